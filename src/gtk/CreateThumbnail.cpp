@@ -22,8 +22,10 @@
 #include "librpbase/common.h"
 #include "librpbase/RomData.hpp"
 #include "librpbase/file/RpFile.hpp"
+#include "librpbase/file/IoBudget.hpp"
 #include "librpbase/img/rp_image.hpp"
 #include "librpbase/img/RpPngWriter.hpp"
+#include "librpbase/config/Config.hpp"
 using namespace LibRpBase;
 
 // libromdata
@@ -247,31 +249,42 @@ G_MODULE_EXPORT int rp_create_thumbnail(const char *source_file, const char *out
 	// ROM file and getting RomData*, but we're doing it here
 	// in order to return better error codes.
 
-	// Attempt to open the ROM file.
-	// TODO: RpGVfsFile wrapper.
-	// For now, using RpFile, which is an stdio wrapper.
-	RpFile *const file = new RpFile(source_file, RpFile::FM_OPEN_READ_GZ);
-	if (!file->isOpen()) {
-		// Could not open the file.
-		file->unref();
-		return RPCT_SOURCE_FILE_ERROR;
-	}
-
-	// Get the appropriate RomData class for this ROM.
-	// RomData class *must* support at least one image type.
-	RomData *romData = RomDataFactory::create(file, RomDataFactory::RDA_HAS_THUMBNAIL);
-	file->unref();	// file is ref()'d by RomData.
-	if (!romData) {
-		// ROM is not supported.
-		return RPCT_SOURCE_FILE_NOT_SUPPORTED;
-	}
-
-	// Create the thumbnail.
-	// TODO: If image is larger than maximum_size, resize down.
 	unique_ptr<CreateThumbnailPrivate> d(new CreateThumbnailPrivate());
+	RomData *romData;
 	PIMGTYPE ret_img = nullptr;
 	rp_image::sBIT_t sBIT;
-	int ret = d->getThumbnail(romData, maximum_size, ret_img, &sBIT);
+	int ret;
+	{
+		// Limit the I/O used for the ROM image.
+		const IoBudget::Limits budgetLimits = Config::instance()->ioBudget();
+		IoBudget budget(budgetLimits);
+		IoBudget::Scope budgetScope(budgetLimits.isEnabled() ? &budget : nullptr);
+
+		// Attempt to open the ROM file.
+		// TODO: RpGVfsFile wrapper.
+		// For now, using RpFile, which is an stdio wrapper.
+		RpFile *const file = new RpFile(source_file, RpFile::FM_OPEN_READ_GZ);
+		if (!file->isOpen()) {
+			// Could not open the file.
+			file->unref();
+			return RPCT_SOURCE_FILE_ERROR;
+		}
+
+		// Get the appropriate RomData class for this ROM.
+		// RomData class *must* support at least one image type.
+		romData = RomDataFactory::create(file, RomDataFactory::RDA_HAS_THUMBNAIL);
+		file->unref();	// file is ref()'d by RomData.
+		if (!romData) {
+			// ROM is not supported.
+			return (budget.isExceeded()
+				? RPCT_SOURCE_FILE_IO_BUDGET
+				: RPCT_SOURCE_FILE_NOT_SUPPORTED);
+		}
+
+		// Create the thumbnail.
+		// TODO: If image is larger than maximum_size, resize down.
+		ret = d->getThumbnail(romData, maximum_size, ret_img, &sBIT);
+	}
 
 	if (ret != 0 || !d->isImgClassValid(ret_img)) {
 		// No image.
@@ -279,7 +292,9 @@ G_MODULE_EXPORT int rp_create_thumbnail(const char *source_file, const char *out
 			d->freeImgClass(ret_img);
 		}
 		romData->unref();
-		return RPCT_SOURCE_FILE_NO_IMAGE;
+		return (ret == RPCT_SOURCE_FILE_IO_BUDGET
+			? RPCT_SOURCE_FILE_IO_BUDGET
+			: RPCT_SOURCE_FILE_NO_IMAGE);
 	}
 
 	// Save the image using RpPngWriter.
@@ -409,6 +424,9 @@ G_MODULE_EXPORT int rp_create_thumbnail(const char *source_file, const char *out
 
 	/** IHDR **/
 
+	// Set the encoding profile.
+	pngWriter->setProfile(Config::instance()->thumbnailPngProfile());
+
 	// If sBIT wasn't found, all fields will be 0.
 	// RpPngWriter will ignore sBIT in this case.
 	pwRet = pngWriter->write_IHDR(&sBIT);
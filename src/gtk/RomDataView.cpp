@@ -27,9 +27,11 @@
 #include "librpbase/RomData.hpp"
 #include "librpbase/RomFields.hpp"
 #include "librpbase/file/RpFile.hpp"
+#include "librpbase/file/IoBudget.hpp"
 #include "librpbase/img/rp_image.hpp"
 #include "librpbase/img/IconAnimData.hpp"
 #include "librpbase/img/IconAnimHelper.hpp"
+#include "librpbase/config/Config.hpp"
 using namespace LibRpBase;
 
 // libi18n
@@ -103,6 +105,11 @@ static void	rom_data_view_desc_format_type_changed(RpDescFormatType desc_format_
 
 static void	rom_data_view_init_header_row	(RomDataView	*page);
 static void	rom_data_view_update_display	(RomDataView	*page);
+static void	rom_data_view_init_fields	(RomDataView	*page,
+						 const RomFields *fields,
+						 int		 tabIdx_filter);
+static void	rom_data_view_load_tab		(RomDataView	*page,
+						 int		 tabIdx);
 static gboolean	rom_data_view_load_rom_data	(gpointer	 data);
 static void	rom_data_view_delete_tabs	(RomDataView	*page);
 
@@ -115,6 +122,10 @@ static void	rom_data_view_unmap_signal_handler  (RomDataView	*page,
 						     gpointer		 user_data);
 static void	tree_view_realize_signal_handler    (GtkTreeView	*treeView,
 						     RomDataView	*page);
+static void	notebook_switch_page_signal_handler (GtkNotebook	*notebook,
+						     GtkWidget		*child,
+						     guint		 page_num,
+						     RomDataView	*page);
 
 /** Icon animation timer. **/
 static void	start_anim_timer(RomDataView *page);
@@ -169,9 +180,13 @@ struct _RomDataView {
 		GtkWidget	*vbox;		// Either page or a GtkVBox/GtkBox.
 		GtkWidget	*table;		// GtkTable (2.x); GtkGrid (3.x)
 		GtkWidget	*lblCredits;
+		int		row;		// Next row in the table.
 	};
 	vector<tab> *tabs;
 
+	// Size group for description labels on all tabs.
+	GtkSizeGroup	*size_group;
+
 	// Description labels.
 	RpDescFormatType		desc_format_type;
 	vector<GtkWidget*>		*vecDescLabels;
@@ -313,6 +328,7 @@ rom_data_view_init(RomDataView *page)
 	page->iconAnimHelper = new IconAnimHelper();
 	page->tabWidget = nullptr;
 	page->tabs = new vector<RomDataView::tab>();
+	page->size_group = nullptr;
 
 	page->desc_format_type = RP_DFT_XFCE;
 	page->vecDescLabels = new vector<GtkWidget*>();
@@ -1223,16 +1239,14 @@ rom_data_view_update_display(RomDataView *page)
 	}
 
 	// Get the fields.
-	const RomFields *fields = page->romData->fields();
+	// NOTE: Tabs with tab loaders are loaded when selected.
+	const RomFields *fields = page->romData->fieldsLazy();
 	if (!fields) {
 		// No fields.
 		// TODO: Show an error?
 		return;
 	}
 	const int count = fields->count();
-#if !GTK_CHECK_VERSION(3,0,0)
-	int rowCount = count;
-#endif
 
 	// Create the GtkNotebook.
 	int tabCount = fields->tabCount();
@@ -1261,7 +1275,7 @@ rom_data_view_update_display(RomDataView *page)
 #else
 			tab.vbox = gtk_vbox_new(false, 8);
 			// TODO: Adjust the table size?
-			tab.table = gtk_table_new(rowCount, 2, false);
+			tab.table = gtk_table_new(count, 2, false);
 			gtk_table_set_row_spacings(GTK_TABLE(tab.table), 2);
 			gtk_table_set_col_spacings(GTK_TABLE(tab.table), 8);
 #endif
@@ -1304,20 +1318,48 @@ rom_data_view_update_display(RomDataView *page)
 
 	// Reserve enough space for vecDescLabels.
 	page->vecDescLabels->reserve(count);
-	// Per-tab row counts.
-	vector<int> tabRowCount(page->tabs->size());
 
 	// Use a GtkSizeGroup to ensure that the description
 	// labels on all tabs have the same width.
-	// NOTE: GtkSizeGroup automatically unreferences itself
-	// once all referenced widgets are deleted, so we don't
-	// need to manage it ourselves.
-	GtkSizeGroup *const size_group = gtk_size_group_new(GTK_SIZE_GROUP_HORIZONTAL);
+	// NOTE: A reference is kept so tabs that are loaded
+	// later can use the same GtkSizeGroup.
+	page->size_group = gtk_size_group_new(GTK_SIZE_GROUP_HORIZONTAL);
+
+	// Create the data widgets.
+	rom_data_view_init_fields(page, fields, -1);
+
+	if (page->tabWidget) {
+		// Load the remaining tabs when they're selected.
+		g_signal_connect(page->tabWidget, "switch-page",
+			G_CALLBACK(notebook_switch_page_signal_handler), page);
+
+		// Load the current tab if it hasn't been loaded yet.
+		const int cur_page = gtk_notebook_get_current_page(GTK_NOTEBOOK(page->tabWidget));
+		if (cur_page >= 0) {
+			notebook_switch_page_signal_handler(GTK_NOTEBOOK(page->tabWidget),
+				gtk_notebook_get_nth_page(GTK_NOTEBOOK(page->tabWidget), cur_page),
+				static_cast<guint>(cur_page), page);
+		}
+	}
+}
+
+/**
+ * Initialize the data widgets for fields on the specified tab.
+ * @param page RomDataView
+ * @param fields RomFields
+ * @param tabIdx_filter Tab index, or -1 for all tabs.
+ */
+static void
+rom_data_view_init_fields(RomDataView *page, const RomFields *fields, int tabIdx_filter)
+{
+	assert(page != nullptr);
+	assert(fields != nullptr);
 
 	// tr: Field description label.
 	const char *const desc_label_fmt = C_("RomDataView", "%s:");
 
 	// Create the data widgets.
+	const int count = fields->count();
 	for (int i = 0; i < count; i++) {
 		const RomFields::Field *const field = fields->field(i);
 		assert(field != nullptr);
@@ -1330,6 +1372,9 @@ rom_data_view_update_display(RomDataView *page)
 		if (tabIdx < 0 || tabIdx >= (int)page->tabs->size()) {
 			// Tab index is out of bounds.
 			continue;
+		} else if (tabIdx_filter >= 0 && tabIdx != tabIdx_filter) {
+			// Not the requested tab.
+			continue;
 		} else if (!page->tabs->at(tabIdx).table) {
 			// Tab name is empty. Tab is hidden.
 			continue;
@@ -1372,11 +1417,11 @@ rom_data_view_update_display(RomDataView *page)
 			auto &tab = page->tabs->at(tabIdx);
 
 			// tr: Field description label.
-			string txt = rp_sprintf(desc_label_fmt, field->name.c_str());
+			string txt = rp_sprintf(desc_label_fmt, field->name);
 			GtkWidget *lblDesc = gtk_label_new(txt.c_str());
 			gtk_label_set_use_underline(GTK_LABEL(lblDesc), false);
 			gtk_widget_show(lblDesc);
-			gtk_size_group_add_widget(size_group, lblDesc);
+			gtk_size_group_add_widget(page->size_group, lblDesc);
 			page->vecDescLabels->push_back(lblDesc);
 
 			// Check if this is an RFT_STRING with warning set.
@@ -1389,7 +1434,7 @@ rom_data_view_update_display(RomDataView *page)
 			set_label_format_type(GTK_LABEL(lblDesc), page->desc_format_type);
 
 			// Value widget.
-			int &row = tabRowCount[tabIdx];
+			int &row = tab.row;
 #if GTK_CHECK_VERSION(3,0,0)
 			// TODO: GTK_FILL
 			gtk_grid_attach(GTK_GRID(tab.table), lblDesc, 0, row, 1, 1);
@@ -1412,8 +1457,8 @@ rom_data_view_update_display(RomDataView *page)
 				// If this is the last field in the tab,
 				// put the RFT_LISTDATA in the GtkGrid instead.
 				bool doVBox = false;
-				if (tabIdx + 1 == tabCount && i == count-1) {
-					// Last tab, and last field.
+				if (i == count-1) {
+					// Last field.
 					doVBox = true;
 				} else {
 					// Check if the next field is on the next tab.
@@ -1476,8 +1521,9 @@ rom_data_view_update_display(RomDataView *page)
 #if GTK_CHECK_VERSION(3,0,0)
 					gtk_grid_attach(GTK_GRID(tab.table), widget, 0, row+1, 2, 1);
 #else
-					rowCount++;
-					gtk_table_resize(GTK_TABLE(tab.table), rowCount, 2);
+					guint n_rows = 0;
+					g_object_get(tab.table, "n-rows", &n_rows, nullptr);
+					gtk_table_resize(GTK_TABLE(tab.table), n_rows+1, 2);
 					gtk_table_attach(GTK_TABLE(tab.table), widget, 0, 2, row+1, row+2,
 						GTK_FILL, GTK_FILL, 0, 0);
 #endif
@@ -1497,6 +1543,40 @@ rom_data_view_update_display(RomDataView *page)
 	}
 }
 
+/**
+ * Load a tab that has a tab loader and initialize its data widgets.
+ * @param page RomDataView
+ * @param tabIdx Tab index.
+ */
+static void
+rom_data_view_load_tab(RomDataView *page, int tabIdx)
+{
+	assert(page != nullptr);
+	if (!page->romData)
+		return;
+
+	const RomFields *const fields = page->romData->fieldsLazy();
+	if (!fields || fields->isTabLoaded(tabIdx)) {
+		// Tab has already been loaded.
+		return;
+	}
+
+	// Limit the I/O used for the ROM image.
+	const IoBudget::Limits budgetLimits = Config::instance()->ioBudget();
+	IoBudget budget(budgetLimits);
+	IoBudget::Scope budgetScope(budgetLimits.isEnabled() ? &budget : nullptr);
+
+	if (fields->loadTab(tabIdx) > 0) {
+		rom_data_view_init_fields(page, fields, tabIdx);
+	}
+
+	if (!fields->hasPendingTabs()) {
+		// All tabs have been loaded.
+		// Close the file, since we don't need it anymore.
+		page->romData->close();
+	}
+}
+
 static gboolean
 rom_data_view_load_rom_data(gpointer data)
 {
@@ -1507,6 +1587,11 @@ rom_data_view_load_rom_data(gpointer data)
 	// Open the ROM file.
 	// TODO: gvfs support.
 	if (G_LIKELY(page->filename != nullptr)) {
+		// Limit the I/O used for the ROM image.
+		const IoBudget::Limits budgetLimits = Config::instance()->ioBudget();
+		IoBudget budget(budgetLimits);
+		IoBudget::Scope budgetScope(budgetLimits.isEnabled() ? &budget : nullptr);
+
 		// Open the ROM file.
 		RpFile *const file = new RpFile(page->filename, RpFile::FM_OPEN_READ_GZ);
 		if (file->isOpen()) {
@@ -1520,8 +1605,13 @@ rom_data_view_load_rom_data(gpointer data)
 			// Make sure the underlying file handle is closed,
 			// since we don't need it once the RomData has been
 			// loaded by RomDataView.
+			// NOTE: If some tabs haven't been loaded yet, the
+			// file will be closed once they're loaded.
 			if (page->romData) {
-				page->romData->close();
+				const RomFields *const fields = page->romData->fieldsLazy();
+				if (!fields || !fields->hasPendingTabs()) {
+					page->romData->close();
+				}
 			}
 		}
 		file->unref();
@@ -1561,6 +1651,11 @@ rom_data_view_delete_tabs(RomDataView *page)
 	}
 	page->tabs->clear();
 
+	if (page->size_group) {
+		g_object_unref(page->size_group);
+		page->size_group = nullptr;
+	}
+
 	if (page->tabWidget) {
 		// Delete the tab widget.
 		gtk_widget_destroy(page->tabWidget);
@@ -1626,6 +1721,34 @@ rom_data_view_unmap_signal_handler(RomDataView	*page,
 	stop_anim_timer(page);
 }
 
+/**
+ * GtkNotebook page has been switched.
+ * Tabs that haven't been loaded yet are loaded here.
+ * @param notebook GtkNotebook
+ * @param child New page widget.
+ * @param page_num New page number.
+ * @param page RomDataView
+ */
+static void
+notebook_switch_page_signal_handler(GtkNotebook	*notebook,
+				    GtkWidget	*child,
+				    guint	 page_num,
+				    RomDataView	*page)
+{
+	RP_UNUSED(notebook);
+	RP_UNUSED(page_num);
+
+	// NOTE: Hidden tabs don't have notebook pages,
+	// so the page number might not match the tab index.
+	const int tabCount = static_cast<int>(page->tabs->size());
+	for (int i = 0; i < tabCount; i++) {
+		if (page->tabs->at(i).vbox == child) {
+			rom_data_view_load_tab(page, i);
+			break;
+		}
+	}
+}
+
 /**
  * GtkTreeView widget has been realized.
  * @param treeView GtkTreeView
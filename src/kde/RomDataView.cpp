@@ -26,9 +26,11 @@
 #include "librpbase/RomData.hpp"
 #include "librpbase/RomFields.hpp"
 #include "librpbase/TextFuncs.hpp"
+#include "librpbase/file/IoBudget.hpp"
 #include "librpbase/img/rp_image.hpp"
 #include "librpbase/img/IconAnimData.hpp"
 #include "librpbase/img/IconAnimHelper.hpp"
+#include "librpbase/config/Config.hpp"
 using namespace LibRpBase;
 
 // libi18n
@@ -165,6 +167,13 @@ class RomDataViewPrivate
 		 */
 		void initDimensions(QLabel *lblDesc, const RomFields::Field *field);
 
+		/**
+		 * Initialize the data widgets for fields on the specified tab.
+		 * @param fields RomFields
+		 * @param tabIdx_filter Tab index, or -1 for all tabs.
+		 */
+		void initFields(const RomFields *fields, int tabIdx_filter);
+
 		/**
 		 * Initialize the display widgets.
 		 * If the widgets already exist, they will
@@ -172,6 +181,12 @@ class RomDataViewPrivate
 		 */
 		void initDisplayWidgets(void);
 
+		/**
+		 * Load a tab that has a tab loader and initialize its data widgets.
+		 * @param tabIdx Tab index.
+		 */
+		void loadTab(int tabIdx);
+
 		/**
 		 * Start the animation timer.
 		 */
@@ -916,19 +931,23 @@ void RomDataViewPrivate::initDisplayWidgets(void)
 	}
 
 	// Get the fields.
-	const RomFields *fields = romData->fields();
+	// NOTE: Tabs with tab loaders are loaded when selected.
+	const RomFields *fields = romData->fieldsLazy();
 	if (!fields) {
 		// No fields.
 		// TODO: Show an error?
 		return;
 	}
-	const int count = fields->count();
 
 	// Create the QTabWidget.
+	// NOTE: Signals are blocked while adding tabs, since
+	// currentChanged() would otherwise load the first tab
+	// before the other fields are initialized.
 	Q_Q(RomDataView);
 	const int tabCount = fields->tabCount();
 	if (tabCount > 1) {
 		tabs.resize(tabCount);
+		ui.tabWidget->blockSignals(true);
 		ui.tabWidget->show();
 		for (int i = 0; i < tabCount; i++) {
 			// Create a tab.
@@ -951,6 +970,7 @@ void RomDataViewPrivate::initDisplayWidgets(void)
 			// Add the tab.
 			ui.tabWidget->addTab(widget, (name ? U82Q(name) : QString()));
 		}
+		ui.tabWidget->blockSignals(false);
 	} else {
 		// No tabs.
 		// Don't create a QTabWidget, but simulate a single
@@ -971,11 +991,40 @@ void RomDataViewPrivate::initDisplayWidgets(void)
 	// TODO: Ensure the description column has the
 	// same width on all tabs.
 
+	// Create the data widgets.
+	initFields(fields, -1);
+
+	if (tabCount > 1) {
+		// Load the current tab if it hasn't been loaded yet.
+		// Other tabs are loaded when they're selected.
+		q->tabWidget_currentChanged(ui.tabWidget->currentIndex());
+	}
+
+	// Close the file.
+	// Keeping the file open may prevent the user from
+	// changing the file.
+	// NOTE: If some tabs haven't been loaded yet, the
+	// file will be closed once they're loaded.
+	if (!fields->hasPendingTabs()) {
+		romData->close();
+	}
+}
+
+/**
+ * Initialize the data widgets for fields on the specified tab.
+ * @param fields RomFields
+ * @param tabIdx_filter Tab index, or -1 for all tabs.
+ */
+void RomDataViewPrivate::initFields(const RomFields *fields, int tabIdx_filter)
+{
+	Q_Q(RomDataView);
+
 	// tr: Field description label.
 	const char *const desc_label_fmt = C_("RomDataView", "%s:");
 
 	// Create the data widgets.
-	int prevTabIdx = 0;
+	const int count = fields->count();
+	int prevTabIdx = (tabIdx_filter >= 0 ? tabIdx_filter : 0);
 	for (int i = 0; i < count; i++) {
 		const RomFields::Field *const field = fields->field(i);
 		assert(field != nullptr);
@@ -988,6 +1037,9 @@ void RomDataViewPrivate::initDisplayWidgets(void)
 		if (tabIdx < 0 || tabIdx >= (int)tabs.size()) {
 			// Tab index is out of bounds.
 			continue;
+		} else if (tabIdx_filter >= 0 && tabIdx != tabIdx_filter) {
+			// Not the requested tab.
+			continue;
 		} else if (!tabs[tabIdx].formLayout) {
 			// Tab name is empty. Tab is hidden.
 			continue;
@@ -1003,7 +1055,7 @@ void RomDataViewPrivate::initDisplayWidgets(void)
 		}
 
 		// tr: Field description label.
-		string txt = rp_sprintf(desc_label_fmt, field->name.c_str());
+		string txt = rp_sprintf(desc_label_fmt, field->name);
 		QLabel *lblDesc = new QLabel(U82Q(txt.c_str()), q);
 		lblDesc->setAlignment(Qt::AlignLeft | Qt::AlignTop);
 		lblDesc->setTextFormat(Qt::PlainText);
@@ -1043,14 +1095,40 @@ void RomDataViewPrivate::initDisplayWidgets(void)
 	// Check if the last field in the last tab
 	// was RFT_LISTDATA. If it is, expand it vertically.
 	// NOTE: Only for RFT_LISTDATA_SEPARATE_ROW.
-	if (!tabs.empty()) {
-		adjustListData(static_cast<int>(tabs.size()-1));
+	if (prevTabIdx < (int)tabs.size() && tabs[prevTabIdx].formLayout) {
+		adjustListData(prevTabIdx);
 	}
+}
 
-	// Close the file.
-	// Keeping the file open may prevent the user from
-	// changing the file.
-	romData->close();
+/**
+ * Load a tab that has a tab loader and initialize its data widgets.
+ * @param tabIdx Tab index.
+ */
+void RomDataViewPrivate::loadTab(int tabIdx)
+{
+	if (!romData)
+		return;
+
+	const RomFields *const fields = romData->fieldsLazy();
+	if (!fields || fields->isTabLoaded(tabIdx)) {
+		// Tab has already been loaded.
+		return;
+	}
+
+	// Limit the I/O used for the ROM image.
+	const IoBudget::Limits budgetLimits = Config::instance()->ioBudget();
+	IoBudget budget(budgetLimits);
+	IoBudget::Scope budgetScope(budgetLimits.isEnabled() ? &budget : nullptr);
+
+	if (fields->loadTab(tabIdx) > 0) {
+		initFields(fields, tabIdx);
+	}
+
+	if (!fields->hasPendingTabs()) {
+		// All tabs have been loaded.
+		// Close the file, since we don't need it anymore.
+		romData->close();
+	}
 }
 
 /**
@@ -1101,6 +1179,10 @@ RomDataView::RomDataView(QWidget *parent)
 	Q_D(RomDataView);
 	d->ui.setupUi(this);
 
+	// Tabs with tab loaders are loaded when selected.
+	QObject::connect(d->ui.tabWidget, SIGNAL(currentChanged(int)),
+		this, SLOT(tabWidget_currentChanged(int)));
+
 	// No display widgets to initialize...
 }
 
@@ -1111,6 +1193,10 @@ RomDataView::RomDataView(RomData *romData, QWidget *parent)
 	Q_D(RomDataView);
 	d->ui.setupUi(this);
 
+	// Tabs with tab loaders are loaded when selected.
+	QObject::connect(d->ui.tabWidget, SIGNAL(currentChanged(int)),
+		this, SLOT(tabWidget_currentChanged(int)));
+
 	// Initialize the display widgets.
 	d->initDisplayWidgets();
 }
@@ -1241,6 +1327,30 @@ void RomDataView::bitfield_toggled_slot(bool checked)
 	}
 }
 
+/**
+ * The current tab has changed.
+ * Tabs that haven't been loaded yet are loaded here.
+ * @param index New tab index.
+ */
+void RomDataView::tabWidget_currentChanged(int index)
+{
+	Q_D(RomDataView);
+	if (index < 0)
+		return;
+
+	// NOTE: Hidden tabs don't have QTabWidget pages,
+	// so the page index might not match the tab index.
+	QWidget *const widget = d->ui.tabWidget->widget(index);
+	const int tabCount = static_cast<int>(d->tabs.size());
+	for (int i = 0; i < tabCount; i++) {
+		const QVBoxLayout *const vboxLayout = d->tabs[i].vboxLayout;
+		if (vboxLayout && vboxLayout->parentWidget() == widget) {
+			d->loadTab(i);
+			break;
+		}
+	}
+}
+
 /**
  * Animated icon timer.
  */
@@ -78,6 +78,13 @@ class RomDataView : public QWidget
 		 */
 		void bitfield_toggled_slot(bool checked);
 
+		/**
+		 * The current tab has changed.
+		 * Tabs that haven't been loaded yet are loaded here.
+		 * @param index New tab index.
+		 */
+		void tabWidget_currentChanged(int index);
+
 		/**
 		 * Animated icon timer.
 		 */
@@ -33,6 +33,10 @@
 // librpbase
 #include "librpbase/RomData.hpp"
 #include "librpbase/file/RpFile.hpp"
+#include "librpbase/file/IoBudget.hpp"
+#include "librpbase/config/Config.hpp"
+using LibRpBase::Config;
+using LibRpBase::IoBudget;
 using LibRpBase::RomData;
 using LibRpBase::RpFile;
 
@@ -71,6 +75,11 @@ RomPropertiesDialogPlugin::RomPropertiesDialogPlugin(KPropertiesDialog *props, c
 		return;
 	}
 
+	// Limit the I/O used for the ROM image.
+	const IoBudget::Limits budgetLimits = Config::instance()->ioBudget();
+	IoBudget budget(budgetLimits);
+	IoBudget::Scope budgetScope(budgetLimits.isEnabled() ? &budget : nullptr);
+
 	// Single file, and it's local.
 	// TODO: Use KIO and transparent decompression?
 	// TODO: RpQFile wrapper.
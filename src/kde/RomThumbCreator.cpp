@@ -25,8 +25,10 @@
 // librpbase
 #include "librpbase/RomData.hpp"
 #include "librpbase/TextFuncs.hpp"
+#include "librpbase/file/IoBudget.hpp"
 #include "librpbase/img/rp_image.hpp"
 #include "librpbase/img/RpPngWriter.hpp"
+#include "librpbase/config/Config.hpp"
 using namespace LibRpBase;
 
 // libromdata
@@ -308,37 +310,50 @@ Q_DECL_EXPORT int rp_create_thumbnail(const char *source_file, const char *outpu
 	// TODO: Static initializer somewhere?
 	rp_image::setBackendCreatorFn(RpQImageBackend::creator_fn);
 
-	// Attempt to open the ROM file.
-	// TODO: RpQFile wrapper.
-	// For now, using RpFile, which is an stdio wrapper.
-	IRpFile *const file = new RpFile(source_file, RpFile::FM_OPEN_READ_GZ);
-	if (!file->isOpen()) {
-		// Could not open the file.
-		file->unref();
-		return RPCT_SOURCE_FILE_ERROR;
-	}
-
-	// Get the appropriate RomData class for this ROM.
-	// RomData class *must* support at least one image type.
-	RomData *romData = RomDataFactory::create(file, RomDataFactory::RDA_HAS_THUMBNAIL);
-	file->unref();	// file is ref()'d by RomData.
-	if (!romData) {
-		// ROM is not supported.
-		return RPCT_SOURCE_FILE_NOT_SUPPORTED;
-	}
-
-	// Create the thumbnail.
-	// TODO: If image is larger than maximum_size, resize down.
-	RomThumbCreatorPrivate *const d = new RomThumbCreatorPrivate();
+	RomData *romData;
 	QImage ret_img;
 	rp_image::sBIT_t sBIT;
-	int ret = d->getThumbnail(romData, maximum_size, ret_img, &sBIT);
-	delete d;
+	int ret;
+	{
+		// Limit the I/O used for the ROM image.
+		const IoBudget::Limits budgetLimits = Config::instance()->ioBudget();
+		IoBudget budget(budgetLimits);
+		IoBudget::Scope budgetScope(budgetLimits.isEnabled() ? &budget : nullptr);
+
+		// Attempt to open the ROM file.
+		// TODO: RpQFile wrapper.
+		// For now, using RpFile, which is an stdio wrapper.
+		IRpFile *const file = new RpFile(source_file, RpFile::FM_OPEN_READ_GZ);
+		if (!file->isOpen()) {
+			// Could not open the file.
+			file->unref();
+			return RPCT_SOURCE_FILE_ERROR;
+		}
+
+		// Get the appropriate RomData class for this ROM.
+		// RomData class *must* support at least one image type.
+		romData = RomDataFactory::create(file, RomDataFactory::RDA_HAS_THUMBNAIL);
+		file->unref();	// file is ref()'d by RomData.
+		if (!romData) {
+			// ROM is not supported.
+			return (budget.isExceeded()
+				? RPCT_SOURCE_FILE_IO_BUDGET
+				: RPCT_SOURCE_FILE_NOT_SUPPORTED);
+		}
+
+		// Create the thumbnail.
+		// TODO: If image is larger than maximum_size, resize down.
+		RomThumbCreatorPrivate *const d = new RomThumbCreatorPrivate();
+		ret = d->getThumbnail(romData, maximum_size, ret_img, &sBIT);
+		delete d;
+	}
 
 	if (ret != 0 || ret_img.isNull()) {
 		// No image.
 		romData->unref();
-		return RPCT_SOURCE_FILE_NO_IMAGE;
+		return (ret == RPCT_SOURCE_FILE_IO_BUDGET
+			? RPCT_SOURCE_FILE_IO_BUDGET
+			: RPCT_SOURCE_FILE_NO_IMAGE);
 	}
 
 	// Save the image using RpPngWriter.
@@ -428,6 +443,9 @@ Q_DECL_EXPORT int rp_create_thumbnail(const char *source_file, const char *outpu
 
 	/** IHDR **/
 
+	// Set the encoding profile.
+	pngWriter->setProfile(Config::instance()->thumbnailPngProfile());
+
 	// CI8 palette.
 	// This will be an empty vector if the image isn't CI8.
 	// RpPngWriter will ignore the palette arguments in that case.
@@ -111,8 +111,8 @@ void RpExtractorPlugin::extract(ExtractionResult *result)
 	}
 
 	// Get the appropriate RomData class for this ROM.
-	// RomData class *must* support at least one image type.
-	RomData *const romData = RomDataFactory::create(file);
+	// Only metadata is needed, so use metadata-only mode.
+	RomData *const romData = RomDataFactory::create(file, RomDataFactory::RDA_METADATA_ONLY);
 	file->unref();	// file is ref()'d by RomData.
 	if (!romData) {
 		// ROM is not supported.
@@ -0,0 +1,877 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libcachemgr)                      *
+ * CacheIndex.cpp: Memory-mapped index of cached files.                    *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "CacheIndex.hpp"
+#include "CacheManager.hpp"
+#include "CacheMetadata.hpp"
+
+// librpbase
+#include "librpbase/file/FileSystem.hpp"
+using namespace LibRpBase;
+
+// C includes.
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// C includes. (C++ namespace)
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+
+// C++ includes.
+#include <algorithm>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+using std::pair;
+using std::string;
+using std::unordered_set;
+using std::vector;
+
+namespace LibCacheMgr {
+
+/** Index file format. **/
+// NOTE: The index is stored in host byte order,
+// since it's only used on the local system.
+
+#define CACHE_INDEX_MAGIC	0x49435052	// "RPCI"
+#define CACHE_INDEX_VERSION	1
+
+// Initial number of slots. (must be a power of 2)
+#define CACHE_INDEX_DEFAULT_CAPACITY	1024
+
+// Special hash values.
+#define CACHE_INDEX_HASH_EMPTY		0ULL
+#define CACHE_INDEX_HASH_DELETED	1ULL
+
+#define CACHE_INDEX_KEY_MAX	160
+#define CACHE_INDEX_ORIGIN_MAX	56
+
+struct CacheIndexHeader {
+	uint32_t magic;		// CACHE_INDEX_MAGIC
+	uint32_t version;	// CACHE_INDEX_VERSION
+	uint32_t capacity;	// Number of slots. (power of 2)
+	uint32_t count;		// Number of entries.
+	uint32_t tombstones;	// Number of deleted slots.
+	uint32_t reserved1;
+	uint64_t total_size;	// Total size of all cached files.
+	uint8_t reserved2[32];
+};
+ASSERT_STRUCT(CacheIndexHeader, 64);
+
+struct CacheIndexEntry {
+	uint64_t hash;		// Key hash. (CACHE_INDEX_HASH_EMPTY or _DELETED for unused slots)
+	uint64_t size;		// File size, in bytes.
+	int64_t last_access;	// Last access time.
+	int64_t checked;	// Last time the file was downloaded or revalidated.
+	uint32_t failures;	// Number of consecutive failed downloads.
+	uint16_t key_len;	// Key length.
+	uint8_t origin_len;	// Origin length.
+	uint8_t reserved;
+	char key[CACHE_INDEX_KEY_MAX];		// Key. (NOT NULL-terminated)
+	char origin[CACHE_INDEX_ORIGIN_MAX];	// Origin. (NOT NULL-terminated)
+};
+ASSERT_STRUCT(CacheIndexEntry, 256);
+
+// Index filename, relative to the cache directory.
+const char CacheIndex::INDEX_FILENAME[] = "cache.idx";
+
+// Filename prefix for temporary files used while downloading.
+const char CacheIndex::TEMP_PREFIX[] = ".rptmp.";
+
+/**
+ * Hash a key using 64-bit FNV-1a.
+ * @param key Key.
+ * @return Hash. (never CACHE_INDEX_HASH_EMPTY or _DELETED)
+ */
+static inline uint64_t hashKey(const string &key)
+{
+	uint64_t hash = 0xCBF29CE484222325ULL;
+	for (auto iter = key.cbegin(); iter != key.cend(); ++iter) {
+		hash ^= static_cast<uint8_t>(*iter);
+		hash *= 0x100000001B3ULL;
+	}
+	if (hash <= CACHE_INDEX_HASH_DELETED) {
+		hash += 2;
+	}
+	return hash;
+}
+
+/**
+ * Get the entries array.
+ * @param header Index header.
+ * @return Entries array.
+ */
+static inline CacheIndexEntry *entries(CacheIndexHeader *header)
+{
+	return reinterpret_cast<CacheIndexEntry*>(header + 1);
+}
+
+/**
+ * Lock the index for the lifetime of this object.
+ *
+ * If the index was resized by another process, it's remapped.
+ * If it's missing or invalid, it's rebuilt by scanning the
+ * cache directory. (This upgrades a shared lock to exclusive.)
+ */
+class CacheIndex::Locker
+{
+	public:
+		Locker(CacheIndex *index, bool exclusive)
+			: m_index(index)
+			, m_flocked(false)
+			, ok(false)
+		{
+			m_index->m_mutex.lock();
+			if (m_index->m_fd < 0)
+				return;
+
+			// If the index file was deleted, e.g. because the
+			// cache directory was cleared, open a new one.
+			struct stat sb;
+			if (fstat(m_index->m_fd, &sb) == 0 && sb.st_nlink == 0) {
+				const string index_filename = m_index->m_cacheDir + '/' + INDEX_FILENAME;
+				const int fd = ::open(index_filename.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+				if (fd < 0)
+					return;
+				m_index->unmap();
+				::close(m_index->m_fd);
+				m_index->m_fd = fd;
+			}
+
+			while (flock(m_index->m_fd, exclusive ? LOCK_EX : LOCK_SH) != 0) {
+				if (errno != EINTR)
+					return;
+			}
+			m_flocked = true;
+
+			// Another process may have resized the index.
+			if (!m_index->m_header || m_index->m_header->capacity != m_index->m_capacity) {
+				m_index->map(0);
+			}
+			if (m_index->isValid()) {
+				ok = true;
+				return;
+			}
+
+			// Index is missing or invalid. Rebuild it.
+			// This requires an exclusive lock.
+			if (!exclusive) {
+				while (flock(m_index->m_fd, LOCK_EX) != 0) {
+					if (errno != EINTR)
+						return;
+				}
+
+				// Another process may have rebuilt the index
+				// while the lock was being upgraded.
+				m_index->map(0);
+				if (m_index->isValid()) {
+					ok = true;
+					return;
+				}
+			}
+			if (m_index->init(CACHE_INDEX_DEFAULT_CAPACITY) == 0) {
+				m_index->scanDir(string());
+				ok = true;
+			}
+		}
+
+		~Locker()
+		{
+			if (m_flocked) {
+				flock(m_index->m_fd, LOCK_UN);
+			}
+			m_index->m_mutex.unlock();
+		}
+
+	private:
+		RP_DISABLE_COPY(Locker)
+		CacheIndex *const m_index;
+		bool m_flocked;
+
+	public:
+		bool ok;
+};
+
+CacheIndex::CacheIndex()
+	: m_fd(-1)
+	, m_header(nullptr)
+	, m_mapSize(0)
+	, m_capacity(0)
+{ }
+
+CacheIndex::~CacheIndex()
+{
+	close();
+}
+
+/**
+ * Open the index for a cache directory.
+ * If the index doesn't exist or is invalid, it will be
+ * rebuilt by scanning the cache directory.
+ * @param cache_dir Cache directory.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int CacheIndex::open(const string &cache_dir)
+{
+	close();
+	if (cache_dir.empty())
+		return -EINVAL;
+
+	m_cacheDir = cache_dir;
+	while (m_cacheDir.size() > 1 && m_cacheDir[m_cacheDir.size()-1] == '/') {
+		m_cacheDir.resize(m_cacheDir.size()-1);
+	}
+
+	// Make sure the cache directory exists.
+	// NOTE: rmkdir() ignores the last path component.
+	const string index_filename = m_cacheDir + '/' + INDEX_FILENAME;
+	if (FileSystem::rmkdir(index_filename) != 0) {
+		return -EIO;
+	}
+
+	m_fd = ::open(index_filename.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+	if (m_fd < 0) {
+		return -errno;
+	}
+
+	// Validate the index, or rebuild it if necessary.
+	bool ok;
+	{
+		Locker lock(this, true);
+		ok = lock.ok;
+	}
+	if (!ok) {
+		close();
+		return -EIO;
+	}
+	return 0;
+}
+
+/**
+ * Close the index.
+ */
+void CacheIndex::close(void)
+{
+	unmap();
+	if (m_fd >= 0) {
+		::close(m_fd);
+		m_fd = -1;
+	}
+}
+
+/**
+ * Map the index file.
+ * @param capacity Number of slots. (If 0, use the current file size.)
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int CacheIndex::map(uint32_t capacity)
+{
+	unmap();
+
+	size_t size;
+	if (capacity == 0) {
+		struct stat sb;
+		if (fstat(m_fd, &sb) != 0)
+			return -errno;
+		if (sb.st_size < (off_t)sizeof(CacheIndexHeader))
+			return -EINVAL;
+		size = static_cast<size_t>(sb.st_size);
+	} else {
+		size = sizeof(CacheIndexHeader) + (size_t)capacity * sizeof(CacheIndexEntry);
+		if (ftruncate(m_fd, size) != 0)
+			return -errno;
+	}
+
+	void *const ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+	if (ptr == MAP_FAILED)
+		return -errno;
+
+	m_header = static_cast<CacheIndexHeader*>(ptr);
+	m_mapSize = size;
+	m_capacity = m_header->capacity;
+	return 0;
+}
+
+/**
+ * Unmap the index file.
+ */
+void CacheIndex::unmap(void)
+{
+	if (m_header) {
+		munmap(m_header, m_mapSize);
+		m_header = nullptr;
+		m_mapSize = 0;
+		m_capacity = 0;
+	}
+}
+
+/**
+ * Is the mapped index valid?
+ * @return True if valid; false if not.
+ */
+bool CacheIndex::isValid(void) const
+{
+	if (!m_header)
+		return false;
+	const uint32_t capacity = m_header->capacity;
+	return (m_header->magic == CACHE_INDEX_MAGIC &&
+		m_header->version == CACHE_INDEX_VERSION &&
+		capacity != 0 && (capacity & (capacity - 1)) == 0 &&
+		m_mapSize == sizeof(CacheIndexHeader) + (size_t)capacity * sizeof(CacheIndexEntry) &&
+		m_header->count + m_header->tombstones <= capacity);
+}
+
+/**
+ * Initialize an empty index with the specified capacity.
+ * The index must be locked exclusively.
+ * @param capacity Number of slots. (power of 2)
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int CacheIndex::init(uint32_t capacity)
+{
+	assert(capacity != 0 && (capacity & (capacity - 1)) == 0);
+
+	// Truncate the file first so the new slots are zeroed.
+	unmap();
+	if (ftruncate(m_fd, 0) != 0)
+		return -errno;
+	int ret = map(capacity);
+	if (ret != 0)
+		return ret;
+
+	memset(m_header, 0, sizeof(*m_header));
+	m_header->magic = CACHE_INDEX_MAGIC;
+	m_header->version = CACHE_INDEX_VERSION;
+	m_header->capacity = capacity;
+	m_capacity = capacity;
+	return 0;
+}
+
+/**
+ * Find an entry in the hash table.
+ * The index must be locked.
+ * @param key Key.
+ * @param hash Key hash.
+ * @param pInsert [out,opt] Slot to use if inserting the key.
+ * @return Entry, or nullptr if not found.
+ */
+CacheIndexEntry *CacheIndex::find(const string &key, uint64_t hash, CacheIndexEntry **pInsert)
+{
+	CacheIndexEntry *const tbl = entries(m_header);
+	const uint32_t mask = m_header->capacity - 1;
+	CacheIndexEntry *tombstone = nullptr;
+
+	// Linear probing.
+	uint32_t idx = static_cast<uint32_t>(hash) & mask;
+	for (uint32_t i = m_header->capacity; i > 0; i--, idx = (idx + 1) & mask) {
+		CacheIndexEntry *const entry = &tbl[idx];
+		if (entry->hash == CACHE_INDEX_HASH_EMPTY) {
+			// End of the probe sequence.
+			if (pInsert) {
+				*pInsert = (tombstone ? tombstone : entry);
+			}
+			return nullptr;
+		} else if (entry->hash == CACHE_INDEX_HASH_DELETED) {
+			// Deleted slot. This can be reused for insertion.
+			if (!tombstone) {
+				tombstone = entry;
+			}
+		} else if (entry->hash == hash && entry->key_len == key.size() &&
+			   !memcmp(entry->key, key.data(), key.size()))
+		{
+			// Found the entry.
+			return entry;
+		}
+	}
+
+	// Table is full.
+	if (pInsert) {
+		*pInsert = tombstone;
+	}
+	return nullptr;
+}
+
+/**
+ * Grow the hash table if it's too full to insert an entry.
+ * The index must be locked exclusively.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int CacheIndex::reserveSlot(void)
+{
+	// Maximum load factor is 75%, including deleted slots.
+	const uint32_t capacity = m_header->capacity;
+	if ((uint64_t)(m_header->count + m_header->tombstones + 1) * 4 <= (uint64_t)capacity * 3)
+		return 0;
+
+	// Double the capacity if there are too many entries.
+	// Otherwise, just remove the deleted slots.
+	uint32_t new_capacity = capacity;
+	while ((uint64_t)(m_header->count + 1) * 2 > new_capacity) {
+		if (new_capacity >= 0x10000000U)
+			return -ENOSPC;
+		new_capacity *= 2;
+	}
+
+	// Save the entries, then rebuild the table.
+	vector<CacheIndexEntry> saved;
+	saved.reserve(m_header->count);
+	const CacheIndexEntry *const tbl = entries(m_header);
+	for (uint32_t i = 0; i < capacity; i++) {
+		if (tbl[i].hash > CACHE_INDEX_HASH_DELETED) {
+			saved.push_back(tbl[i]);
+		}
+	}
+	const uint64_t total_size = m_header->total_size;
+
+	int ret = init(new_capacity);
+	if (ret != 0)
+		return ret;
+
+	for (auto iter = saved.cbegin(); iter != saved.cend(); ++iter) {
+		CacheIndexEntry *const tbl_new = entries(m_header);
+		uint32_t idx = static_cast<uint32_t>(iter->hash) & (new_capacity - 1);
+		while (tbl_new[idx].hash != CACHE_INDEX_HASH_EMPTY) {
+			idx = (idx + 1) & (new_capacity - 1);
+		}
+		tbl_new[idx] = *iter;
+	}
+	m_header->count = static_cast<uint32_t>(saved.size());
+	m_header->total_size = total_size;
+	return 0;
+}
+
+/**
+ * Find or insert an entry in the hash table.
+ * The index must be locked exclusively.
+ * @param key Key.
+ * @param hash Key hash.
+ * @return Entry, or nullptr on error.
+ */
+CacheIndexEntry *CacheIndex::findOrInsert(const string &key, uint64_t hash)
+{
+	CacheIndexEntry *entry = find(key, hash);
+	if (entry)
+		return entry;
+
+	// Not found. Insert a new entry.
+	if (reserveSlot() != 0)
+		return nullptr;
+	find(key, hash, &entry);
+	if (!entry)
+		return nullptr;
+
+	if (entry->hash == CACHE_INDEX_HASH_DELETED) {
+		m_header->tombstones--;
+	}
+	memset(entry, 0, sizeof(*entry));
+	entry->hash = hash;
+	entry->key_len = static_cast<uint16_t>(key.size());
+	memcpy(entry->key, key.data(), key.size());
+	m_header->count++;
+	return entry;
+}
+
+/**
+ * Get the index key for a cache filename.
+ * @param cache_filename Cache filename. (absolute path)
+ * @return Key, or empty string if the file isn't in the cache directory.
+ */
+string CacheIndex::keyForFilename(const string &cache_filename) const
+{
+	const size_t dir_len = m_cacheDir.size();
+	if (cache_filename.size() <= dir_len + 1 ||
+	    cache_filename.compare(0, dir_len, m_cacheDir) != 0 ||
+	    cache_filename[dir_len] != '/')
+	{
+		return string();
+	}
+	return cache_filename.substr(dir_len + 1);
+}
+
+/**
+ * Look up a cached file.
+ * @param cache_filename	[in] Cache filename. (absolute path)
+ * @param pEntry		[out,opt] Index entry.
+ * @param touch			[in] If true, update the last access time.
+ * @return 1 if found; 0 if not found; negative POSIX error code if the file can't be indexed.
+ */
+int CacheIndex::lookup(const string &cache_filename, Entry *pEntry, bool touch)
+{
+	const string key = keyForFilename(cache_filename);
+	if (key.empty())
+		return -EINVAL;
+	if (key.size() > CACHE_INDEX_KEY_MAX)
+		return -ENAMETOOLONG;
+
+	// Updating the last access time writes to the index,
+	// so an exclusive lock is needed in that case.
+	Locker lock(this, touch);
+	if (!lock.ok)
+		return -EIO;
+
+	CacheIndexEntry *const entry = find(key, hashKey(key));
+	if (!entry)
+		return 0;
+
+	if (touch) {
+		entry->last_access = time(nullptr);
+	}
+
+	if (pEntry) {
+		pEntry->key = key;
+		pEntry->origin.assign(entry->origin, entry->origin_len);
+		pEntry->size = entry->size;
+		pEntry->last_access = static_cast<time_t>(entry->last_access);
+		pEntry->checked = static_cast<time_t>(entry->checked);
+		pEntry->failures = entry->failures;
+	}
+	return 1;
+}
+
+/**
+ * Add or update a cached file.
+ * @param cache_filename	[in] Cache filename. (absolute path)
+ * @param size			[in] File size, or -1 to keep the current size.
+ * @param checked		[in] Last time the file was downloaded or revalidated.
+ * @param failures		[in] Number of consecutive failed downloads.
+ * @param origin		[in] Origin server, or empty string to keep the current origin.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int CacheIndex::update(const string &cache_filename, int64_t size,
+	time_t checked, unsigned int failures, const string &origin)
+{
+	const string key = keyForFilename(cache_filename);
+	if (key.empty())
+		return -EINVAL;
+	if (key.size() > CACHE_INDEX_KEY_MAX)
+		return -ENAMETOOLONG;
+
+	Locker lock(this, true);
+	if (!lock.ok)
+		return -EIO;
+
+	CacheIndexEntry *const entry = findOrInsert(key, hashKey(key));
+	if (!entry)
+		return -ENOSPC;
+
+	if (size >= 0) {
+		m_header->total_size -= entry->size;
+		entry->size = static_cast<uint64_t>(size);
+		m_header->total_size += entry->size;
+	}
+	entry->last_access = time(nullptr);
+	entry->checked = checked;
+	entry->failures = failures;
+	if (!origin.empty()) {
+		const size_t origin_len = std::min(origin.size(), (size_t)CACHE_INDEX_ORIGIN_MAX);
+		memcpy(entry->origin, origin.data(), origin_len);
+		entry->origin_len = static_cast<uint8_t>(origin_len);
+	}
+	return 0;
+}
+
+/**
+ * Remove a cached file from the index.
+ * The file itself is not deleted.
+ * @param cache_filename Cache filename. (absolute path)
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int CacheIndex::remove(const string &cache_filename)
+{
+	const string key = keyForFilename(cache_filename);
+	if (key.empty())
+		return -EINVAL;
+	if (key.size() > CACHE_INDEX_KEY_MAX)
+		return -ENAMETOOLONG;
+
+	Locker lock(this, true);
+	if (!lock.ok)
+		return -EIO;
+
+	CacheIndexEntry *const entry = find(key, hashKey(key));
+	if (!entry)
+		return -ENOENT;
+
+	m_header->total_size -= entry->size;
+	entry->hash = CACHE_INDEX_HASH_DELETED;
+	m_header->count--;
+	m_header->tombstones++;
+	return 0;
+}
+
+/**
+ * Get index statistics.
+ * @param pStats [out] Statistics.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int CacheIndex::stats(Stats *pStats)
+{
+	assert(pStats != nullptr);
+	Locker lock(this, false);
+	if (!lock.ok)
+		return -EIO;
+
+	pStats->count = m_header->count;
+	pStats->negative = 0;
+	pStats->total_size = m_header->total_size;
+	pStats->oldest_access = -1;
+
+	const CacheIndexEntry *const tbl = entries(m_header);
+	for (uint32_t i = 0; i < m_header->capacity; i++) {
+		const CacheIndexEntry *const entry = &tbl[i];
+		if (entry->hash <= CACHE_INDEX_HASH_DELETED)
+			continue;
+		if (entry->failures > 0) {
+			pStats->negative++;
+		}
+		if (pStats->oldest_access < 0 || entry->last_access < pStats->oldest_access) {
+			pStats->oldest_access = static_cast<time_t>(entry->last_access);
+		}
+	}
+	return 0;
+}
+
+/**
+ * Get the total size of all cached files.
+ * @return Total size, in bytes.
+ */
+uint64_t CacheIndex::totalSize(void)
+{
+	Locker lock(this, false);
+	return (lock.ok ? m_header->total_size : 0);
+}
+
+/**
+ * Evict the least-recently used files until the
+ * total size is less than or equal to maxSize.
+ * The files and their metadata are deleted.
+ * @param maxSize Maximum total size, in bytes.
+ * @return Number of bytes freed, or negative POSIX error code on error.
+ */
+int64_t CacheIndex::evict(uint64_t maxSize)
+{
+	Locker lock(this, true);
+	if (!lock.ok)
+		return -EIO;
+	if (m_header->total_size <= maxSize)
+		return 0;
+
+	// Sort the files by last access time.
+	// Negative entries don't have files, so they're skipped.
+	CacheIndexEntry *const tbl = entries(m_header);
+	vector<pair<int64_t, uint32_t> > lru;
+	lru.reserve(m_header->count);
+	for (uint32_t i = 0; i < m_header->capacity; i++) {
+		if (tbl[i].hash > CACHE_INDEX_HASH_DELETED && tbl[i].size > 0) {
+			lru.push_back(std::make_pair(tbl[i].last_access, i));
+		}
+	}
+	std::sort(lru.begin(), lru.end());
+
+	int64_t freed = 0;
+	unordered_set<string> evicted;
+	for (auto iter = lru.cbegin(); iter != lru.cend() && m_header->total_size > maxSize; ++iter) {
+		CacheIndexEntry *const entry = &tbl[iter->second];
+		const string key(entry->key, entry->key_len);
+		const int64_t size = deleteEntry(entry);
+		if (size >= 0) {
+			freed += size;
+			evicted.insert(key);
+		}
+	}
+
+	// Scaled images ("<original>.<size>.rpimg") are useless
+	// without their original images, so evict them, too.
+	const size_t suffix_len = strlen(CacheManager::SCALED_IMAGE_SUFFIX);
+	for (uint32_t i = 0; i < m_header->capacity && !evicted.empty(); i++) {
+		CacheIndexEntry *const entry = &tbl[i];
+		if (entry->hash <= CACHE_INDEX_HASH_DELETED || entry->key_len <= suffix_len)
+			continue;
+		const string key(entry->key, entry->key_len);
+		if (key.compare(key.size() - suffix_len, suffix_len, CacheManager::SCALED_IMAGE_SUFFIX) != 0)
+			continue;
+
+		// Remove ".<size>.rpimg" to get the original image's key.
+		const size_t dot = key.rfind('.', key.size() - suffix_len - 1);
+		if (dot == string::npos || evicted.find(key.substr(0, dot)) == evicted.end())
+			continue;
+		const int64_t size = deleteEntry(entry);
+		if (size >= 0) {
+			freed += size;
+		}
+	}
+	return freed;
+}
+
+/**
+ * Delete a cached file and its metadata, and remove it from the index.
+ * The index must be locked exclusively.
+ * @param entry Entry.
+ * @return Number of bytes freed, or -1 if the file couldn't be deleted.
+ */
+int64_t CacheIndex::deleteEntry(CacheIndexEntry *entry)
+{
+	string filename = m_cacheDir;
+	filename += '/';
+	filename.append(entry->key, entry->key_len);
+
+	// Delete the file and its metadata.
+	// If the file is already gone, remove it from the index anyway.
+	if (unlink(filename.c_str()) != 0 && errno != ENOENT)
+		return -1;
+	CacheMetadata::remove(filename);
+
+	const int64_t size = static_cast<int64_t>(entry->size);
+	m_header->total_size -= entry->size;
+	entry->hash = CACHE_INDEX_HASH_DELETED;
+	m_header->count--;
+	m_header->tombstones++;
+	return size;
+}
+
+/**
+ * Rebuild the index by scanning the cache directory.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int CacheIndex::rebuild(void)
+{
+	Locker lock(this, true);
+	if (!lock.ok)
+		return -EIO;
+
+	int ret = init(CACHE_INDEX_DEFAULT_CAPACITY);
+	if (ret != 0)
+		return ret;
+	scanDir(string());
+	return 0;
+}
+
+/**
+ * Scan a cache subdirectory and add its files to the index.
+ * The index must be locked exclusively.
+ * @param subdir Subdirectory, relative to the cache directory. (empty for the root)
+ */
+void CacheIndex::scanDir(const string &subdir)
+{
+	string path = m_cacheDir;
+	if (!subdir.empty()) {
+		path += '/';
+		path += subdir;
+	}
+
+	DIR *const dir = opendir(path.c_str());
+	if (!dir)
+		return;
+
+	const size_t meta_suffix_len = strlen(CacheMetadata::METADATA_SUFFIX);
+	const time_t now = time(nullptr);
+	struct dirent *d;
+	while ((d = readdir(dir)) != nullptr) {
+		if (d->d_name[0] == '.' &&
+		    (d->d_name[1] == '\0' || (d->d_name[1] == '.' && d->d_name[2] == '\0')))
+		{
+			// "." or ".."
+			continue;
+		}
+
+		const string key = (subdir.empty() ? string(d->d_name) : subdir + '/' + d->d_name);
+		const string filename = m_cacheDir + '/' + key;
+		struct stat sb;
+		if (lstat(filename.c_str(), &sb) != 0)
+			continue;
+
+		if (S_ISDIR(sb.st_mode)) {
+			scanDir(key);
+			continue;
+		} else if (!S_ISREG(sb.st_mode) || key == INDEX_FILENAME) {
+			continue;
+		} else if (!strncmp(d->d_name, TEMP_PREFIX, sizeof(TEMP_PREFIX)-1)) {
+			// Temporary file. If it's old, the download was
+			// interrupted, so it can be deleted.
+			if (sb.st_mtime < now - 3600) {
+				unlink(filename.c_str());
+			}
+			continue;
+		}
+
+		CacheMetadata meta;
+		if (key.size() > meta_suffix_len &&
+		    !key.compare(key.size() - meta_suffix_len, meta_suffix_len, CacheMetadata::METADATA_SUFFIX))
+		{
+			// Metadata file. If the data file doesn't exist,
+			// this may be a negative cache entry.
+			const string data_key = key.substr(0, key.size() - meta_suffix_len);
+			const string data_filename = m_cacheDir + '/' + data_key;
+			if (access(data_filename.c_str(), F_OK) == 0 ||
+			    meta.load(data_filename) != 0 || !meta.isNegative() ||
+			    data_key.size() > CACHE_INDEX_KEY_MAX)
+			{
+				continue;
+			}
+
+			CacheIndexEntry *const entry = findOrInsert(data_key, hashKey(data_key));
+			if (entry) {
+				entry->last_access = meta.checked;
+				entry->checked = meta.checked;
+				entry->failures = meta.failures;
+			}
+			continue;
+		}
+
+		if (key.size() > CACHE_INDEX_KEY_MAX)
+			continue;
+		CacheIndexEntry *const entry = findOrInsert(key, hashKey(key));
+		if (!entry)
+			continue;
+
+		if (sb.st_size == 0) {
+			// Zero-byte files were used by older versions
+			// to indicate negative cache entries.
+			// Convert it to metadata, using the mtime as the last check.
+			entry->checked = sb.st_mtime;
+			entry->failures = 1;
+			if (unlink(filename.c_str()) == 0) {
+				meta.checked = sb.st_mtime;
+				meta.failures = 1;
+				meta.save(filename);
+			}
+		} else {
+			if (meta.load(filename) == 0 && meta.checked >= 0) {
+				entry->checked = meta.checked;
+			} else {
+				// No metadata. Start the revalidation interval now.
+				entry->checked = now;
+			}
+			m_header->total_size -= entry->size;
+			entry->size = static_cast<uint64_t>(sb.st_size);
+			m_header->total_size += entry->size;
+		}
+		entry->last_access = std::max(sb.st_atime, sb.st_mtime);
+	}
+	closedir(dir);
+}
+
+}
@@ -0,0 +1,283 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libcachemgr)                      *
+ * CacheIndex.hpp: Memory-mapped index of cached files.                    *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef __ROMPROPERTIES_LIBCACHEMGR_CACHEINDEX_HPP__
+#define __ROMPROPERTIES_LIBCACHEMGR_CACHEINDEX_HPP__
+
+// librpbase
+#include "librpbase/common.h"
+#include "librpbase/threads/Mutex.hpp"
+
+// C includes.
+#include <stdint.h>
+#include <time.h>
+
+// C++ includes.
+#include <string>
+
+namespace LibCacheMgr {
+
+struct CacheIndexHeader;
+struct CacheIndexEntry;
+
+/**
+ * Index of the files in the rom-properties cache.
+ *
+ * The index is a single memory-mapped file in the cache directory.
+ * It's an open-addressing hash table keyed by the cache filename
+ * relative to the cache directory.
+ *
+ * The index is only a hint. Other processes, including older versions
+ * and users clearing the cache manually, may add or delete files
+ * without updating it, so CacheManager confirms hits by checking the
+ * file and falls back to checking the file if the index misses.
+ *
+ * Each entry stores the file size, last access time, last check
+ * time (for revalidation), failure count (for negative cache
+ * entries), and the origin server. The total size is used to
+ * enforce a byte budget by evicting the least-recently used files.
+ *
+ * The index is shared between processes using advisory file locks.
+ * If the index file is missing or invalid, it's rebuilt by scanning
+ * the cache directory.
+ */
+class CacheIndex
+{
+	public:
+		CacheIndex();
+		~CacheIndex();
+
+	private:
+		RP_DISABLE_COPY(CacheIndex)
+
+	public:
+		// Index filename, relative to the cache directory.
+		static const char INDEX_FILENAME[];
+
+		// Filename prefix for temporary files used while downloading.
+		// These are never indexed.
+		static const char TEMP_PREFIX[];
+
+		/**
+		 * Open the index for a cache directory.
+		 * If the index doesn't exist or is invalid, it will be
+		 * rebuilt by scanning the cache directory.
+		 * @param cache_dir Cache directory.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int open(const std::string &cache_dir);
+
+		/**
+		 * Close the index.
+		 */
+		void close(void);
+
+		/**
+		 * Is the index open?
+		 * @return True if open; false if not.
+		 */
+		bool isOpen(void) const
+		{
+			return (m_header != nullptr);
+		}
+
+		/**
+		 * Get the cache directory.
+		 * @return Cache directory.
+		 */
+		const std::string &cacheDir(void) const
+		{
+			return m_cacheDir;
+		}
+
+	public:
+		/**
+		 * Index entry.
+		 */
+		struct Entry {
+			std::string key;	// Filename, relative to the cache directory.
+			std::string origin;	// Origin server, e.g. "https://art.gametdb.com".
+			uint64_t size;		// File size, in bytes. (0 for negative entries)
+			time_t last_access;	// Last access time.
+			time_t checked;		// Last time the file was downloaded or revalidated.
+			unsigned int failures;	// Number of consecutive failed downloads.
+		};
+
+		/**
+		 * Look up a cached file.
+		 * @param cache_filename	[in] Cache filename. (absolute path)
+		 * @param pEntry		[out,opt] Index entry.
+		 * @param touch			[in] If true, update the last access time. (takes an exclusive lock)
+		 * @return 1 if found; 0 if not found; negative POSIX error code if the file can't be indexed.
+		 */
+		int lookup(const std::string &cache_filename, Entry *pEntry = nullptr, bool touch = true);
+
+		/**
+		 * Add or update a cached file.
+		 * @param cache_filename	[in] Cache filename. (absolute path)
+		 * @param size			[in] File size, or -1 to keep the current size.
+		 * @param checked		[in] Last time the file was downloaded or revalidated.
+		 * @param failures		[in] Number of consecutive failed downloads.
+		 * @param origin		[in] Origin server, or empty string to keep the current origin.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int update(const std::string &cache_filename, int64_t size,
+			time_t checked, unsigned int failures, const std::string &origin);
+
+		/**
+		 * Remove a cached file from the index.
+		 * The file itself is not deleted.
+		 * @param cache_filename Cache filename. (absolute path)
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int remove(const std::string &cache_filename);
+
+		/**
+		 * Index statistics.
+		 */
+		struct Stats {
+			unsigned int count;	// Number of entries.
+			unsigned int negative;	// Number of negative entries.
+			uint64_t total_size;	// Total size of all cached files.
+			time_t oldest_access;	// Oldest last access time. (-1 if empty)
+		};
+
+		/**
+		 * Get index statistics.
+		 * @param pStats [out] Statistics.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int stats(Stats *pStats);
+
+		/**
+		 * Get the total size of all cached files.
+		 * @return Total size, in bytes.
+		 */
+		uint64_t totalSize(void);
+
+		/**
+		 * Evict the least-recently used files until the
+		 * total size is less than or equal to maxSize.
+		 * The files and their metadata are deleted, along with
+		 * the scaled images of any evicted original images.
+		 * @param maxSize Maximum total size, in bytes.
+		 * @return Number of bytes freed, or negative POSIX error code on error.
+		 */
+		int64_t evict(uint64_t maxSize);
+
+		/**
+		 * Rebuild the index by scanning the cache directory.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int rebuild(void);
+
+	private:
+		class Locker;
+		friend class Locker;
+
+		/**
+		 * Map the index file.
+		 * @param capacity Number of slots. (If 0, use the current file size.)
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int map(uint32_t capacity);
+
+		/**
+		 * Unmap the index file.
+		 */
+		void unmap(void);
+
+		/**
+		 * Initialize an empty index with the specified capacity.
+		 * The index must be locked exclusively.
+		 * @param capacity Number of slots. (power of 2)
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int init(uint32_t capacity);
+
+		/**
+		 * Grow the hash table if it's too full to insert an entry.
+		 * The index must be locked exclusively.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int reserveSlot(void);
+
+		/**
+		 * Is the mapped index valid?
+		 * @return True if valid; false if not.
+		 */
+		bool isValid(void) const;
+
+		/**
+		 * Find or insert an entry in the hash table.
+		 * The index must be locked exclusively.
+		 * @param key Key.
+		 * @param hash Key hash.
+		 * @return Entry, or nullptr on error.
+		 */
+		CacheIndexEntry *findOrInsert(const std::string &key, uint64_t hash);
+
+		/**
+		 * Find an entry in the hash table.
+		 * The index must be locked.
+		 * @param key Key.
+		 * @param hash Key hash.
+		 * @param pInsert [out,opt] Slot to use if inserting the key.
+		 * @return Entry, or nullptr if not found.
+		 */
+		CacheIndexEntry *find(const std::string &key, uint64_t hash, CacheIndexEntry **pInsert = nullptr);
+
+		/**
+		 * Delete a cached file and its metadata, and remove it from the index.
+		 * The index must be locked exclusively.
+		 * @param entry Entry.
+		 * @return Number of bytes freed, or -1 if the file couldn't be deleted.
+		 */
+		int64_t deleteEntry(CacheIndexEntry *entry);
+
+		/**
+		 * Scan a cache subdirectory and add its files to the index.
+		 * The index must be locked exclusively.
+		 * @param subdir Subdirectory, relative to the cache directory. (empty for the root)
+		 */
+		void scanDir(const std::string &subdir);
+
+		/**
+		 * Get the index key for a cache filename.
+		 * @param cache_filename Cache filename. (absolute path)
+		 * @return Key, or empty string if the file isn't in the cache directory.
+		 */
+		std::string keyForFilename(const std::string &cache_filename) const;
+
+	private:
+		std::string m_cacheDir;
+		int m_fd;
+		CacheIndexHeader *m_header;	// Start of the mapped file.
+		size_t m_mapSize;		// Size of the mapping, in bytes.
+		uint32_t m_capacity;		// Capacity when the file was mapped.
+
+		// Serializes access within the process.
+		// (Advisory file locks serialize access between processes.)
+		LibRpBase::Mutex m_mutex;
+};
+
+}
+
+#endif /* __ROMPROPERTIES_LIBCACHEMGR_CACHEINDEX_HPP__ */
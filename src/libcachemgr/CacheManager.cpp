@@ -26,32 +26,45 @@
 // librpbase
 #include "librpbase/file/RpFile.hpp"
 #include "librpbase/file/FileSystem.hpp"
+#include "librpbase/img/rp_image.hpp"
 using namespace LibRpBase;
 using namespace LibRpBase::FileSystem;
 
 // Windows includes.
 #ifdef _WIN32
 # include "libwin32common/RpWin32_sdk.h"
+# include "librpbase/TextFuncs_wchar.hpp"
 #endif /* _WIN32 */
 
-// gettimeofday()
-// NOTE: MSVC doesn't actually have gettimeofday().
-// We have our own version in msvc_common.h.
-#ifdef _MSC_VER
-# include "libwin32common/msvc_common.h"
-#else /* !_MSC_VER */
-# include <sys/time.h>
-#endif /* _MSC_VER */
+// C includes.
+#include <stdlib.h>
+#include <time.h>
+#ifndef _WIN32
+# include <unistd.h>
+#endif /* !_WIN32 */
+
+// C includes. (C++ namespace)
+#include <cassert>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
 
 // C++ includes.
+#include <memory>
 #include <string>
+#include <vector>
 using std::string;
+using std::unique_ptr;
+using std::vector;
 
 // TODO: DownloaderFactory?
 #ifdef _WIN32
 # include "UrlmonDownloader.hpp"
 #else
 # include "CurlDownloader.hpp"
+# include "CurlMultiDownloader.hpp"
+# include "CacheIndex.hpp"
+# include "librpbase/threads/pthread_once.h"
 #endif
 
 namespace LibCacheMgr {
@@ -61,7 +74,39 @@ namespace LibCacheMgr {
 // TODO: Test this on XP with IEIFLAG_ASYNC.
 Semaphore CacheManager::m_dlsem(2);
 
+#ifndef _WIN32
+// Cache index for the current user's cache directory.
+// TODO: Cache index on Windows.
+static CacheIndex *cache_index = nullptr;
+static pthread_once_t cache_index_once_control = PTHREAD_ONCE_INIT;
+
+/**
+ * Open the cache index.
+ * Called by pthread_once().
+ */
+static void openCacheIndex(void)
+{
+	const string &cache_dir = getCacheDirectory();
+	if (cache_dir.empty())
+		return;
+
+	CacheIndex *const idx = new CacheIndex();
+	if (idx->open(cache_dir) != 0) {
+		// Unable to open the index.
+		// The cache will be checked directly.
+		delete idx;
+		return;
+	}
+	cache_index = idx;
+}
+#endif /* !_WIN32 */
+
 CacheManager::CacheManager()
+	: m_maxConcurrentDownloads(4)
+	, m_revalidateInterval(DEFAULT_REVALIDATE_INTERVAL)
+	, m_negativeCacheTTL(DEFAULT_NEGATIVE_CACHE_TTL)
+	, m_negativeCacheMaxTTL(DEFAULT_NEGATIVE_CACHE_MAX_TTL)
+	, m_cacheMaxSize(DEFAULT_CACHE_MAX_SIZE)
 {
 	// TODO: DownloaderFactory?
 #ifdef _WIN32
@@ -114,6 +159,94 @@ void CacheManager::setProxyUrl(const string &proxyUrl)
 	m_proxyUrl = proxyUrl;
 }
 
+/**
+ * Get the maximum number of concurrent downloads.
+ * This is used by downloadFirst() and prefetch().
+ * @return Maximum number of concurrent downloads.
+ */
+int CacheManager::maxConcurrentDownloads(void) const
+{
+	return m_maxConcurrentDownloads;
+}
+
+/**
+ * Set the maximum number of concurrent downloads.
+ * This is used by downloadFirst() and prefetch().
+ * @param maxConcurrentDownloads Maximum number of concurrent downloads. (minimum 1)
+ */
+void CacheManager::setMaxConcurrentDownloads(int maxConcurrentDownloads)
+{
+	m_maxConcurrentDownloads = (maxConcurrentDownloads > 1 ? maxConcurrentDownloads : 1);
+}
+
+/**
+ * Get the revalidation interval.
+ * @return Revalidation interval, in seconds. (0 == never revalidate)
+ */
+time_t CacheManager::revalidateInterval(void) const
+{
+	return m_revalidateInterval;
+}
+
+/**
+ * Set the revalidation interval.
+ * Cached files older than this will be revalidated with the server.
+ * @param seconds Revalidation interval, in seconds. (0 == never revalidate)
+ */
+void CacheManager::setRevalidateInterval(time_t seconds)
+{
+	m_revalidateInterval = (seconds > 0 ? seconds : 0);
+}
+
+/**
+ * Set the negative cache TTL.
+ *
+ * After a failed download, the file won't be requested again
+ * until the TTL has passed. The TTL is doubled for each
+ * consecutive failure, up to the maximum TTL.
+ *
+ * @param ttl Initial TTL, in seconds. (0 == don't cache failures)
+ * @param maxTTL Maximum TTL, in seconds.
+ */
+void CacheManager::setNegativeCacheTTL(time_t ttl, time_t maxTTL)
+{
+	m_negativeCacheTTL = (ttl > 0 ? ttl : 0);
+	m_negativeCacheMaxTTL = (maxTTL > m_negativeCacheTTL ? maxTTL : m_negativeCacheTTL);
+}
+
+/**
+ * Get the maximum cache size.
+ * @return Maximum cache size, in bytes. (0 == unlimited)
+ */
+uint64_t CacheManager::cacheMaxSize(void) const
+{
+	return m_cacheMaxSize;
+}
+
+/**
+ * Set the maximum cache size.
+ * If the cache grows larger than this, the least-recently
+ * used files will be evicted.
+ * @param maxSize Maximum cache size, in bytes. (0 == unlimited)
+ */
+void CacheManager::setCacheMaxSize(uint64_t maxSize)
+{
+	m_cacheMaxSize = maxSize;
+}
+
+#ifndef _WIN32
+/**
+ * Get the cache index for the current user's cache directory.
+ * The index is opened the first time this function is called.
+ * @return Cache index, or nullptr if it couldn't be opened.
+ */
+CacheIndex *CacheManager::index(void)
+{
+	pthread_once(&cache_index_once_control, openCacheIndex);
+	return cache_index;
+}
+#endif /* !_WIN32 */
+
 /**
  * Get a cache filename.
  * @param cache_key Cache key. (Will be filtered using filterCacheKey().)
@@ -307,6 +440,349 @@ string CacheManager::filterCacheKey(const string &cache_key)
 	return filtered_cache_key;
 }
 
+/**
+ * Get the negative cache TTL for a number of consecutive failures.
+ * The TTL is doubled for each failure, up to the maximum TTL.
+ * @param failures Number of consecutive failures.
+ * @return Negative cache TTL, in seconds.
+ */
+time_t CacheManager::negativeCacheTTLForFailures(unsigned int failures) const
+{
+	time_t ttl = m_negativeCacheTTL;
+	for (; failures > 1 && ttl < m_negativeCacheMaxTTL; failures--) {
+		ttl *= 2;
+	}
+	return (ttl < m_negativeCacheMaxTTL ? ttl : m_negativeCacheMaxTTL);
+}
+
+/**
+ * Check the cache status of a cache file.
+ *
+ * Zero-byte files were used by older versions to indicate
+ * negative cache entries. These are converted to metadata.
+ *
+ * @param cache_filename	[in] Cache filename.
+ * @param meta			[out] Cache metadata.
+ * @return CacheStatus.
+ */
+int CacheManager::checkCacheFile(const string &cache_filename, CacheMetadata &meta) const
+{
+	const time_t now = time(nullptr);
+
+#ifndef _WIN32
+	// Check the cache index first.
+	// NOTE: The index is only a hint. Another process may have
+	// deleted or added the file without updating the index, so
+	// hits are confirmed by checking the file, and misses fall
+	// back to checking the file directly.
+	CacheIndex *const idx = index();
+	CacheIndex::Entry entry;
+	const int found = (idx ? idx->lookup(cache_filename, &entry) : -EIO);
+	if (found > 0) {
+		if (entry.failures > 0) {
+			// Negative cache entry.
+			// NOTE: If the system clock went backwards, retry now.
+			if (entry.checked >= 0 && entry.checked <= now &&
+			    (now - entry.checked) < negativeCacheTTLForFailures(entry.failures))
+			{
+				// Retry time hasn't been reached yet.
+				return CS_UNAVAILABLE;
+			}
+
+			// Retry the download. The failure count is kept
+			// in order to increase the TTL if it fails again.
+			meta.clear();
+			meta.checked = entry.checked;
+			meta.failures = entry.failures;
+			return CS_MISSING;
+		}
+
+		// Make sure the file still exists.
+		if (access(cache_filename, R_OK) != 0) {
+			idx->remove(cache_filename);
+			CacheMetadata::remove(cache_filename);
+			meta.clear();
+			return CS_MISSING;
+		}
+
+		if (m_revalidateInterval == 0 ||
+		    (entry.checked >= 0 && entry.checked <= now &&
+		     (now - entry.checked) < m_revalidateInterval))
+		{
+			// File is cached. The metadata isn't needed.
+			return CS_FRESH;
+		}
+
+		// File should be revalidated.
+		if (meta.load(cache_filename) != 0 || meta.isNegative()) {
+			meta.clear();
+			meta.checked = entry.checked;
+		}
+		return CS_STALE;
+	}
+#endif /* !_WIN32 */
+
+	const bool hasMeta = (meta.load(cache_filename) == 0);
+
+	// Check if the file already exists.
+	if (!access(cache_filename, R_OK)) {
+		// File exists.
+		// Is it larger than 0 bytes?
+		int64_t sz = filesize(cache_filename);
+		if (sz > 0) {
+			// File is larger than 0 bytes, which indicates
+			// it was cached successfully.
+			if (!hasMeta || meta.isNegative()) {
+				// No metadata. The file was cached by an older version.
+				// Start the revalidation interval now. The file's mtime
+				// was set from Last-Modified, so it can be used as a
+				// validator later.
+				meta.clear();
+				time_t filetime;
+				if (get_mtime(cache_filename, &filetime) == 0) {
+					meta.last_modified = filetime;
+				}
+				meta.checked = now;
+				meta.save(cache_filename);
+			}
+
+#ifndef _WIN32
+			if (found == 0) {
+				// The file isn't in the index. Add it.
+				idx->update(cache_filename, sz, meta.checked, 0, string());
+			}
+#endif /* !_WIN32 */
+
+			if (m_revalidateInterval > 0 &&
+			    (meta.checked < 0 || meta.checked > now ||
+			     (now - meta.checked) >= m_revalidateInterval))
+			{
+				// File should be revalidated.
+				return CS_STALE;
+			}
+			return CS_FRESH;
+		} else if (sz == 0) {
+			// File is 0 bytes, which is an older negative cache entry.
+			// Convert it to metadata, using the mtime as the last check.
+			time_t filetime;
+			if (get_mtime(cache_filename, &filetime) != 0)
+				return CS_UNAVAILABLE;
+			if (delete_file(cache_filename) != 0)
+				return CS_UNAVAILABLE;
+			meta.clear();
+			meta.checked = filetime;
+			meta.failures = 1;
+			meta.save(cache_filename);
+		}
+	}
+
+	if (meta.isNegative()) {
+		// Negative cache entry.
+		// NOTE: If the system clock went backwards, retry now.
+		if (meta.checked >= 0 && meta.checked <= now &&
+		    (now - meta.checked) < negativeCacheTTLForFailures(meta.failures))
+		{
+			// Retry time hasn't been reached yet.
+			return CS_UNAVAILABLE;
+		}
+
+		// Retry the download. The failure count is kept
+		// in order to increase the TTL if it fails again.
+		meta.etag.clear();
+		meta.last_modified = -1;
+		return CS_MISSING;
+	}
+
+	// File isn't cached.
+	// Metadata without a file isn't useful.
+	meta.clear();
+	return CS_MISSING;
+}
+
+/**
+ * Set the conditional request validators for a download.
+ * @param downloader	[in] Downloader.
+ * @param status	[in] CacheStatus from checkCacheFile().
+ * @param meta		[in] Cache metadata from checkCacheFile().
+ */
+void CacheManager::setValidators(IDownloader *downloader, int status, const CacheMetadata &meta)
+{
+	if (status == CS_STALE) {
+		downloader->setIfNoneMatch(meta.etag);
+		downloader->setIfModifiedSince(meta.last_modified);
+	} else {
+		downloader->setIfNoneMatch(string());
+		downloader->setIfModifiedSince(-1);
+	}
+}
+
+#ifndef _WIN32
+/**
+ * Create a temporary file for downloading a cache file.
+ * The temporary file is in the same directory as the cache file,
+ * so it can be renamed into place once the download has completed.
+ * @param cache_filename Cache filename.
+ * @return Temporary filename, or empty string on error.
+ */
+static string createTempFile(const string &cache_filename)
+{
+	const size_t slash = cache_filename.rfind('/');
+	if (slash == string::npos)
+		return string();
+
+	string temp_filename = cache_filename.substr(0, slash + 1);
+	temp_filename += CacheIndex::TEMP_PREFIX;
+	temp_filename += cache_filename.substr(slash + 1);
+	temp_filename += ".XXXXXX";
+
+	const int fd = mkstemp(&temp_filename[0]);
+	if (fd < 0)
+		return string();
+	close(fd);
+	return temp_filename;
+}
+
+/**
+ * Get the origin of a URL.
+ * @param url URL.
+ * @return Origin, e.g. "https://art.gametdb.com".
+ */
+static string urlOrigin(const string &url)
+{
+	size_t pos = url.find("://");
+	if (pos == string::npos)
+		return string();
+	pos = url.find('/', pos + 3);
+	return url.substr(0, pos);
+}
+#endif /* !_WIN32 */
+
+/**
+ * Store a downloaded file in the cache.
+ *
+ * If the download failed, a negative cache entry will be created.
+ * If a stale file was being revalidated, the cached file will be
+ * kept unless the server returned a new version.
+ *
+ * @param cache_filename	[in] Cache filename.
+ * @param status		[in] CacheStatus from checkCacheFile().
+ * @param meta			[in,out] Cache metadata from checkCacheFile().
+ * @param dl_ret		[in] Return value from the downloader.
+ * @param downloader		[in] Downloader.
+ * @return 0 if the file is available in the cache; non-zero on error.
+ */
+int CacheManager::storeCacheFile(const string &cache_filename, int status,
+	CacheMetadata &meta, int dl_ret, const IDownloader *downloader) const
+{
+	const time_t now = time(nullptr);
+
+#ifndef _WIN32
+	const string temp_filename = downloader->outputFile();
+	if (!temp_filename.empty() && (dl_ret != 0 || !downloader->isStreamed())) {
+		// Nothing to publish. Delete the temporary file.
+		unlink(temp_filename.c_str());
+	}
+#endif /* !_WIN32 */
+
+	if (status == CS_STALE && (dl_ret != 0 || downloader->isNotModified())) {
+		// Either the file wasn't modified, or the server couldn't
+		// be reached. Keep using the cached file.
+		// NOTE: If revalidation failed, it will be retried after
+		// the next revalidation interval.
+		if (dl_ret == 0 && !downloader->etag().empty()) {
+			// The server may send an updated ETag with 304.
+			meta.etag = downloader->etag();
+		}
+		meta.checked = now;
+		meta.save(cache_filename);
+#ifndef _WIN32
+		CacheIndex *const idx = index();
+		if (idx) {
+			idx->update(cache_filename, -1, now, 0, string());
+		}
+#endif /* !_WIN32 */
+		return 0;
+	}
+
+	if (dl_ret == 0 && !downloader->isNotModified()) {
+		const time_t mtime = downloader->mtime();
+#ifndef _WIN32
+		if (downloader->isStreamed()) {
+			// The file was written to a temporary file and flushed to disk.
+			// Set the mtime, then rename it into place. This ensures
+			// that an interrupted download never leaves a truncated file.
+			if (mtime >= 0) {
+				set_mtime(temp_filename, mtime);
+			}
+			if (rename(temp_filename.c_str(), cache_filename.c_str()) != 0) {
+				// Error renaming the file.
+				// Don't create a negative cache entry, since
+				// this isn't the server's fault.
+				unlink(temp_filename.c_str());
+				return -EIO;
+			}
+		} else
+#endif /* !_WIN32 */
+		{
+			// Write the file to the cache.
+			RpFile *const file = new RpFile(cache_filename, RpFile::FM_CREATE_WRITE);
+			if (!file->isOpen()) {
+				// Error opening the file in the local cache.
+				// Don't create a negative cache entry, since
+				// this isn't the server's fault.
+				file->unref();
+				return -EIO;
+			}
+
+			// Write the file.
+			file->write((void*)downloader->data(), downloader->dataSize());
+			file->close();	// NOTE: May be redundant.
+			file->unref();
+
+			// Set the file's mtime if it was obtained by the downloader.
+			// TODO: IRpFile::set_mtime()?
+			if (mtime >= 0) {
+				set_mtime(cache_filename, mtime);
+			}
+		}
+
+		// Save the validators for revalidation.
+		meta.clear();
+		meta.etag = downloader->etag();
+		meta.last_modified = mtime;
+		meta.checked = now;
+		meta.save(cache_filename);
+
+#ifndef _WIN32
+		CacheIndex *const idx = index();
+		if (idx) {
+			idx->update(cache_filename, downloader->dataSize(), now, 0, urlOrigin(downloader->url()));
+			if (m_cacheMaxSize > 0 && idx->totalSize() > m_cacheMaxSize) {
+				// Cache is too large. Evict the least-recently used files,
+				// with some slack so this doesn't happen on every download.
+				idx->evict(m_cacheMaxSize - (m_cacheMaxSize / 8));
+			}
+		}
+#endif /* !_WIN32 */
+		return 0;
+	}
+
+	// Error downloading the file.
+	// TODO: Only keep a negative cache entry if it's a 404?
+	meta.etag.clear();
+	meta.last_modified = -1;
+	meta.checked = now;
+	meta.failures++;
+	meta.save(cache_filename);
+#ifndef _WIN32
+	CacheIndex *const idx = index();
+	if (idx) {
+		idx->update(cache_filename, 0, now, meta.failures, urlOrigin(downloader->url()));
+	}
+#endif /* !_WIN32 */
+	return (dl_ret != 0 ? dl_ret : -EIO);
+}
+
 /**
  * Download a file.
  *
@@ -315,10 +791,12 @@ string CacheManager::filterCacheKey(const string &cache_key)
  *
  * If the file is present in the cache, the cached version
  * will be retrieved. Otherwise, the file will be downloaded.
+ * If the cached version is older than the revalidation interval,
+ * the server will be asked if it has a newer version.
  *
  * If the file was not found on the server, or it was not found
  * the last time it was requested, an empty string will be
- * returned, and a zero-byte file will be stored in the cache.
+ * returned, and a negative cache entry will be stored.
  *
  * @return Absolute path to the cached file.
  */
@@ -338,46 +816,22 @@ string CacheManager::download(
 	SemaphoreLocker locker(m_dlsem);
 
 	// Check if the file already exists.
-	if (!access(cache_filename, R_OK)) {
-		// File exists.
-		// Is it larger than 0 bytes?
-		int64_t sz = filesize(cache_filename);
-		if (sz == 0) {
-			// File is 0 bytes, which indicates it didn't exist
-			// on the server. If the file is older than a week,
-			// try to redownload it.
-			// TODO: Configurable time.
-			// TODO: How should we handle errors?
-			time_t filetime;
-			if (get_mtime(cache_filename, &filetime) != 0)
-				return string();
-
-			struct timeval systime;
-			if (gettimeofday(&systime, nullptr) != 0)
-				return string();
-			if ((systime.tv_sec - filetime) < (86400*7)) {
-				// Less than a week old.
-				return string();
-			}
-
-			// More than a week old.
-			// Delete the cache file and redownload it.
-			if (delete_file(cache_filename) != 0)
-				return string();
-		} else if (sz > 0) {
-			// File is larger than 0 bytes, which indicates
-			// it was cached successfully.
-			return cache_filename;
-		}
+	CacheMetadata meta;
+	const int status = checkCacheFile(cache_filename, meta);
+	if (status == CS_FRESH) {
+		// File is cached.
+		return cache_filename;
+	} else if (status == CS_UNAVAILABLE) {
+		// Negative cache entry, or an error occurred.
+		return string();
 	}
 
 	// Check if the URL is blank.
 	// This is allowed for some databases that are only available offline.
 	if (url.empty()) {
 		// Blank URL. Don't try to download anything.
-		// Don't mark the file as unavailable by creating a
-		// 0-byte dummy file, either.
-		return string();
+		// Don't mark the file as unavailable, either.
+		return (status == CS_STALE ? cache_filename : string());
 	}
 
 	// Make sure the subdirectories exist.
@@ -388,38 +842,524 @@ string CacheManager::download(
 		return string();
 	}
 
-	// TODO: Keep-alive cURL connections (one per server)?
+#ifndef _WIN32
+	// Download to a temporary file, which is renamed
+	// into place once the download has completed.
+	const string temp_filename = createTempFile(cache_filename);
+	if (temp_filename.empty()) {
+		// Error creating the temporary file.
+		return string();
+	}
+	m_downloader->setOutputFile(temp_filename);
+#endif /* !_WIN32 */
+
 	m_downloader->setUrl(url);
 	m_downloader->setProxyUrl(m_proxyUrl);
-	int ret = m_downloader->download();
+	setValidators(m_downloader, status, meta);
+	const int ret = m_downloader->download();
 
 	// Write the file to the cache.
-	RpFile *const file = new RpFile(cache_filename, RpFile::FM_CREATE_WRITE);
-	if (ret != 0 || !file->isOpen()) {
-		// Error downloading the file, or error opening
-		// the file in the local cache.
-		file->unref();
-
-		// TODO: Only keep a negative cache if it's a 404.
-		// Keep the cached file as a 0-byte file to indicate
-		// a "negative" hit, but return an empty filename.
+	const int sret = storeCacheFile(cache_filename, status, meta, ret, m_downloader);
+	m_downloader->clear();
+	m_downloader->setOutputFile(string());
+	if (sret != 0) {
+		// Error downloading or storing the file.
 		return string();
 	}
 
-	// Write the file.
-	file->write((void*)m_downloader->data(), m_downloader->dataSize());
-	file->close();	// NOTE: May be redundant.
-	file->unref();
+	// Return the cache filename.
+	return cache_filename;
+}
+
+/**
+ * Batch download state for downloadFirst() and prefetch().
+ */
+struct BatchState {
+	enum Status : uint8_t {
+		ST_UNAVAILABLE,	// Not available. (negative cache entry, error)
+		ST_PENDING,	// Download pending.
+		ST_CACHED,	// Available in the cache.
+	};
+
+	explicit BatchState(const CacheManager *cm, size_t count)
+		: cm(cm)
+		, filenames(count)
+		, metas(count)
+		, cacheStatus(count, CacheManager::CS_UNAVAILABLE)
+		, status(count, ST_UNAVAILABLE)
+		, first(false)
+	{ }
+
+	const CacheManager *cm;
+	vector<string> filenames;	// Cache filenames, per request.
+	vector<CacheMetadata> metas;	// Cache metadata, per request.
+	vector<int8_t> cacheStatus;	// CacheStatus, per request.
+	vector<uint8_t> status;		// Status, per request.
+	vector<int> xfer_to_req;	// Transfer index to request index.
+	bool first;			// If true, stop at the first available file.
+};
 
-	// Set the file's mtime if it was obtained by the downloader.
-	// TODO: IRpFile::set_mtime()?
-	time_t mtime = m_downloader->mtime();
-	if (mtime >= 0) {
-		set_mtime(cache_filename, mtime);
+#ifndef _WIN32
+/**
+ * CurlMultiDownloader completion callback.
+ * @param dl		[in] CurlMultiDownloader.
+ * @param index		[in] Transfer index.
+ * @param result	[in] Result from the downloader.
+ * @param userdata	[in] BatchState.
+ */
+void CacheManager::multiCompletion(CurlMultiDownloader *dl, int index, int result, void *userdata)
+{
+	BatchState *const state = static_cast<BatchState*>(userdata);
+	const int req = state->xfer_to_req[index];
+	IDownloader *const downloader = dl->downloader(index);
+
+	// Write the file to the cache.
+	// The downloaded data isn't needed afterwards.
+	const int ret = state->cm->storeCacheFile(state->filenames[req],
+		state->cacheStatus[req], state->metas[req], result, downloader);
+	downloader->clear();
+	state->status[req] = (ret == 0 ? BatchState::ST_CACHED : BatchState::ST_UNAVAILABLE);
+
+	if (!state->first)
+		return;
+
+	// If all higher-priority candidates are unavailable and this
+	// one (or a lower-priority one that finished earlier) is cached,
+	// we're done. Cancel the remaining transfers.
+	for (auto iter = state->status.cbegin(); iter != state->status.cend(); ++iter) {
+		if (*iter == BatchState::ST_UNAVAILABLE)
+			continue;
+		if (*iter == BatchState::ST_CACHED) {
+			const int count = dl->count();
+			for (int i = 0; i < count; i++) {
+				dl->cancel(i);
+			}
+		}
+		break;
 	}
+}
+#endif /* !_WIN32 */
 
-	// Return the cache filename.
-	return cache_filename;
+/**
+ * Check the cache status of a batch of requests.
+ * @param requests	[in] Download requests.
+ * @param state		[out] Batch state.
+ * @param first		[in] If true, stop at the first available file.
+ * @return Number of pending downloads.
+ */
+int CacheManager::checkBatch(const vector<DownloadRequest> &requests, BatchState &state, bool first)
+{
+	const int count = static_cast<int>(requests.size());
+	int pending = 0;
+	for (int i = 0; i < count; i++) {
+		const DownloadRequest &req = requests[i];
+		string &filename = state.filenames[i];
+		filename = getCacheFilename(req.cache_key);
+		if (filename.empty())
+			continue;
+
+		const int cs = checkCacheFile(filename, state.metas[i]);
+		state.cacheStatus[i] = cs;
+		if (cs == CS_FRESH || (cs == CS_STALE && req.url.empty())) {
+			// File is cached.
+			state.status[i] = BatchState::ST_CACHED;
+		} else if ((cs == CS_MISSING || cs == CS_STALE) &&
+			   !req.url.empty() && rmkdir(filename) == 0)
+		{
+			// File needs to be downloaded or revalidated.
+			state.status[i] = BatchState::ST_PENDING;
+			pending++;
+		}
+
+		if (first && state.status[i] == BatchState::ST_CACHED) {
+			// Candidates after the first cached file are never needed.
+			break;
+		} else if (first && cs == CS_STALE) {
+			// Stale files are available even if revalidation fails.
+			break;
+		}
+	}
+	return pending;
+}
+
+/**
+ * Download all pending files in a batch.
+ * @param requests	[in] Download requests.
+ * @param state		[in,out] Batch state.
+ */
+void CacheManager::downloadBatch(const vector<DownloadRequest> &requests, BatchState &state)
+{
+	const int count = static_cast<int>(requests.size());
+
+#ifdef _WIN32
+	// TODO: Concurrent downloads on Windows.
+	// Download the files one at a time.
+	for (int i = 0; i < count; i++) {
+		if (state.status[i] != BatchState::ST_PENDING)
+			continue;
+		m_downloader->setUrl(requests[i].url);
+		m_downloader->setProxyUrl(m_proxyUrl);
+		setValidators(m_downloader, state.cacheStatus[i], state.metas[i]);
+		const int ret = m_downloader->download();
+		state.status[i] = (storeCacheFile(state.filenames[i], state.cacheStatus[i],
+				state.metas[i], ret, m_downloader) == 0
+			? BatchState::ST_CACHED
+			: BatchState::ST_UNAVAILABLE);
+		m_downloader->clear();
+
+		if (state.first && state.status[i] == BatchState::ST_CACHED) {
+			// Highest-priority available file.
+			break;
+		}
+	}
+#else /* !_WIN32 */
+	// Download all pending files concurrently.
+	CurlMultiDownloader multi;
+	multi.setMaxConcurrent(m_maxConcurrentDownloads);
+	multi.setMaxSize(m_downloader->maxSize());
+	multi.setProxyUrl(m_proxyUrl);
+	for (int i = 0; i < count; i++) {
+		if (state.status[i] != BatchState::ST_PENDING)
+			continue;
+
+		// Download to a temporary file, which is renamed
+		// into place once the download has completed.
+		const string temp_filename = createTempFile(state.filenames[i]);
+		if (temp_filename.empty()) {
+			// Error creating the temporary file.
+			state.status[i] = BatchState::ST_UNAVAILABLE;
+			continue;
+		}
+
+		const int index = multi.addUrl(requests[i].url);
+		IDownloader *const downloader = multi.downloader(index);
+		downloader->setOutputFile(temp_filename);
+		setValidators(downloader, state.cacheStatus[i], state.metas[i]);
+		state.xfer_to_req.push_back(i);
+	}
+	multi.perform(multiCompletion, &state);
+
+	// Delete the temporary files for cancelled downloads.
+	const int xfer_count = static_cast<int>(state.xfer_to_req.size());
+	for (int i = 0; i < xfer_count; i++) {
+		if (state.status[state.xfer_to_req[i]] == BatchState::ST_PENDING) {
+			unlink(multi.downloader(i)->outputFile().c_str());
+		}
+	}
+#endif /* _WIN32 */
+}
+
+/**
+ * Download the first available file from a list of candidates.
+ *
+ * Candidates are listed in priority order. All candidates that
+ * aren't already cached are downloaded concurrently, and the
+ * highest-priority candidate that is available is returned.
+ * Lower-priority downloads are cancelled as soon as the
+ * result is known.
+ *
+ * Negative cache entries and revalidation are handled
+ * the same way as download().
+ *
+ * @param requests	[in] Download requests, in priority order.
+ * @param pIndex	[out,opt] Index of the selected request, or -1 if none.
+ * @return Absolute path to the cached file, or empty string if none are available.
+ */
+string CacheManager::downloadFirst(const vector<DownloadRequest> &requests, int *pIndex)
+{
+	if (pIndex) {
+		*pIndex = -1;
+	}
+
+	// Lock the semaphore to make sure we don't
+	// download too many batches at once.
+	SemaphoreLocker locker(m_dlsem);
+
+	// Check the cache first.
+	BatchState state(this, requests.size());
+	state.first = true;
+	if (checkBatch(requests, state, true) > 0) {
+		// Download the pending candidates.
+		downloadBatch(requests, state);
+	}
+
+	// Find the highest-priority candidate that's available.
+	const int count = static_cast<int>(requests.size());
+	for (int i = 0; i < count; i++) {
+		if (state.status[i] == BatchState::ST_CACHED) {
+			if (pIndex) {
+				*pIndex = i;
+			}
+			return state.filenames[i];
+		}
+	}
+
+	// Nothing is available.
+	return string();
+}
+
+/**
+ * Download multiple files concurrently.
+ *
+ * This is intended for prefetching images for an entire
+ * directory. Files that are already cached are skipped.
+ *
+ * @param requests	[in] Download requests.
+ * @return Number of requested files that are now available in the cache.
+ */
+int CacheManager::prefetch(const vector<DownloadRequest> &requests)
+{
+	// Lock the semaphore to make sure we don't
+	// download too many batches at once.
+	SemaphoreLocker locker(m_dlsem);
+
+	// Check the cache first.
+	BatchState state(this, requests.size());
+	if (checkBatch(requests, state, false) > 0) {
+		// Download the pending files.
+		downloadBatch(requests, state);
+	}
+
+	int cached = 0;
+	for (auto iter = state.status.cbegin(); iter != state.status.cend(); ++iter) {
+		if (*iter == BatchState::ST_CACHED) {
+			cached++;
+		}
+	}
+	return cached;
+}
+
+/** Scaled image cache. **/
+
+#define SCALED_IMAGE_MAGIC	0x49535052	// "RPSI"
+#define SCALED_IMAGE_VERSION	1
+
+// Filename suffix for scaled images.
+const char CacheManager::SCALED_IMAGE_SUFFIX[] = ".rpimg";
+
+/**
+ * Scaled image file header.
+ * This is followed by the ARGB32 image data, with no padding.
+ * NOTE: Stored in host byte order, since it's only used on the local system.
+ */
+struct ScaledImageHeader {
+	uint32_t magic;		// SCALED_IMAGE_MAGIC
+	uint32_t version;	// SCALED_IMAGE_VERSION
+	int64_t src_mtime;	// mtime of the original image.
+	int64_t src_size;	// Size of the original image.
+	uint32_t width;		// Image width.
+	uint32_t height;	// Image height.
+	uint8_t has_sBIT;	// Set if sBIT is valid.
+	uint8_t sBIT[5];	// sBIT: red, green, blue, gray, alpha
+	uint8_t reserved[2];
+};
+ASSERT_STRUCT(ScaledImageHeader, 40);
+
+/**
+ * Get the filename for a scaled image.
+ * @param cache_filename	[in] Cache filename of the original image.
+ * @param size			[in] Requested image size.
+ * @return Scaled image filename.
+ */
+string CacheManager::getScaledImageFilename(const string &cache_filename, int size)
+{
+	char buf[24];
+	snprintf(buf, sizeof(buf), ".%d%s", size, SCALED_IMAGE_SUFFIX);
+	return cache_filename + buf;
+}
+
+/**
+ * Load a scaled image from the cache.
+ *
+ * Scaled images are stored uncompressed next to the original
+ * image, so loading one is much faster than decoding and
+ * scaling the original image again. If the original image
+ * has changed since the scaled image was stored, the scaled
+ * image is ignored.
+ *
+ * @param cache_filename	[in] Cache filename of the original image.
+ * @param size			[in] Requested image size.
+ * @return Scaled image, or nullptr if it isn't available.
+ */
+rp_image *CacheManager::loadScaledImage(const string &cache_filename, int size)
+{
+	assert(size > 0);
+	if (cache_filename.empty() || size <= 0)
+		return nullptr;
+
+	const string scaled_filename = getScaledImageFilename(cache_filename, size);
+	unique_IRpFile<RpFile> file(new RpFile(scaled_filename, RpFile::FM_OPEN_READ));
+	if (!file->isOpen())
+		return nullptr;
+
+	ScaledImageHeader header;
+	if (file->read(&header, sizeof(header)) != sizeof(header) ||
+	    header.magic != SCALED_IMAGE_MAGIC ||
+	    header.version != SCALED_IMAGE_VERSION ||
+	    header.width == 0 || header.width > 32768 ||
+	    header.height == 0 || header.height > 32768)
+	{
+		return nullptr;
+	}
+
+	// Make sure the original image hasn't changed.
+	time_t src_mtime;
+	if (get_mtime(cache_filename, &src_mtime) != 0 ||
+	    static_cast<int64_t>(src_mtime) != header.src_mtime ||
+	    filesize(cache_filename) != header.src_size)
+	{
+		return nullptr;
+	}
+
+	// Make sure the file isn't truncated.
+	const size_t row_bytes = static_cast<size_t>(header.width) * 4;
+	if (file->size() != static_cast<int64_t>(sizeof(header) + row_bytes * header.height))
+		return nullptr;
+
+	unique_ptr<rp_image> img(new rp_image(header.width, header.height, rp_image::FORMAT_ARGB32));
+	if (!img->isValid())
+		return nullptr;
+
+	if (img->stride() == static_cast<int>(row_bytes)) {
+		// Read the whole image at once.
+		if (file->read(img->bits(), row_bytes * header.height) != row_bytes * header.height)
+			return nullptr;
+	} else {
+		// Read one row at a time.
+		for (unsigned int y = 0; y < header.height; y++) {
+			if (file->read(img->scanLine(y), row_bytes) != row_bytes)
+				return nullptr;
+		}
+	}
+
+	if (header.has_sBIT) {
+		const rp_image::sBIT_t sBIT = {
+			header.sBIT[0], header.sBIT[1], header.sBIT[2],
+			header.sBIT[3], header.sBIT[4]
+		};
+		img->set_sBIT(&sBIT);
+	}
+
+#ifndef _WIN32
+	// Update the last access time in the index.
+	CacheIndex *const idx = index();
+	if (idx) {
+		idx->lookup(scaled_filename);
+	}
+#endif /* !_WIN32 */
+
+	return img.release();
+}
+
+/**
+ * Store a scaled image in the cache.
+ * @param cache_filename	[in] Cache filename of the original image.
+ * @param size			[in] Requested image size.
+ * @param img			[in] Scaled image.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int CacheManager::storeScaledImage(const string &cache_filename, int size, const rp_image *img)
+{
+	assert(size > 0);
+	assert(img != nullptr);
+	if (cache_filename.empty() || size <= 0 || !img || !img->isValid())
+		return -EINVAL;
+
+	// Scaled images are always stored as ARGB32.
+	unique_ptr<rp_image> tmp_img;
+	if (img->format() != rp_image::FORMAT_ARGB32) {
+		tmp_img.reset(img->dup_ARGB32());
+		if (!tmp_img)
+			return -EINVAL;
+		img = tmp_img.get();
+	}
+
+	ScaledImageHeader header;
+	memset(&header, 0, sizeof(header));
+	header.magic = SCALED_IMAGE_MAGIC;
+	header.version = SCALED_IMAGE_VERSION;
+
+	// Save the original image's mtime and size
+	// in order to detect if it changes.
+	time_t src_mtime;
+	if (get_mtime(cache_filename, &src_mtime) != 0)
+		return -ENOENT;
+	header.src_mtime = src_mtime;
+	header.src_size = filesize(cache_filename);
+	header.width = img->width();
+	header.height = img->height();
+
+	rp_image::sBIT_t sBIT;
+	if (img->get_sBIT(&sBIT) == 0) {
+		header.has_sBIT = 1;
+		header.sBIT[0] = sBIT.red;
+		header.sBIT[1] = sBIT.green;
+		header.sBIT[2] = sBIT.blue;
+		header.sBIT[3] = sBIT.gray;
+		header.sBIT[4] = sBIT.alpha;
+	}
+
+	const string scaled_filename = getScaledImageFilename(cache_filename, size);
+#ifndef _WIN32
+	// Write to a temporary file, which is renamed into place
+	// once it's complete. This ensures that loadScaledImage()
+	// never sees a partially-written file.
+	const string temp_filename = createTempFile(scaled_filename);
+	if (temp_filename.empty())
+		return -EIO;
+#else /* _WIN32 */
+	// Write to a temporary file, which replaces the scaled image
+	// once it's complete. Thread IDs are unique system-wide,
+	// so other threads and processes won't use the same file.
+	char temp_suffix[32];
+	snprintf(temp_suffix, sizeof(temp_suffix), ".%lu.tmp",
+		static_cast<unsigned long>(GetCurrentThreadId()));
+	const string temp_filename = scaled_filename + temp_suffix;
+#endif /* !_WIN32 */
+
+	unique_IRpFile<RpFile> file(new RpFile(temp_filename, RpFile::FM_CREATE_WRITE));
+	if (!file->isOpen()) {
+		const int err = file->lastError();
+		delete_file(temp_filename);
+		return -(err != 0 ? err : EIO);
+	}
+
+	bool ok = (file->write(&header, sizeof(header)) == sizeof(header));
+	const size_t row_bytes = static_cast<size_t>(img->width()) * 4;
+	for (int y = 0; ok && y < img->height(); y++) {
+		ok = (file->write(img->scanLine(y), row_bytes) == row_bytes);
+	}
+	file->close();
+	if (!ok) {
+		// Error writing the file.
+		delete_file(temp_filename);
+		return -EIO;
+	}
+
+#ifdef _WIN32
+	if (!MoveFileEx(U82T_s(temp_filename), U82T_s(scaled_filename), MOVEFILE_REPLACE_EXISTING)) {
+		// Error replacing the file.
+		delete_file(temp_filename);
+		return -EIO;
+	}
+#else /* !_WIN32 */
+	if (rename(temp_filename.c_str(), scaled_filename.c_str()) != 0) {
+		// Error renaming the file.
+		unlink(temp_filename.c_str());
+		return -EIO;
+	}
+#endif /* _WIN32 */
+
+#ifndef _WIN32
+	// Add the scaled image to the index so it
+	// counts towards the maximum cache size.
+	CacheIndex *const idx = index();
+	if (idx) {
+		idx->update(scaled_filename, sizeof(header) + row_bytes * img->height(),
+			time(nullptr), 0, string());
+	}
+#endif /* !_WIN32 */
+	return 0;
 }
 
 /**
@@ -436,8 +1376,30 @@ string CacheManager::findInCache(const string &cache_key)
 		return string();
 	}
 
+#ifndef _WIN32
+	// Check the cache index first.
+	// NOTE: The index is only a hint, so the file is always checked.
+	CacheIndex *const idx = index();
+	CacheIndex::Entry entry;
+	const int found = (idx ? idx->lookup(cache_filename, &entry) : -EIO);
+	if (found > 0 && entry.failures > 0) {
+		// Negative cache entry.
+		return string();
+	}
+#endif /* !_WIN32 */
+
 	// Return the filename if the file exists.
-	return (!access(cache_filename, R_OK) ? cache_filename : string());
+	if (!access(cache_filename, R_OK)) {
+		return cache_filename;
+	}
+
+#ifndef _WIN32
+	if (found > 0) {
+		// The file was deleted. Remove it from the index.
+		idx->remove(cache_filename);
+	}
+#endif /* !_WIN32 */
+	return string();
 }
 
 }
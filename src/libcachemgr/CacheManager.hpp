@@ -25,12 +25,24 @@
 #include "librpbase/common.h"
 #include "librpbase/threads/Semaphore.hpp"
 
+#include "CacheMetadata.hpp"
+
 // C++ includes.
 #include <string>
+#include <vector>
+
+namespace LibRpBase {
+	class rp_image;
+}
 
 namespace LibCacheMgr {
 
 class IDownloader;
+struct BatchState;
+#ifndef _WIN32
+class CurlMultiDownloader;
+class CacheIndex;
+#endif /* !_WIN32 */
 class CacheManager
 {
 	public:
@@ -63,6 +75,82 @@ class CacheManager
 		 */
 		void setProxyUrl(const std::string &proxyUrl);
 
+		/**
+		 * Get the maximum number of concurrent downloads.
+		 * This is used by downloadFirst() and prefetch().
+		 * @return Maximum number of concurrent downloads.
+		 */
+		int maxConcurrentDownloads(void) const;
+
+		/**
+		 * Set the maximum number of concurrent downloads.
+		 * This is used by downloadFirst() and prefetch().
+		 * @param maxConcurrentDownloads Maximum number of concurrent downloads. (minimum 1)
+		 */
+		void setMaxConcurrentDownloads(int maxConcurrentDownloads);
+
+		/** Cache expiration. **/
+
+		// Default revalidation interval: 30 days
+		static const time_t DEFAULT_REVALIDATE_INTERVAL = 30*86400;
+		// Default negative cache TTL: 1 day, doubled for each failure
+		static const time_t DEFAULT_NEGATIVE_CACHE_TTL = 86400;
+		// Default maximum negative cache TTL: 28 days
+		static const time_t DEFAULT_NEGATIVE_CACHE_MAX_TTL = 28*86400;
+
+		/**
+		 * Get the revalidation interval.
+		 * @return Revalidation interval, in seconds. (0 == never revalidate)
+		 */
+		time_t revalidateInterval(void) const;
+
+		/**
+		 * Set the revalidation interval.
+		 * Cached files older than this will be revalidated with the server.
+		 * @param seconds Revalidation interval, in seconds. (0 == never revalidate)
+		 */
+		void setRevalidateInterval(time_t seconds);
+
+		/**
+		 * Set the negative cache TTL.
+		 *
+		 * After a failed download, the file won't be requested again
+		 * until the TTL has passed. The TTL is doubled for each
+		 * consecutive failure, up to the maximum TTL.
+		 *
+		 * @param ttl Initial TTL, in seconds. (0 == don't cache failures)
+		 * @param maxTTL Maximum TTL, in seconds.
+		 */
+		void setNegativeCacheTTL(time_t ttl, time_t maxTTL);
+
+		/** Cache size limit. **/
+
+		// Default maximum cache size: 512 MiB
+		static const uint64_t DEFAULT_CACHE_MAX_SIZE = 512ULL*1024*1024;
+
+		/**
+		 * Get the maximum cache size.
+		 * @return Maximum cache size, in bytes. (0 == unlimited)
+		 */
+		uint64_t cacheMaxSize(void) const;
+
+		/**
+		 * Set the maximum cache size.
+		 * If the cache grows larger than this, the least-recently
+		 * used files will be evicted.
+		 * @param maxSize Maximum cache size, in bytes. (0 == unlimited)
+		 */
+		void setCacheMaxSize(uint64_t maxSize);
+
+#ifndef _WIN32
+		/**
+		 * Get the cache index for the current user's cache directory.
+		 * The index is opened the first time this function is called.
+		 * @return Cache index, or nullptr if it couldn't be opened.
+		 */
+		static CacheIndex *index(void);
+#endif /* !_WIN32 */
+
 	protected:
 		/**
 		 * Get a cache filename.
@@ -88,10 +176,12 @@ class CacheManager
 		 *
 		 * If the file is present in the cache, the cached version
 		 * will be retrieved. Otherwise, the file will be downloaded.
+		 * If the cached version is older than the revalidation interval,
+		 * the server will be asked if it has a newer version.
 		 *
 		 * If the file was not found on the server, or it was not found
 		 * the last time it was requested, an empty string will be
-		 * returned, and a zero-byte file will be stored in the cache.
+		 * returned, and a negative cache entry will be stored.
 		 *
 		 * @return Absolute path to the cached file.
 		 */
@@ -106,9 +196,179 @@ class CacheManager
 		 */
 		std::string findInCache(const std::string &cache_key);
 
+	public:
+		/**
+		 * Download request for downloadFirst() and prefetch().
+		 */
+		struct DownloadRequest {
+			std::string url;
+			std::string cache_key;
+
+			DownloadRequest() { }
+			DownloadRequest(const std::string &url, const std::string &cache_key)
+				: url(url), cache_key(cache_key) { }
+		};
+
+		/**
+		 * Download the first available file from a list of candidates.
+		 *
+		 * Candidates are listed in priority order. All candidates that
+		 * aren't already cached are downloaded concurrently, and the
+		 * highest-priority candidate that is available is returned.
+		 * Lower-priority downloads are cancelled as soon as the
+		 * result is known.
+		 *
+		 * Negative cache entries and revalidation are handled
+		 * the same way as download().
+		 *
+		 * @param requests	[in] Download requests, in priority order.
+		 * @param pIndex	[out,opt] Index of the selected request, or -1 if none.
+		 * @return Absolute path to the cached file, or empty string if none are available.
+		 */
+		std::string downloadFirst(const std::vector<DownloadRequest> &requests, int *pIndex = nullptr);
+
+		/**
+		 * Download multiple files concurrently.
+		 *
+		 * This is intended for prefetching images for an entire
+		 * directory. Files that are already cached are skipped.
+		 *
+		 * @param requests	[in] Download requests.
+		 * @return Number of requested files that are now available in the cache.
+		 */
+		int prefetch(const std::vector<DownloadRequest> &requests);
+
+	public:
+		/** Scaled image cache. **/
+
+		// Filename suffix for scaled images.
+		// Scaled images are stored as "<original>.<size>" + SCALED_IMAGE_SUFFIX.
+		static const char SCALED_IMAGE_SUFFIX[];
+
+		/**
+		 * Load a scaled image from the cache.
+		 *
+		 * Scaled images are stored uncompressed next to the original
+		 * image, so loading one is much faster than decoding and
+		 * scaling the original image again. If the original image
+		 * has changed since the scaled image was stored, the scaled
+		 * image is ignored.
+		 *
+		 * @param cache_filename	[in] Cache filename of the original image.
+		 * @param size			[in] Requested image size.
+		 * @return Scaled image, or nullptr if it isn't available.
+		 */
+		static LibRpBase::rp_image *loadScaledImage(const std::string &cache_filename, int size);
+
+		/**
+		 * Store a scaled image in the cache.
+		 * @param cache_filename	[in] Cache filename of the original image.
+		 * @param size			[in] Requested image size.
+		 * @param img			[in] Scaled image.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		static int storeScaledImage(const std::string &cache_filename, int size, const LibRpBase::rp_image *img);
+
+	protected:
+		/**
+		 * Get the filename for a scaled image.
+		 * @param cache_filename	[in] Cache filename of the original image.
+		 * @param size			[in] Requested image size.
+		 * @return Scaled image filename.
+		 */
+		static std::string getScaledImageFilename(const std::string &cache_filename, int size);
+
+	public:
+		// Cache status from checkCacheFile().
+		enum CacheStatus {
+			CS_UNAVAILABLE	= -1,	// Negative cache entry, or error.
+			CS_MISSING	= 0,	// Not cached; should be downloaded.
+			CS_FRESH	= 1,	// Cached.
+			CS_STALE	= 2,	// Cached, but should be revalidated.
+		};
+
+	protected:
+		/**
+		 * Get the negative cache TTL for a number of consecutive failures.
+		 * The TTL is doubled for each failure, up to the maximum TTL.
+		 * @param failures Number of consecutive failures.
+		 * @return Negative cache TTL, in seconds.
+		 */
+		time_t negativeCacheTTLForFailures(unsigned int failures) const;
+
+		/**
+		 * Check the cache status of a cache file.
+		 *
+		 * Zero-byte files were used by older versions to indicate
+		 * negative cache entries. These are converted to metadata.
+		 *
+		 * @param cache_filename	[in] Cache filename.
+		 * @param meta			[out] Cache metadata.
+		 * @return CacheStatus.
+		 */
+		int checkCacheFile(const std::string &cache_filename, CacheMetadata &meta) const;
+
+		/**
+		 * Set the conditional request validators for a download.
+		 * @param downloader	[in] Downloader.
+		 * @param status	[in] CacheStatus from checkCacheFile().
+		 * @param meta		[in] Cache metadata from checkCacheFile().
+		 */
+		static void setValidators(IDownloader *downloader, int status, const CacheMetadata &meta);
+
+		/**
+		 * Store a downloaded file in the cache.
+		 *
+		 * If the download failed, a negative cache entry will be created.
+		 * If a stale file was being revalidated, the cached file will be
+		 * kept unless the server returned a new version.
+		 *
+		 * @param cache_filename	[in] Cache filename.
+		 * @param status		[in] CacheStatus from checkCacheFile().
+		 * @param meta			[in,out] Cache metadata from checkCacheFile().
+		 * @param dl_ret		[in] Return value from the downloader.
+		 * @param downloader		[in] Downloader.
+		 * @return 0 if the file is available in the cache; non-zero on error.
+		 */
+		int storeCacheFile(const std::string &cache_filename, int status,
+			CacheMetadata &meta, int dl_ret, const IDownloader *downloader) const;
+
+		/**
+		 * Check the cache status of a batch of requests.
+		 * @param requests	[in] Download requests.
+		 * @param state		[out] Batch state.
+		 * @param first		[in] If true, stop at the first available file.
+		 * @return Number of pending downloads.
+		 */
+		int checkBatch(const std::vector<DownloadRequest> &requests, BatchState &state, bool first);
+
+		/**
+		 * Download all pending files in a batch.
+		 * @param requests	[in] Download requests.
+		 * @param state		[in,out] Batch state.
+		 */
+		void downloadBatch(const std::vector<DownloadRequest> &requests, BatchState &state);
+
+#ifndef _WIN32
+		/**
+		 * CurlMultiDownloader completion callback.
+		 * @param dl		[in] CurlMultiDownloader.
+		 * @param index		[in] Transfer index.
+		 * @param result	[in] Result from the downloader.
+		 * @param userdata	[in] BatchState.
+		 */
+		static void multiCompletion(CurlMultiDownloader *dl, int index, int result, void *userdata);
+#endif /* !_WIN32 */
+
 	protected:
 		std::string m_proxyUrl;
 		IDownloader *m_downloader;
+		int m_maxConcurrentDownloads;
+
+		time_t m_revalidateInterval;	// Revalidation interval, in seconds.
+		time_t m_negativeCacheTTL;	// Initial negative cache TTL, in seconds.
+		time_t m_negativeCacheMaxTTL;	// Maximum negative cache TTL, in seconds.
+		uint64_t m_cacheMaxSize;	// Maximum cache size, in bytes.
 
 		// Semaphore used to limit the number of simultaneous downloads.
 		static LibRpBase::Semaphore m_dlsem;
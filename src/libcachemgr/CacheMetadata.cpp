@@ -0,0 +1,151 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libcachemgr)                      *
+ * CacheMetadata.cpp: Metadata for cached files.                           *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "CacheMetadata.hpp"
+
+// librpbase
+#include "librpbase/file/RpFile.hpp"
+#include "librpbase/file/FileSystem.hpp"
+using namespace LibRpBase;
+
+// C includes.
+#include <stdlib.h>
+
+// C includes. (C++ namespace)
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+// C++ includes.
+#include <string>
+using std::string;
+
+namespace LibCacheMgr {
+
+// Filename suffix for metadata files.
+const char CacheMetadata::METADATA_SUFFIX[] = ".rpmeta";
+
+/**
+ * Load the metadata for a cached file.
+ * @param cache_filename Cache filename. (not the metadata filename)
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int CacheMetadata::load(const string &cache_filename)
+{
+	clear();
+
+	RpFile *const file = new RpFile(cache_filename + METADATA_SUFFIX, RpFile::FM_OPEN_READ);
+	if (!file->isOpen()) {
+		int err = -file->lastError();
+		file->unref();
+		return (err != 0 ? err : -EIO);
+	}
+
+	// Metadata files are small.
+	char buf[1024];
+	const size_t size = file->read(buf, sizeof(buf)-1);
+	file->unref();
+	if (size == 0) {
+		return -EIO;
+	}
+	buf[size] = '\0';
+
+	// Parse the "name=value" lines.
+	char *line = buf;
+	while (*line != '\0') {
+		char *next = strchr(line, '\n');
+		if (next) {
+			*next++ = '\0';
+		} else {
+			next = line + strlen(line);
+		}
+
+		char *const eq = strchr(line, '=');
+		if (eq) {
+			*eq = '\0';
+			const char *const value = eq + 1;
+			if (!strcmp(line, "ETag")) {
+				etag = value;
+			} else if (!strcmp(line, "LastModified")) {
+				last_modified = static_cast<time_t>(strtoll(value, nullptr, 10));
+			} else if (!strcmp(line, "Checked")) {
+				checked = static_cast<time_t>(strtoll(value, nullptr, 10));
+			} else if (!strcmp(line, "Failures")) {
+				failures = static_cast<unsigned int>(strtoul(value, nullptr, 10));
+			}
+		}
+
+		line = next;
+	}
+
+	return 0;
+}
+
+/**
+ * Save the metadata for a cached file.
+ * @param cache_filename Cache filename. (not the metadata filename)
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int CacheMetadata::save(const string &cache_filename) const
+{
+	string data;
+	data.reserve(128);
+	char buf[48];
+	if (!etag.empty() && etag.find_first_of("\r\n") == string::npos) {
+		data += "ETag=";
+		data += etag;
+		data += '\n';
+	}
+	if (last_modified >= 0) {
+		snprintf(buf, sizeof(buf), "LastModified=%lld\n", static_cast<long long>(last_modified));
+		data += buf;
+	}
+	if (checked >= 0) {
+		snprintf(buf, sizeof(buf), "Checked=%lld\n", static_cast<long long>(checked));
+		data += buf;
+	}
+	if (failures > 0) {
+		snprintf(buf, sizeof(buf), "Failures=%u\n", failures);
+		data += buf;
+	}
+
+	RpFile *const file = new RpFile(cache_filename + METADATA_SUFFIX, RpFile::FM_CREATE_WRITE);
+	if (!file->isOpen()) {
+		int err = -file->lastError();
+		file->unref();
+		return (err != 0 ? err : -EIO);
+	}
+
+	const size_t size = file->write(data.data(), data.size());
+	file->unref();
+	return (size == data.size() ? 0 : -EIO);
+}
+
+/**
+ * Delete the metadata for a cached file.
+ * @param cache_filename Cache filename. (not the metadata filename)
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int CacheMetadata::remove(const string &cache_filename)
+{
+	return FileSystem::delete_file(cache_filename + METADATA_SUFFIX);
+}
+
+}
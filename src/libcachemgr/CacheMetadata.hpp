@@ -0,0 +1,100 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libcachemgr)                      *
+ * CacheMetadata.hpp: Metadata for cached files.                           *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef __ROMPROPERTIES_LIBCACHEMGR_CACHEMETADATA_HPP__
+#define __ROMPROPERTIES_LIBCACHEMGR_CACHEMETADATA_HPP__
+
+// C includes.
+#include <time.h>
+
+// C++ includes.
+#include <string>
+
+namespace LibCacheMgr {
+
+/**
+ * Metadata for a cached file.
+ *
+ * This is stored in a small text file next to the cached file,
+ * using the same filename plus METADATA_SUFFIX. It contains
+ * the HTTP validators used for conditional revalidation, and
+ * the retry state for negative cache entries.
+ */
+struct CacheMetadata
+{
+	std::string etag;	// ETag from the server. (empty if none)
+	time_t last_modified;	// Last-Modified time from the server. (-1 if none)
+	time_t checked;		// Last time the file was downloaded or revalidated. (-1 if unknown)
+	unsigned int failures;	// Number of consecutive failed downloads. (0 == positive entry)
+
+	// Filename suffix for metadata files.
+	static const char METADATA_SUFFIX[];
+
+	CacheMetadata()
+		: last_modified(-1)
+		, checked(-1)
+		, failures(0)
+	{ }
+
+	/**
+	 * Clear the metadata.
+	 */
+	void clear(void)
+	{
+		etag.clear();
+		last_modified = -1;
+		checked = -1;
+		failures = 0;
+	}
+
+	/**
+	 * Is this a negative cache entry?
+	 * @return True if the last download failed.
+	 */
+	bool isNegative(void) const
+	{
+		return (failures > 0);
+	}
+
+	/**
+	 * Load the metadata for a cached file.
+	 * @param cache_filename Cache filename. (not the metadata filename)
+	 * @return 0 on success; negative POSIX error code on error.
+	 */
+	int load(const std::string &cache_filename);
+
+	/**
+	 * Save the metadata for a cached file.
+	 * @param cache_filename Cache filename. (not the metadata filename)
+	 * @return 0 on success; negative POSIX error code on error.
+	 */
+	int save(const std::string &cache_filename) const;
+
+	/**
+	 * Delete the metadata for a cached file.
+	 * @param cache_filename Cache filename. (not the metadata filename)
+	 * @return 0 on success; negative POSIX error code on error.
+	 */
+	static int remove(const std::string &cache_filename);
+};
+
+}
+
+#endif /* __ROMPROPERTIES_LIBCACHEMGR_CACHEMETADATA_HPP__ */
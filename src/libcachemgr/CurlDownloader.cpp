@@ -20,11 +20,21 @@
 
 #include "CurlDownloader.hpp"
 
+// librpbase
+#include "librpbase/threads/Mutex.hpp"
+#include "librpbase/threads/pthread_once.h"
+using LibRpBase::Mutex;
+
 // C includes.
+#include <fcntl.h>
 #include <stdlib.h>
+#include <strings.h>
+#include <unistd.h>
 
 // C includes. (C++ namespace)
 #include "librpbase/ctypex.h"
+#include <cassert>
+#include <cerrno>
 #include <cstring>
 
 // C++ includes.
@@ -36,18 +46,198 @@ using std::string;
 
 namespace LibCacheMgr {
 
+// Write buffer size when streaming to an output file.
+// This limits the amount of memory used per transfer.
+static const size_t STREAM_BUFFER_SIZE = 64*1024;
+
+// cURL share handle.
+// NOTE: This is never freed, since DNS lookups and TLS sessions
+// should be reused for as long as the process is running.
+static CURLSH *curl_share = nullptr;
+// pthread_once() control variable.
+static pthread_once_t curl_share_once_control = PTHREAD_ONCE_INIT;
+// Mutexes for the cURL share handle. (one per data type)
+static Mutex curl_share_mutex[CURL_LOCK_DATA_LAST];
+
+/**
+ * cURL share lock function.
+ * @param handle cURL handle.
+ * @param data Data type to lock.
+ * @param access Access type.
+ * @param userptr User pointer. (unused)
+ */
+static void share_lock(CURL *handle, curl_lock_data data, curl_lock_access access, void *userptr)
+{
+	RP_UNUSED(handle);
+	RP_UNUSED(access);
+	RP_UNUSED(userptr);
+	assert(data >= 0 && data < CURL_LOCK_DATA_LAST);
+	if (data >= 0 && data < CURL_LOCK_DATA_LAST) {
+		curl_share_mutex[data].lock();
+	}
+}
+
+/**
+ * cURL share unlock function.
+ * @param handle cURL handle.
+ * @param data Data type to unlock.
+ * @param userptr User pointer. (unused)
+ */
+static void share_unlock(CURL *handle, curl_lock_data data, void *userptr)
+{
+	RP_UNUSED(handle);
+	RP_UNUSED(userptr);
+	assert(data >= 0 && data < CURL_LOCK_DATA_LAST);
+	if (data >= 0 && data < CURL_LOCK_DATA_LAST) {
+		curl_share_mutex[data].unlock();
+	}
+}
+
+/**
+ * Initialize the cURL share handle.
+ * Called by pthread_once().
+ */
+static void initCurlShare(void)
+{
+	// NOTE: curl_global_init() is called by curl_easy_init()
+	// if it hasn't been called yet, but curl_share_init()
+	// doesn't do that.
+	curl_global_init(CURL_GLOBAL_DEFAULT);
+
+	CURLSH *const share = curl_share_init();
+	if (!share) {
+		// Could not initialize the share handle.
+		return;
+	}
+
+	curl_share_setopt(share, CURLSHOPT_LOCKFUNC, share_lock);
+	curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, share_unlock);
+
+	// Share the DNS cache and TLS sessions.
+	// NOTE: The connection cache is NOT shared. The share handle
+	// is used by threads that run transfers at the same time, and
+	// sharing connections between them isn't safe. Connections are
+	// reused using per-thread easy handles instead.
+	curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+	curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+
+	curl_share = share;
+}
+
+/**
+ * Get the cURL share handle.
+ *
+ * The share handle is used by all CurlDownloader objects
+ * in the process, so DNS lookups and TLS sessions can be
+ * reused by later downloads on any thread.
+ *
+ * @return cURL share handle, or nullptr on error.
+ */
+static CURLSH *curlShare(void)
+{
+	pthread_once(&curl_share_once_control, initCurlShare);
+	return curl_share;
+}
+
+// Per-thread cURL easy handle. (CURL*)
+// When a CurlDownloader is deleted, its easy handle is kept
+// here so the next CurlDownloader on the same thread can reuse
+// its connection. TCreateThumbnail creates a short-lived
+// CacheManager per thumbnail, so this keeps the connection to
+// GameTDB open between thumbnails.
+static pthread_key_t curl_handle_key;
+// pthread_once() control variable.
+static pthread_once_t curl_handle_once_control = PTHREAD_ONCE_INIT;
+// Set if curl_handle_key was created.
+static bool curl_handle_key_ok = false;
+
+/**
+ * Delete a per-thread cURL easy handle when its thread exits.
+ * @param handle cURL easy handle.
+ */
+static void freeThreadHandle(void *handle)
+{
+	curl_easy_cleanup(static_cast<CURL*>(handle));
+}
+
+/**
+ * Initialize the per-thread cURL easy handle key.
+ * Called by pthread_once().
+ */
+static void initThreadHandleKey(void)
+{
+	curl_handle_key_ok = (pthread_key_create(&curl_handle_key, freeThreadHandle) == 0);
+}
+
+/**
+ * Take the calling thread's cURL easy handle.
+ * @return cURL easy handle, or nullptr if the thread doesn't have one.
+ */
+static CURL *takeThreadHandle(void)
+{
+	pthread_once(&curl_handle_once_control, initThreadHandleKey);
+	if (!curl_handle_key_ok)
+		return nullptr;
+
+	CURL *const curl = static_cast<CURL*>(pthread_getspecific(curl_handle_key));
+	if (curl) {
+		pthread_setspecific(curl_handle_key, nullptr);
+	}
+	return curl;
+}
+
+/**
+ * Keep a cURL easy handle as the calling thread's easy handle.
+ * If the thread already has one, the handle is deleted.
+ * @param curl cURL easy handle.
+ */
+static void releaseThreadHandle(CURL *curl)
+{
+	pthread_once(&curl_handle_once_control, initThreadHandleKey);
+	if (curl_handle_key_ok && !pthread_getspecific(curl_handle_key) &&
+	    pthread_setspecific(curl_handle_key, curl) == 0)
+	{
+		return;
+	}
+	curl_easy_cleanup(curl);
+}
+
+/** CurlDownloader **/
+
 CurlDownloader::CurlDownloader()
 	: super()
+	, m_curl(nullptr)
+	, m_headers(nullptr)
+	, m_outputFd(-1)
 { }
 
 CurlDownloader::CurlDownloader(const char *url)
 	: super(url)
+	, m_curl(nullptr)
+	, m_headers(nullptr)
+	, m_outputFd(-1)
 { }
 
 CurlDownloader::CurlDownloader(const string &url)
 	: super(url)
+	, m_curl(nullptr)
+	, m_headers(nullptr)
+	, m_outputFd(-1)
 { }
 
+CurlDownloader::~CurlDownloader()
+{
+	closeOutput();
+	if (m_headers) {
+		curl_slist_free_all(static_cast<curl_slist*>(m_headers));
+	}
+	if (m_curl) {
+		// Keep the easy handle for the next CurlDownloader
+		// on this thread.
+		releaseThreadHandle(static_cast<CURL*>(m_curl));
+	}
+}
+
 /**
  * Internal cURL data write function.
  * @param ptr Data to write.
@@ -65,17 +255,46 @@ size_t CurlDownloader::write_data(char *ptr, size_t size, size_t nmemb, void *us
 	CurlDownloader *curlDL = static_cast<CurlDownloader*>(userdata);
 	ao::uvector<uint8_t> *vec = &curlDL->m_data;
 	size_t len = size * nmemb;
+	const bool streaming = !curlDL->m_outputFile.empty();
 
 	if (curlDL->m_maxSize > 0) {
 		// Maximum buffer size is set.
 		// TODO: Check Content-Length header before receiving anything?
-		if (vec->size() + len > curlDL->m_maxSize) {
+		const size_t received = vec->size() + (streaming ? curlDL->m_streamedSize : 0);
+		if (received + len > curlDL->m_maxSize) {
 			// Out of memory.
 			return 0;
 		}
 	}
 
-	if (vec->capacity() == 0) {
+	if (streaming) {
+		// Streaming to the output file.
+		// Buffer the data to reduce the number of writes.
+		if (vec->capacity() == 0) {
+			vec->reserve(STREAM_BUFFER_SIZE);
+		}
+		if (vec->size() + len > STREAM_BUFFER_SIZE) {
+			if (curlDL->flushOutput() != 0) {
+				// Write error.
+				return 0;
+			}
+			if (len >= STREAM_BUFFER_SIZE) {
+				// Too big to buffer. Write it directly.
+				size_t pos = 0;
+				while (pos < len) {
+					const ssize_t ret = write(curlDL->m_outputFd, ptr + pos, len - pos);
+					if (ret < 0) {
+						if (errno == EINTR)
+							continue;
+						return 0;
+					}
+					pos += ret;
+				}
+				curlDL->m_streamedSize += len;
+				return len;
+			}
+		}
+	} else if (vec->capacity() == 0) {
 		// Capacity wasn't initialized by Content-Length.
 		// Reserve at least 64 KB.
 		static const size_t min_reserve = 64*1024;
@@ -108,11 +327,23 @@ size_t CurlDownloader::parse_header(char *ptr, size_t size, size_t nitems, void
 	size_t len = size * nitems;
 
 	// Supported headers.
+	// NOTE: Header names are case-insensitive.
+	// HTTP/2 servers always send lowercase header names.
+	static const char http_status[] = "HTTP/";
 	static const char http_content_length[] = "Content-Length: ";
 	static const char http_last_modified[] = "Last-Modified: ";
+	static const char http_etag[] = "ETag: ";
 
-	if (len >= sizeof(http_content_length) &&
-	    !memcmp(ptr, http_content_length, sizeof(http_content_length)-1))
+	if (len >= sizeof(http_status)-1 &&
+	    !memcmp(ptr, http_status, sizeof(http_status)-1))
+	{
+		// Status line. This is the start of a new response,
+		// e.g. after a redirect, so discard the previous headers.
+		curlDL->m_mtime = -1;
+		curlDL->m_etag.clear();
+	}
+	else if (len >= sizeof(http_content_length) &&
+	    !strncasecmp(ptr, http_content_length, sizeof(http_content_length)-1))
 	{
 		// Found the Content-Length.
 		// Parse the value.
@@ -141,10 +372,13 @@ size_t CurlDownloader::parse_header(char *ptr, size_t size, size_t nitems, void
 		}
 
 		// Reserve enough space for the file being downloaded.
-		vec->reserve(fileSize);
+		// (Not if streaming to the output file.)
+		if (curlDL->m_outputFile.empty()) {
+			vec->reserve(fileSize);
+		}
 	}
 	else if (len >= sizeof(http_last_modified) &&
-	         !memcmp(ptr, http_last_modified, sizeof(http_last_modified)-1))
+	         !strncasecmp(ptr, http_last_modified, sizeof(http_last_modified)-1))
 	{
 		// Found the Last-Modified time.
 		// Should be in the format: "Wed, 15 Nov 1995 04:58:08 GMT"
@@ -162,16 +396,30 @@ size_t CurlDownloader::parse_header(char *ptr, size_t size, size_t nitems, void
 		// Parse the modification time.
 		curlDL->m_mtime = curl_getdate(mtime_str, nullptr);
 	}
+	else if (len >= sizeof(http_etag) &&
+	         !strncasecmp(ptr, http_etag, sizeof(http_etag)-1))
+	{
+		// Found the ETag.
+		// This is an opaque string, including the quotes.
+		size_t val_len = len-(sizeof(http_etag)-1);
+		const char *const val = ptr+sizeof(http_etag)-1;
+		// Remove trailing whitespace. (usually "\r\n")
+		while (val_len > 0 && ISSPACE(val[val_len-1])) {
+			val_len--;
+		}
+		curlDL->m_etag.assign(val, val_len);
+	}
 
 	// Continue processing.
 	return len;
 }
 
 /**
- * Download the file.
- * @return 0 on success; non-zero on error. [TODO: HTTP error codes?]
+ * Set up the cURL easy handle for a download.
+ * This is used by both download() and CurlMultiDownloader.
+ * @return cURL easy handle (CURL*), or nullptr on error.
  */
-int CurlDownloader::download(void)
+void *CurlDownloader::prepare(void)
 {
 	// References:
 	// - http://stackoverflow.com/questions/1636333/download-file-using-libcurl-in-c-c
@@ -179,14 +427,41 @@ int CurlDownloader::download(void)
 	// - https://curl.haxx.se/libcurl/c/curl_easy_setopt.html
 
 	// Clear the previous download.
+	closeOutput();
 	m_data.clear();
+	m_streamedSize = 0;
+	m_streamed = false;
 	m_mtime = -1;
+	m_etag.clear();
+	m_notModified = false;
+	if (m_headers) {
+		curl_slist_free_all(static_cast<curl_slist*>(m_headers));
+		m_headers = nullptr;
+	}
 
 	// Initialize cURL.
-	CURL *curl = curl_easy_init();
-	if (!curl) {
-		// Could not initialize cURL.
-		return -1;	// TODO: Better error?
+	// The easy handle is reused for subsequent downloads, and
+	// is taken from the previous CurlDownloader on this thread
+	// if possible. curl_easy_reset() clears the options, but
+	// keeps the connection cache.
+	if (!m_curl) {
+		m_curl = takeThreadHandle();
+	}
+	if (!m_curl) {
+		m_curl = curl_easy_init();
+		if (!m_curl) {
+			// Could not initialize cURL.
+			return nullptr;
+		}
+	} else {
+		curl_easy_reset(static_cast<CURL*>(m_curl));
+	}
+	CURL *const curl = static_cast<CURL*>(m_curl);
+
+	// Use the shared DNS and TLS session caches.
+	CURLSH *const share = curlShare();
+	if (share) {
+		curl_easy_setopt(curl, CURLOPT_SHARE, share);
 	}
 
 	// Proxy settings.
@@ -199,11 +474,22 @@ int CurlDownloader::download(void)
 	// Set options for curl's "easy" mode.
 	curl_easy_setopt(curl, CURLOPT_URL, m_url.c_str());
 	curl_easy_setopt(curl, CURLOPT_NOPROGRESS, true);
-	// Fail on HTTP errors. (>= 400)
-	curl_easy_setopt(curl, CURLOPT_FAILONERROR, true);
+	// NOTE: Not using CURLOPT_FAILONERROR, since that closes
+	// the connection. HTTP errors are checked after the transfer.
 	// Redirection is required for http://amiibo.life/nfc/%08X-%08X
 	curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, true);
 
+	// Conditional request validators.
+	if (!m_ifNoneMatch.empty()) {
+		const string hdr = "If-None-Match: " + m_ifNoneMatch;
+		m_headers = curl_slist_append(nullptr, hdr.c_str());
+		curl_easy_setopt(curl, CURLOPT_HTTPHEADER, m_headers);
+	}
+	if (m_ifModifiedSince >= 0) {
+		curl_easy_setopt(curl, CURLOPT_TIMECONDITION, (long)CURL_TIMECOND_IFMODSINCE);
+		curl_easy_setopt(curl, CURLOPT_TIMEVALUE, (long)m_ifModifiedSince);
+	}
+
 	// Header and data functions.
 	curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, parse_header);
 	curl_easy_setopt(curl, CURLOPT_HEADERDATA, this);
@@ -222,21 +508,140 @@ int CurlDownloader::download(void)
 	curl_easy_setopt(curl, CURLOPT_TIMEOUT, 20);
 
 	// TODO: Set the User-Agent?
-	CURLcode res = curl_easy_perform(curl);
-	curl_easy_cleanup(curl);
-	if (res != CURLE_OK) {
+	return curl;
+}
+
+/**
+ * Check the result of a download.
+ * This is used by both download() and CurlMultiDownloader.
+ * @param result cURL result code. (CURLcode)
+ * @return 0 on success; non-zero on error.
+ */
+int CurlDownloader::finish(int result)
+{
+	if (result != CURLE_OK) {
 		// Error downloading the file.
+		closeOutput();
+		m_data.clear();
+		return -2;
+	}
+
+	// Check for 304 Not Modified.
+	// NOTE: cURL also reports an unmet time condition if the server
+	// ignored If-Modified-Since but sent an older Last-Modified time.
+	long response_code = 0;
+	long condition_unmet = 0;
+	curl_easy_getinfo(static_cast<CURL*>(m_curl), CURLINFO_RESPONSE_CODE, &response_code);
+	curl_easy_getinfo(static_cast<CURL*>(m_curl), CURLINFO_CONDITION_UNMET, &condition_unmet);
+	if (response_code == 304 || condition_unmet) {
+		// File was not modified.
+		closeOutput();
+		m_data.clear();
+		m_notModified = true;
+		return 0;
+	}
+
+	// Fail on HTTP errors. (>= 400)
+	if (response_code >= 400) {
+		// Discard the error page.
+		closeOutput();
+		m_data.clear();
+		m_mtime = -1;
 		return -2;
 	}
 
 	// Check if we have data.
-	if (m_data.empty()) {
+	if (m_data.empty() && m_streamedSize == 0) {
 		// No data.
+		closeOutput();
 		return -3;
 	}
 
+	if (!m_outputFile.empty()) {
+		// Write the rest of the data to the output file
+		// and make sure it's on disk.
+		int ret = flushOutput();
+		if (ret == 0 && fsync(m_outputFd) != 0) {
+			ret = -errno;
+		}
+		closeOutput();
+		if (ret != 0) {
+			return ret;
+		}
+		m_streamed = true;
+	}
+
 	// Data retrieved.
 	return 0;
 }
 
+/**
+ * Download the file.
+ * @return 0 on success; non-zero on error. [TODO: HTTP error codes?]
+ */
+int CurlDownloader::download(void)
+{
+	CURL *const curl = static_cast<CURL*>(prepare());
+	if (!curl) {
+		// Could not initialize cURL.
+		return -1;	// TODO: Better error?
+	}
+
+	CURLcode res = curl_easy_perform(curl);
+	return finish(res);
+}
+
+/**
+ * Write the buffered data to the output file.
+ * The output file is opened if it isn't open yet.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int CurlDownloader::flushOutput(void)
+{
+	assert(!m_outputFile.empty());
+	if (m_outputFd < 0) {
+		m_outputFd = open(m_outputFile.c_str(), O_WRONLY | O_TRUNC | O_CLOEXEC);
+		if (m_outputFd < 0) {
+			return -errno;
+		}
+	}
+
+	const uint8_t *ptr = m_data.data();
+	size_t len = m_data.size();
+	while (len > 0) {
+		const ssize_t ret = write(m_outputFd, ptr, len);
+		if (ret < 0) {
+			if (errno == EINTR)
+				continue;
+			return -errno;
+		}
+		ptr += ret;
+		len -= ret;
+	}
+
+	m_streamedSize += m_data.size();
+	m_data.clear();
+	return 0;
+}
+
+/**
+ * Close the output file.
+ */
+void CurlDownloader::closeOutput(void)
+{
+	if (m_outputFd >= 0) {
+		close(m_outputFd);
+		m_outputFd = -1;
+	}
+}
+
+/**
+ * Clear the data.
+ */
+void CurlDownloader::clear(void)
+{
+	closeOutput();
+	super::clear();
+}
+
 }
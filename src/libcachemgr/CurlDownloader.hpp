@@ -31,6 +31,7 @@ class CurlDownloader : public IDownloader
 		CurlDownloader();
 		explicit CurlDownloader(const char *url);
 		explicit CurlDownloader(const std::string &url);
+		virtual ~CurlDownloader();
 
 	private:
 		typedef IDownloader super;
@@ -57,12 +58,63 @@ class CurlDownloader : public IDownloader
 		 */
 		static size_t parse_header(char *ptr, size_t size, size_t nitems, void *userdata);
 
+		/**
+		 * Write the buffered data to the output file.
+		 * The output file is opened if it isn't open yet.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int flushOutput(void);
+
+		/**
+		 * Close the output file.
+		 */
+		void closeOutput(void);
+
+	protected:
+		friend class CurlMultiDownloader;
+
+		/**
+		 * Set up the cURL easy handle for a download.
+		 * This is used by both download() and CurlMultiDownloader.
+		 * @return cURL easy handle (CURL*), or nullptr on error.
+		 */
+		void *prepare(void);
+
+		/**
+		 * Check the result of a download.
+		 * This is used by both download() and CurlMultiDownloader.
+		 * @param result cURL result code. (CURLcode)
+		 * @return 0 on success; non-zero on error.
+		 */
+		int finish(int result);
+
 	public:
 		/**
 		 * Download the file.
 		 * @return 0 on success; non-zero on error. [TODO: HTTP error codes?]
 		 */
 		int download(void) final;
+
+		/**
+		 * Clear the data.
+		 */
+		void clear(void) final;
+
+	protected:
+		// cURL easy handle. (CURL*)
+		// This is kept between downloads in order to
+		// reuse the connection to the server. When the
+		// CurlDownloader is deleted, it's kept as the
+		// thread's easy handle for the next CurlDownloader.
+		void *m_curl;
+
+		// Extra request headers. (curl_slist*)
+		// This must be kept until the transfer is finished.
+		void *m_headers;
+
+		// Output file descriptor.
+		// Opened when the first data is received.
+		int m_outputFd;
 };
 
 }
@@ -0,0 +1,268 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libcachemgr)                      *
+ * CurlMultiDownloader.cpp: libcurl-based concurrent file downloader.      *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "CurlMultiDownloader.hpp"
+
+// C includes.
+#include <stdint.h>
+
+// C includes. (C++ namespace)
+#include <cassert>
+#include <cerrno>
+
+// C++ includes.
+#include <string>
+using std::string;
+
+// cURL for network access.
+#include <curl/curl.h>
+
+namespace LibCacheMgr {
+
+CurlMultiDownloader::CurlMultiDownloader()
+	: m_multi(nullptr)
+	, m_maxConcurrent(4)
+	, m_active(0)
+	, m_maxSize(0)
+{ }
+
+CurlMultiDownloader::~CurlMultiDownloader()
+{
+	for (auto iter = m_transfers.begin(); iter != m_transfers.end(); ++iter) {
+		delete iter->dl;
+	}
+}
+
+/**
+ * Get the maximum number of concurrent transfers.
+ * @return Maximum number of concurrent transfers.
+ */
+int CurlMultiDownloader::maxConcurrent(void) const
+{
+	return m_maxConcurrent;
+}
+
+/**
+ * Set the maximum number of concurrent transfers.
+ * @param maxConcurrent Maximum number of concurrent transfers. (minimum 1)
+ */
+void CurlMultiDownloader::setMaxConcurrent(int maxConcurrent)
+{
+	m_maxConcurrent = (maxConcurrent > 1 ? maxConcurrent : 1);
+}
+
+/**
+ * Set the maximum buffer size for each transfer. (0 == unlimited)
+ * This affects transfers added after this call.
+ * @param maxSize Maximum buffer size.
+ */
+void CurlMultiDownloader::setMaxSize(size_t maxSize)
+{
+	m_maxSize = maxSize;
+}
+
+/**
+ * Set the proxy server for each transfer.
+ * This affects transfers added after this call.
+ * @param proxyUrl Proxy server URL. (Use blank string for default settings.)
+ */
+void CurlMultiDownloader::setProxyUrl(const string &proxyUrl)
+{
+	m_proxyUrl = proxyUrl;
+}
+
+/**
+ * Add a URL to download.
+ * Transfers are started in the order they were added.
+ * @param url URL.
+ * @return Transfer index.
+ */
+int CurlMultiDownloader::addUrl(const string &url)
+{
+	Transfer transfer;
+	transfer.dl = new CurlDownloader(url);
+	transfer.dl->setMaxSize(m_maxSize);
+	transfer.dl->setProxyUrl(m_proxyUrl);
+	transfer.state = TS_PENDING;
+	m_transfers.push_back(transfer);
+	return static_cast<int>(m_transfers.size() - 1);
+}
+
+/**
+ * Get the number of transfers.
+ * @return Number of transfers.
+ */
+int CurlMultiDownloader::count(void) const
+{
+	return static_cast<int>(m_transfers.size());
+}
+
+/**
+ * Get the downloader for a transfer.
+ * This can be used to retrieve the data after the transfer completes.
+ * @param index Transfer index.
+ * @return Downloader, or nullptr if the index is invalid.
+ */
+IDownloader *CurlMultiDownloader::downloader(int index)
+{
+	assert(index >= 0 && index < count());
+	if (index < 0 || index >= count())
+		return nullptr;
+	return m_transfers[index].dl;
+}
+
+/**
+ * Cancel a transfer.
+ * If the transfer hasn't started, it won't be started.
+ * If the transfer is in progress, it will be aborted.
+ * The completion callback is not called for cancelled transfers.
+ * @param index Transfer index.
+ */
+void CurlMultiDownloader::cancel(int index)
+{
+	assert(index >= 0 && index < count());
+	if (index < 0 || index >= count())
+		return;
+
+	Transfer &transfer = m_transfers[index];
+	switch (transfer.state) {
+		case TS_PENDING:
+			transfer.state = TS_CANCELLED;
+			break;
+		case TS_ACTIVE:
+			assert(m_multi != nullptr);
+			curl_multi_remove_handle(static_cast<CURLM*>(m_multi),
+				static_cast<CURL*>(transfer.dl->m_curl));
+			transfer.dl->clear();
+			transfer.state = TS_CANCELLED;
+			m_active--;
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+ * Download all of the files.
+ * This function blocks until all transfers have either
+ * finished or been cancelled.
+ * @param callback	[in,opt] Completion callback.
+ * @param userdata	[in,opt] User data for the callback.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int CurlMultiDownloader::perform(completion_fn callback, void *userdata)
+{
+	CURLM *const multi = curl_multi_init();
+	if (!multi) {
+		return -ENOMEM;
+	}
+	m_multi = multi;
+	m_active = 0;
+
+	// Limit the number of connections, too.
+	// Otherwise, cURL may open a new connection for
+	// each transfer instead of waiting for a free one.
+	curl_multi_setopt(multi, CURLMOPT_MAX_TOTAL_CONNECTIONS, static_cast<long>(m_maxConcurrent));
+
+	const int count = static_cast<int>(m_transfers.size());
+	int next = 0;
+	int ret = 0;
+	while (true) {
+		// Start more transfers if we have free slots.
+		for (; next < count && m_active < m_maxConcurrent; next++) {
+			Transfer &transfer = m_transfers[next];
+			if (transfer.state != TS_PENDING)
+				continue;
+
+			CURL *const curl = static_cast<CURL*>(transfer.dl->prepare());
+			if (!curl) {
+				// Could not initialize cURL.
+				transfer.state = TS_DONE;
+				if (callback) {
+					callback(this, next, -1, userdata);
+				}
+				continue;
+			}
+			curl_easy_setopt(curl, CURLOPT_PRIVATE, reinterpret_cast<char*>(static_cast<intptr_t>(next)));
+			curl_multi_add_handle(multi, curl);
+			transfer.state = TS_ACTIVE;
+			m_active++;
+		}
+
+		if (m_active == 0) {
+			// No more transfers.
+			break;
+		}
+
+		int running = 0;
+		CURLMcode mret = curl_multi_perform(multi, &running);
+		if (mret != CURLM_OK) {
+			ret = -EIO;
+			break;
+		}
+
+		// Check for completed transfers.
+		CURLMsg *msg;
+		int msgs_left = 0;
+		while ((msg = curl_multi_info_read(multi, &msgs_left)) != nullptr) {
+			if (msg->msg != CURLMSG_DONE)
+				continue;
+
+			char *priv = nullptr;
+			curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, &priv);
+			const int index = static_cast<int>(reinterpret_cast<intptr_t>(priv));
+			assert(index >= 0 && index < count);
+			Transfer &transfer = m_transfers[index];
+			if (transfer.state != TS_ACTIVE) {
+				// Transfer was cancelled.
+				continue;
+			}
+
+			const CURLcode result = msg->data.result;
+			curl_multi_remove_handle(multi, msg->easy_handle);
+			transfer.state = TS_DONE;
+			m_active--;
+
+			const int dl_ret = transfer.dl->finish(result);
+			if (callback) {
+				callback(this, index, dl_ret, userdata);
+			}
+		}
+
+		if (running > 0) {
+			// Wait for activity.
+			curl_multi_wait(multi, nullptr, 0, 1000, nullptr);
+		}
+	}
+
+	// Remove any transfers that are still active.
+	// (Only if an error occurred.)
+	for (int i = 0; i < count; i++) {
+		if (m_transfers[i].state == TS_ACTIVE) {
+			cancel(i);
+		}
+	}
+
+	curl_multi_cleanup(multi);
+	m_multi = nullptr;
+	return ret;
+}
+
+}
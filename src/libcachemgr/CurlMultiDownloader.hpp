@@ -0,0 +1,152 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libcachemgr)                      *
+ * CurlMultiDownloader.hpp: libcurl-based concurrent file downloader.      *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef __ROMPROPERTIES_LIBCACHEMGR_CURLMULTIDOWNLOADER_HPP__
+#define __ROMPROPERTIES_LIBCACHEMGR_CURLMULTIDOWNLOADER_HPP__
+
+#include "CurlDownloader.hpp"
+
+// C++ includes.
+#include <string>
+#include <vector>
+
+namespace LibCacheMgr {
+
+/**
+ * Download multiple files concurrently using the
+ * cURL "multi" interface.
+ *
+ * Each transfer uses its own CurlDownloader, so the
+ * downloaded data can be retrieved using downloader().
+ */
+class CurlMultiDownloader
+{
+	public:
+		CurlMultiDownloader();
+		~CurlMultiDownloader();
+
+	private:
+		RP_DISABLE_COPY(CurlMultiDownloader)
+
+	public:
+		/**
+		 * Completion callback.
+		 *
+		 * Called once for each transfer that finishes, in order of
+		 * completion. cancel() may be called from the callback.
+		 *
+		 * @param dl		[in] CurlMultiDownloader.
+		 * @param index		[in] Transfer index.
+		 * @param result	[in] Result from the downloader. (0 on success)
+		 * @param userdata	[in] User data.
+		 */
+		typedef void (*completion_fn)(CurlMultiDownloader *dl, int index, int result, void *userdata);
+
+		/**
+		 * Get the maximum number of concurrent transfers.
+		 * @return Maximum number of concurrent transfers.
+		 */
+		int maxConcurrent(void) const;
+
+		/**
+		 * Set the maximum number of concurrent transfers.
+		 * @param maxConcurrent Maximum number of concurrent transfers. (minimum 1)
+		 */
+		void setMaxConcurrent(int maxConcurrent);
+
+		/**
+		 * Set the maximum buffer size for each transfer. (0 == unlimited)
+		 * This affects transfers added after this call.
+		 * @param maxSize Maximum buffer size.
+		 */
+		void setMaxSize(size_t maxSize);
+
+		/**
+		 * Set the proxy server for each transfer.
+		 * This affects transfers added after this call.
+		 * @param proxyUrl Proxy server URL. (Use blank string for default settings.)
+		 */
+		void setProxyUrl(const std::string &proxyUrl);
+
+		/**
+		 * Add a URL to download.
+		 * Transfers are started in the order they were added.
+		 * @param url URL.
+		 * @return Transfer index.
+		 */
+		int addUrl(const std::string &url);
+
+		/**
+		 * Get the number of transfers.
+		 * @return Number of transfers.
+		 */
+		int count(void) const;
+
+		/**
+		 * Get the downloader for a transfer.
+		 * This can be used to retrieve the data after the transfer completes.
+		 * @param index Transfer index.
+		 * @return Downloader, or nullptr if the index is invalid.
+		 */
+		IDownloader *downloader(int index);
+
+		/**
+		 * Cancel a transfer.
+		 * If the transfer hasn't started, it won't be started.
+		 * If the transfer is in progress, it will be aborted.
+		 * The completion callback is not called for cancelled transfers.
+		 * @param index Transfer index.
+		 */
+		void cancel(int index);
+
+		/**
+		 * Download all of the files.
+		 * This function blocks until all transfers have either
+		 * finished or been cancelled.
+		 * @param callback	[in,opt] Completion callback.
+		 * @param userdata	[in,opt] User data for the callback.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int perform(completion_fn callback, void *userdata);
+
+	private:
+		enum TransferState {
+			TS_PENDING,	// Not started yet.
+			TS_ACTIVE,	// In progress.
+			TS_DONE,	// Finished.
+			TS_CANCELLED,	// Cancelled.
+		};
+
+		struct Transfer {
+			CurlDownloader *dl;
+			TransferState state;
+		};
+		std::vector<Transfer> m_transfers;
+
+		void *m_multi;		// CURLM*
+		int m_maxConcurrent;
+		int m_active;		// Number of active transfers.
+		size_t m_maxSize;
+		std::string m_proxyUrl;
+};
+
+}
+
+#endif /* __ROMPROPERTIES_LIBCACHEMGR_CURLMULTIDOWNLOADER_HPP__ */
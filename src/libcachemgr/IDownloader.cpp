@@ -31,21 +31,33 @@ using std::string;
 namespace LibCacheMgr {
 
 IDownloader::IDownloader()
-	: m_mtime(-1)
+	: m_streamedSize(0)
+	, m_streamed(false)
+	, m_mtime(-1)
+	, m_ifModifiedSince(-1)
+	, m_notModified(false)
 	, m_inProgress(false)
 	, m_maxSize(0)
 { }
 
 IDownloader::IDownloader(const char *url)
 	: m_url(url)
+	, m_streamedSize(0)
+	, m_streamed(false)
 	, m_mtime(-1)
+	, m_ifModifiedSince(-1)
+	, m_notModified(false)
 	, m_inProgress(false)
 	, m_maxSize(0)
 { }
 
 IDownloader::IDownloader(const string &url)
 	: m_url(url)
+	, m_streamedSize(0)
+	, m_streamed(false)
 	, m_mtime(-1)
+	, m_ifModifiedSince(-1)
+	, m_notModified(false)
 	, m_inProgress(false)
 	, m_maxSize(0)
 { }
@@ -154,24 +166,98 @@ void IDownloader::setProxyUrl(const string &proxyUrl)
 	m_proxyUrl = proxyUrl;
 }
 
+/** Conditional requests. **/
+
+/**
+ * Set the ETag for an If-None-Match request.
+ * @param etag ETag from a previous download. (Use blank string to disable.)
+ */
+void IDownloader::setIfNoneMatch(const string &etag)
+{
+	assert(!m_inProgress);
+	m_ifNoneMatch = etag;
+}
+
+/**
+ * Set the time for an If-Modified-Since request.
+ * @param mtime Last-Modified time from a previous download. (Use -1 to disable.)
+ */
+void IDownloader::setIfModifiedSince(time_t mtime)
+{
+	assert(!m_inProgress);
+	m_ifModifiedSince = mtime;
+}
+
+/**
+ * Was the file not modified since the previous download?
+ * If true, download() returned 0, but there is no data.
+ * @return True if the server returned 304 Not Modified.
+ */
+bool IDownloader::isNotModified(void) const
+{
+	return m_notModified;
+}
+
+/** Output file. **/
+
+/**
+ * Get the output file.
+ * @return Output file, or empty string if the data is kept in memory.
+ */
+string IDownloader::outputFile(void) const
+{
+	return m_outputFile;
+}
+
+/**
+ * Set the output file.
+ *
+ * If set, the data is written to this file as it's received
+ * instead of being kept in memory. The file must already exist;
+ * it will be truncated. Once the download has completed, the
+ * file is flushed to disk. If the download fails, the file may
+ * contain partial data.
+ *
+ * NOTE: Downloaders that don't support output files will
+ * keep the data in memory. Check isStreamed() afterwards.
+ *
+ * @param filename Output file. (Use blank string to keep the data in memory.)
+ */
+void IDownloader::setOutputFile(const string &filename)
+{
+	assert(!m_inProgress);
+	m_outputFile = filename;
+}
+
+/**
+ * Was the data written to the output file?
+ * @return True if the data is in the output file; false if it's in memory.
+ */
+bool IDownloader::isStreamed(void) const
+{
+	return m_streamed;
+}
+
 /** Data accessors. **/
 
 /**
  * Get the size of the data.
+ * If the data was written to the output file,
+ * this is the size of the file.
  * @return Size of the data.
  */
 size_t IDownloader::dataSize(void) const
 {
-	return m_data.size();
+	return (m_streamed ? m_streamedSize : m_data.size());
 }
 
 /**
 * Get a pointer to the start of the data.
-* @return Pointer to the start of the data.
+* @return Pointer to the start of the data, or nullptr if the data was written to the output file.
 */
 const uint8_t *IDownloader::data(void) const
 {
-	return m_data.data();
+	return (m_streamed ? nullptr : m_data.data());
 }
 
 /**
@@ -183,6 +269,15 @@ time_t IDownloader::mtime(void) const
 	return m_mtime;
 }
 
+/**
+ * Get the ETag.
+ * @return ETag, or empty string if none was set by the server.
+ */
+string IDownloader::etag(void) const
+{
+	return m_etag;
+}
+
 /**
  * Clear the data.
  */
@@ -191,6 +286,8 @@ void IDownloader::clear(void)
 	assert(!m_inProgress);
 	// TODO: Don't clear if m_inProgress?
 	m_data.clear();
+	m_streamedSize = 0;
+	m_streamed = false;
 }
 
 }
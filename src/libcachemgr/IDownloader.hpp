@@ -112,18 +112,75 @@ class IDownloader
 		 */
 		void setProxyUrl(const std::string &proxyUrl);
 
+	public:
+		/** Conditional requests. **/
+		// NOTE: Downloaders that don't support conditional
+		// requests will always download the full file.
+
+		/**
+		 * Set the ETag for an If-None-Match request.
+		 * @param etag ETag from a previous download. (Use blank string to disable.)
+		 */
+		void setIfNoneMatch(const std::string &etag);
+
+		/**
+		 * Set the time for an If-Modified-Since request.
+		 * @param mtime Last-Modified time from a previous download. (Use -1 to disable.)
+		 */
+		void setIfModifiedSince(time_t mtime);
+
+		/**
+		 * Was the file not modified since the previous download?
+		 * If true, download() returned 0, but there is no data.
+		 * @return True if the server returned 304 Not Modified.
+		 */
+		bool isNotModified(void) const;
+
+	public:
+		/** Output file. **/
+
+		/**
+		 * Get the output file.
+		 * @return Output file, or empty string if the data is kept in memory.
+		 */
+		std::string outputFile(void) const;
+
+		/**
+		 * Set the output file.
+		 *
+		 * If set, the data is written to this file as it's received
+		 * instead of being kept in memory. The file must already exist;
+		 * it will be truncated. Once the download has completed, the
+		 * file is flushed to disk. If the download fails, the file may
+		 * contain partial data.
+		 *
+		 * NOTE: Downloaders that don't support output files will
+		 * keep the data in memory. Check isStreamed() afterwards.
+		 *
+		 * @param filename Output file. (Use blank string to keep the data in memory.)
+		 */
+		void setOutputFile(const std::string &filename);
+
+		/**
+		 * Was the data written to the output file?
+		 * @return True if the data is in the output file; false if it's in memory.
+		 */
+		bool isStreamed(void) const;
+
 	public:
 		/** Data accessors. **/
 
 		/**
 		 * Get the size of the data.
+		 * If the data was written to the output file,
+		 * this is the size of the file.
 		 * @return Size of the data.
 		 */
 		size_t dataSize(void) const;
 
 		/**
 		 * Get a pointer to the start of the data.
-		 * @return Pointer to the start of the data.
+		 * @return Pointer to the start of the data, or nullptr if the data was written to the output file.
 		 */
 		const uint8_t *data(void) const;
 
@@ -133,10 +190,16 @@ class IDownloader
 		 */
 		time_t mtime(void) const;
 
+		/**
+		 * Get the ETag.
+		 * @return ETag, or empty string if none was set by the server.
+		 */
+		std::string etag(void) const;
+
 		/**
 		 * Clear the data.
 		 */
-		void clear(void);
+		virtual void clear(void);
 
 	public:
 		/**
@@ -151,10 +214,24 @@ class IDownloader
 
 		// Uninitialized vector class.
 		// Reference: http://andreoffringa.org/?q=uvector
+		// If streaming to an output file, this is
+		// only used as a write buffer.
 		ao::uvector<uint8_t> m_data;
 
+		// Output file.
+		std::string m_outputFile;
+		size_t m_streamedSize;	// Number of bytes written to the output file.
+		bool m_streamed;	// Set if the data was written to the output file.
+
 		// Last-Modified time.
 		time_t m_mtime;
+		// ETag.
+		std::string m_etag;
+
+		// Conditional request validators.
+		std::string m_ifNoneMatch;
+		time_t m_ifModifiedSince;
+		bool m_notModified;	// Set if the server returned 304 Not Modified.
 
 		bool m_inProgress;	// Set when downloading.
 		size_t m_maxSize;	// Maximum buffer size. (0 == unlimited)
@@ -0,0 +1,980 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libcachemgr/tests)                *
+ * CacheManagerTest.cpp: CacheManager concurrent download tests.           *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// Cache Manager
+#include "../CacheManager.hpp"
+#include "../CurlMultiDownloader.hpp"
+#include "../CacheMetadata.hpp"
+#include "../CacheIndex.hpp"
+#include "HttpStubServer.hpp"
+
+// librpbase
+#include "librpbase/file/FileSystem.hpp"
+#include "librpbase/img/rp_image.hpp"
+using namespace LibRpBase;
+
+// C includes.
+#include <dirent.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstring>
+
+// C++ includes.
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+namespace LibCacheMgr { namespace Tests {
+
+class CacheManagerTest : public ::testing::Test
+{
+	protected:
+		CacheManagerTest() { }
+
+		static void SetUpTestCase(void)
+		{
+			// Don't send requests for the local server to a proxy.
+			setenv("no_proxy", "127.0.0.1", 1);
+
+			// Use a temporary cache directory.
+			// NOTE: This must be set before the cache directory
+			// is initialized by FileSystem::getCacheDirectory().
+			char tmpl[] = "/tmp/rp-CacheManagerTest.XXXXXX";
+			if (mkdtemp(tmpl)) {
+				ms_tmpdir = tmpl;
+				setenv("XDG_CACHE_HOME", tmpl, 1);
+			}
+		}
+
+		static void TearDownTestCase(void)
+		{
+			// Remove the temporary cache directory.
+			if (!ms_tmpdir.empty()) {
+				nftw(ms_tmpdir.c_str(), removeEntry, 16, FTW_DEPTH | FTW_PHYS);
+				ms_tmpdir.clear();
+			}
+		}
+
+		void SetUp(void) final
+		{
+			ASSERT_FALSE(ms_tmpdir.empty());
+			ASSERT_EQ(0, m_server.start());
+		}
+
+		void TearDown(void) final
+		{
+			m_server.stop();
+		}
+
+		static int removeEntry(const char *fpath, const struct stat *sb, int typeflag, struct FTW *ftwbuf)
+		{
+			RP_UNUSED(sb);
+			RP_UNUSED(typeflag);
+			RP_UNUSED(ftwbuf);
+			return remove(fpath);
+		}
+
+		/**
+		 * Get the current time in milliseconds.
+		 * @return Current time, in milliseconds.
+		 */
+		static int64_t msecs(void)
+		{
+			struct timeval tv;
+			gettimeofday(&tv, nullptr);
+			return (int64_t)tv.tv_sec * 1000 + (tv.tv_usec / 1000);
+		}
+
+		/**
+		 * Create a download request for the stub server.
+		 * The cache key is unique to the current test.
+		 * @param path Path on the stub server.
+		 * @return Download request.
+		 */
+		CacheManager::DownloadRequest request(const char *path) const
+		{
+			const ::testing::TestInfo *const info =
+				::testing::UnitTest::GetInstance()->current_test_info();
+			string cache_key = "test/";
+			cache_key += info->name();
+			cache_key += path;
+			return CacheManager::DownloadRequest(m_server.url(path), cache_key);
+		}
+
+		/**
+		 * Get the cache filename for a cache key.
+		 * @param cache_key Cache key.
+		 * @return Cache filename.
+		 */
+		static string cacheFilename(const string &cache_key)
+		{
+			string filename = FileSystem::getCacheDirectory();
+			filename += '/';
+			filename += cache_key;
+			return filename;
+		}
+
+		/**
+		 * Count the temporary download files in a directory.
+		 * @param dir Directory.
+		 * @return Number of temporary files.
+		 */
+		static unsigned int countTempFiles(const string &dir)
+		{
+			unsigned int count = 0;
+			DIR *const d = opendir(dir.c_str());
+			if (!d)
+				return 0;
+			struct dirent *ent;
+			while ((ent = readdir(d)) != nullptr) {
+				if (!strncmp(ent->d_name, CacheIndex::TEMP_PREFIX, strlen(CacheIndex::TEMP_PREFIX))) {
+					count++;
+				}
+			}
+			closedir(d);
+			return count;
+		}
+
+		/**
+		 * Make a cache entry's last check older.
+		 * @param cache_filename Cache filename.
+		 * @param seconds Number of seconds to subtract.
+		 */
+		static void ageCacheEntry(const string &cache_filename, time_t seconds)
+		{
+			CacheMetadata meta;
+			ASSERT_EQ(0, meta.load(cache_filename));
+			meta.checked -= seconds;
+			ASSERT_EQ(0, meta.save(cache_filename));
+
+			// The cache index has its own copy.
+			CacheIndex *const idx = CacheManager::index();
+			ASSERT_TRUE(idx != nullptr);
+			CacheIndex::Entry entry;
+			ASSERT_EQ(1, idx->lookup(cache_filename, &entry, false));
+			ASSERT_EQ(0, idx->update(cache_filename, -1,
+				entry.checked - seconds, entry.failures, string()));
+		}
+
+		/**
+		 * Conditional request handler.
+		 * Returns 304 if the request's validators match the current version.
+		 */
+		struct ConditionalHandler {
+			string etag;		// Current ETag.
+			string last_modified;	// Current Last-Modified. (HTTP date)
+			string body;		// Current body.
+			int status;		// Status for unconditional requests.
+			unsigned int conditional;	// Number of conditional requests.
+
+			ConditionalHandler()
+				: status(200), conditional(0) { }
+
+			static HttpStubServer::Response handle(const string &path,
+				const std::map<string, string> &headers, void *userdata)
+			{
+				RP_UNUSED(path);
+				ConditionalHandler *const h = static_cast<ConditionalHandler*>(userdata);
+				auto inm = headers.find("if-none-match");
+				auto ims = headers.find("if-modified-since");
+				if (inm != headers.end() || ims != headers.end()) {
+					h->conditional++;
+				}
+
+				if (h->status == 200) {
+					if ((inm != headers.end() && inm->second == h->etag) ||
+					    (inm == headers.end() && ims != headers.end() &&
+					     ims->second == h->last_modified))
+					{
+						return HttpStubServer::Response(304, string());
+					}
+				}
+
+				HttpStubServer::Response resp(h->status, (h->status == 200 ? h->body : string()));
+				if (h->status == 200) {
+					if (!h->etag.empty()) {
+						resp.headers.push_back(std::make_pair(string("ETag"), h->etag));
+					}
+					if (!h->last_modified.empty()) {
+						resp.headers.push_back(std::make_pair(string("Last-Modified"), h->last_modified));
+					}
+				}
+				return resp;
+			}
+		};
+
+		struct CompletionInfo {
+			vector<int> results;
+			vector<int> order;
+		};
+
+		static void completion(CurlMultiDownloader *dl, int index, int result, void *userdata)
+		{
+			RP_UNUSED(dl);
+			CompletionInfo *const info = static_cast<CompletionInfo*>(userdata);
+			info->results[index] = result;
+			info->order.push_back(index);
+		}
+
+	public:
+		HttpStubServer m_server;
+		static string ms_tmpdir;
+};
+
+string CacheManagerTest::ms_tmpdir;
+
+/**
+ * CurlMultiDownloader: Download multiple files concurrently.
+ */
+TEST_F(CacheManagerTest, multiDownloadTest)
+{
+	static const unsigned int DELAY = 300;
+	m_server.setResponse("/a.png", HttpStubServer::Response(200, "A", DELAY));
+	m_server.setResponse("/b.png", HttpStubServer::Response(200, "BB", DELAY));
+	m_server.setResponse("/c.png", HttpStubServer::Response(200, "CCC", DELAY));
+
+	CurlMultiDownloader multi;
+	multi.setMaxConcurrent(4);
+	multi.addUrl(m_server.url("/a.png"));
+	multi.addUrl(m_server.url("/b.png"));
+	multi.addUrl(m_server.url("/missing.png"));
+	multi.addUrl(m_server.url("/c.png"));
+
+	CompletionInfo info;
+	info.results.assign(4, 1);
+	const int64_t start = msecs();
+	ASSERT_EQ(0, multi.perform(completion, &info));
+	const int64_t elapsed = msecs() - start;
+
+	EXPECT_EQ(0, info.results[0]);
+	EXPECT_EQ(0, info.results[1]);
+	EXPECT_NE(0, info.results[2]);
+	EXPECT_EQ(0, info.results[3]);
+	EXPECT_EQ(4U, info.order.size());
+	EXPECT_EQ(2U, multi.downloader(1)->dataSize());
+	EXPECT_EQ(3U, multi.downloader(3)->dataSize());
+
+	// Serial downloads would take at least 3*DELAY.
+	EXPECT_LT(elapsed, (int64_t)(DELAY * 3));
+}
+
+/**
+ * CurlMultiDownloader: Concurrency limit.
+ */
+TEST_F(CacheManagerTest, multiConcurrencyLimitTest)
+{
+	m_server.setResponse("/a.png", HttpStubServer::Response(200, "A", 50));
+
+	CurlMultiDownloader multi;
+	multi.setMaxConcurrent(2);
+	for (int i = 0; i < 6; i++) {
+		multi.addUrl(m_server.url("/a.png"));
+	}
+
+	CompletionInfo info;
+	info.results.assign(6, 1);
+	ASSERT_EQ(0, multi.perform(completion, &info));
+	for (int i = 0; i < 6; i++) {
+		EXPECT_EQ(0, info.results[i]) << "transfer " << i;
+	}
+	EXPECT_EQ(6U, m_server.requestCount());
+	EXPECT_LE(m_server.connectionCount(), 2U);
+}
+
+/**
+ * downloadFirst(): The highest-priority available candidate wins,
+ * even if a lower-priority candidate finishes first.
+ */
+TEST_F(CacheManagerTest, downloadFirstPriorityTest)
+{
+	m_server.setResponse("/b.png", HttpStubServer::Response(200, "slow", 200));
+	m_server.setResponse("/c.png", HttpStubServer::Response(200, "fast"));
+
+	vector<CacheManager::DownloadRequest> requests;
+	requests.push_back(request("/missing.png"));
+	requests.push_back(request("/b.png"));
+	requests.push_back(request("/c.png"));
+
+	CacheManager cache;
+	int index = -1;
+	const string filename = cache.downloadFirst(requests, &index);
+	EXPECT_EQ(1, index);
+	ASSERT_FALSE(filename.empty());
+	EXPECT_EQ(4, FileSystem::filesize(filename));
+
+	// The missing file should have a negative cache entry.
+	EXPECT_TRUE(cache.findInCache(requests[0].cache_key).empty());
+	CacheMetadata meta;
+	ASSERT_EQ(0, meta.load(cacheFilename(requests[0].cache_key)));
+	EXPECT_EQ(1U, meta.failures);
+
+	// Requesting it again should use the cache.
+	m_server.resetCounters();
+	EXPECT_EQ(filename, cache.downloadFirst(requests, &index));
+	EXPECT_EQ(1, index);
+	EXPECT_EQ(0U, m_server.requestCount());
+}
+
+/**
+ * downloadFirst(): Lower-priority downloads are cancelled
+ * once the highest-priority candidate is available.
+ */
+TEST_F(CacheManagerTest, downloadFirstCancelTest)
+{
+	static const unsigned int SLOW_DELAY = 1000;
+	m_server.setResponse("/a.png", HttpStubServer::Response(200, "fast"));
+	m_server.setResponse("/b.png", HttpStubServer::Response(200, "slow", SLOW_DELAY));
+
+	vector<CacheManager::DownloadRequest> requests;
+	requests.push_back(request("/a.png"));
+	requests.push_back(request("/b.png"));
+
+	CacheManager cache;
+	int index = -1;
+	const int64_t start = msecs();
+	const string filename = cache.downloadFirst(requests, &index);
+	const int64_t elapsed = msecs() - start;
+	EXPECT_EQ(0, index);
+	EXPECT_FALSE(filename.empty());
+	EXPECT_LT(elapsed, (int64_t)SLOW_DELAY);
+
+	// The cancelled download must not leave a cache entry.
+	EXPECT_TRUE(cache.findInCache(requests[1].cache_key).empty());
+	EXPECT_EQ(0U, countTempFiles(cacheFilename("test")));
+}
+
+/**
+ * downloadFirst(): A cached lower-priority candidate is used
+ * if all higher-priority candidates are unavailable.
+ */
+TEST_F(CacheManagerTest, downloadFirstCachedFallbackTest)
+{
+	m_server.setResponse("/b.png", HttpStubServer::Response(200, "cached"));
+
+	vector<CacheManager::DownloadRequest> requests;
+	requests.push_back(request("/missing.png"));
+	requests.push_back(request("/b.png"));
+	requests.push_back(request("/c.png"));
+
+	// Cache the second candidate.
+	CacheManager cache;
+	ASSERT_FALSE(cache.download(requests[1].url, requests[1].cache_key).empty());
+	m_server.resetCounters();
+
+	int index = -1;
+	EXPECT_FALSE(cache.downloadFirst(requests, &index).empty());
+	EXPECT_EQ(1, index);
+
+	// Only the first candidate should have been requested.
+	EXPECT_EQ(1U, m_server.requestCount());
+	EXPECT_EQ(1U, m_server.requestCount("/missing.png"));
+}
+
+/**
+ * downloadFirst(): No candidates are available.
+ */
+TEST_F(CacheManagerTest, downloadFirstNoneTest)
+{
+	vector<CacheManager::DownloadRequest> requests;
+	requests.push_back(request("/missing1.png"));
+	requests.push_back(request("/missing2.png"));
+
+	CacheManager cache;
+	int index = 0;
+	EXPECT_TRUE(cache.downloadFirst(requests, &index).empty());
+	EXPECT_EQ(-1, index);
+}
+
+/**
+ * prefetch(): Download multiple files.
+ */
+TEST_F(CacheManagerTest, prefetchTest)
+{
+	m_server.setResponse("/a.png", HttpStubServer::Response(200, "A"));
+	m_server.setResponse("/b.png", HttpStubServer::Response(200, "B"));
+	m_server.setResponse("/c.png", HttpStubServer::Response(200, "C"));
+
+	vector<CacheManager::DownloadRequest> requests;
+	requests.push_back(request("/a.png"));
+	requests.push_back(request("/missing.png"));
+	requests.push_back(request("/b.png"));
+	requests.push_back(request("/c.png"));
+
+	CacheManager cache;
+	cache.setMaxConcurrentDownloads(2);
+	EXPECT_EQ(3, cache.prefetch(requests));
+	EXPECT_EQ(4U, m_server.requestCount());
+
+	// Everything is cached now.
+	m_server.resetCounters();
+	EXPECT_EQ(3, cache.prefetch(requests));
+	EXPECT_EQ(0U, m_server.requestCount());
+}
+
+/**
+ * Revalidate a stale file using If-None-Match.
+ */
+TEST_F(CacheManagerTest, revalidateETagTest)
+{
+	ConditionalHandler h;
+	h.etag = "\"v1\"";
+	h.body = "version 1";
+	m_server.setHandler("/etag.png", ConditionalHandler::handle, &h);
+	const CacheManager::DownloadRequest req = request("/etag.png");
+
+	CacheManager cache;
+	const string filename = cache.download(req.url, req.cache_key);
+	ASSERT_FALSE(filename.empty());
+	CacheMetadata meta;
+	ASSERT_EQ(0, meta.load(filename));
+	EXPECT_EQ(h.etag, meta.etag);
+	EXPECT_EQ(0U, meta.failures);
+
+	// Fresh files aren't revalidated.
+	EXPECT_EQ(filename, cache.download(req.url, req.cache_key));
+	EXPECT_EQ(1U, m_server.requestCount());
+
+	// Stale files are revalidated, and a 304 keeps the cached file.
+	ageCacheEntry(filename, CacheManager::DEFAULT_REVALIDATE_INTERVAL + 60);
+	EXPECT_EQ(filename, cache.download(req.url, req.cache_key));
+	EXPECT_EQ(2U, m_server.requestCount());
+	EXPECT_EQ(1U, h.conditional);
+	EXPECT_EQ(9, FileSystem::filesize(filename));
+
+	// The revalidation interval was restarted.
+	EXPECT_EQ(filename, cache.download(req.url, req.cache_key));
+	EXPECT_EQ(2U, m_server.requestCount());
+}
+
+/**
+ * Revalidate a stale file using If-Modified-Since.
+ */
+TEST_F(CacheManagerTest, revalidateLastModifiedTest)
+{
+	ConditionalHandler h;
+	h.last_modified = "Wed, 15 Nov 1995 04:58:08 GMT";
+	h.body = "version 1";
+	m_server.setHandler("/lm.png", ConditionalHandler::handle, &h);
+	const CacheManager::DownloadRequest req = request("/lm.png");
+
+	CacheManager cache;
+	const string filename = cache.download(req.url, req.cache_key);
+	ASSERT_FALSE(filename.empty());
+	time_t mtime = 0;
+	ASSERT_EQ(0, FileSystem::get_mtime(filename, &mtime));
+	EXPECT_EQ(816411488, (long)mtime);
+
+	ageCacheEntry(filename, CacheManager::DEFAULT_REVALIDATE_INTERVAL + 60);
+	EXPECT_EQ(filename, cache.download(req.url, req.cache_key));
+	EXPECT_EQ(2U, m_server.requestCount());
+	EXPECT_EQ(1U, h.conditional);
+	EXPECT_EQ(9, FileSystem::filesize(filename));
+}
+
+/**
+ * Revalidate a stale file that was modified on the server.
+ */
+TEST_F(CacheManagerTest, revalidateModifiedTest)
+{
+	ConditionalHandler h;
+	h.etag = "\"v1\"";
+	h.body = "version 1";
+	m_server.setHandler("/mod.png", ConditionalHandler::handle, &h);
+	const CacheManager::DownloadRequest req = request("/mod.png");
+
+	CacheManager cache;
+	const string filename = cache.download(req.url, req.cache_key);
+	ASSERT_FALSE(filename.empty());
+
+	h.etag = "\"v2\"";
+	h.body = "version 2, longer";
+	ageCacheEntry(filename, CacheManager::DEFAULT_REVALIDATE_INTERVAL + 60);
+	EXPECT_EQ(filename, cache.download(req.url, req.cache_key));
+	EXPECT_EQ(17, FileSystem::filesize(filename));
+
+	CacheMetadata meta;
+	ASSERT_EQ(0, meta.load(filename));
+	EXPECT_EQ(h.etag, meta.etag);
+}
+
+/**
+ * If revalidation fails, the stale file is still used.
+ */
+TEST_F(CacheManagerTest, revalidateFailureTest)
+{
+	ConditionalHandler h;
+	h.etag = "\"v1\"";
+	h.body = "version 1";
+	m_server.setHandler("/fail.png", ConditionalHandler::handle, &h);
+	const CacheManager::DownloadRequest req = request("/fail.png");
+
+	CacheManager cache;
+	const string filename = cache.download(req.url, req.cache_key);
+	ASSERT_FALSE(filename.empty());
+
+	h.status = 500;
+	ageCacheEntry(filename, CacheManager::DEFAULT_REVALIDATE_INTERVAL + 60);
+	EXPECT_EQ(filename, cache.download(req.url, req.cache_key));
+	EXPECT_EQ(2U, m_server.requestCount());
+	EXPECT_EQ(9, FileSystem::filesize(filename));
+
+	CacheMetadata meta;
+	ASSERT_EQ(0, meta.load(filename));
+	EXPECT_EQ(0U, meta.failures);
+}
+
+/**
+ * Negative cache entries use exponential backoff.
+ */
+TEST_F(CacheManagerTest, negativeCacheBackoffTest)
+{
+	static const time_t TTL = 3600;
+	const CacheManager::DownloadRequest req = request("/missing.png");
+	const string filename = cacheFilename(req.cache_key);
+
+	CacheManager cache;
+	cache.setNegativeCacheTTL(TTL, TTL * 3);
+	EXPECT_TRUE(cache.download(req.url, req.cache_key).empty());
+	EXPECT_EQ(1U, m_server.requestCount());
+	CacheMetadata meta;
+	ASSERT_EQ(0, meta.load(filename));
+	EXPECT_EQ(1U, meta.failures);
+
+	// Within the TTL: no request.
+	EXPECT_TRUE(cache.download(req.url, req.cache_key).empty());
+	EXPECT_EQ(1U, m_server.requestCount());
+
+	// After the TTL: retry, and the failure count increases.
+	ageCacheEntry(filename, TTL + 60);
+	EXPECT_TRUE(cache.download(req.url, req.cache_key).empty());
+	EXPECT_EQ(2U, m_server.requestCount());
+	ASSERT_EQ(0, meta.load(filename));
+	EXPECT_EQ(2U, meta.failures);
+
+	// The TTL is now doubled.
+	ageCacheEntry(filename, TTL + 60);
+	EXPECT_TRUE(cache.download(req.url, req.cache_key).empty());
+	EXPECT_EQ(2U, m_server.requestCount());
+	ageCacheEntry(filename, TTL);
+	EXPECT_TRUE(cache.download(req.url, req.cache_key).empty());
+	EXPECT_EQ(3U, m_server.requestCount());
+
+	// The TTL is capped at the maximum.
+	ASSERT_EQ(0, meta.load(filename));
+	EXPECT_EQ(3U, meta.failures);
+	ageCacheEntry(filename, TTL * 3 + 60);
+	m_server.setResponse("/missing.png", HttpStubServer::Response(200, "found"));
+	EXPECT_FALSE(cache.download(req.url, req.cache_key).empty());
+	EXPECT_EQ(4U, m_server.requestCount());
+
+	// Successful download clears the negative cache entry.
+	ASSERT_EQ(0, meta.load(filename));
+	EXPECT_EQ(0U, meta.failures);
+}
+
+/**
+ * Zero-byte files from older versions are converted
+ * to negative cache entries.
+ */
+TEST_F(CacheManagerTest, legacyNegativeCacheTest)
+{
+	const CacheManager::DownloadRequest req = request("/legacy.png");
+	const string filename = cacheFilename(req.cache_key);
+	ASSERT_EQ(0, FileSystem::rmkdir(filename));
+	int fd = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	ASSERT_GE(fd, 0);
+	close(fd);
+
+	// The index is rebuilt when upgrading from an older version.
+	CacheIndex *const idx = CacheManager::index();
+	ASSERT_TRUE(idx != nullptr);
+	ASSERT_EQ(0, idx->rebuild());
+
+	CacheManager cache;
+	EXPECT_TRUE(cache.download(req.url, req.cache_key).empty());
+	EXPECT_EQ(0U, m_server.requestCount());
+	EXPECT_NE(0, FileSystem::access(filename, R_OK));
+
+	CacheMetadata meta;
+	ASSERT_EQ(0, meta.load(filename));
+	EXPECT_EQ(1U, meta.failures);
+}
+
+/**
+ * Downloads are streamed to a temporary file,
+ * which is renamed into place when complete.
+ */
+TEST_F(CacheManagerTest, streamedDownloadTest)
+{
+	string body(300*1024, '\0');
+	for (size_t i = 0; i < body.size(); i++) {
+		body[i] = static_cast<char>(i * 13);
+	}
+	HttpStubServer::Response resp(200, body);
+	resp.headers.push_back(std::make_pair(string("Last-Modified"), string("Wed, 21 Oct 2015 07:28:00 GMT")));
+	m_server.setResponse("/streamed.png", resp);
+	const CacheManager::DownloadRequest req = request("/streamed.png");
+	const CacheManager::DownloadRequest neg = request("/streamed-missing.png");
+
+	CacheManager cache;
+	const string filename = cache.download(req.url, req.cache_key);
+	ASSERT_FALSE(filename.empty());
+	EXPECT_TRUE(cache.download(neg.url, neg.cache_key).empty());
+
+	// Verify the file contents and mtime.
+	FILE *f = fopen(filename.c_str(), "rb");
+	ASSERT_TRUE(f != nullptr);
+	string data(body.size() + 1, '\0');
+	data.resize(fread(&data[0], 1, data.size(), f));
+	fclose(f);
+	EXPECT_TRUE(data == body);
+	time_t mtime = -1;
+	ASSERT_EQ(0, FileSystem::get_mtime(filename, &mtime));
+	EXPECT_EQ((time_t)1445412480, mtime);
+
+	// No temporary files should be left over.
+	EXPECT_EQ(0U, countTempFiles(cacheFilename("test")));
+}
+
+/**
+ * Scaled images are stored and invalidated
+ * when the original image changes.
+ */
+TEST_F(CacheManagerTest, scaledImageTest)
+{
+	const CacheManager::DownloadRequest req = request("/scaled.png");
+	m_server.setResponse("/scaled.png", HttpStubServer::Response(200, "original"));
+
+	CacheManager cache;
+	const string filename = cache.download(req.url, req.cache_key);
+	ASSERT_FALSE(filename.empty());
+	EXPECT_TRUE(CacheManager::loadScaledImage(filename, 64) == nullptr);
+
+	// 4x4 image with a transparent pixel. The transparent pixel's
+	// color must not affect the averaged color.
+	rp_image src(4, 4, rp_image::FORMAT_ARGB32);
+	ASSERT_TRUE(src.isValid());
+	for (int y = 0; y < 4; y++) {
+		uint32_t *const line = static_cast<uint32_t*>(src.scanLine(y));
+		for (int x = 0; x < 4; x++) {
+			line[x] = (x < 2 ? 0xFF204060 : 0xFF406080);
+		}
+	}
+	static_cast<uint32_t*>(src.scanLine(3))[3] = 0x00FFFFFF;
+	const rp_image::sBIT_t sBIT = {8, 8, 8, 0, 8};
+	src.set_sBIT(&sBIT);
+
+	unique_ptr<rp_image> scaled(src.downscaled(2, 2));
+	ASSERT_TRUE(scaled != nullptr);
+	ASSERT_EQ(2, scaled->width());
+	ASSERT_EQ(2, scaled->height());
+	const uint32_t expected[2][2] = {
+		{0xFF204060, 0xFF406080},
+		{0xFF204060, 0xBF406080},
+	};
+	for (int y = 0; y < 2; y++) {
+		const uint32_t *const line = static_cast<const uint32_t*>(scaled->scanLine(y));
+		EXPECT_EQ(expected[y][0], line[0]);
+		EXPECT_EQ(expected[y][1], line[1]);
+	}
+
+	// Store the scaled image and load it again.
+	ASSERT_EQ(0, CacheManager::storeScaledImage(filename, 64, scaled.get()));
+	unique_ptr<rp_image> loaded(CacheManager::loadScaledImage(filename, 64));
+	ASSERT_TRUE(loaded != nullptr);
+	ASSERT_EQ(rp_image::FORMAT_ARGB32, loaded->format());
+	ASSERT_EQ(2, loaded->width());
+	ASSERT_EQ(2, loaded->height());
+	for (int y = 0; y < 2; y++) {
+		EXPECT_EQ(0, memcmp(scaled->scanLine(y), loaded->scanLine(y), 2 * 4));
+	}
+	rp_image::sBIT_t loaded_sBIT;
+	ASSERT_EQ(0, loaded->get_sBIT(&loaded_sBIT));
+	EXPECT_EQ(0, memcmp(&sBIT, &loaded_sBIT, sizeof(sBIT)));
+
+	// The scaled image is written to a temporary file and renamed
+	// into place, so replacing it creates a new file instead of
+	// overwriting the one that's in use.
+	const string dir = filename.substr(0, filename.rfind('/'));
+	const string scaled_filename = filename + ".64.rpimg";
+	struct stat sb_old, sb_new;
+	ASSERT_EQ(0, stat(scaled_filename.c_str(), &sb_old));
+	int fd = open(scaled_filename.c_str(), O_RDONLY);
+	ASSERT_GE(fd, 0);
+	ASSERT_EQ(0, CacheManager::storeScaledImage(filename, 64, scaled.get()));
+	ASSERT_EQ(0, stat(scaled_filename.c_str(), &sb_new));
+	EXPECT_NE(sb_old.st_ino, sb_new.st_ino);
+	close(fd);
+	EXPECT_EQ(0U, countTempFiles(dir));
+
+	// Other sizes are stored separately.
+	EXPECT_TRUE(CacheManager::loadScaledImage(filename, 128) == nullptr);
+
+	// If the original image changes, the scaled image is ignored.
+	ageCacheEntry(filename, CacheManager::DEFAULT_REVALIDATE_INTERVAL + 60);
+	m_server.setResponse("/scaled.png", HttpStubServer::Response(200, "new original"));
+	EXPECT_EQ(filename, cache.download(req.url, req.cache_key));
+	EXPECT_TRUE(CacheManager::loadScaledImage(filename, 64) == nullptr);
+}
+
+/**
+ * Cached files are found using the index.
+ */
+TEST_F(CacheManagerTest, indexLookupTest)
+{
+	const CacheManager::DownloadRequest req = request("/indexed.png");
+	const string filename = cacheFilename(req.cache_key);
+	m_server.setResponse("/indexed.png", HttpStubServer::Response(200, "indexed"));
+
+	CacheManager cache;
+	EXPECT_TRUE(cache.findInCache(req.cache_key).empty());
+	EXPECT_EQ(filename, cache.download(req.url, req.cache_key));
+	EXPECT_EQ(1U, m_server.requestCount());
+
+	CacheIndex *const idx = CacheManager::index();
+	ASSERT_TRUE(idx != nullptr);
+	CacheIndex::Entry entry;
+	ASSERT_EQ(1, idx->lookup(filename, &entry, false));
+	EXPECT_EQ(7U, entry.size);
+	EXPECT_EQ(0U, entry.failures);
+	EXPECT_EQ(m_server.url(""), entry.origin);
+
+	EXPECT_EQ(filename, cache.findInCache(req.cache_key));
+	EXPECT_EQ(filename, cache.download(req.url, req.cache_key));
+	EXPECT_EQ(1U, m_server.requestCount());
+}
+
+/**
+ * The least-recently used files are evicted
+ * when the cache grows larger than the maximum size.
+ */
+TEST_F(CacheManagerTest, cacheMaxSizeTest)
+{
+	CacheIndex *const idx = CacheManager::index();
+	ASSERT_TRUE(idx != nullptr);
+
+	// Clear out files from other tests.
+	ASSERT_GE(idx->evict(0), 0);
+	ASSERT_EQ(0U, idx->totalSize());
+
+	const string body(1000, 'x');
+	CacheManager cache;
+	cache.setCacheMaxSize(4000);
+
+	static const char *const paths[] = {"/lru0.png", "/lru1.png", "/lru2.png", "/lru3.png"};
+	vector<string> filenames;
+	for (size_t i = 0; i < ARRAY_SIZE(paths); i++) {
+		m_server.setResponse(paths[i], HttpStubServer::Response(200, body));
+		const CacheManager::DownloadRequest req = request(paths[i]);
+		filenames.push_back(cache.download(req.url, req.cache_key));
+		ASSERT_FALSE(filenames.back().empty());
+
+		// Make sure the access times are distinct.
+		if (i < 3) {
+			sleep(1);
+		}
+	}
+	EXPECT_EQ(4000U, idx->totalSize());
+
+	// Access the first file so the second file is the LRU.
+	CacheIndex::Entry entry;
+	EXPECT_EQ(1, idx->lookup(filenames[0], &entry, true));
+
+	// The next download exceeds the limit.
+	m_server.setResponse("/lru4.png", HttpStubServer::Response(200, body));
+	const CacheManager::DownloadRequest req = request("/lru4.png");
+	EXPECT_FALSE(cache.download(req.url, req.cache_key).empty());
+
+	// Evicted down to 7/8 of the limit: two files are removed.
+	EXPECT_EQ(3000U, idx->totalSize());
+	EXPECT_EQ(0, FileSystem::access(filenames[0], R_OK));
+	EXPECT_NE(0, FileSystem::access(filenames[1], R_OK));
+	EXPECT_NE(0, FileSystem::access(filenames[2], R_OK));
+	EXPECT_EQ(0, FileSystem::access(filenames[3], R_OK));
+	EXPECT_EQ(0, idx->lookup(filenames[1], nullptr, false));
+	CacheMetadata meta;
+	EXPECT_NE(0, meta.load(filenames[1]));
+}
+
+/**
+ * Evicting an original image also evicts its scaled images.
+ */
+TEST_F(CacheManagerTest, evictScaledImageTest)
+{
+	CacheIndex *const idx = CacheManager::index();
+	ASSERT_TRUE(idx != nullptr);
+
+	// Clear out files from other tests.
+	ASSERT_GE(idx->evict(0), 0);
+	ASSERT_EQ(0U, idx->totalSize());
+
+	CacheManager cache;
+	m_server.setResponse("/evict_orig.png", HttpStubServer::Response(200, "original"));
+	const CacheManager::DownloadRequest req_orig = request("/evict_orig.png");
+	const string filename = cache.download(req_orig.url, req_orig.cache_key);
+	ASSERT_FALSE(filename.empty());
+
+	// Make sure the original image is the LRU.
+	sleep(1);
+	rp_image img(2, 2, rp_image::FORMAT_ARGB32);
+	ASSERT_TRUE(img.isValid());
+	ASSERT_EQ(0, CacheManager::storeScaledImage(filename, 64, &img));
+	const string scaled_filename = filename + ".64" + CacheManager::SCALED_IMAGE_SUFFIX;
+	ASSERT_EQ(1, idx->lookup(scaled_filename, nullptr, false));
+
+	m_server.setResponse("/evict_other.png", HttpStubServer::Response(200, "other"));
+	const CacheManager::DownloadRequest req_other = request("/evict_other.png");
+	const string other_filename = cache.download(req_other.url, req_other.cache_key);
+	ASSERT_FALSE(other_filename.empty());
+
+	// Only the original image needs to be evicted to get under
+	// the limit, but its scaled image is evicted, too.
+	ASSERT_GT(idx->evict(idx->totalSize() - 1), 0);
+	EXPECT_NE(0, FileSystem::access(filename, R_OK));
+	EXPECT_NE(0, FileSystem::access(scaled_filename, R_OK));
+	EXPECT_EQ(0, idx->lookup(scaled_filename, nullptr, false));
+	EXPECT_EQ(0, FileSystem::access(other_filename, R_OK));
+	EXPECT_EQ(5U, idx->totalSize());
+}
+
+/**
+ * The index is rebuilt from the cache directory.
+ */
+TEST_F(CacheManagerTest, indexRebuildTest)
+{
+	const CacheManager::DownloadRequest req = request("/rebuild.png");
+	const string filename = cacheFilename(req.cache_key);
+	m_server.setResponse("/rebuild.png", HttpStubServer::Response(200, "rebuild"));
+	const CacheManager::DownloadRequest neg = request("/rebuild-missing.png");
+	const string neg_filename = cacheFilename(neg.cache_key);
+
+	CacheManager cache;
+	EXPECT_FALSE(cache.download(req.url, req.cache_key).empty());
+	EXPECT_TRUE(cache.download(neg.url, neg.cache_key).empty());
+
+	CacheIndex *const idx = CacheManager::index();
+	ASSERT_TRUE(idx != nullptr);
+	CacheIndex::Stats before;
+	ASSERT_EQ(0, idx->stats(&before));
+
+	// Delete the index file. It should be recreated
+	// by scanning the cache directory.
+	const string index_filename = idx->cacheDir() + '/' + CacheIndex::INDEX_FILENAME;
+	ASSERT_EQ(0, unlink(index_filename.c_str()));
+
+	CacheIndex::Stats after;
+	ASSERT_EQ(0, idx->stats(&after));
+	EXPECT_EQ(0, FileSystem::access(index_filename, R_OK));
+	EXPECT_EQ(before.count, after.count);
+	EXPECT_EQ(before.negative, after.negative);
+	EXPECT_EQ(before.total_size, after.total_size);
+
+	CacheIndex::Entry entry;
+	ASSERT_EQ(1, idx->lookup(filename, &entry, false));
+	EXPECT_EQ(7U, entry.size);
+	EXPECT_EQ(0U, entry.failures);
+	ASSERT_EQ(1, idx->lookup(neg_filename, &entry, false));
+	EXPECT_EQ(0U, entry.size);
+	EXPECT_EQ(1U, entry.failures);
+
+	// Cached files are still found without a new download.
+	EXPECT_FALSE(cache.download(req.url, req.cache_key).empty());
+	EXPECT_TRUE(cache.download(neg.url, neg.cache_key).empty());
+	EXPECT_EQ(2U, m_server.requestCount());
+}
+
+/**
+ * The index is only a hint. Files deleted or added
+ * without updating the index are handled correctly.
+ */
+TEST_F(CacheManagerTest, indexStaleTest)
+{
+	const CacheManager::DownloadRequest req = request("/stale-deleted.png");
+	const string filename = cacheFilename(req.cache_key);
+	m_server.setResponse("/stale-deleted.png", HttpStubServer::Response(200, "deleted"));
+
+	CacheManager cache;
+	EXPECT_EQ(filename, cache.download(req.url, req.cache_key));
+	EXPECT_EQ(1U, m_server.requestCount());
+
+	// Delete the file without updating the index.
+	// It should be downloaded again.
+	ASSERT_EQ(0, unlink(filename.c_str()));
+	EXPECT_TRUE(cache.findInCache(req.cache_key).empty());
+	EXPECT_EQ(filename, cache.download(req.url, req.cache_key));
+	EXPECT_EQ(2U, m_server.requestCount());
+
+	CacheIndex *const idx = CacheManager::index();
+	ASSERT_TRUE(idx != nullptr);
+	ASSERT_EQ(1, idx->lookup(filename, nullptr, false));
+	ASSERT_EQ(0, unlink(filename.c_str()));
+	EXPECT_TRUE(cache.findInCache(req.cache_key).empty());
+	EXPECT_EQ(0, idx->lookup(filename, nullptr, false));
+
+	// Add a file without updating the index.
+	// It should be found without a download.
+	const CacheManager::DownloadRequest added = request("/stale-added.png");
+	const string added_filename = cacheFilename(added.cache_key);
+	FILE *const f = fopen(added_filename.c_str(), "wb");
+	ASSERT_TRUE(f != nullptr);
+	fputs("added", f);
+	fclose(f);
+	EXPECT_EQ(0, idx->lookup(added_filename, nullptr, false));
+
+	EXPECT_EQ(added_filename, cache.findInCache(added.cache_key));
+	EXPECT_EQ(added_filename, cache.download(added.url, added.cache_key));
+	EXPECT_EQ(2U, m_server.requestCount());
+
+	// The file is now in the index.
+	CacheIndex::Entry entry;
+	ASSERT_EQ(1, idx->lookup(added_filename, &entry, false));
+	EXPECT_EQ(5U, entry.size);
+}
+
+} }
+
+/**
+ * Test suite main function.
+ */
+extern "C" int gtest_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibCacheMgr test suite: CacheManager tests.\n\n");
+	fflush(nullptr);
+
+	// coverity[fun_call_w_exception]: uncaught exceptions cause nonzero exit anyway, so don't warn.
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
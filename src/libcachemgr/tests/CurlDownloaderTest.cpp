@@ -0,0 +1,296 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libcachemgr/tests)                *
+ * CurlDownloaderTest.cpp: CurlDownloader tests.                           *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// Cache Manager
+#include "../CurlDownloader.hpp"
+#include "HttpStubServer.hpp"
+
+// cURL
+#include <curl/curl.h>
+
+// C includes.
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstring>
+
+// C++ includes.
+#include <memory>
+#include <string>
+using std::string;
+using std::unique_ptr;
+
+namespace LibCacheMgr { namespace Tests {
+
+class CurlDownloaderTest : public ::testing::Test
+{
+	protected:
+		CurlDownloaderTest() { }
+
+		static void SetUpTestCase(void)
+		{
+			// Don't send requests for the local server to a proxy.
+			setenv("no_proxy", "127.0.0.1", 1);
+		}
+
+		void SetUp(void) final
+		{
+			ASSERT_EQ(0, m_server.start());
+			m_server.setResponse("/test.png", HttpStubServer::Response(200, "PNG data"));
+		}
+
+		void TearDown(void) final
+		{
+			m_server.stop();
+		}
+
+	public:
+		// Number of iterations for benchmarks.
+		static const unsigned int BENCHMARK_ITERATIONS = 50;
+
+		// Simulated connection latency for benchmarks, in milliseconds.
+		static const unsigned int BENCHMARK_CONNECT_DELAY = 10;
+
+		HttpStubServer m_server;
+};
+
+/**
+ * Download a file.
+ */
+TEST_F(CurlDownloaderTest, downloadTest)
+{
+	CurlDownloader dl(m_server.url("/test.png"));
+	ASSERT_EQ(0, dl.download());
+	ASSERT_EQ(8U, dl.dataSize());
+	EXPECT_EQ(0, memcmp("PNG data", dl.data(), 8));
+}
+
+/**
+ * Download a file that doesn't exist.
+ */
+TEST_F(CurlDownloaderTest, notFoundTest)
+{
+	CurlDownloader dl(m_server.url("/missing.png"));
+	EXPECT_NE(0, dl.download());
+	EXPECT_EQ(0U, dl.dataSize());
+}
+
+/**
+ * Multiple downloads using the same CurlDownloader
+ * should use a single connection.
+ */
+TEST_F(CurlDownloaderTest, connectionReuseTest)
+{
+	CurlDownloader dl;
+	for (int i = 0; i < 5; i++) {
+		dl.setUrl(m_server.url(i & 1 ? "/missing.png" : "/test.png"));
+		dl.download();
+	}
+	EXPECT_EQ(5U, m_server.requestCount());
+	EXPECT_EQ(1U, m_server.connectionCount());
+}
+
+/**
+ * Downloads using separate CurlDownloader objects
+ * on the same thread should reuse the connection.
+ */
+TEST_F(CurlDownloaderTest, threadConnectionTest)
+{
+	for (int i = 0; i < 5; i++) {
+		unique_ptr<CurlDownloader> dl(new CurlDownloader(m_server.url("/test.png")));
+		ASSERT_EQ(0, dl->download());
+	}
+	EXPECT_EQ(5U, m_server.requestCount());
+	EXPECT_EQ(1U, m_server.connectionCount());
+}
+
+/**
+ * CurlDownloader thread parameters.
+ */
+struct DownloadThreadParam {
+	string url;
+	int ret;
+};
+
+/**
+ * Download a file on another thread.
+ * @param param DownloadThreadParam.
+ * @return nullptr
+ */
+static void *downloadThread(void *param)
+{
+	DownloadThreadParam *const dtp = static_cast<DownloadThreadParam*>(param);
+	CurlDownloader dl(dtp->url);
+	dtp->ret = dl.download();
+	return nullptr;
+}
+
+/**
+ * Connections are not shared between threads.
+ */
+TEST_F(CurlDownloaderTest, threadsDontShareConnectionsTest)
+{
+	{
+		CurlDownloader dl(m_server.url("/test.png"));
+		ASSERT_EQ(0, dl.download());
+	}
+
+	DownloadThreadParam dtp;
+	dtp.url = m_server.url("/test.png");
+	dtp.ret = -1;
+	pthread_t thread;
+	ASSERT_EQ(0, pthread_create(&thread, nullptr, downloadThread, &dtp));
+	pthread_join(thread, nullptr);
+	EXPECT_EQ(0, dtp.ret);
+
+	EXPECT_EQ(2U, m_server.requestCount());
+	EXPECT_EQ(2U, m_server.connectionCount());
+}
+
+/**
+ * Read a file into a string.
+ * @param filename Filename.
+ * @return File contents.
+ */
+static string readFile(const char *filename)
+{
+	string data;
+	FILE *f = fopen(filename, "rb");
+	if (!f)
+		return data;
+	char buf[4096];
+	size_t size;
+	while ((size = fread(buf, 1, sizeof(buf), f)) > 0) {
+		data.append(buf, size);
+	}
+	fclose(f);
+	return data;
+}
+
+/**
+ * Stream a file to an output file.
+ * The file is larger than the write buffer.
+ */
+TEST_F(CurlDownloaderTest, outputFileTest)
+{
+	string body(300*1024, '\0');
+	for (size_t i = 0; i < body.size(); i++) {
+		body[i] = static_cast<char>(i * 7);
+	}
+	m_server.setResponse("/large.png", HttpStubServer::Response(200, body));
+
+	char tmpl[] = "/tmp/rp-CurlDownloaderTest.XXXXXX";
+	const int fd = mkstemp(tmpl);
+	ASSERT_GE(fd, 0);
+	close(fd);
+
+	CurlDownloader dl(m_server.url("/large.png"));
+	dl.setOutputFile(tmpl);
+	EXPECT_EQ(0, dl.download());
+	EXPECT_TRUE(dl.isStreamed());
+	EXPECT_EQ(body.size(), dl.dataSize());
+	EXPECT_TRUE(dl.data() == nullptr);
+	EXPECT_TRUE(readFile(tmpl) == body);
+
+	// Downloading to memory again.
+	dl.setOutputFile(string());
+	dl.setUrl(m_server.url("/test.png"));
+	EXPECT_EQ(0, dl.download());
+	EXPECT_FALSE(dl.isStreamed());
+	ASSERT_EQ(8U, dl.dataSize());
+	EXPECT_EQ(0, memcmp("PNG data", dl.data(), 8));
+
+	unlink(tmpl);
+}
+
+/**
+ * The maximum size also applies when streaming to an output file.
+ */
+TEST_F(CurlDownloaderTest, outputFileMaxSizeTest)
+{
+	m_server.setResponse("/large.png", HttpStubServer::Response(200, string(200*1024, 'x')));
+
+	char tmpl[] = "/tmp/rp-CurlDownloaderTest.XXXXXX";
+	const int fd = mkstemp(tmpl);
+	ASSERT_GE(fd, 0);
+	close(fd);
+
+	CurlDownloader dl(m_server.url("/large.png"));
+	dl.setOutputFile(tmpl);
+	dl.setMaxSize(100*1024);
+	EXPECT_NE(0, dl.download());
+	EXPECT_FALSE(dl.isStreamed());
+	EXPECT_EQ(0U, dl.dataSize());
+
+	unlink(tmpl);
+}
+
+/**
+ * Benchmark downloads with connection reuse.
+ * Each new connection has a simulated delay.
+ */
+TEST_F(CurlDownloaderTest, keepAlive_benchmark)
+{
+	m_server.setConnectDelay(BENCHMARK_CONNECT_DELAY);
+	for (unsigned int i = BENCHMARK_ITERATIONS; i > 0; i--) {
+		CurlDownloader dl(m_server.url("/test.png"));
+		ASSERT_EQ(0, dl.download());
+	}
+	printf("%u downloads, %u connections\n",
+		m_server.requestCount(), m_server.connectionCount());
+}
+
+/**
+ * Benchmark downloads without connection reuse.
+ * Each new connection has a simulated delay.
+ */
+TEST_F(CurlDownloaderTest, noKeepAlive_benchmark)
+{
+	m_server.setConnectDelay(BENCHMARK_CONNECT_DELAY);
+	m_server.setKeepAlive(false);
+	for (unsigned int i = BENCHMARK_ITERATIONS; i > 0; i--) {
+		CurlDownloader dl(m_server.url("/test.png"));
+		ASSERT_EQ(0, dl.download());
+	}
+	printf("%u downloads, %u connections\n",
+		m_server.requestCount(), m_server.connectionCount());
+}
+
+} }
+
+/**
+ * Test suite main function.
+ */
+extern "C" int gtest_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibCacheMgr test suite: CurlDownloader tests.\n\n");
+	fflush(nullptr);
+
+	// coverity[fun_call_w_exception]: uncaught exceptions cause nonzero exit anyway, so don't warn.
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
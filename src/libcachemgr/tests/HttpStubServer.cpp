@@ -0,0 +1,439 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libcachemgr/tests)                *
+ * HttpStubServer.cpp: Minimal local HTTP server for downloader tests.     *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "HttpStubServer.hpp"
+using LibRpBase::Mutex;
+using LibRpBase::MutexLocker;
+
+// C includes.
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// C includes. (C++ namespace)
+#include "librpbase/ctypex.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+// C++ includes.
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+using std::map;
+using std::string;
+using std::vector;
+
+namespace LibCacheMgr { namespace Tests {
+
+HttpStubServer::HttpStubServer()
+	: m_listen_fd(-1)
+	, m_port(0)
+	, m_running(false)
+	, m_keepAlive(true)
+	, m_connectDelay(0)
+	, m_connections(0)
+	, m_requests(0)
+{ }
+
+HttpStubServer::~HttpStubServer()
+{
+	stop();
+}
+
+/**
+ * Start the server.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int HttpStubServer::start(void)
+{
+	if (m_running) {
+		return 0;
+	}
+
+	m_listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+	if (m_listen_fd < 0) {
+		return -errno;
+	}
+
+	int one = 1;
+	setsockopt(m_listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+	// Bind to an ephemeral port on the loopback interface.
+	struct sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	addr.sin_port = 0;
+	socklen_t addrlen = sizeof(addr);
+	if (bind(m_listen_fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) != 0 ||
+	    listen(m_listen_fd, 64) != 0 ||
+	    getsockname(m_listen_fd, reinterpret_cast<struct sockaddr*>(&addr), &addrlen) != 0)
+	{
+		int err = errno;
+		close(m_listen_fd);
+		m_listen_fd = -1;
+		return -err;
+	}
+	m_port = ntohs(addr.sin_port);
+
+	m_running = true;
+	int ret = pthread_create(&m_listen_thread, nullptr, listenThread, this);
+	if (ret != 0) {
+		m_running = false;
+		close(m_listen_fd);
+		m_listen_fd = -1;
+		m_port = 0;
+		return -ret;
+	}
+	return 0;
+}
+
+/**
+ * Stop the server.
+ * All connections will be closed.
+ */
+void HttpStubServer::stop(void)
+{
+	if (!m_running) {
+		return;
+	}
+
+	// Shut down the listening socket to wake up accept().
+	m_running = false;
+	shutdown(m_listen_fd, SHUT_RDWR);
+	pthread_join(m_listen_thread, nullptr);
+	close(m_listen_fd);
+	m_listen_fd = -1;
+	m_port = 0;
+
+	// Shut down the client sockets to wake up recv().
+	vector<pthread_t> threads;
+	{
+		MutexLocker locker(m_mutex);
+		for (auto iter = m_clientFds.cbegin(); iter != m_clientFds.cend(); ++iter) {
+			shutdown(*iter, SHUT_RDWR);
+		}
+		threads.swap(m_clientThreads);
+	}
+	for (auto iter = threads.cbegin(); iter != threads.cend(); ++iter) {
+		pthread_join(*iter, nullptr);
+	}
+}
+
+/**
+ * Get a URL for the specified path on this server.
+ * @param path Path, starting with '/'.
+ * @return URL.
+ */
+string HttpStubServer::url(const char *path) const
+{
+	char buf[32];
+	snprintf(buf, sizeof(buf), "http://127.0.0.1:%u", m_port);
+	return string(buf) + path;
+}
+
+/**
+ * Set the response for a path.
+ * Paths without a response will return 404.
+ * @param path Path, starting with '/'.
+ * @param response Response.
+ */
+void HttpStubServer::setResponse(const string &path, const Response &response)
+{
+	MutexLocker locker(m_mutex);
+	m_responses[path] = response;
+}
+
+/**
+ * Set a handler function for a path.
+ * This overrides setResponse() for the path.
+ * @param path Path, starting with '/'.
+ * @param handler Handler function.
+ * @param userdata User data.
+ */
+void HttpStubServer::setHandler(const string &path, handler_fn handler, void *userdata)
+{
+	MutexLocker locker(m_mutex);
+	Handler h = {handler, userdata};
+	m_handlers[path] = h;
+}
+
+/**
+ * Enable or disable keep-alive.
+ * If disabled, every connection is closed after one response.
+ * @param keepAlive True to enable keep-alive.
+ */
+void HttpStubServer::setKeepAlive(bool keepAlive)
+{
+	MutexLocker locker(m_mutex);
+	m_keepAlive = keepAlive;
+}
+
+/**
+ * Set a delay for new connections.
+ * This simulates the cost of TCP and TLS handshakes
+ * with a remote server.
+ * @param ms Delay, in milliseconds.
+ */
+void HttpStubServer::setConnectDelay(unsigned int ms)
+{
+	MutexLocker locker(m_mutex);
+	m_connectDelay = ms;
+}
+
+/**
+ * Get the number of connections accepted.
+ * @return Number of connections.
+ */
+unsigned int HttpStubServer::connectionCount(void)
+{
+	MutexLocker locker(m_mutex);
+	return m_connections;
+}
+
+/**
+ * Get the number of requests received.
+ * @return Number of requests.
+ */
+unsigned int HttpStubServer::requestCount(void)
+{
+	MutexLocker locker(m_mutex);
+	return m_requests;
+}
+
+/**
+ * Get the number of requests received for a path.
+ * @param path Path.
+ * @return Number of requests.
+ */
+unsigned int HttpStubServer::requestCount(const string &path)
+{
+	MutexLocker locker(m_mutex);
+	auto iter = m_pathRequests.find(path);
+	return (iter != m_pathRequests.end() ? iter->second : 0);
+}
+
+/**
+ * Reset the connection and request counters.
+ */
+void HttpStubServer::resetCounters(void)
+{
+	MutexLocker locker(m_mutex);
+	m_connections = 0;
+	m_requests = 0;
+	m_pathRequests.clear();
+}
+
+struct ClientThreadParam {
+	HttpStubServer *server;
+	int fd;
+};
+
+void *HttpStubServer::listenThread(void *param)
+{
+	HttpStubServer *const server = static_cast<HttpStubServer*>(param);
+	while (server->m_running) {
+		int fd = accept(server->m_listen_fd, nullptr, nullptr);
+		if (fd < 0) {
+			if (errno == EINTR)
+				continue;
+			// Socket was shut down.
+			break;
+		}
+
+		int one = 1;
+		setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+		MutexLocker locker(server->m_mutex);
+		server->m_connections++;
+		ClientThreadParam *const ctp = new ClientThreadParam;
+		ctp->server = server;
+		ctp->fd = fd;
+		pthread_t thread;
+		if (pthread_create(&thread, nullptr, clientThread, ctp) != 0) {
+			delete ctp;
+			close(fd);
+			continue;
+		}
+		server->m_clientThreads.push_back(thread);
+		server->m_clientFds.push_back(fd);
+	}
+	return nullptr;
+}
+
+void *HttpStubServer::clientThread(void *param)
+{
+	ClientThreadParam *const ctp = static_cast<ClientThreadParam*>(param);
+	HttpStubServer *const server = ctp->server;
+	const int fd = ctp->fd;
+	delete ctp;
+
+	server->handleClient(fd);
+
+	MutexLocker locker(server->m_mutex);
+	auto iter = std::find(server->m_clientFds.begin(), server->m_clientFds.end(), fd);
+	if (iter != server->m_clientFds.end()) {
+		server->m_clientFds.erase(iter);
+	}
+	close(fd);
+	return nullptr;
+}
+
+/**
+ * Handle a client connection.
+ * @param fd Client socket.
+ */
+void HttpStubServer::handleClient(int fd)
+{
+	unsigned int connectDelay;
+	{
+		MutexLocker locker(m_mutex);
+		connectDelay = m_connectDelay;
+	}
+	if (connectDelay > 0) {
+		usleep(connectDelay * 1000);
+	}
+
+	string buf;
+	char rdbuf[4096];
+	while (m_running) {
+		// Process any complete requests in the buffer.
+		size_t end = buf.find("\r\n\r\n");
+		if (end != string::npos) {
+			const string request = buf.substr(0, end);
+			buf.erase(0, end + 4);
+			if (!processRequest(fd, request))
+				break;
+			continue;
+		}
+
+		ssize_t sz = recv(fd, rdbuf, sizeof(rdbuf), 0);
+		if (sz <= 0) {
+			// Connection closed.
+			break;
+		}
+		buf.append(rdbuf, sz);
+	}
+}
+
+/**
+ * Process a single request.
+ * @param fd Client socket.
+ * @param request Request header block.
+ * @return True to keep the connection open; false to close it.
+ */
+bool HttpStubServer::processRequest(int fd, const string &request)
+{
+	// Parse the request line.
+	size_t eol = request.find("\r\n");
+	const string reqline = request.substr(0, eol);
+	const size_t sp1 = reqline.find(' ');
+	const size_t sp2 = (sp1 != string::npos ? reqline.find(' ', sp1+1) : string::npos);
+	if (sp2 == string::npos) {
+		return false;
+	}
+	const string method = reqline.substr(0, sp1);
+	const string path = reqline.substr(sp1+1, sp2-sp1-1);
+
+	// Parse the headers.
+	map<string, string> headers;
+	while (eol != string::npos) {
+		const size_t start = eol + 2;
+		eol = request.find("\r\n", start);
+		const string line = request.substr(start, (eol != string::npos ? eol - start : string::npos));
+		const size_t colon = line.find(':');
+		if (colon == string::npos)
+			continue;
+		string name = line.substr(0, colon);
+		std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+		size_t vpos = colon + 1;
+		while (vpos < line.size() && ISSPACE(line[vpos]))
+			vpos++;
+		headers[name] = line.substr(vpos);
+	}
+
+	// Get the response.
+	Response resp(404, string());
+	bool keepAlive;
+	{
+		MutexLocker locker(m_mutex);
+		m_requests++;
+		m_pathRequests[path]++;
+		keepAlive = m_keepAlive;
+
+		auto hiter = m_handlers.find(path);
+		if (hiter != m_handlers.end()) {
+			const Handler h = hiter->second;
+			m_mutex.unlock();
+			resp = h.fn(path, headers, h.userdata);
+			m_mutex.lock();
+		} else {
+			auto riter = m_responses.find(path);
+			if (riter != m_responses.end()) {
+				resp = riter->second;
+			}
+		}
+	}
+	auto citer = headers.find("connection");
+	if (citer != headers.end() && citer->second == "close") {
+		keepAlive = false;
+	}
+
+	if (resp.delay_ms > 0) {
+		usleep(resp.delay_ms * 1000);
+	}
+
+	// Build the response.
+	const bool has_body = (resp.status != 304 && resp.status != 204);
+	char line[128];
+	snprintf(line, sizeof(line), "HTTP/1.1 %d Stub\r\n", resp.status);
+	string out = line;
+	if (has_body) {
+		snprintf(line, sizeof(line), "Content-Length: %u\r\n", static_cast<unsigned int>(resp.body.size()));
+		out += line;
+	}
+	for (auto iter = resp.headers.cbegin(); iter != resp.headers.cend(); ++iter) {
+		out += iter->first;
+		out += ": ";
+		out += iter->second;
+		out += "\r\n";
+	}
+	out += (keepAlive ? "Connection: keep-alive\r\n" : "Connection: close\r\n");
+	out += "\r\n";
+	if (has_body && method != "HEAD") {
+		out += resp.body;
+	}
+
+	size_t pos = 0;
+	while (pos < out.size()) {
+		ssize_t sz = send(fd, out.data() + pos, out.size() - pos, MSG_NOSIGNAL);
+		if (sz <= 0)
+			return false;
+		pos += sz;
+	}
+	return keepAlive;
+}
+
+} }
@@ -0,0 +1,211 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libcachemgr/tests)                *
+ * HttpStubServer.hpp: Minimal local HTTP server for downloader tests.     *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __ROMPROPERTIES_LIBCACHEMGR_TESTS_HTTPSTUBSERVER_HPP__
+#define __ROMPROPERTIES_LIBCACHEMGR_TESTS_HTTPSTUBSERVER_HPP__
+
+// librpbase
+#include "librpbase/common.h"
+#include "librpbase/threads/Mutex.hpp"
+
+// C includes.
+#include <pthread.h>
+#include <stdint.h>
+
+// C++ includes.
+#include <map>
+#include <string>
+#include <vector>
+
+namespace LibCacheMgr { namespace Tests {
+
+/**
+ * Minimal HTTP/1.1 server listening on the loopback interface.
+ *
+ * This is used to test the downloaders without network access.
+ * Each connection is handled by a separate thread, and keep-alive
+ * is supported, so connection reuse can be measured by checking
+ * connectionCount().
+ *
+ * Only GET and HEAD requests are supported.
+ */
+class HttpStubServer
+{
+	public:
+		HttpStubServer();
+		~HttpStubServer();
+
+	private:
+		RP_DISABLE_COPY(HttpStubServer)
+
+	public:
+		struct Response {
+			int status;		// HTTP status code.
+			std::string body;	// Response body.
+			std::vector<std::pair<std::string, std::string> > headers;	// Extra headers.
+			unsigned int delay_ms;	// Delay before sending the response.
+
+			Response()
+				: status(200), delay_ms(0) { }
+			Response(int status, const std::string &body, unsigned int delay_ms = 0)
+				: status(status), body(body), delay_ms(delay_ms) { }
+		};
+
+		/**
+		 * Request handler function.
+		 * Called for every request to a path that has a handler.
+		 * @param path		[in] Request path.
+		 * @param headers	[in] Request headers. (names are lowercase)
+		 * @param userdata	[in] User data.
+		 * @return Response.
+		 */
+		typedef Response (*handler_fn)(const std::string &path,
+			const std::map<std::string, std::string> &headers, void *userdata);
+
+		/**
+		 * Start the server.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int start(void);
+
+		/**
+		 * Stop the server.
+		 * All connections will be closed.
+		 */
+		void stop(void);
+
+		/**
+		 * Get the server's port number.
+		 * @return Port number, or 0 if the server isn't running.
+		 */
+		uint16_t port(void) const { return m_port; }
+
+		/**
+		 * Get a URL for the specified path on this server.
+		 * @param path Path, starting with '/'.
+		 * @return URL.
+		 */
+		std::string url(const char *path) const;
+
+		/**
+		 * Set the response for a path.
+		 * Paths without a response will return 404.
+		 * @param path Path, starting with '/'.
+		 * @param response Response.
+		 */
+		void setResponse(const std::string &path, const Response &response);
+
+		/**
+		 * Set a handler function for a path.
+		 * This overrides setResponse() for the path.
+		 * @param path Path, starting with '/'.
+		 * @param handler Handler function.
+		 * @param userdata User data.
+		 */
+		void setHandler(const std::string &path, handler_fn handler, void *userdata);
+
+		/**
+		 * Enable or disable keep-alive.
+		 * If disabled, every connection is closed after one response.
+		 * @param keepAlive True to enable keep-alive.
+		 */
+		void setKeepAlive(bool keepAlive);
+
+		/**
+		 * Set a delay for new connections.
+		 * This simulates the cost of TCP and TLS handshakes
+		 * with a remote server.
+		 * @param ms Delay, in milliseconds.
+		 */
+		void setConnectDelay(unsigned int ms);
+
+		/**
+		 * Get the number of connections accepted.
+		 * @return Number of connections.
+		 */
+		unsigned int connectionCount(void);
+
+		/**
+		 * Get the number of requests received.
+		 * @return Number of requests.
+		 */
+		unsigned int requestCount(void);
+
+		/**
+		 * Get the number of requests received for a path.
+		 * @param path Path.
+		 * @return Number of requests.
+		 */
+		unsigned int requestCount(const std::string &path);
+
+		/**
+		 * Reset the connection and request counters.
+		 */
+		void resetCounters(void);
+
+	private:
+		static void *listenThread(void *param);
+		static void *clientThread(void *param);
+
+		/**
+		 * Handle a client connection.
+		 * @param fd Client socket.
+		 */
+		void handleClient(int fd);
+
+		/**
+		 * Process a single request.
+		 * @param fd Client socket.
+		 * @param request Request header block.
+		 * @return True to keep the connection open; false to close it.
+		 */
+		bool processRequest(int fd, const std::string &request);
+
+	private:
+		int m_listen_fd;
+		uint16_t m_port;
+		volatile bool m_running;
+
+		pthread_t m_listen_thread;
+
+		// Protects everything below.
+		LibRpBase::Mutex m_mutex;
+
+		struct Handler {
+			handler_fn fn;
+			void *userdata;
+		};
+		std::map<std::string, Response> m_responses;
+		std::map<std::string, Handler> m_handlers;
+		bool m_keepAlive;
+		unsigned int m_connectDelay;
+
+		unsigned int m_connections;
+		unsigned int m_requests;
+		std::map<std::string, unsigned int> m_pathRequests;
+
+		std::vector<pthread_t> m_clientThreads;
+		std::vector<int> m_clientFds;
+};
+
+} }
+
+#endif /* __ROMPROPERTIES_LIBCACHEMGR_TESTS_HTTPSTUBSERVER_HPP__ */
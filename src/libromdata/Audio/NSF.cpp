@@ -302,7 +302,7 @@ int NSF::loadFieldData(void)
 	} else {
 		bfval = 0;
 	}
-	vector<string> *const v_tv_system_bitfield_names = RomFields::strArrayToVector_i18n(
+	const vector<string> *const v_tv_system_bitfield_names = RomFields::strArrayToVector_i18n(
 		"NSF|TVSystem", tv_system_bitfield_names, ARRAY_SIZE(tv_system_bitfield_names));
 	d->fields->addField_bitfield(C_("NSF", "TV System"),
 		v_tv_system_bitfield_names, 0, bfval);
@@ -316,7 +316,7 @@ int NSF::loadFieldData(void)
 		NOP_C_("NSF|Expansion", "Namco N163"),
 		NOP_C_("NSF|Expansion", "Sunsoft 5B"),
 	};
-	vector<string> *const v_expansion_bitfield_names = RomFields::strArrayToVector_i18n(
+	const vector<string> *const v_expansion_bitfield_names = RomFields::strArrayToVector_i18n(
 		"NSF|Expansion", expansion_bitfield_names, ARRAY_SIZE(expansion_bitfield_names));
 	d->fields->addField_bitfield(C_("NSF", "Expansion"),
 		v_expansion_bitfield_names, 3, nsfHeader->expansion_audio);
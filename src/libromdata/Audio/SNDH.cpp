@@ -961,23 +961,26 @@ int SNDH::loadFieldData(void)
 			// No durations. Don't bother showing the list.
 			delete vv_subtune_list;
 		} else {
-			static const char *subtune_list_hdr[3] = {
+			// NOTE: Header vectors are shared, so each
+			// column combination has its own array.
+			static const char *const subtune_list_hdr_SN[] = {
 				NOP_C_("SNDH|SubtuneList", "#"),
-				nullptr, nullptr
+				NOP_C_("SNDH|SubtuneList", "Name"),
+				NOP_C_("SNDH|SubtuneList", "Duration"),
 			};
-			if (has_SN && has_TIME) {
-				subtune_list_hdr[1] = NOP_C_("SNDH|SubtuneList", "Name");
-				subtune_list_hdr[2] = NOP_C_("SNDH|SubtuneList", "Duration");
-			} else if (has_SN) {
-				subtune_list_hdr[1] = NOP_C_("SNDH|SubtuneList", "Name");
-			} else if (has_TIME) {
-				subtune_list_hdr[1] = NOP_C_("SNDH|SubtuneList", "Duration");
-			} else {
+			static const char *const subtune_list_hdr_TIME[] = {
+				NOP_C_("SNDH|SubtuneList", "#"),
+				NOP_C_("SNDH|SubtuneList", "Duration"),
+			};
+			const char *const *subtune_list_hdr = subtune_list_hdr_SN;
+			if (!has_SN && has_TIME) {
+				subtune_list_hdr = subtune_list_hdr_TIME;
+			} else if (!has_SN && !has_TIME) {
 				assert(!"Invalid combination of has_SN and has_TIME.");
 				col_count = 1;
 			}
 
-			vector<string> *const v_subtune_list_hdr = RomFields::strArrayToVector_i18n(
+			const vector<string> *const v_subtune_list_hdr = RomFields::strArrayToVector_i18n(
 				"SNDH|SubtuneList", subtune_list_hdr, col_count);
 
 			RomFields::AFLD_PARAMS params;
@@ -533,6 +533,9 @@ const rp_image *DreamcastSavePrivate::loadIcon(void)
 	}
 	iconAnimData->seq_count = iconAnimData->count;
 
+	// Remove duplicate frames.
+	iconAnimData->dedupFrames();
+
 	// Return the first frame.
 	return iconAnimData->frames[0];
 }
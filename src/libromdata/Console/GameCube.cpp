@@ -293,6 +293,10 @@ int GameCubePrivate::loadWiiPartitionTables(void)
 	} else if ((discType & DISC_SYSTEM_MASK) != DISC_SYSTEM_WII) {
 		// Unsupported disc type.
 		return -EIO;
+	} else if (metaDataOnly) {
+		// Wii metadata is read from the disc header, so the
+		// partition tables and tickets are never needed.
+		return -ENOTSUP;
 	}
 
 	// Clear the existing partition table vector.
@@ -1504,10 +1508,12 @@ int GameCube::loadFieldData(void)
 					be32_to_cpu(tmdHeader->title_id.lo)));
 
 			// Access rights.
-			vector<string> *const v_access_rights_hdr = new vector<string>();
-			v_access_rights_hdr->reserve(2);
-			v_access_rights_hdr->push_back("AHBPROT");
-			v_access_rights_hdr->push_back(C_("GameCube", "DVD Video"));
+			static const char *const access_rights_names[] = {
+				"AHBPROT",
+				NOP_C_("GameCube", "DVD Video"),
+			};
+			const vector<string> *const v_access_rights_hdr = RomFields::strArrayToVector_i18n(
+				"GameCube", access_rights_names, ARRAY_SIZE(access_rights_names));
 			d->fields->addField_bitfield(C_("GameCube", "Access Rights"),
 				v_access_rights_hdr, 0, be32_to_cpu(tmdHeader->access_rights));
 		}
@@ -1783,7 +1789,7 @@ int GameCube::loadFieldData(void)
 			// tr: Total size of the partition.
 			NOP_C_("GameCube|Partition", "Total Size"),
 		};
-		vector<string> *const v_partitions_names = RomFields::strArrayToVector_i18n(
+		const vector<string> *const v_partitions_names = RomFields::strArrayToVector_i18n(
 			"GameCube|Partition", partitions_names, ARRAY_SIZE(partitions_names));
 
 		RomFields::AFLD_PARAMS params;
@@ -1834,6 +1840,9 @@ int GameCube::loadMetaData(void)
 
 		case GameCubePrivate::DISC_SYSTEM_GCN: {
 			if (!d->opening_bnr.gcn.data) {
+				// NOTE: opening.bnr is loaded in metadata-only mode, too.
+				// The title, publisher, and description are only
+				// available there.
 				d->gcn_loadOpeningBnr();
 				if (!d->opening_bnr.gcn.data) {
 					// Still unable to load the metadata.
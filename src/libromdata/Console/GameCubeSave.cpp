@@ -466,6 +466,11 @@ const rp_image *GameCubeSavePrivate::loadIcon(void)
 	}
 	iconAnimData->seq_count = idx;
 
+	// Remove duplicate frames, then store the
+	// RGB5A3 frames as CI8 if possible.
+	iconAnimData->dedupFrames();
+	iconAnimData->packFramesCI8();
+
 	// Return the first frame.
 	return iconAnimData->frames[0];
 }
@@ -338,7 +338,7 @@ void MegaDrivePrivate::addFields_romHeader(const MD_RomHeader *pRomHeader)
 		NOP_C_("MegaDrive|I/O", "Activator"),
 		NOP_C_("MegaDrive|I/O", "Mega Mouse"),
 	};
-	vector<string> *const v_io_bitfield_names = RomFields::strArrayToVector_i18n(
+	const vector<string> *const v_io_bitfield_names = RomFields::strArrayToVector_i18n(
 		"MegaDrive|I/O", io_bitfield_names, ARRAY_SIZE(io_bitfield_names));
 	// Parse I/O support.
 	uint32_t io_support = parseIOSupport(pRomHeader->io_support, sizeof(pRomHeader->io_support));
@@ -418,7 +418,7 @@ void MegaDrivePrivate::addFields_romHeader(const MD_RomHeader *pRomHeader)
 		NOP_C_("Region", "USA"),
 		NOP_C_("Region", "Europe"),
 	};
-	vector<string> *const v_region_code_bitfield_names = RomFields::strArrayToVector_i18n(
+	const vector<string> *const v_region_code_bitfield_names = RomFields::strArrayToVector_i18n(
 		"Region", region_code_bitfield_names, ARRAY_SIZE(region_code_bitfield_names));
 	fields->addField_bitfield(C_("RomData", "Region Code"),
 		v_region_code_bitfield_names, 0, md_region);
@@ -503,7 +503,7 @@ void MegaDrivePrivate::addFields_vectorTable(const M68K_VectorTable *pVectors)
 		NOP_C_("MegaDrive|VectorTable", "Vector"),
 		NOP_C_("MegaDrive|VectorTable", "Address"),
 	};
-	vector<string> *const v_vectors_headers = RomFields::strArrayToVector_i18n(
+	const vector<string> *const v_vectors_headers = RomFields::strArrayToVector_i18n(
 		"MegaDrive|VectorTable", vectors_headers, ARRAY_SIZE(vectors_headers));
 
 	RomFields::AFLD_PARAMS params(RomFields::RFT_LISTDATA_SEPARATE_ROW, 8);
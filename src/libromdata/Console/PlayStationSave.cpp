@@ -194,6 +194,8 @@ const rp_image *PlayStationSavePrivate::loadIcon(void)
 			scHeader.icon_pal, sizeof(scHeader.icon_pal));
 	}
 
+	// Remove duplicate frames.
+	iconAnimData->dedupFrames();
 
 	// Return the first frame.
 	return iconAnimData->frames[0];
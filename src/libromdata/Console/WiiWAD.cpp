@@ -875,10 +875,12 @@ int WiiWAD::loadFieldData(void)
 	}
 
 	// Access rights.
-	vector<string> *const v_access_rights_hdr = new vector<string>();
-	v_access_rights_hdr->reserve(2);
-	v_access_rights_hdr->push_back("AHBPROT");
-	v_access_rights_hdr->push_back(C_("WiiWAD", "DVD Video"));
+	static const char *const access_rights_names[] = {
+		"AHBPROT",
+		NOP_C_("WiiWAD", "DVD Video"),
+	};
+	const vector<string> *const v_access_rights_hdr = RomFields::strArrayToVector_i18n(
+		"WiiWAD", access_rights_names, ARRAY_SIZE(access_rights_names));
 	d->fields->addField_bitfield(C_("WiiWAD", "Access Rights"),
 		v_access_rights_hdr, 0, be32_to_cpu(tmdHeader->access_rights));
 
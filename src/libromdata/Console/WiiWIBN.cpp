@@ -208,6 +208,11 @@ const rp_image *WiiWIBNPrivate::loadIcon(void)
 	}
 	iconAnimData->seq_count = idx;
 
+	// Remove duplicate frames, then store the
+	// RGB5A3 frames as CI8 if possible.
+	iconAnimData->dedupFrames();
+	iconAnimData->packFramesCI8();
+
 	// Return the first frame.
 	return iconAnimData->frames[0];
 }
@@ -530,7 +535,7 @@ int WiiWIBN::loadFieldData(void)
 	static const char *const flags_names[] = {
 		NOP_C_("WiiWIBN|Flags", "No Copy"),
 	};
-	vector<string> *const v_flags_names = RomFields::strArrayToVector_i18n(
+	const vector<string> *const v_flags_names = RomFields::strArrayToVector_i18n(
 		"WiiWIBN|Flags", flags_names, ARRAY_SIZE(flags_names));
 	d->fields->addField_bitfield(C_("WiiWIBN", "Flags"),
 		v_flags_names, 0, be32_to_cpu(wibnHeader->flags));
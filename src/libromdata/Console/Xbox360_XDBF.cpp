@@ -631,7 +631,7 @@ int Xbox360_XDBF_Private::addFields_achievements(void)
 		NOP_C_("Xbox360_XDBF|Achievements", "Description"),
 		NOP_C_("Xbox360_XDBF|Achievements", "Gamerscore"),
 	};
-	vector<string> *const v_xach_col_names = RomFields::strArrayToVector_i18n(
+	const vector<string> *const v_xach_col_names = RomFields::strArrayToVector_i18n(
 		"Xbox360_XDBF|Achievements", xach_col_names, ARRAY_SIZE(xach_col_names));
 
 	// Vectors.
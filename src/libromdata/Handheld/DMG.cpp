@@ -794,7 +794,7 @@ int DMG::loadFieldData(void)
 	static const char *const system_bitfield_names[] = {
 		"DMG", "SGB", "CGB"
 	};
-	vector<string> *const v_system_bitfield_names = RomFields::strArrayToVector(
+	const vector<string> *const v_system_bitfield_names = RomFields::strArrayToVector(
 		system_bitfield_names, ARRAY_SIZE(system_bitfield_names));
 	d->fields->addField_bitfield(C_("DMG", "System"),
 		v_system_bitfield_names, 0, dmg_system);
@@ -856,7 +856,7 @@ int DMG::loadFieldData(void)
 		NOP_C_("DMG|Features", "Timer"),
 		NOP_C_("DMG|Features", "Rumble"),
 	};
-	vector<string> *const v_feature_bitfield_names = RomFields::strArrayToVector_i18n(
+	const vector<string> *const v_feature_bitfield_names = RomFields::strArrayToVector_i18n(
 		"DMG|Features", feature_bitfield_names, ARRAY_SIZE(feature_bitfield_names));
 	d->fields->addField_bitfield(C_("DMG", "Features"),
 		v_feature_bitfield_names, 0, DMGPrivate::CartType(romHeader->cart_type).features);
@@ -1084,7 +1084,7 @@ int DMG::loadFieldData(void)
 			NOP_C_("DMG|Features", "Rumble"),
 			NOP_C_("DMG|Features", "Timer"),
 		};
-		vector<string> *const v_gbx_feature_bitfield_names = RomFields::strArrayToVector_i18n(
+		const vector<string> *const v_gbx_feature_bitfield_names = RomFields::strArrayToVector_i18n(
 			"DMG|Features", gbx_feature_bitfield_names, ARRAY_SIZE(gbx_feature_bitfield_names));
 		d->fields->addField_bitfield(C_("DMG", "Features"),
 			v_gbx_feature_bitfield_names, 0, gbx_features);
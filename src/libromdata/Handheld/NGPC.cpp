@@ -296,7 +296,7 @@ int NGPC::loadFieldData(void)
 	static const char *const system_bitfield_names[] = {
 		"NGP (Monochrome)", "NGP Color"
 	};
-	vector<string> *const v_system_bitfield_names = RomFields::strArrayToVector(
+	const vector<string> *const v_system_bitfield_names = RomFields::strArrayToVector(
 		system_bitfield_names, ARRAY_SIZE(system_bitfield_names));
 	d->fields->addField_bitfield(C_("NGPC", "System"),
 		v_system_bitfield_names, 0,
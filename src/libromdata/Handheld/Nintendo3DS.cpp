@@ -283,6 +283,15 @@ class Nintendo3DSPrivate : public RomDataPrivate
 		 * @return 0 on success; non-zero on error.
 		 */
 		int addFields_permissions(void);
+
+		/**
+		 * Tab loader for the Permissions tab.
+		 * @param fields RomFields object.
+		 * @param tabIdx Tab index.
+		 * @param userdata Nintendo3DSPrivate.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		static int loadTab_permissions(RomFields *fields, int tabIdx, void *userdata);
 };
 
 /** Nintendo3DSPrivate **/
@@ -1348,6 +1357,22 @@ int Nintendo3DSPrivate::addFields_permissions(void)
 	return 0;
 }
 
+/**
+ * Tab loader for the Permissions tab.
+ * @param fields RomFields object.
+ * @param tabIdx Tab index.
+ * @param userdata Nintendo3DSPrivate.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int Nintendo3DSPrivate::loadTab_permissions(RomFields *fields, int tabIdx, void *userdata)
+{
+	RP_UNUSED(tabIdx);
+	Nintendo3DSPrivate *const d = static_cast<Nintendo3DSPrivate*>(userdata);
+	assert(d->fields == fields);
+	RP_UNUSED(fields);
+	return (d->addFields_permissions() == 0 ? 0 : -EIO);
+}
+
 /** Nintendo3DS **/
 
 /**
@@ -2006,7 +2031,7 @@ int Nintendo3DS::loadFieldData(void)
 
 		const char *const *pt_types;
 		const uint8_t *keyslots = nullptr;
-		vector<string> *v_partitions_names;
+		const vector<string> *v_partitions_names;
 		if (!emmc) {
 			// CCI (3DS cartridge dump)
 
@@ -2397,7 +2422,7 @@ int Nintendo3DS::loadFieldData(void)
 			NOP_C_("Nintendo3DS|CtNames", "Version"),
 			NOP_C_("Nintendo3DS|CtNames", "Size"),
 		};
-		vector<string> *const v_contents_names = RomFields::strArrayToVector_i18n(
+		const vector<string> *const v_contents_names = RomFields::strArrayToVector_i18n(
 			"Nintendo3DS|CtNames", contents_names, ARRAY_SIZE(contents_names));
 
 		RomFields::AFLD_PARAMS params(RomFields::RFT_LISTDATA_SEPARATE_ROW, 0);
@@ -2443,7 +2468,7 @@ int Nintendo3DS::loadFieldData(void)
 		static const char *const exheader_flags_names[] = {
 			"CompressExefsCode", "SDApplication"
 		};
-		vector<string> *const v_exheader_flags_names = RomFields::strArrayToVector(
+		const vector<string> *const v_exheader_flags_names = RomFields::strArrayToVector(
 			exheader_flags_names, ARRAY_SIZE(exheader_flags_names));
 		d->fields->addField_bitfield("Flags",
 			v_exheader_flags_names, 0, le32_to_cpu(ncch_exheader->sci.flags));
@@ -2508,7 +2533,7 @@ int Nintendo3DS::loadFieldData(void)
 			NOP_C_("Nintendo3DS|N3DSCPUMode", "L2 Cache"),
 			NOP_C_("Nintendo3DS|N3DSCPUMode", "804 MHz"),
 		};
-		vector<string> *const v_new3ds_cpu_mode_names = RomFields::strArrayToVector_i18n(
+		const vector<string> *const v_new3ds_cpu_mode_names = RomFields::strArrayToVector_i18n(
 			"Nintendo3DS|N3DSCPUMode", new3ds_cpu_mode_names, ARRAY_SIZE(new3ds_cpu_mode_names));
 		d->fields->addField_bitfield("New3DS CPU Mode",
 			v_new3ds_cpu_mode_names, 0, ncch_exheader->aci.arm11_local.flags[0]);
@@ -2519,9 +2544,10 @@ int Nintendo3DS::loadFieldData(void)
 
 		// Permissions. These are technically part of the
 		// ExHeader, but we're using a separate tab because
-		// there's a lot of them.
-		d->fields->addTab(C_("Nintendo3DS", "Permissions"));
-		d->addFields_permissions();
+		// there's a lot of them. They're only loaded if
+		// the tab is actually displayed.
+		const int perm_tab = d->fields->addTab(C_("Nintendo3DS", "Permissions"));
+		d->fields->setTabLoader(perm_tab, Nintendo3DSPrivate::loadTab_permissions, d);
 	}
 
 	// Finished reading the field data.
@@ -2547,6 +2573,21 @@ int Nintendo3DS::loadMetaData(void)
 		return -EIO;
 	}
 
+	// Metadata-only mode: If the CIA has a meta section, use its
+	// SMDH directly. Only 3DS titles have one, so the ticket and TMD
+	// don't have to be parsed and the first content doesn't have to
+	// be opened as a DSiWare SRL.
+	if (isMetaDataOnly() && d->romType == Nintendo3DSPrivate::ROM_TYPE_CIA &&
+	    d->mxh.cia_header.meta_size != cpu_to_le32(0))
+	{
+		if (d->loadSMDH() == 0) {
+			// Add the SMDH metadata.
+			d->metaData = new RomMetaData();
+			d->metaData->addMetaData_metaData(d->sbptr.smdh.data->metaData());
+			return static_cast<int>(d->metaData->count());
+		}
+	}
+
 	// Check for DSiWare.
 	// TODO: Check d->sbptr.srl.data first?
 	int ret = const_cast<Nintendo3DSPrivate*>(d)->loadTicketAndTMD();
@@ -352,6 +352,10 @@ const rp_image *NintendoDSPrivate::loadIcon(void)
 	// a single icon because iconAnimData() will call loadIcon()
 	// if iconAnimData is nullptr.
 
+	// Remove duplicate frames.
+	// Some DSi icons have identical data in multiple bitmap slots.
+	iconAnimData->dedupFrames();
+
 	// Return a pointer to the first frame.
 	icon_first_frame = iconAnimData->frames[iconAnimData->seq_index[0]];
 	return icon_first_frame;
@@ -1117,7 +1121,7 @@ int NintendoDS::loadFieldData(void)
 	static const char *const hw_bitfield_names[] = {
 		"Nintendo DS", "Nintendo DSi"
 	};
-	vector<string> *const v_hw_bitfield_names = RomFields::strArrayToVector(
+	const vector<string> *const v_hw_bitfield_names = RomFields::strArrayToVector(
 		hw_bitfield_names, ARRAY_SIZE(hw_bitfield_names));
 	d->fields->addField_bitfield(C_("NintendoDS", "Hardware"),
 		v_hw_bitfield_names, 0, hw_type);
@@ -1143,7 +1147,7 @@ int NintendoDS::loadFieldData(void)
 		NOP_C_("Region", "South Korea"),
 		NOP_C_("Region", "China"),
 	};
-	vector<string> *const v_nds_region_bitfield_names = RomFields::strArrayToVector_i18n(
+	const vector<string> *const v_nds_region_bitfield_names = RomFields::strArrayToVector_i18n(
 		"Region", nds_region_bitfield_names, ARRAY_SIZE(nds_region_bitfield_names));
 	d->fields->addField_bitfield(C_("NintendoDS", "DS Region Code"),
 		v_nds_region_bitfield_names, 0, nds_region);
@@ -1231,7 +1235,7 @@ int NintendoDS::loadFieldData(void)
 		NOP_C_("Region", "China"),
 		NOP_C_("Region", "South Korea"),
 	};
-	vector<string> *const v_dsi_region_bitfield_names = RomFields::strArrayToVector_i18n(
+	const vector<string> *const v_dsi_region_bitfield_names = RomFields::strArrayToVector_i18n(
 		"Region", dsi_region_bitfield_names, ARRAY_SIZE(dsi_region_bitfield_names));
 	d->fields->addField_bitfield(region_code_name,
 		v_dsi_region_bitfield_names, 3, le32_to_cpu(romHeader->dsi.region_code));
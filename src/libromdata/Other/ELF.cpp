@@ -720,7 +720,7 @@ int ELFPrivate::addPtDynamicFields(void)
 			// 0x00000010
 			"STATIC_TLS",
 		};
-		vector<string> *const v_dt_flags_names = RomFields::strArrayToVector(
+		const vector<string> *const v_dt_flags_names = RomFields::strArrayToVector(
 			dt_flags_names, ARRAY_SIZE(dt_flags_names));
 		fields->addField_bitfield("DT_FLAGS",
 			v_dt_flags_names, 3, val_DT_FLAGS);
@@ -745,7 +745,7 @@ int ELFPrivate::addPtDynamicFields(void)
 			// 0x01000000
 			"GlobAudit", "Singleton", "Stub", "PIE"
 		};
-		vector<string> *const v_dt_flags_1_names = RomFields::strArrayToVector(
+		const vector<string> *const v_dt_flags_1_names = RomFields::strArrayToVector(
 			dt_flags_1_names, ARRAY_SIZE(dt_flags_1_names));
 		fields->addField_bitfield("DT_FLAGS_1",
 			v_dt_flags_1_names, 3, val_DT_FLAGS_1);
@@ -1227,7 +1227,7 @@ int ELF::loadFieldData(void)
 				// tr: Little-Endian Data
 				NOP_C_("ELF|SPARCFlags", "LE Data")
 			};
-			vector<string> *const v_sparc_flags_names = RomFields::strArrayToVector_i18n(
+			const vector<string> *const v_sparc_flags_names = RomFields::strArrayToVector_i18n(
 				"ELF|SPARCFlags", sparc_flags_names, ARRAY_SIZE(sparc_flags_names));
 			d->fields->addField_bitfield(C_("ELF", "CPU Flags"),
 				v_sparc_flags_names, 4, flags);
@@ -1274,7 +1274,7 @@ int ELF::loadFieldData(void)
 				NOP_C_("ELF|MIPSFlags", "FP64"),
 				NOP_C_("ELF|MIPSFlags", "NaN 2008"),
 			};
-			vector<string> *const v_mips_flags_names = RomFields::strArrayToVector_i18n(
+			const vector<string> *const v_mips_flags_names = RomFields::strArrayToVector_i18n(
 				"ELF|MIPSFlags", mips_flags_names, ARRAY_SIZE(mips_flags_names));
 			d->fields->addField_bitfield(C_("ELF", "CPU Flags"),
 				v_mips_flags_names, 4, (flags & ~0xF0000000));
@@ -120,7 +120,7 @@ void EXEPrivate::addFields_VS_VERSION_INFO(const VS_FIXEDFILEINFO *pVsFfi, const
 		NOP_C_("EXE|FileFlags", "Info Inferred"),
 		NOP_C_("EXE|FileFlags", "Special Build"),
 	};
-	vector<string> *const v_FileFlags_names = RomFields::strArrayToVector_i18n(
+	const vector<string> *const v_FileFlags_names = RomFields::strArrayToVector_i18n(
 		"EXE|FileFlags", FileFlags_names, ARRAY_SIZE(FileFlags_names));
 	fields->addField_bitfield(C_("EXE", "File Flags"),
 		v_FileFlags_names, 3, pVsFfi->dwFileFlags & pVsFfi->dwFileFlagsMask);
@@ -329,7 +329,7 @@ void EXEPrivate::addFields_VS_VERSION_INFO(const VS_FIXEDFILEINFO *pVsFfi, const
 	static const char *const field_names[] = {
 		"Key", "Value"
 	};
-	vector<string> *const v_field_names = RomFields::strArrayToVector(
+	const vector<string> *const v_field_names = RomFields::strArrayToVector(
 		field_names, ARRAY_SIZE(field_names));
 
 	// Add the StringFileInfo.
@@ -272,7 +272,7 @@ int EXEPrivate::addFields_PE_Manifest(void)
 			ADD_SETTING(settings, windowsSettings, ultraHighResolutionScrollingAware);
 
 			// Show the bitfield.
-			vector<string> *const v_WindowsSettings_names = RomFields::strArrayToVector_i18n(
+			const vector<string> *const v_WindowsSettings_names = RomFields::strArrayToVector_i18n(
 				"EXE|Manifest|WinSettings", WindowsSettings_names, ARRAY_SIZE(WindowsSettings_names));
 			fields->addField_bitfield(C_("EXE|Manifest", "Settings"),
 				v_WindowsSettings_names, 2, settings);
@@ -352,7 +352,7 @@ int EXEPrivate::addFields_PE_Manifest(void)
 			}
 
 			// Show the bitfield.
-			vector<string> *const v_OS_Compatibility_names = RomFields::strArrayToVector_i18n(
+			const vector<string> *const v_OS_Compatibility_names = RomFields::strArrayToVector_i18n(
 				"EXE|Manifest|OSCompatibility", OS_Compatibility_names, ARRAY_SIZE(OS_Compatibility_names));
 			fields->addField_bitfield(C_("EXE|Manifest", "Compatibility"),
 				v_OS_Compatibility_names, 2, compat);
@@ -575,7 +575,7 @@ int MachO::loadFieldData(void)
 			// 0x01000000
 			"NoHeapExec", "AppExtSafe"
 		};
-		vector<string> *const v_flags_bitfield_names = RomFields::strArrayToVector(
+		const vector<string> *const v_flags_bitfield_names = RomFields::strArrayToVector(
 			flags_bitfield_names, ARRAY_SIZE(flags_bitfield_names));
 		d->fields->addField_bitfield(C_("MachO", "Flags"),
 			v_flags_bitfield_names, 3, machHeader->flags);
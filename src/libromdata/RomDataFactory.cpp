@@ -28,6 +28,7 @@
 #include "librpbase/RomData.hpp"
 #include "librpbase/file/IRpFile.hpp"
 #include "librpbase/file/FileSystem.hpp"
+#include "librpbase/file/IoBudget.hpp"
 #include "librpbase/file/RelatedFile.hpp"
 #include "librpbase/threads/pthread_once.h"
 using namespace LibRpBase;
@@ -191,6 +192,15 @@ class RomDataFactoryPrivate
 		 */
 		static RomData *openDreamcastVMSandVMI(IRpFile *file);
 
+		/**
+		 * Create a RomData subclass for the specified ROM file.
+		 * Internal implementation of RomDataFactory::create().
+		 * @param file ROM file.
+		 * @param attrs RomDataAttr bitfield. RomData subclass must have the specified attributes.
+		 * @return RomData subclass, or nullptr if the ROM isn't supported.
+		 */
+		static RomData *create(IRpFile *file, unsigned int attrs);
+
 		// Vectors for file extensions and MIME types.
 		// We want to collect them once per session instead of
 		// repeatedly collecting them, since the caller might
@@ -215,6 +225,7 @@ class RomDataFactoryPrivate
 		/**
 		 * Initialize the vector of supported MIME types.
 		 * Used for KFileMetaData.
+		 * Only RomData subclasses with metadata are included.
 		 *
 		 * Internal function; must be called using pthread_once().
 		 */
@@ -231,6 +242,7 @@ pthread_once_t RomDataFactoryPrivate::once_mimeTypes = PTHREAD_ONCE_INIT;
 #define ATTR_NONE RomDataFactory::RDA_NONE
 #define ATTR_HAS_THUMBNAIL RomDataFactory::RDA_HAS_THUMBNAIL
 #define ATTR_HAS_DPOVERLAY RomDataFactory::RDA_HAS_DPOVERLAY
+#define ATTR_HAS_METADATA RomDataFactory::RDA_HAS_METADATA
 
 // RomData subclasses that use a header at 0 and
 // definitely have a 32-bit magic number in the header.
@@ -241,30 +253,30 @@ const RomDataFactoryPrivate::RomDataFns RomDataFactoryPrivate::romDataFns_magic[
 	// Consoles
 	GetRomDataFns_addr(WiiWIBN, ATTR_HAS_THUMBNAIL, 0, 'WIBN'),
 	GetRomDataFns_addr(Xbox360_XDBF, ATTR_HAS_THUMBNAIL, 0, 'XDBF'),
-	GetRomDataFns_addr(Xbox360_XEX, ATTR_HAS_THUMBNAIL, 0, 'XEX2'),
+	GetRomDataFns_addr(Xbox360_XEX, ATTR_HAS_THUMBNAIL | ATTR_HAS_METADATA, 0, 'XEX2'),
 
 	// Handhelds
-	GetRomDataFns_addr(DMG, ATTR_NONE, 0x104, 0xCEED6666),
+	GetRomDataFns_addr(DMG, ATTR_HAS_METADATA, 0x104, 0xCEED6666),
 	GetRomDataFns_addr(GameBoyAdvance, ATTR_NONE, 0x04, 0x24FFAE51),
 	GetRomDataFns_addr(Lynx, ATTR_NONE, 0, 'LYNX'),
-	GetRomDataFns_addr(NGPC, ATTR_NONE, 12, ' SNK'),
+	GetRomDataFns_addr(NGPC, ATTR_HAS_METADATA, 12, ' SNK'),
 	GetRomDataFns_addr(Nintendo3DSFirm, ATTR_NONE, 0, 'FIRM'),
-	GetRomDataFns_addr(Nintendo3DS_SMDH, ATTR_HAS_THUMBNAIL, 0, 'SMDH'),
+	GetRomDataFns_addr(Nintendo3DS_SMDH, ATTR_HAS_THUMBNAIL | ATTR_HAS_METADATA, 0, 'SMDH'),
 
 	// Textures
-	GetRomDataFns_addr(DirectDrawSurface, ATTR_HAS_THUMBNAIL, 0, 'DDS '),
+	GetRomDataFns_addr(DirectDrawSurface, ATTR_HAS_THUMBNAIL | ATTR_HAS_METADATA, 0, 'DDS '),
 #ifdef ENABLE_GL
-	GetRomDataFns_addr(KhronosKTX, ATTR_HAS_THUMBNAIL, 0, (uint32_t)'\xABKTX'),
+	GetRomDataFns_addr(KhronosKTX, ATTR_HAS_THUMBNAIL | ATTR_HAS_METADATA, 0, (uint32_t)'\xABKTX'),
 #endif /* ENABLE_GL */
-	GetRomDataFns_addr(ValveVTF, ATTR_HAS_THUMBNAIL, 0, 'VTF\0'),
-	GetRomDataFns_addr(ValveVTF3, ATTR_HAS_THUMBNAIL, 0, 'VTF3'),
+	GetRomDataFns_addr(ValveVTF, ATTR_HAS_THUMBNAIL | ATTR_HAS_METADATA, 0, 'VTF\0'),
+	GetRomDataFns_addr(ValveVTF3, ATTR_HAS_THUMBNAIL | ATTR_HAS_METADATA, 0, 'VTF3'),
 
 	// Audio
-	GetRomDataFns_addr(BRSTM, ATTR_NONE, 0, 'RSTM'),
-	GetRomDataFns_addr(GBS, ATTR_NONE, 0, 'GBS\x01'),
-	GetRomDataFns_addr(NSF, ATTR_NONE, 0, 'NESM'),
-	GetRomDataFns_addr(SPC, ATTR_NONE, 0, 'SNES'),
-	GetRomDataFns_addr(VGM, ATTR_NONE, 0, 'Vgm '),
+	GetRomDataFns_addr(BRSTM, ATTR_HAS_METADATA, 0, 'RSTM'),
+	GetRomDataFns_addr(GBS, ATTR_HAS_METADATA, 0, 'GBS\x01'),
+	GetRomDataFns_addr(NSF, ATTR_HAS_METADATA, 0, 'NESM'),
+	GetRomDataFns_addr(SPC, ATTR_HAS_METADATA, 0, 'SNES'),
+	GetRomDataFns_addr(VGM, ATTR_HAS_METADATA, 0, 'Vgm '),
 
 	// Other
 	GetRomDataFns_addr(ELF, ATTR_NONE, 0, '\177ELF'),
@@ -277,35 +289,35 @@ const RomDataFactoryPrivate::RomDataFns RomDataFactoryPrivate::romDataFns_magic[
 // placed at the end of this array.
 const RomDataFactoryPrivate::RomDataFns RomDataFactoryPrivate::romDataFns_header[] = {
 	// Consoles
-	GetRomDataFns(Dreamcast, ATTR_HAS_THUMBNAIL),
+	GetRomDataFns(Dreamcast, ATTR_HAS_THUMBNAIL | ATTR_HAS_METADATA),
 	GetRomDataFns(DreamcastSave, ATTR_HAS_THUMBNAIL),
-	GetRomDataFns(GameCube, ATTR_HAS_THUMBNAIL),
-	GetRomDataFns(GameCubeBNR, ATTR_HAS_THUMBNAIL),
+	GetRomDataFns(GameCube, ATTR_HAS_THUMBNAIL | ATTR_HAS_METADATA),
+	GetRomDataFns(GameCubeBNR, ATTR_HAS_THUMBNAIL | ATTR_HAS_METADATA),
 	GetRomDataFns(GameCubeSave, ATTR_HAS_THUMBNAIL),
 	GetRomDataFns(MegaDrive, ATTR_NONE),
-	GetRomDataFns(N64, ATTR_NONE),
+	GetRomDataFns(N64, ATTR_HAS_METADATA),
 	GetRomDataFns(NES, ATTR_NONE),
 	GetRomDataFns(SNES, ATTR_NONE),
-	GetRomDataFns(SegaSaturn, ATTR_NONE),
+	GetRomDataFns(SegaSaturn, ATTR_HAS_METADATA),
 	GetRomDataFns(WiiSave, ATTR_HAS_THUMBNAIL),
 	GetRomDataFns(WiiU, ATTR_HAS_THUMBNAIL),
-	GetRomDataFns(WiiWAD, ATTR_HAS_THUMBNAIL),
+	GetRomDataFns(WiiWAD, ATTR_HAS_THUMBNAIL | ATTR_HAS_METADATA),
 
 	// Handhelds
-	GetRomDataFns(Nintendo3DS, ATTR_HAS_THUMBNAIL | ATTR_HAS_DPOVERLAY),
-	GetRomDataFns(NintendoDS, ATTR_HAS_THUMBNAIL | ATTR_HAS_DPOVERLAY),
+	GetRomDataFns(Nintendo3DS, ATTR_HAS_THUMBNAIL | ATTR_HAS_DPOVERLAY | ATTR_HAS_METADATA),
+	GetRomDataFns(NintendoDS, ATTR_HAS_THUMBNAIL | ATTR_HAS_DPOVERLAY | ATTR_HAS_METADATA),
 
 	// Textures
-	GetRomDataFns(SegaPVR, ATTR_HAS_THUMBNAIL),
-	GetRomDataFns(XboxXPR, ATTR_HAS_THUMBNAIL),
+	GetRomDataFns(SegaPVR, ATTR_HAS_THUMBNAIL | ATTR_HAS_METADATA),
+	GetRomDataFns(XboxXPR, ATTR_HAS_THUMBNAIL | ATTR_HAS_METADATA),
 
 	// Audio
-	GetRomDataFns(ADX, ATTR_NONE),
-	GetRomDataFns(BCSTM, ATTR_NONE),
-	GetRomDataFns(PSF, ATTR_NONE),
-	GetRomDataFns(SAP, ATTR_NONE),	// "SAP\r\n", "SAP\n"; maybe move to _magic[]?
-	GetRomDataFns(SNDH, ATTR_NONE),	// "SNDH", or "ICE!" or "Ice!" if packed.
-	GetRomDataFns(SID, ATTR_NONE),	// PSID/RSID; maybe move to _magic[]?
+	GetRomDataFns(ADX, ATTR_HAS_METADATA),
+	GetRomDataFns(BCSTM, ATTR_HAS_METADATA),
+	GetRomDataFns(PSF, ATTR_HAS_METADATA),
+	GetRomDataFns(SAP, ATTR_HAS_METADATA),	// "SAP\r\n", "SAP\n"; maybe move to _magic[]?
+	GetRomDataFns(SNDH, ATTR_HAS_METADATA),	// "SNDH", or "ICE!" or "Ice!" if packed.
+	GetRomDataFns(SID, ATTR_HAS_METADATA),	// PSID/RSID; maybe move to _magic[]?
 
 	// Other
 	GetRomDataFns(Amiibo, ATTR_HAS_THUMBNAIL),
@@ -315,17 +327,17 @@ const RomDataFactoryPrivate::RomDataFns RomDataFactoryPrivate::romDataFns_header
 	// The following formats have 16-bit magic numbers,
 	// so they should go at the end of the address=0 section.
 	GetRomDataFns(EXE, ATTR_NONE),	// TODO: Thumbnailing on non-Windows platforms.
-	GetRomDataFns(PlayStationSave, ATTR_HAS_THUMBNAIL),
+	GetRomDataFns(PlayStationSave, ATTR_HAS_THUMBNAIL | ATTR_HAS_METADATA),
 
 	// NOTE: game.com may be at either 0 or 0x40000.
 	// The 0x40000 address is checked below.
-	GetRomDataFns(GameCom, ATTR_HAS_THUMBNAIL),
+	GetRomDataFns(GameCom, ATTR_HAS_THUMBNAIL | ATTR_HAS_METADATA),
 
 	// Headers with non-zero addresses.
-	GetRomDataFns_addr(Sega8Bit, ATTR_NONE, 0x7FE0, 0x20),
+	GetRomDataFns_addr(Sega8Bit, ATTR_HAS_METADATA, 0x7FE0, 0x20),
 	// NOTE: game.com may be at either 0 or 0x40000.
 	// The 0 address is checked above.
-	GetRomDataFns_addr(GameCom, ATTR_HAS_THUMBNAIL, 0x40000, 0x20),
+	GetRomDataFns_addr(GameCom, ATTR_HAS_THUMBNAIL | ATTR_HAS_METADATA, 0x40000, 0x20),
 
 	{nullptr, nullptr, nullptr, nullptr, ATTR_NONE, 0, 0}
 };
@@ -416,20 +428,12 @@ RomData *RomDataFactoryPrivate::openDreamcastVMSandVMI(IRpFile *file)
 
 /**
  * Create a RomData subclass for the specified ROM file.
- *
- * NOTE: RomData::isValid() is checked before returning a
- * created RomData instance, so returned objects can be
- * assumed to be valid as long as they aren't nullptr.
- *
- * If imgbf is non-zero, at least one of the specified image
- * types must be supported by the RomData subclass in order to
- * be returned.
- *
+ * Internal implementation of RomDataFactory::create().
  * @param file ROM file.
- * @param attrs RomDataAttr bitfield. If set, RomData subclass must have the specified attributes.
+ * @param attrs RomDataAttr bitfield. RomData subclass must have the specified attributes.
  * @return RomData subclass, or nullptr if the ROM isn't supported.
  */
-RomData *RomDataFactory::create(IRpFile *file, unsigned int attrs)
+RomData *RomDataFactoryPrivate::create(IRpFile *file, unsigned int attrs)
 {
 	RomData::DetectInfo info;
 
@@ -459,7 +463,9 @@ RomData *RomDataFactory::create(IRpFile *file, unsigned int attrs)
 	}
 
 	// Special handling for Dreamcast .VMI+.VMS pairs.
-	if (info.ext != nullptr &&
+	// NOTE: DreamcastSave only has thumbnails.
+	if ((attrs & ~RomDataFactory::RDA_HAS_THUMBNAIL) == 0 &&
+	    info.ext != nullptr &&
 	    (!strcasecmp(info.ext, ".vms") ||
 	     !strcasecmp(info.ext, ".vmi")))
 	{
@@ -506,6 +512,10 @@ RomData *RomDataFactory::create(IRpFile *file, unsigned int attrs)
 
 				// Not actually supported.
 				romData->unref();
+				if (IoBudget::isCurrentExceeded()) {
+					// I/O budget exceeded. Don't try any other classes.
+					return nullptr;
+				}
 			}
 		}
 	}
@@ -575,6 +585,10 @@ RomData *RomDataFactory::create(IRpFile *file, unsigned int attrs)
 
 			// Not actually supported.
 			romData->unref();
+			if (IoBudget::isCurrentExceeded()) {
+				// I/O budget exceeded. Don't try any other classes.
+				return nullptr;
+			}
 		}
 	}
 
@@ -625,6 +639,10 @@ RomData *RomDataFactory::create(IRpFile *file, unsigned int attrs)
 
 			// Not actually supported.
 			romData->unref();
+			if (IoBudget::isCurrentExceeded()) {
+				// I/O budget exceeded. Don't try any other classes.
+				return nullptr;
+			}
 		}
 	}
 
@@ -632,6 +650,46 @@ RomData *RomDataFactory::create(IRpFile *file, unsigned int attrs)
 	return nullptr;
 }
 
+/**
+ * Create a RomData subclass for the specified ROM file.
+ *
+ * NOTE: RomData::isValid() is checked before returning a
+ * created RomData instance, so returned objects can be
+ * assumed to be valid as long as they aren't nullptr.
+ *
+ * If imgbf is non-zero, at least one of the specified image
+ * types must be supported by the RomData subclass in order to
+ * be returned.
+ *
+ * If an IoBudget is active on the current thread, detection stops
+ * as soon as the budget is exceeded, and nullptr is returned.
+ * Use IoBudget::isExceeded() to check for this case.
+ *
+ * If RDA_METADATA_ONLY is set, only RomData subclasses with metadata
+ * are checked, and the RomData object is created in metadata-only mode.
+ * See RomData::isMetaDataOnly().
+ *
+ * @param file ROM file.
+ * @param attrs RomDataAttr bitfield. If set, RomData subclass must have the specified attributes.
+ * @return RomData subclass, or nullptr if the ROM isn't supported.
+ */
+RomData *RomDataFactory::create(IRpFile *file, unsigned int attrs)
+{
+	if (!(attrs & RDA_METADATA_ONLY)) {
+		return RomDataFactoryPrivate::create(file, attrs);
+	}
+
+	// Metadata-only mode.
+	// RDA_METADATA_ONLY isn't a subclass attribute,
+	// so it must be removed before checking subclasses.
+	// The RomData object is created within a MetaDataOnlyScope
+	// so its constructor can skip work, too.
+	attrs &= ~RDA_METADATA_ONLY;
+	attrs |= RDA_HAS_METADATA;
+	RomData::MetaDataOnlyScope scope;
+	return RomDataFactoryPrivate::create(file, attrs);
+}
+
 /**
  * Initialize the vector of supported file extensions.
  * Used for Win32 COM registration.
@@ -711,6 +769,7 @@ const vector<RomDataFactory::ExtInfo> &RomDataFactory::supportedFileExtensions(v
 /**
  * Initialize the vector of supported MIME types.
  * Used for KFileMetaData.
+ * Only RomData subclasses with metadata are included.
  *
  * Internal function; must be called using pthread_once().
  */
@@ -737,6 +796,12 @@ void RomDataFactoryPrivate::init_supportedMimeTypes(void)
 	{
 		const RomDataFns *fns = *tblptr;
 		for (; fns->supportedFileExtensions != nullptr; fns++) {
+			if (!(fns->attrs & RomDataFactory::RDA_HAS_METADATA)) {
+				// KFileMetaData only needs RomData
+				// subclasses that have metadata.
+				continue;
+			}
+
 			const char *const *sys_mimeTypes = fns->supportedMimeTypes();
 			if (!sys_mimeTypes)
 				continue;
@@ -755,6 +820,7 @@ void RomDataFactoryPrivate::init_supportedMimeTypes(void)
 /**
  * Get all supported MIME types.
  * Used for KFileMetaData.
+ * Only RomData subclasses with metadata are included.
  *
  * @return All supported MIME types.
  */
@@ -54,6 +54,14 @@ class RomDataFactory
 
 			// RomData subclass may have "dangerous" permissions.
 			RDA_HAS_DPOVERLAY	= (1 << 1),
+
+			// RomData subclass has metadata. (implements loadMetaData())
+			RDA_HAS_METADATA	= (1 << 2),
+
+			// Create the RomData subclass in metadata-only mode.
+			// This isn't a subclass attribute; it implies RDA_HAS_METADATA.
+			// See RomData::isMetaDataOnly().
+			RDA_METADATA_ONLY	= (1 << 3),
 		};
 
 		/**
@@ -67,6 +75,14 @@ class RomDataFactory
 		 * types must be supported by the RomData subclass in order to
 		 * be returned.
 		 *
+		 * If an IoBudget is active on the current thread, detection stops
+		 * as soon as the budget is exceeded, and nullptr is returned.
+		 * Use IoBudget::isExceeded() to check for this case.
+		 *
+		 * If RDA_METADATA_ONLY is set, only RomData subclasses with metadata
+		 * are checked, and the RomData object is created in metadata-only mode.
+		 * See RomData::isMetaDataOnly().
+		 *
 		 * @param file ROM file.
 		 * @param attrs RomDataAttr bitfield. If set, RomData subclass must have the specified attributes.
 		 * @return RomData subclass, or nullptr if the ROM isn't supported.
@@ -98,6 +114,7 @@ class RomDataFactory
 		/**
 		 * Get all supported MIME types.
 		 * Used for KFileMetaData.
+		 * Only RomData subclasses with metadata are included.
 		 *
 		 * @return All supported MIME types.
 		 */
@@ -1223,7 +1223,7 @@ int DirectDrawSurface::loadFieldData(void)
 		nullptr, nullptr, nullptr,
 		NOP_C_("DirectDrawSurface|dwFlags", "Depth"),
 	};
-	vector<string> *const v_dwFlags_names = RomFields::strArrayToVector_i18n(
+	const vector<string> *const v_dwFlags_names = RomFields::strArrayToVector_i18n(
 		"DirectDrawSurface|dwFlags", dwFlags_names, ARRAY_SIZE(dwFlags_names));
 	d->fields->addField_bitfield(C_("DirectDrawSurface", "Flags"),
 		v_dwFlags_names, 3, ddsHeader->dwFlags);
@@ -1246,7 +1246,7 @@ int DirectDrawSurface::loadFieldData(void)
 		nullptr, nullptr,
 		NOP_C_("DirectDrawSurface|dwCaps", "Mipmap"),
 	};
-	vector<string> *const v_dwCaps_names = RomFields::strArrayToVector_i18n(
+	const vector<string> *const v_dwCaps_names = RomFields::strArrayToVector_i18n(
 		"DirectDrawSurface|dwFlags", dwCaps_names, ARRAY_SIZE(dwCaps_names));
 	d->fields->addField_bitfield(C_("DirectDrawSurface", "Caps"),
 		v_dwCaps_names, 3, ddsHeader->dwCaps);
@@ -1273,7 +1273,7 @@ int DirectDrawSurface::loadFieldData(void)
 		nullptr,
 		NOP_C_("DirectDrawSurface|dwCaps2", "Volume"),
 	};
-	vector<string> *const v_dwCaps2_names = RomFields::strArrayToVector_i18n(
+	const vector<string> *const v_dwCaps2_names = RomFields::strArrayToVector_i18n(
 		"DirectDrawSurface|dwCaps2", dwCaps2_names, ARRAY_SIZE(dwCaps2_names));
 	d->fields->addField_bitfield(C_("DirectDrawSurface", "Caps2"),
 		v_dwCaps2_names, 4, ddsHeader->dwCaps2);
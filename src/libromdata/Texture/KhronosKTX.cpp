@@ -906,7 +906,7 @@ int KhronosKTX::loadFieldData(void)
 
 		// NOTE: Making a copy.
 		vector<vector<string> > *const p_kv_data = new vector<vector<string> >(d->kv_data);
-		vector<string> *const v_kv_field_names = RomFields::strArrayToVector_i18n(
+		const vector<string> *const v_kv_field_names = RomFields::strArrayToVector_i18n(
 			"KhronosKTX|KeyValue", kv_field_names, ARRAY_SIZE(kv_field_names));
 
 		RomFields::AFLD_PARAMS params;
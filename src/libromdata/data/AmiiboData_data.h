@@ -0,0 +1,2097 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libromdata)                       *
+ * AmiiboData_data.h: Nintendo amiibo identification data.                 *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+// NOTE: This file is included multiple times by AmiiboData.cpp
+// to build the string pool and the amiibo data tables.
+// Each entry must be on its own line. (See strpool.h.)
+
+// Entry macros that aren't defined by AmiiboData.cpp are
+// no-ops, so each table only needs to define its own macros.
+// Null entries don't have strings, so more than one null
+// entry can be on a single line.
+#ifndef AMIIBO_CHAR_SERIES_ENTRY
+# define AMIIBO_CHAR_SERIES_ENTRY(name)
+#endif
+#ifndef AMIIBO_CHAR_SERIES_NULL_ENTRY
+# define AMIIBO_CHAR_SERIES_NULL_ENTRY()
+#endif
+#ifndef AMIIBO_CHAR_VARIANTS_BEGIN
+# define AMIIBO_CHAR_VARIANTS_BEGIN(arr)
+#endif
+#ifndef AMIIBO_CHAR_VARIANT
+# define AMIIBO_CHAR_VARIANT(variant_id, name)
+#endif
+#ifndef AMIIBO_CHAR_VARIANT_NULL
+# define AMIIBO_CHAR_VARIANT_NULL(variant_id)
+#endif
+#ifndef AMIIBO_CHAR_VARIANTS_END
+# define AMIIBO_CHAR_VARIANTS_END()
+#endif
+#ifndef AMIIBO_CHAR_VARIANTS_MSS
+# define AMIIBO_CHAR_VARIANTS_MSS(c_name, char_name)
+#endif
+#ifndef AMIIBO_CHAR_ID_ONE
+# define AMIIBO_CHAR_ID_ONE(id, name)
+#endif
+#ifndef AMIIBO_CHAR_ID_VAR
+# define AMIIBO_CHAR_ID_VAR(id, name, vararray)
+#endif
+#ifndef AMIIBO_SERIES_ENTRY
+# define AMIIBO_SERIES_ENTRY(name)
+#endif
+#ifndef AMIIBO_SERIES_NULL_ENTRY
+# define AMIIBO_SERIES_NULL_ENTRY()
+#endif
+#ifndef AMIIBO_ID_ENTRY
+# define AMIIBO_ID_ENTRY(release_no, wave_no, name)
+#endif
+#ifndef AMIIBO_ID_NULL_ENTRY
+# define AMIIBO_ID_NULL_ENTRY()
+#endif
+
+/** Page 21 (raw offset 0x54): Character series **/
+
+// Character series.
+// Array index == sss, rshifted by 2.
+
+AMIIBO_CHAR_SERIES_ENTRY("Super Mario Bros.")	// 0x000
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x004
+AMIIBO_CHAR_SERIES_ENTRY("Yoshi")		// 0x008
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x00C
+AMIIBO_CHAR_SERIES_ENTRY("The Legend of Zelda")	// 0x010
+AMIIBO_CHAR_SERIES_ENTRY("The Legend of Zelda")	// 0x014
+
+// Animal Crossing
+AMIIBO_CHAR_SERIES_ENTRY("Animal Crossing")	// 0x018
+AMIIBO_CHAR_SERIES_ENTRY("Animal Crossing")	// 0x01C
+AMIIBO_CHAR_SERIES_ENTRY("Animal Crossing")	// 0x020
+AMIIBO_CHAR_SERIES_ENTRY("Animal Crossing")	// 0x024
+AMIIBO_CHAR_SERIES_ENTRY("Animal Crossing")	// 0x028
+AMIIBO_CHAR_SERIES_ENTRY("Animal Crossing")	// 0x02C
+AMIIBO_CHAR_SERIES_ENTRY("Animal Crossing")	// 0x030
+AMIIBO_CHAR_SERIES_ENTRY("Animal Crossing")	// 0x034
+AMIIBO_CHAR_SERIES_ENTRY("Animal Crossing")	// 0x038
+AMIIBO_CHAR_SERIES_ENTRY("Animal Crossing")	// 0x03C
+AMIIBO_CHAR_SERIES_ENTRY("Animal Crossing")	// 0x040
+AMIIBO_CHAR_SERIES_ENTRY("Animal Crossing")	// 0x044
+AMIIBO_CHAR_SERIES_ENTRY("Animal Crossing")	// 0x048
+AMIIBO_CHAR_SERIES_ENTRY("Animal Crossing")	// 0x04C
+AMIIBO_CHAR_SERIES_ENTRY("Animal Crossing")	// 0x050
+
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x054
+AMIIBO_CHAR_SERIES_ENTRY("Star Fox")		// 0x058
+AMIIBO_CHAR_SERIES_ENTRY("Metroid")		// 0x05C
+AMIIBO_CHAR_SERIES_ENTRY("F-Zero")		// 0x060
+AMIIBO_CHAR_SERIES_ENTRY("Pikmin")		// 0x064
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x068
+AMIIBO_CHAR_SERIES_ENTRY("Punch-Out!!")		// 0x06C
+AMIIBO_CHAR_SERIES_ENTRY("Wii Fit")		// 0x070
+AMIIBO_CHAR_SERIES_ENTRY("Kid Icarus")		// 0x074
+AMIIBO_CHAR_SERIES_ENTRY("Classic Nintendo")	// 0x078
+AMIIBO_CHAR_SERIES_ENTRY("Mii")			// 0x07C
+AMIIBO_CHAR_SERIES_ENTRY("Splatoon")		// 0x080
+
+// 0x084 - 0x098
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x084
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x090
+
+AMIIBO_CHAR_SERIES_ENTRY("Mario Sports Superstars")	// 0x09C
+
+// 0x0A0-0x18C
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x0A0
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x0B0
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x0C0
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x0D0
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x0E0
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x0F0
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x100
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x110
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x120
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x130
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x140
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x150
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x160
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x170
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x180
+
+// Pokémon (0x190 - 0x1BC)
+// NOTE: MSVC prior to 2015 doesn't support UTF-8 string constants.
+AMIIBO_CHAR_SERIES_ENTRY("Pok\xC3\xA9mon")	// 0x190
+AMIIBO_CHAR_SERIES_ENTRY("Pok\xC3\xA9mon")	// 0x194
+AMIIBO_CHAR_SERIES_ENTRY("Pok\xC3\xA9mon")	// 0x198
+AMIIBO_CHAR_SERIES_ENTRY("Pok\xC3\xA9mon")	// 0x19C
+AMIIBO_CHAR_SERIES_ENTRY("Pok\xC3\xA9mon")	// 0x1A0
+AMIIBO_CHAR_SERIES_ENTRY("Pok\xC3\xA9mon")	// 0x1A4
+AMIIBO_CHAR_SERIES_ENTRY("Pok\xC3\xA9mon")	// 0x1A8
+AMIIBO_CHAR_SERIES_ENTRY("Pok\xC3\xA9mon")	// 0x1AC
+AMIIBO_CHAR_SERIES_ENTRY("Pok\xC3\xA9mon")	// 0x1B0
+AMIIBO_CHAR_SERIES_ENTRY("Pok\xC3\xA9mon")	// 0x1B4
+AMIIBO_CHAR_SERIES_ENTRY("Pok\xC3\xA9mon")	// 0x1B8
+AMIIBO_CHAR_SERIES_ENTRY("Pok\xC3\xA9mon")	// 0x1BC
+
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x1C0
+
+AMIIBO_CHAR_SERIES_ENTRY("Special Pok\xC3\xA9mon")	// 0x1D0
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x1D4
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x1E0
+AMIIBO_CHAR_SERIES_ENTRY("Kirby")		// 0x1F0
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x1F4
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x200
+AMIIBO_CHAR_SERIES_ENTRY("Fire Emblem")		// 0x210
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x214
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x220
+AMIIBO_CHAR_SERIES_ENTRY("Xenoblade")		// 0x224
+AMIIBO_CHAR_SERIES_ENTRY("Earthbound")		// 0x228
+AMIIBO_CHAR_SERIES_ENTRY("Chibi-Robo!")		// 0x22C
+
+// 0x230 - 0x31C
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x230
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x240
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x250
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x260
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x270
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x280
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x290
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x2A0
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x2B0
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x2C0
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x2D0
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x2E0
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x2F0
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x300
+AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY() AMIIBO_CHAR_SERIES_NULL_ENTRY()	// 0x310
+
+AMIIBO_CHAR_SERIES_ENTRY("Sonic the Hedgehog")	// 0x320
+AMIIBO_CHAR_SERIES_ENTRY("Bayonetta")		// 0x324
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x328
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x32C
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x330
+AMIIBO_CHAR_SERIES_ENTRY("Pac-Man")		// 0x334
+AMIIBO_CHAR_SERIES_ENTRY("Dark Souls")		// 0x338
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x33C
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x340
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x344
+AMIIBO_CHAR_SERIES_ENTRY("Mega Man")		// 0x348
+AMIIBO_CHAR_SERIES_ENTRY("Street Fighter")	// 0x34C
+AMIIBO_CHAR_SERIES_ENTRY("Monster Hunter")	// 0x350
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x354
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x358
+AMIIBO_CHAR_SERIES_ENTRY("Shovel Knight")	// 0x35C
+AMIIBO_CHAR_SERIES_ENTRY("Final Fantasy")	// 0x360
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x364
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x368
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x36C
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x370
+AMIIBO_CHAR_SERIES_ENTRY("Cereal")		// 0x374
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x378
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x37C
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x380
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x384
+AMIIBO_CHAR_SERIES_NULL_ENTRY()			// 0x388
+AMIIBO_CHAR_SERIES_ENTRY("Diablo")		// 0x38C
+
+// Character variants.
+
+AMIIBO_CHAR_VARIANTS_BEGIN(smb_mario)
+AMIIBO_CHAR_VARIANT(0x00, "Mario")
+AMIIBO_CHAR_VARIANT(0x01, "Dr. Mario")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(smb_yoshi)
+AMIIBO_CHAR_VARIANT(0x00, "Yoshi")
+AMIIBO_CHAR_VARIANT(0x01, "Yarn Yoshi")	// Color variant is in Page 22, amiibo ID.
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(smb_rosalina)
+AMIIBO_CHAR_VARIANT(0x00, "Rosalina")
+AMIIBO_CHAR_VARIANT(0x01, "Rosalina & Luma")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(smb_bowser)
+AMIIBO_CHAR_VARIANT(0x00, "Bowser")
+
+// Skylanders
+// NOTE: Cannot distinguish between regular and dark
+// variants in amiibo mode.
+AMIIBO_CHAR_VARIANT(0xFF, "Hammer Slam Bowser")
+//AMIIBO_CHAR_VARIANT(0xFF, "Dark Hammer Slam Bowser")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(smb_donkey_kong)
+AMIIBO_CHAR_VARIANT(0x00, "Donkey Kong")
+
+// Skylanders
+// NOTE: Cannot distinguish between regular and dark
+// variants in amiibo mode.
+AMIIBO_CHAR_VARIANT(0xFF, "Turbo Charge Donkey Kong")
+//AMIIBO_CHAR_VARIANT(0xFF, "Dark Turbo Charge Donkey Kong")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(yoshi_poochy)
+AMIIBO_CHAR_VARIANT_NULL(0x00)	// TODO
+AMIIBO_CHAR_VARIANT(0x01, "Yarn Poochy")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(tloz_link)
+AMIIBO_CHAR_VARIANT(0x00, "Link")
+AMIIBO_CHAR_VARIANT(0x01, "Toon Link")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(tloz_zelda)
+AMIIBO_CHAR_VARIANT(0x00, "Zelda")
+AMIIBO_CHAR_VARIANT(0x01, "Sheik")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(tloz_ganondorf)
+AMIIBO_CHAR_VARIANT_NULL(0x00)	// TODO
+AMIIBO_CHAR_VARIANT(0x01, "Ganondorf")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(metroid_samus)
+AMIIBO_CHAR_VARIANT(0x00, "Samus")
+AMIIBO_CHAR_VARIANT(0x01, "Zero Suit Samus")
+AMIIBO_CHAR_VARIANT(0x02, "Samus Aran")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(pikmin_olimar)
+AMIIBO_CHAR_VARIANT_NULL(0x00)	// TODO
+AMIIBO_CHAR_VARIANT(0x01, "Olimar")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(mii)
+AMIIBO_CHAR_VARIANT(0x00, "Mii Brawler")
+AMIIBO_CHAR_VARIANT(0x01, "Mii Swordfighter")
+AMIIBO_CHAR_VARIANT(0x02, "Mii Gunner")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(splatoon_inkling)
+AMIIBO_CHAR_VARIANT(0x00, "Inkling")	// NOTE: Not actually assigned.
+AMIIBO_CHAR_VARIANT(0x01, "Inkling Girl")
+AMIIBO_CHAR_VARIANT(0x02, "Inkling Boy")
+AMIIBO_CHAR_VARIANT(0x03, "Inkling Squid")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(splatoon_octoling)
+AMIIBO_CHAR_VARIANT(0x00, "Octoling")	// NOTE: Not actually assigned.
+AMIIBO_CHAR_VARIANT(0x01, "Octoling Girl")
+AMIIBO_CHAR_VARIANT(0x02, "Octoling Boy")
+AMIIBO_CHAR_VARIANT(0x03, "Octoling Octopus")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(fe_corrin)
+AMIIBO_CHAR_VARIANT(0x00, "Corrin")
+AMIIBO_CHAR_VARIANT(0x01, "Corrin (Player 2")
+AMIIBO_CHAR_VARIANTS_END()
+
+// Mario Sports Superstars
+// Each character has five variants (0x01-0x05).
+// NOTE: Variant 0x00 is not actually assigned.
+// (See AMIIBO_MSS_VARIANTS() in AmiiboData.cpp.)
+
+AMIIBO_CHAR_VARIANTS_MSS(mario, "Mario")
+AMIIBO_CHAR_VARIANTS_MSS(luigi, "Luigi")
+AMIIBO_CHAR_VARIANTS_MSS(peach, "Peach")
+AMIIBO_CHAR_VARIANTS_MSS(daisy, "Daisy")
+AMIIBO_CHAR_VARIANTS_MSS(yoshi, "Yoshi")
+AMIIBO_CHAR_VARIANTS_MSS(wario, "Wario")
+AMIIBO_CHAR_VARIANTS_MSS(waluigi, "Waluigi")
+AMIIBO_CHAR_VARIANTS_MSS(donkey_kong, "Donkey Kong")
+AMIIBO_CHAR_VARIANTS_MSS(diddy_kong, "Diddy Kong")
+AMIIBO_CHAR_VARIANTS_MSS(bowser, "Bowser")
+AMIIBO_CHAR_VARIANTS_MSS(bowser_jr, "Bowser Jr.")
+AMIIBO_CHAR_VARIANTS_MSS(boo, "Boo")
+AMIIBO_CHAR_VARIANTS_MSS(baby_mario, "Baby Mario")
+AMIIBO_CHAR_VARIANTS_MSS(baby_luigi, "Baby Luigi")
+AMIIBO_CHAR_VARIANTS_MSS(birdo, "Birdo")
+AMIIBO_CHAR_VARIANTS_MSS(rosalina, "Rosalina")
+AMIIBO_CHAR_VARIANTS_MSS(metal_mario, "Metal Mario")
+AMIIBO_CHAR_VARIANTS_MSS(pink_gold_peach, "Pink Gold Peach")
+
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_isabelle)
+AMIIBO_CHAR_VARIANT(0x00, "Isabelle (Summer Outfit)")
+AMIIBO_CHAR_VARIANT(0x01, "Isabelle (Autumn Outfit)")
+// TODO: How are these ones different?
+AMIIBO_CHAR_VARIANT(0x03, "Isabelle (Series 4)")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_kk_slider)
+AMIIBO_CHAR_VARIANT(0x00, "K.K. Slider")
+AMIIBO_CHAR_VARIANT(0x01, "DJ K.K.")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_tom_nook)
+AMIIBO_CHAR_VARIANT(0x00, "Tom Nook")
+// TODO: Variant description.
+AMIIBO_CHAR_VARIANT(0x01, "Tom Nook (Series 3)")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_timmy)
+// TODO: Variant descriptions.
+AMIIBO_CHAR_VARIANT(0x00, "Timmy")
+AMIIBO_CHAR_VARIANT(0x02, "Timmy (Series 3)")
+AMIIBO_CHAR_VARIANT(0x04, "Timmy (Series 4)")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_tommy)
+// TODO: Variant descriptions.
+AMIIBO_CHAR_VARIANT(0x01, "Tommy (Series 2)")
+AMIIBO_CHAR_VARIANT(0x03, "Tommy (Series 4)")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_digby)
+AMIIBO_CHAR_VARIANT(0x00, "Digby")
+// TODO: Variant description.
+AMIIBO_CHAR_VARIANT(0x01, "Digby (Series 3)")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_resetti)
+AMIIBO_CHAR_VARIANT(0x00, "Resetti")
+// TODO: Variant description.
+AMIIBO_CHAR_VARIANT(0x01, "Resetti (Series 4)")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_don_resetti)
+// TODO: Variant descriptions.
+AMIIBO_CHAR_VARIANT(0x00, "Don Resetti (Series 2)")
+AMIIBO_CHAR_VARIANT(0x01, "Don Resetti (Series 3)")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_redd)
+AMIIBO_CHAR_VARIANT(0x00, "Redd")
+// TODO: Variant description.
+AMIIBO_CHAR_VARIANT(0x01, "Redd (Series 4)")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_dr_shrunk)
+AMIIBO_CHAR_VARIANT(0x00, "Dr. Shrunk")
+AMIIBO_CHAR_VARIANT(0x01, "Shrunk")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_lottie)
+AMIIBO_CHAR_VARIANT(0x00, "Lottie")
+// TODO: Variant description.
+AMIIBO_CHAR_VARIANT(0x01, "Lottie (Series 4)")
+AMIIBO_CHAR_VARIANTS_END()
+
+// Animal Crossing x Sanrio all have variant type 0x01.
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_marty)
+AMIIBO_CHAR_VARIANT(0x01, "Marty (Sanrio)")
+AMIIBO_CHAR_VARIANTS_END()
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_chelsea)
+AMIIBO_CHAR_VARIANT(0x01, "Chelsea (Sanrio)")
+AMIIBO_CHAR_VARIANTS_END()
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_chai)
+AMIIBO_CHAR_VARIANT(0x01, "Chai (Sanrio)")
+AMIIBO_CHAR_VARIANTS_END()
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_rilla)
+AMIIBO_CHAR_VARIANT(0x01, "Rilla (Sanrio)")
+AMIIBO_CHAR_VARIANTS_END()
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_toby)
+AMIIBO_CHAR_VARIANT(0x01, "Toby (Sanrio)")
+AMIIBO_CHAR_VARIANTS_END()
+AMIIBO_CHAR_VARIANTS_BEGIN(ac_etoile)
+AMIIBO_CHAR_VARIANT(0x01, "\xC3\x89toile")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(mh_rathalos)
+AMIIBO_CHAR_VARIANT(0x00, "One-Eyed Rathalos and Rider")	// NOTE: Not actually assigned.
+AMIIBO_CHAR_VARIANT(0x01, "One-Eyed Rathalos and Rider (Male)")
+AMIIBO_CHAR_VARIANT(0x02, "One-Eyed Rathalos and Rider (Female)")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(mh_rathian_cheval)
+AMIIBO_CHAR_VARIANT(0x00, "Rathian and Cheval")	// NOTE: Not actually assigned.
+AMIIBO_CHAR_VARIANT(0x01, "Rathian and Cheval")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(mh_barioth_ayuria)
+AMIIBO_CHAR_VARIANT(0x00, "Barioth and Ayuria")	// NOTE: Not actually assigned.
+AMIIBO_CHAR_VARIANT(0x01, "Barioth and Ayuria")
+AMIIBO_CHAR_VARIANTS_END()
+
+AMIIBO_CHAR_VARIANTS_BEGIN(mh_qurupeco_dan)
+AMIIBO_CHAR_VARIANT(0x00, "Qurupeco and Dan")	// NOTE: Not actually assigned.
+AMIIBO_CHAR_VARIANT(0x01, "Qurupeco and Dan")
+AMIIBO_CHAR_VARIANTS_END()
+
+// Cereal
+AMIIBO_CHAR_VARIANTS_BEGIN(cereal_smb)
+AMIIBO_CHAR_VARIANT(0x00, "Super Mario Cereal")	// NOTE: Not actually assigned.
+AMIIBO_CHAR_VARIANT(0x01, "Super Mario Cereal")
+AMIIBO_CHAR_VARIANTS_END()
+
+// Character IDs.
+
+// Super Mario Bros. (character series = 0x000)
+AMIIBO_CHAR_ID_VAR(0x0000, "Mario", smb_mario_variants)
+AMIIBO_CHAR_ID_ONE(0x0001, "Luigi")
+AMIIBO_CHAR_ID_ONE(0x0002, "Peach")
+AMIIBO_CHAR_ID_VAR(0x0003, "Yoshi", smb_yoshi_variants)
+AMIIBO_CHAR_ID_VAR(0x0004, "Rosalina", smb_rosalina_variants)
+AMIIBO_CHAR_ID_VAR(0x0005, "Bowser", smb_bowser_variants)
+AMIIBO_CHAR_ID_ONE(0x0006, "Bowser Jr.")
+AMIIBO_CHAR_ID_ONE(0x0007, "Wario")
+AMIIBO_CHAR_ID_VAR(0x0008, "Donkey Kong", smb_donkey_kong_variants)
+AMIIBO_CHAR_ID_ONE(0x0009, "Diddy Kong")
+AMIIBO_CHAR_ID_ONE(0x000A, "Toad")
+AMIIBO_CHAR_ID_ONE(0x0013, "Daisy")
+AMIIBO_CHAR_ID_ONE(0x0014, "Waluigi")
+AMIIBO_CHAR_ID_ONE(0x0015, "Goomba")
+AMIIBO_CHAR_ID_ONE(0x0017, "Boo")
+AMIIBO_CHAR_ID_ONE(0x0023, "Koopa Troopa")
+
+// Yoshi (character series = 0x008)
+AMIIBO_CHAR_ID_VAR(0x0080, "Poochy", yoshi_poochy_variants)
+
+// The Legend of Zelda (character series = 0x010)
+AMIIBO_CHAR_ID_VAR(0x0100, "Link", tloz_link_variants)
+AMIIBO_CHAR_ID_VAR(0x0101, "Zelda", tloz_zelda_variants)
+AMIIBO_CHAR_ID_VAR(0x0102, "Ganondorf", tloz_ganondorf_variants)
+AMIIBO_CHAR_ID_ONE(0x0103, "Midna & Wolf Link")
+AMIIBO_CHAR_ID_ONE(0x0105, "Daruk")
+AMIIBO_CHAR_ID_ONE(0x0106, "Urbosa")
+AMIIBO_CHAR_ID_ONE(0x0107, "Mipha")
+AMIIBO_CHAR_ID_ONE(0x0108, "Revali")
+// The Legend of Zelda (character series = 0x014)
+AMIIBO_CHAR_ID_ONE(0x0141, "Bokoblin")
+
+// Animal Crossing (character series = 0x018)
+AMIIBO_CHAR_ID_ONE(0x0180, "Villager")
+AMIIBO_CHAR_ID_VAR(0x0181, "Isabelle", ac_isabelle_variants)
+AMIIBO_CHAR_ID_VAR(0x0182, "K.K. Slider", ac_kk_slider_variants)
+AMIIBO_CHAR_ID_VAR(0x0183, "Tom Nook", ac_tom_nook_variants)
+AMIIBO_CHAR_ID_ONE(0x0184, "Timmy & Tommy")
+AMIIBO_CHAR_ID_VAR(0x0185, "Timmy", ac_timmy_variants)
+AMIIBO_CHAR_ID_VAR(0x0186, "Tommy", ac_tommy_variants)
+AMIIBO_CHAR_ID_ONE(0x0187, "Sable")
+AMIIBO_CHAR_ID_ONE(0x0188, "Mabel")
+AMIIBO_CHAR_ID_ONE(0x0189, "Labelle")
+AMIIBO_CHAR_ID_ONE(0x018A, "Reese")
+AMIIBO_CHAR_ID_ONE(0x018B, "Cyrus")
+AMIIBO_CHAR_ID_VAR(0x018C, "Digby", ac_digby_variants)
+AMIIBO_CHAR_ID_ONE(0x018D, "Rover")
+AMIIBO_CHAR_ID_VAR(0x018E, "Resetti", ac_resetti_variants)
+AMIIBO_CHAR_ID_VAR(0x018F, "Don Resetti", ac_don_resetti_variants)
+AMIIBO_CHAR_ID_ONE(0x0190, "Brewster")
+AMIIBO_CHAR_ID_ONE(0x0191, "Harriet")
+AMIIBO_CHAR_ID_ONE(0x0192, "Blathers")
+AMIIBO_CHAR_ID_ONE(0x0193, "Celeste")
+AMIIBO_CHAR_ID_ONE(0x0194, "Kicks")
+AMIIBO_CHAR_ID_ONE(0x0195, "Porter")
+AMIIBO_CHAR_ID_ONE(0x0196, "Kapp'n")
+AMIIBO_CHAR_ID_ONE(0x0197, "Leilani")
+AMIIBO_CHAR_ID_ONE(0x0198, "Lelia")
+AMIIBO_CHAR_ID_ONE(0x0199, "Grams")
+AMIIBO_CHAR_ID_ONE(0x019A, "Chip")
+AMIIBO_CHAR_ID_ONE(0x019B, "Nat")
+AMIIBO_CHAR_ID_ONE(0x019C, "Phineas")
+AMIIBO_CHAR_ID_ONE(0x019D, "Copper")
+AMIIBO_CHAR_ID_ONE(0x019E, "Booker")
+AMIIBO_CHAR_ID_ONE(0x019F, "Pete")
+AMIIBO_CHAR_ID_ONE(0x01A0, "Pelly")
+AMIIBO_CHAR_ID_ONE(0x01A1, "Phyllis")
+AMIIBO_CHAR_ID_ONE(0x01A2, "Gulliver")
+AMIIBO_CHAR_ID_ONE(0x01A3, "Joan")
+AMIIBO_CHAR_ID_ONE(0x01A4, "Pascal")
+AMIIBO_CHAR_ID_ONE(0x01A5, "Katrina")
+AMIIBO_CHAR_ID_ONE(0x01A6, "Sahara")
+AMIIBO_CHAR_ID_ONE(0x01A7, "Wendell")
+AMIIBO_CHAR_ID_VAR(0x01A8, "Redd", ac_redd_variants)
+AMIIBO_CHAR_ID_ONE(0x01A9, "Gracie")
+AMIIBO_CHAR_ID_ONE(0x01AA, "Lyle")
+AMIIBO_CHAR_ID_ONE(0x01AB, "Pave")
+AMIIBO_CHAR_ID_ONE(0x01AC, "Zipper")
+AMIIBO_CHAR_ID_ONE(0x01AD, "Jack")
+AMIIBO_CHAR_ID_ONE(0x01AE, "Franklin")
+AMIIBO_CHAR_ID_ONE(0x01AF, "Jingle")
+AMIIBO_CHAR_ID_ONE(0x01B0, "Tortimer")
+AMIIBO_CHAR_ID_VAR(0x01B1, "Dr. Shrunk", ac_dr_shrunk_variants)
+AMIIBO_CHAR_ID_ONE(0x01B3, "Blanca")
+AMIIBO_CHAR_ID_ONE(0x01B4, "Leif")
+AMIIBO_CHAR_ID_ONE(0x01B5, "Luna")
+AMIIBO_CHAR_ID_ONE(0x01B5, "Luna")
+AMIIBO_CHAR_ID_ONE(0x01B6, "Katie")
+AMIIBO_CHAR_ID_VAR(0x01C1, "Lottie", ac_lottie_variants)
+AMIIBO_CHAR_ID_ONE(0x0200, "Cyrano")
+AMIIBO_CHAR_ID_ONE(0x0201, "Antonio")
+AMIIBO_CHAR_ID_ONE(0x0202, "Pango")
+AMIIBO_CHAR_ID_ONE(0x0203, "Anabelle")
+AMIIBO_CHAR_ID_ONE(0x0206, "Snooty")
+AMIIBO_CHAR_ID_ONE(0x0208, "Annalisa")
+AMIIBO_CHAR_ID_ONE(0x0209, "Olaf")
+AMIIBO_CHAR_ID_ONE(0x0214, "Teddy")
+AMIIBO_CHAR_ID_ONE(0x0215, "Pinky")
+AMIIBO_CHAR_ID_ONE(0x0216, "Curt")
+AMIIBO_CHAR_ID_ONE(0x0217, "Chow")
+AMIIBO_CHAR_ID_ONE(0x0219, "Nate")
+AMIIBO_CHAR_ID_ONE(0x021A, "Groucho")
+AMIIBO_CHAR_ID_ONE(0x021B, "Tutu")
+AMIIBO_CHAR_ID_ONE(0x021C, "Ursala")
+AMIIBO_CHAR_ID_ONE(0x021D, "Grizzly")
+AMIIBO_CHAR_ID_ONE(0x021E, "Paula")
+AMIIBO_CHAR_ID_ONE(0x021F, "Ike")
+AMIIBO_CHAR_ID_ONE(0x0220, "Charlise")
+AMIIBO_CHAR_ID_ONE(0x0221, "Beardo")
+AMIIBO_CHAR_ID_ONE(0x0222, "Klaus")
+AMIIBO_CHAR_ID_ONE(0x022D, "Jay")
+AMIIBO_CHAR_ID_ONE(0x022E, "Robin")
+AMIIBO_CHAR_ID_ONE(0x022F, "Anchovy")
+AMIIBO_CHAR_ID_ONE(0x0230, "Twiggy")
+AMIIBO_CHAR_ID_ONE(0x0231, "Jitters")
+AMIIBO_CHAR_ID_ONE(0x0232, "Piper")
+AMIIBO_CHAR_ID_ONE(0x0233, "Admiral")
+AMIIBO_CHAR_ID_ONE(0x0235, "Midge")
+AMIIBO_CHAR_ID_ONE(0x0238, "Jacob")
+AMIIBO_CHAR_ID_ONE(0x023C, "Lucha")
+AMIIBO_CHAR_ID_ONE(0x023D, "Jacques")
+AMIIBO_CHAR_ID_ONE(0x023E, "Peck")
+AMIIBO_CHAR_ID_ONE(0x023F, "Sparro")
+AMIIBO_CHAR_ID_ONE(0x024A, "Angus")
+AMIIBO_CHAR_ID_ONE(0x024B, "Rodeo")
+AMIIBO_CHAR_ID_ONE(0x024D, "Stu")
+AMIIBO_CHAR_ID_ONE(0x024F, "T-Bone")
+AMIIBO_CHAR_ID_ONE(0x024F, "T-Bone")
+AMIIBO_CHAR_ID_ONE(0x0251, "Coach")
+AMIIBO_CHAR_ID_ONE(0x0252, "Vic")
+AMIIBO_CHAR_ID_ONE(0x025D, "Bob")
+AMIIBO_CHAR_ID_ONE(0x025E, "Mitzi")
+AMIIBO_CHAR_ID_ONE(0x025F, "Rosie")	// amiibo Festival variant is in Page 22, amiibo series.
+AMIIBO_CHAR_ID_ONE(0x0260, "Olivia")
+AMIIBO_CHAR_ID_ONE(0x0261, "Kiki")
+AMIIBO_CHAR_ID_ONE(0x0262, "Tangy")
+AMIIBO_CHAR_ID_ONE(0x0263, "Punchy")
+AMIIBO_CHAR_ID_ONE(0x0264, "Purrl")
+AMIIBO_CHAR_ID_ONE(0x0265, "Moe")
+AMIIBO_CHAR_ID_ONE(0x0266, "Kabuki")
+AMIIBO_CHAR_ID_ONE(0x0267, "Kid Cat")
+AMIIBO_CHAR_ID_ONE(0x0268, "Monique")
+AMIIBO_CHAR_ID_ONE(0x0269, "Tabby")
+AMIIBO_CHAR_ID_ONE(0x026A, "Stinky")
+AMIIBO_CHAR_ID_ONE(0x026B, "Kitty")
+AMIIBO_CHAR_ID_ONE(0x026C, "Tom")
+AMIIBO_CHAR_ID_ONE(0x026D, "Merry")
+AMIIBO_CHAR_ID_ONE(0x026E, "Felicity")
+AMIIBO_CHAR_ID_ONE(0x026F, "Lolly")
+AMIIBO_CHAR_ID_ONE(0x0270, "Ankha")
+AMIIBO_CHAR_ID_ONE(0x0271, "Rudy")
+AMIIBO_CHAR_ID_ONE(0x0272, "Katt")
+AMIIBO_CHAR_ID_ONE(0x027D, "Bluebear")
+AMIIBO_CHAR_ID_ONE(0x027E, "Maple")
+AMIIBO_CHAR_ID_ONE(0x027F, "Poncho")
+AMIIBO_CHAR_ID_ONE(0x0280, "Pudge")
+AMIIBO_CHAR_ID_ONE(0x0281, "Kody")
+AMIIBO_CHAR_ID_ONE(0x0282, "Stitches")	// amiibo Festival variant is in Page 22, amiibo series.
+AMIIBO_CHAR_ID_ONE(0x0283, "Vladimir")
+AMIIBO_CHAR_ID_ONE(0x0284, "Murphy")
+AMIIBO_CHAR_ID_ONE(0x0286, "Olive")
+AMIIBO_CHAR_ID_ONE(0x0287, "Cheri")
+AMIIBO_CHAR_ID_ONE(0x028A, "June")
+AMIIBO_CHAR_ID_ONE(0x028B, "Pekoe")
+AMIIBO_CHAR_ID_ONE(0x028C, "Chester")
+AMIIBO_CHAR_ID_ONE(0x028D, "Barold")
+AMIIBO_CHAR_ID_ONE(0x028E, "Tammy")
+AMIIBO_CHAR_ID_VAR(0x028F, "Marty", ac_marty_variants)
+AMIIBO_CHAR_ID_ONE(0x0299, "Goose")
+AMIIBO_CHAR_ID_ONE(0x029A, "Benedict")
+AMIIBO_CHAR_ID_ONE(0x029B, "Egbert")
+AMIIBO_CHAR_ID_ONE(0x029E, "Ava")
+AMIIBO_CHAR_ID_ONE(0x02A2, "Becky")
+AMIIBO_CHAR_ID_ONE(0x02A3, "Plucky")
+AMIIBO_CHAR_ID_ONE(0x02A4, "Knox")
+AMIIBO_CHAR_ID_ONE(0x02A5, "Broffina")
+AMIIBO_CHAR_ID_ONE(0x02A6, "Ken")
+AMIIBO_CHAR_ID_ONE(0x02B1, "Patty")
+AMIIBO_CHAR_ID_ONE(0x02B2, "Tipper")
+AMIIBO_CHAR_ID_ONE(0x02B7, "Norma")
+AMIIBO_CHAR_ID_ONE(0x02B8, "Naomi")
+AMIIBO_CHAR_ID_ONE(0x02C3, "Alfonso")
+AMIIBO_CHAR_ID_ONE(0x02C4, "Alli")
+AMIIBO_CHAR_ID_ONE(0x02C5, "Boots")
+AMIIBO_CHAR_ID_ONE(0x02C7, "Del")
+AMIIBO_CHAR_ID_ONE(0x02C9, "Sly")
+AMIIBO_CHAR_ID_ONE(0x02CA, "Gayle")
+AMIIBO_CHAR_ID_ONE(0x02CB, "Drago")
+AMIIBO_CHAR_ID_ONE(0x02D6, "Fauna")
+AMIIBO_CHAR_ID_ONE(0x02D7, "Bam")
+AMIIBO_CHAR_ID_ONE(0x02D8, "Zell")
+AMIIBO_CHAR_ID_ONE(0x02D9, "Bruce")
+AMIIBO_CHAR_ID_ONE(0x02DA, "Deirdre")
+AMIIBO_CHAR_ID_ONE(0x02DB, "Lopez")
+AMIIBO_CHAR_ID_ONE(0x02DC, "Fuchsia")
+AMIIBO_CHAR_ID_ONE(0x02DD, "Beau")
+AMIIBO_CHAR_ID_ONE(0x02DE, "Diana")
+AMIIBO_CHAR_ID_ONE(0x02DF, "Erik")
+AMIIBO_CHAR_ID_VAR(0x02E0, "Chelsea", ac_chelsea_variants)
+AMIIBO_CHAR_ID_ONE(0x02EA, "Goldie")	// amiibo Festival variant is in Page 22, amiibo series.
+AMIIBO_CHAR_ID_ONE(0x02EB, "Butch")
+AMIIBO_CHAR_ID_ONE(0x02EC, "Lucky")
+AMIIBO_CHAR_ID_ONE(0x02ED, "Biskit")
+AMIIBO_CHAR_ID_ONE(0x02EE, "Bones")
+AMIIBO_CHAR_ID_ONE(0x02EF, "Portia")
+AMIIBO_CHAR_ID_ONE(0x02F0, "Walker")
+AMIIBO_CHAR_ID_ONE(0x02F1, "Daisy")
+AMIIBO_CHAR_ID_ONE(0x02F2, "Cookie")
+AMIIBO_CHAR_ID_ONE(0x02F3, "Maddie")
+AMIIBO_CHAR_ID_ONE(0x02F4, "Bea")
+AMIIBO_CHAR_ID_ONE(0x02F8, "Mac")
+AMIIBO_CHAR_ID_ONE(0x02F9, "Marcel")
+AMIIBO_CHAR_ID_ONE(0x02FA, "Benjamin")
+AMIIBO_CHAR_ID_ONE(0x02FB, "Cherry")
+AMIIBO_CHAR_ID_ONE(0x02FC, "Shep")
+AMIIBO_CHAR_ID_ONE(0x0307, "Bill")
+AMIIBO_CHAR_ID_ONE(0x0307, "Bill")
+AMIIBO_CHAR_ID_ONE(0x0308, "Joey")
+AMIIBO_CHAR_ID_ONE(0x0309, "Pate")
+AMIIBO_CHAR_ID_ONE(0x030A, "Maelle")
+AMIIBO_CHAR_ID_ONE(0x030B, "Deena")
+AMIIBO_CHAR_ID_ONE(0x030C, "Pompom")
+AMIIBO_CHAR_ID_ONE(0x030D, "Mallary")
+AMIIBO_CHAR_ID_ONE(0x030E, "Freckles")
+AMIIBO_CHAR_ID_ONE(0x030F, "Derwin")
+AMIIBO_CHAR_ID_ONE(0x0310, "Drake")
+AMIIBO_CHAR_ID_ONE(0x0311, "Scoot")
+AMIIBO_CHAR_ID_ONE(0x0312, "Weber")
+AMIIBO_CHAR_ID_ONE(0x0313, "Miranda")
+AMIIBO_CHAR_ID_ONE(0x0314, "Ketchup")
+AMIIBO_CHAR_ID_ONE(0x0316, "Gloria")
+AMIIBO_CHAR_ID_ONE(0x0317, "Molly")
+AMIIBO_CHAR_ID_ONE(0x0318, "Quillson")
+AMIIBO_CHAR_ID_ONE(0x0323, "Opal")
+AMIIBO_CHAR_ID_ONE(0x0324, "Dizzy")
+AMIIBO_CHAR_ID_ONE(0x0325, "Big Top")
+AMIIBO_CHAR_ID_ONE(0x0326, "Eloise")
+AMIIBO_CHAR_ID_ONE(0x0327, "Margie")
+AMIIBO_CHAR_ID_ONE(0x0328, "Paolo")
+AMIIBO_CHAR_ID_ONE(0x0329, "Axel")
+AMIIBO_CHAR_ID_ONE(0x032A, "Ellie")
+AMIIBO_CHAR_ID_ONE(0x032C, "Tucker")
+AMIIBO_CHAR_ID_ONE(0x032D, "Tia")
+AMIIBO_CHAR_ID_VAR(0x032E, "Chai", ac_chai_variants)
+AMIIBO_CHAR_ID_ONE(0x0338, "Lily")
+AMIIBO_CHAR_ID_ONE(0x0339, "Ribbot")
+AMIIBO_CHAR_ID_ONE(0x033A, "Frobert")
+AMIIBO_CHAR_ID_ONE(0x033B, "Camofrog")
+AMIIBO_CHAR_ID_ONE(0x033C, "Drift")
+AMIIBO_CHAR_ID_ONE(0x033D, "Wart Jr.")
+AMIIBO_CHAR_ID_ONE(0x033E, "Puddles")
+AMIIBO_CHAR_ID_ONE(0x033F, "Jeremiah")
+AMIIBO_CHAR_ID_ONE(0x0341, "Tad")
+AMIIBO_CHAR_ID_ONE(0x0342, "Cousteau")
+AMIIBO_CHAR_ID_ONE(0x0343, "Huck")
+AMIIBO_CHAR_ID_ONE(0x0344, "Prince")
+AMIIBO_CHAR_ID_ONE(0x0345, "Jambette")
+AMIIBO_CHAR_ID_ONE(0x0347, "Raddle")
+AMIIBO_CHAR_ID_ONE(0x0348, "Gigi")
+AMIIBO_CHAR_ID_ONE(0x0349, "Croque")
+AMIIBO_CHAR_ID_ONE(0x034A, "Diva")
+AMIIBO_CHAR_ID_ONE(0x034B, "Henry")
+AMIIBO_CHAR_ID_ONE(0x0356, "Chevre")
+AMIIBO_CHAR_ID_ONE(0x0357, "Nan")
+AMIIBO_CHAR_ID_ONE(0x0358, "Billy")
+AMIIBO_CHAR_ID_ONE(0x035A, "Gruff")
+AMIIBO_CHAR_ID_ONE(0x035C, "Velma")
+AMIIBO_CHAR_ID_ONE(0x035D, "Kidd")
+AMIIBO_CHAR_ID_ONE(0x035E, "Pashmina")
+AMIIBO_CHAR_ID_ONE(0x0369, "Cesar")
+AMIIBO_CHAR_ID_ONE(0x036A, "Peewee")
+AMIIBO_CHAR_ID_ONE(0x036B, "Boone")
+AMIIBO_CHAR_ID_ONE(0x036D, "Louie")
+AMIIBO_CHAR_ID_ONE(0x036E, "Boyd")
+AMIIBO_CHAR_ID_ONE(0x0370, "Violet")
+AMIIBO_CHAR_ID_ONE(0x0371, "Al")
+AMIIBO_CHAR_ID_ONE(0x0372, "Rocket")
+AMIIBO_CHAR_ID_ONE(0x0373, "Hans")
+AMIIBO_CHAR_ID_VAR(0x0374, "Rilla", ac_rilla_variants)
+AMIIBO_CHAR_ID_ONE(0x037E, "Hamlet")
+AMIIBO_CHAR_ID_ONE(0x037F, "Apple")
+AMIIBO_CHAR_ID_ONE(0x0380, "Graham")
+AMIIBO_CHAR_ID_ONE(0x0381, "Rodney")
+AMIIBO_CHAR_ID_ONE(0x0382, "Soleil")
+AMIIBO_CHAR_ID_ONE(0x0383, "Clay")
+AMIIBO_CHAR_ID_ONE(0x0384, "Flurry")
+AMIIBO_CHAR_ID_ONE(0x0385, "Hamphrey")
+AMIIBO_CHAR_ID_ONE(0x0390, "Rocco")
+AMIIBO_CHAR_ID_ONE(0x0392, "Bubbles")
+AMIIBO_CHAR_ID_ONE(0x0393, "Bertha")
+AMIIBO_CHAR_ID_ONE(0x0394, "Biff")
+AMIIBO_CHAR_ID_ONE(0x0395, "Bitty")
+AMIIBO_CHAR_ID_ONE(0x0398, "Harry")
+AMIIBO_CHAR_ID_ONE(0x0399, "Hippeux")
+AMIIBO_CHAR_ID_ONE(0x03A4, "Buck")
+AMIIBO_CHAR_ID_ONE(0x03A5, "Victoria")
+AMIIBO_CHAR_ID_ONE(0x03A6, "Savannah")
+AMIIBO_CHAR_ID_ONE(0x03A7, "Elmer")
+AMIIBO_CHAR_ID_ONE(0x03A8, "Rosco")
+AMIIBO_CHAR_ID_ONE(0x03A9, "Winnie")
+AMIIBO_CHAR_ID_ONE(0x03AA, "Ed")
+AMIIBO_CHAR_ID_ONE(0x03AB, "Cleo")
+AMIIBO_CHAR_ID_ONE(0x03AC, "Peaches")
+AMIIBO_CHAR_ID_ONE(0x03AD, "Annalise")
+AMIIBO_CHAR_ID_ONE(0x03AE, "Clyde")
+AMIIBO_CHAR_ID_ONE(0x03AF, "Colton")
+AMIIBO_CHAR_ID_ONE(0x03B0, "Papi")
+AMIIBO_CHAR_ID_ONE(0x03B1, "Julian")
+AMIIBO_CHAR_ID_ONE(0x03BC, "Yuka")
+AMIIBO_CHAR_ID_ONE(0x03BD, "Alice")
+AMIIBO_CHAR_ID_ONE(0x03BE, "Melba")
+AMIIBO_CHAR_ID_ONE(0x03BF, "Sydney")
+AMIIBO_CHAR_ID_ONE(0x03C0, "Gonzo")
+AMIIBO_CHAR_ID_ONE(0x03C1, "Ozzie")
+AMIIBO_CHAR_ID_ONE(0x03C4, "Canberra")
+AMIIBO_CHAR_ID_ONE(0x03C5, "Lyman")
+AMIIBO_CHAR_ID_ONE(0x03C6, "Eugene")
+AMIIBO_CHAR_ID_ONE(0x03D1, "Kitt")
+AMIIBO_CHAR_ID_ONE(0x03D2, "Mathilda")
+AMIIBO_CHAR_ID_ONE(0x03D3, "Carrie")
+AMIIBO_CHAR_ID_ONE(0x03D6, "Astrid")
+AMIIBO_CHAR_ID_ONE(0x03D7, "Sylvia")
+AMIIBO_CHAR_ID_ONE(0x03D9, "Walt")
+AMIIBO_CHAR_ID_ONE(0x03DA, "Rooney")
+AMIIBO_CHAR_ID_ONE(0x03DB, "Marcie")
+AMIIBO_CHAR_ID_ONE(0x03E6, "Bud")
+AMIIBO_CHAR_ID_ONE(0x03E7, "Elvis")
+AMIIBO_CHAR_ID_ONE(0x03E8, "Rex")
+AMIIBO_CHAR_ID_ONE(0x03EA, "Leopold")
+AMIIBO_CHAR_ID_ONE(0x03EC, "Mott")
+AMIIBO_CHAR_ID_ONE(0x03ED, "Rory")
+AMIIBO_CHAR_ID_ONE(0x03EE, "Lionel")
+AMIIBO_CHAR_ID_ONE(0x03FA, "Nana")
+AMIIBO_CHAR_ID_ONE(0x03FB, "Simon")
+AMIIBO_CHAR_ID_ONE(0x03FC, "Tammi")
+AMIIBO_CHAR_ID_ONE(0x03FD, "Monty")
+AMIIBO_CHAR_ID_ONE(0x03FE, "Elise")
+AMIIBO_CHAR_ID_ONE(0x03FF, "Flip")
+AMIIBO_CHAR_ID_ONE(0x0400, "Shari")
+AMIIBO_CHAR_ID_ONE(0x0401, "Deli")
+AMIIBO_CHAR_ID_ONE(0x040C, "Dora")
+AMIIBO_CHAR_ID_ONE(0x040D, "Limberg")
+AMIIBO_CHAR_ID_ONE(0x040E, "Bella")
+AMIIBO_CHAR_ID_ONE(0x040F, "Bree")
+AMIIBO_CHAR_ID_ONE(0x0410, "Samson")
+AMIIBO_CHAR_ID_ONE(0x0411, "Rod")
+AMIIBO_CHAR_ID_ONE(0x0414, "Candi")
+AMIIBO_CHAR_ID_ONE(0x0415, "Rizzo")
+AMIIBO_CHAR_ID_ONE(0x0416, "Anicotti")
+AMIIBO_CHAR_ID_ONE(0x0418, "Broccolo")
+AMIIBO_CHAR_ID_ONE(0x041A, "Moose")
+AMIIBO_CHAR_ID_ONE(0x041B, "Bettina")
+AMIIBO_CHAR_ID_ONE(0x041C, "Greta")
+AMIIBO_CHAR_ID_ONE(0x041D, "Penelope")
+AMIIBO_CHAR_ID_ONE(0x041E, "Chadder")
+AMIIBO_CHAR_ID_ONE(0x0429, "Octavian")
+AMIIBO_CHAR_ID_ONE(0x042A, "Marina")
+AMIIBO_CHAR_ID_ONE(0x042B, "Zucker")
+AMIIBO_CHAR_ID_ONE(0x0436, "Queenie")
+AMIIBO_CHAR_ID_ONE(0x0437, "Gladys")
+AMIIBO_CHAR_ID_ONE(0x0438, "Sandy")
+AMIIBO_CHAR_ID_ONE(0x0439, "Sprocket")
+AMIIBO_CHAR_ID_ONE(0x043B, "Julia")
+AMIIBO_CHAR_ID_ONE(0x043C, "Cranston")
+AMIIBO_CHAR_ID_ONE(0x043D, "Phil")
+AMIIBO_CHAR_ID_ONE(0x043E, "Blanche")
+AMIIBO_CHAR_ID_ONE(0x043F, "Flora")
+AMIIBO_CHAR_ID_ONE(0x0440, "Phoebe")
+AMIIBO_CHAR_ID_ONE(0x044B, "Apollo")
+AMIIBO_CHAR_ID_ONE(0x044C, "Amelia")
+AMIIBO_CHAR_ID_ONE(0x044D, "Pierce")
+AMIIBO_CHAR_ID_ONE(0x044E, "Buzz")
+AMIIBO_CHAR_ID_ONE(0x0450, "Avery")
+AMIIBO_CHAR_ID_ONE(0x0451, "Frank")
+AMIIBO_CHAR_ID_ONE(0x0452, "Sterling")
+AMIIBO_CHAR_ID_ONE(0x0453, "Keaton")
+AMIIBO_CHAR_ID_ONE(0x0454, "Celia")
+AMIIBO_CHAR_ID_ONE(0x045F, "Aurora")
+AMIIBO_CHAR_ID_ONE(0x0460, "Joan")
+AMIIBO_CHAR_ID_ONE(0x0460, "Roald")
+AMIIBO_CHAR_ID_ONE(0x0461, "Cube")
+AMIIBO_CHAR_ID_ONE(0x0462, "Hopper")
+AMIIBO_CHAR_ID_ONE(0x0463, "Friga")
+AMIIBO_CHAR_ID_ONE(0x0464, "Gwen")
+AMIIBO_CHAR_ID_ONE(0x0465, "Puck")
+AMIIBO_CHAR_ID_ONE(0x0468, "Wade")
+AMIIBO_CHAR_ID_ONE(0x0469, "Boomer")
+AMIIBO_CHAR_ID_ONE(0x046A, "Iggly")
+AMIIBO_CHAR_ID_ONE(0x046B, "Tex")
+AMIIBO_CHAR_ID_ONE(0x046C, "Flo")
+AMIIBO_CHAR_ID_ONE(0x046D, "Sprinkle")
+AMIIBO_CHAR_ID_ONE(0x0478, "Curly")
+AMIIBO_CHAR_ID_ONE(0x0479, "Truffles")
+AMIIBO_CHAR_ID_ONE(0x047A, "Rasher")
+AMIIBO_CHAR_ID_ONE(0x047B, "Hugh")
+AMIIBO_CHAR_ID_ONE(0x047C, "Lucy")
+AMIIBO_CHAR_ID_ONE(0x047D, "Spork/Crackle")
+AMIIBO_CHAR_ID_ONE(0x0480, "Cobb")
+AMIIBO_CHAR_ID_ONE(0x0481, "Boris")
+AMIIBO_CHAR_ID_ONE(0x0482, "Maggie")
+AMIIBO_CHAR_ID_ONE(0x0483, "Peggy")
+AMIIBO_CHAR_ID_ONE(0x0485, "Gala")
+AMIIBO_CHAR_ID_ONE(0x0486, "Chops")
+AMIIBO_CHAR_ID_ONE(0x0487, "Kevin")
+AMIIBO_CHAR_ID_ONE(0x0488, "Pancetti")
+AMIIBO_CHAR_ID_ONE(0x0489, "Agnes")
+AMIIBO_CHAR_ID_ONE(0x0494, "Bunnie")
+AMIIBO_CHAR_ID_ONE(0x0495, "Dotty")
+AMIIBO_CHAR_ID_ONE(0x0496, "Coco")
+AMIIBO_CHAR_ID_ONE(0x0497, "Snake")
+AMIIBO_CHAR_ID_ONE(0x0498, "Gaston")
+AMIIBO_CHAR_ID_ONE(0x0499, "Gabi")
+AMIIBO_CHAR_ID_ONE(0x049A, "Pippy")
+AMIIBO_CHAR_ID_ONE(0x049B, "Tiffany")
+AMIIBO_CHAR_ID_ONE(0x049C, "Genji")
+AMIIBO_CHAR_ID_ONE(0x049D, "Ruby")
+AMIIBO_CHAR_ID_ONE(0x049E, "Doc")
+AMIIBO_CHAR_ID_ONE(0x049F, "Claude")
+AMIIBO_CHAR_ID_ONE(0x04A0, "Francine")
+AMIIBO_CHAR_ID_ONE(0x04A1, "Chrissy")
+AMIIBO_CHAR_ID_ONE(0x04A2, "Hopkins")
+AMIIBO_CHAR_ID_ONE(0x04A3, "OHare")
+AMIIBO_CHAR_ID_ONE(0x04A4, "Carmen")
+AMIIBO_CHAR_ID_ONE(0x04A5, "Bonbon")
+AMIIBO_CHAR_ID_ONE(0x04A6, "Cole")
+AMIIBO_CHAR_ID_ONE(0x04A7, "Mira")
+AMIIBO_CHAR_ID_VAR(0x04A8, "Toby", ac_toby_variants)
+AMIIBO_CHAR_ID_ONE(0x04B2, "Tank")
+AMIIBO_CHAR_ID_ONE(0x04B3, "Rhonda")
+AMIIBO_CHAR_ID_ONE(0x04B4, "Spike")
+AMIIBO_CHAR_ID_ONE(0x04B6, "Hornsby")
+AMIIBO_CHAR_ID_ONE(0x04B9, "Merengue")
+// FIXME: MSVC 2010 interprets \xA9e as 2718 because
+// it's too dumb to realize \x takes *two* nybbles.
+AMIIBO_CHAR_ID_ONE(0x04BA, "Ren\303\251e")
+AMIIBO_CHAR_ID_ONE(0x04C5, "Vesta")
+AMIIBO_CHAR_ID_ONE(0x04C6, "Baabara")
+AMIIBO_CHAR_ID_ONE(0x04C7, "Eunice")
+AMIIBO_CHAR_ID_ONE(0x04C8, "Stella")
+AMIIBO_CHAR_ID_ONE(0x04C9, "Cashmere")
+AMIIBO_CHAR_ID_ONE(0x04CC, "Willow")
+AMIIBO_CHAR_ID_ONE(0x04CD, "Curlos")
+AMIIBO_CHAR_ID_ONE(0x04CE, "Wendy")
+AMIIBO_CHAR_ID_ONE(0x04CF, "Timbra")
+AMIIBO_CHAR_ID_ONE(0x04D0, "Frita")
+AMIIBO_CHAR_ID_ONE(0x04D1, "Muffy")
+AMIIBO_CHAR_ID_ONE(0x04D2, "Pietro")
+AMIIBO_CHAR_ID_VAR(0x04D3, "\xC3\x89toile", ac_etoile_variants)
+AMIIBO_CHAR_ID_ONE(0x04DD, "Peanut")
+AMIIBO_CHAR_ID_ONE(0x04DE, "Blaire")
+AMIIBO_CHAR_ID_ONE(0x04DF, "Filbert")
+AMIIBO_CHAR_ID_ONE(0x04E0, "Pecan")
+AMIIBO_CHAR_ID_ONE(0x04E1, "Nibbles")
+AMIIBO_CHAR_ID_ONE(0x04E2, "Agent S")
+AMIIBO_CHAR_ID_ONE(0x04E3, "Caroline")
+AMIIBO_CHAR_ID_ONE(0x04E4, "Sally")
+AMIIBO_CHAR_ID_ONE(0x04E5, "Static")
+AMIIBO_CHAR_ID_ONE(0x04E6, "Mint")
+AMIIBO_CHAR_ID_ONE(0x04E7, "Ricky")
+AMIIBO_CHAR_ID_ONE(0x04E8, "Cally")
+AMIIBO_CHAR_ID_ONE(0x04EA, "Tasha")
+AMIIBO_CHAR_ID_ONE(0x04EB, "Sylvana")
+AMIIBO_CHAR_ID_ONE(0x04EC, "Poppy")
+AMIIBO_CHAR_ID_ONE(0x04ED, "Sheldon")
+AMIIBO_CHAR_ID_ONE(0x04EE, "Marshal")
+AMIIBO_CHAR_ID_ONE(0x04EF, "Hazel")
+AMIIBO_CHAR_ID_ONE(0x04FA, "Rolf")
+AMIIBO_CHAR_ID_ONE(0x04FB, "Rowan")
+AMIIBO_CHAR_ID_ONE(0x04FC, "Tybalt")
+AMIIBO_CHAR_ID_ONE(0x04FD, "Bangle")
+AMIIBO_CHAR_ID_ONE(0x04FE, "Leonardo")
+AMIIBO_CHAR_ID_ONE(0x04FF, "Claudia")
+AMIIBO_CHAR_ID_ONE(0x0500, "Bianca")
+AMIIBO_CHAR_ID_ONE(0x050B, "Chief")
+AMIIBO_CHAR_ID_ONE(0x050C, "Lobo")
+AMIIBO_CHAR_ID_ONE(0x050D, "Wolfgang")
+AMIIBO_CHAR_ID_ONE(0x050E, "Whitney")
+AMIIBO_CHAR_ID_ONE(0x050F, "Dobie")
+AMIIBO_CHAR_ID_ONE(0x0510, "Freya")
+AMIIBO_CHAR_ID_ONE(0x0511, "Fang")
+AMIIBO_CHAR_ID_ONE(0x0513, "Vivian")
+AMIIBO_CHAR_ID_ONE(0x0514, "Skye")
+AMIIBO_CHAR_ID_ONE(0x0515, "Kyle")
+
+// Star Fox (character series = 0x058)
+AMIIBO_CHAR_ID_ONE(0x0580, "Fox")
+AMIIBO_CHAR_ID_ONE(0x0581, "Falco")
+// TODO: 0x0582, 0x0583
+AMIIBO_CHAR_ID_ONE(0x0584, "Wolf")
+
+// Metroid (character series = 0x05C)
+AMIIBO_CHAR_ID_VAR(0x05C0, "Samus", metroid_samus_variants)
+AMIIBO_CHAR_ID_ONE(0x05C1, "Metroid")
+AMIIBO_CHAR_ID_ONE(0x05C2, "Ridley")
+
+// F-Zero (character series = 0x060)
+AMIIBO_CHAR_ID_ONE(0x0600, "Captain Falcon")
+
+// Pikmin (character series = 0x064)
+AMIIBO_CHAR_ID_VAR(0x0640, "Olimar", pikmin_olimar_variants)
+AMIIBO_CHAR_ID_ONE(0x0642, "Pikmin")
+
+// Punch-Out!! (character series = 0x06C)
+AMIIBO_CHAR_ID_ONE(0x06C0, "Little Mac")
+
+// Wii Fit (character series = 0x070)
+AMIIBO_CHAR_ID_ONE(0x0700, "Wii Fit Trainer")
+
+// Kid Icarus (character series = 0x074)
+AMIIBO_CHAR_ID_ONE(0x0740, "Pit")
+AMIIBO_CHAR_ID_ONE(0x0741, "Dark Pit")
+AMIIBO_CHAR_ID_ONE(0x0742, "Palutena")
+
+// Classic Nintendo (character series = 0x078)
+AMIIBO_CHAR_ID_ONE(0x0780, "Mr. Game & Watch")
+AMIIBO_CHAR_ID_ONE(0x0781, "R.O.B.")	// NES/Famicom variant is in Page 22, amiibo series.
+AMIIBO_CHAR_ID_ONE(0x0782, "Duck Hunt")
+
+// Mii (character series = 0x07C)
+AMIIBO_CHAR_ID_VAR(0x07C0, "Mii Brawler", mii_variants)
+
+// Splatoon (character series = 0x080)
+AMIIBO_CHAR_ID_VAR(0x0800, "Inkling", splatoon_inkling_variants)
+AMIIBO_CHAR_ID_ONE(0x0801, "Callie")
+AMIIBO_CHAR_ID_ONE(0x0802, "Marie")
+AMIIBO_CHAR_ID_ONE(0x0803, "Pearl")
+AMIIBO_CHAR_ID_ONE(0x0804, "Marina")
+AMIIBO_CHAR_ID_VAR(0x0805, "Octoling", splatoon_octoling_variants)
+
+// Mario Sports Superstars (character series = 0x09C)
+AMIIBO_CHAR_ID_VAR(0x09C0, "Mario", mss_mario_variants)
+AMIIBO_CHAR_ID_VAR(0x09C1, "Luigi", mss_luigi_variants)
+AMIIBO_CHAR_ID_VAR(0x09C2, "Peach", mss_peach_variants)
+AMIIBO_CHAR_ID_VAR(0x09C3, "Daisy", mss_daisy_variants)
+AMIIBO_CHAR_ID_VAR(0x09C4, "Yoshi", mss_yoshi_variants)
+AMIIBO_CHAR_ID_VAR(0x09C5, "Wario", mss_wario_variants)
+AMIIBO_CHAR_ID_VAR(0x09C6, "Waluigi", mss_waluigi_variants)
+AMIIBO_CHAR_ID_VAR(0x09C7, "Donkey Kong", mss_donkey_kong_variants)
+AMIIBO_CHAR_ID_VAR(0x09C8, "Diddy Kong", mss_diddy_kong_variants)
+AMIIBO_CHAR_ID_VAR(0x09C9, "Bowser", mss_bowser_variants)
+AMIIBO_CHAR_ID_VAR(0x09CA, "Bowser Jr.", mss_bowser_jr_variants)
+AMIIBO_CHAR_ID_VAR(0x09CB, "Boo", mss_boo_variants)
+AMIIBO_CHAR_ID_VAR(0x09CC, "Baby Mario", mss_baby_mario_variants)
+AMIIBO_CHAR_ID_VAR(0x09CD, "Baby Luigi", mss_baby_luigi_variants)
+AMIIBO_CHAR_ID_VAR(0x09CE, "Birdo", mss_birdo_variants)
+AMIIBO_CHAR_ID_VAR(0x09CF, "Rosalina", mss_rosalina_variants)
+AMIIBO_CHAR_ID_VAR(0x09D0, "Metal Mario", mss_metal_mario_variants)
+AMIIBO_CHAR_ID_VAR(0x09D1, "Pink Gold Peach", mss_pink_gold_peach_variants)
+
+// Pokémon (character series = 0x190 - 0x1BC)
+AMIIBO_CHAR_ID_ONE(0x1900+  6, "Charizard")
+AMIIBO_CHAR_ID_ONE(0x1900+ 25, "Pikachu")
+AMIIBO_CHAR_ID_ONE(0x1900+ 39, "Jigglypuff")
+AMIIBO_CHAR_ID_ONE(0x1900+150, "Mewtwo")
+AMIIBO_CHAR_ID_ONE(0x1900+448, "Lucario")
+AMIIBO_CHAR_ID_ONE(0x1900+658, "Greninja")
+
+// Special Pokémon (character series = 0x1D0)
+AMIIBO_CHAR_ID_ONE(0x1D00, "Shadow Mewtwo")
+AMIIBO_CHAR_ID_ONE(0x1D01, "Detective Pikachu")
+
+// Kirby (character series = 0x1F0)
+AMIIBO_CHAR_ID_ONE(0x1F00, "Kirby")
+AMIIBO_CHAR_ID_ONE(0x1F01, "Meta Knight")
+AMIIBO_CHAR_ID_ONE(0x1F02, "King Dedede")
+AMIIBO_CHAR_ID_ONE(0x1F03, "Waddle Dee")
+
+// BoxBoy! (character series = 0x1F4)
+AMIIBO_CHAR_ID_ONE(0x1F40, "Qbby")
+
+// Fire Emblem (character series = 0x210)
+AMIIBO_CHAR_ID_ONE(0x2100, "Marth")
+AMIIBO_CHAR_ID_ONE(0x2101, "Ike")
+AMIIBO_CHAR_ID_ONE(0x2102, "Lucina")
+AMIIBO_CHAR_ID_ONE(0x2103, "Robin")
+AMIIBO_CHAR_ID_ONE(0x2104, "Roy")
+AMIIBO_CHAR_ID_VAR(0x2105, "Corrin", fe_corrin_variants)
+AMIIBO_CHAR_ID_ONE(0x2106, "Alm")
+AMIIBO_CHAR_ID_ONE(0x2107, "Celica")
+AMIIBO_CHAR_ID_ONE(0x2108, "Chrom")
+AMIIBO_CHAR_ID_ONE(0x2109, "Tiki")
+
+// Xenoblade (character series = 0x224)
+AMIIBO_CHAR_ID_ONE(0x2240, "Shulk")
+
+// Earthbound (character series = 0x228)
+AMIIBO_CHAR_ID_ONE(0x2280, "Ness")
+AMIIBO_CHAR_ID_ONE(0x2281, "Lucas")
+
+// Chibi-Robo! (character series = 0x22C)
+AMIIBO_CHAR_ID_ONE(0x22C0, "Chibi Robo")
+
+// Sonic the Hedgehog (character series = 0x320)
+AMIIBO_CHAR_ID_ONE(0x3200, "Sonic")
+
+// Bayonetta (character series = 0x324)
+AMIIBO_CHAR_ID_ONE(0x3240, "Bayonetta")
+
+// Pac-Man (character series = 0x334)
+AMIIBO_CHAR_ID_ONE(0x3340, "Pac-Man")
+
+// Dark Souls (character series = 0x338)
+AMIIBO_CHAR_ID_ONE(0x3380, "Solaire of Astora")
+
+// Mega Man (character series = 0x348)
+AMIIBO_CHAR_ID_ONE(0x3480, "Mega Man")
+
+// Street Fighter (character series = 0x34C)
+AMIIBO_CHAR_ID_ONE(0x34C0, "Ryu")
+
+// Monster Hunter (character series = 0x350)
+AMIIBO_CHAR_ID_VAR(0x3500, "One-Eyed Rathalos and Rider", mh_rathalos_variants)
+AMIIBO_CHAR_ID_ONE(0x3501, "Nabiru")
+AMIIBO_CHAR_ID_VAR(0x3502, "Rathian and Cheval", mh_rathian_cheval_variants)
+AMIIBO_CHAR_ID_VAR(0x3503, "Barioth and Ayuria", mh_barioth_ayuria_variants)
+AMIIBO_CHAR_ID_VAR(0x3504, "Qurupeco and Dan", mh_qurupeco_dan_variants)
+
+// Shovel Knight (character series = 0x35C)
+AMIIBO_CHAR_ID_ONE(0x35C0, "Shovel Knight")
+
+// Final Fantasy (character series = 0x360)
+AMIIBO_CHAR_ID_ONE(0x3600, "Cloud")
+
+// Cereal (character series = 0x374)
+AMIIBO_CHAR_ID_VAR(0x3740, "Super Mario Cereal", cereal_smb_variants)
+
+// Diablo (character series = 0x38C)
+AMIIBO_CHAR_ID_ONE(0x38C0, "Loot Goblin")
+
+/** Page 22 (byte 0x5C): amiibo series **/
+
+// amiibo series names.
+// Array index = SS
+
+AMIIBO_SERIES_ENTRY("Super Smash Bros.")		// 0x00
+AMIIBO_SERIES_ENTRY("Super Mario Bros.")		// 0x01
+AMIIBO_SERIES_ENTRY("Chibi Robo!")			// 0x02
+AMIIBO_SERIES_ENTRY("Yarn Yoshi")			// 0x03
+AMIIBO_SERIES_ENTRY("Splatoon")				// 0x04
+AMIIBO_SERIES_ENTRY("Animal Crossing")			// 0x05
+AMIIBO_SERIES_ENTRY("Super Mario Bros. 30th Anniversary")	// 0x06
+AMIIBO_SERIES_ENTRY("Skylanders")			// 0x07
+AMIIBO_SERIES_NULL_ENTRY()				// 0x08
+AMIIBO_SERIES_ENTRY("The Legend of Zelda")		// 0x09
+AMIIBO_SERIES_ENTRY("Shovel Knight")			// 0x0A
+AMIIBO_SERIES_NULL_ENTRY()				// 0x0B
+AMIIBO_SERIES_ENTRY("Kirby")				// 0x0C
+AMIIBO_SERIES_ENTRY("Special Pok\xC3\xA9mon")		// 0x0D
+AMIIBO_SERIES_ENTRY("Mario Sports Superstars")		// 0x0E
+AMIIBO_SERIES_ENTRY("Monster Hunter")			// 0x0F
+AMIIBO_SERIES_ENTRY("BoxBoy!")				// 0x10
+AMIIBO_SERIES_ENTRY("Pikmin")				// 0x11
+AMIIBO_SERIES_ENTRY("Fire Emblem")			// 0x12
+AMIIBO_SERIES_ENTRY("Metroid")				// 0x13
+AMIIBO_SERIES_ENTRY("Other")				// 0x14
+AMIIBO_SERIES_ENTRY("Mega Man")				// 0x15
+AMIIBO_SERIES_ENTRY("Diablo")				// 0x16
+
+// amiibo IDs.
+// Index is the amiibo ID. (aaaa)
+
+// SSB: Wave 1 [0x0000-0x000B]
+AMIIBO_ID_ENTRY(  1, 1, "Mario")			// 0x0000
+AMIIBO_ID_ENTRY(  2, 1, "Peach")			// 0x0001
+AMIIBO_ID_ENTRY(  3, 1, "Yoshi")			// 0x0002
+AMIIBO_ID_ENTRY(  4, 1, "Donkey Kong")			// 0x0003
+AMIIBO_ID_ENTRY(  5, 1, "Link")				// 0x0004
+AMIIBO_ID_ENTRY(  6, 1, "Fox")				// 0x0005
+AMIIBO_ID_ENTRY(  7, 1, "Samus")			// 0x0006
+AMIIBO_ID_ENTRY(  8, 1, "Wii Fit Trainer")		// 0x0007
+AMIIBO_ID_ENTRY(  9, 1, "Villager")			// 0x0008
+AMIIBO_ID_ENTRY( 10, 1, "Pikachu")			// 0x0009
+AMIIBO_ID_ENTRY( 11, 1, "Kirby")			// 0x000A
+AMIIBO_ID_ENTRY( 12, 1, "Marth")			// 0x000B
+
+// SSB: Wave 2 [0x000C-0x0012]
+AMIIBO_ID_ENTRY( 15, 2, "Luigi")			// 0x000C
+AMIIBO_ID_ENTRY( 14, 2, "Diddy Kong")			// 0x000D
+AMIIBO_ID_ENTRY( 13, 2, "Zelda")			// 0x000E
+AMIIBO_ID_ENTRY( 16, 2, "Little Mac")			// 0x000F
+AMIIBO_ID_ENTRY( 17, 2, "Pit")				// 0x0010
+AMIIBO_ID_ENTRY( 21, 3, "Lucario")			// 0x0011 (Wave 3, out of order)
+AMIIBO_ID_ENTRY( 18, 2, "Captain Falcon")		// 0x0012
+
+// Waves 3+ [0x0013-0x0033]
+AMIIBO_ID_ENTRY( 19, 3, "Rosalina & Luma")		// 0x0013
+AMIIBO_ID_ENTRY( 20, 3, "Bowser")			// 0x0014
+AMIIBO_ID_ENTRY( 43, 6, "Bowser Jr.")			// 0x0015
+AMIIBO_ID_ENTRY( 22, 3, "Toon Link")			// 0x0016
+AMIIBO_ID_ENTRY( 23, 3, "Sheik")			// 0x0017
+AMIIBO_ID_ENTRY( 24, 3, "Ike")				// 0x0018
+AMIIBO_ID_ENTRY( 42, 6, "Dr. Mario")			// 0x0019
+AMIIBO_ID_ENTRY( 32, 4, "Wario")			// 0x001A
+AMIIBO_ID_ENTRY( 41, 6, "Ganondorf")			// 0x001B
+AMIIBO_ID_ENTRY( 52, 7, "Falco")			// 0x001C
+AMIIBO_ID_ENTRY( 40, 6, "Zero Suit Samus")		// 0x001D
+AMIIBO_ID_ENTRY( 44, 6, "Olimar")			// 0x001E
+AMIIBO_ID_ENTRY( 38, 5, "Palutena")			// 0x001F
+AMIIBO_ID_ENTRY( 39, 5, "Dark Pit")			// 0x0020
+AMIIBO_ID_ENTRY( 48, 7, "Mii Brawler")			// 0x0021
+AMIIBO_ID_ENTRY( 49, 7, "Mii Swordfighter")		// 0x0022
+AMIIBO_ID_ENTRY( 50, 7, "Mii Gunner")			// 0x0023
+AMIIBO_ID_ENTRY( 33, 4, "Charizard")			// 0x0024
+AMIIBO_ID_ENTRY( 36, 4, "Greninja")			// 0x0025
+AMIIBO_ID_ENTRY( 37, 4, "Jigglypuff")			// 0x0026
+AMIIBO_ID_ENTRY( 29, 3, "Meta Knight")			// 0x0027
+AMIIBO_ID_ENTRY( 28, 3, "King Dedede")			// 0x0028
+AMIIBO_ID_ENTRY( 31, 4, "Lucina")			// 0x0029
+AMIIBO_ID_ENTRY( 30, 4, "Robin")			// 0x002A
+AMIIBO_ID_ENTRY( 25, 3, "Shulk")			// 0x002B
+AMIIBO_ID_ENTRY( 34, 4, "Ness")				// 0x002C
+AMIIBO_ID_ENTRY( 45, 6, "Mr. Game & Watch")		// 0x002D
+AMIIBO_ID_ENTRY( 54, 9, "R.O.B. (Famicom)")		// 0x002E (FIXME: Localized release numbers.)
+AMIIBO_ID_ENTRY( 47, 6, "Duck Hunt")			// 0x002F
+AMIIBO_ID_ENTRY( 26, 3, "Sonic")			// 0x0030
+AMIIBO_ID_ENTRY( 27, 3, "Mega Man")			// 0x0031
+AMIIBO_ID_ENTRY( 35, 4, "Pac-Man")			// 0x0032
+AMIIBO_ID_ENTRY( 46, 6, "R.O.B. (NES)")			// 0x0033 (FIXME: Localized release numbers.)
+
+// SMB: Wave 1 [0x0034-0x0039]
+AMIIBO_ID_ENTRY(  1, 1, "Mario")			// 0x0034
+AMIIBO_ID_ENTRY(  4, 1, "Luigi")			// 0x0035
+AMIIBO_ID_ENTRY(  2, 1, "Peach")			// 0x0036
+AMIIBO_ID_ENTRY(  5, 1, "Yoshi")			// 0x0037
+AMIIBO_ID_ENTRY(  3, 1, "Toad")				// 0x0038
+AMIIBO_ID_ENTRY(  6, 1, "Bowser")			// 0x0039
+
+// Chibi-Robo!
+AMIIBO_ID_ENTRY(  0, 0, "Chibi Robo")			// 0x003A
+
+// Unused [0x003B]
+AMIIBO_ID_NULL_ENTRY()					// 0x003B
+
+// SMB: Wave 1: Special Editions [0x003C-0x003D]
+AMIIBO_ID_ENTRY(  7, 1, "Mario (Gold Edition)")		// 0x003C
+AMIIBO_ID_ENTRY(  8, 1, "Mario (Silver Edition)")	// 0x003D
+
+// Splatoon: Wave 1 [0x003E-0x0040]
+AMIIBO_ID_ENTRY(  0, 1, "Inkling Girl")			// 0x003E
+AMIIBO_ID_ENTRY(  0, 1, "Inkling Boy")			// 0x003F
+AMIIBO_ID_ENTRY(  0, 1, "Inkling Squid")		// 0x0040
+
+// Yarn Yoshi [0x0041-0x0043]
+AMIIBO_ID_ENTRY(  1, 0, "Green Yarn Yoshi")		// 0x0041
+AMIIBO_ID_ENTRY(  2, 0, "Pink Yarn Yoshi")		// 0x0042
+AMIIBO_ID_ENTRY(  3, 0, "Light Blue Yarn Yoshi")	// 0x0043
+
+// Animal Crossing Cards: Series 1 [0x0044-0x00A7]
+AMIIBO_ID_ENTRY(  1, 1, "Isabelle")			// 0x0044
+AMIIBO_ID_ENTRY(  2, 1, "Tom Nook")			// 0x0045
+AMIIBO_ID_ENTRY(  3, 1, "DJ KK")			// 0x0046
+AMIIBO_ID_ENTRY(  4, 1, "Sable")			// 0x0047
+AMIIBO_ID_ENTRY(  5, 1, "Kapp'n")			// 0x0048
+AMIIBO_ID_ENTRY(  6, 1, "Resetti")			// 0x0049
+AMIIBO_ID_ENTRY(  7, 1, "Joan")				// 0x004A
+AMIIBO_ID_ENTRY(  8, 1, "Timmy")			// 0x004B
+AMIIBO_ID_ENTRY(  9, 1, "Digby")			// 0x004C
+AMIIBO_ID_ENTRY( 10, 1, "Pascal")			// 0x004D
+AMIIBO_ID_ENTRY( 11, 1, "Harriet")			// 0x004E
+AMIIBO_ID_ENTRY( 12, 1, "Redd")				// 0x004F
+AMIIBO_ID_ENTRY( 13, 1, "Sahara")			// 0x0050
+AMIIBO_ID_ENTRY( 14, 1, "Luna")				// 0x0051
+AMIIBO_ID_ENTRY( 15, 1, "Tortimer")			// 0x0052
+AMIIBO_ID_ENTRY( 16, 1, "Lyle")				// 0x0053
+AMIIBO_ID_ENTRY( 17, 1, "Lottie")			// 0x0054
+AMIIBO_ID_ENTRY( 18, 1, "Bob")				// 0x0055
+AMIIBO_ID_ENTRY( 19, 1, "Fauna")			// 0x0056
+AMIIBO_ID_ENTRY( 20, 1, "Curt")				// 0x0057
+AMIIBO_ID_ENTRY( 21, 1, "Portia")			// 0x0058
+AMIIBO_ID_ENTRY( 22, 1, "Leonardo")			// 0x0059
+AMIIBO_ID_ENTRY( 23, 1, "Cheri")			// 0x005A
+AMIIBO_ID_ENTRY( 24, 1, "Kyle")				// 0x005B
+AMIIBO_ID_ENTRY( 25, 1, "Al")				// 0x005C
+// FIXME: MSVC 2010 interprets \xA9e as 2718 because
+// it's too dumb to realize \x takes *two* nybbles.
+AMIIBO_ID_ENTRY( 26, 1, "Ren\303\251e")			// 0x005D
+AMIIBO_ID_ENTRY( 27, 1, "Lopez")			// 0x005E
+AMIIBO_ID_ENTRY( 28, 1, "Jambette")			// 0x005F
+AMIIBO_ID_ENTRY( 29, 1, "Rasher")			// 0x0060
+AMIIBO_ID_ENTRY( 30, 1, "Tiffany")			// 0x0061
+AMIIBO_ID_ENTRY( 31, 1, "Sheldon")			// 0x0062
+AMIIBO_ID_ENTRY( 32, 1, "Bluebear")			// 0x0063
+AMIIBO_ID_ENTRY( 33, 1, "Bill")				// 0x0064
+AMIIBO_ID_ENTRY( 34, 1, "Kiki")				// 0x0065
+AMIIBO_ID_ENTRY( 35, 1, "Deli")				// 0x0066
+AMIIBO_ID_ENTRY( 36, 1, "Alli")				// 0x0067
+AMIIBO_ID_ENTRY( 37, 1, "Kabuki")			// 0x0068
+AMIIBO_ID_ENTRY( 38, 1, "Patty")			// 0x0069
+AMIIBO_ID_ENTRY( 39, 1, "Jitters")			// 0x006A
+AMIIBO_ID_ENTRY( 40, 1, "Gigi")				// 0x006B
+AMIIBO_ID_ENTRY( 41, 1, "Quillson")			// 0x006C
+AMIIBO_ID_ENTRY( 42, 1, "Marcie")			// 0x006D
+AMIIBO_ID_ENTRY( 43, 1, "Puck")				// 0x006E
+AMIIBO_ID_ENTRY( 44, 1, "Shari")			// 0x006F
+AMIIBO_ID_ENTRY( 45, 1, "Octavian")			// 0x0070
+AMIIBO_ID_ENTRY( 46, 1, "Winnie")			// 0x0071
+AMIIBO_ID_ENTRY( 47, 1, "Knox")				// 0x0072
+AMIIBO_ID_ENTRY( 48, 1, "Sterling")			// 0x0073
+AMIIBO_ID_ENTRY( 49, 1, "Bonbon")			// 0x0074
+AMIIBO_ID_ENTRY( 50, 1, "Punchy")			// 0x0075
+AMIIBO_ID_ENTRY( 51, 1, "Opal")				// 0x0076
+AMIIBO_ID_ENTRY( 52, 1, "Poppy")			// 0x0077
+AMIIBO_ID_ENTRY( 53, 1, "Limberg")			// 0x0078
+AMIIBO_ID_ENTRY( 54, 1, "Deena")			// 0x0079
+AMIIBO_ID_ENTRY( 55, 1, "Snake")			// 0x007A
+AMIIBO_ID_ENTRY( 56, 1, "Bangle")			// 0x007B
+AMIIBO_ID_ENTRY( 57, 1, "Phil")				// 0x007C
+AMIIBO_ID_ENTRY( 58, 1, "Monique")			// 0x007D
+AMIIBO_ID_ENTRY( 59, 1, "Nate")				// 0x007E
+AMIIBO_ID_ENTRY( 60, 1, "Samson")			// 0x007F
+AMIIBO_ID_ENTRY( 61, 1, "Tutu")				// 0x0080
+AMIIBO_ID_ENTRY( 62, 1, "T-Bone")			// 0x0081
+AMIIBO_ID_ENTRY( 63, 1, "Mint")				// 0x0082
+AMIIBO_ID_ENTRY( 64, 1, "Pudge")			// 0x0083
+AMIIBO_ID_ENTRY( 65, 1, "Midge")			// 0x0084
+AMIIBO_ID_ENTRY( 66, 1, "Gruff")			// 0x0085
+AMIIBO_ID_ENTRY( 67, 1, "Flurry")			// 0x0086
+AMIIBO_ID_ENTRY( 68, 1, "Clyde")			// 0x0087
+AMIIBO_ID_ENTRY( 69, 1, "Bella")			// 0x0088
+AMIIBO_ID_ENTRY( 70, 1, "Biff")				// 0x0089
+AMIIBO_ID_ENTRY( 71, 1, "Yuka")				// 0x008A
+AMIIBO_ID_ENTRY( 72, 1, "Lionel")			// 0x008B
+AMIIBO_ID_ENTRY( 73, 1, "Flo")				// 0x008C
+AMIIBO_ID_ENTRY( 74, 1, "Cobb")				// 0x008D
+AMIIBO_ID_ENTRY( 75, 1, "Amelia")			// 0x008E
+AMIIBO_ID_ENTRY( 76, 1, "Jeremiah")			// 0x008F
+AMIIBO_ID_ENTRY( 77, 1, "Cherry")			// 0x0090
+AMIIBO_ID_ENTRY( 78, 1, "Rosco")			// 0x0091
+AMIIBO_ID_ENTRY( 79, 1, "Truffles")			// 0x0092
+AMIIBO_ID_ENTRY( 80, 1, "Eugene")			// 0x0093
+AMIIBO_ID_ENTRY( 81, 1, "Eunice")			// 0x0094
+AMIIBO_ID_ENTRY( 82, 1, "Goose")			// 0x0095
+AMIIBO_ID_ENTRY( 83, 1, "Annalisa")			// 0x0096
+AMIIBO_ID_ENTRY( 84, 1, "Benjamin")			// 0x0097
+AMIIBO_ID_ENTRY( 85, 1, "Pancetti")			// 0x0098
+AMIIBO_ID_ENTRY( 86, 1, "Chief")			// 0x0099
+AMIIBO_ID_ENTRY( 87, 1, "Bunnie")			// 0x009A
+AMIIBO_ID_ENTRY( 88, 1, "Clay")				// 0x009B
+AMIIBO_ID_ENTRY( 89, 1, "Diana")			// 0x009C
+AMIIBO_ID_ENTRY( 90, 1, "Axel")				// 0x009D
+AMIIBO_ID_ENTRY( 91, 1, "Muffy")			// 0x009E
+AMIIBO_ID_ENTRY( 92, 1, "Henry")			// 0x009F
+AMIIBO_ID_ENTRY( 93, 1, "Bertha")			// 0x00A0
+AMIIBO_ID_ENTRY( 94, 1, "Cyrano")			// 0x00A1
+AMIIBO_ID_ENTRY( 95, 1, "Peanut")			// 0x00A2
+AMIIBO_ID_ENTRY( 96, 1, "Cole")				// 0x00A3
+AMIIBO_ID_ENTRY( 97, 1, "Willow")			// 0x00A4
+AMIIBO_ID_ENTRY( 98, 1, "Roald")			// 0x00A5
+AMIIBO_ID_ENTRY( 99, 1, "Molly")			// 0x00A6
+AMIIBO_ID_ENTRY(100, 1, "Walker")			// 0x00A7
+
+// Animal Crossing Cards: Series 2 [0x00A8-0x010B]
+AMIIBO_ID_ENTRY(101, 2, "K.K. Slider")			// 0x00A8
+AMIIBO_ID_ENTRY(102, 2, "Reese")			// 0x00A9
+AMIIBO_ID_ENTRY(103, 2, "Kicks")			// 0x00AA
+AMIIBO_ID_ENTRY(104, 2, "Labelle")			// 0x00AB
+AMIIBO_ID_ENTRY(105, 2, "Copper")			// 0x00AC
+AMIIBO_ID_ENTRY(106, 2, "Booker")			// 0x00AD
+AMIIBO_ID_ENTRY(107, 2, "Katie")			// 0x00AE
+AMIIBO_ID_ENTRY(108, 2, "Tommy")			// 0x00AF
+AMIIBO_ID_ENTRY(109, 2, "Porter")			// 0x00B0
+AMIIBO_ID_ENTRY(110, 2, "Lelia")			// 0x00B1
+AMIIBO_ID_ENTRY(111, 2, "Dr. Shrunk")			// 0x00B2
+AMIIBO_ID_ENTRY(112, 2, "Don Resetti")			// 0x00B3
+AMIIBO_ID_ENTRY(113, 2, "Isabelle (Autumn Outfit)")	// 0x00B4
+AMIIBO_ID_ENTRY(114, 2, "Blanca")			// 0x00B5
+AMIIBO_ID_ENTRY(115, 2, "Nat")				// 0x00B6
+AMIIBO_ID_ENTRY(116, 2, "Chip")				// 0x00B7
+AMIIBO_ID_ENTRY(117, 2, "Jack")				// 0x00B8
+AMIIBO_ID_ENTRY(118, 2, "Poncho")			// 0x00B9
+AMIIBO_ID_ENTRY(119, 2, "Felicity")			// 0x00BA
+AMIIBO_ID_ENTRY(120, 2, "Ozzie")			// 0x00BB
+AMIIBO_ID_ENTRY(121, 2, "Tia")				// 0x00BC
+AMIIBO_ID_ENTRY(122, 2, "Lucha")			// 0x00BD
+AMIIBO_ID_ENTRY(123, 2, "Fuchsia")			// 0x00BE
+AMIIBO_ID_ENTRY(124, 2, "Harry")			// 0x00BF
+AMIIBO_ID_ENTRY(125, 2, "Gwen")				// 0x00C0
+AMIIBO_ID_ENTRY(126, 2, "Coach")			// 0x00C1
+AMIIBO_ID_ENTRY(127, 2, "Kitt")				// 0x00C2
+AMIIBO_ID_ENTRY(128, 2, "Tom")				// 0x00C3
+AMIIBO_ID_ENTRY(129, 2, "Tipper")			// 0x00C4
+AMIIBO_ID_ENTRY(130, 2, "Prince")			// 0x00C5
+AMIIBO_ID_ENTRY(131, 2, "Pate")				// 0x00C6
+AMIIBO_ID_ENTRY(132, 2, "Vladimir")			// 0x00C7
+AMIIBO_ID_ENTRY(133, 2, "Savannah")			// 0x00C8
+AMIIBO_ID_ENTRY(134, 2, "Kidd")				// 0x00C9
+AMIIBO_ID_ENTRY(135, 2, "Phoebe")			// 0x00CA
+AMIIBO_ID_ENTRY(136, 2, "Egbert")			// 0x00CB
+AMIIBO_ID_ENTRY(137, 2, "Cookie")			// 0x00CC
+AMIIBO_ID_ENTRY(138, 2, "Sly")				// 0x00CD
+AMIIBO_ID_ENTRY(139, 2, "Blaire")			// 0x00CE
+AMIIBO_ID_ENTRY(140, 2, "Avery")			// 0x00CF
+AMIIBO_ID_ENTRY(141, 2, "Nana")				// 0x00D0
+AMIIBO_ID_ENTRY(142, 2, "Peck")				// 0x00D1
+AMIIBO_ID_ENTRY(143, 2, "Olivia")			// 0x00D2
+AMIIBO_ID_ENTRY(144, 2, "Cesar")			// 0x00D3
+AMIIBO_ID_ENTRY(145, 2, "Carmen")			// 0x00D4
+AMIIBO_ID_ENTRY(146, 2, "Rodney")			// 0x00D5
+AMIIBO_ID_ENTRY(147, 2, "Scoot")			// 0x00D6
+AMIIBO_ID_ENTRY(148, 2, "Whitney")			// 0x00D7
+AMIIBO_ID_ENTRY(149, 2, "Broccolo")			// 0x00D8
+AMIIBO_ID_ENTRY(150, 2, "Coco")				// 0x00D9
+AMIIBO_ID_ENTRY(151, 2, "Groucho")			// 0x00DA
+AMIIBO_ID_ENTRY(152, 2, "Wendy")			// 0x00DB
+AMIIBO_ID_ENTRY(153, 2, "Alfonso")			// 0x00DC
+AMIIBO_ID_ENTRY(154, 2, "Rhonda")			// 0x00DD
+AMIIBO_ID_ENTRY(155, 2, "Butch")			// 0x00DE
+AMIIBO_ID_ENTRY(156, 2, "Gabi")				// 0x00DF
+AMIIBO_ID_ENTRY(157, 2, "Moose")			// 0x00E0
+AMIIBO_ID_ENTRY(158, 2, "Timbra")			// 0x00E1
+AMIIBO_ID_ENTRY(159, 2, "Zell")				// 0x00E2
+AMIIBO_ID_ENTRY(160, 2, "Pekoe")			// 0x00E3
+AMIIBO_ID_ENTRY(161, 2, "Teddy")			// 0x00E4
+AMIIBO_ID_ENTRY(162, 2, "Mathilda")			// 0x00E5
+AMIIBO_ID_ENTRY(163, 2, "Ed")				// 0x00E6
+AMIIBO_ID_ENTRY(164, 2, "Bianca")			// 0x00E7
+AMIIBO_ID_ENTRY(165, 2, "Filbert")			// 0x00E8
+AMIIBO_ID_ENTRY(166, 2, "Kitty")			// 0x00E9
+AMIIBO_ID_ENTRY(167, 2, "Beau")				// 0x00EA
+AMIIBO_ID_ENTRY(168, 2, "Nan")				// 0x00EB
+AMIIBO_ID_ENTRY(169, 2, "Bud")				// 0x00EC
+AMIIBO_ID_ENTRY(170, 2, "Ruby")				// 0x00ED
+AMIIBO_ID_ENTRY(171, 2, "Benedict")			// 0x00EE
+AMIIBO_ID_ENTRY(172, 2, "Agnes")			// 0x00EF
+AMIIBO_ID_ENTRY(173, 2, "Julian")			// 0x00F0
+AMIIBO_ID_ENTRY(174, 2, "Bettina")			// 0x00F1
+AMIIBO_ID_ENTRY(175, 2, "Jay")				// 0x00F2
+AMIIBO_ID_ENTRY(176, 2, "Sprinkle")			// 0x00F3
+AMIIBO_ID_ENTRY(177, 2, "Flip")				// 0x00F4
+AMIIBO_ID_ENTRY(178, 2, "Hugh")				// 0x00F5
+AMIIBO_ID_ENTRY(179, 2, "Hopper")			// 0x00F6
+AMIIBO_ID_ENTRY(180, 2, "Pecan")			// 0x00F7
+AMIIBO_ID_ENTRY(181, 2, "Drake")			// 0x00F8
+AMIIBO_ID_ENTRY(182, 2, "Alice")			// 0x00F9
+AMIIBO_ID_ENTRY(183, 2, "Camofrog")			// 0x00FA
+AMIIBO_ID_ENTRY(184, 2, "Anicotti")			// 0x00FB
+AMIIBO_ID_ENTRY(185, 2, "Chops")			// 0x00FC
+AMIIBO_ID_ENTRY(186, 2, "Charlise")			// 0x00FD
+AMIIBO_ID_ENTRY(187, 2, "Vic")				// 0x00FE
+AMIIBO_ID_ENTRY(188, 2, "Ankha")			// 0x00FF
+AMIIBO_ID_ENTRY(189, 2, "Drift")			// 0x0100
+AMIIBO_ID_ENTRY(190, 2, "Vesta")			// 0x0101
+AMIIBO_ID_ENTRY(191, 2, "Marcel")			// 0x0102
+AMIIBO_ID_ENTRY(192, 2, "Pango")			// 0x0103
+AMIIBO_ID_ENTRY(193, 2, "Keaton")			// 0x0104
+AMIIBO_ID_ENTRY(194, 2, "Gladys")			// 0x0105
+AMIIBO_ID_ENTRY(195, 2, "Hamphrey")			// 0x0106
+AMIIBO_ID_ENTRY(196, 2, "Freya")			// 0x0107
+AMIIBO_ID_ENTRY(197, 2, "Kid Cat")			// 0x0108
+AMIIBO_ID_ENTRY(198, 2, "Agent S")			// 0x0109
+AMIIBO_ID_ENTRY(199, 2, "Big Top")			// 0x010A
+AMIIBO_ID_ENTRY(200, 2, "Rocket")			// 0x010B
+
+// Animal Crossing Cards: Series 3 [0x010C-0x016F]
+AMIIBO_ID_ENTRY(201, 3, "Rover")			// 0x010C
+AMIIBO_ID_ENTRY(202, 3, "Blathers")			// 0x010D
+AMIIBO_ID_ENTRY(203, 3, "Tom Nook")			// 0x010E
+AMIIBO_ID_ENTRY(204, 3, "Pelly")			// 0x010F
+AMIIBO_ID_ENTRY(205, 3, "Phyllis")			// 0x0110
+AMIIBO_ID_ENTRY(206, 3, "Pete")				// 0x0111
+AMIIBO_ID_ENTRY(207, 3, "Mabel")			// 0x0112
+AMIIBO_ID_ENTRY(208, 3, "Leif")				// 0x0113
+AMIIBO_ID_ENTRY(209, 3, "Wendell")			// 0x0114
+AMIIBO_ID_ENTRY(210, 3, "Cyrus")			// 0x0115
+AMIIBO_ID_ENTRY(211, 3, "Grams")			// 0x0116
+AMIIBO_ID_ENTRY(212, 3, "Timmy")			// 0x0117
+AMIIBO_ID_ENTRY(213, 3, "Digby")			// 0x0118
+AMIIBO_ID_ENTRY(214, 3, "Don Resetti")			// 0x0119
+AMIIBO_ID_ENTRY(215, 3, "Isabelle")			// 0x011A
+AMIIBO_ID_ENTRY(216, 3, "Franklin")			// 0x011B
+AMIIBO_ID_ENTRY(217, 3, "Jingle")			// 0x011C
+AMIIBO_ID_ENTRY(218, 3, "Lily")				// 0x011D
+AMIIBO_ID_ENTRY(219, 3, "Anchovy")			// 0x011E
+AMIIBO_ID_ENTRY(220, 3, "Tabby")			// 0x011F
+AMIIBO_ID_ENTRY(221, 3, "Kody")				// 0x0120
+AMIIBO_ID_ENTRY(222, 3, "Miranda")			// 0x0121
+AMIIBO_ID_ENTRY(223, 3, "Del")				// 0x0122
+AMIIBO_ID_ENTRY(224, 3, "Paula")			// 0x0123
+AMIIBO_ID_ENTRY(225, 3, "Ken")				// 0x0124
+AMIIBO_ID_ENTRY(226, 3, "Mitzi")			// 0x0125
+AMIIBO_ID_ENTRY(227, 3, "Rodeo")			// 0x0126
+AMIIBO_ID_ENTRY(228, 3, "Bubbles")			// 0x0127
+AMIIBO_ID_ENTRY(229, 3, "Cousteau")			// 0x0128
+AMIIBO_ID_ENTRY(230, 3, "Velma")			// 0x0129
+AMIIBO_ID_ENTRY(231, 3, "Elvis")			// 0x012A
+AMIIBO_ID_ENTRY(232, 3, "Canberra")			// 0x012B
+AMIIBO_ID_ENTRY(233, 3, "Colton")			// 0x012C
+AMIIBO_ID_ENTRY(234, 3, "Marina")			// 0x012D
+AMIIBO_ID_ENTRY(235, 3, "Spork/Crackle")		// 0x012E
+AMIIBO_ID_ENTRY(236, 3, "Freckles")			// 0x012F
+AMIIBO_ID_ENTRY(237, 3, "Bam")				// 0x0130
+AMIIBO_ID_ENTRY(238, 3, "Friga")			// 0x0131
+AMIIBO_ID_ENTRY(239, 3, "Ricky")			// 0x0132
+AMIIBO_ID_ENTRY(240, 3, "Deirdre")			// 0x0133
+AMIIBO_ID_ENTRY(241, 3, "Hans")				// 0x0134
+AMIIBO_ID_ENTRY(242, 3, "Chevre")			// 0x0135
+AMIIBO_ID_ENTRY(243, 3, "Drago")			// 0x0136
+AMIIBO_ID_ENTRY(244, 3, "Tangy")			// 0x0137
+AMIIBO_ID_ENTRY(245, 3, "Mac")				// 0x0138
+AMIIBO_ID_ENTRY(246, 3, "Eloise")			// 0x0139
+AMIIBO_ID_ENTRY(247, 3, "Wart Jr.")			// 0x013A
+AMIIBO_ID_ENTRY(248, 3, "Hazel")			// 0x013B
+AMIIBO_ID_ENTRY(249, 3, "Beardo")			// 0x013C
+AMIIBO_ID_ENTRY(250, 3, "Ava")				// 0x013D
+AMIIBO_ID_ENTRY(251, 3, "Chester")			// 0x013E
+AMIIBO_ID_ENTRY(252, 3, "Merry")			// 0x013F
+AMIIBO_ID_ENTRY(253, 3, "Genji")			// 0x0140
+AMIIBO_ID_ENTRY(254, 3, "Greta")			// 0x0141
+AMIIBO_ID_ENTRY(255, 3, "Wolfgang")			// 0x0142
+AMIIBO_ID_ENTRY(256, 3, "Diva")				// 0x0143
+AMIIBO_ID_ENTRY(257, 3, "Klaus")			// 0x0144
+AMIIBO_ID_ENTRY(258, 3, "Daisy")			// 0x0145
+AMIIBO_ID_ENTRY(259, 3, "Stinky")			// 0x0146
+AMIIBO_ID_ENTRY(260, 3, "Tammi")			// 0x0147
+AMIIBO_ID_ENTRY(261, 3, "Tucker")			// 0x0148
+AMIIBO_ID_ENTRY(262, 3, "Blanche")			// 0x0149
+AMIIBO_ID_ENTRY(263, 3, "Gaston")			// 0x014A
+AMIIBO_ID_ENTRY(264, 3, "Marshal")			// 0x014B
+AMIIBO_ID_ENTRY(265, 3, "Gala")				// 0x014C
+AMIIBO_ID_ENTRY(266, 3, "Joey")				// 0x014D
+AMIIBO_ID_ENTRY(267, 3, "Pippy")			// 0x014E
+AMIIBO_ID_ENTRY(268, 3, "Buck")				// 0x014F
+AMIIBO_ID_ENTRY(269, 3, "Bree")				// 0x0150
+AMIIBO_ID_ENTRY(270, 3, "Rooney")			// 0x0151
+AMIIBO_ID_ENTRY(271, 3, "Curlos")			// 0x0152
+AMIIBO_ID_ENTRY(272, 3, "Skye")				// 0x0153
+AMIIBO_ID_ENTRY(273, 3, "Moe")				// 0x0154
+AMIIBO_ID_ENTRY(274, 3, "Flora")			// 0x0155
+AMIIBO_ID_ENTRY(275, 3, "Hamlet")			// 0x0156
+AMIIBO_ID_ENTRY(276, 3, "Astrid")			// 0x0157
+AMIIBO_ID_ENTRY(277, 3, "Monty")			// 0x0158
+AMIIBO_ID_ENTRY(278, 3, "Dora")				// 0x0159
+AMIIBO_ID_ENTRY(279, 3, "Biskit")			// 0x015A
+AMIIBO_ID_ENTRY(280, 3, "Victoria")			// 0x015B
+AMIIBO_ID_ENTRY(281, 3, "Lyman")			// 0x015C
+AMIIBO_ID_ENTRY(282, 3, "Violet")			// 0x015D
+AMIIBO_ID_ENTRY(283, 3, "Frank")			// 0x015E
+AMIIBO_ID_ENTRY(284, 3, "Chadder")			// 0x015F
+AMIIBO_ID_ENTRY(285, 3, "Merengue")			// 0x0160
+AMIIBO_ID_ENTRY(286, 3, "Cube")				// 0x0161
+AMIIBO_ID_ENTRY(287, 3, "Claudia")			// 0x0162
+AMIIBO_ID_ENTRY(288, 3, "Curly")			// 0x0163
+AMIIBO_ID_ENTRY(289, 3, "Boomer")			// 0x0164
+AMIIBO_ID_ENTRY(290, 3, "Caroline")			// 0x0165
+AMIIBO_ID_ENTRY(291, 3, "Sparro")			// 0x0166
+AMIIBO_ID_ENTRY(292, 3, "Baabara")			// 0x0167
+AMIIBO_ID_ENTRY(293, 3, "Rolf")				// 0x0168
+AMIIBO_ID_ENTRY(294, 3, "Maple")			// 0x0169
+AMIIBO_ID_ENTRY(295, 3, "Antonio")			// 0x016A
+AMIIBO_ID_ENTRY(296, 3, "Soleil")			// 0x016B
+AMIIBO_ID_ENTRY(297, 3, "Apollo")			// 0x016C
+AMIIBO_ID_ENTRY(298, 3, "Derwin")			// 0x016D
+AMIIBO_ID_ENTRY(299, 3, "Francine")			// 0x016E
+AMIIBO_ID_ENTRY(300, 3, "Chrissy")			// 0x016F
+
+// Animal Crossing Cards: Series 4 [0x0170-0x01D3]
+AMIIBO_ID_ENTRY(301, 4, "Isabelle")			// 0x0170
+AMIIBO_ID_ENTRY(302, 4, "Brewster")			// 0x0171
+AMIIBO_ID_ENTRY(303, 4, "Katrina")			// 0x0172
+AMIIBO_ID_ENTRY(304, 4, "Phineas")			// 0x0173
+AMIIBO_ID_ENTRY(305, 4, "Celeste")			// 0x0174
+AMIIBO_ID_ENTRY(306, 4, "Tommy")			// 0x0175
+AMIIBO_ID_ENTRY(307, 4, "Gracie")			// 0x0176
+AMIIBO_ID_ENTRY(308, 4, "Leilani")			// 0x0177
+AMIIBO_ID_ENTRY(309, 4, "Resetti")			// 0x0178
+AMIIBO_ID_ENTRY(310, 4, "Timmy")			// 0x0179
+AMIIBO_ID_ENTRY(311, 4, "Lottie")			// 0x017A
+AMIIBO_ID_ENTRY(312, 4, "Shrunk")			// 0x017B
+AMIIBO_ID_ENTRY(313, 4, "Pave")				// 0x017C
+AMIIBO_ID_ENTRY(314, 4, "Gulliver")			// 0x017D
+AMIIBO_ID_ENTRY(315, 4, "Redd")				// 0x017E
+AMIIBO_ID_ENTRY(316, 4, "Zipper")			// 0x017F
+AMIIBO_ID_ENTRY(317, 4, "Goldie")			// 0x0180
+AMIIBO_ID_ENTRY(318, 4, "Stitches")			// 0x0181
+AMIIBO_ID_ENTRY(319, 4, "Pinky")			// 0x0182
+AMIIBO_ID_ENTRY(320, 4, "Mott")				// 0x0183
+AMIIBO_ID_ENTRY(321, 4, "Mallary")			// 0x0184
+AMIIBO_ID_ENTRY(322, 4, "Rocco")			// 0x0185
+AMIIBO_ID_ENTRY(323, 4, "Katt")				// 0x0186
+AMIIBO_ID_ENTRY(324, 4, "Graham")			// 0x0187
+AMIIBO_ID_ENTRY(325, 4, "Peaches")			// 0x0188
+AMIIBO_ID_ENTRY(326, 4, "Dizzy")			// 0x0189
+AMIIBO_ID_ENTRY(327, 4, "Penelope")			// 0x018A
+AMIIBO_ID_ENTRY(328, 4, "Boone")			// 0x018B
+AMIIBO_ID_ENTRY(329, 4, "Broffina")			// 0x018C
+AMIIBO_ID_ENTRY(330, 4, "Croque")			// 0x018D
+AMIIBO_ID_ENTRY(331, 4, "Pashmina")			// 0x018E
+AMIIBO_ID_ENTRY(332, 4, "Shep")				// 0x018F
+AMIIBO_ID_ENTRY(333, 4, "Lolly")			// 0x0190
+AMIIBO_ID_ENTRY(334, 4, "Erik")				// 0x0191
+AMIIBO_ID_ENTRY(335, 4, "Dotty")			// 0x0192
+AMIIBO_ID_ENTRY(336, 4, "Pierce")			// 0x0193
+AMIIBO_ID_ENTRY(337, 4, "Queenie")			// 0x0194
+AMIIBO_ID_ENTRY(338, 4, "Fang")				// 0x0195
+AMIIBO_ID_ENTRY(339, 4, "Frita")			// 0x0196
+AMIIBO_ID_ENTRY(340, 4, "Tex")				// 0x0197
+AMIIBO_ID_ENTRY(341, 4, "Melba")			// 0x0198
+AMIIBO_ID_ENTRY(342, 4, "Bones")			// 0x0199
+AMIIBO_ID_ENTRY(343, 4, "Anabelle")			// 0x019A
+AMIIBO_ID_ENTRY(344, 4, "Rudy")				// 0x019B
+AMIIBO_ID_ENTRY(345, 4, "Naomi")			// 0x019C
+AMIIBO_ID_ENTRY(346, 4, "Peewee")			// 0x019D
+AMIIBO_ID_ENTRY(347, 4, "Tammy")			// 0x019E
+AMIIBO_ID_ENTRY(348, 4, "Olaf")				// 0x019F
+AMIIBO_ID_ENTRY(349, 4, "Lucy")				// 0x01A0
+AMIIBO_ID_ENTRY(350, 4, "Elmer")			// 0x01A1
+AMIIBO_ID_ENTRY(351, 4, "Puddles")			// 0x01A2
+AMIIBO_ID_ENTRY(352, 4, "Rory")				// 0x01A3
+AMIIBO_ID_ENTRY(353, 4, "Elise")			// 0x01A4
+AMIIBO_ID_ENTRY(354, 4, "Walt")				// 0x01A5
+AMIIBO_ID_ENTRY(355, 4, "Mira")				// 0x01A6
+AMIIBO_ID_ENTRY(356, 4, "Pietro")			// 0x01A7
+AMIIBO_ID_ENTRY(357, 4, "Aurora")			// 0x01A8
+AMIIBO_ID_ENTRY(358, 4, "Papi")				// 0x01A9
+AMIIBO_ID_ENTRY(359, 4, "Apple")			// 0x01AA
+AMIIBO_ID_ENTRY(360, 4, "Rod")				// 0x01AB
+AMIIBO_ID_ENTRY(361, 4, "Purrl")			// 0x01AC
+AMIIBO_ID_ENTRY(362, 4, "Static")			// 0x01AD
+AMIIBO_ID_ENTRY(363, 4, "Celia")			// 0x01AE
+AMIIBO_ID_ENTRY(364, 4, "Zucker")			// 0x01AF
+AMIIBO_ID_ENTRY(365, 4, "Peggy")			// 0x01B0
+AMIIBO_ID_ENTRY(366, 4, "Ribbot")			// 0x01B1
+AMIIBO_ID_ENTRY(367, 4, "Annalise")			// 0x01B2
+AMIIBO_ID_ENTRY(368, 4, "Chow")				// 0x01B3
+AMIIBO_ID_ENTRY(369, 4, "Sylvia")			// 0x01B4
+AMIIBO_ID_ENTRY(370, 4, "Jacques")			// 0x01B5
+AMIIBO_ID_ENTRY(371, 4, "Sally")			// 0x01B6
+AMIIBO_ID_ENTRY(372, 4, "Doc")				// 0x01B7
+AMIIBO_ID_ENTRY(373, 4, "Pompom")			// 0x01B8
+AMIIBO_ID_ENTRY(374, 4, "Tank")				// 0x01B9
+AMIIBO_ID_ENTRY(375, 4, "Becky")			// 0x01BA
+AMIIBO_ID_ENTRY(376, 4, "Rizzo")			// 0x01BB
+AMIIBO_ID_ENTRY(377, 4, "Sydney")			// 0x01BC
+AMIIBO_ID_ENTRY(378, 4, "Barold")			// 0x01BD
+AMIIBO_ID_ENTRY(379, 4, "Nibbles")			// 0x01BE
+AMIIBO_ID_ENTRY(380, 4, "Kevin")			// 0x01BF
+AMIIBO_ID_ENTRY(381, 4, "Gloria")			// 0x01C0
+AMIIBO_ID_ENTRY(382, 4, "Lobo")				// 0x01C1
+AMIIBO_ID_ENTRY(383, 4, "Hippeux")			// 0x01C2
+AMIIBO_ID_ENTRY(384, 4, "Margie")			// 0x01C3
+AMIIBO_ID_ENTRY(385, 4, "Lucky")			// 0x01C4
+AMIIBO_ID_ENTRY(386, 4, "Rosie")			// 0x01C5
+AMIIBO_ID_ENTRY(387, 4, "Rowan")			// 0x01C6
+AMIIBO_ID_ENTRY(388, 4, "Maelle")			// 0x01C7
+AMIIBO_ID_ENTRY(389, 4, "Bruce")			// 0x01C8
+AMIIBO_ID_ENTRY(390, 4, "OHare")			// 0x01C9
+AMIIBO_ID_ENTRY(391, 4, "Gayle")			// 0x01CA
+AMIIBO_ID_ENTRY(392, 4, "Cranston")			// 0x01CB
+AMIIBO_ID_ENTRY(393, 4, "Frobert")			// 0x01CC
+AMIIBO_ID_ENTRY(394, 4, "Grizzly")			// 0x01CD
+AMIIBO_ID_ENTRY(395, 4, "Cally")			// 0x01CE
+AMIIBO_ID_ENTRY(396, 4, "Simon")			// 0x01CF
+AMIIBO_ID_ENTRY(397, 4, "Iggly")			// 0x01D0
+AMIIBO_ID_ENTRY(398, 4, "Angus")			// 0x01D1
+AMIIBO_ID_ENTRY(399, 4, "Twiggy")			// 0x01D2
+AMIIBO_ID_ENTRY(400, 4, "Robin")			// 0x01D3
+
+// Animal Crossing: Character Parfait, Amiibo Festival
+AMIIBO_ID_ENTRY(401, 5, "Isabelle (Parfait)")		// 0x01D4
+AMIIBO_ID_ENTRY(402, 5, "Goldie (amiibo Festival)")	// 0x01D5
+AMIIBO_ID_ENTRY(403, 5, "Stitches (amiibo Festival)")	// 0x01D6
+AMIIBO_ID_ENTRY(404, 5, "Rosie (amiibo Festival)")	// 0x01D7
+AMIIBO_ID_ENTRY(405, 5, "K.K. Slider (Parfait)")	// 0x01D8
+
+// Unused [0x01D9-0x01DF]
+AMIIBO_ID_NULL_ENTRY()					// 0x01D9
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01DA,0x01DB
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01DC,0x01DD
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01DE,0x01DF
+
+// Unused [0x01E0-0x01EF]
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01E0,0x01E1
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01E2,0x01E3
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01E4,0x01E5
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01E6,0x01E7
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01E8,0x01E9
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01EA,0x01EB
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01EC,0x01ED
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01EE,0x01EF
+
+// Unused [0x01F0-0x01FF]
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01F0,0x01E1
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01F2,0x01F3
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01F4,0x01F5
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01F6,0x01F7
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01F8,0x01F9
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01FA,0x01FB
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01FC,0x01FD
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x01FE,0x01FF
+
+// Unused [0x0200-0x020F]
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0200,0x0201
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0202,0x0203
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0204,0x0205
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0206,0x0207
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0208,0x0209
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x020A,0x020B
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x020C,0x020D
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x020E,0x020F
+
+// Unused [0x0210-0x021F]
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0210,0x0211
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0212,0x0213
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0214,0x0215
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0216,0x0217
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0218,0x0219
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x021A,0x021B
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x021C,0x021D
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x021E,0x021F
+
+// Unused [0x0220-0x022F]
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0220,0x0221
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0222,0x0223
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0224,0x0225
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0226,0x0227
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0228,0x0229
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x022A,0x022B
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x022C,0x022D
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x022E,0x022F
+
+// Unused [0x0230-0x0237]
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0230,0x0231
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0232,0x0233
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0234,0x0235
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0236,0x0237
+
+// SMB 30th Anniversary [0x0238-0x0239]
+AMIIBO_ID_ENTRY(  1, 1, "8-bit Mario (Classic Color)")	// 0x0238
+AMIIBO_ID_ENTRY(  2, 1, "8-bit Mario (Modern Color)")	// 0x0239
+
+// Skylanders Series [0x023A-0x023B]
+AMIIBO_ID_ENTRY(  1, 0, "Hammer Slam Bowser")		// 0x023A
+AMIIBO_ID_ENTRY(  2, 0, "Turbo Charge Donkey Kong")	// 0x023B
+#if 0
+// NOTE: Cannot distinguish between regular and dark
+// variants in amiibo mode.
+AMIIBO_ID_ENTRY(  3, 0, "Dark Hammer Slam Bowser")	// 0x023A
+AMIIBO_ID_ENTRY(  4, 0, "Dark Turbo Charge Donkey Kong")	// 0x023B
+#endif
+
+// Unused [0x023C]
+AMIIBO_ID_NULL_ENTRY()					// 0x023C
+
+// SSB: Mewtwo (Wave 7) [0x023D]
+AMIIBO_ID_ENTRY( 51, 7, "Mewtwo")			// 0x023D
+
+// Yarn Yoshi: Mega Yarn Yoshi [0x023E]
+AMIIBO_ID_ENTRY(  4, 0, "Mega Yarn Yoshi")		// 0x023E
+
+// Animal Crossing Figurines: Wave 1 [0x023F-0x0246]
+AMIIBO_ID_ENTRY(  0, 1, "Isabelle")			// 0x023F
+AMIIBO_ID_ENTRY(  0, 1, "K.K. Slider")			// 0x0240
+AMIIBO_ID_ENTRY(  0, 1, "Mabel")			// 0x0241
+AMIIBO_ID_ENTRY(  0, 1, "Tom Nook")			// 0x0242
+AMIIBO_ID_ENTRY(  0, 1, "Digby")			// 0x0243
+AMIIBO_ID_ENTRY(  0, 1, "Lottie")			// 0x0244
+AMIIBO_ID_ENTRY(  0, 1, "Reese")			// 0x0245
+AMIIBO_ID_ENTRY(  0, 1, "Cyrus")			// 0x0246
+
+// Animal Crossing Figurines: Wave 2 [0x0247-0x024A]
+AMIIBO_ID_ENTRY(  0, 2, "Blathers")			// 0x0247
+AMIIBO_ID_ENTRY(  0, 2, "Celeste")			// 0x0248
+AMIIBO_ID_ENTRY(  0, 2, "Resetti")			// 0x0249
+AMIIBO_ID_ENTRY(  0, 2, "Kicks")			// 0x024A
+
+// Animal Crossing Figurines: Wave 4 (out of order) [0x024B]
+AMIIBO_ID_ENTRY(  0, 4, "Isabelle (Summer Outfit)")	// 0x024B
+
+// Animal Crossing Figurines: Wave 3 [0x024C-0x024E]
+AMIIBO_ID_ENTRY(  0, 3, "Rover")			// 0x024C
+AMIIBO_ID_ENTRY(  0, 3, "Timmy & Tommy")		// 0x024D
+AMIIBO_ID_ENTRY(  0, 3, "Kapp'n")			// 0x024E
+
+// The Legend of Zelda: Twilight Princess [0x024F]
+AMIIBO_ID_ENTRY(  0, 1, "Midna & Wolf Link")		// 0x024F
+
+// Shovel Knight [0x0250]
+AMIIBO_ID_ENTRY(  0, 0, "Shovel Knight")		// 0x0250
+
+// SSB: DLC characters (Waves 8+)
+AMIIBO_ID_ENTRY( 53, 8, "Lucas")			// 0x0251
+AMIIBO_ID_ENTRY( 55, 9, "Roy")				// 0x0252
+AMIIBO_ID_ENTRY( 56, 9, "Ryu")				// 0x0253
+
+// Kirby [0x0254-0x0257]
+AMIIBO_ID_ENTRY(  0, 0, "Kirby")			// 0x0254
+AMIIBO_ID_ENTRY(  0, 0, "Meta Knight")			// 0x0255
+AMIIBO_ID_ENTRY(  0, 0, "King Dedede")			// 0x0256
+AMIIBO_ID_ENTRY(  0, 0, "Waddle Dee")			// 0x0257
+
+// SSB: Special amiibo [0x0258]
+AMIIBO_ID_ENTRY(  0, 0, "Mega Man (Gold Edition)")	// 0x0258
+
+// SSB: Wave 10 [0x0259-0x025B]
+AMIIBO_ID_ENTRY( 57, 10, "Cloud")			// 0x0259
+AMIIBO_ID_ENTRY( 58, 10, "Corrin")			// 0x025A
+AMIIBO_ID_ENTRY( 59, 10, "Bayonetta")			// 0x025B
+
+// Special Pokémon [0x025C]
+AMIIBO_ID_ENTRY(  0, 0, "Shadow Mewtwo")		// 0x025C
+
+// Splatoon: Wave 2 [0x025D-0x0261]
+AMIIBO_ID_ENTRY(  0, 2, "Callie")			// 0x025D
+AMIIBO_ID_ENTRY(  0, 2, "Marie")			// 0x025E
+AMIIBO_ID_ENTRY(  0, 2, "Inkling Girl (Lime Green)")	// 0x025F
+AMIIBO_ID_ENTRY(  0, 2, "Inkling Boy (Purple)")		// 0x0260
+AMIIBO_ID_ENTRY(  0, 2, "Inkling Squid (Orange)")	// 0x0261
+
+// SMB: Wave 2 [0x0262-0x0268]
+AMIIBO_ID_ENTRY( 12, 2, "Rosalina")			// 0x0262
+AMIIBO_ID_ENTRY(  9, 2, "Wario")			// 0x0263
+AMIIBO_ID_ENTRY( 13, 2, "Donkey Kong")			// 0x0264
+AMIIBO_ID_ENTRY( 14, 2, "Diddy Kong")			// 0x0265
+AMIIBO_ID_ENTRY( 11, 2, "Daisy")			// 0x0266
+AMIIBO_ID_ENTRY( 10, 2, "Waluigi")			// 0x0267
+AMIIBO_ID_ENTRY( 15, 2, "Boo")				// 0x0268
+
+// Mario Sports Superstars Cards [0x0269-0x02C2]
+AMIIBO_ID_ENTRY(  1, 1, "Mario (Soccer)")		// 0x0269
+AMIIBO_ID_ENTRY(  2, 1, "Mario (Baseball)")		// 0x026A
+AMIIBO_ID_ENTRY(  3, 1, "Mario (Tennis)")		// 0x026B
+AMIIBO_ID_ENTRY(  4, 1, "Mario (Golf)")			// 0x026C
+AMIIBO_ID_ENTRY(  5, 1, "Mario (Horse Racing)")		// 0x026D
+AMIIBO_ID_ENTRY(  6, 1, "Luigi (Soccer)")		// 0x026E
+AMIIBO_ID_ENTRY(  7, 1, "Luigi (Baseball)")		// 0x026F
+AMIIBO_ID_ENTRY(  8, 1, "Luigi (Tennis)")		// 0x0270
+AMIIBO_ID_ENTRY(  9, 1, "Luigi (Golf)")			// 0x0271
+AMIIBO_ID_ENTRY( 10, 1, "Luigi (Horse Racing)")		// 0x0272
+AMIIBO_ID_ENTRY( 11, 1, "Peach (Soccer)")		// 0x0273
+AMIIBO_ID_ENTRY( 12, 1, "Peach (Baseball)")		// 0x0274
+AMIIBO_ID_ENTRY( 13, 1, "Peach (Tennis)")		// 0x0275
+AMIIBO_ID_ENTRY( 14, 1, "Peach (Golf)")			// 0x0276
+AMIIBO_ID_ENTRY( 15, 1, "Peach (Horse Racing)")		// 0x0277
+AMIIBO_ID_ENTRY( 16, 1, "Daisy (Soccer)")		// 0x0278
+AMIIBO_ID_ENTRY( 17, 1, "Daisy (Baseball)")		// 0x0279
+AMIIBO_ID_ENTRY( 18, 1, "Daisy (Tennis)")		// 0x027A
+AMIIBO_ID_ENTRY( 19, 1, "Daisy (Golf)")			// 0x027B
+AMIIBO_ID_ENTRY( 20, 1, "Daisy (Horse Racing)")		// 0x027C
+AMIIBO_ID_ENTRY( 21, 1, "Yoshi (Soccer)")		// 0x027D
+AMIIBO_ID_ENTRY( 22, 1, "Yoshi (Baseball)")		// 0x027E
+AMIIBO_ID_ENTRY( 23, 1, "Yoshi (Tennis)")		// 0x027F
+AMIIBO_ID_ENTRY( 24, 1, "Yoshi (Golf)")			// 0x0280
+AMIIBO_ID_ENTRY( 25, 1, "Yoshi (Horse Racing)")		// 0x0281
+AMIIBO_ID_ENTRY( 26, 1, "Wario (Soccer)")		// 0x0282
+AMIIBO_ID_ENTRY( 27, 1, "Wario (Baseball)")		// 0x0283
+AMIIBO_ID_ENTRY( 28, 1, "Wario (Tennis)")		// 0x0284
+AMIIBO_ID_ENTRY( 29, 1, "Wario (Golf)")			// 0x0285
+AMIIBO_ID_ENTRY( 30, 1, "Wario (Horse Racing)")		// 0x0286
+AMIIBO_ID_ENTRY( 31, 1, "Waluigi (Soccer)")		// 0x0287
+AMIIBO_ID_ENTRY( 32, 1, "Waluigi (Baseball)")		// 0x0288
+AMIIBO_ID_ENTRY( 33, 1, "Waluigi (Tennis)")		// 0x0289
+AMIIBO_ID_ENTRY( 34, 1, "Waluigi (Golf)")		// 0x028A
+AMIIBO_ID_ENTRY( 35, 1, "Waluigi (Horse Racing)")	// 0x028B
+AMIIBO_ID_ENTRY( 36, 1, "Donkey Kong (Soccer)")		// 0x028C
+AMIIBO_ID_ENTRY( 37, 1, "Donkey Kong (Baseball)")	// 0x028D
+AMIIBO_ID_ENTRY( 38, 1, "Donkey Kong (Tennis)")		// 0x028E
+AMIIBO_ID_ENTRY( 39, 1, "Donkey Kong (Golf)")		// 0x028F
+AMIIBO_ID_ENTRY( 40, 1, "Donkey Kong (Horse Racing)")	// 0x0290
+AMIIBO_ID_ENTRY( 41, 1, "Diddy Kong (Soccer)")		// 0x0291
+AMIIBO_ID_ENTRY( 42, 1, "Diddy Kong (Baseball)")	// 0x0292
+AMIIBO_ID_ENTRY( 43, 1, "Diddy Kong (Tennis)")		// 0x0293
+AMIIBO_ID_ENTRY( 44, 1, "Diddy Kong (Golf)")		// 0x0294
+AMIIBO_ID_ENTRY( 45, 1, "Diddy Kong (Horse Racing)")	// 0x0295
+AMIIBO_ID_ENTRY( 46, 1, "Bowser (Soccer)")		// 0x0296
+AMIIBO_ID_ENTRY( 47, 1, "Bowser (Baseball)")		// 0x0297
+AMIIBO_ID_ENTRY( 48, 1, "Bowser (Tennis)")		// 0x0298
+AMIIBO_ID_ENTRY( 49, 1, "Bowser (Golf)")		// 0x0299
+AMIIBO_ID_ENTRY( 50, 1, "Bowser (Horse Racing)")	// 0x029A
+AMIIBO_ID_ENTRY( 51, 1, "Bowser Jr. (Soccer)")		// 0x029B
+AMIIBO_ID_ENTRY( 52, 1, "Bowser Jr. (Baseball)")	// 0x029C
+AMIIBO_ID_ENTRY( 53, 1, "Bowser Jr. (Tennis)")		// 0x029D
+AMIIBO_ID_ENTRY( 54, 1, "Bowser Jr. (Golf)")		// 0x029E
+AMIIBO_ID_ENTRY( 55, 1, "Bowser Jr. (Horse Racing)")	// 0x029F
+AMIIBO_ID_ENTRY( 56, 1, "Boo (Soccer)")			// 0x02A0
+AMIIBO_ID_ENTRY( 57, 1, "Boo (Baseball)")		// 0x02A1
+AMIIBO_ID_ENTRY( 58, 1, "Boo (Tennis)")			// 0x02A2
+AMIIBO_ID_ENTRY( 59, 1, "Boo (Golf)")			// 0x02A3
+AMIIBO_ID_ENTRY( 60, 1, "Boo (Horse Racing)")		// 0x02A4
+AMIIBO_ID_ENTRY( 61, 1, "Baby Mario (Soccer)")		// 0x02A5
+AMIIBO_ID_ENTRY( 62, 1, "Baby Mario (Baseball)")	// 0x02A6
+AMIIBO_ID_ENTRY( 63, 1, "Baby Mario (Tennis)")		// 0x02A7
+AMIIBO_ID_ENTRY( 64, 1, "Baby Mario (Golf)")		// 0x02A8
+AMIIBO_ID_ENTRY( 65, 1, "Baby Mario (Horse Racing)")	// 0x02A9
+AMIIBO_ID_ENTRY( 66, 1, "Baby Luigi (Soccer)")		// 0x02AA
+AMIIBO_ID_ENTRY( 67, 1, "Baby Luigi (Baseball)")	// 0x02AB
+AMIIBO_ID_ENTRY( 68, 1, "Baby Luigi (Tennis)")		// 0x02AC
+AMIIBO_ID_ENTRY( 69, 1, "Baby Luigi (Golf)")		// 0x02AD
+AMIIBO_ID_ENTRY( 70, 1, "Baby Luigi (Horse Racing)")	// 0x02AE
+AMIIBO_ID_ENTRY( 71, 1, "Birdo (Soccer)")		// 0x02AF
+AMIIBO_ID_ENTRY( 72, 1, "Birdo (Baseball)")		// 0x02B0
+AMIIBO_ID_ENTRY( 73, 1, "Birdo (Tennis)")		// 0x02B1
+AMIIBO_ID_ENTRY( 74, 1, "Birdo (Golf)")			// 0x02B2
+AMIIBO_ID_ENTRY( 75, 1, "Birdo (Horse Racing)")		// 0x02B3
+AMIIBO_ID_ENTRY( 76, 1, "Rosalina (Soccer)")		// 0x02B4
+AMIIBO_ID_ENTRY( 77, 1, "Rosalina (Baseball)")		// 0x02B5
+AMIIBO_ID_ENTRY( 78, 1, "Rosalina (Tennis)")		// 0x02B6
+AMIIBO_ID_ENTRY( 79, 1, "Rosalina (Golf)")		// 0x02B7
+AMIIBO_ID_ENTRY( 80, 1, "Rosalina (Horse Racing)")	// 0x02B8
+AMIIBO_ID_ENTRY( 81, 1, "Metal Mario (Soccer)")		// 0x02B9
+AMIIBO_ID_ENTRY( 82, 1, "Metal Mario (Baseball)")	// 0x02BA
+AMIIBO_ID_ENTRY( 83, 1, "Metal Mario (Tennis)")		// 0x02BB
+AMIIBO_ID_ENTRY( 84, 1, "Metal Mario (Golf)")		// 0x02BC
+AMIIBO_ID_ENTRY( 85, 1, "Metal Mario (Horse Racing)")	// 0x02BD
+AMIIBO_ID_ENTRY( 86, 1, "Pink Gold Peach (Soccer)")	// 0x02BE
+AMIIBO_ID_ENTRY( 87, 1, "Pink Gold Peach (Baseball)")	// 0x02BF
+AMIIBO_ID_ENTRY( 88, 1, "Pink Gold Peach (Tennis)")	// 0x02C0
+AMIIBO_ID_ENTRY( 89, 1, "Pink Gold Peach (Golf)")	// 0x02C1
+AMIIBO_ID_ENTRY( 90, 1, "Pink Gold Peach (Horse Racing)")	// 0x02C2
+
+// Unused [0x02C3-0x02CF]
+AMIIBO_ID_NULL_ENTRY()					// 0x02C3
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x02C4,0x02C5
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x02C6,0x02C7
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x02C8,0x02C9
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x02CA,0x02CB
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x02CC,0x02CD
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x02CE,0x02CF
+
+// Unused [0x02D0-0x02DF]
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x02D0,0x02D1
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x02D2,0x02D3
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x02D4,0x02D5
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x02D6,0x02D7
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x02D8,0x02D9
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x02DA,0x02DB
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x02DC,0x02DD
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x02DE,0x02DF
+
+// Unused [0x02E1]
+AMIIBO_ID_NULL_ENTRY()					// 0x02E1
+
+// Monster Hunter [0x02E1-0x02E6]
+AMIIBO_ID_ENTRY(  2, 1, "One-Eyed Rathalos and Rider (Female)")	// 0x02E1
+AMIIBO_ID_ENTRY(  1, 1, "One-Eyed Rathalos and Rider (Male)")	// 0x02E2
+AMIIBO_ID_ENTRY(  3, 1, "Nabiru")			// 0x02E3
+AMIIBO_ID_ENTRY(  4, 2, "Rathian and Cheval")		// 0x02E4
+AMIIBO_ID_ENTRY(  5, 2, "Barioth and Ayuria")		// 0x02E5
+AMIIBO_ID_ENTRY(  6, 2, "Qurupeco and Dan")		// 0x02E6
+
+// Animal Crossing: Welcome Amiibo Series [0x02E8-0x031E]
+AMIIBO_ID_ENTRY(  1, 7, "Vivian")			// 0x02E7
+AMIIBO_ID_ENTRY(  2, 7, "Hopkins")			// 0x02E8
+AMIIBO_ID_ENTRY(  3, 7, "June")				// 0x02E9
+AMIIBO_ID_ENTRY(  4, 7, "Piper")			// 0x02EA
+AMIIBO_ID_ENTRY(  5, 7, "Paolo")			// 0x02EB
+AMIIBO_ID_ENTRY(  6, 7, "Hornsby")			// 0x02EC
+AMIIBO_ID_ENTRY(  7, 7, "Stella")			// 0x02ED
+AMIIBO_ID_ENTRY(  8, 7, "Tybalt")			// 0x02EE
+AMIIBO_ID_ENTRY(  9, 7, "Huck")				// 0x02EF
+AMIIBO_ID_ENTRY( 10, 7, "Sylvana")			// 0x02F0
+AMIIBO_ID_ENTRY( 11, 7, "Boris")			// 0x02F1
+AMIIBO_ID_ENTRY( 12, 7, "Wade")				// 0x02F2
+AMIIBO_ID_ENTRY( 13, 7, "Carrie")			// 0x02F3
+AMIIBO_ID_ENTRY( 14, 7, "Ketchup")			// 0x02F4
+AMIIBO_ID_ENTRY( 15, 7, "Rex")				// 0x02F5
+AMIIBO_ID_ENTRY( 16, 7, "Stu")				// 0x02F6
+AMIIBO_ID_ENTRY( 17, 7, "Ursala")			// 0x02F7
+AMIIBO_ID_ENTRY( 18, 7, "Jacob")			// 0x02F8
+AMIIBO_ID_ENTRY( 19, 7, "Maddie")			// 0x02F9
+AMIIBO_ID_ENTRY( 20, 7, "Billy")			// 0x02FA
+AMIIBO_ID_ENTRY( 21, 7, "Boyd")				// 0x02FB
+AMIIBO_ID_ENTRY( 22, 7, "Bitty")			// 0x02FC
+AMIIBO_ID_ENTRY( 23, 7, "Maggie")			// 0x02FD
+AMIIBO_ID_ENTRY( 24, 7, "Murphy")			// 0x02FE
+AMIIBO_ID_ENTRY( 25, 7, "Plucky")			// 0x02FF
+AMIIBO_ID_ENTRY( 26, 7, "Sandy")			// 0x0300
+AMIIBO_ID_ENTRY( 27, 7, "Claude")			// 0x0301
+AMIIBO_ID_ENTRY( 28, 7, "Raddle")			// 0x0302
+AMIIBO_ID_ENTRY( 29, 7, "Julia")			// 0x0303
+AMIIBO_ID_ENTRY( 30, 7, "Louie")			// 0x0304
+AMIIBO_ID_ENTRY( 31, 7, "Bea")				// 0x0305
+AMIIBO_ID_ENTRY( 32, 7, "Admiral")			// 0x0306
+AMIIBO_ID_ENTRY( 33, 7, "Ellie")			// 0x0307
+AMIIBO_ID_ENTRY( 34, 7, "Boots")			// 0x0308
+AMIIBO_ID_ENTRY( 35, 7, "Weber")			// 0x0309
+AMIIBO_ID_ENTRY( 36, 7, "Candi")			// 0x030A
+AMIIBO_ID_ENTRY( 37, 7, "Leopold")			// 0x030B
+AMIIBO_ID_ENTRY( 38, 7, "Spike")			// 0x030C
+AMIIBO_ID_ENTRY( 39, 7, "Cashmere")			// 0x030D
+AMIIBO_ID_ENTRY( 40, 7, "Tad")				// 0x030E
+AMIIBO_ID_ENTRY( 41, 7, "Norma")			// 0x030F
+AMIIBO_ID_ENTRY( 42, 7, "Gonzo")			// 0x0310
+AMIIBO_ID_ENTRY( 43, 7, "Sprocket")			// 0x0311
+AMIIBO_ID_ENTRY( 44, 7, "Snooty")			// 0x0312
+AMIIBO_ID_ENTRY( 45, 7, "Olive")			// 0x0313
+AMIIBO_ID_ENTRY( 46, 7, "Dobie")			// 0x0314
+AMIIBO_ID_ENTRY( 47, 7, "Buzz")				// 0x0315
+AMIIBO_ID_ENTRY( 48, 7, "Cleo")				// 0x0316
+AMIIBO_ID_ENTRY( 49, 7, "Ike")				// 0x0317
+AMIIBO_ID_ENTRY( 50, 7, "Tasha")			// 0x0318
+
+// Animal Crossing x Sanrio Series
+AMIIBO_ID_ENTRY(  1, 6, "Rilla")			// 0x0319
+AMIIBO_ID_ENTRY(  2, 6, "Marty")			// 0x031A
+AMIIBO_ID_ENTRY(  3, 6, "\xC3\x89toile")		// 0x031B
+AMIIBO_ID_ENTRY(  4, 6, "Chai")				// 0x031C
+AMIIBO_ID_ENTRY(  5, 6, "Chelsea")			// 0x031D
+AMIIBO_ID_ENTRY(  6, 6, "Toby")				// 0x031E
+
+// Unused [0x031F-0x32F]
+AMIIBO_ID_NULL_ENTRY()					// 0x031F
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0320,0x0321
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0322,0x0323
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0324,0x0325
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0326,0x0327
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0328,0x0329
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x032A,0x032B
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x032C,0x032D
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x032E,0x032F
+
+// Unused [0x0330-0x33F]
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0330,0x0331
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0332,0x0333
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0334,0x0335
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0336,0x0337
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0338,0x0339
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x033A,0x033B
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x033C,0x033D
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x033E,0x033F
+
+// Unused [0x0340-0x34A]
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0340,0x0341
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0342,0x0343
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0344,0x0345
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0346,0x0347
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0348,0x0349
+AMIIBO_ID_NULL_ENTRY()					// 0x034A
+
+// The Legend of Zelda: 30th Anniversary Series
+AMIIBO_ID_ENTRY(  0, 2, "Link (Ocarina of Time)")	// 0x034B
+AMIIBO_ID_ENTRY(  0, 4, "Link (Majora's Mask)")		// 0x034C
+AMIIBO_ID_ENTRY(  0, 4, "Link (Twilight Princess)")	// 0x034D
+AMIIBO_ID_ENTRY(  0, 4, "Link (Skyward Sword)")		// 0x034E
+AMIIBO_ID_ENTRY(  0, 2, "Link (8-bit)")			// 0x034F
+AMIIBO_ID_ENTRY(  0, 2, "Toon Link (The Wind Waker)")	// 0x0350
+AMIIBO_ID_NULL_ENTRY()					// 0x0351
+AMIIBO_ID_ENTRY(  0, 2, "Toon Zelda (The Wind Waker)")	// 0x0352
+
+// The Legend of Zelda: Breath of the Wild Series
+AMIIBO_ID_ENTRY(  0, 3, "Link (Archer)")		// 0x0353
+AMIIBO_ID_ENTRY(  0, 3, "Link (Rider)")			// 0x0354
+AMIIBO_ID_ENTRY(  0, 3, "Guardian")			// 0x0355
+AMIIBO_ID_ENTRY(  0, 3, "Zelda")			// 0x0356
+AMIIBO_ID_NULL_ENTRY()					// 0x0357 (???)
+// The Legend of Zelda: Breath of the Wild Series (Champions)
+AMIIBO_ID_ENTRY(  0, 4, "Daruk")			// 0x0358
+AMIIBO_ID_ENTRY(  0, 4, "Urbosa")			// 0x0359
+AMIIBO_ID_ENTRY(  0, 4, "Mipha")			// 0x035A
+AMIIBO_ID_ENTRY(  0, 4, "Revali")			// 0x035B
+// The Legend of Zelda: Breath of the Wild Series (Wave 3, continued)
+AMIIBO_ID_ENTRY(  0, 3, "Bokoblin")			// 0x035C
+
+// Yarn Yoshi: Poochy [0x035D]
+AMIIBO_ID_ENTRY(  5, 0, "Poochy")			// 0x035D
+
+// BoxBoy!: Qbby [0x035E]
+AMIIBO_ID_ENTRY(  0, 0, "Qbby")				// 0x035E
+
+// Unused [0x035F]
+AMIIBO_ID_NULL_ENTRY()					// 0x035F
+
+// Fire Emblem [0x0360-0x0361]
+AMIIBO_ID_ENTRY(  1, 0, "Alm")				// 0x0360
+AMIIBO_ID_ENTRY(  2, 0, "Celica")			// 0x0361
+
+// SSB: Wave 10 [0x0362-0x0364]
+AMIIBO_ID_ENTRY( 60, 10, "Cloud (Player 2)")		// 0x0362
+AMIIBO_ID_ENTRY( 61, 10, "Corrin (Player 2)")		// 0x0363
+AMIIBO_ID_ENTRY( 62, 10, "Bayonetta (Player 2)")	// 0x0364
+
+// Metroid [0x365-0x366]
+AMIIBO_ID_ENTRY(  1, 1, "Samus Aran")			// 0x0365
+AMIIBO_ID_ENTRY(  2, 1, "Metroid")			// 0x0366
+
+// SMB: Wave 3 [0x0367-0x0368]
+AMIIBO_ID_ENTRY( 16, 3, "Goomba")			// 0x0367
+AMIIBO_ID_ENTRY( 17, 3, "Koopa Troopa")			// 0x0368
+
+// Splatoon: Wave 3 [0x0369-0x036B]
+AMIIBO_ID_ENTRY(  0, 3, "Inkling Girl (Neon Pink)")	// 0x0369
+AMIIBO_ID_ENTRY(  0, 3, "Inkling Boy (Neon Green)")	// 0x036A
+AMIIBO_ID_ENTRY(  0, 3, "Inkling Squid (Neon Purple)")	// 0x036B
+
+// Unused [0x36C-0x0370]
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x036C-0x036D
+AMIIBO_ID_NULL_ENTRY()					// 0x036E
+
+// Fire Emblem [0x036F-0x0370]
+AMIIBO_ID_ENTRY(  3, 0, "Chrom")			// 0x036F
+AMIIBO_ID_ENTRY(  4, 0, "Tiki")				// 0x0370
+
+// SMB: Wave 4 (Super Mario Odyssey) [0x0371-0x373]
+AMIIBO_ID_ENTRY( 18, 4, "Mario - Wedding")		// 0x0371
+AMIIBO_ID_ENTRY( 19, 4, "Peach - Wedding")		// 0x0372
+AMIIBO_ID_ENTRY( 20, 4, "Bowser - Wedding")		// 0x0373
+
+// Cereal [0x374]
+AMIIBO_ID_ENTRY(  0, 0, "Super Mario Cereal")		// 0x0374
+
+// Special Pokémon [0x0375]
+AMIIBO_ID_ENTRY(  0, 0, "Detective Pikachu")		// 0x0375
+
+// Splatoon: Wave 4 [0x0376-0x0377]
+AMIIBO_ID_ENTRY(  0, 4, "Pearl")			// 0x0376
+AMIIBO_ID_ENTRY(  0, 4, "Marina")			// 0x0377
+
+// Dark Souls [0x0378]
+AMIIBO_ID_ENTRY(  0, 0, "Solaire of Astora")		// 0x0378
+
+// Mega Man [0x0379]
+AMIIBO_ID_ENTRY(  0, 0, "Mega Man")			// 0x0379
+
+// Unused [0x037A-0x038D]
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x037A,0x037B
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x037C,0x037D
+
+// SSBU: Wave 11 [0x037E-0x037F]
+AMIIBO_ID_ENTRY( 65, 11, "Wolf")			// 0x037E
+AMIIBO_ID_ENTRY( 64, 11, "Ridley")
+
+// Unused [0x0380-0x0381]
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0380,0x0381
+
+// SSBU: Wave 11 [0x0382]
+AMIIBO_ID_ENTRY( 63, 11, "Inkling")			// 0x0382
+
+// Unused [0x0383-0x038D]
+AMIIBO_ID_NULL_ENTRY()					// 0x0383
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0384,0x0385
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0386,0x0387
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x0388,0x0389
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x038A,0x038B
+AMIIBO_ID_NULL_ENTRY() AMIIBO_ID_NULL_ENTRY()		// 0x038C,0x038D
+
+// Splatoon: Wave 5 [0x038E-0x0390]
+AMIIBO_ID_ENTRY(  0, 5, "Octoling Girl")		// 0x038E
+AMIIBO_ID_ENTRY(  0, 5, "Octoling Boy")			// 0x038F
+AMIIBO_ID_ENTRY(  0, 5, "Octoling Octopus")		// 0x0390
+
+// Diablo [0x0391]
+AMIIBO_ID_ENTRY(  0, 0, "Loot Goblin")			// 0x0391
+
+#undef AMIIBO_CHAR_SERIES_ENTRY
+#undef AMIIBO_CHAR_SERIES_NULL_ENTRY
+#undef AMIIBO_CHAR_VARIANTS_BEGIN
+#undef AMIIBO_CHAR_VARIANT
+#undef AMIIBO_CHAR_VARIANT_NULL
+#undef AMIIBO_CHAR_VARIANTS_END
+#undef AMIIBO_CHAR_VARIANTS_MSS
+#undef AMIIBO_CHAR_ID_ONE
+#undef AMIIBO_CHAR_ID_VAR
+#undef AMIIBO_SERIES_ENTRY
+#undef AMIIBO_SERIES_NULL_ENTRY
+#undef AMIIBO_ID_ENTRY
+#undef AMIIBO_ID_NULL_ENTRY
@@ -0,0 +1,163 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libromdata)                       *
+ * DX10Formats_data.h: DirectX 10 formats.                                 *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+// NOTE: This file is included multiple times by DX10Formats.cpp
+// to build the string pool and the DXGI_FORMAT table.
+// Each entry must be on its own line. (See strpool.h.)
+
+// NOTE: Only contains the contiguous section.
+// Other values have to be checked afterwards.
+
+DX10FORMATS_NULL_ENTRY()			// 0
+DX10FORMATS_ENTRY("R32G32B32A32_TYPELESS")	// 1
+DX10FORMATS_ENTRY("R32G32B32A32_FLOAT")		// 2
+DX10FORMATS_ENTRY("R32G32B32A32_UINT")		// 3
+DX10FORMATS_ENTRY("R32G32B32A32_SINT")		// 4
+DX10FORMATS_ENTRY("R32G32B32_TYPELESS")		// 5
+DX10FORMATS_ENTRY("R32G32B32_FLOAT")		// 6
+DX10FORMATS_ENTRY("R32G32B32_UINT")		// 7
+DX10FORMATS_ENTRY("R32G32B32_SINT")		// 8
+DX10FORMATS_ENTRY("R16G16B16A16_TYPELESS")	// 9
+DX10FORMATS_ENTRY("R16G16B16A16_FLOAT")		// 10
+DX10FORMATS_ENTRY("R16G16B16A16_UNORM")		// 11
+DX10FORMATS_ENTRY("R16G16B16A16_UINT")		// 12
+DX10FORMATS_ENTRY("R16G16B16A16_SNORM")		// 13
+DX10FORMATS_ENTRY("R16G16B16A16_SINT")		// 14
+DX10FORMATS_ENTRY("R32G32_TYPELESS")		// 15
+DX10FORMATS_ENTRY("R32G32_FLOAT")		// 16
+DX10FORMATS_ENTRY("R32G32_UINT")		// 17
+DX10FORMATS_ENTRY("R32G32_SINT")		// 18
+DX10FORMATS_ENTRY("R32G8X24_TYPELESS")		// 19
+DX10FORMATS_ENTRY("D32_FLOAT_S8X24_UINT")	// 20
+DX10FORMATS_ENTRY("R32_FLOAT_X8X24_TYPELESS")	// 21
+DX10FORMATS_ENTRY("X32_TYPELESS_G8X24_UINT")	// 22
+DX10FORMATS_ENTRY("R10G10B10A2_TYPELESS")	// 23
+DX10FORMATS_ENTRY("R10G10B10A2_UNORM")		// 24
+DX10FORMATS_ENTRY("R10G10B10A2_UINT")		// 25
+DX10FORMATS_ENTRY("R11G11B10_FLOAT")		// 26
+DX10FORMATS_ENTRY("R8G8B8A8_TYPELESS")		// 27
+DX10FORMATS_ENTRY("R8G8B8A8_UNORM")		// 28
+DX10FORMATS_ENTRY("R8G8B8A8_UNORM_SRGB")	// 29
+DX10FORMATS_ENTRY("R8G8B8A8_UINT")		// 30
+DX10FORMATS_ENTRY("R8G8B8A8_SNORM")		// 31
+DX10FORMATS_ENTRY("R8G8B8A8_SINT")		// 32
+DX10FORMATS_ENTRY("R16G16_TYPELESS")		// 33
+DX10FORMATS_ENTRY("R16G16_FLOAT")		// 34
+DX10FORMATS_ENTRY("R16G16_UNORM")		// 35
+DX10FORMATS_ENTRY("R16G16_UINT")		// 36
+DX10FORMATS_ENTRY("R16G16_SNORM")		// 37
+DX10FORMATS_ENTRY("R16G16_SINT")		// 38
+DX10FORMATS_ENTRY("R32_TYPELESS")		// 39
+DX10FORMATS_ENTRY("D32_FLOAT")			// 40
+DX10FORMATS_ENTRY("R32_FLOAT")			// 41
+DX10FORMATS_ENTRY("R32_UINT")			// 42
+DX10FORMATS_ENTRY("R32_SINT")			// 43
+DX10FORMATS_ENTRY("R24G8_TYPELESS")		// 44
+DX10FORMATS_ENTRY("D24_UNORM_S8_UINT")		// 45
+DX10FORMATS_ENTRY("R24_UNORM_X8_TYPELESS")	// 46
+DX10FORMATS_ENTRY("X24_TYPELESS_G8_UINT")	// 47
+DX10FORMATS_ENTRY("R8G8_TYPELESS")		// 48
+DX10FORMATS_ENTRY("R8G8_UNORM")			// 49
+DX10FORMATS_ENTRY("R8G8_UINT")			// 50
+DX10FORMATS_ENTRY("R8G8_SNORM")			// 51
+DX10FORMATS_ENTRY("R8G8_SINT")			// 52
+DX10FORMATS_ENTRY("R16_TYPELESS")		// 53
+DX10FORMATS_ENTRY("R16_FLOAT")			// 54
+DX10FORMATS_ENTRY("D16_UNORM")			// 55
+DX10FORMATS_ENTRY("R16_UNORM")			// 56
+DX10FORMATS_ENTRY("R16_UINT")			// 57
+DX10FORMATS_ENTRY("R16_SNORM")			// 58
+DX10FORMATS_ENTRY("R16_SINT")			// 59
+DX10FORMATS_ENTRY("R8_TYPELESS")		// 60
+DX10FORMATS_ENTRY("R8_UNORM")			// 61
+DX10FORMATS_ENTRY("R8_UINT")			// 62
+DX10FORMATS_ENTRY("R8_SNORM")			// 63
+DX10FORMATS_ENTRY("R8_SINT")			// 64
+DX10FORMATS_ENTRY("A8_UNORM")			// 65
+DX10FORMATS_ENTRY("R1_UNORM")			// 66
+DX10FORMATS_ENTRY("R9G9B9E5_SHAREDEXP")		// 67
+DX10FORMATS_ENTRY("R8G8_B8G8_UNORM")		// 68
+DX10FORMATS_ENTRY("G8R8_G8B8_UNORM")		// 69
+DX10FORMATS_ENTRY("BC1_TYPELESS")		// 70
+DX10FORMATS_ENTRY("BC1_UNORM")			// 71
+DX10FORMATS_ENTRY("BC1_UNORM_SRGB")		// 72
+DX10FORMATS_ENTRY("BC2_TYPELESS")		// 73
+DX10FORMATS_ENTRY("BC2_UNORM")			// 74
+DX10FORMATS_ENTRY("BC2_UNORM_SRGB")		// 75
+DX10FORMATS_ENTRY("BC3_TYPELESS")		// 76
+DX10FORMATS_ENTRY("BC3_UNORM")			// 77
+DX10FORMATS_ENTRY("BC3_UNORM_SRGB")		// 78
+DX10FORMATS_ENTRY("BC4_TYPELESS")		// 79
+DX10FORMATS_ENTRY("BC4_UNORM")			// 80
+DX10FORMATS_ENTRY("BC4_SNORM")			// 81
+DX10FORMATS_ENTRY("BC5_TYPELESS")		// 82
+DX10FORMATS_ENTRY("BC5_UNORM")			// 83
+DX10FORMATS_ENTRY("BC5_SNORM")			// 84
+DX10FORMATS_ENTRY("B5G6R5_UNORM")		// 85
+DX10FORMATS_ENTRY("B5G5R5A1_UNORM")		// 86
+DX10FORMATS_ENTRY("B8G8R8A8_UNORM")		// 87
+DX10FORMATS_ENTRY("B8G8R8X8_UNORM")		// 88
+DX10FORMATS_ENTRY("R10G10B10_XR_BIAS_A2_UNORM")	// 89
+DX10FORMATS_ENTRY("B8G8R8A8_TYPELESS")		// 90
+DX10FORMATS_ENTRY("B8G8R8A8_UNORM_SRGB")	// 91
+DX10FORMATS_ENTRY("B8G8R8X8_TYPELESS")		// 92
+DX10FORMATS_ENTRY("B8G8R8X8_UNORM_SRGB")	// 93
+DX10FORMATS_ENTRY("BC6H_TYPELESS")		// 94
+DX10FORMATS_ENTRY("BC6H_UF16")			// 95
+DX10FORMATS_ENTRY("BC6H_SF16")			// 96
+DX10FORMATS_ENTRY("BC7_TYPELESS")		// 97
+DX10FORMATS_ENTRY("BC7_UNORM")			// 98
+DX10FORMATS_ENTRY("BC7_UNORM_SRGB")		// 99
+DX10FORMATS_ENTRY("AYUV")			// 100
+DX10FORMATS_ENTRY("Y410")			// 101
+DX10FORMATS_ENTRY("Y416")			// 102
+DX10FORMATS_ENTRY("NV12")			// 103
+DX10FORMATS_ENTRY("P010")			// 104
+DX10FORMATS_ENTRY("P016")			// 105
+DX10FORMATS_ENTRY("420_OPAQUE")			// 106
+DX10FORMATS_ENTRY("YUY2")			// 107
+DX10FORMATS_ENTRY("Y210")			// 108
+DX10FORMATS_ENTRY("Y216")			// 109
+DX10FORMATS_ENTRY("NV11")			// 110
+DX10FORMATS_ENTRY("AI44")			// 111
+DX10FORMATS_ENTRY("IA44")			// 112
+DX10FORMATS_ENTRY("P8")				// 113
+DX10FORMATS_ENTRY("A8P8")			// 114
+DX10FORMATS_ENTRY("B4G4R4A4_UNORM")		// 115
+DX10FORMATS_ENTRY("XBOX_R10G10B10_7E2_A2_FLOAT")	// 116
+DX10FORMATS_ENTRY("XBOX_R10G10B10_6E4_A2_FLOAT")	// 117
+DX10FORMATS_ENTRY("XBOX_D16_UNORM_S8_UINT")	// 118
+DX10FORMATS_ENTRY("XBOX_R6_UNORM_X8_TYPELESS")	// 119
+DX10FORMATS_ENTRY("XBOX_DXGI_FORMAT_X16_TYPELESS_G8_UINT")	// 120
+DX10FORMATS_NULL_ENTRY()			// 121
+DX10FORMATS_NULL_ENTRY()			// 122
+DX10FORMATS_NULL_ENTRY()			// 123
+DX10FORMATS_NULL_ENTRY()			// 124
+DX10FORMATS_NULL_ENTRY()			// 125
+DX10FORMATS_NULL_ENTRY()			// 126
+DX10FORMATS_NULL_ENTRY()			// 127
+DX10FORMATS_NULL_ENTRY()			// 128
+DX10FORMATS_NULL_ENTRY()			// 129
+DX10FORMATS_ENTRY("P208")			// 130
+DX10FORMATS_ENTRY("V208")			// 131
+DX10FORMATS_ENTRY("V408")			// 132
+
+#undef DX10FORMATS_ENTRY
+#undef DX10FORMATS_NULL_ENTRY
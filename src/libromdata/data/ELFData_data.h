@@ -0,0 +1,320 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libromdata)                       *
+ * ELFData_data.h: Executable and Linkable Format data.                    *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+// NOTE: This file is included multiple times by ELFData.cpp
+// to build the string pool and the ELF data tables.
+// Each entry must be on its own line. (See strpool.h.)
+
+// ELF machine types. (contiguous low IDs)
+// Reference: https://github.com/file/file/blob/master/magic/Magdir/elf
+// NOTE: Null entries don't have strings, so more than
+// one null entry can be on a single line.
+
+// 0
+ELFDATA_LOW_ENTRY("No machine")
+ELFDATA_LOW_ENTRY("AT&T WE 32100 (M32)")
+ELFDATA_LOW_ENTRY("Sun/Oracle SPARC")
+ELFDATA_LOW_ENTRY("Intel i386")
+ELFDATA_LOW_ENTRY("Motorola M68K")
+ELFDATA_LOW_ENTRY("Motorola M88K")
+ELFDATA_LOW_ENTRY("Intel i486")
+ELFDATA_LOW_ENTRY("Intel i860")
+ELFDATA_LOW_ENTRY("MIPS")
+ELFDATA_LOW_ENTRY("Amdahl")
+
+// 10
+ELFDATA_LOW_ENTRY("MIPS (deprecated)")
+ELFDATA_LOW_ENTRY("IBM RS/6000")
+ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY()
+ELFDATA_LOW_ENTRY("HP PA-RISC")
+ELFDATA_LOW_ENTRY("nCUBE")
+ELFDATA_LOW_ENTRY("Fujitsu VPP500")
+ELFDATA_LOW_ENTRY("SPARC32PLUS")
+ELFDATA_LOW_ENTRY("Intel i960")
+
+// 20
+ELFDATA_LOW_ENTRY("PowerPC or Cisco 4500")
+ELFDATA_LOW_ENTRY("64-bit PowerPC or Cisco 7500")
+ELFDATA_LOW_ENTRY("IBM System/390")
+ELFDATA_LOW_ENTRY("Cell SPU")
+ELFDATA_LOW_ENTRY("Cisco SVIP")
+ELFDATA_LOW_ENTRY("Cisco 7200")
+ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY()
+
+// 30
+ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY()
+ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY()
+ELFDATA_LOW_ENTRY("NEC V800 or Cisco 12000")
+ELFDATA_LOW_ENTRY("Fujitsu FR20")
+ELFDATA_LOW_ENTRY("TRW RH-32")
+ELFDATA_LOW_ENTRY("Motorola RCE")
+
+// 40
+ELFDATA_LOW_ENTRY("ARM")
+ELFDATA_LOW_ENTRY("DEC Alpha")
+ELFDATA_LOW_ENTRY("Hitachi/Renesas SuperH")
+ELFDATA_LOW_ENTRY("Sun/Oracle SPARC V9")
+ELFDATA_LOW_ENTRY("Siemens Tricore Embedded Processor")
+ELFDATA_LOW_ENTRY("Argonaut RISC Core")
+ELFDATA_LOW_ENTRY("Renesas H8/300")
+ELFDATA_LOW_ENTRY("Renesas H8/300H")
+ELFDATA_LOW_ENTRY("Renesas H8S")
+ELFDATA_LOW_ENTRY("Renesas H8/500")
+
+// 50
+ELFDATA_LOW_ENTRY("Intel Itanium")
+ELFDATA_LOW_ENTRY("Stanford MIPS-X")
+ELFDATA_LOW_ENTRY("Motorola Coldfire")
+ELFDATA_LOW_ENTRY("Motorola M68HC12")
+ELFDATA_LOW_ENTRY("Fujitsu MMA")
+ELFDATA_LOW_ENTRY("Siemens PCP")
+ELFDATA_LOW_ENTRY("Sony nCPU")
+ELFDATA_LOW_ENTRY("Denso NDR1")
+ELFDATA_LOW_ENTRY("Start*Core")
+ELFDATA_LOW_ENTRY("Toyota ME16")
+
+// 60
+ELFDATA_LOW_ENTRY("ST100")
+ELFDATA_LOW_ENTRY("Tinyj emb.")
+ELFDATA_LOW_ENTRY("AMD64")
+ELFDATA_LOW_ENTRY("Sony DSP")
+ELFDATA_LOW_ENTRY("DEC PDP-10")
+ELFDATA_LOW_ENTRY("DEC PDP-11")
+ELFDATA_LOW_ENTRY("FX66")
+ELFDATA_LOW_ENTRY("ST9+ 8/16-bit")
+ELFDATA_LOW_ENTRY("ST7 8-bit")
+ELFDATA_LOW_ENTRY("Motorola MC68HC16")
+
+// 70
+ELFDATA_LOW_ENTRY("Motorola MC68HC11")
+ELFDATA_LOW_ENTRY("Motorola MC68HC08")
+ELFDATA_LOW_ENTRY("Motorola MC68HC05")
+ELFDATA_LOW_ENTRY("SGI SVx or Cray NV1")
+ELFDATA_LOW_ENTRY("ST19 8-bit")
+ELFDATA_LOW_ENTRY("Digital VAX")
+ELFDATA_LOW_ENTRY("Axis cris")
+ELFDATA_LOW_ENTRY("Infineon 32-bit embedded")
+ELFDATA_LOW_ENTRY("Element 14 64-bit DSP")
+ELFDATA_LOW_ENTRY("LSI Logic 16-bit DSP")
+
+// 80
+ELFDATA_LOW_ENTRY("MMIX")
+ELFDATA_LOW_ENTRY("Harvard machine-independent")
+ELFDATA_LOW_ENTRY("SiTera Prism")
+ELFDATA_LOW_ENTRY("Atmel AVR 8-bit")
+ELFDATA_LOW_ENTRY("Fujitsu FR-30")
+ELFDATA_LOW_ENTRY("Mitsubishi D10V")
+ELFDATA_LOW_ENTRY("Mitsubishi D30V")
+ELFDATA_LOW_ENTRY("NEC V850")
+ELFDATA_LOW_ENTRY("Renesas M32R")
+ELFDATA_LOW_ENTRY("Matsushita MN10300")
+
+// 90
+ELFDATA_LOW_ENTRY("Matsushita MN10200")
+ELFDATA_LOW_ENTRY("picoJava")
+ELFDATA_LOW_ENTRY("OpenRISC")
+ELFDATA_LOW_ENTRY("ARC Cores Tangent-A5")
+ELFDATA_LOW_ENTRY("Tensilica Xtensa")
+ELFDATA_LOW_ENTRY("Alphamosaic VideoCore")
+ELFDATA_LOW_ENTRY("Thompson Multimedia")
+ELFDATA_LOW_ENTRY("NatSemi 32k")
+ELFDATA_LOW_ENTRY("Tenor Network TPC")
+ELFDATA_LOW_ENTRY("Trebia SNP 1000")
+
+// 100
+ELFDATA_LOW_ENTRY("STMicroelectronics ST200")
+ELFDATA_LOW_ENTRY("Ubicom IP2022")
+ELFDATA_LOW_ENTRY("MAX Processor")
+ELFDATA_LOW_ENTRY("NatSemi CompactRISC")
+ELFDATA_LOW_ENTRY("Fujitsu F2MC16")
+ELFDATA_LOW_ENTRY("TI msp430")
+ELFDATA_LOW_ENTRY("Analog Devices Blackfin")
+ELFDATA_LOW_ENTRY("S1C33 Family of Seiko Epson")
+ELFDATA_LOW_ENTRY("Sharp embedded")
+ELFDATA_LOW_ENTRY("Arca RISC")
+
+// 110
+ELFDATA_LOW_ENTRY("PKU-Unity Ltd.")
+ELFDATA_LOW_ENTRY("eXcess: 16/32/64-bit")
+ELFDATA_LOW_ENTRY("Icera Deep Execution Processor")
+ELFDATA_LOW_ENTRY("Altera Nios II")
+ELFDATA_LOW_ENTRY("NatSemi CRX")
+ELFDATA_LOW_ENTRY("Motorola XGATE")
+ELFDATA_LOW_ENTRY("Infineon C16x/XC16x")
+ELFDATA_LOW_ENTRY("Renesas M16C series")
+ELFDATA_LOW_ENTRY("Microchip dsPIC30F")
+ELFDATA_LOW_ENTRY("Freescale RISC core")
+
+// 120
+ELFDATA_LOW_ENTRY("Renesas M32C series")
+ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY()
+ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY()
+
+// 130
+ELFDATA_LOW_NULL_ENTRY()
+ELFDATA_LOW_ENTRY("Altium TSK3000 core")
+ELFDATA_LOW_ENTRY("Freescale RS08")
+ELFDATA_LOW_NULL_ENTRY()
+ELFDATA_LOW_ENTRY("Cyan Technology eCOG2")
+ELFDATA_LOW_ENTRY("Sunplus S+core7 RISC")
+ELFDATA_LOW_ENTRY("New Japan Radio (NJR) 24-bit DSP")
+ELFDATA_LOW_ENTRY("Broadcom VideoCore III")
+ELFDATA_LOW_ENTRY("LatticeMico32")
+ELFDATA_LOW_ENTRY("Seiko Epson C17 family")
+
+// 140
+ELFDATA_LOW_ENTRY("TI TMS320C6000 DSP family")
+ELFDATA_LOW_ENTRY("TI TMS320C2000 DSP family")
+ELFDATA_LOW_ENTRY("TI TMS320C55x DSP family")
+ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY()
+ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY()
+
+// 150
+ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY()
+ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY()
+
+// 160
+ELFDATA_LOW_ENTRY("STMicroelectronics 64-bit VLIW DSP")
+ELFDATA_LOW_ENTRY("Cypress M8C")
+ELFDATA_LOW_ENTRY("Renesas R32C series")
+ELFDATA_LOW_ENTRY("NXP TriMedia family")
+ELFDATA_LOW_ENTRY("Qualcomm DSP6")
+ELFDATA_LOW_ENTRY("Intel 8051 and variants")
+ELFDATA_LOW_ENTRY("STMicroelectronics STxP7x family")
+ELFDATA_LOW_ENTRY("Andes embedded RISC")
+ELFDATA_LOW_ENTRY("Cyan eCOG1X family")
+ELFDATA_LOW_ENTRY("Dallas MAXQ30")
+
+// 170
+ELFDATA_LOW_ENTRY("New Japan Radio (NJR) 16-bit DSP")
+ELFDATA_LOW_ENTRY("M2000 Reconfigurable RISC")
+ELFDATA_LOW_ENTRY("Cray NV2 vector architecture")
+ELFDATA_LOW_ENTRY("Renesas RX family")
+ELFDATA_LOW_ENTRY("META")
+ELFDATA_LOW_ENTRY("MCST Elbrus")
+ELFDATA_LOW_ENTRY("Cyan Technology eCOG16 family")
+ELFDATA_LOW_ENTRY("NatSemi CompactRISC")
+ELFDATA_LOW_ENTRY("Freescale Extended Time Processing Unit")
+ELFDATA_LOW_ENTRY("Infineon SLE9X")
+
+// 180
+ELFDATA_LOW_ENTRY("Intel L10M")
+ELFDATA_LOW_ENTRY("Intel K10M")
+ELFDATA_LOW_NULL_ENTRY()
+ELFDATA_LOW_ENTRY("ARM AArch64")
+ELFDATA_LOW_NULL_ENTRY()
+ELFDATA_LOW_ENTRY("Atmel 32-bit family")
+ELFDATA_LOW_ENTRY("STMicroelectronics STM8 8-bit")
+ELFDATA_LOW_ENTRY("Tilera TILE64")
+ELFDATA_LOW_ENTRY("Tilera TILEPro")
+ELFDATA_LOW_ENTRY("Xilinx MicroBlaze 32-bit RISC")
+
+// 190
+ELFDATA_LOW_ENTRY("NVIDIA CUDA architecture")
+ELFDATA_LOW_ENTRY("Tilera TILE-Gx")
+ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY()
+ELFDATA_LOW_ENTRY("Renesas RL78 family")
+ELFDATA_LOW_NULL_ENTRY()
+ELFDATA_LOW_ENTRY("Renesas 68K0R")
+
+// 200
+ELFDATA_LOW_ENTRY("Freescale 56800EX")
+ELFDATA_LOW_ENTRY("Beyond BA1")
+ELFDATA_LOW_ENTRY("Beyond BA2")
+ELFDATA_LOW_ENTRY("XMOS xCORE")
+ELFDATA_LOW_ENTRY("Micrchip 8-bit PIC(r)")
+ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY() ELFDATA_LOW_NULL_ENTRY()
+
+// 210
+ELFDATA_LOW_ENTRY("KM211 KM32")
+ELFDATA_LOW_ENTRY("KM211 KMX32")
+ELFDATA_LOW_ENTRY("KM211 KMX16")
+ELFDATA_LOW_ENTRY("KM211 KMX8")
+ELFDATA_LOW_ENTRY("KM211 KVARC")
+ELFDATA_LOW_ENTRY("Paneve CDP")
+ELFDATA_LOW_ENTRY("Cognitive Smart Memory")
+ELFDATA_LOW_ENTRY("iCelero CoolEngine")
+ELFDATA_LOW_ENTRY("Nanoradio Optimized RISC")
+
+// ELF machine types. (other IDs)
+// Reference: https://github.com/file/file/blob/master/magic/Magdir/elf
+ELFDATA_OTHER_ENTRY(243,	"UCB RISC-V")
+ELFDATA_OTHER_ENTRY(247,	"eBPF")
+ELFDATA_OTHER_ENTRY(251,	"NEC VE")
+
+// The following are unofficial and/or obsolete types.
+// TODO: Indicate unofficial/obsolete using a separate flag?
+ELFDATA_OTHER_ENTRY(0x1057,	"AVR (unofficial)")
+ELFDATA_OTHER_ENTRY(0x1059,	"MSP430 (unofficial)")
+ELFDATA_OTHER_ENTRY(0x1223,	"Adapteva Epiphany (unofficial)")
+ELFDATA_OTHER_ENTRY(0x2530,	"Morpho MT (unofficial)")
+ELFDATA_OTHER_ENTRY(0x3330,	"FR30 (unofficial)")
+ELFDATA_OTHER_ENTRY(0x3426,	"OpenRISC (obsolete)")
+ELFDATA_OTHER_ENTRY(0x4688,	"Infineon C166 (unofficial)")
+ELFDATA_OTHER_ENTRY(0x5441,	"Cygnus FRV (unofficial)")
+ELFDATA_OTHER_ENTRY(0x5aa5,	"DLX (unofficial)")
+ELFDATA_OTHER_ENTRY(0x7650,	"Cygnus D10V (unofficial)")
+ELFDATA_OTHER_ENTRY(0x7676,	"Cygnus D30V (unofficial)")
+ELFDATA_OTHER_ENTRY(0x8217,	"Ubicom IP2xxx (unofficial)")
+ELFDATA_OTHER_ENTRY(0x8472,	"OpenRISC (obsolete)")
+ELFDATA_OTHER_ENTRY(0x9025,	"Cygnus PowerPC (unofficial)")
+ELFDATA_OTHER_ENTRY(0x9026,	"DEC Alpha (unofficial)")
+ELFDATA_OTHER_ENTRY(0x9041,	"Cygnus M32R (unofficial)")
+ELFDATA_OTHER_ENTRY(0x9080,	"Cygnus V850 (unofficial)")
+ELFDATA_OTHER_ENTRY(0xA390,	"IBM System/390 (obsolete)")
+ELFDATA_OTHER_ENTRY(0xABC7,	"Old Xtensa (unofficial)")
+ELFDATA_OTHER_ENTRY(0xAD45,	"xstormy16 (unofficial)")
+ELFDATA_OTHER_ENTRY(0xBAAB,	"Old MicroBlaze (unofficial)")
+ELFDATA_OTHER_ENTRY(0xBEEF,	"Cygnus MN10300 (unofficial)")
+ELFDATA_OTHER_ENTRY(0xDEAD,	"Cygnus MN10200 (unofficial)")
+ELFDATA_OTHER_ENTRY(0xF00D,	"Toshiba MeP (unofficial)")
+ELFDATA_OTHER_ENTRY(0xFEB0,	"Renesas M32C (unofficial)")
+ELFDATA_OTHER_ENTRY(0xFEBA,	"Vitesse IQ2000 (unofficial)")
+ELFDATA_OTHER_ENTRY(0xFEBB,	"NIOS (unofficial)")
+ELFDATA_OTHER_ENTRY(0xFEED,	"Moxie (unofficial)")
+
+// ELF OS ABI names.
+// Reference: https://github.com/file/file/blob/master/magic/Magdir/elf
+// 0
+ELFDATA_OSABI_ENTRY("UNIX System V")
+ELFDATA_OSABI_ENTRY("HP-UX")
+ELFDATA_OSABI_ENTRY("NetBSD")
+ELFDATA_OSABI_ENTRY("GNU/Linux")
+ELFDATA_OSABI_ENTRY("GNU/Hurd")
+ELFDATA_OSABI_ENTRY("86Open")
+ELFDATA_OSABI_ENTRY("Solaris")
+ELFDATA_OSABI_ENTRY("Monterey")
+ELFDATA_OSABI_ENTRY("IRIX")
+ELFDATA_OSABI_ENTRY("FreeBSD")
+
+// 10
+ELFDATA_OSABI_ENTRY("Tru64")
+ELFDATA_OSABI_ENTRY("Novell Modesto")
+ELFDATA_OSABI_ENTRY("OpenBSD")
+ELFDATA_OSABI_ENTRY("OpenVMS")
+ELFDATA_OSABI_ENTRY("HP NonStop Kernel")
+ELFDATA_OSABI_ENTRY("AROS Research Operating System")
+ELFDATA_OSABI_ENTRY("FenixOS")
+ELFDATA_OSABI_ENTRY("Nuxi CloudABI")
+
+#undef ELFDATA_LOW_ENTRY
+#undef ELFDATA_LOW_NULL_ENTRY
+#undef ELFDATA_OTHER_ENTRY
+#undef ELFDATA_OSABI_ENTRY
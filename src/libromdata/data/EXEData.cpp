@@ -20,12 +20,22 @@
 
 #include "EXEData.hpp"
 #include "Other/exe_structs.h"
+#include "PerfectHash.hpp"
+#include "strpool.h"
 
-// C includes.
-#include <stdlib.h>
+// One-time initialization.
+#include "librpbase/threads/pthread_once.h"
 
 namespace LibRomData {
 
+// String pool.
+struct EXEData_strpool_t {
+	char STRPOOL_NULL[1];
+#define EXEDATA_PE_ENTRY(cpu, name)	STRPOOL_MEMBER(s, name)
+#define EXEDATA_LE_ENTRY(cpu, name)	STRPOOL_MEMBER(s, name)
+#include "EXEData_data.h"
+};
+
 class EXEDataPrivate {
 	private:
 		// Static class.
@@ -34,91 +44,69 @@ class EXEDataPrivate {
 		RP_DISABLE_COPY(EXEDataPrivate)
 
 	public:
+		static const EXEData_strpool_t strpool;
+
 		struct MachineType {
 			uint16_t cpu;
-			const char *name;
+			uint16_t name;		// Offset in strpool.
 		};
 		static const MachineType machineTypes_PE[];
 		static const MachineType machineTypes_LE[];
 
+		// Perfect hash indexes.
+		static PerfectHash machineTypes_PE_hash;
+		static PerfectHash machineTypes_LE_hash;
+		static pthread_once_t once_control;
+
 		/**
-		 * bsearch() comparison function for MachineType.
-		 * @param a
-		 * @param b
-		 * @return
+		 * Build the perfect hash indexes.
+		 * Called by pthread_once().
 		 */
-		static int RP_C_API MachineType_compar(const void *a, const void *b);
+		static void initHashes(void);
 };
 
+// String pool.
+const EXEData_strpool_t EXEDataPrivate::strpool = {
+	"",
+#define EXEDATA_PE_ENTRY(cpu, name)	STRPOOL_STRING(name)
+#define EXEDATA_LE_ENTRY(cpu, name)	STRPOOL_STRING(name)
+#include "EXEData_data.h"
+};
+static_assert(sizeof(EXEData_strpool_t) <= 0xFFFF, "EXEData_strpool_t is too big for 16-bit offsets.");
+
 // PE machine types.
-// NOTE: The cpu field *must* be sorted in ascending order.
 const EXEDataPrivate::MachineType EXEDataPrivate::machineTypes_PE[] = {
-	{IMAGE_FILE_MACHINE_I386,	"Intel i386"},
-	{IMAGE_FILE_MACHINE_R3000_BE,	"MIPS R3000 (big-endian)"},
-	{IMAGE_FILE_MACHINE_R3000,	"MIPS R3000"},
-	{IMAGE_FILE_MACHINE_R4000,	"MIPS R4000"},
-	{IMAGE_FILE_MACHINE_R10000,	"MIPS R10000"},
-	{IMAGE_FILE_MACHINE_WCEMIPSV2,	"MIPS (WCE v2)"},
-	{IMAGE_FILE_MACHINE_ALPHA,	"DEC Alpha AXP"},
-	{IMAGE_FILE_MACHINE_SH3,	"Hitachi SH3"},
-	{IMAGE_FILE_MACHINE_SH3DSP,	"Hitachi SH3 DSP"},
-	{IMAGE_FILE_MACHINE_SH3E,	"Hitachi SH3E"},
-	{IMAGE_FILE_MACHINE_SH4,	"Hitachi SH4"},
-	{IMAGE_FILE_MACHINE_SH5,	"Hitachi SH5"},
-	{IMAGE_FILE_MACHINE_ARM,	"ARM"},
-	{IMAGE_FILE_MACHINE_THUMB,	"ARM Thumb"},
-	{IMAGE_FILE_MACHINE_ARMNT,	"ARM Thumb-2"},
-	{IMAGE_FILE_MACHINE_AM33,	"Matsushita AM33"},
-	{IMAGE_FILE_MACHINE_POWERPC,	"PowerPC"},
-	{IMAGE_FILE_MACHINE_POWERPCFP,	"PowerPC with FPU"},
-	{IMAGE_FILE_MACHINE_POWERPCBE,	"PowerPC (big-endian)"},
-	{IMAGE_FILE_MACHINE_IA64,	"Intel Itanium"},
-	{IMAGE_FILE_MACHINE_MIPS16,	"MIPS16"},
-	{IMAGE_FILE_MACHINE_M68K,	"Motorola 68000"},
-	{IMAGE_FILE_MACHINE_PA_RISC,	"PA-RISC"},
-	{IMAGE_FILE_MACHINE_ALPHA64,	"DEC Alpha AXP (64-bit)"},
-	{IMAGE_FILE_MACHINE_MIPSFPU,	"MIPS with FPU"},
-	{IMAGE_FILE_MACHINE_MIPSFPU16,	"MIPS16 with FPU"},
-	{IMAGE_FILE_MACHINE_TRICORE,	"Infineon TriCore"},
-	{IMAGE_FILE_MACHINE_CEF,	"Common Executable Format"},
-	{IMAGE_FILE_MACHINE_EBC,	"EFI Byte Code"},
-	{IMAGE_FILE_MACHINE_AMD64,	"AMD64"},
-	{IMAGE_FILE_MACHINE_M32R,	"Mitsubishi M32R"},
-	{IMAGE_FILE_MACHINE_ARM64,	"ARM (64-bit)"},
-	{IMAGE_FILE_MACHINE_CEE,	"MSIL"},
-
-	{0, nullptr}
+#define EXEDATA_PE_ENTRY(cpu, name)	{cpu, STRPOOL_OFFSET(EXEData_strpool_t, s)},
+#define EXEDATA_LE_ENTRY(cpu, name)
+#include "EXEData_data.h"
+
+	{0, 0}
 };
 
 // LE machine types.
-// NOTE: The cpu field *must* be sorted in ascending order.
 const EXEDataPrivate::MachineType EXEDataPrivate::machineTypes_LE[] = {
-	{LE_CPU_80286,		"Intel i286"},
-	{LE_CPU_80386,		"Intel i386"},
-	{LE_CPU_80486,		"Intel i486"},
-	{LE_CPU_80586,		"Intel Pentium"},
-	{LE_CPU_i860_N10,	"Intel i860 XR (N10)"},
-	{LE_CPU_i860_N11,	"Intel i860 XP (N11)"},
-	{LE_CPU_MIPS_I,		"MIPS Mark I (R2000, R3000"},
-	{LE_CPU_MIPS_II,	"MIPS Mark II (R6000)"},
-	{LE_CPU_MIPS_III,	"MIPS Mark III (R4000)"},
-
-	{0, nullptr}
+#define EXEDATA_PE_ENTRY(cpu, name)
+#define EXEDATA_LE_ENTRY(cpu, name)	{cpu, STRPOOL_OFFSET(EXEData_strpool_t, s)},
+#include "EXEData_data.h"
+
+	{0, 0}
 };
 
+// Perfect hash indexes.
+PerfectHash EXEDataPrivate::machineTypes_PE_hash;
+PerfectHash EXEDataPrivate::machineTypes_LE_hash;
+pthread_once_t EXEDataPrivate::once_control = PTHREAD_ONCE_INIT;
+
 /**
- * bsearch() comparison function for MachineType.
- * @param a
- * @param b
- * @return
+ * Build the perfect hash indexes.
+ * Called by pthread_once().
  */
-int RP_C_API EXEDataPrivate::MachineType_compar(const void *a, const void *b)
+void EXEDataPrivate::initHashes(void)
 {
-	const uint16_t cpu1 = static_cast<const MachineType*>(a)->cpu;
-	const uint16_t cpu2 = static_cast<const MachineType*>(b)->cpu;
-	if (cpu1 < cpu2) return -1;
-	if (cpu1 > cpu2) return 1;
-	return 0;
+	machineTypes_PE_hash.init(machineTypes_PE,
+		ARRAY_SIZE(machineTypes_PE)-1, &MachineType::cpu);
+	machineTypes_LE_hash.init(machineTypes_LE,
+		ARRAY_SIZE(machineTypes_LE)-1, &MachineType::cpu);
 }
 
 /**
@@ -128,15 +116,10 @@ int RP_C_API EXEDataPrivate::MachineType_compar(const void *a, const void *b)
  */
 const char *EXEData::lookup_pe_cpu(uint16_t cpu)
 {
-	// Do a binary search.
-	const EXEDataPrivate::MachineType key = {cpu, nullptr};
-	const EXEDataPrivate::MachineType *res =
-		static_cast<const EXEDataPrivate::MachineType*>(bsearch(&key,
-			EXEDataPrivate::machineTypes_PE,
-			ARRAY_SIZE(EXEDataPrivate::machineTypes_PE)-1,
-			sizeof(EXEDataPrivate::MachineType),
-			EXEDataPrivate::MachineType_compar));
-	return (res ? res->name : nullptr);
+	// Look up the key in the perfect hash index.
+	pthread_once(&EXEDataPrivate::once_control, EXEDataPrivate::initHashes);
+	const int idx = EXEDataPrivate::machineTypes_PE_hash.find(cpu);
+	return (idx >= 0 ? STRPOOL_GET(EXEDataPrivate::strpool, EXEDataPrivate::machineTypes_PE[idx].name) : nullptr);
 }
 
 /**
@@ -146,15 +129,10 @@ const char *EXEData::lookup_pe_cpu(uint16_t cpu)
  */
 const char *EXEData::lookup_le_cpu(uint16_t cpu)
 {
-	// Do a binary search.
-	const EXEDataPrivate::MachineType key = {cpu, nullptr};
-	const EXEDataPrivate::MachineType *res =
-		static_cast<const EXEDataPrivate::MachineType*>(bsearch(&key,
-			EXEDataPrivate::machineTypes_LE,
-			ARRAY_SIZE(EXEDataPrivate::machineTypes_LE)-1,
-			sizeof(EXEDataPrivate::MachineType),
-			EXEDataPrivate::MachineType_compar));
-	return (res ? res->name : nullptr);
+	// Look up the key in the perfect hash index.
+	pthread_once(&EXEDataPrivate::once_control, EXEDataPrivate::initHashes);
+	const int idx = EXEDataPrivate::machineTypes_LE_hash.find(cpu);
+	return (idx >= 0 ? STRPOOL_GET(EXEDataPrivate::strpool, EXEDataPrivate::machineTypes_LE[idx].name) : nullptr);
 }
 
 }
@@ -0,0 +1,72 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libromdata)                       *
+ * EXEData_data.h: DOS/Windows executable data.                            *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+// NOTE: This file is included multiple times by EXEData.cpp
+// to build the string pool and the machine type tables.
+// Each entry must be on its own line. (See strpool.h.)
+
+// PE machine types.
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_I386,	"Intel i386")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_R3000_BE,	"MIPS R3000 (big-endian)")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_R3000,	"MIPS R3000")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_R4000,	"MIPS R4000")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_R10000,	"MIPS R10000")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_WCEMIPSV2,	"MIPS (WCE v2)")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_ALPHA,	"DEC Alpha AXP")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_SH3,	"Hitachi SH3")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_SH3DSP,	"Hitachi SH3 DSP")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_SH3E,	"Hitachi SH3E")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_SH4,	"Hitachi SH4")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_SH5,	"Hitachi SH5")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_ARM,	"ARM")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_THUMB,	"ARM Thumb")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_ARMNT,	"ARM Thumb-2")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_AM33,	"Matsushita AM33")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_POWERPC,	"PowerPC")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_POWERPCFP,	"PowerPC with FPU")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_POWERPCBE,	"PowerPC (big-endian)")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_IA64,	"Intel Itanium")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_MIPS16,	"MIPS16")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_M68K,	"Motorola 68000")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_PA_RISC,	"PA-RISC")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_ALPHA64,	"DEC Alpha AXP (64-bit)")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_MIPSFPU,	"MIPS with FPU")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_MIPSFPU16,	"MIPS16 with FPU")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_TRICORE,	"Infineon TriCore")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_CEF,	"Common Executable Format")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_EBC,	"EFI Byte Code")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_AMD64,	"AMD64")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_M32R,	"Mitsubishi M32R")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_ARM64,	"ARM (64-bit)")
+EXEDATA_PE_ENTRY(IMAGE_FILE_MACHINE_CEE,	"MSIL")
+
+// LE machine types.
+EXEDATA_LE_ENTRY(LE_CPU_80286,		"Intel i286")
+EXEDATA_LE_ENTRY(LE_CPU_80386,		"Intel i386")
+EXEDATA_LE_ENTRY(LE_CPU_80486,		"Intel i486")
+EXEDATA_LE_ENTRY(LE_CPU_80586,		"Intel Pentium")
+EXEDATA_LE_ENTRY(LE_CPU_i860_N10,	"Intel i860 XR (N10)")
+EXEDATA_LE_ENTRY(LE_CPU_i860_N11,	"Intel i860 XP (N11)")
+EXEDATA_LE_ENTRY(LE_CPU_MIPS_I,		"MIPS Mark I (R2000, R3000")
+EXEDATA_LE_ENTRY(LE_CPU_MIPS_II,	"MIPS Mark II (R6000)")
+EXEDATA_LE_ENTRY(LE_CPU_MIPS_III,	"MIPS Mark III (R4000)")
+
+#undef EXEDATA_PE_ENTRY
+#undef EXEDATA_LE_ENTRY
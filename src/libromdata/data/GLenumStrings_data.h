@@ -0,0 +1,251 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libromdata)                       *
+ * GLenumStrings_data.h: OpenGL string tables.                             *
+ *                                                                         *
+ * Copyright (c) 2016-2018 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+// NOTE: This file is included multiple times by GLenumStrings.cpp
+// to build the string pool and the GLenum table.
+// Each entry must be on its own line. (See strpool.h.)
+
+// NOTE: Leaving the "GL_" prefix off of the strings.
+
+GLENUMSTRINGS_ENTRY(BYTE)
+GLENUMSTRINGS_ENTRY(UNSIGNED_BYTE)
+GLENUMSTRINGS_ENTRY(SHORT)
+GLENUMSTRINGS_ENTRY(UNSIGNED_SHORT)
+GLENUMSTRINGS_ENTRY(INT)
+GLENUMSTRINGS_ENTRY(UNSIGNED_INT)
+GLENUMSTRINGS_ENTRY(FLOAT)
+GLENUMSTRINGS_ENTRY(HALF_FLOAT)
+GLENUMSTRINGS_ENTRY(STENCIL_INDEX)
+GLENUMSTRINGS_ENTRY(DEPTH_COMPONENT)
+GLENUMSTRINGS_ENTRY(RED)
+GLENUMSTRINGS_ENTRY(GREEN)
+GLENUMSTRINGS_ENTRY(BLUE)
+GLENUMSTRINGS_ENTRY(RGB)
+GLENUMSTRINGS_ENTRY(RGBA)
+GLENUMSTRINGS_ENTRY(LUMINANCE)
+GLENUMSTRINGS_ENTRY(LUMINANCE_ALPHA)
+GLENUMSTRINGS_ENTRY(R3_G3_B2)
+GLENUMSTRINGS_ENTRY(UNSIGNED_BYTE_3_3_2)
+GLENUMSTRINGS_ENTRY(UNSIGNED_SHORT_4_4_4_4)
+GLENUMSTRINGS_ENTRY(UNSIGNED_SHORT_5_5_5_1)
+GLENUMSTRINGS_ENTRY(UNSIGNED_INT_8_8_8_8)
+GLENUMSTRINGS_ENTRY(UNSIGNED_INT_10_10_10_2)
+GLENUMSTRINGS_ENTRY(LUMINANCE4)
+GLENUMSTRINGS_ENTRY(LUMINANCE8)
+GLENUMSTRINGS_ENTRY(LUMINANCE12)
+GLENUMSTRINGS_ENTRY(LUMINANCE16)
+GLENUMSTRINGS_ENTRY(LUMINANCE4_ALPHA4)
+GLENUMSTRINGS_ENTRY(LUMINANCE6_ALPHA2)
+GLENUMSTRINGS_ENTRY(LUMINANCE8_ALPHA8)
+GLENUMSTRINGS_ENTRY(LUMINANCE12_ALPHA4)
+GLENUMSTRINGS_ENTRY(LUMINANCE12_ALPHA12)
+GLENUMSTRINGS_ENTRY(LUMINANCE16_ALPHA16)
+GLENUMSTRINGS_ENTRY(INTENSITY)
+GLENUMSTRINGS_ENTRY(INTENSITY4)
+GLENUMSTRINGS_ENTRY(INTENSITY8)
+GLENUMSTRINGS_ENTRY(INTENSITY12)
+GLENUMSTRINGS_ENTRY(INTENSITY16)
+GLENUMSTRINGS_ENTRY(RGB4)
+GLENUMSTRINGS_ENTRY(RGB5)
+GLENUMSTRINGS_ENTRY(RGB8)
+GLENUMSTRINGS_ENTRY(RGB10)
+GLENUMSTRINGS_ENTRY(RGB12)
+GLENUMSTRINGS_ENTRY(RGB16)
+GLENUMSTRINGS_ENTRY(RGBA2)
+GLENUMSTRINGS_ENTRY(RGBA4)
+GLENUMSTRINGS_ENTRY(RGB5_A1)
+GLENUMSTRINGS_ENTRY(RGBA8)
+GLENUMSTRINGS_ENTRY(RGB10_A2)
+GLENUMSTRINGS_ENTRY(RGBA12)
+GLENUMSTRINGS_ENTRY(RGBA16)
+GLENUMSTRINGS_ENTRY(BGR)
+GLENUMSTRINGS_ENTRY(BGRA)
+GLENUMSTRINGS_ENTRY(DEPTH_COMPONENT16)
+GLENUMSTRINGS_ENTRY(DEPTH_COMPONENT24)
+GLENUMSTRINGS_ENTRY(DEPTH_COMPONENT32)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RED)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RG)
+GLENUMSTRINGS_ENTRY(RG)
+GLENUMSTRINGS_ENTRY(RG_INTEGER)
+GLENUMSTRINGS_ENTRY(R8)
+GLENUMSTRINGS_ENTRY(R16)
+GLENUMSTRINGS_ENTRY(RG8)
+GLENUMSTRINGS_ENTRY(RG16)
+GLENUMSTRINGS_ENTRY(R16F)
+GLENUMSTRINGS_ENTRY(R32F)
+GLENUMSTRINGS_ENTRY(RG16F)
+GLENUMSTRINGS_ENTRY(RG32F)
+GLENUMSTRINGS_ENTRY(R8I)
+GLENUMSTRINGS_ENTRY(R8UI)
+GLENUMSTRINGS_ENTRY(R16I)
+GLENUMSTRINGS_ENTRY(R16UI)
+GLENUMSTRINGS_ENTRY(R32I)
+GLENUMSTRINGS_ENTRY(R32UI)
+GLENUMSTRINGS_ENTRY(RG8I)
+GLENUMSTRINGS_ENTRY(RG8UI)
+GLENUMSTRINGS_ENTRY(RG16I)
+GLENUMSTRINGS_ENTRY(RG16UI)
+GLENUMSTRINGS_ENTRY(RG32I)
+GLENUMSTRINGS_ENTRY(RG32UI)
+GLENUMSTRINGS_ENTRY(UNSIGNED_BYTE_2_3_3_REV)
+GLENUMSTRINGS_ENTRY(UNSIGNED_SHORT_5_6_5)
+GLENUMSTRINGS_ENTRY(UNSIGNED_SHORT_5_6_5_REV)
+GLENUMSTRINGS_ENTRY(UNSIGNED_SHORT_4_4_4_4_REV)
+GLENUMSTRINGS_ENTRY(UNSIGNED_SHORT_1_5_5_5_REV)
+GLENUMSTRINGS_ENTRY(UNSIGNED_INT_8_8_8_8_REV)
+GLENUMSTRINGS_ENTRY(UNSIGNED_INT_2_10_10_10_REV)
+GLENUMSTRINGS_ENTRY(RGB_S3TC)
+GLENUMSTRINGS_ENTRY(RGB4_S3TC)
+GLENUMSTRINGS_ENTRY(RGBA_S3TC)
+GLENUMSTRINGS_ENTRY(RGBA4_S3TC)
+GLENUMSTRINGS_ENTRY(RGBA_DXT5_S3TC)
+GLENUMSTRINGS_ENTRY(RGBA4_DXT5_S3TC)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGB_S3TC_DXT1_EXT)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_S3TC_DXT1_EXT)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_S3TC_DXT3_EXT)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_S3TC_DXT5_EXT)
+GLENUMSTRINGS_ENTRY(COMPRESSED_ALPHA)
+GLENUMSTRINGS_ENTRY(COMPRESSED_LUMINANCE)
+GLENUMSTRINGS_ENTRY(COMPRESSED_LUMINANCE_ALPHA)
+GLENUMSTRINGS_ENTRY(COMPRESSED_INTENSITY)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGB)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA)
+GLENUMSTRINGS_ENTRY(DEPTH_STENCIL)
+GLENUMSTRINGS_ENTRY(UNSIGNED_INT_24_8)
+GLENUMSTRINGS_ENTRY(RGBA32F)
+GLENUMSTRINGS_ENTRY(RGB32F)
+GLENUMSTRINGS_ENTRY(RGBA16F)
+GLENUMSTRINGS_ENTRY(RGB16F)
+GLENUMSTRINGS_ENTRY(DEPTH24_STENCIL8)
+GLENUMSTRINGS_ENTRY(R11F_G11F_B10F)
+GLENUMSTRINGS_ENTRY(UNSIGNED_INT_10F_11F_11F_REV)
+GLENUMSTRINGS_ENTRY(RGB9_E5)
+GLENUMSTRINGS_ENTRY(UNSIGNED_INT_5_9_9_9_REV)
+GLENUMSTRINGS_ENTRY(SRGB)
+GLENUMSTRINGS_ENTRY(SRGB8)
+GLENUMSTRINGS_ENTRY(SRGB_ALPHA)
+GLENUMSTRINGS_ENTRY(SRGB8_ALPHA8)
+GLENUMSTRINGS_ENTRY(SLUMINANCE_ALPHA)
+GLENUMSTRINGS_ENTRY(SLUMINANCE8_ALPHA8)
+GLENUMSTRINGS_ENTRY(SLUMINANCE)
+GLENUMSTRINGS_ENTRY(SLUMINANCE8)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB_ALPHA)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SLUMINANCE)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SLUMINANCE_ALPHA)
+
+// GL_EXT_texture_compression_latc
+GLENUMSTRINGS_ENTRY(COMPRESSED_LUMINANCE_LATC1_EXT)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SIGNED_LUMINANCE_LATC1_EXT)
+GLENUMSTRINGS_ENTRY(COMPRESSED_LUMINANCE_ALPHA_LATC2_EXT)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SIGNED_LUMINANCE_ALPHA_LATC2_EXT)
+
+GLENUMSTRINGS_ENTRY(DEPTH_COMPONENT32F)
+GLENUMSTRINGS_ENTRY(DEPTH32F_STENCIL8)
+GLENUMSTRINGS_ENTRY(STENCIL_INDEX1)
+GLENUMSTRINGS_ENTRY(STENCIL_INDEX4)
+GLENUMSTRINGS_ENTRY(STENCIL_INDEX8)
+GLENUMSTRINGS_ENTRY(STENCIL_INDEX16)
+GLENUMSTRINGS_ENTRY(RGB565)
+GLENUMSTRINGS_ENTRY(ETC1_RGB8_OES)
+GLENUMSTRINGS_ENTRY(RGBA32UI)
+GLENUMSTRINGS_ENTRY(RGB32UI)
+GLENUMSTRINGS_ENTRY(RGBA16UI)
+GLENUMSTRINGS_ENTRY(RGB16UI)
+GLENUMSTRINGS_ENTRY(RGBA8UI)
+GLENUMSTRINGS_ENTRY(RGB8UI)
+GLENUMSTRINGS_ENTRY(RGBA32I)
+GLENUMSTRINGS_ENTRY(RGB32I)
+GLENUMSTRINGS_ENTRY(RGBA16I)
+GLENUMSTRINGS_ENTRY(RGB16I)
+GLENUMSTRINGS_ENTRY(RGBA8I)
+GLENUMSTRINGS_ENTRY(RGB8I)
+GLENUMSTRINGS_ENTRY(RED_INTEGER)
+GLENUMSTRINGS_ENTRY(GREEN_INTEGER)
+GLENUMSTRINGS_ENTRY(BLUE_INTEGER)
+GLENUMSTRINGS_ENTRY(ALPHA_INTEGER)
+GLENUMSTRINGS_ENTRY(RGB_INTEGER)
+GLENUMSTRINGS_ENTRY(RGBA_INTEGER)
+GLENUMSTRINGS_ENTRY(BGR_INTEGER)
+GLENUMSTRINGS_ENTRY(BGRA_INTEGER)
+GLENUMSTRINGS_ENTRY(INT_2_10_10_10_REV)
+GLENUMSTRINGS_ENTRY(FLOAT_32_UNSIGNED_INT_24_8_REV)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RED_RGTC1)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SIGNED_RED_RGTC1)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RG_RGTC2)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SIGNED_RG_RGTC2)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_BPTC_UNORM)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB_ALPHA_BPTC_UNORM)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGB_BPTC_SIGNED_FLOAT)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT)
+GLENUMSTRINGS_ENTRY(R8_SNORM)
+GLENUMSTRINGS_ENTRY(RG8_SNORM)
+GLENUMSTRINGS_ENTRY(RGB8_SNORM)
+GLENUMSTRINGS_ENTRY(RGBA8_SNORM)
+GLENUMSTRINGS_ENTRY(R16_SNORM)
+GLENUMSTRINGS_ENTRY(RG16_SNORM)
+GLENUMSTRINGS_ENTRY(RGB16_SNORM)
+GLENUMSTRINGS_ENTRY(RGBA16_SNORM)
+GLENUMSTRINGS_ENTRY(RGB10_A2UI)
+
+// ETC2
+GLENUMSTRINGS_ENTRY(COMPRESSED_R11_EAC)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SIGNED_R11_EAC)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RG11_EAC)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SIGNED_RG11_EAC)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGB8_ETC2)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_ETC2)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA8_ETC2_EAC)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_ALPHA8_ETC2_EAC)
+
+// GL_KHR_texture_compression_astc_hdr
+// GL_KHR_texture_compression_astc_ldr
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_ASTC_4x4_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_ASTC_5x4_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_ASTC_5x5_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_ASTC_6x5_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_ASTC_6x6_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_ASTC_8x5_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_ASTC_8x6_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_ASTC_8x8_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_ASTC_10x5_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_ASTC_10x6_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_ASTC_10x8_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_ASTC_10x10_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_ASTC_12x10_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_RGBA_ASTC_12x12_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR)
+GLENUMSTRINGS_ENTRY(COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR)
+
+#undef GLENUMSTRINGS_ENTRY
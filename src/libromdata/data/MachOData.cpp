@@ -36,10 +36,10 @@ const char *MachOData::lookup_cpu_type(uint32_t cputype)
 	const unsigned int abi = (cputype >> 24) & 1;
 	const unsigned int cpu = (cputype & 0xFFFFFF);
 
-	static const char *const cpu_tbl[2][19] = {
+	static const char cpu_tbl[2][19][11] = {
 		{
 			// 32-bit CPUs
-			nullptr, "VAX", nullptr, "ROMP",
+			"", "VAX", "", "ROMP",
 			"NS32032", "NS32332", "MC680x0", "i386",
 			"MIPS", "NS32532", "MC98000", "HPPA",
 			"ARM", "MC88000", "SPARC", "i860",
@@ -47,11 +47,11 @@ const char *MachOData::lookup_cpu_type(uint32_t cputype)
 		},
 		{
 			// 64-bit CPUs
-			nullptr, nullptr, nullptr, nullptr,
-			nullptr, nullptr, nullptr, "amd64",
-			nullptr, nullptr, nullptr, nullptr,
-			"ARM64", nullptr, nullptr, nullptr,
-			nullptr, nullptr, "PowerPC 64"
+			"", "", "", "",
+			"", "", "", "amd64",
+			"", "", "", "",
+			"ARM64", "", "", "",
+			"", "", "PowerPC 64"
 		}
 	};
 
@@ -60,7 +60,8 @@ const char *MachOData::lookup_cpu_type(uint32_t cputype)
 		s_cpu = cpu_tbl[abi][cpu];
 	}
 
-	return s_cpu;
+	// NOTE: Empty strings in the table indicate an unknown CPU.
+	return (s_cpu && s_cpu[0] != '\0') ? s_cpu : nullptr;
 }
 
 /**
@@ -80,8 +81,8 @@ const char *MachOData::lookup_cpu_subtype(uint32_t cputype, uint32_t cpusubtype)
 			break;
 
 		case CPU_TYPE_VAX: {
-			static const char *const cpu_subtype_vax_tbl[] = {
-				nullptr, "VAX-11/780", "VAX-11/785", "VAX-11/750",
+			static const char cpu_subtype_vax_tbl[][13] = {
+				"", "VAX-11/780", "VAX-11/785", "VAX-11/750",
 				"VAX-11/730", "MicroVAX I", "MicroVAX II", "VAX 8200",
 				"VAX 8500", "VAX 8600", "VAX 8650", "VAX 8800",
 				"MicroVAX III"
@@ -93,8 +94,8 @@ const char *MachOData::lookup_cpu_subtype(uint32_t cputype, uint32_t cpusubtype)
 		}
 
 		case CPU_TYPE_MC680x0: {
-			static const char *const cpu_subtype_m68k_tbl[] = {
-				nullptr, nullptr, "MC68040", "MC68030"
+			static const char cpu_subtype_m68k_tbl[][8] = {
+				"", "", "MC68040", "MC68030"
 			};
 			if (cpusubtype < ARRAY_SIZE(cpu_subtype_m68k_tbl)) {
 				s_cpu_subtype = cpu_subtype_m68k_tbl[cpusubtype];
@@ -212,8 +213,8 @@ const char *MachOData::lookup_cpu_subtype(uint32_t cputype, uint32_t cpusubtype)
 		}
 
 		case CPU_TYPE_MIPS: {
-			static const char *const cpu_subtype_mips_tbl[] = {
-				nullptr, "R2300", "R2600", "R2800",
+			static const char cpu_subtype_mips_tbl[][7] = {
+				"", "R2300", "R2600", "R2800",
 				"R2000a", "R2000", "R3000a", "R3000"
 			};
 			if (cpusubtype < ARRAY_SIZE(cpu_subtype_mips_tbl)) {
@@ -229,8 +230,8 @@ const char *MachOData::lookup_cpu_subtype(uint32_t cputype, uint32_t cpusubtype)
 			break;
 
 		case CPU_TYPE_HPPA: {
-			static const char *const cpu_subtype_hppa_tbl[] = {
-				nullptr, "HP/PA 7100", "HP/PA 7100LC"
+			static const char cpu_subtype_hppa_tbl[][13] = {
+				"", "HP/PA 7100", "HP/PA 7100LC"
 			};
 			if (cpusubtype < ARRAY_SIZE(cpu_subtype_hppa_tbl)) {
 				s_cpu_subtype = cpu_subtype_hppa_tbl[cpusubtype];
@@ -239,8 +240,8 @@ const char *MachOData::lookup_cpu_subtype(uint32_t cputype, uint32_t cpusubtype)
 		}
 
 		case CPU_TYPE_MC88000: {
-			static const char *const cpu_subtype_m88k_tbl[] = {
-				nullptr, "MC88100", "MC88110"
+			static const char cpu_subtype_m88k_tbl[][8] = {
+				"", "MC88100", "MC88110"
 			};
 			if (cpusubtype < ARRAY_SIZE(cpu_subtype_m88k_tbl)) {
 				s_cpu_subtype = cpu_subtype_m88k_tbl[cpusubtype];
@@ -252,9 +253,9 @@ const char *MachOData::lookup_cpu_subtype(uint32_t cputype, uint32_t cpusubtype)
 			if (abi && cpusubtype == CPU_SUBTYPE_ARM64_V8) {
 				s_cpu_subtype = "ARMv8";
 			} else if (!abi) {
-				static const char *const cpu_subtype_arm_tbl[] = {
-					nullptr, nullptr, nullptr, nullptr,
-					nullptr, "ARMv4T", "ARMv6", "ARMv5TEJ",
+				static const char cpu_subtype_arm_tbl[][9] = {
+					"", "", "", "",
+					"", "ARMv4T", "ARMv6", "ARMv5TEJ",
 					"XScale", "ARMv7", "ARMv7f", "ARMv7s",
 					"ARMv7k", "ARMv8", "ARMv6-M", "ARMv7-M",
 					"ARMv7E-M"
@@ -267,8 +268,8 @@ const char *MachOData::lookup_cpu_subtype(uint32_t cputype, uint32_t cpusubtype)
 		}
 
 		case CPU_TYPE_POWERPC: {
-			static const char *const cpu_subtype_ppc_tbl[] = {
-				nullptr, "601", "602", "603",
+			static const char cpu_subtype_ppc_tbl[][6] = {
+				"", "601", "602", "603",
 				"603e", "603ev", "604", "604e",
 				"620", "750", "7400", "7450"
 			};
@@ -281,7 +282,8 @@ const char *MachOData::lookup_cpu_subtype(uint32_t cputype, uint32_t cpusubtype)
 		}
 	}
 
-	return s_cpu_subtype;
+	// NOTE: Empty strings in the tables indicate an unknown subtype.
+	return (s_cpu_subtype && s_cpu_subtype[0] != '\0') ? s_cpu_subtype : nullptr;
 }
 
 }
@@ -20,6 +20,7 @@
  ***************************************************************************/
 
 #include "NESMappers.hpp"
+#include "strpool.h"
 
 // C includes.
 #include <stdint.h>
@@ -30,6 +31,14 @@
 
 namespace LibRomData {
 
+// String pool.
+struct NESMappers_strpool_t {
+	char STRPOOL_NULL[1];
+#define NESMAPPERS_ENTRY(name)		STRPOOL_MEMBER(s, name)
+#define NESMAPPERS_NULL_ENTRY()
+#include "NESMappers_data.h"
+};
+
 /**
  * References:
  * - https://wiki.nesdev.com/w/index.php/Mapper
@@ -45,9 +54,11 @@ class NESMappersPrivate
 		RP_DISABLE_COPY(NESMappersPrivate)
 
 	public:
+		static const NESMappers_strpool_t strpool;
+
 		// iNES mapper list.
 		struct MapperEntry {
-			const char *name;
+			uint16_t name;		// Offset in strpool.
 			// TODO: Add manufacturers.
 			//const char *manufacturer;
 		};
@@ -105,6 +116,15 @@ class NESMappersPrivate
 		static int RP_C_API SubmapperEntry_compar(const void *a, const void *b);
 };
 
+// String pool.
+const NESMappers_strpool_t NESMappersPrivate::strpool = {
+	"",
+#define NESMAPPERS_ENTRY(name)		STRPOOL_STRING(name)
+#define NESMAPPERS_NULL_ENTRY()
+#include "NESMappers_data.h"
+};
+static_assert(sizeof(NESMappers_strpool_t) <= 0xFFFF, "NESMappers_strpool_t is too big for 16-bit offsets.");
+
 /**
  * iNES mapper list.
  * TODO: Add more fields:
@@ -113,313 +133,9 @@ class NESMappersPrivate
  * - Extra VRAM for 4 screens
  */
 const NESMappersPrivate::MapperEntry NESMappersPrivate::mappers[] = {
-	// Mappers 0-9
-	{"NROM"},
-	{"SxROM (MMC1)"},
-	{"UxROM"},
-	{"CNROM"},
-	{"TxROM (MMC3, MMC6)"},
-	{"ExROM (MMC5)"},
-	{"FFE #6"},
-	{"AxROM"},
-	{"FFE #8"},
-	{"PxROM (MMC2)"},
-
-	// Mappers 10-19
-	{"FxROM (MMC4)"},
-	{"Color Dreams"},
-	{"MMC3 clone"}, // this is also marked as another FFE mapper. conflict?
-	{"CPROM"},
-	{"MMC3 clone"},
-	{"Multicart (unlicensed)"},
-	{"FCG-x"},
-	{"FFE #17"},
-	{"Jaleco SS88006"},
-	{"Namco 129/163"},
-
-	// Mappers 20-29
-	{"Famicom Disk System"}, // this isn't actually used, as FDS roms are stored in their own format.
-	{"VRC4a, VRC4c"},
-	{"VRC2a"},
-	{"VRC4e, VRC4f, VRC2b"},
-	{"VRC6a"},
-	{"VRC4b, VRC4d"},
-	{"VRC6b"},
-	{"VRC4 variant"}, //investigate
-	{"Multicart/Homebrew"},
-	{"Homebrew"},
-
-	// Mappers 30-39
-	{"UNROM 512 (Homebrew)"},
-	{"NSF (Homebrew)"},
-	{"Irem G-101"},
-	{"Taito TC0190"},
-	{"BNROM, NINA-001"},
-	{"JY Company subset"},
-	{"TXC PCB 01-22000-400"},
-	{"MMC3 multicart (official)"},
-	{"GNROM variant"},
-	{"BNROM variant"},
-
-	// Mappers 40-49
-	{"CD4020 (FDS conversion) (unlicensed)"},
-	{"Caltron 6-in-1"},
-	{"FDS conversion (unlicensed)"},
-	{"FDS conversion (unlicensed)"},
-	{"MMC3 clone"},
-	{"MMC3 multicart (unlicensed)"},
-	{"Rumble Station"},
-	{"MMC3 multicart (official)"},
-	{"Taito TC0690"},
-	{"MMC3 multicart (unlicensed)"},
-
-	// Mappers 50-59
-	{"FDS conversion (unlicensed)"},
-	{nullptr},
-	{"MMC3 clone"},
-	{nullptr},
-	{"Novel Diamond"},	// conflicting information
-	{nullptr},
-	{nullptr},
-	{"Multicart (unlicensed)"},
-	{"Multicart (unlicensed)"},
-	{nullptr},
-
-	// Mappers 60-69
-	{"Multicart (unlicensed)"},
-	{"Multicart (unlicensed)"},
-	{"Multicart (unlicensed)"},
-	{nullptr},
-	{"Tengen RAMBO-1"},
-	{"Irem H3001"},
-	{"GxROM, MHROM"},
-	{"Sunsoft-3"},
-	{"Sunsoft-4"},
-	{"Sunsoft FME-7"},
-
-	// Mappers 70-79
-	{"Family Trainer"},
-	{"Codemasters (UNROM clone)"},
-	{"Jaleco JF-17"},
-	{"Konami VRC3"},
-	{"MMC3 clone"},
-	{"Konami VRC1"},
-	{"Namcot 108 variant"},
-	{nullptr},
-	{"Holy Diver; Uchuusen - Cosmo Carrier"},
-	{"NINA-03, NINA-06"},
-
-	// Mappers 80-89
-	{"Taito X1-005"},
-	{nullptr},
-	{"Taito X1-017"},
-	{"Cony Soft"},
-	{"PC-SMB2J"},
-	{"Konami VRC7"},
-	{"Jaleco JF-13"},
-	{nullptr},
-	{"Namcot 118 variant"},
-	{"Sunsoft-2 (Sunsoft-3 board)"},	
-
-	// Mappers 90-99
-	{"JY Company (simple nametable control)"},
-	{nullptr},
-	{nullptr},
-	{"Sunsoft-2 (Sunsoft-3R board)"},
-	{"HVC-UN1ROM"},
-	{"NAMCOT-3425"},
-	{"Oeka Kids"},
-	{"Irem TAM-S1"},
-	{nullptr},
-	{"CNROM (Vs. System)"},
-
-	// Mappers 100-109
-	{"MMC3 variant (hacked ROMs)"},	// Also used for UNIF
-	{"Jaleco JF-10 (misdump)"},
-	{nullptr},
-	{nullptr},
-	{nullptr},
-	{"NES-EVENT (Nintendo World Championships 1990)"},
-	{nullptr},
-	{"Magic Dragon"},
-	{nullptr},
-	{nullptr},
-
-	// Mappers 110-119
-	{nullptr},
-	{"Cheapocabra GT-ROM 512k flash board"},	// Membler Industries
-	{"Namcot 118 variant"},
-	{"NINA-03/06 multicart"},
-	{nullptr},
-	{"MMC3 clone (Carson)"},
-	{"Copy-protected bootleg mapper"},
-	{nullptr},
-	{"TxSROM"},
-	{"TQROM"},
-
-	// Mappers 120-129
-	{nullptr},
-	{nullptr},
-	{nullptr},
-	{nullptr},
-	{nullptr},
-	{nullptr},
-	{nullptr},
-	{nullptr},
-	{nullptr},
-	{nullptr},
-
-	// Mappers 130-139
-	{nullptr},
-	{nullptr},
-	{nullptr},
-	{"Sachen Jovial Race"},
-	{nullptr},
-	{nullptr},
-	{nullptr},
-	{"Sachen 8259D"},
-	{"Sachen 8259B"},
-	{"Sachen 8259C"},
-
-	// Mappers 140-149
-	{"Jaleco JF-11, JF-14 (GNROM variant)"},
-	{"Sachen 8259A"},
-	{nullptr},
-	{"Copy-protected NROM"},
-	{"Death Race (Color Dreams variant)"},
-	{"Sidewinder (CNROM clone)"},
-	{"Galactic Crusader (NINA-06 clone)"},
-	{"Sachen Challenge of the Dragon"},
-	{"NINA-06 variant"},
-	{"SA-0036 (CNROM clone)"},
-
-	// Mappers 150-159
-	{"Sachen 74LS374N (corrected)"},
-	{"VRC1 (Vs. System)"},
-	{nullptr},
-	{"Bandai LZ93D50 with SRAM"},
-	{"NAMCOT-3453"},
-	{"MMC1A"},
-	{"DIS23C01"},
-	{"Datach Joint ROM System"},
-	{"Tengen 800037"},
-	{"Bandai LZ93D50 with 24C01"},
-
-	// Mappers 160-169
-	{nullptr},
-	{nullptr},
-	{nullptr},
-	{"Nanjing"},
-	{nullptr},
-	{nullptr},
-	{"SUBOR"},
-	{"SUBOR"},
-	{"Racermate Challenge 2"},
-	{"Yuxing"},
-
-	// Mappers 170-179
-	{nullptr},
-	{nullptr},
-	{nullptr},
-	{nullptr},
-	{"Multicart (unlicensed)"},
-	{nullptr},
-	{"WaiXing (BMCFK23C?)"},
-	{nullptr},
-	{"Education / WaiXing / HengGe"},
-	{nullptr},
-
-	// Mappers 180-189
-	{"Crazy Climber (UNROM clone)"},
-	{nullptr},
-	{"MMC3 variant"},
-	{"Suikan Pipe (VRC4e clone)"},
-	{"Sunsoft-1"},
-	{"CNROM with weak copy protection"},
-	{"Study Box"},
-	{nullptr},
-	{"Bandai Karaoke Studio"},
-	{"Thunder Warrior (MMC3 clone)"},
-
-	// Mappers 190-199
-	{nullptr},
-	{"MMC3 clone"},
-	{"MMC3 clone"},
-	{"NTDEC TC-112"},
-	{"MMC3 clone"},	// same as 195 on NES 2.0
-	{"MMC3 clone"},	// same as 194 on NES 2.0
-	{"MMC3 clone"},
-	{nullptr},
-	{nullptr},
-	{nullptr},
-
-	// Mappers 200-209
-	{"Multicart (unlicensed)"},
-	{"NROM-256 multicart (unlicensed)"},
-	{"150-in-1 multicart (unlicensed)"},
-	{"35-in-1 multicart (unlicensed)"},
-	{nullptr},
-	{"MMC3 multicart (unlicensed)"},
-	{"DxROM (Tengen MIMIC-1, Namcot 118)"},
-	{"Fudou Myouou Den"},
-	{nullptr},
-	{"JY Company (MMC2/MMC4 clone)"},
-
-	// Mappers 210-219
-	{"Namcot 175, 340"},
-	{"JY Company (extended nametable control)"},
-	{nullptr},
-	{nullptr},
-	{nullptr},
-	{"MMC3 clone"},
-	{nullptr},
-	{nullptr},
-	{"Magic Floor (homebrew)"},
-	{"UNL A9746"},
-
-	// Mappers 220-229
-	{"Summer Carnival '92 - Recca"},
-	{nullptr},
-	{"CTC-31 (VRC2 + 74xx)"},
-	{nullptr},
-	{nullptr},
-	{"Multicart (unlicensed)"},
-	{"Multicart (unlicensed)"},
-	{"Multicart (unlicensed)"},
-	{"Active Enterprises"},
-	{"BMC 31-IN-1"},
-
-	// Mappers 230-239
-	{"Multicart (unlicensed)"},
-	{"Multicart (unlicensed)"},
-	{"Codemasters Quattro"},
-	{"Multicart (unlicensed)"},
-	{"Maxi 15 multicart"},
-	{nullptr},
-	{nullptr},
-	{"Teletubbies 420-in-1 multicart"},
-	{nullptr},
-	{nullptr},
-
-	// Mappers 240-249
-	{"Multicart (unlicensed)"},
-	{"BNROM (similar to 034)"},
-	{"Unlicensed"},
-	{"Sachen 74LS374N"},
-	{nullptr},
-	{"MMC3 clone"},
-	{"Feng Shen Bang - Zhu Lu Zhi Zhan"},
-	{nullptr},
-	{"Incorrect assignment (should be 115)"},
-	{nullptr},
-
-	// Mappers 250-255
-	{"Nitra (MMC3 clone)"},
-	{nullptr},
-	{"WaiXing - Sangokushi"},
-	{nullptr},
-	{"Pikachu Y2K of crypted ROMs"},
-	{nullptr},
+#define NESMAPPERS_ENTRY(name)		{STRPOOL_OFFSET(NESMappers_strpool_t, s)},
+#define NESMAPPERS_NULL_ENTRY()		{0},
+#include "NESMappers_data.h"
 };
 
 /** Submappers. **/
@@ -561,7 +277,7 @@ const char *NESMappers::lookup_ines(int mapper)
 		return nullptr;
 	}
 
-	return NESMappersPrivate::mappers[mapper].name;
+	return STRPOOL_GET(NESMappersPrivate::strpool, NESMappersPrivate::mappers[mapper].name);
 }
 
 /**
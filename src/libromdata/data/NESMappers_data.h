@@ -0,0 +1,334 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libromdata)                       *
+ * NESMappers_data.h: NES mapper data.                                     *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+// NOTE: This file is included multiple times by NESMappers.cpp
+// to build the string pool and the iNES mapper list.
+// Each entry must be on its own line. (See strpool.h.)
+
+// Mappers 0-9
+NESMAPPERS_ENTRY("NROM")
+NESMAPPERS_ENTRY("SxROM (MMC1)")
+NESMAPPERS_ENTRY("UxROM")
+NESMAPPERS_ENTRY("CNROM")
+NESMAPPERS_ENTRY("TxROM (MMC3, MMC6)")
+NESMAPPERS_ENTRY("ExROM (MMC5)")
+NESMAPPERS_ENTRY("FFE #6")
+NESMAPPERS_ENTRY("AxROM")
+NESMAPPERS_ENTRY("FFE #8")
+NESMAPPERS_ENTRY("PxROM (MMC2)")
+
+// Mappers 10-19
+NESMAPPERS_ENTRY("FxROM (MMC4)")
+NESMAPPERS_ENTRY("Color Dreams")
+NESMAPPERS_ENTRY("MMC3 clone")	// this is also marked as another FFE mapper. conflict?
+NESMAPPERS_ENTRY("CPROM")
+NESMAPPERS_ENTRY("MMC3 clone")
+NESMAPPERS_ENTRY("Multicart (unlicensed)")
+NESMAPPERS_ENTRY("FCG-x")
+NESMAPPERS_ENTRY("FFE #17")
+NESMAPPERS_ENTRY("Jaleco SS88006")
+NESMAPPERS_ENTRY("Namco 129/163")
+
+// Mappers 20-29
+NESMAPPERS_ENTRY("Famicom Disk System")	// this isn't actually used, as FDS roms are stored in their own format.
+NESMAPPERS_ENTRY("VRC4a, VRC4c")
+NESMAPPERS_ENTRY("VRC2a")
+NESMAPPERS_ENTRY("VRC4e, VRC4f, VRC2b")
+NESMAPPERS_ENTRY("VRC6a")
+NESMAPPERS_ENTRY("VRC4b, VRC4d")
+NESMAPPERS_ENTRY("VRC6b")
+NESMAPPERS_ENTRY("VRC4 variant")	// investigate
+NESMAPPERS_ENTRY("Multicart/Homebrew")
+NESMAPPERS_ENTRY("Homebrew")
+
+// Mappers 30-39
+NESMAPPERS_ENTRY("UNROM 512 (Homebrew)")
+NESMAPPERS_ENTRY("NSF (Homebrew)")
+NESMAPPERS_ENTRY("Irem G-101")
+NESMAPPERS_ENTRY("Taito TC0190")
+NESMAPPERS_ENTRY("BNROM, NINA-001")
+NESMAPPERS_ENTRY("JY Company subset")
+NESMAPPERS_ENTRY("TXC PCB 01-22000-400")
+NESMAPPERS_ENTRY("MMC3 multicart (official)")
+NESMAPPERS_ENTRY("GNROM variant")
+NESMAPPERS_ENTRY("BNROM variant")
+
+// Mappers 40-49
+NESMAPPERS_ENTRY("CD4020 (FDS conversion) (unlicensed)")
+NESMAPPERS_ENTRY("Caltron 6-in-1")
+NESMAPPERS_ENTRY("FDS conversion (unlicensed)")
+NESMAPPERS_ENTRY("FDS conversion (unlicensed)")
+NESMAPPERS_ENTRY("MMC3 clone")
+NESMAPPERS_ENTRY("MMC3 multicart (unlicensed)")
+NESMAPPERS_ENTRY("Rumble Station")
+NESMAPPERS_ENTRY("MMC3 multicart (official)")
+NESMAPPERS_ENTRY("Taito TC0690")
+NESMAPPERS_ENTRY("MMC3 multicart (unlicensed)")
+
+// Mappers 50-59
+NESMAPPERS_ENTRY("FDS conversion (unlicensed)")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("MMC3 clone")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Novel Diamond")	// conflicting information
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Multicart (unlicensed)")
+NESMAPPERS_ENTRY("Multicart (unlicensed)")
+NESMAPPERS_NULL_ENTRY()
+
+// Mappers 60-69
+NESMAPPERS_ENTRY("Multicart (unlicensed)")
+NESMAPPERS_ENTRY("Multicart (unlicensed)")
+NESMAPPERS_ENTRY("Multicart (unlicensed)")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Tengen RAMBO-1")
+NESMAPPERS_ENTRY("Irem H3001")
+NESMAPPERS_ENTRY("GxROM, MHROM")
+NESMAPPERS_ENTRY("Sunsoft-3")
+NESMAPPERS_ENTRY("Sunsoft-4")
+NESMAPPERS_ENTRY("Sunsoft FME-7")
+
+// Mappers 70-79
+NESMAPPERS_ENTRY("Family Trainer")
+NESMAPPERS_ENTRY("Codemasters (UNROM clone)")
+NESMAPPERS_ENTRY("Jaleco JF-17")
+NESMAPPERS_ENTRY("Konami VRC3")
+NESMAPPERS_ENTRY("MMC3 clone")
+NESMAPPERS_ENTRY("Konami VRC1")
+NESMAPPERS_ENTRY("Namcot 108 variant")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Holy Diver; Uchuusen - Cosmo Carrier")
+NESMAPPERS_ENTRY("NINA-03, NINA-06")
+
+// Mappers 80-89
+NESMAPPERS_ENTRY("Taito X1-005")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Taito X1-017")
+NESMAPPERS_ENTRY("Cony Soft")
+NESMAPPERS_ENTRY("PC-SMB2J")
+NESMAPPERS_ENTRY("Konami VRC7")
+NESMAPPERS_ENTRY("Jaleco JF-13")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Namcot 118 variant")
+NESMAPPERS_ENTRY("Sunsoft-2 (Sunsoft-3 board)")
+
+// Mappers 90-99
+NESMAPPERS_ENTRY("JY Company (simple nametable control)")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Sunsoft-2 (Sunsoft-3R board)")
+NESMAPPERS_ENTRY("HVC-UN1ROM")
+NESMAPPERS_ENTRY("NAMCOT-3425")
+NESMAPPERS_ENTRY("Oeka Kids")
+NESMAPPERS_ENTRY("Irem TAM-S1")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("CNROM (Vs. System)")
+
+// Mappers 100-109
+NESMAPPERS_ENTRY("MMC3 variant (hacked ROMs)")	// Also used for UNIF
+NESMAPPERS_ENTRY("Jaleco JF-10 (misdump)")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("NES-EVENT (Nintendo World Championships 1990)")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Magic Dragon")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+
+// Mappers 110-119
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Cheapocabra GT-ROM 512k flash board")	// Membler Industries
+NESMAPPERS_ENTRY("Namcot 118 variant")
+NESMAPPERS_ENTRY("NINA-03/06 multicart")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("MMC3 clone (Carson)")
+NESMAPPERS_ENTRY("Copy-protected bootleg mapper")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("TxSROM")
+NESMAPPERS_ENTRY("TQROM")
+
+// Mappers 120-129
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+
+// Mappers 130-139
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Sachen Jovial Race")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Sachen 8259D")
+NESMAPPERS_ENTRY("Sachen 8259B")
+NESMAPPERS_ENTRY("Sachen 8259C")
+
+// Mappers 140-149
+NESMAPPERS_ENTRY("Jaleco JF-11, JF-14 (GNROM variant)")
+NESMAPPERS_ENTRY("Sachen 8259A")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Copy-protected NROM")
+NESMAPPERS_ENTRY("Death Race (Color Dreams variant)")
+NESMAPPERS_ENTRY("Sidewinder (CNROM clone)")
+NESMAPPERS_ENTRY("Galactic Crusader (NINA-06 clone)")
+NESMAPPERS_ENTRY("Sachen Challenge of the Dragon")
+NESMAPPERS_ENTRY("NINA-06 variant")
+NESMAPPERS_ENTRY("SA-0036 (CNROM clone)")
+
+// Mappers 150-159
+NESMAPPERS_ENTRY("Sachen 74LS374N (corrected)")
+NESMAPPERS_ENTRY("VRC1 (Vs. System)")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Bandai LZ93D50 with SRAM")
+NESMAPPERS_ENTRY("NAMCOT-3453")
+NESMAPPERS_ENTRY("MMC1A")
+NESMAPPERS_ENTRY("DIS23C01")
+NESMAPPERS_ENTRY("Datach Joint ROM System")
+NESMAPPERS_ENTRY("Tengen 800037")
+NESMAPPERS_ENTRY("Bandai LZ93D50 with 24C01")
+
+// Mappers 160-169
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Nanjing")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("SUBOR")
+NESMAPPERS_ENTRY("SUBOR")
+NESMAPPERS_ENTRY("Racermate Challenge 2")
+NESMAPPERS_ENTRY("Yuxing")
+
+// Mappers 170-179
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Multicart (unlicensed)")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("WaiXing (BMCFK23C?)")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Education / WaiXing / HengGe")
+NESMAPPERS_NULL_ENTRY()
+
+// Mappers 180-189
+NESMAPPERS_ENTRY("Crazy Climber (UNROM clone)")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("MMC3 variant")
+NESMAPPERS_ENTRY("Suikan Pipe (VRC4e clone)")
+NESMAPPERS_ENTRY("Sunsoft-1")
+NESMAPPERS_ENTRY("CNROM with weak copy protection")
+NESMAPPERS_ENTRY("Study Box")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Bandai Karaoke Studio")
+NESMAPPERS_ENTRY("Thunder Warrior (MMC3 clone)")
+
+// Mappers 190-199
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("MMC3 clone")
+NESMAPPERS_ENTRY("MMC3 clone")
+NESMAPPERS_ENTRY("NTDEC TC-112")
+NESMAPPERS_ENTRY("MMC3 clone")	// same as 195 on NES 2.0
+NESMAPPERS_ENTRY("MMC3 clone")	// same as 194 on NES 2.0
+NESMAPPERS_ENTRY("MMC3 clone")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+
+// Mappers 200-209
+NESMAPPERS_ENTRY("Multicart (unlicensed)")
+NESMAPPERS_ENTRY("NROM-256 multicart (unlicensed)")
+NESMAPPERS_ENTRY("150-in-1 multicart (unlicensed)")
+NESMAPPERS_ENTRY("35-in-1 multicart (unlicensed)")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("MMC3 multicart (unlicensed)")
+NESMAPPERS_ENTRY("DxROM (Tengen MIMIC-1, Namcot 118)")
+NESMAPPERS_ENTRY("Fudou Myouou Den")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("JY Company (MMC2/MMC4 clone)")
+
+// Mappers 210-219
+NESMAPPERS_ENTRY("Namcot 175, 340")
+NESMAPPERS_ENTRY("JY Company (extended nametable control)")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("MMC3 clone")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Magic Floor (homebrew)")
+NESMAPPERS_ENTRY("UNL A9746")
+
+// Mappers 220-229
+NESMAPPERS_ENTRY("Summer Carnival '92 - Recca")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("CTC-31 (VRC2 + 74xx)")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Multicart (unlicensed)")
+NESMAPPERS_ENTRY("Multicart (unlicensed)")
+NESMAPPERS_ENTRY("Multicart (unlicensed)")
+NESMAPPERS_ENTRY("Active Enterprises")
+NESMAPPERS_ENTRY("BMC 31-IN-1")
+
+// Mappers 230-239
+NESMAPPERS_ENTRY("Multicart (unlicensed)")
+NESMAPPERS_ENTRY("Multicart (unlicensed)")
+NESMAPPERS_ENTRY("Codemasters Quattro")
+NESMAPPERS_ENTRY("Multicart (unlicensed)")
+NESMAPPERS_ENTRY("Maxi 15 multicart")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Teletubbies 420-in-1 multicart")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_NULL_ENTRY()
+
+// Mappers 240-249
+NESMAPPERS_ENTRY("Multicart (unlicensed)")
+NESMAPPERS_ENTRY("BNROM (similar to 034)")
+NESMAPPERS_ENTRY("Unlicensed")
+NESMAPPERS_ENTRY("Sachen 74LS374N")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("MMC3 clone")
+NESMAPPERS_ENTRY("Feng Shen Bang - Zhu Lu Zhi Zhan")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Incorrect assignment (should be 115)")
+NESMAPPERS_NULL_ENTRY()
+
+// Mappers 250-255
+NESMAPPERS_ENTRY("Nitra (MMC3 clone)")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("WaiXing - Sangokushi")
+NESMAPPERS_NULL_ENTRY()
+NESMAPPERS_ENTRY("Pikachu Y2K of crypted ROMs")
+NESMAPPERS_NULL_ENTRY()
+
+#undef NESMAPPERS_ENTRY
+#undef NESMAPPERS_NULL_ENTRY
@@ -20,6 +20,14 @@
 
 #include "Nintendo3DSSysTitles.hpp"
 #include "libi18n/i18n.h"
+#include "PerfectHash.hpp"
+
+// One-time initialization.
+#include "librpbase/threads/pthread_once.h"
+
+// C++ includes.
+#include <vector>
+using std::vector;
 
 namespace LibRomData {
 
@@ -53,6 +61,27 @@ class Nintendo3DSSysTitlesPrivate
 		static const SysTitle sys_title_00040030[];	// System applets.
 
 		//static const SysTitleGroup sys_title_group[];	// All SysTitle[] arrays.
+
+	public:
+		// Perfect hash indexes, keyed by tid_lo.
+		// Index is (title * 6) + region.
+		static PerfectHash sys_title_00040010_hash;
+		static PerfectHash sys_title_00040030_hash;
+		static pthread_once_t once_control;
+
+		/**
+		 * Build a perfect hash index for a SysTitle array.
+		 * @param hash		[out] PerfectHash.
+		 * @param titles	[in] SysTitle array.
+		 * @param title_count	[in] Number of titles.
+		 */
+		static void initHash(PerfectHash &hash, const SysTitle *titles, unsigned int title_count);
+
+		/**
+		 * Build the perfect hash indexes.
+		 * Called by pthread_once().
+		 */
+		static void initHashes(void);
 };
 
 /** Nintendo3DSSysTitlesPrivate **/
@@ -118,6 +147,40 @@ const Nintendo3DSSysTitlesPrivate::SysTitle Nintendo3DSSysTitlesPrivate::sys_tit
 	{{0x2000C003, 0x2000C803, 0x2000D003,          0, 0x2000DE03,          0}, NOP_C_("Nintendo3DSSysTitles", "Software Keyboard (SAFE_MODE)")},
 };
 
+// Perfect hash indexes.
+PerfectHash Nintendo3DSSysTitlesPrivate::sys_title_00040010_hash;
+PerfectHash Nintendo3DSSysTitlesPrivate::sys_title_00040030_hash;
+pthread_once_t Nintendo3DSSysTitlesPrivate::once_control = PTHREAD_ONCE_INIT;
+
+/**
+ * Build a perfect hash index for a SysTitle array.
+ * @param hash		[out] PerfectHash.
+ * @param titles	[in] SysTitle array.
+ * @param title_count	[in] Number of titles.
+ */
+void Nintendo3DSSysTitlesPrivate::initHash(PerfectHash &hash, const SysTitle *titles, unsigned int title_count)
+{
+	// NOTE: Unavailable regions have tid_lo == 0.
+	// lookup_sys_title() rejects tid_lo == 0, so these
+	// entries are never matched.
+	vector<uint32_t> keys;
+	keys.reserve(title_count * 6);
+	for (; title_count > 0; title_count--, titles++) {
+		keys.insert(keys.end(), &titles->tid_lo[0], &titles->tid_lo[6]);
+	}
+	hash.init(keys.data(), static_cast<unsigned int>(keys.size()));
+}
+
+/**
+ * Build the perfect hash indexes.
+ * Called by pthread_once().
+ */
+void Nintendo3DSSysTitlesPrivate::initHashes(void)
+{
+	initHash(sys_title_00040010_hash, sys_title_00040010, ARRAY_SIZE(sys_title_00040010));
+	initHash(sys_title_00040030_hash, sys_title_00040030, ARRAY_SIZE(sys_title_00040030));
+}
+
 /** Nintendo3DSSysTitles **/
 
 /**
@@ -130,7 +193,7 @@ const Nintendo3DSSysTitlesPrivate::SysTitle Nintendo3DSSysTitlesPrivate::sys_tit
 const char *Nintendo3DSSysTitles::lookup_sys_title(uint32_t tid_hi, uint32_t tid_lo, const char **pRegion)
 {
 	const Nintendo3DSSysTitlesPrivate::SysTitle *titles;
-	int title_count;
+	const PerfectHash *hash;
 
 	if (tid_hi == 0 || tid_lo == 0 ||
 	    tid_hi == 0xFFFFFFFF || tid_lo == 0xFFFFFFFF)
@@ -144,10 +207,10 @@ const char *Nintendo3DSSysTitles::lookup_sys_title(uint32_t tid_hi, uint32_t tid
 
 	if (tid_hi == 0x00040010) {
 		titles = Nintendo3DSSysTitlesPrivate::sys_title_00040010;
-		title_count = ARRAY_SIZE(Nintendo3DSSysTitlesPrivate::sys_title_00040010);
+		hash = &Nintendo3DSSysTitlesPrivate::sys_title_00040010_hash;
 	} else if (tid_hi == 0x00040030) {
 		titles = Nintendo3DSSysTitlesPrivate::sys_title_00040030;
-		title_count = ARRAY_SIZE(Nintendo3DSSysTitlesPrivate::sys_title_00040030);
+		hash = &Nintendo3DSSysTitlesPrivate::sys_title_00040030_hash;
 	} else {
 		// tid_hi not supported.
 		if (pRegion) {
@@ -156,21 +219,19 @@ const char *Nintendo3DSSysTitles::lookup_sys_title(uint32_t tid_hi, uint32_t tid
 		return nullptr;
 	}
 
-	// TODO: bsearch()?
-	for (; title_count > 0; title_count--, titles++) {
-		for (unsigned int region = 0; region < 6; region++) {
-			if (titles->tid_lo[region] != 0 && titles->tid_lo[region] == tid_lo) {
-				// Found a match!
-				if (pRegion) {
-					*pRegion = Nintendo3DSSysTitlesPrivate::regions[region];
-				}
-				return dpgettext_expr(RP_I18N_DOMAIN, "Nintendo3DSSysTitles", titles->desc);
-			}
-		}
+	// Look up tid_lo in the perfect hash index.
+	pthread_once(&Nintendo3DSSysTitlesPrivate::once_control, Nintendo3DSSysTitlesPrivate::initHashes);
+	const int idx = hash->find(tid_lo);
+	if (idx < 0) {
+		// Not found.
+		return nullptr;
 	}
 
-	// Not found.
-	return nullptr;
+	// Found a match!
+	if (pRegion) {
+		*pRegion = Nintendo3DSSysTitlesPrivate::regions[idx % 6];
+	}
+	return dpgettext_expr(RP_I18N_DOMAIN, "Nintendo3DSSysTitles", titles[idx / 6].desc);
 }
 
 }
@@ -0,0 +1,482 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libromdata)                       *
+ * NintendoPublishers_data.h: Nintendo third-party publishers list.        *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+// NOTE: This file is included multiple times by NintendoPublishers.cpp
+// to build the string pool and the publisher tables.
+// Each entry must be on its own line. (See strpool.h.)
+
+/**
+ * Nintendo third-party publisher list.
+ * This list is valid for most Nintendo systems.
+ */
+NINTENDOPUBLISHERS_ENTRY('00',	"<unlicensed>")
+NINTENDOPUBLISHERS_ENTRY('01',	"Nintendo")
+NINTENDOPUBLISHERS_ENTRY('02',	"Rocket Games / Ajinomoto")
+NINTENDOPUBLISHERS_ENTRY('03',	"Imagineer-Zoom")
+NINTENDOPUBLISHERS_ENTRY('04',	"Gray Matter")
+NINTENDOPUBLISHERS_ENTRY('05',	"Zamuse")
+NINTENDOPUBLISHERS_ENTRY('06',	"Falcom")
+NINTENDOPUBLISHERS_ENTRY('07',	"Enix")
+NINTENDOPUBLISHERS_ENTRY('08',	"Capcom")
+NINTENDOPUBLISHERS_ENTRY('09',	"Hot B Co.")
+NINTENDOPUBLISHERS_ENTRY('0A',	"Jaleco")
+NINTENDOPUBLISHERS_ENTRY('0B',	"Coconuts Japan")
+NINTENDOPUBLISHERS_ENTRY('0C',	"Coconuts Japan / G.X.Media")
+NINTENDOPUBLISHERS_ENTRY('0D',	"Micronet")
+NINTENDOPUBLISHERS_ENTRY('0E',	"Technos")
+NINTENDOPUBLISHERS_ENTRY('0F',	"Mebio Software")
+NINTENDOPUBLISHERS_ENTRY('0G',	"Shouei System")
+NINTENDOPUBLISHERS_ENTRY('0H',	"Starfish")
+NINTENDOPUBLISHERS_ENTRY('0J',	"Mitsui Fudosan / Dentsu")
+NINTENDOPUBLISHERS_ENTRY('0L',	"Warashi Inc.")
+NINTENDOPUBLISHERS_ENTRY('0N',	"Nowpro")
+NINTENDOPUBLISHERS_ENTRY('0P',	"Game Village")
+NINTENDOPUBLISHERS_ENTRY('0Q',	"IE Institute")
+NINTENDOPUBLISHERS_ENTRY('12',	"Infocom")
+NINTENDOPUBLISHERS_ENTRY('13',	"Electronic Arts Japan")
+NINTENDOPUBLISHERS_ENTRY('15',	"Cobra Team")
+NINTENDOPUBLISHERS_ENTRY('16',	"Human / Field")
+NINTENDOPUBLISHERS_ENTRY('17',	"KOEI")
+NINTENDOPUBLISHERS_ENTRY('18',	"Hudson Soft")
+NINTENDOPUBLISHERS_ENTRY('19',	"S.C.P.")
+NINTENDOPUBLISHERS_ENTRY('1A',	"Yanoman")
+NINTENDOPUBLISHERS_ENTRY('1C',	"Tecmo Products")
+NINTENDOPUBLISHERS_ENTRY('1D',	"Japan Glary Business")
+NINTENDOPUBLISHERS_ENTRY('1E',	"Forum / OpenSystem")
+NINTENDOPUBLISHERS_ENTRY('1F',	"Virgin Games (Japan)")
+NINTENDOPUBLISHERS_ENTRY('1G',	"SMDE")
+NINTENDOPUBLISHERS_ENTRY('1J',	"Daikokudenki")
+NINTENDOPUBLISHERS_ENTRY('1P',	"Creatures Inc.")
+NINTENDOPUBLISHERS_ENTRY('1Q',	"TDK Deep Impresion")
+NINTENDOPUBLISHERS_ENTRY('20',	"Zoo")
+NINTENDOPUBLISHERS_ENTRY('21',	"Sunsoft / Tokai Engineering")
+NINTENDOPUBLISHERS_ENTRY('22',	"POW (Planning Office Wada) / VR1 Japan")
+NINTENDOPUBLISHERS_ENTRY('23',	"Micro World")
+NINTENDOPUBLISHERS_ENTRY('25',	"San-X")
+NINTENDOPUBLISHERS_ENTRY('26',	"Enix")
+NINTENDOPUBLISHERS_ENTRY('27',	"Loriciel / Electro Brain")
+NINTENDOPUBLISHERS_ENTRY('28',	"Kemco Japan")
+NINTENDOPUBLISHERS_ENTRY('29',	"Seta")
+NINTENDOPUBLISHERS_ENTRY('2A',	"Culture Brain")
+NINTENDOPUBLISHERS_ENTRY('2C',	"Palsoft")
+NINTENDOPUBLISHERS_ENTRY('2D',	"Visit Co.,Ltd.")
+NINTENDOPUBLISHERS_ENTRY('2E',	"Intec")
+NINTENDOPUBLISHERS_ENTRY('2F',	"System Sacom")
+NINTENDOPUBLISHERS_ENTRY('2G',	"Poppo")
+NINTENDOPUBLISHERS_ENTRY('2H',	"Ubisoft Japan")
+NINTENDOPUBLISHERS_ENTRY('2J',	"Media Works")
+NINTENDOPUBLISHERS_ENTRY('2K',	"NEC InterChannel")
+NINTENDOPUBLISHERS_ENTRY('2L',	"Tam")
+NINTENDOPUBLISHERS_ENTRY('2M',	"Jordan")
+NINTENDOPUBLISHERS_ENTRY('2N',	"Smilesoft / Rocket")
+NINTENDOPUBLISHERS_ENTRY('2Q',	"Mediakite")
+NINTENDOPUBLISHERS_ENTRY('30',	"Viacom")
+NINTENDOPUBLISHERS_ENTRY('31',	"Carrozzeria")
+NINTENDOPUBLISHERS_ENTRY('32',	"Dynamic")
+NINTENDOPUBLISHERS_ENTRY('34',	"Magifact")
+NINTENDOPUBLISHERS_ENTRY('35',	"Hect")
+NINTENDOPUBLISHERS_ENTRY('36',	"Codemasters")
+NINTENDOPUBLISHERS_ENTRY('37',	"Taito / GAGA Communications")
+NINTENDOPUBLISHERS_ENTRY('38',	"Laguna")
+NINTENDOPUBLISHERS_ENTRY('39',	"Telstar / Event / Taito")
+NINTENDOPUBLISHERS_ENTRY('3A',	"Soedesco")
+NINTENDOPUBLISHERS_ENTRY('3B',	"Arcade Zone Ltd")
+NINTENDOPUBLISHERS_ENTRY('3C',	"Entertainment International / Empire Software")
+NINTENDOPUBLISHERS_ENTRY('3D',	"Loriciel")
+NINTENDOPUBLISHERS_ENTRY('3E',	"Gremlin Graphics")
+NINTENDOPUBLISHERS_ENTRY('3F',	"K.Amusement Leasing Co.")
+NINTENDOPUBLISHERS_ENTRY('40',	"Seika Corp.")
+NINTENDOPUBLISHERS_ENTRY('41',	"Ubi Soft Entertainment")
+NINTENDOPUBLISHERS_ENTRY('42',	"Sunsoft US")
+NINTENDOPUBLISHERS_ENTRY('44',	"Life Fitness")
+NINTENDOPUBLISHERS_ENTRY('46',	"System 3")
+NINTENDOPUBLISHERS_ENTRY('47',	"Spectrum Holobyte")
+NINTENDOPUBLISHERS_ENTRY('49',	"Irem")
+NINTENDOPUBLISHERS_ENTRY('4A',	"Gakken")	// FDS
+NINTENDOPUBLISHERS_ENTRY('4B',	"Raya Systems")
+NINTENDOPUBLISHERS_ENTRY('4C',	"Renovation Products")
+NINTENDOPUBLISHERS_ENTRY('4D',	"Malibu Games")
+NINTENDOPUBLISHERS_ENTRY('4F',	"Eidos")
+NINTENDOPUBLISHERS_ENTRY('4G',	"Playmates Interactive")
+NINTENDOPUBLISHERS_ENTRY('4J',	"Fox Interactive")
+NINTENDOPUBLISHERS_ENTRY('4K',	"Time Warner Interactive")
+NINTENDOPUBLISHERS_ENTRY('4Q',	"Disney Interactive")
+NINTENDOPUBLISHERS_ENTRY('4S',	"Black Pearl")
+NINTENDOPUBLISHERS_ENTRY('4U',	"Advanced Productions")
+NINTENDOPUBLISHERS_ENTRY('4X',	"GT Interactive")
+NINTENDOPUBLISHERS_ENTRY('4Y',	"RARE")
+NINTENDOPUBLISHERS_ENTRY('4Z',	"Crave Entertainment")
+NINTENDOPUBLISHERS_ENTRY('50',	"Absolute Entertainment")
+NINTENDOPUBLISHERS_ENTRY('51',	"Acclaim")
+NINTENDOPUBLISHERS_ENTRY('52',	"Activision")
+NINTENDOPUBLISHERS_ENTRY('53',	"American Sammy")
+NINTENDOPUBLISHERS_ENTRY('54',	"Take 2 Interactive / GameTek")
+NINTENDOPUBLISHERS_ENTRY('55',	"Hi Tech")
+NINTENDOPUBLISHERS_ENTRY('56',	"LJN LTD.")
+NINTENDOPUBLISHERS_ENTRY('58',	"Mattel")
+NINTENDOPUBLISHERS_ENTRY('5A',	"Mindscape / Red Orb Entertainment")
+NINTENDOPUBLISHERS_ENTRY('5B',	"Romstar")
+NINTENDOPUBLISHERS_ENTRY('5C',	"Taxan")
+NINTENDOPUBLISHERS_ENTRY('5D',	"Midway / Tradewest")
+NINTENDOPUBLISHERS_ENTRY('5F',	"American Softworks")
+NINTENDOPUBLISHERS_ENTRY('5G',	"Majesco Sales Inc")
+NINTENDOPUBLISHERS_ENTRY('5H',	"3DO")
+NINTENDOPUBLISHERS_ENTRY('5K',	"Hasbro")
+NINTENDOPUBLISHERS_ENTRY('5L',	"NewKidCo")
+NINTENDOPUBLISHERS_ENTRY('5M',	"Telegames")
+NINTENDOPUBLISHERS_ENTRY('5N',	"Metro3D")
+NINTENDOPUBLISHERS_ENTRY('5P',	"Vatical Entertainment")
+NINTENDOPUBLISHERS_ENTRY('5Q',	"LEGO Media")
+NINTENDOPUBLISHERS_ENTRY('5S',	"Xicat Interactive")
+NINTENDOPUBLISHERS_ENTRY('5T',	"Cryo Interactive")
+NINTENDOPUBLISHERS_ENTRY('5W',	"Red Storm Entertainment")
+NINTENDOPUBLISHERS_ENTRY('5X',	"Microids")
+NINTENDOPUBLISHERS_ENTRY('5Z',	"Data Design / Conspiracy / Swing")
+NINTENDOPUBLISHERS_ENTRY('60',	"Titus")
+NINTENDOPUBLISHERS_ENTRY('61',	"Virgin Interactive")
+NINTENDOPUBLISHERS_ENTRY('62',	"Maxis")
+NINTENDOPUBLISHERS_ENTRY('64',	"LucasArts Entertainment")
+NINTENDOPUBLISHERS_ENTRY('67',	"Ocean")
+NINTENDOPUBLISHERS_ENTRY('68',	"Bethesda Softworks")
+NINTENDOPUBLISHERS_ENTRY('69',	"Electronic Arts")
+NINTENDOPUBLISHERS_ENTRY('6B',	"Laser Beam")
+NINTENDOPUBLISHERS_ENTRY('6E',	"Elite Systems")
+NINTENDOPUBLISHERS_ENTRY('6F',	"Electro Brain")
+NINTENDOPUBLISHERS_ENTRY('6G',	"The Learning Company")
+NINTENDOPUBLISHERS_ENTRY('6H',	"BBC")
+NINTENDOPUBLISHERS_ENTRY('6J',	"Software 2000")
+NINTENDOPUBLISHERS_ENTRY('6K',	"UFO Interactive Games")
+NINTENDOPUBLISHERS_ENTRY('6L',	"BAM! Entertainment")
+NINTENDOPUBLISHERS_ENTRY('6M',	"Studio 3")
+NINTENDOPUBLISHERS_ENTRY('6Q',	"Classified Games")
+NINTENDOPUBLISHERS_ENTRY('6S',	"TDK Mediactive")
+NINTENDOPUBLISHERS_ENTRY('6U',	"DreamCatcher")
+NINTENDOPUBLISHERS_ENTRY('6V',	"JoWood Produtions")
+NINTENDOPUBLISHERS_ENTRY('6W',	"Sega")
+NINTENDOPUBLISHERS_ENTRY('6X',	"Wannado Edition")
+NINTENDOPUBLISHERS_ENTRY('6Y',	"LSP (Light & Shadow Prod.)")
+NINTENDOPUBLISHERS_ENTRY('6Z',	"ITE Media")
+NINTENDOPUBLISHERS_ENTRY('70',	"Atari (Infogrames)")
+NINTENDOPUBLISHERS_ENTRY('71',	"Interplay")
+NINTENDOPUBLISHERS_ENTRY('72',	"JVC (US)")
+NINTENDOPUBLISHERS_ENTRY('73',	"Parker Brothers")
+NINTENDOPUBLISHERS_ENTRY('75',	"Sales Curve (Storm / SCI)")
+NINTENDOPUBLISHERS_ENTRY('78',	"THQ")
+NINTENDOPUBLISHERS_ENTRY('79',	"Accolade")
+NINTENDOPUBLISHERS_ENTRY('7A',	"Triffix Entertainment")
+NINTENDOPUBLISHERS_ENTRY('7C',	"Microprose Software")
+NINTENDOPUBLISHERS_ENTRY('7D',	"Sierra / Universal Interactive")
+NINTENDOPUBLISHERS_ENTRY('7F',	"Kemco")
+NINTENDOPUBLISHERS_ENTRY('7G',	"Rage Software")
+NINTENDOPUBLISHERS_ENTRY('7H',	"Encore")
+NINTENDOPUBLISHERS_ENTRY('7J',	"Zoo")
+NINTENDOPUBLISHERS_ENTRY('7K',	"Kiddinx")
+NINTENDOPUBLISHERS_ENTRY('7L',	"Simon & Schuster Interactive")
+NINTENDOPUBLISHERS_ENTRY('7M',	"Asmik Ace Entertainment Inc.")
+NINTENDOPUBLISHERS_ENTRY('7N',	"Empire Interactive")
+NINTENDOPUBLISHERS_ENTRY('7Q',	"Jester Interactive")
+NINTENDOPUBLISHERS_ENTRY('7S',	"Rockstar Games")
+NINTENDOPUBLISHERS_ENTRY('7T',	"Scholastic")
+NINTENDOPUBLISHERS_ENTRY('7U',	"Ignition Entertainment")
+NINTENDOPUBLISHERS_ENTRY('7V',	"Summitsoft")
+NINTENDOPUBLISHERS_ENTRY('7W',	"Stadlbauer")
+NINTENDOPUBLISHERS_ENTRY('80',	"Misawa")
+NINTENDOPUBLISHERS_ENTRY('81',	"Teichiku")
+NINTENDOPUBLISHERS_ENTRY('82',	"Namco Ltd.")
+NINTENDOPUBLISHERS_ENTRY('83',	"LOZC")
+NINTENDOPUBLISHERS_ENTRY('84',	"KOEI")
+NINTENDOPUBLISHERS_ENTRY('86',	"Tokuma Shoten Intermedia")
+NINTENDOPUBLISHERS_ENTRY('87',	"Tsukuda Original")
+NINTENDOPUBLISHERS_ENTRY('88',	"DATAM-Polystar")
+NINTENDOPUBLISHERS_ENTRY('8B',	"BulletProof Software (BPS)")
+NINTENDOPUBLISHERS_ENTRY('8C',	"Vic Tokai Inc.")
+NINTENDOPUBLISHERS_ENTRY('8E',	"Character Soft")
+NINTENDOPUBLISHERS_ENTRY('8F',	"I'Max")
+NINTENDOPUBLISHERS_ENTRY('8G',	"Saurus")
+NINTENDOPUBLISHERS_ENTRY('8J',	"General Entertainment")
+NINTENDOPUBLISHERS_ENTRY('8N',	"Success")
+NINTENDOPUBLISHERS_ENTRY('8P',	"Sega Japan")
+NINTENDOPUBLISHERS_ENTRY('90',	"Takara Amusement")
+NINTENDOPUBLISHERS_ENTRY('91',	"Chun Soft")
+NINTENDOPUBLISHERS_ENTRY('92',	"Video System /  Mc O' River")
+NINTENDOPUBLISHERS_ENTRY('93',	"BEC")
+NINTENDOPUBLISHERS_ENTRY('95',	"Varie")
+NINTENDOPUBLISHERS_ENTRY('96',	"Yonezawa / S'pal")
+NINTENDOPUBLISHERS_ENTRY('97',	"Kaneko")
+NINTENDOPUBLISHERS_ENTRY('99',	"Marvelous Entertainment")
+NINTENDOPUBLISHERS_ENTRY('9A',	"Nichibutsu / Nihon Bussan")
+NINTENDOPUBLISHERS_ENTRY('9B',	"Tecmo")
+NINTENDOPUBLISHERS_ENTRY('9C',	"Imagineer")
+NINTENDOPUBLISHERS_ENTRY('9F',	"Nova")
+NINTENDOPUBLISHERS_ENTRY('9G',	"Take2 / Den'Z / Global Star")
+NINTENDOPUBLISHERS_ENTRY('9H',	"Bottom Up")
+NINTENDOPUBLISHERS_ENTRY('9J',	"TGL (Technical Group Laboratory)")
+NINTENDOPUBLISHERS_ENTRY('9L',	"Hasbro Japan")
+NINTENDOPUBLISHERS_ENTRY('9N',	"Marvelous Entertainment")
+NINTENDOPUBLISHERS_ENTRY('9P',	"Keynet Inc.")
+NINTENDOPUBLISHERS_ENTRY('9Q',	"Hands-On Entertainment")
+NINTENDOPUBLISHERS_ENTRY('A0',	"Telenet")
+NINTENDOPUBLISHERS_ENTRY('A1',	"Hori")
+NINTENDOPUBLISHERS_ENTRY('A2',	"Scorpion Soft")	// FDS
+NINTENDOPUBLISHERS_ENTRY('A4',	"Konami")
+NINTENDOPUBLISHERS_ENTRY('A5',	"K.Amusement Leasing Co.")
+NINTENDOPUBLISHERS_ENTRY('A6',	"Kawada Co., Ltd.")
+NINTENDOPUBLISHERS_ENTRY('A7',	"Takara")
+NINTENDOPUBLISHERS_ENTRY('A8',	"Royal Industries")	// FDS
+NINTENDOPUBLISHERS_ENTRY('A9',	"Technos Japan Corp.")
+NINTENDOPUBLISHERS_ENTRY('AA',	"JVC / Victor")
+NINTENDOPUBLISHERS_ENTRY('AC',	"Toei Animation")
+NINTENDOPUBLISHERS_ENTRY('AD',	"Toho")
+NINTENDOPUBLISHERS_ENTRY('AF',	"Namco")
+NINTENDOPUBLISHERS_ENTRY('AG',	"Media Rings Corporation")
+NINTENDOPUBLISHERS_ENTRY('AH',	"J-Wing")
+NINTENDOPUBLISHERS_ENTRY('AJ',	"Pioneer LDC")
+NINTENDOPUBLISHERS_ENTRY('AK',	"KID")
+NINTENDOPUBLISHERS_ENTRY('AL',	"Mediafactory")
+NINTENDOPUBLISHERS_ENTRY('AP',	"Infogrames / Hudson")
+NINTENDOPUBLISHERS_ENTRY('AQ',	"Kiratto. Ludic Inc")
+NINTENDOPUBLISHERS_ENTRY('AY',	"Yacht Club Games")
+NINTENDOPUBLISHERS_ENTRY('B0',	"Acclaim Japan")
+NINTENDOPUBLISHERS_ENTRY('B1',	"ASCII Corporation")
+NINTENDOPUBLISHERS_ENTRY('B2',	"Bandai")
+NINTENDOPUBLISHERS_ENTRY('B3',	"Soft Pro Inc.")	// FDS
+NINTENDOPUBLISHERS_ENTRY('B4',	"Enix")
+NINTENDOPUBLISHERS_ENTRY('B6',	"HAL Laboratory")
+NINTENDOPUBLISHERS_ENTRY('B7',	"SNK")
+NINTENDOPUBLISHERS_ENTRY('B9',	"Pony Canyon")
+NINTENDOPUBLISHERS_ENTRY('BA',	"Culture Brain")
+NINTENDOPUBLISHERS_ENTRY('BB',	"Sunsoft")
+NINTENDOPUBLISHERS_ENTRY('BC',	"Toshiba EMI")
+NINTENDOPUBLISHERS_ENTRY('BD',	"Sony Imagesoft")
+NINTENDOPUBLISHERS_ENTRY('BF',	"Sammy")
+NINTENDOPUBLISHERS_ENTRY('BG',	"Magical")
+NINTENDOPUBLISHERS_ENTRY('BH',	"Visco")
+NINTENDOPUBLISHERS_ENTRY('BJ',	"Compile")
+NINTENDOPUBLISHERS_ENTRY('BL',	"MTO Inc.")
+NINTENDOPUBLISHERS_ENTRY('BN',	"Sunrise Interactive")
+NINTENDOPUBLISHERS_ENTRY('BP',	"Global A Entertainment")
+NINTENDOPUBLISHERS_ENTRY('BQ',	"Fuuki")
+NINTENDOPUBLISHERS_ENTRY('C0',	"Taito")
+NINTENDOPUBLISHERS_ENTRY('C1',	"Sunsoft / Ask Co., Ltd.")	// FDS
+NINTENDOPUBLISHERS_ENTRY('C2',	"Kemco")
+NINTENDOPUBLISHERS_ENTRY('C3',	"Square")
+NINTENDOPUBLISHERS_ENTRY('C4',	"Tokuma Shoten")
+NINTENDOPUBLISHERS_ENTRY('C5',	"Data East")
+NINTENDOPUBLISHERS_ENTRY('C6',	"Tonkin House / Tokyo Shoseki")
+NINTENDOPUBLISHERS_ENTRY('C7',	"East Cube")	// FDS
+NINTENDOPUBLISHERS_ENTRY('C8',	"Koei")
+NINTENDOPUBLISHERS_ENTRY('CA',	"Konami / Ultra / Palcom")
+NINTENDOPUBLISHERS_ENTRY('CB',	"NTVIC / VAP")
+NINTENDOPUBLISHERS_ENTRY('CC',	"Use Co., Ltd.")
+NINTENDOPUBLISHERS_ENTRY('CD',	"Meldac")
+NINTENDOPUBLISHERS_ENTRY('CE',	"Pony Canyon / FCI")
+NINTENDOPUBLISHERS_ENTRY('CF',	"Angel / Sotsu Agency / Sunrise")
+NINTENDOPUBLISHERS_ENTRY('CG',	"Yumedia / Aroma Co., Ltd")
+NINTENDOPUBLISHERS_ENTRY('CJ',	"Boss")
+NINTENDOPUBLISHERS_ENTRY('CK',	"Axela / Crea-Tech")
+NINTENDOPUBLISHERS_ENTRY('CL',	"Sekaibunka-Sha / Sumire Kobo / Marigul Management Inc.")
+NINTENDOPUBLISHERS_ENTRY('CM',	"Konami Computer Entertainment Osaka")
+NINTENDOPUBLISHERS_ENTRY('CN',	"NEC Interchannel")
+NINTENDOPUBLISHERS_ENTRY('CP',	"Enterbrain")
+NINTENDOPUBLISHERS_ENTRY('CQ',	"From Software")
+NINTENDOPUBLISHERS_ENTRY('D0',	"Taito / Disco")
+NINTENDOPUBLISHERS_ENTRY('D1',	"Sofel")
+NINTENDOPUBLISHERS_ENTRY('D2',	"Quest / Bothtec")
+NINTENDOPUBLISHERS_ENTRY('D3',	"Sigma")
+NINTENDOPUBLISHERS_ENTRY('D4',	"Ask Kodansha")
+NINTENDOPUBLISHERS_ENTRY('D6',	"Naxat")
+NINTENDOPUBLISHERS_ENTRY('D7',	"Copya System")
+NINTENDOPUBLISHERS_ENTRY('D8',	"Capcom Co., Ltd.")
+NINTENDOPUBLISHERS_ENTRY('D9',	"Banpresto")
+NINTENDOPUBLISHERS_ENTRY('DA',	"Tomy")
+NINTENDOPUBLISHERS_ENTRY('DB',	"LJN Japan")
+NINTENDOPUBLISHERS_ENTRY('DD',	"NCS")
+NINTENDOPUBLISHERS_ENTRY('DE',	"Human Entertainment")
+NINTENDOPUBLISHERS_ENTRY('DF',	"Altron")
+NINTENDOPUBLISHERS_ENTRY('DG',	"Jaleco")
+NINTENDOPUBLISHERS_ENTRY('DH',	"Gaps Inc.")
+NINTENDOPUBLISHERS_ENTRY('DN',	"Elf")
+NINTENDOPUBLISHERS_ENTRY('DQ',	"Compile Heart")
+NINTENDOPUBLISHERS_ENTRY('DV',	"FarSight Studios")
+NINTENDOPUBLISHERS_ENTRY('E0',	"Jaleco")
+NINTENDOPUBLISHERS_ENTRY('E2',	"Yutaka")
+NINTENDOPUBLISHERS_ENTRY('E3',	"Varie")
+NINTENDOPUBLISHERS_ENTRY('E4',	"T&ESoft")
+NINTENDOPUBLISHERS_ENTRY('E5',	"Epoch")
+NINTENDOPUBLISHERS_ENTRY('E7',	"Athena")
+NINTENDOPUBLISHERS_ENTRY('E8',	"Asmik")
+NINTENDOPUBLISHERS_ENTRY('E9',	"Natsume")
+NINTENDOPUBLISHERS_ENTRY('EA',	"King Records")
+NINTENDOPUBLISHERS_ENTRY('EB',	"Atlus")
+NINTENDOPUBLISHERS_ENTRY('EC',	"Epic / Sony Records")
+NINTENDOPUBLISHERS_ENTRY('EE',	"IGS (Information Global Service)")
+NINTENDOPUBLISHERS_ENTRY('EG',	"Chatnoir")
+NINTENDOPUBLISHERS_ENTRY('EH',	"Right Stuff")
+NINTENDOPUBLISHERS_ENTRY('EL',	"Spike")
+NINTENDOPUBLISHERS_ENTRY('EM',	"Konami Computer Entertainment Tokyo")
+NINTENDOPUBLISHERS_ENTRY('EN',	"Alphadream Corporation")
+NINTENDOPUBLISHERS_ENTRY('EP',	"Sting")
+NINTENDOPUBLISHERS_ENTRY('ES',	"Star-Fish")
+NINTENDOPUBLISHERS_ENTRY('F0',	"A Wave")
+NINTENDOPUBLISHERS_ENTRY('F1',	"Motown Software")
+NINTENDOPUBLISHERS_ENTRY('F2',	"Left Field Entertainment")
+NINTENDOPUBLISHERS_ENTRY('F3',	"Extreme Ent. Grp.")
+NINTENDOPUBLISHERS_ENTRY('F4',	"TecMagik")
+NINTENDOPUBLISHERS_ENTRY('F9',	"Cybersoft")
+NINTENDOPUBLISHERS_ENTRY('FB',	"Psygnosis")
+NINTENDOPUBLISHERS_ENTRY('FE',	"Davidson / Western Tech.")
+NINTENDOPUBLISHERS_ENTRY('FK',	"The Game Factory")
+NINTENDOPUBLISHERS_ENTRY('FL',	"Hip Games")
+NINTENDOPUBLISHERS_ENTRY('FM',	"Aspyr")
+NINTENDOPUBLISHERS_ENTRY('FP',	"Mastiff")
+NINTENDOPUBLISHERS_ENTRY('FQ',	"iQue")
+NINTENDOPUBLISHERS_ENTRY('FR',	"Digital Tainment Pool")
+NINTENDOPUBLISHERS_ENTRY('FS',	"XS Games / Jack Of All Games")
+NINTENDOPUBLISHERS_ENTRY('FT',	"Daiwon")
+NINTENDOPUBLISHERS_ENTRY('G0',	"Alpha Unit")
+NINTENDOPUBLISHERS_ENTRY('G1',	"PCCW Japan")
+NINTENDOPUBLISHERS_ENTRY('G2',	"Yuke's Media Creations")
+NINTENDOPUBLISHERS_ENTRY('G4',	"KiKi Co Ltd")
+NINTENDOPUBLISHERS_ENTRY('G5',	"Open Sesame Inc")
+NINTENDOPUBLISHERS_ENTRY('G6',	"Sims")
+NINTENDOPUBLISHERS_ENTRY('G7',	"Broccoli")
+NINTENDOPUBLISHERS_ENTRY('G8',	"Avex")
+NINTENDOPUBLISHERS_ENTRY('G9',	"D3 Publisher")
+NINTENDOPUBLISHERS_ENTRY('GB',	"Konami Computer Entertainment Japan")
+NINTENDOPUBLISHERS_ENTRY('GD',	"Square-Enix")
+NINTENDOPUBLISHERS_ENTRY('GE',	"KSG")
+NINTENDOPUBLISHERS_ENTRY('GF',	"Micott & Basara Inc.")
+NINTENDOPUBLISHERS_ENTRY('GG',	"O3 Entertainment")
+NINTENDOPUBLISHERS_ENTRY('GH',	"Orbital Media")
+NINTENDOPUBLISHERS_ENTRY('GJ',	"Detn8 Games")
+NINTENDOPUBLISHERS_ENTRY('GL',	"Gameloft / Ubi Soft")
+NINTENDOPUBLISHERS_ENTRY('GM',	"Gamecock Media Group")
+NINTENDOPUBLISHERS_ENTRY('GN',	"Oxygen Games")
+NINTENDOPUBLISHERS_ENTRY('GT',	"505 Games")
+NINTENDOPUBLISHERS_ENTRY('GY',	"The Game Factory")
+NINTENDOPUBLISHERS_ENTRY('H1',	"Treasure")
+NINTENDOPUBLISHERS_ENTRY('H2',	"Aruze")
+NINTENDOPUBLISHERS_ENTRY('H3',	"Ertain")
+NINTENDOPUBLISHERS_ENTRY('H4',	"SNK Playmore")
+NINTENDOPUBLISHERS_ENTRY('HF',	"Level-5")
+NINTENDOPUBLISHERS_ENTRY('HJ',	"Genius Products")
+NINTENDOPUBLISHERS_ENTRY('HY',	"Reef Entertainment")
+NINTENDOPUBLISHERS_ENTRY('HZ',	"Nordcurrent")
+NINTENDOPUBLISHERS_ENTRY('IH',	"Yojigen")
+NINTENDOPUBLISHERS_ENTRY('J9',	"AQ Interactive")
+NINTENDOPUBLISHERS_ENTRY('JF',	"Arc System Works")
+NINTENDOPUBLISHERS_ENTRY('JJ',	"Deep Silver")
+NINTENDOPUBLISHERS_ENTRY('JW',	"Atari")
+NINTENDOPUBLISHERS_ENTRY('K6',	"Nihon System")
+NINTENDOPUBLISHERS_ENTRY('KB',	"NIS America")
+NINTENDOPUBLISHERS_ENTRY('KM',	"Deep Silver")
+NINTENDOPUBLISHERS_ENTRY('KP',	"Purple Hills")
+NINTENDOPUBLISHERS_ENTRY('LH',	"Trend Verlag / East Entertainment")
+NINTENDOPUBLISHERS_ENTRY('LT',	"Legacy Interactive")
+NINTENDOPUBLISHERS_ENTRY('ME',	"SilverStar Games")
+NINTENDOPUBLISHERS_ENTRY('MJ',	"Mumbo Jumbo")
+NINTENDOPUBLISHERS_ENTRY('MR',	"Mindscape")
+NINTENDOPUBLISHERS_ENTRY('MS',	"Milestone / UFO Interactive")
+NINTENDOPUBLISHERS_ENTRY('MT',	"Blast !")
+NINTENDOPUBLISHERS_ENTRY('N9',	"Terabox")
+NINTENDOPUBLISHERS_ENTRY('NG',	"Nordic Games")
+NINTENDOPUBLISHERS_ENTRY('NK',	"Neko Entertainment / Diffusion / Naps team")
+NINTENDOPUBLISHERS_ENTRY('NP',	"Nobilis")
+NINTENDOPUBLISHERS_ENTRY('NQ',	"Namco Bandai")
+NINTENDOPUBLISHERS_ENTRY('NR',	"Data Design / Destineer Studios")
+NINTENDOPUBLISHERS_ENTRY('NS',	"NIS America")
+NINTENDOPUBLISHERS_ENTRY('PG',	"Phoenix Games")
+NINTENDOPUBLISHERS_ENTRY('PL',	"Playlogic")
+NINTENDOPUBLISHERS_ENTRY('RM',	"Rondomedia")
+NINTENDOPUBLISHERS_ENTRY('RS',	"Warner Bros. Interactive Entertainment Inc.")
+NINTENDOPUBLISHERS_ENTRY('RT',	"RTL Games")
+NINTENDOPUBLISHERS_ENTRY('RW',	"RealNetworks")
+NINTENDOPUBLISHERS_ENTRY('S5',	"Southpeak Interactive")
+NINTENDOPUBLISHERS_ENTRY('SP',	"Blade Interactive Studios")
+NINTENDOPUBLISHERS_ENTRY('SV',	"SevenGames")
+NINTENDOPUBLISHERS_ENTRY('SZ',	"Storm City")
+NINTENDOPUBLISHERS_ENTRY('TK',	"Tasuke / Works")
+NINTENDOPUBLISHERS_ENTRY('TV',	"Tivola")
+NINTENDOPUBLISHERS_ENTRY('UG',	"Metro 3D / Data Design")
+NINTENDOPUBLISHERS_ENTRY('VN',	"Valcon Games")
+NINTENDOPUBLISHERS_ENTRY('VP',	"Virgin Play")
+NINTENDOPUBLISHERS_ENTRY('VZ',	"Little Orbit")
+NINTENDOPUBLISHERS_ENTRY('WR',	"Warner Bros. Interactive Entertainment Inc.")
+NINTENDOPUBLISHERS_ENTRY('XJ',	"Xseed Games")
+NINTENDOPUBLISHERS_ENTRY('XS',	"Aksys Games")
+NINTENDOPUBLISHERS_ENTRY('XT',	"Fun Box Media")
+NINTENDOPUBLISHERS_ENTRY('YF',	"O2 Games")
+NINTENDOPUBLISHERS_ENTRY('YM',	"Bergsala Lightweight")
+NINTENDOPUBLISHERS_ENTRY('YT',	"Valcon Games")
+NINTENDOPUBLISHERS_ENTRY('Z4',	"Ntreev Soft")
+NINTENDOPUBLISHERS_ENTRY('ZA',	"WBA Interactive")
+NINTENDOPUBLISHERS_ENTRY('ZH',	"Internal Engine")
+NINTENDOPUBLISHERS_ENTRY('ZS',	"Zinkia")
+NINTENDOPUBLISHERS_ENTRY('ZW',	"Judo Baby")
+NINTENDOPUBLISHERS_ENTRY('ZX',	"Topware Interactive")
+
+/**
+ * Nintendo third-party publisher list.
+ * This list is valid for Famicom Disk System only.
+ */
+NINTENDOPUBLISHERS_FDS_ENTRY(0x00,	"<unlicensed>",			"<非公認>")
+NINTENDOPUBLISHERS_FDS_ENTRY(0x01,	"Nintendo",			"任天堂")
+NINTENDOPUBLISHERS_FDS_ENTRY(0x08,	"Capcom",			"カプコン")
+NINTENDOPUBLISHERS_FDS_ENTRY(0x0A,	"Jaleco",			"ジャレコ")
+NINTENDOPUBLISHERS_FDS_ENTRY(0x18,	"Hudson Soft",			"ハドソン")
+NINTENDOPUBLISHERS_FDS_ENTRY(0x49,	"Irem",				"アイレム")
+NINTENDOPUBLISHERS_FDS_ENTRY(0x4A,	"Gakken",			"学習研究社")
+NINTENDOPUBLISHERS_FDS_ENTRY(0x8B,	"BulletProof Software (BPS)",	"BPS")
+NINTENDOPUBLISHERS_FDS_ENTRY(0x99,	"Pack-In-Video",		"パックインビデオ")
+NINTENDOPUBLISHERS_FDS_ENTRY(0x9B,	"Tecmo",			"テクモ")
+NINTENDOPUBLISHERS_FDS_ENTRY(0x9C,	"Imagineer",			"イマジニア")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xA2,	"Scorpion Soft",		"スコーピオンソフト")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xA4,	"Konami",			"コナミ")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xA6,	"Kawada Co., Ltd.",		"河田")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xA7,	"Takara",			"タカラ")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xA8,	"Royal Industries",		"ロイヤル工業")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xAC,	"Toei Animation",		"東映動画")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xAF,	"Namco",			"ナムコ")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xB1,	"ASCII Corporation",		"アスキー")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xB2,	"Bandai",			"バンダイ")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xB3,	"Soft Pro Inc.",		"ソフトプロ")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xB6,	"HAL Laboratory",		"HAL研究所")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xBB,	"Sunsoft",			"サンソフト")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xBC,	"Toshiba EMI",			"東芝EMI")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xC0,	"Taito",			"タイトー")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xC1,	"Sunsoft / Ask Co., Ltd.",	"サンソフト アスク講談社")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xC2,	"Kemco",			"ケムコ")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xC3,	"Square",			"スクウェア")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xC4,	"Tokuma Shoten",		"徳間書店")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xC5,	"Data East",			"データイースト")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xC6,	"Tonkin House / Tokyo Shoseki",	"トンキンハウス")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xC7,	"East Cube",			"イーストキューブ")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xCA,	"Konami / Ultra / Palcom",	"コナミ")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xCB,	"NTVIC / VAP",			"バップ")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xCC,	"Use Co., Ltd.",		"ユース")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xCE,	"Pony Canyon / FCI",		"ポニーキャニオン")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xD1,	"Sofel",			"ソフエル")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xD2,	"Bothtec, Inc.",		"ボーステック")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xDB,	"Hiro Co., Ltd.",		"ヒロ")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xE7,	"Athena",			"アテナ")
+NINTENDOPUBLISHERS_FDS_ENTRY(0xEB,	"Atlus",			"アトラス")
+
+#undef NINTENDOPUBLISHERS_ENTRY
+#undef NINTENDOPUBLISHERS_FDS_ENTRY
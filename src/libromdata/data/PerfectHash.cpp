@@ -0,0 +1,146 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libromdata)                       *
+ * PerfectHash.cpp: Perfect hash index for static data tables.             *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "PerfectHash.hpp"
+
+// C includes. (C++ namespace)
+#include <cassert>
+
+// C++ includes.
+#include <algorithm>
+#include <vector>
+using std::vector;
+
+namespace LibRomData {
+
+PerfectHash::PerfectHash()
+	: bucket_mask(0)
+	, slot_mask(0)
+{ }
+
+/**
+ * Build the index from an array of keys.
+ * Duplicate keys are ignored. (The first index is used.)
+ * @param keys Keys.
+ * @param count Number of keys. (Must be less than 65535.)
+ */
+void PerfectHash::init(const uint32_t *keys, unsigned int count)
+{
+	assert(count < EMPTY_SLOT);
+
+	// Number of buckets: ~4 keys per bucket.
+	// Number of slots: at least 1.25x the number of keys.
+	// Both must be powers of two for masking.
+	unsigned int bucket_count = 1;
+	while (bucket_count * 4 < count) {
+		bucket_count <<= 1;
+	}
+	unsigned int slot_count = 8;
+	while (slot_count < count + (count / 4)) {
+		slot_count <<= 1;
+	}
+
+	// Assign keys to buckets.
+	vector<vector<uint16_t> > buckets(bucket_count);
+	for (unsigned int i = 0; i < count; i++) {
+		buckets[mix(keys[i]) & (bucket_count - 1)].push_back(static_cast<uint16_t>(i));
+	}
+
+	// Remove duplicate keys.
+	for (auto iter = buckets.begin(); iter != buckets.end(); ++iter) {
+		vector<uint16_t> &b = *iter;
+		for (size_t i = 1; i < b.size(); ) {
+			bool dup = false;
+			for (size_t j = 0; j < i; j++) {
+				if (keys[b[i]] == keys[b[j]]) {
+					dup = true;
+					break;
+				}
+			}
+			if (dup) {
+				b.erase(b.begin() + i);
+			} else {
+				i++;
+			}
+		}
+	}
+
+	// Place the largest buckets first.
+	vector<unsigned int> order(bucket_count);
+	for (unsigned int i = 0; i < bucket_count; i++) {
+		order[i] = i;
+	}
+	std::stable_sort(order.begin(), order.end(),
+		[&buckets](unsigned int a, unsigned int b) {
+			return buckets[a].size() > buckets[b].size();
+		});
+
+	// Find a displacement value for each bucket.
+	// If a bucket can't be placed, double the number of slots and retry.
+	vector<uint32_t> tmp_slots;
+	for (;; slot_count <<= 1) {
+		const Slot empty = {0, EMPTY_SLOT};
+		slots.assign(slot_count, empty);
+		disp.assign(bucket_count, 0);
+
+		bool ok = true;
+		for (auto iter = order.cbegin(); iter != order.cend() && ok; ++iter) {
+			const vector<uint16_t> &b = buckets[*iter];
+			if (b.empty())
+				break;
+
+			ok = false;
+			for (uint32_t d = 0; d < EMPTY_SLOT; d++) {
+				// Check if all keys in this bucket have free slots.
+				tmp_slots.clear();
+				bool collision = false;
+				for (auto idx = b.cbegin(); idx != b.cend(); ++idx) {
+					const uint32_t s = slot(mix(keys[*idx]), d) & (slot_count - 1);
+					if (slots[s].idx != EMPTY_SLOT ||
+					    std::find(tmp_slots.cbegin(), tmp_slots.cend(), s) != tmp_slots.cend())
+					{
+						collision = true;
+						break;
+					}
+					tmp_slots.push_back(s);
+				}
+				if (collision)
+					continue;
+
+				// Found a displacement value.
+				for (size_t i = 0; i < b.size(); i++) {
+					slots[tmp_slots[i]].key = keys[b[i]];
+					slots[tmp_slots[i]].idx = b[i];
+				}
+				disp[*iter] = static_cast<uint16_t>(d);
+				ok = true;
+				break;
+			}
+		}
+
+		if (ok)
+			break;
+	}
+
+	bucket_mask = bucket_count - 1;
+	slot_mask = slot_count - 1;
+}
+
+}
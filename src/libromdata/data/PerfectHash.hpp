@@ -0,0 +1,147 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libromdata)                       *
+ * PerfectHash.hpp: Perfect hash index for static data tables.             *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef __ROMPROPERTIES_LIBROMDATA_PERFECTHASH_HPP__
+#define __ROMPROPERTIES_LIBROMDATA_PERFECTHASH_HPP__
+
+#include "librpbase/common.h"
+
+// C includes.
+#include <stdint.h>
+
+// C includes. (C++ namespace)
+#include <cassert>
+
+// C++ includes.
+#include <vector>
+
+namespace LibRomData {
+
+/**
+ * Perfect hash index for static data tables.
+ *
+ * Maps unique 32-bit keys to table indexes in O(1) using
+ * "hash and displace": each key is assigned to a bucket,
+ * and each bucket has a displacement value that was chosen
+ * so that none of the keys collide.
+ *
+ * The index is built at runtime using init(), which should
+ * be called using pthread_once(). find() must not be called
+ * before init() has completed.
+ */
+class PerfectHash
+{
+	public:
+		PerfectHash();
+
+	private:
+		RP_DISABLE_COPY(PerfectHash)
+
+	public:
+		/**
+		 * Build the index from an array of keys.
+		 * Duplicate keys are ignored. (The first index is used.)
+		 * @param keys Keys.
+		 * @param count Number of keys. (Must be less than 65535.)
+		 */
+		void init(const uint32_t *keys, unsigned int count);
+
+		/**
+		 * Build the index from an array of structs.
+		 * @param tbl Table.
+		 * @param count Number of entries in the table.
+		 * @param key Pointer to the key member.
+		 */
+		template<typename T, typename K>
+		void init(const T *tbl, unsigned int count, K T::*key)
+		{
+			std::vector<uint32_t> keys;
+			keys.resize(count);
+			for (unsigned int i = 0; i < count; i++) {
+				keys[i] = static_cast<uint32_t>(tbl[i].*key);
+			}
+			init(keys.data(), count);
+		}
+
+		/**
+		 * Find a key.
+		 * @param key Key.
+		 * @return Table index, or -1 if not found.
+		 */
+		inline int find(uint32_t key) const;
+
+	public:
+		/**
+		 * Hash a 32-bit value.
+		 * This is the MurmurHash3 finalizer.
+		 * @param h Value.
+		 * @return Hashed value.
+		 */
+		static inline uint32_t mix(uint32_t h)
+		{
+			h ^= h >> 16;
+			h *= 0x85EBCA6B;
+			h ^= h >> 13;
+			h *= 0xC2B2AE35;
+			h ^= h >> 16;
+			return h;
+		}
+
+		/**
+		 * Get the slot for a hashed key.
+		 * @param h Hashed key.
+		 * @param disp Displacement value.
+		 * @return Slot, before masking.
+		 */
+		static inline uint32_t slot(uint32_t h, uint32_t disp)
+		{
+			return mix(h + (disp * 0x9E3779B9));
+		}
+
+	private:
+		static const uint16_t EMPTY_SLOT = 0xFFFF;
+
+		struct Slot {
+			uint32_t key;
+			uint16_t idx;	// Table index, or EMPTY_SLOT.
+		};
+
+		uint32_t bucket_mask;
+		uint32_t slot_mask;
+		std::vector<uint16_t> disp;	// Displacement values, per bucket.
+		std::vector<Slot> slots;
+};
+
+/**
+ * Find a key.
+ * @param key Key.
+ * @return Table index, or -1 if not found.
+ */
+inline int PerfectHash::find(uint32_t key) const
+{
+	assert(!slots.empty());
+	const uint32_t h = mix(key);
+	const Slot &s = slots[slot(h, disp[h & bucket_mask]) & slot_mask];
+	return (s.key == key && s.idx != EMPTY_SLOT ? s.idx : -1);
+}
+
+}
+
+#endif /* __ROMPROPERTIES_LIBROMDATA_PERFECTHASH_HPP__ */
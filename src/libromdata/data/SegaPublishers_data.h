@@ -0,0 +1,373 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libromdata)                       *
+ * SegaPublishers_data.h: Sega third-party publishers list.                *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+// NOTE: This file is included multiple times by SegaPublishers.cpp
+// to build the string pool and the T-code table.
+// Each entry must be on its own line. (See strpool.h.)
+
+SEGAPUBLISHERS_ENTRY(0,	"Sega")
+SEGAPUBLISHERS_ENTRY(11,	"Taito")
+SEGAPUBLISHERS_ENTRY(12,	"Capcom")
+SEGAPUBLISHERS_ENTRY(13,	"Data East")
+SEGAPUBLISHERS_ENTRY(14,	"Namco (Namcot)")
+SEGAPUBLISHERS_ENTRY(15,	"Sun Electronics (Sunsoft)")
+SEGAPUBLISHERS_ENTRY(16,	"Ma-Ba")
+SEGAPUBLISHERS_ENTRY(17,	"Dempa")
+SEGAPUBLISHERS_ENTRY(18,	"Tecno Soft")
+SEGAPUBLISHERS_ENTRY(19,	"Tecno Soft")
+SEGAPUBLISHERS_ENTRY(20,	"Asmik")
+SEGAPUBLISHERS_ENTRY(21,	"ASCII")
+SEGAPUBLISHERS_ENTRY(22,	"Micronet")
+SEGAPUBLISHERS_ENTRY(23,	"VIC Tokai")
+SEGAPUBLISHERS_ENTRY(24,	"Treco, Sammy")
+SEGAPUBLISHERS_ENTRY(25,	"Nippon Computer Systems (Masaya)")
+SEGAPUBLISHERS_ENTRY(26,	"Sigma Enterprises")
+SEGAPUBLISHERS_ENTRY(27,	"Toho")
+SEGAPUBLISHERS_ENTRY(28,	"HOT-B")
+SEGAPUBLISHERS_ENTRY(29,	"Kyugo")
+SEGAPUBLISHERS_ENTRY(30,	"Video System")
+SEGAPUBLISHERS_ENTRY(31,	"SNK")
+SEGAPUBLISHERS_ENTRY(32,	"Wolf Team")
+SEGAPUBLISHERS_ENTRY(33,	"Kaneko")
+SEGAPUBLISHERS_ENTRY(34,	"DreamWorks")
+SEGAPUBLISHERS_ENTRY(35,	"Seismic Software")
+SEGAPUBLISHERS_ENTRY(36,	"Tecmo")
+SEGAPUBLISHERS_ENTRY(38,	"Mediagenic")
+SEGAPUBLISHERS_ENTRY(40,	"Toaplan")
+SEGAPUBLISHERS_ENTRY(41,	"UNIPACC")
+SEGAPUBLISHERS_ENTRY(42,	"UPL")
+SEGAPUBLISHERS_ENTRY(43,	"Human")
+SEGAPUBLISHERS_ENTRY(44,	"Sanritsu (SIMS)")
+SEGAPUBLISHERS_ENTRY(45,	"Game Arts")
+SEGAPUBLISHERS_ENTRY(46,	"Kodansha Research Institute")
+SEGAPUBLISHERS_ENTRY(47,	"Sage's Creation")
+SEGAPUBLISHERS_ENTRY(48,	"Tengen (Time Warner Interactive)")
+SEGAPUBLISHERS_ENTRY(49,	"Telenet Japan, Micro World")
+SEGAPUBLISHERS_ENTRY(50,	"Electronic Arts")
+SEGAPUBLISHERS_ENTRY(51,	"Microcabin")
+SEGAPUBLISHERS_ENTRY(52,	"SystemSoft (SystemSoft Alpha)")
+SEGAPUBLISHERS_ENTRY(53,	"Riverhillsoft")
+SEGAPUBLISHERS_ENTRY(54,	"Face")
+SEGAPUBLISHERS_ENTRY(55,	"Nuvision Entertainment")
+SEGAPUBLISHERS_ENTRY(56,	"Razorsoft")
+SEGAPUBLISHERS_ENTRY(57,	"Jaleco")
+SEGAPUBLISHERS_ENTRY(58,	"Visco")
+SEGAPUBLISHERS_ENTRY(60,	"Victor Musical Industries (Victor Entertainment, Victor Soft)")
+SEGAPUBLISHERS_ENTRY(61,	"Toyo Recording Co. (Wonder Amusement Studio)")
+SEGAPUBLISHERS_ENTRY(62,	"Sony Imagesoft")
+SEGAPUBLISHERS_ENTRY(63,	"Toshiba EMI")
+SEGAPUBLISHERS_ENTRY(64,	"Information Global Service")
+SEGAPUBLISHERS_ENTRY(65,	"Tsukuda Ideal")
+SEGAPUBLISHERS_ENTRY(66,	"Compile")
+SEGAPUBLISHERS_ENTRY(67,	"Home Data (Magical)")
+SEGAPUBLISHERS_ENTRY(68,	"CSK Research Institute (CRI)")
+SEGAPUBLISHERS_ENTRY(69,	"Arena Entertainment")
+SEGAPUBLISHERS_ENTRY(70,	"Virgin Interactive")
+SEGAPUBLISHERS_ENTRY(71,	"Nihon Bussan (Nichibutsu)")
+SEGAPUBLISHERS_ENTRY(72,	"Varie")
+SEGAPUBLISHERS_ENTRY(73,	"Coconuts Japan, Soft Vision")
+SEGAPUBLISHERS_ENTRY(74,	"PALSOFT")
+SEGAPUBLISHERS_ENTRY(75,	"Pony Canyon")
+SEGAPUBLISHERS_ENTRY(76,	"Koei")
+SEGAPUBLISHERS_ENTRY(77,	"Takeru (Sur De Wave)")
+SEGAPUBLISHERS_ENTRY(79,	"U.S. Gold")
+SEGAPUBLISHERS_ENTRY(81,	"Acclaim Entertainment, Flying Edge")
+SEGAPUBLISHERS_ENTRY(83,	"GameTek")
+SEGAPUBLISHERS_ENTRY(84,	"Datawest")
+SEGAPUBLISHERS_ENTRY(85,	"PCM Complete")
+SEGAPUBLISHERS_ENTRY(86,	"Absolute Entertainment")
+SEGAPUBLISHERS_ENTRY(87,	"Mindscape (The Software Toolworks)")
+SEGAPUBLISHERS_ENTRY(88,	"Domark")
+SEGAPUBLISHERS_ENTRY(89,	"Parker Brothers")
+SEGAPUBLISHERS_ENTRY(91,	"Pack-In Video (Victor Interactive Software, Pack-In-Soft, Victor Soft)")
+SEGAPUBLISHERS_ENTRY(92,	"Polydor (Sandstorm)")
+SEGAPUBLISHERS_ENTRY(93,	"Sony")
+SEGAPUBLISHERS_ENTRY(95,	"Konami")
+SEGAPUBLISHERS_ENTRY(97,	"Tradewest, Williams Entertainment, Midway Games")
+SEGAPUBLISHERS_ENTRY(99,	"Success")
+SEGAPUBLISHERS_ENTRY(100,	"THQ, Black Pearl Software)")
+SEGAPUBLISHERS_ENTRY(101,	"TecMagik Entertainment")
+SEGAPUBLISHERS_ENTRY(102,	"Samsung")
+SEGAPUBLISHERS_ENTRY(103,	"Takara")
+SEGAPUBLISHERS_ENTRY(105,	"Shogakukan Production")
+SEGAPUBLISHERS_ENTRY(106,	"Electronic Arts Victor")
+SEGAPUBLISHERS_ENTRY(107,	"Electro Brain")
+SEGAPUBLISHERS_ENTRY(109,	"Saddleback Graphics")
+SEGAPUBLISHERS_ENTRY(110,	"Dynamix (Simon & Schuster Interactive)")
+SEGAPUBLISHERS_ENTRY(111,	"American Laser Games")
+SEGAPUBLISHERS_ENTRY(112,	"Hi-Tech Expressions")
+SEGAPUBLISHERS_ENTRY(113,	"Psygnosis")
+SEGAPUBLISHERS_ENTRY(114,	"T&E Soft")
+SEGAPUBLISHERS_ENTRY(115,	"Core Design")
+SEGAPUBLISHERS_ENTRY(118,	"The Learning Company")
+SEGAPUBLISHERS_ENTRY(119,	"Accolade")
+SEGAPUBLISHERS_ENTRY(120,	"Codemasters")
+SEGAPUBLISHERS_ENTRY(121,	"ReadySoft")
+SEGAPUBLISHERS_ENTRY(123,	"Gremlin Interactive")
+SEGAPUBLISHERS_ENTRY(124,	"Spectrum Holobyte")
+SEGAPUBLISHERS_ENTRY(125,	"Interplay")
+SEGAPUBLISHERS_ENTRY(126,	"Maxis")
+SEGAPUBLISHERS_ENTRY(127,	"Working Designs")
+SEGAPUBLISHERS_ENTRY(130,	"Activision")
+SEGAPUBLISHERS_ENTRY(132,	"Playmates Interactive Entertainment")
+SEGAPUBLISHERS_ENTRY(133,	"Bandai")
+SEGAPUBLISHERS_ENTRY(135,	"CapDisc")
+SEGAPUBLISHERS_ENTRY(137,	"ASC Games")
+SEGAPUBLISHERS_ENTRY(139,	"Viacom New Media")
+SEGAPUBLISHERS_ENTRY(141,	"Toei Video")
+SEGAPUBLISHERS_ENTRY(143,	"Hudson (Hudson Soft)")
+SEGAPUBLISHERS_ENTRY(144,	"Atlus")
+SEGAPUBLISHERS_ENTRY(145,	"Sony Music Entertainment")
+SEGAPUBLISHERS_ENTRY(146,	"Takara")
+SEGAPUBLISHERS_ENTRY(147,	"Sansan")
+SEGAPUBLISHERS_ENTRY(149,	"Nisshouiwai Infocom")
+SEGAPUBLISHERS_ENTRY(150,	"Imagineer (Imadio)")
+SEGAPUBLISHERS_ENTRY(151,	"Infogrames")
+SEGAPUBLISHERS_ENTRY(152,	"Davidson & Associates")
+SEGAPUBLISHERS_ENTRY(153,	"Rocket Science Games")
+SEGAPUBLISHERS_ENTRY(154,	"Technōs Japan")
+SEGAPUBLISHERS_ENTRY(157,	"Angel")
+SEGAPUBLISHERS_ENTRY(158,	"Mindscape")
+SEGAPUBLISHERS_ENTRY(159,	"Crystal Dynamics")
+SEGAPUBLISHERS_ENTRY(160,	"Sales Curve Interactive")
+SEGAPUBLISHERS_ENTRY(161,	"Fox Interactive")
+SEGAPUBLISHERS_ENTRY(162,	"Digital Pictures")
+SEGAPUBLISHERS_ENTRY(164,	"Ocean Software")
+SEGAPUBLISHERS_ENTRY(165,	"Seta")
+SEGAPUBLISHERS_ENTRY(166,	"Altron")
+SEGAPUBLISHERS_ENTRY(167,	"ASK Kodansha")
+SEGAPUBLISHERS_ENTRY(168,	"Athena")
+SEGAPUBLISHERS_ENTRY(169,	"Gakken")
+SEGAPUBLISHERS_ENTRY(170,	"General Entertainment")
+SEGAPUBLISHERS_ENTRY(172,	"EA Sports")
+SEGAPUBLISHERS_ENTRY(174,	"Glams")
+SEGAPUBLISHERS_ENTRY(176,	"ASCII Something Good")
+SEGAPUBLISHERS_ENTRY(177,	"Ubisoft")
+SEGAPUBLISHERS_ENTRY(178,	"Hitachi")
+SEGAPUBLISHERS_ENTRY(180,	"BMG Interactive Entertainment (BMG Victor, BMG Japan)")
+SEGAPUBLISHERS_ENTRY(181,	"Obunsha")
+SEGAPUBLISHERS_ENTRY(182,	"Thinking Cap")
+SEGAPUBLISHERS_ENTRY(185,	"Gaga Communications")
+SEGAPUBLISHERS_ENTRY(186,	"SoftBank (Game Bank)")
+SEGAPUBLISHERS_ENTRY(187,	"Naxat Soft (Pionesoft)")
+SEGAPUBLISHERS_ENTRY(188,	"Mizuki (Spike, Maxbet)")
+SEGAPUBLISHERS_ENTRY(189,	"KAZe")
+SEGAPUBLISHERS_ENTRY(193,	"Sega Yonezawa")
+SEGAPUBLISHERS_ENTRY(194,	"We Net")
+SEGAPUBLISHERS_ENTRY(195,	"Datam Polystar")
+SEGAPUBLISHERS_ENTRY(197,	"KID")
+SEGAPUBLISHERS_ENTRY(198,	"Epoch")
+SEGAPUBLISHERS_ENTRY(199,	"Ving")
+SEGAPUBLISHERS_ENTRY(200,	"Yoshimoto Kogyo")
+SEGAPUBLISHERS_ENTRY(201,	"NEC Interchannel (InterChannel)")
+SEGAPUBLISHERS_ENTRY(202,	"Sonnet Computer Entertainment")
+SEGAPUBLISHERS_ENTRY(203,	"Game Studio")
+SEGAPUBLISHERS_ENTRY(204,	"Psikyo")
+SEGAPUBLISHERS_ENTRY(205,	"Media Entertainment")
+SEGAPUBLISHERS_ENTRY(206,	"Banpresto")
+SEGAPUBLISHERS_ENTRY(207,	"Ecseco Development")
+SEGAPUBLISHERS_ENTRY(208,	"Bullet-Proof Software (BPS)")
+SEGAPUBLISHERS_ENTRY(209,	"Sieg")
+SEGAPUBLISHERS_ENTRY(210,	"Yanoman")
+SEGAPUBLISHERS_ENTRY(212,	"Oz Club")
+SEGAPUBLISHERS_ENTRY(213,	"Nihon Create")
+SEGAPUBLISHERS_ENTRY(214,	"Media Rings Corporation")
+SEGAPUBLISHERS_ENTRY(215,	"Shoeisha")
+SEGAPUBLISHERS_ENTRY(216,	"OPeNBooK")
+SEGAPUBLISHERS_ENTRY(217,	"Hakuhodo (Hamlet)")
+SEGAPUBLISHERS_ENTRY(218,	"Aroma (Yumedia)")
+SEGAPUBLISHERS_ENTRY(219,	"Societa Daikanyama")
+SEGAPUBLISHERS_ENTRY(220,	"Arc System Works")
+SEGAPUBLISHERS_ENTRY(221,	"Climax Entertainment")
+SEGAPUBLISHERS_ENTRY(222,	"Pioneer LDC")
+SEGAPUBLISHERS_ENTRY(223,	"Tokuma Shoten")
+SEGAPUBLISHERS_ENTRY(224,	"I'MAX")
+SEGAPUBLISHERS_ENTRY(226,	"Shogakukan")
+SEGAPUBLISHERS_ENTRY(227,	"Vantan International")
+SEGAPUBLISHERS_ENTRY(229,	"Titus")
+SEGAPUBLISHERS_ENTRY(230,	"LucasArts")
+SEGAPUBLISHERS_ENTRY(231,	"Pai")
+SEGAPUBLISHERS_ENTRY(232,	"Ecole (Reindeer)")
+SEGAPUBLISHERS_ENTRY(233,	"Nayuta")
+SEGAPUBLISHERS_ENTRY(234,	"Bandai Visual")
+SEGAPUBLISHERS_ENTRY(235,	"Quintet")
+SEGAPUBLISHERS_ENTRY(239,	"Disney Interactive")
+SEGAPUBLISHERS_ENTRY(240,	"9003 (OpenBook9003)")
+SEGAPUBLISHERS_ENTRY(241,	"Multisoft")
+SEGAPUBLISHERS_ENTRY(242,	"Sky Think System")
+SEGAPUBLISHERS_ENTRY(243,	"OCC")
+SEGAPUBLISHERS_ENTRY(246,	"Increment P (iPC)")
+SEGAPUBLISHERS_ENTRY(249,	"King Records")
+SEGAPUBLISHERS_ENTRY(250,	"Fun House")
+SEGAPUBLISHERS_ENTRY(251,	"Patra")
+SEGAPUBLISHERS_ENTRY(252,	"Inner Brain")
+SEGAPUBLISHERS_ENTRY(253,	"Make Software")
+SEGAPUBLISHERS_ENTRY(254,	"GT Interactive Software")
+SEGAPUBLISHERS_ENTRY(255,	"Kodansha")
+SEGAPUBLISHERS_ENTRY(257,	"Clef")
+SEGAPUBLISHERS_ENTRY(259,	"C-Seven")
+SEGAPUBLISHERS_ENTRY(260,	"Fujitsu Parex")
+SEGAPUBLISHERS_ENTRY(261,	"Xing Entertainment")
+SEGAPUBLISHERS_ENTRY(264,	"Media Quest")
+SEGAPUBLISHERS_ENTRY(268,	"Wooyoung System")
+SEGAPUBLISHERS_ENTRY(270,	"Nihon System")
+SEGAPUBLISHERS_ENTRY(271,	"Scholar")
+SEGAPUBLISHERS_ENTRY(273,	"Datt Japan")
+SEGAPUBLISHERS_ENTRY(278,	"MediaWorks")
+SEGAPUBLISHERS_ENTRY(279,	"Kadokawa Shoten")
+SEGAPUBLISHERS_ENTRY(280,	"Elf")
+SEGAPUBLISHERS_ENTRY(282,	"Tomy")
+SEGAPUBLISHERS_ENTRY(289,	"KSS")
+SEGAPUBLISHERS_ENTRY(290,	"Mainichi Communications")
+SEGAPUBLISHERS_ENTRY(291,	"Warashi")
+SEGAPUBLISHERS_ENTRY(292,	"Metro")
+SEGAPUBLISHERS_ENTRY(293,	"Sai-Mate")
+SEGAPUBLISHERS_ENTRY(294,	"Kokopeli Digital Studios")
+SEGAPUBLISHERS_ENTRY(296,	"Planning Office Wada (POW)")
+SEGAPUBLISHERS_ENTRY(297,	"Telstar")
+SEGAPUBLISHERS_ENTRY(300,	"Warp, Kumon Publishing")
+SEGAPUBLISHERS_ENTRY(303,	"Masudaya")
+SEGAPUBLISHERS_ENTRY(306,	"Soft Office")
+SEGAPUBLISHERS_ENTRY(307,	"Empire Interactive")
+SEGAPUBLISHERS_ENTRY(308,	"Genki (Sada Soft)")
+SEGAPUBLISHERS_ENTRY(309,	"Neverland")
+SEGAPUBLISHERS_ENTRY(310,	"Shar Rock")
+SEGAPUBLISHERS_ENTRY(311,	"Natsume")
+SEGAPUBLISHERS_ENTRY(312,	"Nexus Interact")
+SEGAPUBLISHERS_ENTRY(313,	"Aplix Corporation")
+SEGAPUBLISHERS_ENTRY(314,	"Omiya Soft")
+SEGAPUBLISHERS_ENTRY(315,	"JVC")
+SEGAPUBLISHERS_ENTRY(316,	"Zoom")
+SEGAPUBLISHERS_ENTRY(321,	"TEN Institute")
+SEGAPUBLISHERS_ENTRY(322,	"Fujitsu")
+SEGAPUBLISHERS_ENTRY(325,	"TGL")
+SEGAPUBLISHERS_ENTRY(326,	"Red Company (Red Entertainment)")
+SEGAPUBLISHERS_ENTRY(328,	"Waka Manufacturing")
+SEGAPUBLISHERS_ENTRY(329,	"Treasure")
+SEGAPUBLISHERS_ENTRY(330,	"Tokuma Shoten Intermedia")
+SEGAPUBLISHERS_ENTRY(331,	"Sonic! Software Planning (Camelot)")
+SEGAPUBLISHERS_ENTRY(339,	"Sting")
+SEGAPUBLISHERS_ENTRY(340,	"Chunsoft")
+SEGAPUBLISHERS_ENTRY(341,	"Aki")
+SEGAPUBLISHERS_ENTRY(342,	"From Software")
+SEGAPUBLISHERS_ENTRY(346,	"Daiki")
+SEGAPUBLISHERS_ENTRY(348,	"Aspect")
+SEGAPUBLISHERS_ENTRY(350,	"Micro Vision")
+SEGAPUBLISHERS_ENTRY(351,	"Gainax")
+SEGAPUBLISHERS_ENTRY(354,	"FortyFive (45XLV)")
+SEGAPUBLISHERS_ENTRY(355,	"Enix")
+SEGAPUBLISHERS_ENTRY(356,	"Ray Corporation")
+SEGAPUBLISHERS_ENTRY(357,	"Tonkin House")
+SEGAPUBLISHERS_ENTRY(360,	"Outrigger")
+SEGAPUBLISHERS_ENTRY(361,	"B-Factory")
+SEGAPUBLISHERS_ENTRY(362,	"LayUp")
+SEGAPUBLISHERS_ENTRY(363,	"Axela")
+SEGAPUBLISHERS_ENTRY(364,	"WorkJam")
+SEGAPUBLISHERS_ENTRY(365,	"Nihon Syscom (Syscom Entertainment)")
+SEGAPUBLISHERS_ENTRY(367,	"FOG (Full On Games)")
+SEGAPUBLISHERS_ENTRY(368,	"Eidos Interactive")
+SEGAPUBLISHERS_ENTRY(369,	"UEP Systems")
+SEGAPUBLISHERS_ENTRY(370,	"Shouei System")
+SEGAPUBLISHERS_ENTRY(371,	"GMF")
+SEGAPUBLISHERS_ENTRY(373,	"ADK")
+SEGAPUBLISHERS_ENTRY(374,	"Softstar Entertainment")
+SEGAPUBLISHERS_ENTRY(375,	"Nexton")
+SEGAPUBLISHERS_ENTRY(376,	"Denshi Media Services")
+SEGAPUBLISHERS_ENTRY(379,	"Takuyo")
+SEGAPUBLISHERS_ENTRY(380,	"Starlight Marry")
+SEGAPUBLISHERS_ENTRY(381,	"Crystal Vision")
+SEGAPUBLISHERS_ENTRY(382,	"Kamata and Partners")
+SEGAPUBLISHERS_ENTRY(383,	"AquaPlus")
+SEGAPUBLISHERS_ENTRY(384,	"Media Gallop")
+SEGAPUBLISHERS_ENTRY(385,	"Culture Brain")
+SEGAPUBLISHERS_ENTRY(386,	"Locus")
+SEGAPUBLISHERS_ENTRY(387,	"Entertainment Software Publishing (ESP)")
+SEGAPUBLISHERS_ENTRY(388,	"NEC Home Electronics")
+SEGAPUBLISHERS_ENTRY(390,	"Pulse Interactive")
+SEGAPUBLISHERS_ENTRY(391,	"Random House")
+SEGAPUBLISHERS_ENTRY(394,	"Vivarium")
+SEGAPUBLISHERS_ENTRY(395,	"Mebius")
+SEGAPUBLISHERS_ENTRY(396,	"Panther Software")
+SEGAPUBLISHERS_ENTRY(397,	"TBS")
+SEGAPUBLISHERS_ENTRY(398,	"NetVillage (Gamevillage)")
+SEGAPUBLISHERS_ENTRY(400,	"Vision (Noisia)")
+SEGAPUBLISHERS_ENTRY(401,	"Shangri-La")
+SEGAPUBLISHERS_ENTRY(402,	"Crave Entertainment")
+SEGAPUBLISHERS_ENTRY(403,	"Metro3D")
+SEGAPUBLISHERS_ENTRY(404,	"Majesco")
+SEGAPUBLISHERS_ENTRY(405,	"Take-Two Interactive")
+SEGAPUBLISHERS_ENTRY(406,	"Hasbro Interactive")
+SEGAPUBLISHERS_ENTRY(407,	"Rage Software (Rage Games)")
+SEGAPUBLISHERS_ENTRY(408,	"Marvelous Entertainment")
+SEGAPUBLISHERS_ENTRY(409,	"Bottom Up")
+SEGAPUBLISHERS_ENTRY(410,	"Daikoku Denki")
+SEGAPUBLISHERS_ENTRY(411,	"Sunrise Interactive")
+SEGAPUBLISHERS_ENTRY(412,	"Bimboosoft")
+SEGAPUBLISHERS_ENTRY(413,	"UFO")
+SEGAPUBLISHERS_ENTRY(414,	"Mattel Interactive")
+SEGAPUBLISHERS_ENTRY(415,	"CaramelPot")
+SEGAPUBLISHERS_ENTRY(416,	"Vatical Entertainment")
+SEGAPUBLISHERS_ENTRY(417,	"Ripcord Games")
+SEGAPUBLISHERS_ENTRY(418,	"Sega Toys")
+SEGAPUBLISHERS_ENTRY(419,	"Gathering of Developers")
+SEGAPUBLISHERS_ENTRY(421,	"Rockstar Games")
+SEGAPUBLISHERS_ENTRY(422,	"Winkysoft")
+SEGAPUBLISHERS_ENTRY(423,	"Cyberfront")
+SEGAPUBLISHERS_ENTRY(424,	"DaZZ")
+SEGAPUBLISHERS_ENTRY(428,	"Kobi")
+SEGAPUBLISHERS_ENTRY(429,	"Fujicom")
+SEGAPUBLISHERS_ENTRY(433,	"Real Vision")
+SEGAPUBLISHERS_ENTRY(434,	"Visit")
+SEGAPUBLISHERS_ENTRY(435,	"Global A Entertainment")
+SEGAPUBLISHERS_ENTRY(438,	"Studio Wonder Effect")
+SEGAPUBLISHERS_ENTRY(439,	"Media Factory")
+SEGAPUBLISHERS_ENTRY(441,	"Red")
+SEGAPUBLISHERS_ENTRY(443,	"Agetec")
+SEGAPUBLISHERS_ENTRY(444,	"Abel")
+SEGAPUBLISHERS_ENTRY(445,	"Softmax")
+SEGAPUBLISHERS_ENTRY(446,	"Isao")
+SEGAPUBLISHERS_ENTRY(447,	"Kool Kizz")
+SEGAPUBLISHERS_ENTRY(448,	"GeneX")
+SEGAPUBLISHERS_ENTRY(449,	"Xicat Interactive")
+SEGAPUBLISHERS_ENTRY(450,	"Swing! Entertainment")
+SEGAPUBLISHERS_ENTRY(451,	"Yuke's")
+SEGAPUBLISHERS_ENTRY(454,	"AAA Game")
+SEGAPUBLISHERS_ENTRY(455,	"TV Asahi")
+SEGAPUBLISHERS_ENTRY(456,	"Crazy Games")
+SEGAPUBLISHERS_ENTRY(457,	"Atmark")
+SEGAPUBLISHERS_ENTRY(458,	"Hackberry")
+SEGAPUBLISHERS_ENTRY(460,	"AIA")
+SEGAPUBLISHERS_ENTRY(461,	"Starfish-SD")
+SEGAPUBLISHERS_ENTRY(462,	"Idea Factory")
+SEGAPUBLISHERS_ENTRY(463,	"Broccoli")
+SEGAPUBLISHERS_ENTRY(465,	"Oaks (Princess Soft)")
+SEGAPUBLISHERS_ENTRY(466,	"Bigben Interactive")
+SEGAPUBLISHERS_ENTRY(467,	"G.rev")
+SEGAPUBLISHERS_ENTRY(469,	"Symbio Planning")
+SEGAPUBLISHERS_ENTRY(471,	"Alchemist")
+SEGAPUBLISHERS_ENTRY(473,	"SNK Playmore")
+SEGAPUBLISHERS_ENTRY(474,	"D3Publisher")
+SEGAPUBLISHERS_ENTRY(475,	"Rain Software (Charara)")
+SEGAPUBLISHERS_ENTRY(476,	"Good Navigate (GN Software)")
+SEGAPUBLISHERS_ENTRY(477,	"Alfa System")
+SEGAPUBLISHERS_ENTRY(478,	"Milestone Inc.")
+SEGAPUBLISHERS_ENTRY(479,	"Triangle Service")
+
+#undef SEGAPUBLISHERS_ENTRY
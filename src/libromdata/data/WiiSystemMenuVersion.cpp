@@ -19,10 +19,13 @@
  ***************************************************************************/
 
 #include "WiiSystemMenuVersion.hpp"
+#include "PerfectHash.hpp"
+
+// One-time initialization.
+#include "librpbase/threads/pthread_once.h"
 
 // C includes.
 #include <stdint.h>
-#include <stdlib.h>
 
 namespace LibRomData {
 
@@ -48,13 +51,15 @@ class WiiSystemMenuVersionPrivate {
 		static const SysVersionEntry_t sysVersionList[];
 
 	public:
+		// Perfect hash index.
+		static PerfectHash sysVersionList_hash;
+		static pthread_once_t once_control;
+
 		/**
-		 * Comparison function for bsearch().
-		 * @param a
-		 * @param b
-		 * @return
+		 * Build the perfect hash index.
+		 * Called by pthread_once().
 		 */
-		static int RP_C_API compar(const void *a, const void *b);
+		static void initHash(void);
 };
 
 /** WiiSystemMenuVersionPrivate **/
@@ -97,19 +102,18 @@ const WiiSystemMenuVersionPrivate::SysVersionEntry_t WiiSystemMenuVersionPrivate
 	{0, ""}
 };
 
+// Perfect hash index.
+PerfectHash WiiSystemMenuVersionPrivate::sysVersionList_hash;
+pthread_once_t WiiSystemMenuVersionPrivate::once_control = PTHREAD_ONCE_INIT;
+
 /**
- * Comparison function for bsearch().
- * @param a
- * @param b
- * @return
+ * Build the perfect hash index.
+ * Called by pthread_once().
  */
-int RP_C_API WiiSystemMenuVersionPrivate::compar(const void *a, const void *b)
+void WiiSystemMenuVersionPrivate::initHash(void)
 {
-	unsigned int v1 = static_cast<const SysVersionEntry_t*>(a)->version;
-	unsigned int v2 = static_cast<const SysVersionEntry_t*>(b)->version;
-	if (v1 < v2) return -1;
-	if (v1 > v2) return 1;
-	return 0;
+	sysVersionList_hash.init(sysVersionList,
+		ARRAY_SIZE(sysVersionList)-1, &SysVersionEntry_t::version);
 }
 
 /** WiiSystemMenuVersion **/
@@ -121,15 +125,10 @@ int RP_C_API WiiSystemMenuVersionPrivate::compar(const void *a, const void *b)
  */
 const char *WiiSystemMenuVersion::lookup(unsigned int version)
 {
-	// Do a binary search.
-	const WiiSystemMenuVersionPrivate::SysVersionEntry_t key = {static_cast<uint16_t>(version), ""};
-	const WiiSystemMenuVersionPrivate::SysVersionEntry_t *res =
-		static_cast<const WiiSystemMenuVersionPrivate::SysVersionEntry_t*>(bsearch(&key,
-			WiiSystemMenuVersionPrivate::sysVersionList,
-			ARRAY_SIZE(WiiSystemMenuVersionPrivate::sysVersionList)-1,
-			sizeof(WiiSystemMenuVersionPrivate::SysVersionEntry_t),
-			WiiSystemMenuVersionPrivate::compar));
-	return (res ? res->str : nullptr);
+	// Look up the version in the perfect hash index.
+	pthread_once(&WiiSystemMenuVersionPrivate::once_control, WiiSystemMenuVersionPrivate::initHash);
+	const int idx = WiiSystemMenuVersionPrivate::sysVersionList_hash.find(static_cast<uint16_t>(version));
+	return (idx >= 0 ? WiiSystemMenuVersionPrivate::sysVersionList[idx].str : nullptr);
 }
 
 }
@@ -19,9 +19,10 @@
  ***************************************************************************/
 
 #include "WiiUData.hpp"
+#include "PerfectHash.hpp"
 
-// C includes.
-#include <stdlib.h>
+// One-time initialization.
+#include "librpbase/threads/pthread_once.h"
 
 namespace LibRomData {
 
@@ -56,13 +57,16 @@ class WiiUDataPrivate {
 		 */
 		static const WiiUDiscPublisher disc_publishers_region[];
 
+		// Perfect hash indexes.
+		static PerfectHash disc_publishers_noregion_hash;
+		static PerfectHash disc_publishers_region_hash;
+		static pthread_once_t once_control;
+
 		/**
-		 * Comparison function for bsearch().
-		 * @param a
-		 * @param b
-		 * @return
+		 * Build the perfect hash indexes.
+		 * Called by pthread_once().
 		 */
-		static int RP_C_API compar(const void *a, const void *b);
+		static void initHashes(void);
 };
 
 /** WiiUDataPrivate **/
@@ -327,19 +331,21 @@ const WiiUDataPrivate::WiiUDiscPublisher WiiUDataPrivate::disc_publishers_region
 	{0, 0}
 };
 
+// Perfect hash indexes.
+PerfectHash WiiUDataPrivate::disc_publishers_noregion_hash;
+PerfectHash WiiUDataPrivate::disc_publishers_region_hash;
+pthread_once_t WiiUDataPrivate::once_control = PTHREAD_ONCE_INIT;
+
 /**
- * Comparison function for bsearch().
- * @param a
- * @param b
- * @return
+ * Build the perfect hash indexes.
+ * Called by pthread_once().
  */
-int RP_C_API WiiUDataPrivate::compar(const void *a, const void *b)
+void WiiUDataPrivate::initHashes(void)
 {
-	unsigned int id4_1 = static_cast<const WiiUDiscPublisher*>(a)->id4;
-	unsigned int id4_2 = static_cast<const WiiUDiscPublisher*>(b)->id4;
-	if (id4_1 < id4_2) return -1;
-	if (id4_1 > id4_2) return 1;
-	return 0;
+	disc_publishers_noregion_hash.init(disc_publishers_noregion,
+		ARRAY_SIZE(disc_publishers_noregion)-1, &WiiUDiscPublisher::id4);
+	disc_publishers_region_hash.init(disc_publishers_region,
+		ARRAY_SIZE(disc_publishers_region)-1, &WiiUDiscPublisher::id4);
 }
 
 /** WiiUData **/
@@ -356,37 +362,23 @@ int RP_C_API WiiUDataPrivate::compar(const void *a, const void *b)
  */
 uint32_t WiiUData::lookup_disc_publisher(const char *id4)
 {
-	// Check the region-independent list first.
-	WiiUDataPrivate::WiiUDiscPublisher key;
-	key.id4 = (static_cast<uint8_t>(id4[0]) << 24) |
-		  (static_cast<uint8_t>(id4[1]) << 16) |
-		  (static_cast<uint8_t>(id4[2]) << 8) | 'x';
-	key.publisher = 0;
+	pthread_once(&WiiUDataPrivate::once_control, WiiUDataPrivate::initHashes);
 
-	// Do a binary search.
-	const WiiUDataPrivate::WiiUDiscPublisher *res =
-		static_cast<const WiiUDataPrivate::WiiUDiscPublisher*>(bsearch(&key,
-			WiiUDataPrivate::disc_publishers_noregion,
-			ARRAY_SIZE(WiiUDataPrivate::disc_publishers_noregion)-1,
-			sizeof(WiiUDataPrivate::WiiUDiscPublisher),
-			WiiUDataPrivate::compar));
-	if (res) {
+	// Check the region-independent list first.
+	uint32_t key = (static_cast<uint8_t>(id4[0]) << 24) |
+		       (static_cast<uint8_t>(id4[1]) << 16) |
+		       (static_cast<uint8_t>(id4[2]) << 8) | 'x';
+	int idx = WiiUDataPrivate::disc_publishers_noregion_hash.find(key);
+	if (idx >= 0) {
 		// Found a publisher in the region-independent list.
-		return res->publisher;
+		return WiiUDataPrivate::disc_publishers_noregion[idx].publisher;
 	}
 
 	// Check the region-specific list.
-	key.id4 &= ~0xFF;
-	key.id4 |= static_cast<uint8_t>(id4[3]);
-
-	// Do a binary search.
-	res = static_cast<const WiiUDataPrivate::WiiUDiscPublisher*>(bsearch(&key,
-			WiiUDataPrivate::disc_publishers_region,
-			ARRAY_SIZE(WiiUDataPrivate::disc_publishers_region)-1,
-			sizeof(WiiUDataPrivate::WiiUDiscPublisher),
-			WiiUDataPrivate::compar));
-
-	return (res ? res->publisher : 0);
+	key &= ~0xFF;
+	key |= static_cast<uint8_t>(id4[3]);
+	idx = WiiUDataPrivate::disc_publishers_region_hash.find(key);
+	return (idx >= 0 ? WiiUDataPrivate::disc_publishers_region[idx].publisher : 0);
 }
 
 }
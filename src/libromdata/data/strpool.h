@@ -0,0 +1,94 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libromdata)                       *
+ * strpool.h: String pool macros for static data tables.                   *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef __ROMPROPERTIES_LIBROMDATA_DATA_STRPOOL_H__
+#define __ROMPROPERTIES_LIBROMDATA_DATA_STRPOOL_H__
+
+/**
+ * Tables of `const char*` need one relocation per string when built as
+ * position-independent code. String pools avoid this by storing all of
+ * a table's strings in a single struct of char arrays, with the table
+ * itself storing offsets into the struct.
+ *
+ * The table is written in a separate *_data.h file, one entry per line,
+ * using a table-specific entry macro. The file is included three times:
+ * 1. STRPOOL_MEMBER(): Declare the string pool struct.
+ * 2. STRPOOL_STRING(): Initialize the string pool.
+ * 3. STRPOOL_OFFSET(): Build the table.
+ * If the file has more than one table, it's included once per table
+ * in step 3. The includer defines the entry macros before each
+ * #include, and the *_data.h file #undef's them at the end.
+ *
+ * Each string's member name is generated from its line number,
+ * so there must be at most one entry per line. If an entry has
+ * more than one string, use a different tag for each string.
+ *
+ * The first member of each string pool struct should be an empty
+ * string, STRPOOL_NULL; offset 0 is used for nullptr. Null entries
+ * use a separate entry macro that expands to 0 in step 3.
+ */
+
+#include <stddef.h>
+
+#define STRPOOL_NAME_INT2(tag, line)	tag##_##line
+#define STRPOOL_NAME_INT(tag, line)	STRPOOL_NAME_INT2(tag, line)
+
+/**
+ * Get the member name for a string on the current line.
+ * @param tag Tag.
+ */
+#define STRPOOL_NAME(tag)	STRPOOL_NAME_INT(tag, __LINE__)
+
+/**
+ * Declare a string pool member for a string on the current line.
+ * @param tag Tag.
+ * @param str String literal.
+ */
+#define STRPOOL_MEMBER(tag, str)	char STRPOOL_NAME(tag)[sizeof(str)];
+
+/**
+ * Initialize a string pool member.
+ * @param str String literal.
+ */
+#define STRPOOL_STRING(str)	str,
+
+/**
+ * Get the offset of a string on the current line.
+ * @param pool_t String pool struct type.
+ * @param tag Tag.
+ */
+#define STRPOOL_OFFSET(pool_t, tag)	offsetof(pool_t, STRPOOL_NAME(tag))
+
+/**
+ * Empty string at the start of each string pool.
+ * Offset 0 is used for nullptr.
+ */
+#define STRPOOL_NULL	strpool_null
+
+/**
+ * Get a string from a string pool.
+ * @param pool String pool.
+ * @param offset Offset. (If 0, nullptr is returned.)
+ * @return String, or nullptr if offset is 0.
+ */
+#define STRPOOL_GET(pool, offset) \
+	((offset) != 0 ? reinterpret_cast<const char*>(&(pool)) + (offset) : nullptr)
+
+#endif /* __ROMPROPERTIES_LIBROMDATA_DATA_STRPOOL_H__ */
@@ -30,6 +30,7 @@ using LibCacheMgr::CacheManager;
 // librpbase
 #include "librpbase/RomData.hpp"
 #include "librpbase/file/RpFile.hpp"
+#include "librpbase/file/IoBudget.hpp"
 #include "librpbase/img/rp_image.hpp"
 #include "librpbase/img/RpImageLoader.hpp"
 #include "librpbase/config/Config.hpp"
@@ -149,12 +150,46 @@ ImgClass TCreateThumbnail<ImgClass>::getExternalImage(
 		return getNullImgClass();
 	}
 
+	// If the image doesn't need nearest-neighbor scaling,
+	// it can be decoded at a reduced size if the image
+	// format supports it.
+	const int dec_size = (romData->imgpf(imageType) & RomData::IMGPF_RESCALE_NEAREST) ? 0 : req_size;
+
+	// The I/O budget only covers the ROM image, so suspend it
+	// while downloading and loading images from the cache.
+	IoBudget::Scope noBudget(nullptr);
+
 	// NOTE: This will force a configuration timestamp check.
 	const Config *const config = Config::instance();
 	const bool extImgDownloadEnabled = config->extImgDownloadEnabled();
 	const bool downloadHighResScans = config->downloadHighResScans();
 
 	CacheManager cache;
+	cache.setRevalidateInterval(static_cast<time_t>(config->cacheRevalidateDays()) * 86400);
+	cache.setNegativeCacheTTL(static_cast<time_t>(config->negativeCacheDays()) * 86400,
+		static_cast<time_t>(config->negativeCacheMaxDays()) * 86400);
+	cache.setCacheMaxSize(static_cast<uint64_t>(config->cacheMaxSize()) * 1024 * 1024);
+	if (extImgDownloadEnabled && extURLs.size() > 1) {
+		// Multiple candidates. Download them concurrently
+		// so the loop below only has to check the cache.
+		// Lower-priority downloads are cancelled once the
+		// best available image has been downloaded.
+		std::vector<CacheManager::DownloadRequest> requests;
+		requests.reserve(extURLs.size());
+		for (auto iter = extURLs.cbegin(); iter != extURLs.cend(); ++iter) {
+			if (!downloadHighResScans && iter->high_res)
+				continue;
+			requests.push_back(CacheManager::DownloadRequest(iter->url, iter->cache_key));
+		}
+		if (requests.size() > 1) {
+			// NOTE: All candidates use the proxy for the first URL.
+			// They're usually on the same server.
+			std::string proxy = proxyForUrl(requests[0].url);
+			cache.setProxyUrl(!proxy.empty() ? proxy.c_str() : nullptr);
+			cache.downloadFirst(requests);
+		}
+	}
+
 	for (auto iter = extURLs.cbegin(); iter != extURLs.cend(); ++iter) {
 		const RomData::ExtURL &extURL = *iter;
 		std::string proxy = proxyForUrl(extURL.url);
@@ -184,34 +219,66 @@ ImgClass TCreateThumbnail<ImgClass>::getExternalImage(
 		if (cache_filename.empty())
 			continue;
 
-		// Attempt to load the image.
-		unique_IRpFile<RpFile> file(new RpFile(cache_filename, RpFile::FM_OPEN_READ));
-		if (file->isOpen()) {
-			unique_ptr<rp_image> dl_img(RpImageLoader::load(file.get()));
-			if (dl_img && dl_img->isValid()) {
-				// Image loaded successfully.
-				file->close();
-				ImgClass ret_img = rpImageToImgClass(dl_img.get());
-				if (isImgClassValid(ret_img)) {
-					// Image converted successfully.
-					if (pOutSize) {
-						// Get the image size.
-						pOutSize->width = dl_img->width();
-						pOutSize->height = dl_img->height();
-					}
-					// Get the sBIT metadata.
-					if (sBIT) {
-						if (dl_img->get_sBIT(sBIT) != 0) {
-							// No sBIT metadata.
-							// Clear the struct.
-							memset(sBIT, 0, sizeof(*sBIT));
+		// Check for a scaled image first.
+		// NOTE: Images that need nearest-neighbor scaling
+		// are used as-is, so they aren't scaled here.
+		unique_ptr<rp_image> dl_img;
+		if (dec_size > 0) {
+			dl_img.reset(CacheManager::loadScaledImage(cache_filename, dec_size));
+		}
+
+		if (!dl_img) {
+			// Attempt to load the image.
+			unique_IRpFile<RpFile> file(new RpFile(cache_filename, RpFile::FM_OPEN_READ));
+			if (!file->isOpen())
+				continue;
+			dl_img.reset(RpImageLoader::load(file.get(), dec_size));
+			file->close();
+
+			if (dl_img && dl_img->isValid() && dec_size > 0) {
+				// Scale the image down to the requested size,
+				// and store it so the next request doesn't
+				// have to decode the original image again.
+				// NOTE: If the image is already small enough,
+				// it isn't stored, since that wouldn't save
+				// anything over decoding the original image.
+				ImgSize img_sz = {dl_img->width(), dl_img->height()};
+				if (img_sz.width > dec_size || img_sz.height > dec_size) {
+					const ImgSize tgt_sz = {dec_size, dec_size};
+					rescale_aspect(img_sz, tgt_sz);
+					if (img_sz.width > 0 && img_sz.height > 0) {
+						rp_image *const scaled_img = dl_img->downscaled(img_sz.width, img_sz.height);
+						if (scaled_img) {
+							dl_img.reset(scaled_img);
+							CacheManager::storeScaledImage(cache_filename, dec_size, dl_img.get());
 						}
 					}
-					// TODO: Transparency processing?
-					return ret_img;
 				}
 			}
 		}
+
+		if (dl_img && dl_img->isValid()) {
+			// Image loaded successfully.
+			ImgClass ret_img = rpImageToImgClass(dl_img.get());
+			if (isImgClassValid(ret_img)) {
+				// Image converted successfully.
+				if (pOutSize) {
+					// Get the image size.
+					pOutSize->width = dl_img->width();
+					pOutSize->height = dl_img->height();
+				}
+				// Get the sBIT metadata.
+				if (sBIT) {
+					if (dl_img->get_sBIT(sBIT) != 0) {
+						// No sBIT metadata.
+						// Clear the struct.
+						memset(sBIT, 0, sizeof(*sBIT));
+					}
+				}
+				// TODO: Transparency processing?
+				return ret_img;
+			}
+		}
 	}
 
 	// No image.
@@ -342,7 +409,9 @@ int TCreateThumbnail<ImgClass>::getThumbnail(const RomData *romData, int req_siz
 
 	if (!isImgClassValid(ret_img)) {
 		// No image.
-		return RPCT_SOURCE_FILE_NO_IMAGE;
+		return (IoBudget::isCurrentExceeded()
+			? RPCT_SOURCE_FILE_IO_BUDGET
+			: RPCT_SOURCE_FILE_NO_IMAGE);
 	}
 
 skip_image_check:
@@ -419,6 +488,14 @@ skip_image_check:
 template<typename ImgClass>
 int TCreateThumbnail<ImgClass>::getThumbnail(IRpFile *file, int req_size, ImgClass &ret_img, rp_image::sBIT_t *sBIT)
 {
+	// Limit the I/O used for the ROM image,
+	// unless the caller already set a budget.
+	IoBudget *const callerBudget = IoBudget::current();
+	const IoBudget::Limits budgetLimits = Config::instance()->ioBudget();
+	IoBudget budget(budgetLimits);
+	IoBudget::Scope budgetScope(callerBudget ? callerBudget
+		: (budgetLimits.isEnabled() ? &budget : nullptr));
+
 	// Get the appropriate RomData class for this ROM.
 	// RomData class *must* support at least one image type.
 	RomData *romData = RomDataFactory::create(file, RomDataFactory::RDA_HAS_THUMBNAIL);
@@ -427,7 +504,9 @@ int TCreateThumbnail<ImgClass>::getThumbnail(IRpFile *file, int req_size, ImgCla
 		if (sBIT) {
 			memset(sBIT, 0, sizeof(*sBIT));
 		}
-		return RPCT_SOURCE_FILE_NOT_SUPPORTED;
+		return (IoBudget::isCurrentExceeded()
+			? RPCT_SOURCE_FILE_IO_BUDGET
+			: RPCT_SOURCE_FILE_NOT_SUPPORTED);
 	}
 
 	// Call the actual function.
@@ -447,6 +526,14 @@ int TCreateThumbnail<ImgClass>::getThumbnail(IRpFile *file, int req_size, ImgCla
 template<typename ImgClass>
 int TCreateThumbnail<ImgClass>::getThumbnail(const char *filename, int req_size, ImgClass &ret_img, rp_image::sBIT_t *sBIT)
 {
+	// Limit the I/O used for the ROM image,
+	// unless the caller already set a budget.
+	IoBudget *const callerBudget = IoBudget::current();
+	const IoBudget::Limits budgetLimits = Config::instance()->ioBudget();
+	IoBudget budget(budgetLimits);
+	IoBudget::Scope budgetScope(callerBudget ? callerBudget
+		: (budgetLimits.isEnabled() ? &budget : nullptr));
+
 	// Attempt to open the ROM file.
 	// TODO: OS-specific wrappers, e.g. RpQFile or RpGVfsFile.
 	// For now, using RpFile, which is an stdio wrapper.
@@ -469,7 +556,9 @@ int TCreateThumbnail<ImgClass>::getThumbnail(const char *filename, int req_size,
 		if (sBIT) {
 			memset(sBIT, 0, sizeof(*sBIT));
 		}
-		return RPCT_SOURCE_FILE_NOT_SUPPORTED;
+		return (IoBudget::isCurrentExceeded()
+			? RPCT_SOURCE_FILE_IO_BUDGET
+			: RPCT_SOURCE_FILE_NOT_SUPPORTED);
 	}
 
 	// Call the actual function.
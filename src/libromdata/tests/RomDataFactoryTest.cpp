@@ -0,0 +1,509 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libromdata/tests)                 *
+ * RomDataFactoryTest.cpp: RomDataFactory test.                            *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// librpbase
+#include "librpbase/byteswap.h"
+#include "librpbase/RomData.hpp"
+#include "librpbase/RomMetaData.hpp"
+#include "librpbase/file/IoStats.hpp"
+#include "librpbase/file/RpFile.hpp"
+#include "librpbase/file/RpMemFile.hpp"
+using namespace LibRpBase;
+
+// RomDataFactory
+#include "../RomDataFactory.hpp"
+#include "../Texture/dds_structs.h"
+#include "../Other/elf_structs.h"
+#include "../Console/gcn_structs.h"
+#include "../Console/gcn_banner.h"
+#include "../Handheld/n3ds_structs.h"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+
+// C++ includes.
+#include <string>
+#include <vector>
+using std::string;
+using std::vector;
+
+namespace LibRomData { namespace Tests {
+
+class RomDataFactoryTest : public ::testing::Test
+{
+	protected:
+		RomDataFactoryTest() { }
+
+	public:
+		void SetUp(void) final;
+		void TearDown(void) final;
+
+	public:
+		// Number of iterations for benchmarks.
+		static const unsigned int BENCHMARK_ITERATIONS = 10000;
+
+		// DDS texture dimensions.
+		static const unsigned int DDS_WIDTH = 256;
+		static const unsigned int DDS_HEIGHT = 256;
+
+		// Temporary filenames for I/O tests.
+		static const char tmp_dds_filename[];
+		static const char tmp_cia_filename[];
+
+	protected:
+		// Synthetic files.
+		vector<uint8_t> m_dds_buf;
+		vector<uint8_t> m_elf_buf;
+		vector<uint8_t> m_gcn_buf;
+		vector<uint8_t> m_cia_buf;
+
+	public:
+		/**
+		 * Create a RomData object from a memory buffer.
+		 * @param buf Memory buffer.
+		 * @param attrs RomDataAttr bitfield.
+		 * @return RomData object, or nullptr on error.
+		 */
+		static RomData *createFromBuf(const vector<uint8_t> &buf, unsigned int attrs = 0);
+
+		/**
+		 * Write a memory buffer to a file and create a RomData object
+		 * from it, counting the bytes read.
+		 * The RomData object is unreferenced after calling metaData().
+		 * @param filename	[in] Filename.
+		 * @param buf		[in] Memory buffer.
+		 * @param attrs		[in] RomDataAttr bitfield.
+		 * @param pMetaData	[out] Copy of the metadata. (caller must delete it)
+		 * @return Number of bytes read.
+		 */
+		static uint64_t bytesReadForMetaData(const char *filename, const vector<uint8_t> &buf,
+			unsigned int attrs, RomMetaData **pMetaData);
+
+		/**
+		 * Compare two RomMetaData objects.
+		 * @param expected Expected RomMetaData.
+		 * @param actual Actual RomMetaData.
+		 */
+		static void compareMetaData(const RomMetaData *expected, const RomMetaData *actual);
+};
+
+const char RomDataFactoryTest::tmp_dds_filename[] = "RomDataFactoryTest.dds";
+const char RomDataFactoryTest::tmp_cia_filename[] = "RomDataFactoryTest.cia";
+
+/**
+ * SetUp() function.
+ * Run before each test.
+ */
+void RomDataFactoryTest::SetUp(void)
+{
+	// DDS: DXT1 texture, no mipmaps.
+	const unsigned int dxt1_size = (DDS_WIDTH * DDS_HEIGHT) / 2;
+	m_dds_buf.assign(4 + sizeof(DDS_HEADER) + dxt1_size, 0x55);
+	memcpy(m_dds_buf.data(), DDS_MAGIC, 4);
+	DDS_HEADER *const ddsHeader = reinterpret_cast<DDS_HEADER*>(&m_dds_buf[4]);
+	memset(ddsHeader, 0, sizeof(*ddsHeader));
+	ddsHeader->dwSize = cpu_to_le32(sizeof(*ddsHeader));
+	ddsHeader->dwFlags = cpu_to_le32(DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH |
+	                                 DDSD_PIXELFORMAT | DDSD_LINEARSIZE);
+	ddsHeader->dwHeight = cpu_to_le32(DDS_HEIGHT);
+	ddsHeader->dwWidth = cpu_to_le32(DDS_WIDTH);
+	ddsHeader->dwPitchOrLinearSize = cpu_to_le32(dxt1_size);
+	ddsHeader->ddspf.dwSize = cpu_to_le32(sizeof(ddsHeader->ddspf));
+	ddsHeader->ddspf.dwFlags = cpu_to_le32(DDPF_FOURCC);
+	ddsHeader->ddspf.dwFourCC = cpu_to_be32(DDPF_FOURCC_DXT1);
+
+	// ELF: 64-bit little-endian executable header.
+	// ELF doesn't have metadata.
+	m_elf_buf.assign(4096, 0);
+	Elf64_Ehdr *const elfHeader = reinterpret_cast<Elf64_Ehdr*>(m_elf_buf.data());
+	memcpy(elfHeader->e_magic, "\177ELF", sizeof(elfHeader->e_magic));
+	elfHeader->e_class = ELFCLASS64;
+	elfHeader->e_data = ELFDATA2LSB;
+	elfHeader->e_elfversion = 1;
+	elfHeader->e_type = cpu_to_le16(ET_EXEC);
+	elfHeader->e_machine = cpu_to_le16(62);	// x86-64
+	elfHeader->e_version = cpu_to_le32(1);
+	elfHeader->e_ehsize = cpu_to_le16(sizeof(*elfHeader));
+
+	// GameCube: Disc image with an FST containing opening.bnr.
+	// The banner has a different title and publisher than
+	// the disc header, plus a description.
+	static const unsigned int GCN_FST_OFFSET = 0x1000;
+	static const unsigned int GCN_BNR_OFFSET = 0x2000;
+	static const char gcn_fst_names[] = "opening.bnr";
+	m_gcn_buf.assign(0x10000, 0);
+	GCN_DiscHeader *const gcnHeader = reinterpret_cast<GCN_DiscHeader*>(m_gcn_buf.data());
+	memcpy(gcnHeader->id6, "GALE01", 6);
+	gcnHeader->magic_gcn = cpu_to_be32(GCN_MAGIC);
+	strcpy(gcnHeader->game_title, "Disc Header Title");
+
+	const unsigned int fst_size = (2 * sizeof(GCN_FST_Entry)) + sizeof(gcn_fst_names);
+	GCN_Boot_Block *const bootBlock = reinterpret_cast<GCN_Boot_Block*>(&m_gcn_buf[GCN_Boot_Block_ADDRESS]);
+	bootBlock->fst_offset = cpu_to_be32(GCN_FST_OFFSET);
+	bootBlock->fst_size = cpu_to_be32(fst_size);
+	bootBlock->fst_max_size = cpu_to_be32(fst_size);
+
+	GCN_FST_Entry *const fst = reinterpret_cast<GCN_FST_Entry*>(&m_gcn_buf[GCN_FST_OFFSET]);
+	fst[0].file_type_name_offset = cpu_to_be32(0x01000000);
+	fst[0].root_dir.file_count = cpu_to_be32(2);
+	fst[1].file_type_name_offset = cpu_to_be32(0);
+	fst[1].file.offset = cpu_to_be32(GCN_BNR_OFFSET);
+	fst[1].file.size = cpu_to_be32(sizeof(gcn_banner_bnr1_t));
+	memcpy(&fst[2], gcn_fst_names, sizeof(gcn_fst_names));
+
+	gcn_banner_bnr1_t *const bnr = reinterpret_cast<gcn_banner_bnr1_t*>(&m_gcn_buf[GCN_BNR_OFFSET]);
+	bnr->magic = cpu_to_be32(GCN_BANNER_MAGIC_BNR1);
+	strcpy(bnr->comment.gamename, "Banner Title");
+	strcpy(bnr->comment.company, "Banner Co.");
+	strcpy(bnr->comment.gamename_full, "Banner Title: Full Name");
+	strcpy(bnr->comment.company_full, "Banner Company, Inc.");
+	strcpy(bnr->comment.gamedesc, "Banner description.");
+
+	// Nintendo 3DS: CIA with a ticket, a TMD with one unencrypted
+	// content, and an SMDH in the meta section.
+	static const unsigned int CIA_SIG_LEN = 4 + 0x100 + 0x3C;	// RSA-2048
+	static const unsigned int CIA_CONTENT_SIZE = 0x10000;
+	static const unsigned int CIA_SMDH_SIZE = sizeof(N3DS_SMDH_Header_t) + sizeof(N3DS_SMDH_Icon_t);
+	const unsigned int ticket_size = CIA_SIG_LEN + sizeof(N3DS_Ticket_t);
+	const unsigned int tmd_size = CIA_SIG_LEN + sizeof(N3DS_TMD_t) + sizeof(N3DS_Content_Chunk_Record_t);
+	const unsigned int meta_size = sizeof(N3DS_CIA_Meta_Header_t) + CIA_SMDH_SIZE;
+	const unsigned int ticket_addr = 0x2040 + N3DS_CERT_CHAIN_SIZE;
+	const unsigned int tmd_addr = ticket_addr + ((ticket_size + 63) & ~63U);
+	const unsigned int content_addr = tmd_addr + ((tmd_size + 63) & ~63U);
+	const unsigned int smdh_addr = content_addr + CIA_CONTENT_SIZE + sizeof(N3DS_CIA_Meta_Header_t);
+	m_cia_buf.assign(smdh_addr + CIA_SMDH_SIZE, 0);
+
+	N3DS_CIA_Header_t *const ciaHeader = reinterpret_cast<N3DS_CIA_Header_t*>(m_cia_buf.data());
+	ciaHeader->header_size = cpu_to_le32(sizeof(*ciaHeader));
+	ciaHeader->cert_chain_size = cpu_to_le32(N3DS_CERT_CHAIN_SIZE);
+	ciaHeader->ticket_size = cpu_to_le32(ticket_size);
+	ciaHeader->tmd_size = cpu_to_le32(tmd_size);
+	ciaHeader->meta_size = cpu_to_le32(meta_size);
+	ciaHeader->content_size = cpu_to_le64(CIA_CONTENT_SIZE);
+
+	const uint32_t sig_type = cpu_to_be32(N3DS_SIGTYPE_RSA_2048_SHA256);
+	memcpy(&m_cia_buf[ticket_addr], &sig_type, sizeof(sig_type));
+	memcpy(&m_cia_buf[tmd_addr], &sig_type, sizeof(sig_type));
+	N3DS_TMD_t *const tmd = reinterpret_cast<N3DS_TMD_t*>(&m_cia_buf[tmd_addr + CIA_SIG_LEN]);
+	tmd->header.content_count = cpu_to_be16(1);
+	N3DS_Content_Chunk_Record_t *const chunk = reinterpret_cast<N3DS_Content_Chunk_Record_t*>(&tmd[1]);
+	chunk->size = cpu_to_be64(CIA_CONTENT_SIZE);
+
+	N3DS_SMDH_Header_t *const smdh = reinterpret_cast<N3DS_SMDH_Header_t*>(&m_cia_buf[smdh_addr]);
+	smdh->magic = cpu_to_be32(N3DS_SMDH_HEADER_MAGIC);
+	static const char cia_title[] = "CIA Title";
+	static const char cia_publisher[] = "CIA Publisher";
+	for (unsigned int i = 0; i < ARRAY_SIZE(smdh->titles); i++) {
+		for (unsigned int j = 0; j < sizeof(cia_title)-1; j++) {
+			smdh->titles[i].desc_long[j] = cpu_to_le16(cia_title[j]);
+		}
+		for (unsigned int j = 0; j < sizeof(cia_publisher)-1; j++) {
+			smdh->titles[i].publisher[j] = cpu_to_le16(cia_publisher[j]);
+		}
+	}
+}
+
+/**
+ * TearDown() function.
+ * Run after each test.
+ */
+void RomDataFactoryTest::TearDown(void)
+{
+	remove(tmp_dds_filename);
+	remove(tmp_cia_filename);
+}
+
+/**
+ * Create a RomData object from a memory buffer.
+ * @param buf Memory buffer.
+ * @param attrs RomDataAttr bitfield.
+ * @return RomData object, or nullptr on error.
+ */
+RomData *RomDataFactoryTest::createFromBuf(const vector<uint8_t> &buf, unsigned int attrs)
+{
+	RpMemFile *const f = new RpMemFile(buf.data(), buf.size());
+	RomData *const romData = RomDataFactory::create(f, attrs);
+	f->unref();
+	return romData;
+}
+
+/**
+ * Write a memory buffer to a file and create a RomData object
+ * from it, counting the bytes read.
+ * The RomData object is unreferenced after calling metaData().
+ * @param filename	[in] Filename.
+ * @param buf		[in] Memory buffer.
+ * @param attrs		[in] RomDataAttr bitfield.
+ * @param pMetaData	[out] Copy of the metadata. (caller must delete it)
+ * @return Number of bytes read.
+ */
+uint64_t RomDataFactoryTest::bytesReadForMetaData(const char *filename, const vector<uint8_t> &buf,
+	unsigned int attrs, RomMetaData **pMetaData)
+{
+	*pMetaData = nullptr;
+	RpFile *f = new RpFile(filename, RpFile::FM_CREATE_WRITE);
+	EXPECT_TRUE(f->isOpen());
+	EXPECT_EQ(buf.size(), f->write(buf.data(), buf.size()));
+	f->unref();
+
+	IoStats::Counters counters;
+	memset(&counters, 0, sizeof(counters));
+	IoStats::setThreadCounters(&counters);
+	f = new RpFile(filename, RpFile::FM_OPEN_READ);
+	EXPECT_TRUE(f->isOpen());
+	RomData *const romData = RomDataFactory::create(f, attrs);
+	f->unref();
+	if (romData) {
+		const RomMetaData *const metaData = romData->metaData();
+		if (metaData) {
+			*pMetaData = new RomMetaData();
+			(*pMetaData)->addMetaData_metaData(metaData);
+		}
+		romData->unref();
+	}
+	IoStats::setThreadCounters(nullptr);
+	return counters.bytes_read;
+}
+
+/**
+ * Compare two RomMetaData objects.
+ * @param expected Expected RomMetaData.
+ * @param actual Actual RomMetaData.
+ */
+void RomDataFactoryTest::compareMetaData(const RomMetaData *expected, const RomMetaData *actual)
+{
+	ASSERT_TRUE(expected != nullptr);
+	ASSERT_TRUE(actual != nullptr);
+	ASSERT_EQ(expected->count(), actual->count());
+
+	const int count = expected->count();
+	for (int i = 0; i < count; i++) {
+		const RomMetaData::MetaData *const prop_exp = expected->prop(i);
+		const RomMetaData::MetaData *const prop_act = actual->prop(i);
+		ASSERT_TRUE(prop_exp != nullptr);
+		ASSERT_TRUE(prop_act != nullptr);
+		EXPECT_EQ(prop_exp->name, prop_act->name) << "property " << i;
+		ASSERT_EQ(prop_exp->type, prop_act->type) << "property " << i;
+		switch (prop_exp->type) {
+			case PropertyType::String:
+				EXPECT_EQ(*prop_exp->data.str, *prop_act->data.str) << "property " << i;
+				break;
+			case PropertyType::Timestamp:
+				EXPECT_EQ(prop_exp->data.timestamp, prop_act->data.timestamp) << "property " << i;
+				break;
+			default:
+				EXPECT_EQ(prop_exp->data.uvalue, prop_act->data.uvalue) << "property " << i;
+				break;
+		}
+	}
+}
+
+/**
+ * Metadata-only mode must produce the same metadata as normal mode.
+ */
+TEST_F(RomDataFactoryTest, metaDataOnlySameMetaData)
+{
+	RomData *const romData = createFromBuf(m_dds_buf);
+	ASSERT_TRUE(romData != nullptr);
+	EXPECT_FALSE(romData->isMetaDataOnly());
+
+	RomData *const romData_mdo = createFromBuf(m_dds_buf, RomDataFactory::RDA_METADATA_ONLY);
+	ASSERT_TRUE(romData_mdo != nullptr);
+	EXPECT_TRUE(romData_mdo->isMetaDataOnly());
+
+	compareMetaData(romData->metaData(), romData_mdo->metaData());
+
+	romData->unref();
+	romData_mdo->unref();
+}
+
+/**
+ * Metadata-only mode must produce the same metadata as normal mode
+ * for GameCube discs, which get their metadata from opening.bnr.
+ */
+TEST_F(RomDataFactoryTest, metaDataOnlyGameCubeBanner)
+{
+	RomData *const romData = createFromBuf(m_gcn_buf);
+	ASSERT_TRUE(romData != nullptr);
+
+	RomData *const romData_mdo = createFromBuf(m_gcn_buf, RomDataFactory::RDA_METADATA_ONLY);
+	ASSERT_TRUE(romData_mdo != nullptr);
+	EXPECT_TRUE(romData_mdo->isMetaDataOnly());
+
+	// Title, Publisher, and Subject (description) from opening.bnr.
+	const RomMetaData *const metaData = romData->metaData();
+	ASSERT_TRUE(metaData != nullptr);
+	ASSERT_EQ(3, metaData->count());
+	EXPECT_EQ(Property::Title, metaData->prop(0)->name);
+	EXPECT_EQ("Banner Title: Full Name", *metaData->prop(0)->data.str);
+	EXPECT_EQ(Property::Publisher, metaData->prop(1)->name);
+	EXPECT_EQ("Banner Company, Inc.", *metaData->prop(1)->data.str);
+	EXPECT_EQ(Property::Subject, metaData->prop(2)->name);
+	EXPECT_EQ("Banner description.", *metaData->prop(2)->data.str);
+
+	compareMetaData(metaData, romData_mdo->metaData());
+
+	romData->unref();
+	romData_mdo->unref();
+}
+
+/**
+ * fields() and image() are not available in metadata-only mode.
+ */
+TEST_F(RomDataFactoryTest, metaDataOnlyNoFieldsOrImages)
+{
+	RomData *const romData = createFromBuf(m_dds_buf);
+	ASSERT_TRUE(romData != nullptr);
+	EXPECT_TRUE(romData->fields() != nullptr);
+	EXPECT_TRUE(romData->image(RomData::IMG_INT_IMAGE) != nullptr);
+	romData->unref();
+
+	RomData *const romData_mdo = createFromBuf(m_dds_buf, RomDataFactory::RDA_METADATA_ONLY);
+	ASSERT_TRUE(romData_mdo != nullptr);
+	EXPECT_TRUE(romData_mdo->fields() == nullptr);
+	EXPECT_TRUE(romData_mdo->fieldsLazy() == nullptr);
+	EXPECT_TRUE(romData_mdo->image(RomData::IMG_INT_IMAGE) == nullptr);
+	romData_mdo->unref();
+}
+
+/**
+ * RomData subclasses without metadata are skipped in metadata-only mode.
+ */
+TEST_F(RomDataFactoryTest, metaDataOnlySkipsNoMetaData)
+{
+	RomData *const romData = createFromBuf(m_elf_buf);
+	ASSERT_TRUE(romData != nullptr);
+	romData->unref();
+
+	EXPECT_TRUE(createFromBuf(m_elf_buf, RomDataFactory::RDA_METADATA_ONLY) == nullptr);
+	EXPECT_TRUE(createFromBuf(m_elf_buf, RomDataFactory::RDA_HAS_METADATA) == nullptr);
+}
+
+/**
+ * Metadata-only mode must not read the image data.
+ * The baseline only calls metaData(), as metadata extractors do.
+ */
+TEST_F(RomDataFactoryTest, metaDataOnlyBytesRead)
+{
+	RomMetaData *metaData = nullptr, *metaData_mdo = nullptr;
+	const uint64_t bytes_read = bytesReadForMetaData(tmp_dds_filename, m_dds_buf, 0, &metaData);
+	const uint64_t bytes_read_mdo = bytesReadForMetaData(tmp_dds_filename, m_dds_buf,
+		RomDataFactory::RDA_METADATA_ONLY, &metaData_mdo);
+	ASSERT_NO_FATAL_FAILURE(compareMetaData(metaData, metaData_mdo));
+	delete metaData;
+	delete metaData_mdo;
+
+	// The DXT1 image data must not have been read.
+	EXPECT_LE(bytes_read_mdo, bytes_read);
+	EXPECT_LT(bytes_read_mdo, static_cast<uint64_t>(m_dds_buf.size() / 2));
+}
+
+/**
+ * Metadata-only mode reads a CIA's SMDH from the meta section
+ * without parsing the ticket and TMD or opening the content.
+ */
+TEST_F(RomDataFactoryTest, metaDataOnlyNintendo3DSCIA)
+{
+	RomMetaData *metaData = nullptr, *metaData_mdo = nullptr;
+	const uint64_t bytes_read = bytesReadForMetaData(tmp_cia_filename, m_cia_buf, 0, &metaData);
+	const uint64_t bytes_read_mdo = bytesReadForMetaData(tmp_cia_filename, m_cia_buf,
+		RomDataFactory::RDA_METADATA_ONLY, &metaData_mdo);
+
+	// Title and Publisher from the SMDH.
+	ASSERT_TRUE(metaData != nullptr);
+	ASSERT_EQ(2, metaData->count());
+	EXPECT_EQ(Property::Title, metaData->prop(0)->name);
+	EXPECT_EQ("CIA Title", *metaData->prop(0)->data.str);
+	EXPECT_EQ(Property::Publisher, metaData->prop(1)->name);
+	EXPECT_EQ("CIA Publisher", *metaData->prop(1)->data.str);
+	ASSERT_NO_FATAL_FAILURE(compareMetaData(metaData, metaData_mdo));
+	delete metaData;
+	delete metaData_mdo;
+
+	// The ticket, TMD, and content must not have been read.
+	const unsigned int ticket_tmd_size =
+		sizeof(N3DS_Ticket_t) + sizeof(N3DS_TMD_t) + sizeof(N3DS_Content_Chunk_Record_t);
+	EXPECT_LE(bytes_read_mdo + ticket_tmd_size, bytes_read);
+}
+
+/**
+ * Benchmark: create() and metaData() in normal mode.
+ * This is what metadata extractors did before metadata-only mode.
+ */
+TEST_F(RomDataFactoryTest, create_normal_benchmark)
+{
+	for (unsigned int i = BENCHMARK_ITERATIONS; i > 0; i--) {
+		RomData *const romData = createFromBuf(m_elf_buf);
+		ASSERT_TRUE(romData != nullptr);
+		romData->metaData();
+		romData->unref();
+
+		RomData *const romData_dds = createFromBuf(m_dds_buf);
+		ASSERT_TRUE(romData_dds != nullptr);
+		romData_dds->metaData();
+		romData_dds->unref();
+
+		RomData *const romData_gcn = createFromBuf(m_gcn_buf);
+		ASSERT_TRUE(romData_gcn != nullptr);
+		romData_gcn->metaData();
+		romData_gcn->unref();
+	}
+}
+
+/**
+ * Benchmark: The same calls in metadata-only mode.
+ */
+TEST_F(RomDataFactoryTest, create_metaDataOnly_benchmark)
+{
+	for (unsigned int i = BENCHMARK_ITERATIONS; i > 0; i--) {
+		RomData *const romData = createFromBuf(m_elf_buf, RomDataFactory::RDA_METADATA_ONLY);
+		ASSERT_TRUE(romData == nullptr);
+
+		RomData *const romData_dds = createFromBuf(m_dds_buf, RomDataFactory::RDA_METADATA_ONLY);
+		ASSERT_TRUE(romData_dds != nullptr);
+		romData_dds->metaData();
+		romData_dds->unref();
+
+		RomData *const romData_gcn = createFromBuf(m_gcn_buf, RomDataFactory::RDA_METADATA_ONLY);
+		ASSERT_TRUE(romData_gcn != nullptr);
+		romData_gcn->metaData();
+		romData_gcn->unref();
+	}
+}
+
+} }
+
+/**
+ * Test suite main function.
+ */
+extern "C" int gtest_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibRomData test suite: RomDataFactory tests.\n\n");
+	fprintf(stderr, "Benchmark iterations: %u\n", LibRomData::Tests::RomDataFactoryTest::BENCHMARK_ITERATIONS);
+	fflush(nullptr);
+
+	// coverity[fun_call_w_exception]: uncaught exceptions cause nonzero exit anyway, so don't warn.
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,334 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (libromdata/tests)                 *
+ * PerfectHashTest.cpp: PerfectHash class test.                            *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "libromdata/config.libromdata.h"
+
+// Google Test
+#include "gtest/gtest.h"
+
+// PerfectHash
+#include "../../data/PerfectHash.hpp"
+
+// Data classes that use PerfectHash.
+#include "../../data/AmiiboData.hpp"
+#include "../../data/EXEData.hpp"
+#include "../../data/Nintendo3DSSysTitles.hpp"
+#include "../../data/NintendoPublishers.hpp"
+#include "../../data/SegaPublishers.hpp"
+#include "../../data/WiiSystemMenuVersion.hpp"
+#include "../../data/WiiUData.hpp"
+#ifdef ENABLE_GL
+# include "../../data/GLenumStrings.hpp"
+#endif /* ENABLE_GL */
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstring>
+
+// C++ includes.
+#include <algorithm>
+#include <vector>
+using std::vector;
+
+namespace LibRomData { namespace Tests {
+
+class PerfectHashTest : public ::testing::Test
+{
+	protected:
+		PerfectHashTest() { }
+
+	public:
+		// Number of iterations for benchmarks.
+		static const unsigned int BENCHMARK_ITERATIONS = 100;
+
+		/**
+		 * Generate a set of unique pseudo-random keys.
+		 * @param keys	[out] Keys.
+		 * @param count	[in] Number of keys.
+		 * @param seed	[in] Seed.
+		 */
+		static void generateKeys(vector<uint32_t> &keys, unsigned int count, uint32_t seed);
+
+		// Alphanumeric characters used in publisher and game IDs.
+		static const char alnum[];
+};
+
+// Alphanumeric characters used in publisher and game IDs.
+const char PerfectHashTest::alnum[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+/**
+ * Generate a set of unique pseudo-random keys.
+ * @param keys	[out] Keys.
+ * @param count	[in] Number of keys.
+ * @param seed	[in] Seed.
+ */
+void PerfectHashTest::generateKeys(vector<uint32_t> &keys, unsigned int count, uint32_t seed)
+{
+	// xorshift32
+	keys.clear();
+	keys.reserve(count);
+	while (keys.size() < count) {
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		if (std::find(keys.cbegin(), keys.cend(), seed) == keys.cend()) {
+			keys.push_back(seed);
+		}
+	}
+}
+
+/** PerfectHash **/
+
+/**
+ * Test an empty index.
+ */
+TEST_F(PerfectHashTest, emptyTest)
+{
+	PerfectHash hash;
+	hash.init(nullptr, 0);
+	EXPECT_EQ(-1, hash.find(0));
+	EXPECT_EQ(-1, hash.find(1));
+	EXPECT_EQ(-1, hash.find(0xFFFFFFFF));
+}
+
+/**
+ * Test sets of random keys.
+ * All keys must be found at their original index,
+ * and other keys must not be found.
+ */
+TEST_F(PerfectHashTest, randomKeysTest)
+{
+	static const unsigned int counts[] = {1, 2, 7, 8, 9, 100, 440, 1000, 5000};
+
+	vector<uint32_t> keys;
+	for (unsigned int i = 0; i < ARRAY_SIZE(counts); i++) {
+		const unsigned int count = counts[i];
+		generateKeys(keys, count * 2, 0x12345678 + i);
+
+		// First half: Keys in the index.
+		// Second half: Keys not in the index.
+		PerfectHash hash;
+		hash.init(keys.data(), count);
+		for (unsigned int j = 0; j < count; j++) {
+			EXPECT_EQ(static_cast<int>(j), hash.find(keys[j])) << "count == " << count;
+		}
+		for (unsigned int j = count; j < count * 2; j++) {
+			EXPECT_EQ(-1, hash.find(keys[j])) << "count == " << count;
+		}
+	}
+}
+
+/**
+ * Test sequential keys, including 0.
+ */
+TEST_F(PerfectHashTest, sequentialKeysTest)
+{
+	vector<uint32_t> keys(512);
+	for (unsigned int i = 0; i < 512; i++) {
+		keys[i] = i;
+	}
+
+	PerfectHash hash;
+	hash.init(keys.data(), 256);
+	for (unsigned int i = 0; i < 256; i++) {
+		EXPECT_EQ(static_cast<int>(i), hash.find(i));
+	}
+	for (unsigned int i = 256; i < 512; i++) {
+		EXPECT_EQ(-1, hash.find(i));
+	}
+}
+
+/**
+ * Test duplicate keys.
+ * The first index should be used.
+ */
+TEST_F(PerfectHashTest, duplicateKeysTest)
+{
+	static const uint32_t keys[] = {5, 10, 5, 20, 10, 0, 0};
+
+	PerfectHash hash;
+	hash.init(keys, ARRAY_SIZE(keys));
+	EXPECT_EQ(0, hash.find(5));
+	EXPECT_EQ(1, hash.find(10));
+	EXPECT_EQ(3, hash.find(20));
+	EXPECT_EQ(5, hash.find(0));
+	EXPECT_EQ(-1, hash.find(15));
+}
+
+/**
+ * Test the struct member init() overload.
+ */
+TEST_F(PerfectHashTest, structInitTest)
+{
+	struct Entry {
+		uint16_t id;
+		const char *name;
+	};
+	static const Entry tbl[] = {
+		{0x8664, "AMD64"},
+		{0x014C, "i386"},
+		{0xAA64, "ARM64"},
+	};
+
+	PerfectHash hash;
+	hash.init(tbl, ARRAY_SIZE(tbl), &Entry::id);
+	EXPECT_EQ(0, hash.find(0x8664));
+	EXPECT_EQ(1, hash.find(0x014C));
+	EXPECT_EQ(2, hash.find(0xAA64));
+	EXPECT_EQ(-1, hash.find(0x0200));
+}
+
+/** Data table lookups **/
+
+/**
+ * Test known data table lookups.
+ */
+TEST_F(PerfectHashTest, dataLookupTest)
+{
+	// NintendoPublishers
+	EXPECT_STREQ("Nintendo", NintendoPublishers::lookup("01"));
+	EXPECT_STREQ("Topware Interactive", NintendoPublishers::lookup("ZX"));
+	EXPECT_EQ(nullptr, NintendoPublishers::lookup("!!"));
+	EXPECT_STREQ("<unlicensed>", NintendoPublishers::lookup_fds(0x00));
+	EXPECT_STREQ("Atlus", NintendoPublishers::lookup_fds(0xEB));
+	EXPECT_EQ(nullptr, NintendoPublishers::lookup_fds(0xFF));
+
+	// SegaPublishers
+	EXPECT_STREQ("Sega", SegaPublishers::lookup(0));
+	EXPECT_STREQ("Triangle Service", SegaPublishers::lookup(479));
+	EXPECT_EQ(nullptr, SegaPublishers::lookup(1));
+
+	// WiiUData
+	EXPECT_EQ(static_cast<uint32_t>('0001'), WiiUData::lookup_disc_publisher("AC3E"));
+	EXPECT_EQ(static_cast<uint32_t>('00EL'), WiiUData::lookup_disc_publisher("BTXJ"));
+	EXPECT_EQ(static_cast<uint32_t>('00GT'), WiiUData::lookup_disc_publisher("BTXE"));
+	EXPECT_EQ(0U, WiiUData::lookup_disc_publisher("BTXK"));
+
+	// EXEData
+	EXPECT_STREQ("AMD64", EXEData::lookup_pe_cpu(0x8664));
+	EXPECT_EQ(nullptr, EXEData::lookup_pe_cpu(0x0000));
+
+	// WiiSystemMenuVersion
+	EXPECT_STREQ("1.0", WiiSystemMenuVersion::lookup(33));
+	EXPECT_STREQ("4.3E", WiiSystemMenuVersion::lookup(610));
+	EXPECT_EQ(nullptr, WiiSystemMenuVersion::lookup(34));
+
+	// AmiiboData
+	EXPECT_STREQ("Mario", AmiiboData::lookup_char_name(0x00000000));
+	EXPECT_STREQ("Dr. Mario", AmiiboData::lookup_char_name(0x00000100));
+	EXPECT_EQ(nullptr, AmiiboData::lookup_char_name(0x00000200));
+	EXPECT_STREQ("Loot Goblin", AmiiboData::lookup_char_name(0x38C00000));
+	EXPECT_EQ(nullptr, AmiiboData::lookup_char_name(0xFFFF0000));
+
+	// Nintendo3DSSysTitles
+	const char *region = nullptr;
+	EXPECT_STREQ("System Settings",
+		Nintendo3DSSysTitles::lookup_sys_title(0x00040010, 0x00020000, &region));
+	EXPECT_STREQ("JPN", region);
+	EXPECT_STREQ("amiibo Settings",
+		Nintendo3DSSysTitles::lookup_sys_title(0x00040030, 0x0000BF02, &region));
+	EXPECT_STREQ("TWN", region);
+	EXPECT_EQ(nullptr, Nintendo3DSSysTitles::lookup_sys_title(0x00040010, 0x0000BF02, nullptr));
+
+#ifdef ENABLE_GL
+	// GLenumStrings
+	EXPECT_STREQ("RGBA8", GLenumStrings::lookup_glEnum(0x8058));
+	EXPECT_EQ(nullptr, GLenumStrings::lookup_glEnum(0xFFFFFFFF));
+#endif /* ENABLE_GL */
+}
+
+/**
+ * Benchmark lookups over each data table's full key set.
+ */
+TEST_F(PerfectHashTest, dataLookup_benchmark)
+{
+	// Prevent the lookups from being optimized out.
+	unsigned int found = 0;
+
+	for (unsigned int i = BENCHMARK_ITERATIONS; i > 0; i--) {
+		// NintendoPublishers: All two-character alphanumeric codes.
+		char code[3] = {0, 0, 0};
+		for (unsigned int a = 0; a < sizeof(alnum)-1; a++) {
+			code[0] = alnum[a];
+			for (unsigned int b = 0; b < sizeof(alnum)-1; b++) {
+				code[1] = alnum[b];
+				found += (NintendoPublishers::lookup(code) != nullptr);
+			}
+		}
+		for (unsigned int fds = 0; fds < 256; fds++) {
+			found += (NintendoPublishers::lookup_fds(static_cast<uint8_t>(fds)) != nullptr);
+		}
+
+		// SegaPublishers: T-codes up to 511.
+		for (unsigned int t = 0; t < 512; t++) {
+			found += (SegaPublishers::lookup(t) != nullptr);
+		}
+
+		// WiiUData: All three-character alphanumeric IDs in the 'A' and 'B' series.
+		char id4[5] = {0, 0, 0, 'E', 0};
+		for (unsigned int a = 10; a < 12; a++) {
+			id4[0] = alnum[a];
+			for (unsigned int b = 0; b < sizeof(alnum)-1; b++) {
+				id4[1] = alnum[b];
+				for (unsigned int c = 0; c < sizeof(alnum)-1; c++) {
+					id4[2] = alnum[c];
+					found += (WiiUData::lookup_disc_publisher(id4) != 0);
+				}
+			}
+		}
+
+		// 16-bit tables: All 16-bit values.
+		for (unsigned int v = 0; v < 0x10000; v++) {
+			found += (EXEData::lookup_pe_cpu(static_cast<uint16_t>(v)) != nullptr);
+			found += (EXEData::lookup_le_cpu(static_cast<uint16_t>(v)) != nullptr);
+			found += (WiiSystemMenuVersion::lookup(v) != nullptr);
+			found += (AmiiboData::lookup_char_name(v << 16) != nullptr);
+#ifdef ENABLE_GL
+			found += (GLenumStrings::lookup_glEnum(v) != nullptr);
+#endif /* ENABLE_GL */
+		}
+
+		// Nintendo3DSSysTitles: tid_lo values in the system title ranges.
+		for (uint32_t tid_lo = 0x00008000; tid_lo < 0x0000F000; tid_lo++) {
+			found += (Nintendo3DSSysTitles::lookup_sys_title(0x00040030, tid_lo, nullptr) != nullptr);
+		}
+		for (uint32_t tid_lo = 0x00020000; tid_lo < 0x00030000; tid_lo += 0x100) {
+			found += (Nintendo3DSSysTitles::lookup_sys_title(0x00040010, tid_lo, nullptr) != nullptr);
+		}
+	}
+
+	EXPECT_GT(found, 0U);
+}
+
+} }
+
+/**
+ * Test suite main function.
+ */
+extern "C" int gtest_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibRomData test suite: PerfectHash tests.\n\n");
+	fprintf(stderr, "Benchmark iterations: %u\n", LibRomData::Tests::PerfectHashTest::BENCHMARK_ITERATIONS);
+	fflush(nullptr);
+
+	// coverity[fun_call_w_exception]: uncaught exceptions cause nonzero exit anyway, so don't warn.
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,943 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * BinFields.cpp: Binary RomFields/RomMetaData serialization.              *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "BinFields.hpp"
+#include "RomMetaData.hpp"
+#include "byteswap.h"
+
+// C includes. (C++ namespace)
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+
+// C++ includes.
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+using std::string;
+using std::unique_ptr;
+using std::unordered_map;
+using std::vector;
+
+namespace LibRpBase {
+
+/**
+ * Builds the data area and string table for BinFields::serialize().
+ */
+class BinFieldsWriter
+{
+	public:
+		BinFieldsWriter() { }
+
+	private:
+		RP_DISABLE_COPY(BinFieldsWriter)
+
+	public:
+		// Data area and string table.
+		vector<uint8_t> data;
+		vector<uint8_t> strtbl;
+
+	private:
+		// Deduplication maps.
+		unordered_map<string, uint32_t> strMap;
+		unordered_map<const vector<string>*, uint32_t> strArrayMap;
+
+		/**
+		 * Append a uint32_t to a buffer.
+		 * @param buf Buffer.
+		 * @param value Value. (host-endian)
+		 */
+		static inline void append32(vector<uint8_t> &buf, uint32_t value)
+		{
+			value = cpu_to_le32(value);
+			const uint8_t *const p = reinterpret_cast<const uint8_t*>(&value);
+			buf.insert(buf.end(), p, p + sizeof(value));
+		}
+
+	public:
+		/**
+		 * Add a string to the string table.
+		 * @param str String.
+		 * @param len String length.
+		 * @return String reference.
+		 */
+		uint32_t addString(const char *str, size_t len);
+
+		/**
+		 * Add a string to the string table.
+		 * @param str String, or nullptr.
+		 * @return String reference, or BINFIELDS_REF_NONE if str is nullptr.
+		 */
+		inline uint32_t addString(const char *str)
+		{
+			return (str ? addString(str, strlen(str)) : BINFIELDS_REF_NONE);
+		}
+
+		/**
+		 * Add a string to the string table.
+		 * @param str String, or nullptr.
+		 * @return String reference, or BINFIELDS_REF_NONE if str is nullptr.
+		 */
+		inline uint32_t addString(const string *str)
+		{
+			return (str ? addString(str->data(), str->size()) : BINFIELDS_REF_NONE);
+		}
+
+		/**
+		 * Add a string array to the data area.
+		 * Shared name tables are only stored once.
+		 * @param vec Vector of strings, or nullptr.
+		 * @param shared If true, the vector is a shared name table.
+		 * @return String array reference, or BINFIELDS_REF_NONE if vec is nullptr.
+		 */
+		uint32_t addStrArray(const vector<string> *vec, bool shared);
+
+		/**
+		 * Add list data to the data area.
+		 * @param list_data List data, or nullptr.
+		 * @return List data reference, or BINFIELDS_REF_NONE if list_data is nullptr.
+		 */
+		uint32_t addListData(const vector<vector<string> > *list_data);
+
+		/**
+		 * Add age ratings to the data area.
+		 * @param age_ratings Age ratings, or nullptr.
+		 * @return Age ratings reference, or BINFIELDS_REF_NONE if age_ratings is nullptr.
+		 */
+		uint32_t addAgeRatings(const RomFields::age_ratings_t *age_ratings);
+};
+
+/**
+ * Add a string to the string table.
+ * @param str String.
+ * @param len String length.
+ * @return String reference.
+ */
+uint32_t BinFieldsWriter::addString(const char *str, size_t len)
+{
+	string key(str, len);
+	auto iter = strMap.find(key);
+	if (iter != strMap.end()) {
+		// String was already added.
+		return iter->second;
+	}
+
+	const uint32_t ref = static_cast<uint32_t>(strtbl.size());
+	append32(strtbl, static_cast<uint32_t>(len));
+	strtbl.insert(strtbl.end(), str, str + len);
+	// NULL terminator and padding.
+	strtbl.resize((strtbl.size() + 1 + 3) & ~static_cast<size_t>(3), 0);
+	strMap.insert(std::make_pair(std::move(key), ref));
+	return ref;
+}
+
+/**
+ * Add a string array to the data area.
+ * Shared name tables are only stored once.
+ * @param vec Vector of strings, or nullptr.
+ * @param shared If true, the vector is a shared name table.
+ * @return String array reference, or BINFIELDS_REF_NONE if vec is nullptr.
+ */
+uint32_t BinFieldsWriter::addStrArray(const vector<string> *vec, bool shared)
+{
+	if (!vec)
+		return BINFIELDS_REF_NONE;
+
+	if (shared) {
+		auto iter = strArrayMap.find(vec);
+		if (iter != strArrayMap.end()) {
+			// Name table was already added.
+			return iter->second;
+		}
+	}
+
+	// Add the strings first so the array is contiguous.
+	vector<uint32_t> refs;
+	refs.reserve(vec->size());
+	for (auto iter = vec->cbegin(); iter != vec->cend(); ++iter) {
+		refs.push_back(addString(iter->data(), iter->size()));
+	}
+
+	const uint32_t ref = static_cast<uint32_t>(data.size());
+	append32(data, static_cast<uint32_t>(refs.size()));
+	for (auto iter = refs.cbegin(); iter != refs.cend(); ++iter) {
+		append32(data, *iter);
+	}
+
+	if (shared) {
+		strArrayMap.insert(std::make_pair(vec, ref));
+	}
+	return ref;
+}
+
+/**
+ * Add list data to the data area.
+ * @param list_data List data, or nullptr.
+ * @return List data reference, or BINFIELDS_REF_NONE if list_data is nullptr.
+ */
+uint32_t BinFieldsWriter::addListData(const vector<vector<string> > *list_data)
+{
+	if (!list_data)
+		return BINFIELDS_REF_NONE;
+
+	// Add the rows first so the row table is contiguous.
+	vector<uint32_t> rows;
+	rows.reserve(list_data->size());
+	for (auto iter = list_data->cbegin(); iter != list_data->cend(); ++iter) {
+		rows.push_back(addStrArray(&(*iter), false));
+	}
+
+	const uint32_t ref = static_cast<uint32_t>(data.size());
+	append32(data, static_cast<uint32_t>(rows.size()));
+	for (auto iter = rows.cbegin(); iter != rows.cend(); ++iter) {
+		append32(data, *iter);
+	}
+	return ref;
+}
+
+/**
+ * Add age ratings to the data area.
+ * @param age_ratings Age ratings, or nullptr.
+ * @return Age ratings reference, or BINFIELDS_REF_NONE if age_ratings is nullptr.
+ */
+uint32_t BinFieldsWriter::addAgeRatings(const RomFields::age_ratings_t *age_ratings)
+{
+	if (!age_ratings)
+		return BINFIELDS_REF_NONE;
+
+	const uint32_t ref = static_cast<uint32_t>(data.size());
+	for (auto iter = age_ratings->cbegin(); iter != age_ratings->cend(); ++iter) {
+		const uint16_t value = cpu_to_le16(*iter);
+		const uint8_t *const p = reinterpret_cast<const uint8_t*>(&value);
+		data.insert(data.end(), p, p + sizeof(value));
+	}
+	// Keep the data area 4-byte aligned.
+	data.resize((data.size() + 3) & ~static_cast<size_t>(3), 0);
+	return ref;
+}
+
+/** BinFields **/
+
+/**
+ * Open a serialized buffer for reading.
+ * The buffer is not copied.
+ * @param buf Buffer.
+ * @param size Size of the buffer.
+ */
+BinFields::BinFields(const void *buf, size_t size)
+	: m_buf(nullptr)
+	, m_tab_count(0)
+	, m_field_count(0)
+	, m_metadata_count(0)
+	, m_tabs(nullptr)
+	, m_fields(nullptr)
+	, m_metadata(nullptr)
+	, m_data(nullptr)
+	, m_data_size(0)
+	, m_strtbl(nullptr)
+	, m_strtbl_size(0)
+{
+	assert(buf != nullptr);
+	if (!buf || size < sizeof(BinFields_Header))
+		return;
+
+	const uint8_t *const pBuf = static_cast<const uint8_t*>(buf);
+	const BinFields_Header *const header =
+		reinterpret_cast<const BinFields_Header*>(pBuf);
+	if (header->magic != cpu_to_be32(BINFIELDS_MAGIC) ||
+	    le16_to_cpu(header->version) != BINFIELDS_VERSION ||
+	    le16_to_cpu(header->header_size) != sizeof(BinFields_Header))
+	{
+		// Incorrect magic number, version, or header size.
+		return;
+	}
+
+	const uint64_t total_size = le32_to_cpu(header->total_size);
+	if (total_size > size) {
+		// Buffer is truncated.
+		return;
+	}
+
+	// Verify that all sections are within the buffer.
+	// NOTE: Using 64-bit arithmetic to prevent overflows.
+	const uint32_t tab_count = le32_to_cpu(header->tab_count);
+	const uint32_t field_count = le32_to_cpu(header->field_count);
+	const uint32_t metadata_count = le32_to_cpu(header->metadata_count);
+	const uint32_t tabs_offset = le32_to_cpu(header->tabs_offset);
+	const uint32_t fields_offset = le32_to_cpu(header->fields_offset);
+	const uint32_t metadata_offset = le32_to_cpu(header->metadata_offset);
+	const uint32_t data_offset = le32_to_cpu(header->data_offset);
+	const uint32_t data_size = le32_to_cpu(header->data_size);
+	const uint32_t strtbl_offset = le32_to_cpu(header->strtbl_offset);
+	const uint32_t strtbl_size = le32_to_cpu(header->strtbl_size);
+	if ((uint64_t)tabs_offset + ((uint64_t)tab_count * sizeof(uint32_t)) > total_size ||
+	    (uint64_t)fields_offset + ((uint64_t)field_count * sizeof(BinFields_Field)) > total_size ||
+	    (uint64_t)metadata_offset + ((uint64_t)metadata_count * sizeof(BinFields_MetaData)) > total_size ||
+	    (uint64_t)data_offset + data_size > total_size ||
+	    (uint64_t)strtbl_offset + strtbl_size > total_size)
+	{
+		// Section is out of bounds.
+		return;
+	}
+
+	m_tab_count = tab_count;
+	m_field_count = field_count;
+	m_metadata_count = metadata_count;
+	m_tabs = pBuf + tabs_offset;
+	m_fields = reinterpret_cast<const BinFields_Field*>(pBuf + fields_offset);
+	m_metadata = reinterpret_cast<const BinFields_MetaData*>(pBuf + metadata_offset);
+	m_data = pBuf + data_offset;
+	m_data_size = data_size;
+	m_strtbl = pBuf + strtbl_offset;
+	m_strtbl_size = strtbl_size;
+	m_buf = pBuf;
+}
+
+/**
+ * Serialize RomFields and RomMetaData objects.
+ *
+ * All tabs in the RomFields object will be loaded.
+ * Icons in RFT_LISTDATA fields are not serialized.
+ *
+ * @param out		[out] Output buffer. (Existing contents are replaced.)
+ * @param fields	[in,opt] RomFields object.
+ * @param metaData	[in,opt] RomMetaData object.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int BinFields::serialize(vector<uint8_t> &out,
+	const RomFields *fields, const RomMetaData *metaData)
+{
+	BinFieldsWriter writer;
+
+	// Tab names.
+	vector<uint32_t> tabs;
+	if (fields) {
+		fields->loadAllTabs();
+		const int tabCount = fields->tabCount();
+		tabs.resize(tabCount);
+		for (int i = 0; i < tabCount; i++) {
+			tabs[i] = cpu_to_le32(writer.addString(fields->tabName(i)));
+		}
+	}
+
+	// Fields.
+	vector<BinFields_Field> binFields;
+	if (fields) {
+		const int count = fields->count();
+		binFields.reserve(count);
+		for (int i = 0; i < count; i++) {
+			const RomFields::Field *const field = fields->field(i);
+			assert(field != nullptr);
+			if (!field || !field->isValid)
+				continue;
+
+			BinFields_Field binField;
+			memset(&binField, 0, sizeof(binField));
+			binField.name = writer.addString(field->name);
+			binField.type = field->type;
+			binField.tabIdx = field->tabIdx;
+
+			switch (field->type) {
+				case RomFields::RFT_STRING:
+					binField.flags = field->desc.flags;
+					binField.v[0] = writer.addString(field->data.str);
+					break;
+				case RomFields::RFT_BITFIELD:
+					// NOTE: desc.flags overlaps elemsPerRow.
+
+					binField.v[0] = field->data.bitfield;
+					binField.v[1] = static_cast<uint32_t>(field->desc.bitfield.elemsPerRow);
+					binField.v[2] = writer.addStrArray(field->desc.bitfield.names, true);
+					break;
+				case RomFields::RFT_LISTDATA:
+					// Icons can't be serialized.
+					binField.flags = field->desc.list_data.flags & ~RomFields::RFT_LISTDATA_ICONS;
+					binField.v[0] = writer.addStrArray(field->desc.list_data.names, true);
+					binField.v[1] = writer.addListData(field->data.list_data.data);
+					binField.v[2] = static_cast<uint32_t>(field->desc.list_data.rows_visible);
+					binField.v[3] = field->desc.list_data.alignment.headers;
+					binField.v[4] = field->desc.list_data.alignment.data;
+					if (field->desc.list_data.flags & RomFields::RFT_LISTDATA_CHECKBOXES) {
+						binField.v[5] = field->data.list_data.mxd.checkboxes;
+					}
+					break;
+				case RomFields::RFT_DATETIME: {
+					binField.flags = field->desc.flags;
+					const int64_t date_time = field->data.date_time;
+					binField.v[0] = static_cast<uint32_t>(date_time);
+					binField.v[1] = static_cast<uint32_t>(static_cast<uint64_t>(date_time) >> 32);
+					break;
+				}
+				case RomFields::RFT_AGE_RATINGS:
+					binField.v[0] = writer.addAgeRatings(field->data.age_ratings);
+					break;
+				case RomFields::RFT_DIMENSIONS:
+					binField.v[0] = static_cast<uint32_t>(field->data.dimensions[0]);
+					binField.v[1] = static_cast<uint32_t>(field->data.dimensions[1]);
+					binField.v[2] = static_cast<uint32_t>(field->data.dimensions[2]);
+					break;
+				default:
+					// Unsupported field type.
+					assert(!"Unsupported RomFields::RomFieldsType.");
+					continue;
+			}
+
+#if SYS_BYTEORDER == SYS_BIG_ENDIAN
+			binField.name = cpu_to_le32(binField.name);
+			binField.flags = cpu_to_le32(binField.flags);
+			for (int j = 0; j < ARRAY_SIZE(binField.v); j++) {
+				binField.v[j] = cpu_to_le32(binField.v[j]);
+			}
+#endif /* SYS_BYTEORDER == SYS_BIG_ENDIAN */
+			binFields.push_back(binField);
+		}
+	}
+
+	// Metadata properties.
+	vector<BinFields_MetaData> binMetaData;
+	if (metaData) {
+		const int count = metaData->count();
+		binMetaData.reserve(count);
+		for (int i = 0; i < count; i++) {
+			const RomMetaData::MetaData *const prop = metaData->prop(i);
+			assert(prop != nullptr);
+			if (!prop)
+				continue;
+
+			BinFields_MetaData binProp;
+			memset(&binProp, 0, sizeof(binProp));
+			binProp.name = static_cast<uint8_t>(prop->name);
+			binProp.type = static_cast<uint8_t>(prop->type);
+			switch (prop->type) {
+				case PropertyType::Integer:
+					binProp.value = static_cast<uint32_t>(prop->data.ivalue);
+					break;
+				case PropertyType::UnsignedInteger:
+					binProp.value = prop->data.uvalue;
+					break;
+				case PropertyType::String:
+					binProp.value = writer.addString(prop->data.str);
+					break;
+				case PropertyType::Timestamp:
+					binProp.value = static_cast<uint64_t>(static_cast<int64_t>(prop->data.timestamp));
+					break;
+				default:
+					// Unsupported property type.
+					assert(!"Unsupported PropertyType.");
+					continue;
+			}
+			binProp.value = cpu_to_le64(binProp.value);
+			binMetaData.push_back(binProp);
+		}
+	}
+
+	// Calculate the section offsets.
+	// All sections are 4-byte aligned, since the
+	// records, data area, and strings are multiples
+	// of 4 bytes.
+	const uint64_t tabs_offset = sizeof(BinFields_Header);
+	const uint64_t fields_offset = tabs_offset + (tabs.size() * sizeof(uint32_t));
+	const uint64_t metadata_offset = fields_offset + (binFields.size() * sizeof(BinFields_Field));
+	const uint64_t data_offset = metadata_offset + (binMetaData.size() * sizeof(BinFields_MetaData));
+	const uint64_t strtbl_offset = data_offset + writer.data.size();
+	const uint64_t total_size = strtbl_offset + writer.strtbl.size();
+	if (total_size >= BINFIELDS_REF_NONE) {
+		// Too big for 32-bit offsets.
+		return -EOVERFLOW;
+	}
+
+	BinFields_Header header;
+	header.magic = cpu_to_be32(BINFIELDS_MAGIC);
+	header.version = cpu_to_le16(BINFIELDS_VERSION);
+	header.header_size = cpu_to_le16(sizeof(BinFields_Header));
+	header.total_size = cpu_to_le32(static_cast<uint32_t>(total_size));
+	header.tab_count = cpu_to_le32(static_cast<uint32_t>(tabs.size()));
+	header.field_count = cpu_to_le32(static_cast<uint32_t>(binFields.size()));
+	header.metadata_count = cpu_to_le32(static_cast<uint32_t>(binMetaData.size()));
+	header.tabs_offset = cpu_to_le32(static_cast<uint32_t>(tabs_offset));
+	header.fields_offset = cpu_to_le32(static_cast<uint32_t>(fields_offset));
+	header.metadata_offset = cpu_to_le32(static_cast<uint32_t>(metadata_offset));
+	header.data_offset = cpu_to_le32(static_cast<uint32_t>(data_offset));
+	header.data_size = cpu_to_le32(static_cast<uint32_t>(writer.data.size()));
+	header.strtbl_offset = cpu_to_le32(static_cast<uint32_t>(strtbl_offset));
+	header.strtbl_size = cpu_to_le32(static_cast<uint32_t>(writer.strtbl.size()));
+	header.reserved = 0;
+
+	// Write the buffer.
+	out.resize(static_cast<size_t>(total_size));
+	uint8_t *p = out.data();
+	memcpy(p, &header, sizeof(header));
+	p += sizeof(header);
+	if (!tabs.empty()) {
+		memcpy(p, tabs.data(), tabs.size() * sizeof(uint32_t));
+		p += tabs.size() * sizeof(uint32_t);
+	}
+	if (!binFields.empty()) {
+		memcpy(p, binFields.data(), binFields.size() * sizeof(BinFields_Field));
+		p += binFields.size() * sizeof(BinFields_Field);
+	}
+	if (!binMetaData.empty()) {
+		memcpy(p, binMetaData.data(), binMetaData.size() * sizeof(BinFields_MetaData));
+		p += binMetaData.size() * sizeof(BinFields_MetaData);
+	}
+	if (!writer.data.empty()) {
+		memcpy(p, writer.data.data(), writer.data.size());
+		p += writer.data.size();
+	}
+	if (!writer.strtbl.empty()) {
+		memcpy(p, writer.strtbl.data(), writer.strtbl.size());
+	}
+	return 0;
+}
+
+/**
+ * Get the number of tabs.
+ * @return Number of tabs.
+ */
+int BinFields::tabCount(void) const
+{
+	return static_cast<int>(m_tab_count);
+}
+
+/**
+ * Get a tab name.
+ * @param tabIdx Tab index.
+ * @return Tab name, or nullptr if no name is set.
+ */
+const char *BinFields::tabName(int tabIdx) const
+{
+	if (tabIdx < 0 || static_cast<uint32_t>(tabIdx) >= m_tab_count)
+		return nullptr;
+
+	uint32_t ref;
+	memcpy(&ref, &m_tabs[tabIdx * sizeof(uint32_t)], sizeof(ref));
+	return str(le32_to_cpu(ref));
+}
+
+/**
+ * Get the number of fields.
+ * @return Number of fields.
+ */
+int BinFields::count(void) const
+{
+	return static_cast<int>(m_field_count);
+}
+
+/**
+ * Get a field record.
+ * @param idx Field index.
+ * @return Field record, or nullptr if the index is invalid.
+ */
+const BinFields_Field *BinFields::field(int idx) const
+{
+	if (idx < 0 || static_cast<uint32_t>(idx) >= m_field_count)
+		return nullptr;
+	return &m_fields[idx];
+}
+
+/**
+ * Get the number of metadata properties.
+ * @return Number of metadata properties.
+ */
+int BinFields::metaDataCount(void) const
+{
+	return static_cast<int>(m_metadata_count);
+}
+
+/**
+ * Get a metadata property record.
+ * @param idx Property index.
+ * @return Metadata property record, or nullptr if the index is invalid.
+ */
+const BinFields_MetaData *BinFields::metaData(int idx) const
+{
+	if (idx < 0 || static_cast<uint32_t>(idx) >= m_metadata_count)
+		return nullptr;
+	return &m_metadata[idx];
+}
+
+/**
+ * Get a string.
+ * @param ref		[in] String reference.
+ * @param pLen		[out,opt] String length.
+ * @return NULL-terminated string, or nullptr if the reference is BINFIELDS_REF_NONE or invalid.
+ */
+const char *BinFields::str(uint32_t ref, size_t *pLen) const
+{
+	if (ref == BINFIELDS_REF_NONE || (uint64_t)ref + sizeof(uint32_t) > m_strtbl_size)
+		return nullptr;
+
+	uint32_t len;
+	memcpy(&len, &m_strtbl[ref], sizeof(len));
+	len = le32_to_cpu(len);
+
+	// Make sure the string and its NULL terminator are in bounds.
+	const uint64_t str_offset = (uint64_t)ref + sizeof(uint32_t);
+	if (str_offset + len + 1 > m_strtbl_size || m_strtbl[str_offset + len] != 0)
+		return nullptr;
+
+	if (pLen) {
+		*pLen = len;
+	}
+	return reinterpret_cast<const char*>(&m_strtbl[str_offset]);
+}
+
+/**
+ * Read a uint32_t from the data area.
+ * @param offset	[in] Offset in the data area.
+ * @param pValue	[out] Value.
+ * @return True on success; false if out of bounds.
+ */
+bool BinFields::readData32(uint32_t offset, uint32_t *pValue) const
+{
+	if ((uint64_t)offset + sizeof(uint32_t) > m_data_size)
+		return false;
+	memcpy(pValue, &m_data[offset], sizeof(*pValue));
+	*pValue = le32_to_cpu(*pValue);
+	return true;
+}
+
+/**
+ * Get the number of strings in a string array.
+ * @param ref String array reference.
+ * @return Number of strings, or -1 if the reference is BINFIELDS_REF_NONE or invalid.
+ */
+int BinFields::strArrayCount(uint32_t ref) const
+{
+	uint32_t count;
+	if (ref == BINFIELDS_REF_NONE || !readData32(ref, &count))
+		return -1;
+
+	// Make sure the entire array is in bounds.
+	if ((uint64_t)ref + sizeof(uint32_t) + ((uint64_t)count * sizeof(uint32_t)) > m_data_size)
+		return -1;
+	return static_cast<int>(count);
+}
+
+/**
+ * Get a string from a string array.
+ * @param ref		[in] String array reference.
+ * @param idx		[in] String index.
+ * @param pLen		[out,opt] String length.
+ * @return NULL-terminated string, or nullptr on error.
+ */
+const char *BinFields::strArrayItem(uint32_t ref, int idx, size_t *pLen) const
+{
+	const int count = strArrayCount(ref);
+	if (idx < 0 || idx >= count)
+		return nullptr;
+
+	// NOTE: strArrayCount() verified that the array is in bounds.
+	uint32_t str_ref = BINFIELDS_REF_NONE;
+	readData32(ref + sizeof(uint32_t) + (idx * sizeof(uint32_t)), &str_ref);
+	return str(str_ref, pLen);
+}
+
+/**
+ * Get the number of rows in list data.
+ * @param ref List data reference.
+ * @return Number of rows, or -1 if the reference is BINFIELDS_REF_NONE or invalid.
+ */
+int BinFields::listDataRowCount(uint32_t ref) const
+{
+	// List data has the same layout as a string array,
+	// but with string array references instead of strings.
+	return strArrayCount(ref);
+}
+
+/**
+ * Get a row from list data.
+ * @param ref List data reference.
+ * @param row Row index.
+ * @return String array reference for the row, or BINFIELDS_REF_NONE on error.
+ */
+uint32_t BinFields::listDataRow(uint32_t ref, int row) const
+{
+	const int count = listDataRowCount(ref);
+	if (row < 0 || row >= count)
+		return BINFIELDS_REF_NONE;
+
+	uint32_t row_ref = BINFIELDS_REF_NONE;
+	readData32(ref + sizeof(uint32_t) + (row * sizeof(uint32_t)), &row_ref);
+	return row_ref;
+}
+
+/**
+ * Get age ratings.
+ * @param ref		[in] Age ratings reference.
+ * @param age_ratings	[out] Age ratings.
+ * @return True on success; false if the reference is BINFIELDS_REF_NONE or invalid.
+ */
+bool BinFields::ageRatings(uint32_t ref, RomFields::age_ratings_t &age_ratings) const
+{
+	static const size_t size = RomFields::AGE_MAX * sizeof(uint16_t);
+	if (ref == BINFIELDS_REF_NONE || (uint64_t)ref + size > m_data_size)
+		return false;
+
+	memcpy(age_ratings.data(), &m_data[ref], size);
+#if SYS_BYTEORDER == SYS_BIG_ENDIAN
+	for (auto iter = age_ratings.begin(); iter != age_ratings.end(); ++iter) {
+		*iter = le16_to_cpu(*iter);
+	}
+#endif /* SYS_BYTEORDER == SYS_BIG_ENDIAN */
+	return true;
+}
+
+/**
+ * Copy a string array into a RomFields object as a name table.
+ * Fields that reference the same string array share the name table.
+ * @param binFields	[in] BinFields object.
+ * @param ref		[in] String array reference.
+ * @param fields	[in] RomFields object that owns the name table.
+ * @param nameTables	[in/out] Name tables that were already copied, indexed by reference.
+ * @return Name table, or nullptr if the reference is invalid.
+ */
+static const vector<string> *toNameTable(const BinFields *binFields, uint32_t ref, RomFields *fields,
+	unordered_map<uint32_t, const vector<string>*> &nameTables)
+{
+	auto iter = nameTables.find(ref);
+	if (iter != nameTables.end()) {
+		return iter->second;
+	}
+
+	const int count = binFields->strArrayCount(ref);
+	if (count < 0)
+		return nullptr;
+	vector<string> names;
+	names.reserve(count);
+	for (int i = 0; i < count; i++) {
+		size_t len;
+		const char *const s = binFields->strArrayItem(ref, i, &len);
+		if (!s)
+			return nullptr;
+		names.push_back(string(s, len));
+	}
+
+	const vector<string> *const vec = fields->ownStrVector(names);
+	nameTables.insert(std::make_pair(ref, vec));
+	return vec;
+}
+
+/**
+ * Convert the fields to a RomFields object.
+ * @return RomFields object, or nullptr if the buffer is invalid.
+ */
+RomFields *BinFields::toRomFields(void) const
+{
+	if (!isValid())
+		return nullptr;
+
+	unique_ptr<RomFields> fields(new RomFields());
+
+	// Tab names.
+	// NOTE: RomFields::tabCount() is always at least 1,
+	// so a single unnamed tab doesn't need to be set.
+	const int tabCount = static_cast<int>(m_tab_count);
+	if (tabCount > 1 || (tabCount == 1 && tabName(0) != nullptr)) {
+		fields->reserveTabs(tabCount);
+		for (int i = 0; i < tabCount; i++) {
+			fields->setTabName(i, tabName(i));
+		}
+	}
+
+	// Fields.
+	// Bit names and list headers are owned by the RomFields object.
+	unordered_map<uint32_t, const vector<string>*> nameTables;
+	const int count = static_cast<int>(m_field_count);
+	fields->reserve(count);
+	for (int i = 0; i < count; i++) {
+		const BinFields_Field *const binField = &m_fields[i];
+		const char *const name = str(le32_to_cpu(binField->name));
+		if (!name) {
+			// Invalid field name.
+			return nullptr;
+		}
+
+		uint32_t v[ARRAY_SIZE(binField->v)];
+		for (int j = 0; j < ARRAY_SIZE(v); j++) {
+			v[j] = le32_to_cpu(binField->v[j]);
+		}
+		const unsigned int flags = le32_to_cpu(binField->flags);
+
+		fields->setTabIndex(binField->tabIdx);
+		int ret;
+		switch (binField->type) {
+			case RomFields::RFT_STRING: {
+				const char *const s = str(v[0]);
+				if (!s && v[0] != BINFIELDS_REF_NONE) {
+					// Invalid string reference.
+					return nullptr;
+				}
+				ret = fields->addField_string(name, s, flags);
+				break;
+			}
+
+			case RomFields::RFT_BITFIELD: {
+				const vector<string> *const names =
+					toNameTable(this, v[2], fields.get(), nameTables);
+				if (!names) {
+					// Bit names are required.
+					return nullptr;
+				}
+				ret = fields->addField_bitfield(name, names,
+					static_cast<int>(v[1]), v[0]);
+				break;
+			}
+
+			case RomFields::RFT_LISTDATA: {
+				// NOTE: Icons aren't stored, and RomFields
+				// requires rows_visible to be non-negative.
+				RomFields::AFLD_PARAMS params(flags & ~RomFields::RFT_LISTDATA_ICONS,
+					(static_cast<int>(v[2]) >= 0 ? static_cast<int>(v[2]) : 0));
+				params.alignment.headers = v[3];
+				params.alignment.data = v[4];
+				params.mxd.checkboxes = v[5];
+
+				// Headers. (optional)
+				params.headers = nullptr;
+				if (v[0] != BINFIELDS_REF_NONE) {
+					params.headers = toNameTable(this, v[0], fields.get(), nameTables);
+					if (!params.headers)
+						return nullptr;
+				}
+
+				// List data. (optional)
+				unique_ptr<vector<vector<string> > > list_data;
+				if (v[1] != BINFIELDS_REF_NONE) {
+					const int rowCount = listDataRowCount(v[1]);
+					if (rowCount < 0)
+						return nullptr;
+					list_data.reset(new vector<vector<string> >(rowCount));
+					for (int row = 0; row < rowCount; row++) {
+						const uint32_t row_ref = listDataRow(v[1], row);
+						const int colCount = strArrayCount(row_ref);
+						if (colCount < 0)
+							return nullptr;
+						vector<string> &data_row = list_data->at(row);
+						data_row.reserve(colCount);
+						for (int col = 0; col < colCount; col++) {
+							size_t len;
+							const char *const s = strArrayItem(row_ref, col, &len);
+							if (!s)
+								return nullptr;
+							data_row.push_back(string(s, len));
+						}
+					}
+				}
+				params.list_data = list_data.release();
+				ret = fields->addField_listData(name, &params);
+				break;
+			}
+
+			case RomFields::RFT_DATETIME: {
+				const int64_t date_time = static_cast<int64_t>(
+					(static_cast<uint64_t>(v[1]) << 32) | v[0]);
+				ret = fields->addField_dateTime(name, static_cast<time_t>(date_time), flags);
+				break;
+			}
+
+			case RomFields::RFT_AGE_RATINGS: {
+				RomFields::age_ratings_t age_ratings;
+				if (!ageRatings(v[0], age_ratings))
+					return nullptr;
+				ret = fields->addField_ageRatings(name, age_ratings);
+				break;
+			}
+
+			case RomFields::RFT_DIMENSIONS:
+				ret = fields->addField_dimensions(name,
+					static_cast<int>(v[0]), static_cast<int>(v[1]), static_cast<int>(v[2]));
+				break;
+
+			default:
+				// Unsupported field type.
+				return nullptr;
+		}
+
+		if (ret < 0) {
+			// Error adding the field.
+			return nullptr;
+		}
+	}
+
+	return fields.release();
+}
+
+/**
+ * Convert the metadata to a RomMetaData object.
+ * @return RomMetaData object, or nullptr if the buffer is invalid.
+ */
+RomMetaData *BinFields::toRomMetaData(void) const
+{
+	if (!isValid())
+		return nullptr;
+
+	unique_ptr<RomMetaData> metaData(new RomMetaData());
+	const int count = static_cast<int>(m_metadata_count);
+	metaData->reserve(count);
+	for (int i = 0; i < count; i++) {
+		const BinFields_MetaData *const binProp = &m_metadata[i];
+		const Property::Property name = static_cast<Property::Property>(binProp->name);
+		if (binProp->type == PropertyType::Invalid ||
+		    binProp->type != RomMetaData::propertyType(name))
+		{
+			// Invalid property name or type.
+			return nullptr;
+		}
+
+		const uint64_t value = le64_to_cpu(binProp->value);
+		int ret;
+		switch (binProp->type) {
+			case PropertyType::Integer:
+				ret = metaData->addMetaData_integer(name, static_cast<int>(value));
+				break;
+			case PropertyType::UnsignedInteger:
+				ret = metaData->addMetaData_uint(name, static_cast<unsigned int>(value));
+				break;
+			case PropertyType::String: {
+				const uint32_t ref = static_cast<uint32_t>(value);
+				const char *const s = str(ref);
+				if (!s && ref != BINFIELDS_REF_NONE) {
+					// Invalid string reference.
+					return nullptr;
+				}
+				ret = metaData->addMetaData_string(name, s);
+				break;
+			}
+			case PropertyType::Timestamp:
+				ret = metaData->addMetaData_timestamp(name,
+					static_cast<time_t>(static_cast<int64_t>(value)));
+				break;
+			default:
+				// Unsupported property type.
+				return nullptr;
+		}
+
+		if (ret < 0) {
+			// Error adding the property.
+			return nullptr;
+		}
+	}
+
+	return metaData.release();
+}
+
+}
@@ -0,0 +1,221 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * BinFields.hpp: Binary RomFields/RomMetaData serialization.              *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef __ROMPROPERTIES_LIBRPBASE_BINFIELDS_HPP__
+#define __ROMPROPERTIES_LIBRPBASE_BINFIELDS_HPP__
+
+#include "common.h"
+#include "binfields_structs.h"
+#include "RomFields.hpp"
+
+// C includes.
+#include <stddef.h>
+#include <stdint.h>
+
+// C++ includes.
+#include <vector>
+
+namespace LibRpBase {
+
+class RomMetaData;
+
+/**
+ * Compact binary encoding for RomFields and RomMetaData.
+ * See binfields_structs.h for the format.
+ *
+ * serialize() converts RomFields and RomMetaData objects into
+ * a single buffer, which can be stored in a cache or passed
+ * to another process.
+ *
+ * A BinFields object provides read access to a serialized buffer
+ * without copying it. Strings are returned as pointers into the
+ * buffer, so the buffer must remain valid for the lifetime of the
+ * BinFields object. toRomFields() and toRomMetaData() can be used
+ * to convert the buffer back into regular objects.
+ *
+ * All references are bounds-checked when they're accessed,
+ * so corrupted buffers are handled safely.
+ */
+class BinFields
+{
+	public:
+		/**
+		 * Open a serialized buffer for reading.
+		 * The buffer is not copied.
+		 * @param buf Buffer.
+		 * @param size Size of the buffer.
+		 */
+		BinFields(const void *buf, size_t size);
+
+	private:
+		RP_DISABLE_COPY(BinFields)
+
+	public:
+		/**
+		 * Serialize RomFields and RomMetaData objects.
+		 *
+		 * All tabs in the RomFields object will be loaded.
+		 * Icons in RFT_LISTDATA fields are not serialized.
+		 *
+		 * @param out		[out] Output buffer. (Existing contents are replaced.)
+		 * @param fields	[in,opt] RomFields object.
+		 * @param metaData	[in,opt] RomMetaData object.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		static int serialize(std::vector<uint8_t> &out,
+			const RomFields *fields, const RomMetaData *metaData);
+
+	public:
+		/**
+		 * Is the buffer valid?
+		 * @return True if the buffer has a valid header; false if not.
+		 */
+		inline bool isValid(void) const
+		{
+			return (m_buf != nullptr);
+		}
+
+		/**
+		 * Get the number of tabs.
+		 * @return Number of tabs.
+		 */
+		int tabCount(void) const;
+
+		/**
+		 * Get a tab name.
+		 * @param tabIdx Tab index.
+		 * @return Tab name, or nullptr if no name is set.
+		 */
+		const char *tabName(int tabIdx) const;
+
+		/**
+		 * Get the number of fields.
+		 * @return Number of fields.
+		 */
+		int count(void) const;
+
+		/**
+		 * Get a field record.
+		 * @param idx Field index.
+		 * @return Field record, or nullptr if the index is invalid.
+		 */
+		const BinFields_Field *field(int idx) const;
+
+		/**
+		 * Get the number of metadata properties.
+		 * @return Number of metadata properties.
+		 */
+		int metaDataCount(void) const;
+
+		/**
+		 * Get a metadata property record.
+		 * @param idx Property index.
+		 * @return Metadata property record, or nullptr if the index is invalid.
+		 */
+		const BinFields_MetaData *metaData(int idx) const;
+
+		/**
+		 * Get a string.
+		 * @param ref		[in] String reference.
+		 * @param pLen		[out,opt] String length.
+		 * @return NULL-terminated string, or nullptr if the reference is BINFIELDS_REF_NONE or invalid.
+		 */
+		const char *str(uint32_t ref, size_t *pLen = nullptr) const;
+
+		/**
+		 * Get the number of strings in a string array.
+		 * @param ref String array reference.
+		 * @return Number of strings, or -1 if the reference is BINFIELDS_REF_NONE or invalid.
+		 */
+		int strArrayCount(uint32_t ref) const;
+
+		/**
+		 * Get a string from a string array.
+		 * @param ref		[in] String array reference.
+		 * @param idx		[in] String index.
+		 * @param pLen		[out,opt] String length.
+		 * @return NULL-terminated string, or nullptr on error.
+		 */
+		const char *strArrayItem(uint32_t ref, int idx, size_t *pLen = nullptr) const;
+
+		/**
+		 * Get the number of rows in list data.
+		 * @param ref List data reference.
+		 * @return Number of rows, or -1 if the reference is BINFIELDS_REF_NONE or invalid.
+		 */
+		int listDataRowCount(uint32_t ref) const;
+
+		/**
+		 * Get a row from list data.
+		 * @param ref List data reference.
+		 * @param row Row index.
+		 * @return String array reference for the row, or BINFIELDS_REF_NONE on error.
+		 */
+		uint32_t listDataRow(uint32_t ref, int row) const;
+
+		/**
+		 * Get age ratings.
+		 * @param ref		[in] Age ratings reference.
+		 * @param age_ratings	[out] Age ratings.
+		 * @return True on success; false if the reference is BINFIELDS_REF_NONE or invalid.
+		 */
+		bool ageRatings(uint32_t ref, RomFields::age_ratings_t &age_ratings) const;
+
+	public:
+		/**
+		 * Convert the fields to a RomFields object.
+		 * @return RomFields object, or nullptr if the buffer is invalid.
+		 */
+		RomFields *toRomFields(void) const;
+
+		/**
+		 * Convert the metadata to a RomMetaData object.
+		 * @return RomMetaData object, or nullptr if the buffer is invalid.
+		 */
+		RomMetaData *toRomMetaData(void) const;
+
+	private:
+		/**
+		 * Read a uint32_t from the data area.
+		 * @param offset	[in] Offset in the data area.
+		 * @param pValue	[out] Value.
+		 * @return True on success; false if out of bounds.
+		 */
+		bool readData32(uint32_t offset, uint32_t *pValue) const;
+
+	private:
+		const uint8_t *m_buf;	// nullptr if invalid.
+
+		// Header values. (host-endian)
+		uint32_t m_tab_count;
+		uint32_t m_field_count;
+		uint32_t m_metadata_count;
+		const uint8_t *m_tabs;
+		const BinFields_Field *m_fields;
+		const BinFields_MetaData *m_metadata;
+		const uint8_t *m_data;
+		uint32_t m_data_size;
+		const uint8_t *m_strtbl;
+		uint32_t m_strtbl_size;
+};
+
+}
+
+#endif /* __ROMPROPERTIES_LIBRPBASE_BINFIELDS_HPP__ */
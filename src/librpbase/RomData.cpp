@@ -24,6 +24,7 @@
 #include "TextFuncs.hpp"
 #include "file/IRpFile.hpp"
 #include "threads/Atomics.h"
+#include "threads/ThreadLocal.hpp"
 #include "libi18n/i18n.h"
 
 // C includes. (C++ namespace)
@@ -41,6 +42,9 @@ using std::vector;
 
 namespace LibRpBase {
 
+// Active MetaDataOnlyScope for the current thread.
+static ThreadLocalPtr tls_metaDataOnly;
+
 /** RomDataPrivate **/
 
 /**
@@ -53,6 +57,7 @@ RomDataPrivate::RomDataPrivate(RomData *q, IRpFile *file)
 	: q_ptr(q)
 	, ref_cnt(1)
 	, isValid(false)
+	, metaDataOnly(tls_metaDataOnly.get() != nullptr)
 	, file(nullptr)
 	, fields(new RomFields())
 	, metaData(nullptr)
@@ -420,6 +425,48 @@ void RomData::close(void)
 	}
 }
 
+/**
+ * Enable metadata-only mode.
+ *
+ * In metadata-only mode, only metaData() is available.
+ * fields() returns nullptr, and internal images are
+ * never decoded.
+ *
+ * Subclasses may check isMetaDataOnly() to skip work that
+ * doesn't affect the metadata. Data that the metadata is
+ * read from, e.g. banners stored in the disc's filesystem,
+ * must still be loaded so the metadata is the same.
+ *
+ * NOTE: Objects created within a MetaDataOnlyScope are
+ * already in metadata-only mode when their constructors run.
+ */
+void RomData::setMetaDataOnly(void)
+{
+	RP_D(RomData);
+	d->metaDataOnly = true;
+}
+
+/**
+ * Is this RomData object in metadata-only mode?
+ * @return True if it is; false if it isn't.
+ */
+bool RomData::isMetaDataOnly(void) const
+{
+	RP_D(const RomData);
+	return d->metaDataOnly;
+}
+
+RomData::MetaDataOnlyScope::MetaDataOnlyScope()
+	: m_prev(tls_metaDataOnly.get())
+{
+	tls_metaDataOnly.set(this);
+}
+
+RomData::MetaDataOnlyScope::~MetaDataOnlyScope()
+{
+	tls_metaDataOnly.set(m_prev);
+}
+
 /**
  * Get the class name for the user configuration.
  * @return Class name. (ASCII) (nullptr on error)
@@ -606,12 +653,37 @@ int RomData::loadMetaData(void)
 
 /**
  * Get the ROM Fields object.
- * @return ROM Fields object.
+ * All tabs are loaded, including tabs with tab loaders.
+ * @return ROM Fields object, or nullptr in metadata-only mode.
  */
 const RomFields *RomData::fields(void) const
+{
+	const RomFields *const fields = fieldsLazy();
+	if (fields) {
+		// Load tabs that haven't been loaded yet.
+		fields->loadAllTabs();
+	}
+	return fields;
+}
+
+/**
+ * Get the ROM Fields object without loading tabs
+ * that have tab loaders. These tabs can be loaded
+ * later using RomFields::loadTab().
+ *
+ * NOTE: The file must remain open until all tabs
+ * have been loaded. Check RomFields::hasPendingTabs()
+ * before calling close().
+ *
+ * @return ROM Fields object, or nullptr in metadata-only mode.
+ */
+const RomFields *RomData::fieldsLazy(void) const
 {
 	RP_D(const RomData);
-	if (d->fields->empty()) {
+	if (d->metaDataOnly) {
+		// Fields aren't available in metadata-only mode.
+		return nullptr;
+	} else if (d->fields->empty()) {
 		// Data has not been loaded.
 		// Load it now.
 		int ret = const_cast<RomData*>(this)->loadFieldData();
@@ -645,7 +717,7 @@ const RomMetaData *RomData::metaData(void) const
  * Do NOT delete this object until you're done using this rp_image.
  *
  * @param imageType Image type to load.
- * @return Internal image, or nullptr if the ROM doesn't have one.
+ * @return Internal image, or nullptr if the ROM doesn't have one or in metadata-only mode.
  */
 const rp_image *RomData::image(ImageType imageType) const
 {
@@ -656,6 +728,12 @@ const rp_image *RomData::image(ImageType imageType) const
 	}
 	// TODO: Check supportedImageTypes()?
 
+	RP_D(const RomData);
+	if (d->metaDataOnly) {
+		// Images are never decoded in metadata-only mode.
+		return nullptr;
+	}
+
 	// Load the internal image.
 	// The subclass maintains ownership of the image.
 #ifdef _DEBUG
@@ -118,6 +118,46 @@ class RomData
 		 */
 		virtual void close(void);
 
+		/**
+		 * Enable metadata-only mode.
+		 *
+		 * In metadata-only mode, only metaData() is available.
+		 * fields() returns nullptr, and internal images are
+		 * never decoded.
+		 *
+		 * Subclasses may check isMetaDataOnly() to skip work that
+		 * doesn't affect the metadata. Data that the metadata is
+		 * read from, e.g. banners stored in the disc's filesystem,
+		 * must still be loaded so the metadata is the same.
+		 *
+		 * NOTE: Objects created within a MetaDataOnlyScope are
+		 * already in metadata-only mode when their constructors run.
+		 */
+		void setMetaDataOnly(void);
+
+		/**
+		 * Is this RomData object in metadata-only mode?
+		 * @return True if it is; false if it isn't.
+		 */
+		bool isMetaDataOnly(void) const;
+
+		/**
+		 * Create RomData objects on the current thread in
+		 * metadata-only mode for the lifetime of this object.
+		 * Used by RomDataFactory::create() with RDA_METADATA_ONLY,
+		 * so constructors can check isMetaDataOnly(), too.
+		 */
+		class MetaDataOnlyScope
+		{
+			public:
+				MetaDataOnlyScope();
+				~MetaDataOnlyScope();
+
+			private:
+				RP_DISABLE_COPY(MetaDataOnlyScope)
+				void *m_prev;
+		};
+
 	public:
 		/** ROM detection functions. **/
 
@@ -418,10 +458,24 @@ class RomData
 	public:
 		/**
 		 * Get the ROM Fields object.
-		 * @return ROM Fields object.
+		 * All tabs are loaded, including tabs with tab loaders.
+		 * @return ROM Fields object, or nullptr in metadata-only mode.
 		 */
 		const RomFields *fields(void) const;
 
+		/**
+		 * Get the ROM Fields object without loading tabs
+		 * that have tab loaders. These tabs can be loaded
+		 * later using RomFields::loadTab().
+		 *
+		 * NOTE: The file must remain open until all tabs
+		 * have been loaded. Check RomFields::hasPendingTabs()
+		 * before calling close().
+		 *
+		 * @return ROM Fields object, or nullptr in metadata-only mode.
+		 */
+		const RomFields *fieldsLazy(void) const;
+
 		/**
 		 * Get the ROM Metadata object.
 		 * @return ROM Metadata object.
@@ -444,7 +498,7 @@ class RomData
 		 * Do NOT delete this object until you're done using this rp_image.
 		 *
 		 * @param imageType Image type to load.
-		 * @return Internal image, or nullptr if the ROM doesn't have one.
+		 * @return Internal image, or nullptr if the ROM doesn't have one or in metadata-only mode.
 		 */
 		const rp_image *image(ImageType imageType) const;
 
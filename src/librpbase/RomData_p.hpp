@@ -63,6 +63,7 @@ class RomDataPrivate
 	public:
 		volatile int ref_cnt;		// Reference count.
 		bool isValid;			// Subclass must set this to true if the ROM is valid.
+		bool metaDataOnly;		// Metadata-only mode. (See RomData::setMetaDataOnly().)
 		IRpFile *file;			// Open file.
 		RomFields *const fields;	// ROM fields. (NOTE: allocated by the base class)
 		RomMetaData *metaData;		// ROM metadata. (NOTE: nullptr initially.)
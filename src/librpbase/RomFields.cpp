@@ -23,22 +23,137 @@
 #include "common.h"
 #include "TextFuncs.hpp"
 #include "threads/Atomics.h"
+#include "threads/Mutex.hpp"
 #include "libi18n/i18n.h"
 
 // C includes. (C++ namespace)
 #include <cassert>
+#include <cstring>
 
 // C++ includes.
+#include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <new>
 #include <string>
+#include <unordered_map>
 #include <vector>
 using std::string;
 using std::unique_ptr;
+using std::unordered_map;
 using std::vector;
 
 namespace LibRpBase {
 
+/**
+ * Bump allocator for field names and data.
+ * Memory is only freed when the arena is destroyed.
+ */
+class RomFieldsArena
+{
+	public:
+		RomFieldsArena()
+			: m_chunks(nullptr)
+			, m_pos(nullptr)
+			, m_avail(0)
+		{ }
+		~RomFieldsArena();
+
+	private:
+		RP_DISABLE_COPY(RomFieldsArena)
+
+	public:
+		/**
+		 * Allocate memory from the arena.
+		 * @param size Size, in bytes.
+		 * @return Memory, aligned to 8 bytes.
+		 */
+		void *alloc(size_t size);
+
+		/**
+		 * Copy a string into the arena.
+		 * @param str String.
+		 * @return Copy of the string.
+		 */
+		const char *copyString(const char *str);
+
+	private:
+		// Chunk header. The chunk data follows the header.
+		union Chunk {
+			Chunk *next;
+			uint64_t align;	// Ensures 8-byte alignment for the data.
+		};
+
+		// Default chunk size. This is usually enough
+		// for all of the names and strings in a RomFields.
+		static const size_t CHUNK_SIZE = 4096 - sizeof(Chunk);
+
+		Chunk *m_chunks;	// Allocated chunks. (most recent first)
+		uint8_t *m_pos;		// Next free byte in the current chunk.
+		size_t m_avail;		// Bytes available in the current chunk.
+};
+
+RomFieldsArena::~RomFieldsArena()
+{
+	Chunk *chunk = m_chunks;
+	while (chunk) {
+		Chunk *const next = chunk->next;
+		operator delete(chunk);
+		chunk = next;
+	}
+}
+
+/**
+ * Allocate memory from the arena.
+ * @param size Size, in bytes.
+ * @return Memory, aligned to 8 bytes.
+ */
+void *RomFieldsArena::alloc(size_t size)
+{
+	size = (size + 7) & ~static_cast<size_t>(7);
+	if (size > m_avail) {
+		if (size > CHUNK_SIZE / 4) {
+			// Large allocation. Give it its own chunk,
+			// and keep using the current chunk.
+			Chunk *const chunk = static_cast<Chunk*>(operator new(sizeof(Chunk) + size));
+			if (m_chunks) {
+				chunk->next = m_chunks->next;
+				m_chunks->next = chunk;
+			} else {
+				chunk->next = nullptr;
+				m_chunks = chunk;
+			}
+			return chunk + 1;
+		}
+
+		// Start a new chunk.
+		Chunk *const chunk = static_cast<Chunk*>(operator new(sizeof(Chunk) + CHUNK_SIZE));
+		chunk->next = m_chunks;
+		m_chunks = chunk;
+		m_pos = reinterpret_cast<uint8_t*>(chunk + 1);
+		m_avail = CHUNK_SIZE;
+	}
+
+	void *const ptr = m_pos;
+	m_pos += size;
+	m_avail -= size;
+	return ptr;
+}
+
+/**
+ * Copy a string into the arena.
+ * @param str String.
+ * @return Copy of the string.
+ */
+const char *RomFieldsArena::copyString(const char *str)
+{
+	const size_t len = strlen(str) + 1;
+	char *const ptr = static_cast<char*>(alloc(len));
+	memcpy(ptr, str, len);
+	return ptr;
+}
+
 class RomFieldsPrivate
 {
 	public:
@@ -52,20 +167,130 @@ class RomFieldsPrivate
 		// ROM field structs.
 		vector<RomFields::Field> fields;
 
+		// Arena for field names, tab names, strings, age ratings,
+		// and name tables.
+		RomFieldsArena arena;
+
+		// Name tables from ownStrVector(). (allocated in the arena)
+		vector<vector<string>*> ownedStrVectors;
+
 		// Current tab index.
 		uint8_t tabIdx;
-		// Tab names.
-		vector<string> tabNames;
+		// Tab names. (nullptr or empty if not set)
+		vector<const char*> tabNames;
+
+		// Tab loaders, indexed by tab index.
+		// fn is nullptr if the tab has been loaded
+		// or doesn't have a tab loader.
+		struct TabLoader {
+			RomFields::tab_loader_fn fn;
+			void *userdata;
+		};
+		vector<TabLoader> tabLoaders;
 
 		/**
 		 * Delete allocated objects in this->fields.
 		 * The vector will be cleared afterwards.
 		 */
 		void delete_data(void);
+
+		/**
+		 * Add a field.
+		 * The name is copied into the arena, and the
+		 * type and tab index are set. All other fields
+		 * are zero-initialized.
+		 * @param name Field name.
+		 * @param type Field type.
+		 * @return Field index.
+		 */
+		int addField(const char *name, RomFields::RomFieldType type);
+
+		/**
+		 * Create a string in the arena.
+		 * The string must be destroyed using deleteString().
+		 * @param str String.
+		 * @return String.
+		 */
+		inline string *newString(const char *str)
+		{
+			return new (arena.alloc(sizeof(string))) string(str);
+		}
+
+		/**
+		 * Create a string in the arena.
+		 * The string must be destroyed using deleteString().
+		 * @param str String.
+		 * @return String.
+		 */
+		inline string *newString(const string &str)
+		{
+			return new (arena.alloc(sizeof(string))) string(str);
+		}
+
+		/**
+		 * Destroy a string created using newString().
+		 * @param str String.
+		 */
+		static inline void deleteString(const string *str)
+		{
+			str->~string();
+		}
+
+		/**
+		 * Get a name table for a field copied from another RomFields object.
+		 * Shared name tables are used as-is. Name tables owned by the
+		 * other RomFields object are copied into this one.
+		 * @param other Other RomFields object.
+		 * @param vec Name table. (may be nullptr)
+		 * @return Name table.
+		 */
+		const vector<string> *importStrVector(const RomFieldsPrivate *other, const vector<string> *vec);
+
+	public:
+		/** Shared name tables for strArrayToVector(). **/
+
+		struct StrArrayKey {
+			const char *msgctxt;		// i18n context. (nullptr if not translated)
+			const char *const *strArray;	// Static string array.
+			int count;			// String count.
+
+			inline bool operator==(const StrArrayKey &other) const
+			{
+				return (msgctxt == other.msgctxt &&
+					strArray == other.strArray &&
+					count == other.count);
+			}
+		};
+
+		struct StrArrayKeyHash {
+			inline size_t operator()(const StrArrayKey &key) const
+			{
+				return std::hash<const void*>()(key.strArray) ^
+					(std::hash<const void*>()(key.msgctxt) * 31) ^
+					static_cast<size_t>(key.count);
+			}
+		};
+
+		// NOTE: Elements in an unordered_map are never moved,
+		// so pointers to the vectors remain valid.
+		static Mutex strArrayMutex;
+		static unordered_map<StrArrayKey, vector<string>, StrArrayKeyHash> strArrayMap;
+
+		/**
+		 * Get a shared name table.
+		 * @param msgctxt i18n context, or nullptr to not translate the strings.
+		 * @param strArray Static array of strings.
+		 * @param count Number of strings, or -1 for a NULL-terminated array.
+		 * @return Shared vector.
+		 */
+		static const vector<string> *sharedStrArray(const char *msgctxt, const char *const *strArray, int count);
 };
 
 /** RomFieldsPrivate **/
 
+Mutex RomFieldsPrivate::strArrayMutex;
+unordered_map<RomFieldsPrivate::StrArrayKey, vector<string>, RomFieldsPrivate::StrArrayKeyHash> RomFieldsPrivate::strArrayMap;
+
 RomFieldsPrivate::RomFieldsPrivate()
 	: tabIdx(0)
 { }
@@ -73,6 +298,12 @@ RomFieldsPrivate::RomFieldsPrivate()
 RomFieldsPrivate::~RomFieldsPrivate()
 {
 	delete_data();
+
+	// Destroy the name tables. The memory is freed with the arena.
+	for (auto iter = ownedStrVectors.cbegin(); iter != ownedStrVectors.cend(); ++iter) {
+		typedef vector<string> vector_string;
+		(*iter)->~vector_string();
+	}
 }
 
 /**
@@ -97,21 +328,23 @@ void RomFieldsPrivate::delete_data(void)
 				break;
 
 			case RomFields::RFT_STRING:
-				delete const_cast<string*>(field.data.str);
+				if (field.data.str) {
+					deleteString(field.data.str);
+				}
 				break;
 			case RomFields::RFT_BITFIELD:
-				delete const_cast<vector<string>*>(field.desc.bitfield.names);
+			case RomFields::RFT_AGE_RATINGS:
+				// Bit names are shared or owned by
+				// ownedStrVectors, and age ratings
+				// are stored in the arena.
 				break;
 			case RomFields::RFT_LISTDATA:
-				delete const_cast<vector<string>*>(field.desc.list_data.names);
+				// NOTE: Headers are shared or owned by ownedStrVectors.
 				delete const_cast<vector<vector<string> >*>(field.data.list_data.data);
 				if (field.desc.list_data.flags & RomFields::RFT_LISTDATA_ICONS) {
 					delete const_cast<vector<const rp_image*>*>(field.data.list_data.mxd.icons);
 				}
 				break;
-			case RomFields::RFT_AGE_RATINGS:
-				delete const_cast<RomFields::age_ratings_t*>(field.data.age_ratings);
-				break;
 			default:
 				// ERROR!
 				assert(!"Unsupported RomFields::RomFieldsType.");
@@ -123,6 +356,91 @@ void RomFieldsPrivate::delete_data(void)
 	this->fields.clear();
 }
 
+/**
+ * Get a name table for a field copied from another RomFields object.
+ * Shared name tables are used as-is. Name tables owned by the
+ * other RomFields object are copied into this one.
+ * @param other Other RomFields object.
+ * @param vec Name table. (may be nullptr)
+ * @return Name table.
+ */
+const vector<string> *RomFieldsPrivate::importStrVector(const RomFieldsPrivate *other, const vector<string> *vec)
+{
+	if (!vec || std::find(other->ownedStrVectors.cbegin(), other->ownedStrVectors.cend(), vec)
+	            == other->ownedStrVectors.cend())
+	{
+		// Shared name table.
+		return vec;
+	}
+
+	vector<string> *const copy = new (arena.alloc(sizeof(vector<string>))) vector<string>(*vec);
+	ownedStrVectors.push_back(copy);
+	return copy;
+}
+
+/**
+ * Add a field.
+ * The name is copied into the arena, and the
+ * type and tab index are set. All other fields
+ * are zero-initialized.
+ * @param name Field name.
+ * @param type Field type.
+ * @return Field index.
+ */
+int RomFieldsPrivate::addField(const char *name, RomFields::RomFieldType type)
+{
+	const size_t idx = fields.size();
+	fields.resize(idx+1);
+	RomFields::Field &field = fields[idx];
+	field.name = arena.copyString(name);
+	field.type = type;
+	field.tabIdx = tabIdx;
+	field.isValid = true;
+	return static_cast<int>(idx);
+}
+
+/**
+ * Get a shared name table.
+ * @param msgctxt i18n context, or nullptr to not translate the strings.
+ * @param strArray Static array of strings.
+ * @param count Number of strings, or -1 for a NULL-terminated array.
+ * @return Shared vector.
+ */
+const vector<string> *RomFieldsPrivate::sharedStrArray(const char *msgctxt, const char *const *strArray, int count)
+{
+	const StrArrayKey key = {msgctxt, strArray, count};
+
+	MutexLocker locker(strArrayMutex);
+	auto iter = strArrayMap.find(key);
+	if (iter != strArrayMap.end()) {
+		// Name table was already created.
+		return &iter->second;
+	}
+
+	vector<string> &vec = strArrayMap[key];
+	const bool nullTerminated = (count < 0);
+	if (nullTerminated) {
+		count = std::numeric_limits<int>::max();
+	} else {
+		vec.reserve(count);
+	}
+
+	for (; strArray != nullptr && count > 0; strArray++, count--) {
+		if (!*strArray) {
+			if (nullTerminated)
+				break;
+			// nullptr will be handled as empty strings.
+			vec.push_back(string());
+		} else if (msgctxt) {
+			vec.push_back(dpgettext_expr(RP_I18N_DOMAIN, msgctxt, *strArray));
+		} else {
+			vec.push_back(*strArray);
+		}
+	}
+
+	return &vec;
+}
+
 /** RomFields **/
 
 /**
@@ -380,12 +698,13 @@ const RomFields::Field *RomFields::field(int idx) const
 
 /**
  * Is this RomFields empty?
+ * Tabs that haven't been loaded yet count as fields.
  * @return True if empty; false if not.
  */
 bool RomFields::empty(void) const
 {
 	RP_D(const RomFields);
-	return d->fields.empty();
+	return d->fields.empty() && !hasPendingTabs();
 }
 
 /** Convenience functions for RomData subclasses. **/
@@ -436,7 +755,7 @@ void RomFields::setTabName(int tabIdx, const char *name)
 		// Need to resize tabNames.
 		d->tabNames.resize(tabIdx+1);
 	}
-	d->tabNames[tabIdx] = (name ? name : "");
+	d->tabNames[tabIdx] = (name ? d->arena.copyString(name) : nullptr);
 }
 
 /**
@@ -447,7 +766,7 @@ void RomFields::setTabName(int tabIdx, const char *name)
 int RomFields::addTab(const char *name)
 {
 	RP_D(RomFields);
-	d->tabNames.push_back(name);
+	d->tabNames.push_back(name ? d->arena.copyString(name) : nullptr);
 	d->tabIdx = static_cast<int>(d->tabNames.size() - 1);
 	return d->tabIdx;
 }
@@ -484,9 +803,134 @@ const char *RomFields::tabName(int tabIdx) const
 	}
 
 	// NOTE: nullptr is returned if the name is empty.
-	if (d->tabNames[tabIdx].empty())
+	const char *const name = d->tabNames[tabIdx];
+	if (!name || name[0] == '\0')
 		return nullptr;
-	return d->tabNames[tabIdx].c_str();
+	return name;
+}
+
+/**
+ * Set a tab loader.
+ *
+ * The tab's fields won't be added until the tab is loaded
+ * using loadTab() or loadAllTabs(). This allows expensive
+ * tabs to be skipped if they're never displayed.
+ *
+ * NOTE: The tab name must be set separately, and fields
+ * for this tab must only be added by the tab loader.
+ *
+ * @param tabIdx Tab index.
+ * @param loader Tab loader function.
+ * @param userdata User data. (usually the RomData's private class)
+ */
+void RomFields::setTabLoader(int tabIdx, tab_loader_fn loader, void *userdata)
+{
+	assert(tabIdx >= 0);
+	assert(loader != nullptr);
+	if (tabIdx < 0 || !loader)
+		return;
+
+	RP_D(RomFields);
+	if (static_cast<int>(d->tabNames.size()) < tabIdx+1) {
+		// Need to resize tabNames.
+		d->tabNames.resize(tabIdx+1);
+	}
+	if (static_cast<int>(d->tabLoaders.size()) < tabIdx+1) {
+		// Need to resize tabLoaders.
+		d->tabLoaders.resize(tabIdx+1);
+	}
+	d->tabLoaders[tabIdx].fn = loader;
+	d->tabLoaders[tabIdx].userdata = userdata;
+}
+
+/**
+ * Has the specified tab been loaded?
+ * @param tabIdx Tab index.
+ * @return True if the tab has been loaded or doesn't have a tab loader; false if not.
+ */
+bool RomFields::isTabLoaded(int tabIdx) const
+{
+	RP_D(const RomFields);
+	if (tabIdx < 0 || tabIdx >= static_cast<int>(d->tabLoaders.size()))
+		return true;
+	return (d->tabLoaders[tabIdx].fn == nullptr);
+}
+
+/**
+ * Are there any tabs that haven't been loaded yet?
+ * @return True if any tabs haven't been loaded yet; false if not.
+ */
+bool RomFields::hasPendingTabs(void) const
+{
+	RP_D(const RomFields);
+	for (auto iter = d->tabLoaders.cbegin(); iter != d->tabLoaders.cend(); ++iter) {
+		if (iter->fn != nullptr)
+			return true;
+	}
+	return false;
+}
+
+/**
+ * Load the specified tab by running its tab loader.
+ *
+ * The new fields are inserted after the fields of any
+ * lower-numbered tabs, so field indexes may change.
+ * The tab loader is only run once, even if it fails.
+ *
+ * @param tabIdx Tab index.
+ * @return Number of fields added on success; negative POSIX error code on error.
+ */
+int RomFields::loadTab(int tabIdx) const
+{
+	// NOTE: Tab loading is part of lazy initialization,
+	// so it's allowed on const RomFields objects.
+	RomFieldsPrivate *const d = d_ptr;
+	if (tabIdx < 0 || tabIdx >= static_cast<int>(d->tabLoaders.size()))
+		return 0;
+
+	const RomFieldsPrivate::TabLoader loader = d->tabLoaders[tabIdx];
+	if (!loader.fn) {
+		// Tab has already been loaded.
+		return 0;
+	}
+	d->tabLoaders[tabIdx].fn = nullptr;
+
+	const size_t oldCount = d->fields.size();
+	const uint8_t oldTabIdx = d->tabIdx;
+	d->tabIdx = tabIdx;
+	int ret = loader.fn(const_cast<RomFields*>(this), tabIdx, loader.userdata);
+	d->tabIdx = oldTabIdx;
+
+	// Move the new fields after the fields of lower-numbered tabs
+	// so the fields remain in tab order.
+	const auto oldEnd = d->fields.begin() + oldCount;
+	const auto pos = std::find_if(d->fields.begin(), oldEnd,
+		[tabIdx](const Field &field) { return field.tabIdx > tabIdx; });
+	if (pos != oldEnd) {
+		std::rotate(pos, oldEnd, d->fields.end());
+	}
+
+	if (ret < 0)
+		return ret;
+	return static_cast<int>(d->fields.size() - oldCount);
+}
+
+/**
+ * Load all tabs that haven't been loaded yet.
+ * @return Number of fields added.
+ */
+int RomFields::loadAllTabs(void) const
+{
+	RP_D(const RomFields);
+	int count = 0;
+	const int tabCount = static_cast<int>(d->tabLoaders.size());
+	for (int i = 0; i < tabCount; i++) {
+		const int ret = loadTab(i);
+		if (ret > 0) {
+			count += ret;
+		}
+	}
+	return count;
 }
 
 /** Fields **/
@@ -507,63 +951,59 @@ void RomFields::reserve(int n)
 /**
  * Convert an array of char strings to a vector of std::string.
  * This can be used for addField_bitfield() and addField_listData().
- * @param strArray Array of strings.
+ *
+ * The vector is created once per array and shared by all
+ * RomFields objects, so strArray must be a static array
+ * that is never modified. The vector must not be deleted.
+ *
+ * @param strArray Static array of strings.
  * @param count Number of strings, or -1 for a NULL-terminated array.
- * NOTE: The array will be terminated at NULL regardless of count,
- * so a -1 count is only useful if the size isn't known.
- * @return Allocated std::vector<std::string>.
+ * NOTE: If count is specified, nullptr strings are stored as empty strings.
+ * @return Shared std::vector<std::string>.
  */
-vector<string> *RomFields::strArrayToVector(const char *const *strArray, int count)
+const vector<string> *RomFields::strArrayToVector(const char *const *strArray, int count)
 {
-	vector<string> *pVec = new vector<string>();
-	if (count < 0) {
-		count = std::numeric_limits<int>::max();
-	} else {
-		pVec->reserve(count);
-	}
-
-	for (; strArray != nullptr && count > 0; strArray++, count--) {
-		// nullptr will be handled as empty strings.
-		pVec->push_back(*strArray ? *strArray : string());
-	}
-
-	return pVec;
+	return RomFieldsPrivate::sharedStrArray(nullptr, strArray, count);
 }
 
 /**
  * Convert an array of char strings to a vector of std::string.
  * This can be used for addField_bitfield() and addField_listData().
+ *
+ * The vector is created once per array and shared by all
+ * RomFields objects, so strArray must be a static array
+ * that is never modified. The vector must not be deleted.
+ *
  * @param msgctxt i18n context.
- * @param strArray Array of strings.
+ * @param strArray Static array of strings.
  * @param count Number of strings, or -1 for a NULL-terminated array.
- * NOTE: The array will be terminated at NULL regardless of count,
- * so a -1 count is only useful if the size isn't known.
- * @return Allocated std::vector<std::string>.
+ * NOTE: If count is specified, nullptr strings are stored as empty strings.
+ * @return Shared std::vector<std::string>.
  */
-vector<string> *RomFields::strArrayToVector_i18n(const char *msgctxt, const char *const *strArray, int count)
+const vector<string> *RomFields::strArrayToVector_i18n(const char *msgctxt, const char *const *strArray, int count)
 {
-#ifndef ENABLE_NLS
-	// Mark msgctxt as unused here.
-	RP_UNUSED(msgctxt);
-#endif /* ENABLE_NLS */
-
-	vector<string> *pVec = new vector<string>();
-	if (count < 0) {
-		count = std::numeric_limits<int>::max();
-	} else {
-		pVec->reserve(count);
-	}
-
-	for (; strArray != nullptr && count > 0; strArray++, count--) {
-		// nullptr will be handled as empty strings.
-		if (*strArray) {
-			pVec->push_back(dpgettext_expr(RP_I18N_DOMAIN, msgctxt, *strArray));
-		} else {
-			pVec->push_back(string());
-		}
-	}
+	assert(msgctxt != nullptr);
+	return RomFieldsPrivate::sharedStrArray(msgctxt, strArray, count);
+}
 
-	return pVec;
+/**
+ * Copy a vector of strings into this RomFields object.
+ * This can be used for addField_bitfield() and addField_listData()
+ * if the strings aren't from a static array, e.g. when loading
+ * serialized fields.
+ *
+ * The copy is owned by this RomFields object and is
+ * destroyed along with it.
+ *
+ * @param vec Vector of strings.
+ * @return Copy of the vector of strings.
+ */
+const vector<string> *RomFields::ownStrVector(const vector<string> &vec)
+{
+	RP_D(RomFields);
+	vector<string> *const copy = new (d->arena.alloc(sizeof(vector<string>))) vector<string>(vec);
+	d->ownedStrVectors.push_back(copy);
+	return copy;
 }
 
 /**
@@ -585,6 +1025,9 @@ int RomFields::addFields_romFields(const RomFields *other, int tabOffset)
 	if (!other)
 		return -1;
 
+	// Make sure all of the other tabs have been loaded.
+	other->loadAllTabs();
+
 	// TODO: More tab options:
 	// - Add original tab names if present.
 	// - Add all to specified tab or to current tab.
@@ -594,9 +1037,14 @@ int RomFields::addFields_romFields(const RomFields *other, int tabOffset)
 	// Do we need to add the other tabs?
 	if (tabOffset == TabOffset_AddTabs) {
 		// Add the other tabs.
+		// NOTE: Tab names are stored in the other RomFields object's
+		// arena, so they have to be copied.
 		d->tabNames.reserve(d->tabNames.size() + other->d_ptr->tabNames.size());
-		d->tabNames.insert(d->tabNames.end(),
-			other->d_ptr->tabNames.begin(), other->d_ptr->tabNames.end());
+		for (auto iter = other->d_ptr->tabNames.cbegin();
+		     iter != other->d_ptr->tabNames.cend(); ++iter)
+		{
+			d->tabNames.push_back(*iter ? d->arena.copyString(*iter) : nullptr);
+		}
 
 		// tabOffset will be the first new tab.
 		tabOffset = d->tabIdx + 1;
@@ -613,7 +1061,7 @@ int RomFields::addFields_romFields(const RomFields *other, int tabOffset)
 		const Field &field_src = *old_iter;
 		Field &field_dest = d->fields.at(idx);
 
-		field_dest.name = field_src.name;
+		field_dest.name = d->arena.copyString(field_src.name);
 		field_dest.type = field_src.type;
 		field_dest.tabIdx = (tabOffset != -1 ? (field_src.tabIdx + tabOffset) : d->tabIdx);
 		field_dest.isValid = field_src.isValid;
@@ -625,13 +1073,13 @@ int RomFields::addFields_romFields(const RomFields *other, int tabOffset)
 				break;
 
 			case RFT_STRING:
-				field_dest.data.str = (field_src.data.str ? new string(*field_src.data.str) : nullptr);
+				field_dest.data.str = (field_src.data.str ? d->newString(*field_src.data.str) : nullptr);
 				break;
 			case RFT_BITFIELD:
 				field_dest.desc.bitfield.elemsPerRow = field_src.desc.bitfield.elemsPerRow;
-				field_dest.desc.bitfield.names = (field_src.desc.bitfield.names
-						? new vector<string>(*(field_src.desc.bitfield.names))
-						: nullptr);
+				// NOTE: Bit names owned by the other object are copied.
+				field_dest.desc.bitfield.names = d->importStrVector(
+					other->d_ptr, field_src.desc.bitfield.names);
 				field_dest.data.bitfield = field_src.data.bitfield;
 				break;
 			case RFT_LISTDATA:
@@ -639,9 +1087,9 @@ int RomFields::addFields_romFields(const RomFields *other, int tabOffset)
 					field_src.desc.list_data.flags;
 				field_dest.desc.list_data.rows_visible =
 					field_src.desc.list_data.rows_visible;
-				field_dest.desc.list_data.names = (field_src.desc.list_data.names
-						? new vector<string>(*(field_src.desc.list_data.names))
-						: nullptr);
+				// NOTE: Headers owned by the other object are copied.
+				field_dest.desc.list_data.names = d->importStrVector(
+					other->d_ptr, field_src.desc.list_data.names);
 				field_dest.desc.list_data.alignment.headers =
 					field_src.desc.list_data.alignment.headers;
 				field_dest.desc.list_data.alignment.data =
@@ -664,9 +1112,14 @@ int RomFields::addFields_romFields(const RomFields *other, int tabOffset)
 				field_dest.data.date_time = field_src.data.date_time;
 				break;
 			case RFT_AGE_RATINGS:
-				field_dest.data.age_ratings = (field_src.data.age_ratings
-						? new age_ratings_t(*field_src.data.age_ratings)
-						: nullptr);
+				if (field_src.data.age_ratings) {
+					age_ratings_t *const age_ratings = static_cast<age_ratings_t*>(
+						d->arena.alloc(sizeof(age_ratings_t)));
+					*age_ratings = *field_src.data.age_ratings;
+					field_dest.data.age_ratings = age_ratings;
+				} else {
+					field_dest.data.age_ratings = nullptr;
+				}
 				break;
 			case RFT_DIMENSIONS:
 				memcpy(field_dest.data.dimensions, field_src.data.dimensions, sizeof(field_src.data.dimensions));
@@ -697,23 +1150,18 @@ int RomFields::addField_string(const char *name, const char *str, unsigned int f
 
 	// RFT_STRING
 	RP_D(RomFields);
-	size_t idx = d->fields.size();
-	d->fields.resize(idx+1);
-	Field &field = d->fields.at(idx);
+	const int idx = d->addField(name, RFT_STRING);
+	Field &field = d->fields[idx];
 
-	string *const nstr = (str ? new string(str) : nullptr);
-	field.name = name;
-	field.type = RFT_STRING;
+	string *const nstr = (str ? d->newString(str) : nullptr);
 	field.desc.flags = flags;
 	field.data.str = nstr;
-	field.tabIdx = d->tabIdx;
-	field.isValid = (name != nullptr);
 
 	// Handle string trimming flags.
 	if (nstr && (flags & STRF_TRIM_END)) {
 		trimEnd(*nstr);
 	}
-	return static_cast<int>(idx);
+	return idx;
 }
 
 /**
@@ -731,23 +1179,18 @@ int RomFields::addField_string(const char *name, const string &str, unsigned int
 
 	// RFT_STRING
 	RP_D(RomFields);
-	size_t idx = d->fields.size();
-	d->fields.resize(idx+1);
-	Field &field = d->fields.at(idx);
+	const int idx = d->addField(name, RFT_STRING);
+	Field &field = d->fields[idx];
 
-	string *const nstr = (!str.empty() ? new string(str) : nullptr);
-	field.name = name;
-	field.type = RFT_STRING;
+	string *const nstr = (!str.empty() ? d->newString(str) : nullptr);
 	field.desc.flags = flags;
 	field.data.str = nstr;
-	field.tabIdx = d->tabIdx;
-	field.isValid = true;
 
 	// Handle string trimming flags.
 	if (nstr && (flags & STRF_TRIM_END)) {
 		trimEnd(*nstr);
 	}
-	return static_cast<int>(idx);
+	return idx;
 }
 
 /**
@@ -880,9 +1323,8 @@ int RomFields::addField_string_address_range(const char *name,
 
 /**
  * Add bitfield data.
- * NOTE: This object takes ownership of the vector.
  * @param name Field name.
- * @param bit_names Bit names.
+ * @param bit_names Bit names, from strArrayToVector().
  * @param elemsPerRow Number of elements per row.
  * @param bitfield Bitfield.
  * @return Field index, or -1 on error.
@@ -898,23 +1340,18 @@ int RomFields::addField_bitfield(const char *name,
 
 	// RFT_BITFIELD
 	RP_D(RomFields);
-	size_t idx = d->fields.size();
-	d->fields.resize(idx+1);
-	Field &field = d->fields.at(idx);
+	const int idx = d->addField(name, RFT_BITFIELD);
+	Field &field = d->fields[idx];
 
-	field.name = name;
-	field.type = RFT_BITFIELD;
 	field.desc.bitfield.elemsPerRow = elemsPerRow;
 	field.desc.bitfield.names = bit_names;
 	field.data.bitfield = bitfield;
-	field.tabIdx = d->tabIdx;
-	field.isValid = true;
-	return static_cast<int>(idx);
+	return idx;
 }
 
 /**
  * Add ListData.
- * NOTE: This object takes ownership of the vectors.
+ * NOTE: This object takes ownership of the list data and icon vectors.
  * @param name Field name.
  * @param params Parameters.
  *
@@ -946,12 +1383,9 @@ int RomFields::addField_listData(const char *name, const AFLD_PARAMS *params)
 
 	// RFT_LISTDATA
 	RP_D(RomFields);
-	size_t idx = d->fields.size();
-	d->fields.resize(idx+1);
-	Field &field = d->fields.at(idx);
+	const int idx = d->addField(name, RFT_LISTDATA);
+	Field &field = d->fields[idx];
 
-	field.name = name;
-	field.type = RFT_LISTDATA;
 	field.desc.list_data.flags = params->flags;
 	assert(params->rows_visible >= 0);
 	if (params->rows_visible >= 0) {
@@ -976,9 +1410,7 @@ int RomFields::addField_listData(const char *name, const AFLD_PARAMS *params)
 			field.desc.list_data.flags &= ~RFT_LISTDATA_ICONS;
 		}
 	}
-	field.tabIdx = d->tabIdx;
-	field.isValid = true;
-	return static_cast<int>(idx);
+	return idx;
 }
 
 /**
@@ -996,17 +1428,12 @@ int RomFields::addField_dateTime(const char *name, time_t date_time, unsigned in
 
 	// RFT_DATETIME
 	RP_D(RomFields);
-	size_t idx = d->fields.size();
-	d->fields.resize(idx+1);
-	Field &field = d->fields.at(idx);
+	const int idx = d->addField(name, RFT_DATETIME);
+	Field &field = d->fields[idx];
 
-	field.name = name;
-	field.type = RFT_DATETIME;
 	field.desc.flags = flags;
 	field.data.date_time = date_time;
-	field.tabIdx = d->tabIdx;
-	field.isValid = true;
-	return static_cast<int>(idx);
+	return idx;
 }
 
 /**
@@ -1024,16 +1451,13 @@ int RomFields::addField_ageRatings(const char *name, const age_ratings_t &age_ra
 
 	// RFT_AGE_RATINGS
 	RP_D(RomFields);
-	size_t idx = d->fields.size();
-	d->fields.resize(idx+1);
-	Field &field = d->fields.at(idx);
-
-	field.name = name;
-	field.type = RFT_AGE_RATINGS;
-	field.data.age_ratings = new age_ratings_t(age_ratings);
-	field.tabIdx = d->tabIdx;
-	field.isValid = true;
-	return static_cast<int>(idx);
+	const int idx = d->addField(name, RFT_AGE_RATINGS);
+	Field &field = d->fields[idx];
+
+	age_ratings_t *const ratings = static_cast<age_ratings_t*>(d->arena.alloc(sizeof(age_ratings_t)));
+	*ratings = age_ratings;
+	field.data.age_ratings = ratings;
+	return idx;
 }
 
 /**
@@ -1052,18 +1476,13 @@ int RomFields::addField_dimensions(const char *name, int dimX, int dimY, int dim
 
 	// RFT_DIMENSIONS
 	RP_D(RomFields);
-	size_t idx = d->fields.size();
-	d->fields.resize(idx+1);
-	Field &field = d->fields.at(idx);
+	const int idx = d->addField(name, RFT_DIMENSIONS);
+	Field &field = d->fields[idx];
 
-	field.name = name;
-	field.type = RFT_DIMENSIONS;
 	field.data.dimensions[0] = dimX;
 	field.data.dimensions[1] = dimY;
 	field.data.dimensions[2] = dimZ;
-	field.tabIdx = d->tabIdx;
-	field.isValid = true;
-	return static_cast<int>(idx);
+	return idx;
 }
 
 }
@@ -174,8 +174,9 @@ class RomFields
 
 		// ROM field struct.
 		// Dynamically allocated.
+		// NOTE: Names and strings are owned by the RomFields object.
 		struct Field {
-			std::string name;	// Field name.
+			const char *name;	// Field name.
 			RomFieldType type;	// ROM field type.
 			uint8_t tabIdx;		// Tab index. (0 for default)
 			bool isValid;		// True if this field has valid data.
@@ -190,7 +191,8 @@ class RomFields
 					int elemsPerRow;
 					// Bit flag names.
 					// Must be a vector of at least 'elements' strings.
-					// If a name is nullptr, that element is skipped.
+					// If a name is empty, that element is skipped.
+					// Shared name table from strArrayToVector().
 					const std::vector<std::string> *names;
 				} bitfield;
 				struct _list_data {
@@ -202,7 +204,8 @@ class RomFields
 
 					// List field names. (headers)
 					// Must be a vector of at least 'fields' strings.
-					// If a name is nullptr, that field is skipped.
+					// If a name is empty, that field is skipped.
+					// Shared name table from strArrayToVector().
 					const std::vector<std::string> *names;
 
 					// Column text alignment.
@@ -290,6 +293,7 @@ class RomFields
 
 		/**
 		 * Is this RomFields empty?
+		 * Tabs that haven't been loaded yet count as fields.
 		 * @return True if empty; false if not.
 		 */
 		bool empty(void) const;
@@ -367,6 +371,65 @@ class RomFields
 		 */
 		const char *tabName(int tabIdx) const;
 
+		/**
+		 * Tab loader function.
+		 * Called by loadTab() to add the fields for a tab.
+		 * The current tab index is set to tabIdx before the
+		 * loader is called, and restored afterwards.
+		 * @param fields RomFields object.
+		 * @param tabIdx Tab index.
+		 * @param userdata User data specified in setTabLoader().
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		typedef int (*tab_loader_fn)(RomFields *fields, int tabIdx, void *userdata);
+
+		/**
+		 * Set a tab loader.
+		 *
+		 * The tab's fields won't be added until the tab is loaded
+		 * using loadTab() or loadAllTabs(). This allows expensive
+		 * tabs to be skipped if they're never displayed.
+		 *
+		 * NOTE: The tab name must be set separately, and fields
+		 * for this tab must only be added by the tab loader.
+		 *
+		 * @param tabIdx Tab index.
+		 * @param loader Tab loader function.
+		 * @param userdata User data. (usually the RomData's private class)
+		 */
+		void setTabLoader(int tabIdx, tab_loader_fn loader, void *userdata);
+
+		/**
+		 * Has the specified tab been loaded?
+		 * @param tabIdx Tab index.
+		 * @return True if the tab has been loaded or doesn't have a tab loader; false if not.
+		 */
+		bool isTabLoaded(int tabIdx) const;
+
+		/**
+		 * Are there any tabs that haven't been loaded yet?
+		 * @return True if any tabs haven't been loaded yet; false if not.
+		 */
+		bool hasPendingTabs(void) const;
+
+		/**
+		 * Load the specified tab by running its tab loader.
+		 *
+		 * The new fields are inserted after the fields of any
+		 * lower-numbered tabs, so field indexes may change.
+		 * The tab loader is only run once, even if it fails.
+		 *
+		 * @param tabIdx Tab index.
+		 * @return Number of fields added on success; negative POSIX error code on error.
+		 */
+		int loadTab(int tabIdx) const;
+
+		/**
+		 * Load all tabs that haven't been loaded yet.
+		 * @return Number of fields added.
+		 */
+		int loadAllTabs(void) const;
+
 		/** Fields **/
 
 		/**
@@ -378,25 +441,47 @@ class RomFields
 		/**
 		 * Convert an array of char strings to a vector of std::string.
 		 * This can be used for addField_bitfield() and addField_listData().
-		 * @param strArray Array of strings.
+		 *
+		 * The vector is created once per array and shared by all
+		 * RomFields objects, so strArray must be a static array
+		 * that is never modified. The vector must not be deleted.
+		 *
+		 * @param strArray Static array of strings.
 		 * @param count Number of strings, or -1 for a NULL-terminated array.
-		 * NOTE: The array will be terminated at NULL regardless of count,
-		 * so a -1 count is only useful if the size isn't known.
-		 * @return Allocated std::vector<std::string>.
+		 * NOTE: If count is specified, nullptr strings are stored as empty strings.
+		 * @return Shared std::vector<std::string>.
 		 */
-		static std::vector<std::string> *strArrayToVector(const char *const *strArray, int count = -1);
+		static const std::vector<std::string> *strArrayToVector(const char *const *strArray, int count = -1);
 
 		/**
 		 * Convert an array of char strings to a vector of std::string.
 		 * This can be used for addField_bitfield() and addField_listData().
+		 *
+		 * The vector is created once per array and shared by all
+		 * RomFields objects, so strArray must be a static array
+		 * that is never modified. The vector must not be deleted.
+		 *
 		 * @param msgctxt i18n context.
-		 * @param strArray Array of strings.
+		 * @param strArray Static array of strings.
 		 * @param count Number of strings, or -1 for a NULL-terminated array.
-		 * NOTE: The array will be terminated at NULL regardless of count,
-		 * so a -1 count is only useful if the size isn't known.
-		 * @return Allocated std::vector<std::string>.
+		 * NOTE: If count is specified, nullptr strings are stored as empty strings.
+		 * @return Shared std::vector<std::string>.
+		 */
+		static const std::vector<std::string> *strArrayToVector_i18n(const char *msgctxt, const char *const *strArray, int count = -1);
+
+		/**
+		 * Copy a vector of strings into this RomFields object.
+		 * This can be used for addField_bitfield() and addField_listData()
+		 * if the strings aren't from a static array, e.g. when loading
+		 * serialized fields.
+		 *
+		 * The copy is owned by this RomFields object and is
+		 * destroyed along with it.
+		 *
+		 * @param vec Vector of strings.
+		 * @return Copy of the vector of strings.
 		 */
-		static std::vector<std::string> *strArrayToVector_i18n(const char *msgctxt, const char *const *strArray, int count = -1);
+		const std::vector<std::string> *ownStrVector(const std::vector<std::string> &vec);
 
 		enum {
 			TabOffset_Ignore = -1,
@@ -492,9 +577,8 @@ class RomFields
 
 		/**
 		 * Add bitfield data.
-		 * NOTE: This object takes ownership of the vector.
 		 * @param name Field name.
-		 * @param bit_names Bit names.
+		 * @param bit_names Bit names, from strArrayToVector().
 		 * @param elemsPerRow Number of elements per row.
 		 * @param bitfield Bitfield.
 		 * @return Field index, or -1 on error.
@@ -536,7 +620,7 @@ class RomFields
 			} alignment;
 
 			// Data
-			const std::vector<std::string> *headers;
+			const std::vector<std::string> *headers;	// Shared; from strArrayToVector().
 			const std::vector<std::vector<std::string> > *list_data;
 
 			// Mutually-exclusive data.
@@ -553,7 +637,7 @@ class RomFields
 
 		/**
 		 * Add ListData.
-		 * NOTE: This object takes ownership of the vectors.
+		 * NOTE: This object takes ownership of the list data and icon vectors.
 		 * @param name Field name.
 		 * @param params Parameters.
 		 *
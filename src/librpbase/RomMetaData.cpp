@@ -260,6 +260,18 @@ bool RomMetaData::empty(void) const
 	return d->metaData.empty();
 }
 
+/**
+ * Get the type of a metadata property.
+ * @param name Property name.
+ * @return Property type, or PropertyType::Invalid if the name is invalid.
+ */
+PropertyType::PropertyType RomMetaData::propertyType(Property::Property name)
+{
+	if (name <= Property::FirstProperty || name >= Property::PropertyCount)
+		return PropertyType::Invalid;
+	return static_cast<PropertyType::PropertyType>(RomMetaDataPrivate::PropertyTypeMap[name]);
+}
+
 /** Convenience functions for RomData subclasses. **/
 
 /**
@@ -215,6 +215,13 @@ class RomMetaData
 		 */
 		bool empty(void) const;
 
+		/**
+		 * Get the type of a metadata property.
+		 * @param name Property name.
+		 * @return Property type, or PropertyType::Invalid if the name is invalid.
+		 */
+		static PropertyType::PropertyType propertyType(Property::Property name);
+
 	public:
 		/** Convenience functions for RomData subclasses. **/
 
@@ -20,6 +20,8 @@
 
 #include "config.librpbase.h"
 #include "TextFuncs.hpp"
+#include "TextFuncs_NULL.hpp"
+#include "TextFuncs_utf16.hpp"
 #include "byteswap.h"
 
 // libi18n
@@ -72,16 +74,61 @@ u16string utf16_bswap(const char16_t *str, int len)
 		}
 	}
 
-	// TODO: Optimize this?
-	u16string ret;
-	ret.reserve(len);
-	for (; len > 0; len--, str++) {
-		ret += __swab16(*str);
+	u16string ret(str, len);
+	__byte_swap_16_array(reinterpret_cast<uint16_t*>(&ret[0]), len * sizeof(char16_t));
+	return ret;
+}
+
+/**
+ * Convert UTF-16 text to UTF-8.
+ * Trailing NULL bytes will be removed.
+ * @param wcs	[in] UTF-16 text.
+ * @param len	[in] Length of wcs, in characters. (-1 for NULL-terminated string)
+ * @param bswap	[in] If true, wcs is byteswapped relative to the host.
+ * @return UTF-8 string.
+ */
+static string utf16_to_utf8_int(const char16_t *wcs, int len, bool bswap)
+{
+	if (!wcs) {
+		return string();
+	}
+	len = check_NULL_terminator(wcs, len);
+	if (len <= 0) {
+		return string();
 	}
 
+	// Each UTF-16 character is at most 3 bytes in UTF-8.
+	// (Surrogate pairs are 4 bytes for 2 characters.)
+	string ret;
+	ret.resize(len * 3);
+	ret.resize(utf16_to_utf8_buf(&ret[0], wcs, len, bswap));
 	return ret;
 }
 
+/**
+ * Convert UTF-16LE text to UTF-8.
+ * Trailing NULL bytes will be removed.
+ * @param wcs	[in] UTF-16LE text.
+ * @param len	[in] Length of wcs, in characters. (-1 for NULL-terminated string)
+ * @return UTF-8 string.
+ */
+string utf16le_to_utf8(const char16_t *wcs, int len)
+{
+	return utf16_to_utf8_int(wcs, len, (SYS_BYTEORDER == SYS_BIG_ENDIAN));
+}
+
+/**
+ * Convert UTF-16BE text to UTF-8.
+ * Trailing NULL bytes will be removed.
+ * @param wcs	[in] UTF-16BE text.
+ * @param len	[in] Length of wcs, in characters. (-1 for NULL-terminated string)
+ * @return UTF-8 string.
+ */
+string utf16be_to_utf8(const char16_t *wcs, int len)
+{
+	return utf16_to_utf8_int(wcs, len, (SYS_BYTEORDER == SYS_LIL_ENDIAN));
+}
+
 
 /** Miscellaneous functions. **/
 
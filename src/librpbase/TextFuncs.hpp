@@ -458,6 +458,7 @@ static inline std::u16string utf8_to_utf16(const std::string &str)
 /**
  * Convert UTF-16LE text to UTF-8.
  * Trailing NULL bytes will be removed.
+ * Unpaired surrogates will be converted to U+FFFD.
  * @param wcs	[in] UTF-16LE text.
  * @param len	[in] Length of wcs, in characters. (-1 for NULL-terminated string)
  * @return UTF-8 string.
@@ -467,6 +468,7 @@ std::string utf16le_to_utf8(const char16_t *wcs, int len);
 /**
  * Convert UTF-16BE text to UTF-8.
  * Trailing NULL bytes will be removed.
+ * Unpaired surrogates will be converted to U+FFFD.
  * @param wcs	[in] UTF-16BE text.
  * @param len	[in] Length of wcs, in characters. (-1 for NULL-terminated string)
  * @return UTF-8 string.
@@ -0,0 +1,56 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * TextFuncs_ascii.cpp: ASCII string detection.                            *
+ *                                                                         *
+ * Copyright (c) 2009-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "TextFuncs_ascii.hpp"
+
+// C includes.
+#include <stdint.h>
+
+// C includes. (C++ namespace)
+#include <cstring>
+
+namespace LibRpBase {
+
+/**
+ * Check if a string is entirely 7-bit ASCII.
+ * Standard version using regular C++ code.
+ * @param str String.
+ * @param len Length of str, in bytes.
+ * @return True if no byte is >= 0x80; false otherwise.
+ */
+bool isAscii_cpp(const char *str, size_t len)
+{
+	// Check 8 bytes at a time.
+	for (; len >= 8; str += 8, len -= 8) {
+		uint64_t qword;
+		memcpy(&qword, str, sizeof(qword));
+		if (qword & 0x8080808080808080ULL)
+			return false;
+	}
+
+	// Remaining bytes.
+	for (; len > 0; str++, len--) {
+		if (static_cast<uint8_t>(*str) & 0x80)
+			return false;
+	}
+	return true;
+}
+
+}
@@ -0,0 +1,88 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * TextFuncs_ascii.hpp: ASCII string detection.                            *
+ *                                                                         *
+ * Copyright (c) 2009-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef __ROMPROPERTIES_LIBRPBASE_TEXTFUNCS_ASCII_HPP__
+#define __ROMPROPERTIES_LIBRPBASE_TEXTFUNCS_ASCII_HPP__
+
+#include "common.h"
+#include "cpu_dispatch.h"
+
+// C includes.
+#include <stddef.h>
+
+#if defined(RP_CPU_I386) || defined(RP_CPU_AMD64)
+# include "cpuflags_x86.h"
+# define TEXTFUNCS_ASCII_HAS_SSE2 1
+#endif
+#ifdef RP_CPU_AMD64
+# define TEXTFUNCS_ASCII_ALWAYS_HAS_SSE2 1
+#endif
+
+namespace LibRpBase {
+
+/** Internal algorithms. **/
+// NOTE: These are public to allow for unit tests and benchmarking.
+
+/**
+ * Check if a string is entirely 7-bit ASCII.
+ * Standard version using regular C++ code.
+ * @param str String.
+ * @param len Length of str, in bytes.
+ * @return True if no byte is >= 0x80; false otherwise.
+ */
+bool isAscii_cpp(const char *str, size_t len);
+
+#ifdef TEXTFUNCS_ASCII_HAS_SSE2
+/**
+ * Check if a string is entirely 7-bit ASCII.
+ * SSE2-optimized version.
+ * @param str String.
+ * @param len Length of str, in bytes.
+ * @return True if no byte is >= 0x80; false otherwise.
+ */
+bool isAscii_sse2(const char *str, size_t len);
+#endif /* TEXTFUNCS_ASCII_HAS_SSE2 */
+
+/**
+ * Check if a string is entirely 7-bit ASCII.
+ * @param str String.
+ * @param len Length of str, in bytes.
+ * @return True if no byte is >= 0x80; false otherwise.
+ */
+static inline bool isAscii(const char *str, size_t len)
+{
+#ifdef TEXTFUNCS_ASCII_ALWAYS_HAS_SSE2
+	// amd64 always has SSE2.
+	return isAscii_sse2(str, len);
+#else /* !TEXTFUNCS_ASCII_ALWAYS_HAS_SSE2 */
+# ifdef TEXTFUNCS_ASCII_HAS_SSE2
+	if (RP_CPU_HasSSE2()) {
+		return isAscii_sse2(str, len);
+	} else
+# endif /* TEXTFUNCS_ASCII_HAS_SSE2 */
+	{
+		return isAscii_cpp(str, len);
+	}
+#endif /* TEXTFUNCS_ASCII_ALWAYS_HAS_SSE2 */
+}
+
+}
+
+#endif /* __ROMPROPERTIES_LIBRPBASE_TEXTFUNCS_ASCII_HPP__ */
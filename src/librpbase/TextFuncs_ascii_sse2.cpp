@@ -0,0 +1,61 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * TextFuncs_ascii_sse2.cpp: ASCII string detection.                       *
+ * SSE2-optimized version.                                                 *
+ *                                                                         *
+ * Copyright (c) 2009-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "TextFuncs_ascii.hpp"
+
+// SSE2 intrinsics.
+#include <emmintrin.h>
+
+namespace LibRpBase {
+
+/**
+ * Check if a string is entirely 7-bit ASCII.
+ * SSE2-optimized version.
+ * @param str String.
+ * @param len Length of str, in bytes.
+ * @return True if no byte is >= 0x80; false otherwise.
+ */
+bool isAscii_sse2(const char *str, size_t len)
+{
+	// Check 64 bytes at a time.
+	// The high bits are OR'd together, so only one
+	// movemask is needed per iteration.
+	for (; len >= 64; str += 64, len -= 64) {
+		const __m128i *const p = reinterpret_cast<const __m128i*>(str);
+		const __m128i v = _mm_or_si128(
+			_mm_or_si128(_mm_loadu_si128(&p[0]), _mm_loadu_si128(&p[1])),
+			_mm_or_si128(_mm_loadu_si128(&p[2]), _mm_loadu_si128(&p[3])));
+		if (_mm_movemask_epi8(v) != 0)
+			return false;
+	}
+
+	// Check 16 bytes at a time.
+	for (; len >= 16; str += 16, len -= 16) {
+		const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str));
+		if (_mm_movemask_epi8(v) != 0)
+			return false;
+	}
+
+	// Remaining bytes.
+	return isAscii_cpp(str, len);
+}
+
+}
@@ -0,0 +1,282 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * TextFuncs_cpN.cpp: Built-in code page decoders.                         *
+ *                                                                         *
+ * Copyright (c) 2009-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+
+#include "TextFuncs_cpN.hpp"
+#include "TextFuncs.hpp"
+
+// C includes. (C++ namespace)
+#include <cassert>
+#include <cstring>
+
+// C++ includes.
+#include <memory>
+#include <string>
+using std::string;
+using std::u16string;
+using std::unique_ptr;
+
+namespace LibRpBase {
+
+/**
+ * Convert cp1252 text to UTF-16.
+ * Standard version using regular C++ code.
+ * @param wcs	[out] Output buffer. (Must have room for at least len characters.)
+ * @param str	[in] cp1252 text.
+ * @param len	[in] Length of str, in bytes.
+ * @return Number of UTF-16 characters written. (Always len.)
+ */
+size_t cp1252_to_utf16_cpp(char16_t *wcs, const char *str, size_t len)
+{
+	const uint8_t *p = reinterpret_cast<const uint8_t*>(str);
+	for (size_t i = len; i > 0; i--, p++, wcs++) {
+		const uint8_t chr = *p;
+		if (chr >= 0x80 && chr < 0xA0) {
+			*wcs = cp1252_hi_tbl[chr - 0x80];
+		} else {
+			*wcs = chr;
+		}
+	}
+	return len;
+}
+
+/**
+ * Convert cp932 (Shift-JIS) text to UTF-16.
+ * Standard version using regular C++ code.
+ * @param wcs	[out] Output buffer. (Must have room for at least len characters.)
+ * @param str	[in] cp932 text.
+ * @param len	[in] Length of str, in bytes.
+ * @return Number of UTF-16 characters written, or -1 if the text is invalid.
+ */
+int cp932_to_utf16_cpp(char16_t *wcs, const char *str, size_t len)
+{
+	const uint8_t *p = reinterpret_cast<const uint8_t*>(str);
+	const uint8_t *const p_end = p + len;
+	char16_t *const wcs_start = wcs;
+
+	while (p < p_end) {
+		const uint8_t lead = *p++;
+		if (lead < 0x80) {
+			// ASCII.
+			*wcs++ = lead;
+			continue;
+		} else if (lead >= 0xA1 && lead <= 0xDF) {
+			// Halfwidth katakana.
+			*wcs++ = 0xFEC0 + lead;
+			continue;
+		}
+
+		// Double-byte character.
+		if (p >= p_end) {
+			// Missing the trail byte.
+			return -1;
+		}
+		const uint8_t trail = *p++;
+		unsigned int idx;
+		if (trail >= 0x40 && trail <= 0x7E) {
+			idx = trail - 0x40;
+		} else if (trail >= 0x80 && trail <= 0xFC) {
+			idx = trail - 0x41;
+		} else {
+			// Invalid trail byte.
+			return -1;
+		}
+
+		if (lead >= 0xF0 && lead <= 0xF9) {
+			// User-defined area. (U+E000-U+E757)
+			*wcs++ = 0xE000 + ((lead - 0xF0) * 188) + idx;
+			continue;
+		}
+
+		const unsigned int page = cp932_lead_tbl[lead - 0x80];
+		if (page == 0) {
+			// Invalid lead byte.
+			return -1;
+		}
+		const char16_t wchr = cp932_trail_tbl[page - 1][idx];
+		if (wchr == 0) {
+			// No mapping for this character.
+			return -1;
+		}
+		*wcs++ = wchr;
+	}
+
+	return static_cast<int>(wcs - wcs_start);
+}
+
+/**
+ * Convert Latin-1 text to UTF-16.
+ * @param wcs	[out] Output buffer. (Must have room for at least len characters.)
+ * @param str	[in] Latin-1 text.
+ * @param len	[in] Length of str, in bytes.
+ * @return Number of UTF-16 characters written. (Always len.)
+ */
+static inline size_t latin1_to_utf16_buf(char16_t *wcs, const char *str, size_t len)
+{
+	const uint8_t *p = reinterpret_cast<const uint8_t*>(str);
+	for (size_t i = len; i > 0; i--) {
+		*wcs++ = *p++;
+	}
+	return len;
+}
+
+/**
+ * Convert 8-bit text to a UTF-16 buffer using the built-in decoders.
+ * @param wcs	[out] Output buffer. (Must have room for at least len characters.)
+ * @param cp	[in] Code page number.
+ * @param str	[in] 8-bit text.
+ * @param len	[in] Length of str, in bytes.
+ * @param flags	[in] Flags. (See TextConv_Flags_e.)
+ * @return Number of UTF-16 characters written, or -1 if the system converter should be used.
+ */
+static int cpN_to_utf16_builtin_buf(char16_t *wcs, unsigned int cp, const char *str, size_t len, unsigned int flags)
+{
+	switch (cp) {
+		case 932: {
+			const int ret = cp932_to_utf16_buf(wcs, str, len);
+			if (ret >= 0) {
+				return ret;
+			} else if (!(flags & TEXTCONV_FLAG_CP1252_FALLBACK)) {
+				// No fallback. Let the system converter handle it.
+				return -1;
+			}
+			// Try cp1252 fallback.
+			return static_cast<int>(cp1252_to_utf16_buf(wcs, str, len));
+		}
+
+		case 1252:
+			return static_cast<int>(cp1252_to_utf16_buf(wcs, str, len));
+
+		case CP_LATIN1:
+			return static_cast<int>(latin1_to_utf16_buf(wcs, str, len));
+
+		default:
+			// Not supported.
+			return -1;
+	}
+}
+
+/**
+ * Is the specified code page supported by the built-in decoders?
+ * @param cp Code page number.
+ * @return True if supported; false if not.
+ */
+static inline bool isBuiltinCodePage(unsigned int cp)
+{
+	return (cp == 932 || cp == 1252 || cp == CP_LATIN1);
+}
+
+/**
+ * Convert 8-bit text to UTF-16 using the built-in decoders.
+ *
+ * Supported code pages:
+ * - 932: If the text is invalid and TEXTCONV_FLAG_CP1252_FALLBACK
+ *        is set, cp1252 will be used instead.
+ * - 1252
+ * - CP_LATIN1
+ *
+ * @param out	[out] Output string.
+ * @param cp	[in] Code page number.
+ * @param str	[in] 8-bit text.
+ * @param len	[in] Length of str, in bytes.
+ * @param flags	[in] Flags. (See TextConv_Flags_e.)
+ * @return True if the text was converted; false if the system converter should be used.
+ */
+bool cpN_to_utf16_builtin(u16string &out, unsigned int cp, const char *str, int len, unsigned int flags)
+{
+	if (!isBuiltinCodePage(cp))
+		return false;
+
+	// Conversion stops at the first NULL character.
+	const size_t cb = (len > 0 ? strnlen(str, len) : 0);
+
+	// Each byte produces at most one UTF-16 character.
+	out.resize(cb);
+	if (cb == 0)
+		return true;
+	const int cch = cpN_to_utf16_builtin_buf(&out[0], cp, str, cb, flags);
+	if (cch < 0) {
+		out.clear();
+		return false;
+	}
+	out.resize(cch);
+	return true;
+}
+
+/**
+ * Convert 8-bit text to UTF-8 using the built-in decoders.
+ * See cpN_to_utf16_builtin() for supported code pages.
+ *
+ * @param out	[out] Output string.
+ * @param cp	[in] Code page number.
+ * @param str	[in] 8-bit text.
+ * @param len	[in] Length of str, in bytes.
+ * @param flags	[in] Flags. (See TextConv_Flags_e.)
+ * @return True if the text was converted; false if the system converter should be used.
+ */
+bool cpN_to_utf8_builtin(string &out, unsigned int cp, const char *str, int len, unsigned int flags)
+{
+	if (!isBuiltinCodePage(cp))
+		return false;
+
+	// Conversion stops at the first NULL character.
+	const size_t cb = (len > 0 ? strnlen(str, len) : 0);
+	if (cb == 0) {
+		out.clear();
+		return true;
+	}
+
+	// Convert to UTF-16 first.
+	// Short strings use a stack buffer.
+	char16_t stack_buf[256];
+	unique_ptr<char16_t[]> heap_buf;
+	char16_t *wcs = stack_buf;
+	if (cb > static_cast<size_t>(ARRAY_SIZE(stack_buf))) {
+		heap_buf.reset(new char16_t[cb]);
+		wcs = heap_buf.get();
+	}
+	const int cch = cpN_to_utf16_builtin_buf(wcs, cp, str, cb, flags);
+	if (cch < 0)
+		return false;
+
+	// Convert from UTF-16 to UTF-8.
+	// All of the built-in decoders produce BMP characters,
+	// so each character is at most 3 bytes in UTF-8.
+	out.resize(cch * 3);
+	uint8_t *p = reinterpret_cast<uint8_t*>(&out[0]);
+	for (int i = 0; i < cch; i++) {
+		const char16_t ch16 = wcs[i];
+		assert(ch16 < 0xD800 || ch16 >= 0xE000);
+		if (ch16 < 0x0080) {
+			*p++ = static_cast<uint8_t>(ch16);
+		} else if (ch16 < 0x0800) {
+			*p++ = 0xC0 | (ch16 >> 6);
+			*p++ = 0x80 | (ch16 & 0x3F);
+		} else {
+			*p++ = 0xE0 | (ch16 >> 12);
+			*p++ = 0x80 | ((ch16 >> 6) & 0x3F);
+			*p++ = 0x80 | (ch16 & 0x3F);
+		}
+	}
+	out.resize(p - reinterpret_cast<const uint8_t*>(out.data()));
+	return true;
+}
+
+}
@@ -0,0 +1,184 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * TextFuncs_cpN.hpp: Built-in code page decoders.                         *
+ *                                                                         *
+ * Copyright (c) 2009-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+
+#ifndef __ROMPROPERTIES_LIBRPBASE_TEXTFUNCS_CPN_HPP__
+#define __ROMPROPERTIES_LIBRPBASE_TEXTFUNCS_CPN_HPP__
+
+#include "common.h"
+#include "cpu_dispatch.h"
+
+// C includes.
+#include <stddef.h>
+#include <stdint.h>
+
+// C++ includes.
+#include <string>
+
+#if defined(RP_CPU_I386) || defined(RP_CPU_AMD64)
+# include "cpuflags_x86.h"
+# define TEXTFUNCS_CPN_HAS_SSE2 1
+# define TEXTFUNCS_CPN_HAS_SSSE3 1
+#endif
+#ifdef RP_CPU_AMD64
+# define TEXTFUNCS_CPN_ALWAYS_HAS_SSE2 1
+#endif
+
+namespace LibRpBase {
+
+/** Decoding tables. (TextFuncs_cpN_data.cpp) **/
+
+// cp1252: 0x80-0x9F. (0xA0-0xFF are identical to Latin-1.)
+extern const char16_t cp1252_hi_tbl[32];
+
+// cp932: Lead byte to trail byte table index. (0 == invalid)
+extern const uint8_t cp932_lead_tbl[128];
+
+// cp932: Trail byte tables.
+#define CP932_TRAIL_TBL_COUNT 45
+extern const char16_t cp932_trail_tbl[CP932_TRAIL_TBL_COUNT][188];
+
+/** Internal algorithms. **/
+// NOTE: These are public to allow for unit tests and benchmarking.
+
+/**
+ * Convert cp1252 text to UTF-16.
+ * Standard version using regular C++ code.
+ * @param wcs	[out] Output buffer. (Must have room for at least len characters.)
+ * @param str	[in] cp1252 text.
+ * @param len	[in] Length of str, in bytes.
+ * @return Number of UTF-16 characters written. (Always len.)
+ */
+size_t cp1252_to_utf16_cpp(char16_t *wcs, const char *str, size_t len);
+
+#ifdef TEXTFUNCS_CPN_HAS_SSSE3
+/**
+ * Convert cp1252 text to UTF-16.
+ * SSSE3-optimized version.
+ * @param wcs	[out] Output buffer. (Must have room for at least len characters.)
+ * @param str	[in] cp1252 text.
+ * @param len	[in] Length of str, in bytes.
+ * @return Number of UTF-16 characters written. (Always len.)
+ */
+size_t cp1252_to_utf16_ssse3(char16_t *wcs, const char *str, size_t len);
+#endif /* TEXTFUNCS_CPN_HAS_SSSE3 */
+
+/**
+ * Convert cp1252 text to UTF-16.
+ * @param wcs	[out] Output buffer. (Must have room for at least len characters.)
+ * @param str	[in] cp1252 text.
+ * @param len	[in] Length of str, in bytes.
+ * @return Number of UTF-16 characters written. (Always len.)
+ */
+static inline size_t cp1252_to_utf16_buf(char16_t *wcs, const char *str, size_t len)
+{
+#ifdef TEXTFUNCS_CPN_HAS_SSSE3
+	if (RP_CPU_HasSSSE3()) {
+		return cp1252_to_utf16_ssse3(wcs, str, len);
+	} else
+#endif /* TEXTFUNCS_CPN_HAS_SSSE3 */
+	{
+		return cp1252_to_utf16_cpp(wcs, str, len);
+	}
+}
+
+/**
+ * Convert cp932 (Shift-JIS) text to UTF-16.
+ * Standard version using regular C++ code.
+ * @param wcs	[out] Output buffer. (Must have room for at least len characters.)
+ * @param str	[in] cp932 text.
+ * @param len	[in] Length of str, in bytes.
+ * @return Number of UTF-16 characters written, or -1 if the text is invalid.
+ */
+int cp932_to_utf16_cpp(char16_t *wcs, const char *str, size_t len);
+
+#ifdef TEXTFUNCS_CPN_HAS_SSE2
+/**
+ * Convert cp932 (Shift-JIS) text to UTF-16.
+ * SSE2-optimized version.
+ * Blocks of single-byte characters are converted 16 bytes at a time.
+ * @param wcs	[out] Output buffer. (Must have room for at least len characters.)
+ * @param str	[in] cp932 text.
+ * @param len	[in] Length of str, in bytes.
+ * @return Number of UTF-16 characters written, or -1 if the text is invalid.
+ */
+int cp932_to_utf16_sse2(char16_t *wcs, const char *str, size_t len);
+#endif /* TEXTFUNCS_CPN_HAS_SSE2 */
+
+/**
+ * Convert cp932 (Shift-JIS) text to UTF-16.
+ * @param wcs	[out] Output buffer. (Must have room for at least len characters.)
+ * @param str	[in] cp932 text.
+ * @param len	[in] Length of str, in bytes.
+ * @return Number of UTF-16 characters written, or -1 if the text is invalid.
+ */
+static inline int cp932_to_utf16_buf(char16_t *wcs, const char *str, size_t len)
+{
+#ifdef TEXTFUNCS_CPN_ALWAYS_HAS_SSE2
+	// amd64 always has SSE2.
+	return cp932_to_utf16_sse2(wcs, str, len);
+#else /* !TEXTFUNCS_CPN_ALWAYS_HAS_SSE2 */
+# ifdef TEXTFUNCS_CPN_HAS_SSE2
+	if (RP_CPU_HasSSE2()) {
+		return cp932_to_utf16_sse2(wcs, str, len);
+	} else
+# endif /* TEXTFUNCS_CPN_HAS_SSE2 */
+	{
+		return cp932_to_utf16_cpp(wcs, str, len);
+	}
+#endif /* TEXTFUNCS_CPN_ALWAYS_HAS_SSE2 */
+}
+
+/** Built-in code page conversion. **/
+
+/**
+ * Convert 8-bit text to UTF-16 using the built-in decoders.
+ *
+ * Supported code pages:
+ * - 932: If the text is invalid and TEXTCONV_FLAG_CP1252_FALLBACK
+ *        is set, cp1252 will be used instead.
+ * - 1252
+ * - CP_LATIN1
+ *
+ * @param out	[out] Output string.
+ * @param cp	[in] Code page number.
+ * @param str	[in] 8-bit text.
+ * @param len	[in] Length of str, in bytes.
+ * @param flags	[in] Flags. (See TextConv_Flags_e.)
+ * @return True if the text was converted; false if the system converter should be used.
+ */
+bool cpN_to_utf16_builtin(std::u16string &out, unsigned int cp, const char *str, int len, unsigned int flags);
+
+/**
+ * Convert 8-bit text to UTF-8 using the built-in decoders.
+ * See cpN_to_utf16_builtin() for supported code pages.
+ *
+ * @param out	[out] Output string.
+ * @param cp	[in] Code page number.
+ * @param str	[in] 8-bit text.
+ * @param len	[in] Length of str, in bytes.
+ * @param flags	[in] Flags. (See TextConv_Flags_e.)
+ * @return True if the text was converted; false if the system converter should be used.
+ */
+bool cpN_to_utf8_builtin(std::string &out, unsigned int cp, const char *str, int len, unsigned int flags);
+
+}
+
+#endif /* __ROMPROPERTIES_LIBRPBASE_TEXTFUNCS_CPN_HPP__ */
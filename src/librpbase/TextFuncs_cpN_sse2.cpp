@@ -0,0 +1,124 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * TextFuncs_cpN_sse2.cpp: Built-in code page decoders.                    *
+ * SSE2-optimized version.                                                 *
+ *                                                                         *
+ * Copyright (c) 2009-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+
+#include "TextFuncs_cpN.hpp"
+
+// SSE2 intrinsics.
+#include <emmintrin.h>
+#ifdef _MSC_VER
+# include <intrin.h>
+#endif
+
+namespace LibRpBase {
+
+/**
+ * Get the index of the lowest set bit.
+ * @param mask Mask. (Must not be 0.)
+ * @return Index of the lowest set bit.
+ */
+static inline unsigned int lowest_bit(unsigned int mask)
+{
+#ifdef _MSC_VER
+	unsigned long idx;
+	_BitScanForward(&idx, mask);
+	return static_cast<unsigned int>(idx);
+#else /* !_MSC_VER */
+	return static_cast<unsigned int>(__builtin_ctz(mask));
+#endif /* _MSC_VER */
+}
+
+/**
+ * Convert cp932 (Shift-JIS) text to UTF-16.
+ * SSE2-optimized version.
+ * Blocks of single-byte characters are converted 16 bytes at a time.
+ * @param wcs	[out] Output buffer. (Must have room for at least len characters.)
+ * @param str	[in] cp932 text.
+ * @param len	[in] Length of str, in bytes.
+ * @return Number of UTF-16 characters written, or -1 if the text is invalid.
+ */
+int cp932_to_utf16_sse2(char16_t *wcs, const char *str, size_t len)
+{
+	const __m128i all_ones = _mm_set1_epi8(-1);
+	const __m128i kana_min = _mm_set1_epi8(static_cast<char>(0xA1));
+	const __m128i kana_range = _mm_set1_epi8(0xDF - 0xA1);
+	const __m128i kana_lo_add = _mm_set1_epi8(static_cast<char>(0xC0));
+
+	const char *p = str;
+	const char *const p_end = str + len;
+	char16_t *const wcs_start = wcs;
+
+	while (p_end - p >= 16) {
+		const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+		// ASCII: 0x00-0x7F
+		const __m128i is_ascii = _mm_cmpgt_epi8(data, all_ones);
+		// Halfwidth katakana: 0xA1-0xDF
+		const __m128i kana_ofs = _mm_sub_epi8(data, kana_min);
+		const __m128i is_kana = _mm_cmpeq_epi8(_mm_min_epu8(kana_ofs, kana_range), kana_ofs);
+
+		// Convert the single-byte characters.
+		// Halfwidth katakana are mapped to U+FF61-U+FF9F: (chr + 0xFEC0)
+		// NOTE: All 16 characters are written, but only the ones before
+		// the first double-byte character are kept. This is safe because
+		// the output buffer has room for at least 16 more characters.
+		const __m128i lo = _mm_add_epi8(data, _mm_and_si128(is_kana, kana_lo_add));
+		__m128i *const pOut = reinterpret_cast<__m128i*>(wcs);
+		_mm_storeu_si128(&pOut[0], _mm_unpacklo_epi8(lo, is_kana));
+		_mm_storeu_si128(&pOut[1], _mm_unpackhi_epi8(lo, is_kana));
+
+		const unsigned int mask = static_cast<unsigned int>(
+			_mm_movemask_epi8(_mm_or_si128(is_ascii, is_kana)));
+		if (mask == 0xFFFF) {
+			// All single-byte characters.
+			p += 16;
+			wcs += 16;
+			continue;
+		}
+
+		// Skip the single-byte characters, then decode
+		// the double-byte character using the scalar decoder.
+		const unsigned int n = lowest_bit(~mask);
+		p += n;
+		wcs += n;
+		if (p_end - p < 2) {
+			// Not enough bytes left.
+			break;
+		}
+		const int ret = cp932_to_utf16_cpp(wcs, p, 2);
+		if (ret < 0) {
+			// Invalid character.
+			return -1;
+		}
+		p += 2;
+		wcs += ret;
+	}
+
+	// Remaining bytes.
+	const int ret = cp932_to_utf16_cpp(wcs, p, p_end - p);
+	if (ret < 0) {
+		// Invalid character.
+		return -1;
+	}
+	return static_cast<int>(wcs - wcs_start) + ret;
+}
+
+}
@@ -0,0 +1,95 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * TextFuncs_cpN_ssse3.cpp: Built-in code page decoders.                   *
+ * SSSE3-optimized version.                                                *
+ *                                                                         *
+ * Copyright (c) 2009-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+
+#include "TextFuncs_cpN.hpp"
+
+// SSSE3 intrinsics.
+#include <tmmintrin.h>
+
+namespace LibRpBase {
+
+/**
+ * Convert cp1252 text to UTF-16.
+ * SSSE3-optimized version.
+ * @param wcs	[out] Output buffer. (Must have room for at least len characters.)
+ * @param str	[in] cp1252 text.
+ * @param len	[in] Length of str, in bytes.
+ * @return Number of UTF-16 characters written. (Always len.)
+ */
+size_t cp1252_to_utf16_ssse3(char16_t *wcs, const char *str, size_t len)
+{
+	// Split the 0x80-0x9F table into low and high bytes
+	// so each half can be looked up using pshufb.
+	const __m128i deinterleave = _mm_setr_epi8(0,2,4,6,8,10,12,14, 1,3,5,7,9,11,13,15);
+	const __m128i *const pTbl = reinterpret_cast<const __m128i*>(cp1252_hi_tbl);
+	const __m128i t0 = _mm_shuffle_epi8(_mm_loadu_si128(&pTbl[0]), deinterleave);
+	const __m128i t1 = _mm_shuffle_epi8(_mm_loadu_si128(&pTbl[1]), deinterleave);
+	const __m128i t2 = _mm_shuffle_epi8(_mm_loadu_si128(&pTbl[2]), deinterleave);
+	const __m128i t3 = _mm_shuffle_epi8(_mm_loadu_si128(&pTbl[3]), deinterleave);
+	const __m128i lut8_lo = _mm_unpacklo_epi64(t0, t1);
+	const __m128i lut8_hi = _mm_unpackhi_epi64(t0, t1);
+	const __m128i lut9_lo = _mm_unpacklo_epi64(t2, t3);
+	const __m128i lut9_hi = _mm_unpackhi_epi64(t2, t3);
+
+	const __m128i nybble_mask = _mm_set1_epi8(0x0F);
+	const __m128i hi_nybble_mask = _mm_set1_epi8(static_cast<char>(0xF0));
+	const __m128i hi_8x = _mm_set1_epi8(static_cast<char>(0x80));
+	const __m128i hi_9x = _mm_set1_epi8(static_cast<char>(0x90));
+	const __m128i zero = _mm_setzero_si128();
+
+	size_t i = len;
+	for (; i >= 16; i -= 16, str += 16, wcs += 16) {
+		const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str));
+		__m128i *const pOut = reinterpret_cast<__m128i*>(wcs);
+
+		// Characters 0x80-0x9F are looked up in the table.
+		// Everything else is identical to Latin-1.
+		const __m128i hi_nybble = _mm_and_si128(data, hi_nybble_mask);
+		const __m128i is_8x = _mm_cmpeq_epi8(hi_nybble, hi_8x);
+		const __m128i is_9x = _mm_cmpeq_epi8(hi_nybble, hi_9x);
+		const __m128i is_tbl = _mm_or_si128(is_8x, is_9x);
+		if (_mm_movemask_epi8(is_tbl) == 0) {
+			// No table lookups are needed.
+			_mm_storeu_si128(&pOut[0], _mm_unpacklo_epi8(data, zero));
+			_mm_storeu_si128(&pOut[1], _mm_unpackhi_epi8(data, zero));
+			continue;
+		}
+
+		const __m128i idx = _mm_and_si128(data, nybble_mask);
+		const __m128i tbl_lo = _mm_or_si128(
+			_mm_and_si128(is_8x, _mm_shuffle_epi8(lut8_lo, idx)),
+			_mm_and_si128(is_9x, _mm_shuffle_epi8(lut9_lo, idx)));
+		const __m128i tbl_hi = _mm_or_si128(
+			_mm_and_si128(is_8x, _mm_shuffle_epi8(lut8_hi, idx)),
+			_mm_and_si128(is_9x, _mm_shuffle_epi8(lut9_hi, idx)));
+
+		const __m128i lo = _mm_or_si128(_mm_andnot_si128(is_tbl, data), tbl_lo);
+		_mm_storeu_si128(&pOut[0], _mm_unpacklo_epi8(lo, tbl_hi));
+		_mm_storeu_si128(&pOut[1], _mm_unpackhi_epi8(lo, tbl_hi));
+	}
+
+	// Remaining bytes.
+	cp1252_to_utf16_cpp(wcs, str, i);
+	return len;
+}
+
+}
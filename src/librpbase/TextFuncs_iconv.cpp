@@ -21,6 +21,8 @@
 #include "config.librpbase.h"
 #include "TextFuncs.hpp"
 #include "TextFuncs_NULL.hpp"
+#include "TextFuncs_ascii.hpp"
+#include "TextFuncs_cpN.hpp"
 
 // C includes. (C++ namespace)
 #include <cstdio>
@@ -43,6 +45,7 @@
 #include <iconv.h>
 
 // C includes.
+#include <pthread.h>
 #include <stdlib.h>
 
 // C includes. (C++ namespace)
@@ -57,6 +60,131 @@ using std::u16string;
 
 namespace LibRpBase {
 
+/** iconv descriptor cache. **/
+
+// Parsers convert many short strings, so opening a new
+// iconv descriptor for every conversion is expensive.
+// Each thread has its own cache, since iconv descriptors
+// have conversion state and can't be shared between threads.
+
+// Maximum number of cached descriptors per thread.
+#define ICONV_CACHE_MAX 8
+
+typedef struct _IconvCacheEntry {
+	char src_charset[24];
+	char dest_charset[24];
+	iconv_t cd;
+} IconvCacheEntry;
+
+typedef struct _IconvCache {
+	unsigned int count;	// Number of valid entries.
+	unsigned int next;	// Next entry to replace if the cache is full.
+	IconvCacheEntry entries[ICONV_CACHE_MAX];
+} IconvCache;
+
+// pthread_once() control variable.
+static pthread_once_t iconv_cache_once_control = PTHREAD_ONCE_INIT;
+// Thread-specific data key for the iconv cache.
+// Only valid if iconv_cache_key_ok is true.
+static pthread_key_t iconv_cache_key;
+static bool iconv_cache_key_ok = false;
+
+/**
+ * Free an iconv cache.
+ * Called by pthreads when a thread exits.
+ * @param ptr IconvCache.
+ */
+static void iconv_cache_free(void *ptr)
+{
+	IconvCache *const cache = static_cast<IconvCache*>(ptr);
+	for (unsigned int i = 0; i < cache->count; i++) {
+		iconv_close(cache->entries[i].cd);
+	}
+	free(cache);
+}
+
+/**
+ * Initialize the iconv cache key.
+ * Called by pthread_once().
+ */
+static void iconv_cache_init(void)
+{
+	iconv_cache_key_ok = (pthread_key_create(&iconv_cache_key, iconv_cache_free) == 0);
+}
+
+/**
+ * Open an iconv descriptor using the current thread's cache.
+ *
+ * If the descriptor is cached, its conversion state is reset.
+ * Otherwise, a new descriptor is opened and added to the cache.
+ *
+ * @param src_charset	[in] Source character set.
+ * @param dest_charset	[in] Destination character set.
+ * @param pIsCached	[out] True if the descriptor is owned by the cache;
+ *                	      false if the caller must close it with iconv_close().
+ * @return iconv descriptor, or (iconv_t)(-1) on error.
+ */
+static iconv_t iconv_cache_open(const char *src_charset, const char *dest_charset, bool *pIsCached)
+{
+	*pIsCached = false;
+	pthread_once(&iconv_cache_once_control, iconv_cache_init);
+
+	// Character set names that don't fit in the cache entry aren't cached.
+	IconvCache *cache = nullptr;
+	if (iconv_cache_key_ok &&
+	    strlen(src_charset) < sizeof(cache->entries[0].src_charset) &&
+	    strlen(dest_charset) < sizeof(cache->entries[0].dest_charset))
+	{
+		cache = static_cast<IconvCache*>(pthread_getspecific(iconv_cache_key));
+		if (!cache) {
+			cache = static_cast<IconvCache*>(calloc(1, sizeof(*cache)));
+			if (cache && pthread_setspecific(iconv_cache_key, cache) != 0) {
+				free(cache);
+				cache = nullptr;
+			}
+		}
+	}
+
+	if (cache) {
+		// Check for an existing descriptor.
+		for (unsigned int i = 0; i < cache->count; i++) {
+			IconvCacheEntry *const entry = &cache->entries[i];
+			if (!strcmp(entry->src_charset, src_charset) &&
+			    !strcmp(entry->dest_charset, dest_charset))
+			{
+				// Found a cached descriptor.
+				// Reset its conversion state.
+				iconv(entry->cd, nullptr, nullptr, nullptr, nullptr);
+				*pIsCached = true;
+				return entry->cd;
+			}
+		}
+	}
+
+	// Open a new iconv descriptor.
+	iconv_t cd = iconv_open(dest_charset, src_charset);
+	if (cd == (iconv_t)(-1) || !cache) {
+		// Error opening iconv, or the cache isn't available.
+		return cd;
+	}
+
+	// Add the descriptor to the cache.
+	IconvCacheEntry *entry;
+	if (cache->count < ICONV_CACHE_MAX) {
+		entry = &cache->entries[cache->count++];
+	} else {
+		// Cache is full. Replace an existing entry.
+		entry = &cache->entries[cache->next];
+		cache->next = (cache->next + 1) % ICONV_CACHE_MAX;
+		iconv_close(entry->cd);
+	}
+	strcpy(entry->src_charset, src_charset);
+	strcpy(entry->dest_charset, dest_charset);
+	entry->cd = cd;
+	*pIsCached = true;
+	return cd;
+}
+
 /** OS-specific text conversion functions. **/
 
 /**
@@ -89,8 +217,8 @@ static char *rp_iconv(const char *src, int len,
 	// * http://www.codase.com/search/call?name=iconv
 
 	// Open an iconv descriptor.
-	iconv_t cd;
-	cd = iconv_open(dest_charset, src_charset);
+	bool isCached;
+	iconv_t cd = iconv_cache_open(src_charset, dest_charset, &isCached);
 	if (cd == (iconv_t)(-1)) {
 		// Error opening iconv.
 		return nullptr;
@@ -121,8 +249,10 @@ static char *rp_iconv(const char *src, int len,
 		}
 	}
 
-	// Close the iconv descriptor.
-	iconv_close(cd);
+	// Close the iconv descriptor if it isn't cached.
+	if (!isCached) {
+		iconv_close(cd);
+	}
 
 	if (success) {
 		// The string was converted successfully.
@@ -174,6 +304,29 @@ static inline void codePageToEncName(char *enc_name, size_t len, unsigned int cp
 	}
 }
 
+/**
+ * Check if a code page is a superset of 7-bit ASCII.
+ * ASCII text in these code pages doesn't need to be converted.
+ * @param cp Code page number.
+ * @return True if the code page is a superset of ASCII; false if not.
+ */
+static inline bool isAsciiCompatible(unsigned int cp)
+{
+	switch (cp) {
+		case CP_ACP:
+		case CP_LATIN1:
+		case CP_UTF8:
+		case 932: case 936: case 949: case 950:
+		case 1250: case 1251: case 1252: case 1253:
+		case 1254: case 1255: case 1256: case 1257:
+			return true;
+		default:
+			// NOTE: cp1258 is excluded because iconv may
+			// buffer characters for combining diacritics.
+			return false;
+	}
+}
+
 /**
  * Convert 8-bit text to UTF-8.
  * Trailing NULL bytes will be removed.
@@ -189,15 +342,24 @@ static inline void codePageToEncName(char *enc_name, size_t len, unsigned int cp
 string cpN_to_utf8(unsigned int cp, const char *str, int len, unsigned int flags)
 {
 	len = check_NULL_terminator(str, len);
+	if (isAsciiCompatible(cp) && isAscii(str, len)) {
+		// ASCII text doesn't need to be converted.
+		return string(str, len);
+	}
+
+	// Use the built-in decoders if possible.
+	string ret;
+	if (cpN_to_utf8_builtin(ret, cp, str, len, flags)) {
+		return ret;
+	}
 
 	// Get the encoding name for the primary code page.
-	char cp_name[20];
+	char cp_name[32];
 	codePageToEncName(cp_name, sizeof(cp_name), cp, flags);
 
 	// Attempt to convert the text to UTF-8.
 	// NOTE: "//IGNORE" sometimes doesn't work, so we won't
 	// check for TEXTCONV_FLAG_CP1252_FALLBACK here.
-	string ret;
 	char *mbs = reinterpret_cast<char*>(rp_iconv((char*)str, len*sizeof(*str), cp_name, "UTF-8"));
 	if (!mbs /*&& (flags & TEXTCONV_FLAG_CP1252_FALLBACK)*/) {
 		// Try cp1252 fallback.
@@ -250,15 +412,24 @@ string cpN_to_utf8(unsigned int cp, const char *str, int len, unsigned int flags
 u16string cpN_to_utf16(unsigned int cp, const char *str, int len, unsigned int flags)
 {
 	len = check_NULL_terminator(str, len);
+	if (isAsciiCompatible(cp) && isAscii(str, len)) {
+		// ASCII text doesn't need to be converted.
+		return u16string(str, str + len);
+	}
+
+	// Use the built-in decoders if possible.
+	u16string ret;
+	if (cpN_to_utf16_builtin(ret, cp, str, len, flags)) {
+		return ret;
+	}
 
 	// Get the encoding name for the primary code page.
-	char cp_name[20];
+	char cp_name[32];
 	codePageToEncName(cp_name, sizeof(cp_name), cp, flags);
 
 	// Attempt to convert the text to UTF-16.
 	// NOTE: "//IGNORE" sometimes doesn't work, so we won't
 	// check for TEXTCONV_FLAG_CP1252_FALLBACK here.
-	u16string ret;
 	char16_t *wcs = reinterpret_cast<char16_t*>(rp_iconv((char*)str, len*sizeof(*str), cp_name, RP_ICONV_UTF16_ENCODING));
 	if (!wcs /*&& (flags & TEXTCONV_FLAG_CP1252_FALLBACK)*/) {
 		// Try cp1252 fallback.
@@ -308,9 +479,13 @@ u16string cpN_to_utf16(unsigned int cp, const char *str, int len, unsigned int f
 string utf8_to_cpN(unsigned int cp, const char *str, int len)
 {
 	len = check_NULL_terminator(str, len);
+	if (isAsciiCompatible(cp) && isAscii(str, len)) {
+		// ASCII text doesn't need to be converted.
+		return string(str, len);
+	}
 
 	// Get the encoding name for the primary code page.
-	char cp_name[20];
+	char cp_name[32];
 	codePageToEncName(cp_name, sizeof(cp_name), cp, TEXTCONV_FLAG_CP1252_FALLBACK);
 
 	// Attempt to convert the text from UTF-8.
@@ -340,7 +515,7 @@ string utf16_to_cpN(unsigned int cp, const char16_t *wcs, int len)
 	len = check_NULL_terminator(wcs, len);
 
 	// Get the encoding name for the primary code page.
-	char cp_name[20];
+	char cp_name[32];
 	const unsigned int flags = (cp == CP_UTF8 ? 0 : TEXTCONV_FLAG_CP1252_FALLBACK);
 	codePageToEncName(cp_name, sizeof(cp_name), cp, flags);
 
@@ -354,48 +529,4 @@ string utf16_to_cpN(unsigned int cp, const char16_t *wcs, int len)
 	return ret;
 }
 
-/** Specialized UTF-16 conversion functions. **/
-
-/**
- * Convert UTF-16LE text to UTF-8.
- * Trailing NULL bytes will be removed.
- * @param wcs	[in] UTF-16LE text.
- * @param len	[in] Length of wcs, in characters. (-1 for NULL-terminated string)
- * @return UTF-8 string.
- */
-string utf16le_to_utf8(const char16_t *wcs, int len)
-{
-	len = check_NULL_terminator(wcs, len);
-
-	// Attempt to convert the text from UTF-16LE to UTF-8.
-	string ret;
-	char *mbs = reinterpret_cast<char*>(rp_iconv((char*)wcs, len*sizeof(*wcs), "UTF-16LE", "UTF-8"));
-	if (mbs) {
-		ret.assign(mbs);
-		free(mbs);
-	}
-	return ret;
-}
-
-/**
- * Convert UTF-16BE text to UTF-8.
- * Trailing NULL bytes will be removed.
- * @param wcs	[in] UTF-16BE text.
- * @param len	[in] Length of wcs, in characters. (-1 for NULL-terminated string)
- * @return UTF-8 string.
- */
-string utf16be_to_utf8(const char16_t *wcs, int len)
-{
-	len = check_NULL_terminator(wcs, len);
-
-	// Attempt to convert the text from UTF-16BE to UTF-8.
-	string ret;
-	char *mbs = reinterpret_cast<char*>(rp_iconv((char*)wcs, len*sizeof(*wcs), "UTF-16BE", "UTF-8"));
-	if (mbs) {
-		ret.assign(mbs);
-		free(mbs);
-	}
-	return ret;
-}
-
 }
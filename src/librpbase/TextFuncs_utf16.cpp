@@ -0,0 +1,100 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * TextFuncs_utf16.cpp: UTF-16 to UTF-8 conversion.                        *
+ *                                                                         *
+ * Copyright (c) 2009-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+
+#include "TextFuncs_utf16.hpp"
+#include "byteswap.h"
+
+// C includes.
+#include <stdint.h>
+
+namespace LibRpBase {
+
+/**
+ * Convert UTF-16 text to UTF-8.
+ * Standard version using regular C++ code.
+ * @tparam bswap If true, wcs is byteswapped relative to the host.
+ * @param mbs	[out] Output buffer. (Must have room for at least len*3 bytes.)
+ * @param wcs	[in] UTF-16 text.
+ * @param len	[in] Length of wcs, in characters.
+ * @return Number of bytes written.
+ */
+template<bool bswap>
+static inline size_t T_utf16_to_utf8_cpp(char *mbs, const char16_t *wcs, size_t len)
+{
+	uint8_t *p = reinterpret_cast<uint8_t*>(mbs);
+	const char16_t *const wcs_end = wcs + len;
+
+	while (wcs < wcs_end) {
+		const char16_t wchr = (bswap ? __swab16(*wcs) : *wcs);
+		wcs++;
+
+		if (wchr < 0x0080) {
+			*p++ = static_cast<uint8_t>(wchr);
+		} else if (wchr < 0x0800) {
+			*p++ = 0xC0 | (wchr >> 6);
+			*p++ = 0x80 | (wchr & 0x3F);
+		} else if ((wchr & 0xF800) != 0xD800) {
+			*p++ = 0xE0 | (wchr >> 12);
+			*p++ = 0x80 | ((wchr >> 6) & 0x3F);
+			*p++ = 0x80 | (wchr & 0x3F);
+		} else {
+			// Surrogate pair.
+			const char16_t wchr2 = (wcs < wcs_end
+				? (bswap ? __swab16(*wcs) : *wcs)
+				: 0);
+			if (wchr >= 0xDC00 || (wchr2 & 0xFC00) != 0xDC00) {
+				// Unpaired surrogate.
+				// Replace it with U+FFFD.
+				*p++ = 0xEF;
+				*p++ = 0xBF;
+				*p++ = 0xBD;
+				continue;
+			}
+			wcs++;
+
+			const uint32_t cp = 0x10000 + (((wchr & 0x3FF) << 10) | (wchr2 & 0x3FF));
+			*p++ = 0xF0 | (cp >> 18);
+			*p++ = 0x80 | ((cp >> 12) & 0x3F);
+			*p++ = 0x80 | ((cp >> 6) & 0x3F);
+			*p++ = 0x80 | (cp & 0x3F);
+		}
+	}
+
+	return p - reinterpret_cast<uint8_t*>(mbs);
+}
+
+/**
+ * Convert UTF-16 text to UTF-8.
+ * Standard version using regular C++ code.
+ * @param mbs	[out] Output buffer. (Must have room for at least len*3 bytes.)
+ * @param wcs	[in] UTF-16 text.
+ * @param len	[in] Length of wcs, in characters.
+ * @param bswap	[in] If true, wcs is byteswapped relative to the host.
+ * @return Number of bytes written.
+ */
+size_t utf16_to_utf8_cpp(char *mbs, const char16_t *wcs, size_t len, bool bswap)
+{
+	return (bswap
+		? T_utf16_to_utf8_cpp<true>(mbs, wcs, len)
+		: T_utf16_to_utf8_cpp<false>(mbs, wcs, len));
+}
+
+}
@@ -0,0 +1,97 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * TextFuncs_utf16.hpp: UTF-16 to UTF-8 conversion.                        *
+ *                                                                         *
+ * Copyright (c) 2009-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+
+#ifndef __ROMPROPERTIES_LIBRPBASE_TEXTFUNCS_UTF16_HPP__
+#define __ROMPROPERTIES_LIBRPBASE_TEXTFUNCS_UTF16_HPP__
+
+#include "common.h"
+#include "cpu_dispatch.h"
+
+// C includes.
+#include <stddef.h>
+
+#if defined(RP_CPU_I386) || defined(RP_CPU_AMD64)
+# include "cpuflags_x86.h"
+# define TEXTFUNCS_UTF16_HAS_SSE2 1
+#endif
+#ifdef RP_CPU_AMD64
+# define TEXTFUNCS_UTF16_ALWAYS_HAS_SSE2 1
+#endif
+
+namespace LibRpBase {
+
+/** Internal algorithms. **/
+// NOTE: These are public to allow for unit tests and benchmarking.
+// Unpaired surrogates are converted to U+FFFD.
+
+/**
+ * Convert UTF-16 text to UTF-8.
+ * Standard version using regular C++ code.
+ * @param mbs	[out] Output buffer. (Must have room for at least len*3 bytes.)
+ * @param wcs	[in] UTF-16 text.
+ * @param len	[in] Length of wcs, in characters.
+ * @param bswap	[in] If true, wcs is byteswapped relative to the host.
+ * @return Number of bytes written.
+ */
+size_t utf16_to_utf8_cpp(char *mbs, const char16_t *wcs, size_t len, bool bswap);
+
+#ifdef TEXTFUNCS_UTF16_HAS_SSE2
+/**
+ * Convert UTF-16 text to UTF-8.
+ * SSE2-optimized version.
+ * ASCII characters are converted 8 characters at a time.
+ * @param mbs	[out] Output buffer. (Must have room for at least len*3 bytes.)
+ * @param wcs	[in] UTF-16 text.
+ * @param len	[in] Length of wcs, in characters.
+ * @param bswap	[in] If true, wcs is byteswapped relative to the host.
+ * @return Number of bytes written.
+ */
+size_t utf16_to_utf8_sse2(char *mbs, const char16_t *wcs, size_t len, bool bswap);
+#endif /* TEXTFUNCS_UTF16_HAS_SSE2 */
+
+/**
+ * Convert UTF-16 text to UTF-8.
+ * @param mbs	[out] Output buffer. (Must have room for at least len*3 bytes.)
+ * @param wcs	[in] UTF-16 text.
+ * @param len	[in] Length of wcs, in characters.
+ * @param bswap	[in] If true, wcs is byteswapped relative to the host.
+ * @return Number of bytes written.
+ */
+static inline size_t utf16_to_utf8_buf(char *mbs, const char16_t *wcs, size_t len, bool bswap)
+{
+#ifdef TEXTFUNCS_UTF16_ALWAYS_HAS_SSE2
+	// amd64 always has SSE2.
+	return utf16_to_utf8_sse2(mbs, wcs, len, bswap);
+#else /* !TEXTFUNCS_UTF16_ALWAYS_HAS_SSE2 */
+# ifdef TEXTFUNCS_UTF16_HAS_SSE2
+	if (RP_CPU_HasSSE2()) {
+		return utf16_to_utf8_sse2(mbs, wcs, len, bswap);
+	} else
+# endif /* TEXTFUNCS_UTF16_HAS_SSE2 */
+	{
+		return utf16_to_utf8_cpp(mbs, wcs, len, bswap);
+	}
+#endif /* TEXTFUNCS_UTF16_ALWAYS_HAS_SSE2 */
+}
+
+}
+
+#endif /* __ROMPROPERTIES_LIBRPBASE_TEXTFUNCS_UTF16_HPP__ */
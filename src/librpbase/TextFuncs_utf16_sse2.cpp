@@ -0,0 +1,133 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * TextFuncs_utf16_sse2.cpp: UTF-16 to UTF-8 conversion.                   *
+ * SSE2-optimized version.                                                 *
+ *                                                                         *
+ * Copyright (c) 2009-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+
+#include "TextFuncs_utf16.hpp"
+#include "byteswap.h"
+
+// SSE2 intrinsics.
+#include <emmintrin.h>
+#ifdef _MSC_VER
+# include <intrin.h>
+#endif
+
+namespace LibRpBase {
+
+/**
+ * Get the index of the lowest set bit.
+ * @param mask Mask. (Must not be 0.)
+ * @return Index of the lowest set bit.
+ */
+static inline unsigned int lowest_bit(unsigned int mask)
+{
+#ifdef _MSC_VER
+	unsigned long idx;
+	_BitScanForward(&idx, mask);
+	return static_cast<unsigned int>(idx);
+#else /* !_MSC_VER */
+	return static_cast<unsigned int>(__builtin_ctz(mask));
+#endif /* _MSC_VER */
+}
+
+/**
+ * Convert UTF-16 text to UTF-8.
+ * SSE2-optimized version.
+ * ASCII characters are converted 8 characters at a time.
+ * @tparam bswap If true, wcs is byteswapped relative to the host.
+ * @param mbs	[out] Output buffer. (Must have room for at least len*3 bytes.)
+ * @param wcs	[in] UTF-16 text.
+ * @param len	[in] Length of wcs, in characters.
+ * @return Number of bytes written.
+ */
+template<bool bswap>
+static inline size_t T_utf16_to_utf8_sse2(char *mbs, const char16_t *wcs, size_t len)
+{
+	const __m128i non_ascii_mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+	const __m128i zero = _mm_setzero_si128();
+
+	char *p = mbs;
+	const char16_t *const wcs_end = wcs + len;
+
+	while (wcs_end - wcs >= 8) {
+		__m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(wcs));
+		if (bswap) {
+			data = _mm_or_si128(_mm_slli_epi16(data, 8), _mm_srli_epi16(data, 8));
+		}
+
+		// Pack the characters to 8-bit. Non-ASCII characters will be
+		// overwritten later, so saturation doesn't matter here.
+		// NOTE: The output buffer always has room for 8 more bytes.
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packus_epi16(data, data));
+
+		const __m128i is_ascii = _mm_cmpeq_epi16(_mm_and_si128(data, non_ascii_mask), zero);
+		const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(is_ascii));
+		if (mask == 0xFFFF) {
+			// All ASCII.
+			p += 8;
+			wcs += 8;
+			continue;
+		}
+
+		// Keep the ASCII characters before the first non-ASCII character.
+		// The next block will start with the non-ASCII character.
+		const unsigned int n_ascii = lowest_bit(~mask) / 2;
+		if (n_ascii > 0) {
+			p += n_ascii;
+			wcs += n_ascii;
+			continue;
+		}
+
+		// Block starts with a non-ASCII character.
+		// Convert this block using the scalar code.
+		// If the last character is a high surrogate, include the
+		// next character so the surrogate pair isn't split.
+		size_t n = 8;
+		const char16_t last = (bswap ? __swab16(wcs[7]) : wcs[7]);
+		if ((last & 0xFC00) == 0xD800 && wcs_end - wcs > 8) {
+			n = 9;
+		}
+		p += utf16_to_utf8_cpp(p, wcs, n, bswap);
+		wcs += n;
+	}
+
+	// Remaining characters.
+	p += utf16_to_utf8_cpp(p, wcs, wcs_end - wcs, bswap);
+	return p - mbs;
+}
+
+/**
+ * Convert UTF-16 text to UTF-8.
+ * SSE2-optimized version.
+ * ASCII characters are converted 8 characters at a time.
+ * @param mbs	[out] Output buffer. (Must have room for at least len*3 bytes.)
+ * @param wcs	[in] UTF-16 text.
+ * @param len	[in] Length of wcs, in characters.
+ * @param bswap	[in] If true, wcs is byteswapped relative to the host.
+ * @return Number of bytes written.
+ */
+size_t utf16_to_utf8_sse2(char *mbs, const char16_t *wcs, size_t len, bool bswap)
+{
+	return (bswap
+		? T_utf16_to_utf8_sse2<true>(mbs, wcs, len)
+		: T_utf16_to_utf8_sse2<false>(mbs, wcs, len));
+}
+
+}
@@ -21,6 +21,7 @@
 #include "config.librpbase.h"
 #include "TextFuncs.hpp"
 #include "TextFuncs_NULL.hpp"
+#include "TextFuncs_cpN.hpp"
 
 #ifndef _WIN32
 # error TextFuncs_win32.cpp is for Windows only.
@@ -156,6 +157,13 @@ static char *W32U_UTF16_to_mbs(const char16_t *wcs, int cchWcs,
 string cpN_to_utf8(unsigned int cp, const char *str, int len, unsigned int flags)
 {
 	len = check_NULL_terminator(str, len);
+
+	// Use the built-in decoders if possible.
+	string ret;
+	if (cpN_to_utf8_builtin(ret, cp, str, len, flags)) {
+		return ret;
+	}
+
 	DWORD dwFlags = 0;
 	if (flags & TEXTCONV_FLAG_CP1252_FALLBACK) {
 		// Fallback is enabled.
@@ -164,7 +172,6 @@ string cpN_to_utf8(unsigned int cp, const char *str, int len, unsigned int flags
 	}
 
 	// Convert from `cp` to UTF-16.
-	string ret;
 	int cchWcs;
 	char16_t *wcs = W32U_mbs_to_UTF16(str, len, cp, &cchWcs, dwFlags);
 	if (!wcs || cchWcs == 0) {
@@ -207,6 +214,13 @@ string cpN_to_utf8(unsigned int cp, const char *str, int len, unsigned int flags
 u16string cpN_to_utf16(unsigned int cp, const char *str, int len, unsigned int flags)
 {
 	len = check_NULL_terminator(str, len);
+
+	// Use the built-in decoders if possible.
+	u16string ret;
+	if (cpN_to_utf16_builtin(ret, cp, str, len, flags)) {
+		return ret;
+	}
+
 	DWORD dwFlags = 0;
 	if (flags & TEXTCONV_FLAG_CP1252_FALLBACK) {
 		// Fallback is enabled.
@@ -215,7 +229,6 @@ u16string cpN_to_utf16(unsigned int cp, const char *str, int len, unsigned int f
 	}
 
 	// Convert from `cp` to UTF-16.
-	u16string ret;
 	int cchWcs;
 	char16_t *wcs = W32U_mbs_to_UTF16(str, len, cp, &cchWcs, dwFlags);
 	if (!wcs || cchWcs == 0) {
@@ -306,55 +319,4 @@ string utf16_to_cpN(unsigned int cp, const char16_t *wcs, int len)
 	return ret;
 }
 
-/** Specialized UTF-16 conversion functions. **/
-
-/**
- * Convert UTF-16LE text to UTF-8.
- * Trailing NULL bytes will be removed.
- * @param wcs	[in] UTF-16LE text.
- * @param len	[in] Length of wcs, in characters. (-1 for NULL-terminated string)
- * @return UTF-8 string.
- */
-string utf16le_to_utf8(const char16_t *wcs, int len)
-{
-	// Wrapper around utf16_to_cpN().
-	return utf16_to_cpN(CP_UTF8, wcs, len);
-}
-
-/**
- * Convert UTF-16BE text to UTF-8.
- * Trailing NULL bytes will be removed.
- * @param wcs	[in] UTF-16BE text.
- * @param len	[in] Length of wcs, in characters. (-1 for NULL-terminated string)
- * @return UTF-8 string.
- */
-string utf16be_to_utf8(const char16_t *wcs, int len)
-{
-	if (!wcs || !*wcs || len == 0) {
-		// Empty string.
-		return string();
-	}
-
-	// NOTE: NULL characters are NOT truncated in the
-	// byteswap function. That's done in the regular
-	// utf16le_to_utf8() function.
-
-	// WideCharToMultiByte() doesn't support UTF-16BE.
-	// Byteswap the text first.
-	u16string bwcs = utf16_bswap(wcs, len);
-	if (bwcs.empty()) {
-		// Error byteswapping the string...
-		return string();
-	} else if (len > 0 && len != static_cast<int>(bwcs.size())) {
-		// Byteswapping failed.
-		// NOTE: Only checking if an explicit length
-		// is specified, since we don't want to
-		// call u16_strlen() here.
-		return string();
-	}
-
-	// Convert the byteswapped text.
-	return utf16_to_cpN(CP_UTF8, bwcs.data(), static_cast<int>(bwcs.size()));
-}
-
 }
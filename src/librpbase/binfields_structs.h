@@ -0,0 +1,136 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * binfields_structs.h: Binary RomFields/RomMetaData data structures.      *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef __ROMPROPERTIES_LIBRPBASE_BINFIELDS_STRUCTS_H__
+#define __ROMPROPERTIES_LIBRPBASE_BINFIELDS_STRUCTS_H__
+
+#include "librpbase/common.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma pack(1)
+
+/**
+ * Binary RomFields/RomMetaData format.
+ *
+ * Layout:
+ * - BinFields_Header
+ * - Tab names: tab_count x uint32_t string references
+ * - Fields: field_count x BinFields_Field
+ * - Metadata: metadata_count x BinFields_MetaData
+ * - Data area: string arrays, list data, and age ratings
+ * - String table: all strings, deduplicated
+ *
+ * All offsets are relative to the start of the buffer,
+ * and all sections are 4-byte aligned.
+ *
+ * References to strings are byte offsets into the string table.
+ * Each string is stored as a uint32_t length, followed by the
+ * string data and a NULL terminator, padded to 4 bytes.
+ * The reference points to the length.
+ *
+ * References to data are byte offsets into the data area:
+ * - String array: uint32_t count, followed by count string references.
+ * - List data: uint32_t row count, followed by one string array
+ *   reference per row.
+ * - Age ratings: AGE_MAX uint16_t values.
+ *
+ * BINFIELDS_REF_NONE indicates a NULL string or data pointer.
+ *
+ * All fields are in little-endian.
+ */
+#define BINFIELDS_MAGIC 'RPBF'
+#define BINFIELDS_VERSION 1
+#define BINFIELDS_REF_NONE 0xFFFFFFFFU
+typedef struct PACKED _BinFields_Header {
+	uint32_t magic;			// [0x000] 'RPBF' (big-endian)
+	uint16_t version;		// [0x004] Format version (BINFIELDS_VERSION)
+	uint16_t header_size;		// [0x006] sizeof(BinFields_Header)
+	uint32_t total_size;		// [0x008] Total size, including this header
+	uint32_t tab_count;		// [0x00C] Number of tab names
+	uint32_t field_count;		// [0x010] Number of fields
+	uint32_t metadata_count;	// [0x014] Number of metadata properties
+	uint32_t tabs_offset;		// [0x018] Tab names
+	uint32_t fields_offset;		// [0x01C] Fields
+	uint32_t metadata_offset;	// [0x020] Metadata properties
+	uint32_t data_offset;		// [0x024] Data area
+	uint32_t data_size;		// [0x028] Data area size
+	uint32_t strtbl_offset;		// [0x02C] String table
+	uint32_t strtbl_size;		// [0x030] String table size
+	uint32_t reserved;		// [0x034]
+} BinFields_Header;
+ASSERT_STRUCT(BinFields_Header, 0x38);
+
+/**
+ * Field record.
+ * The meaning of v[] depends on the field type:
+ * - RFT_STRING: v[0] = string ref
+ * - RFT_BITFIELD: v[0] = bitfield, v[1] = elemsPerRow,
+ *                 v[2] = bit names (string array ref)
+ * - RFT_LISTDATA: v[0] = headers (string array ref),
+ *                 v[1] = list data ref, v[2] = rows_visible,
+ *                 v[3] = header alignment, v[4] = data alignment,
+ *                 v[5] = checkboxes
+ * - RFT_DATETIME: v[0] = low 32 bits, v[1] = high 32 bits
+ * - RFT_AGE_RATINGS: v[0] = age ratings ref
+ * - RFT_DIMENSIONS: v[0], v[1], v[2] = dimensions
+ *
+ * Icons in RFT_LISTDATA are not stored, and the
+ * RFT_LISTDATA_ICONS flag is cleared.
+ *
+ * All fields are in little-endian.
+ */
+typedef struct PACKED _BinFields_Field {
+	uint32_t name;		// [0x000] Field name (string ref)
+	uint8_t type;		// [0x004] RomFields::RomFieldType
+	uint8_t tabIdx;		// [0x005] Tab index
+	uint8_t reserved[2];	// [0x006]
+	uint32_t flags;		// [0x008] Field flags (desc.flags)
+	uint32_t v[7];		// [0x00C] Type-specific values
+} BinFields_Field;
+ASSERT_STRUCT(BinFields_Field, 0x28);
+
+/**
+ * Metadata property record.
+ * The meaning of value depends on the property type:
+ * - Integer, UnsignedInteger: Low 32 bits
+ * - String: Low 32 bits = string ref
+ * - Timestamp: 64-bit UNIX timestamp
+ *
+ * All fields are in little-endian.
+ */
+typedef struct PACKED _BinFields_MetaData {
+	uint8_t name;		// [0x000] Property::Property
+	uint8_t type;		// [0x001] PropertyType::PropertyType
+	uint8_t reserved[6];	// [0x002]
+	uint64_t value;		// [0x008] Value
+} BinFields_MetaData;
+ASSERT_STRUCT(BinFields_MetaData, 0x10);
+
+#pragma pack()
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ROMPROPERTIES_LIBRPBASE_BINFIELDS_STRUCTS_H__ */
@@ -26,6 +26,7 @@
 // C includes. (C++ namespace)
 #include "librpbase/ctypex.h"
 #include <cassert>
+#include <cstdlib>
 #include <cstring>
 
 // C++ includes.
@@ -107,6 +108,21 @@ class ConfigPrivate : public ConfReaderPrivate
 		bool useIntIconForSmallSizes;
 		bool downloadHighResScans;
 		bool showDangerousPermissionsOverlayIcon;
+
+		// Cache expiration options. (in days)
+		unsigned int cacheRevalidateDays;
+		unsigned int negativeCacheDays;
+		unsigned int negativeCacheMaxDays;
+
+		// Maximum cache size, in MiB. (0 == unlimited)
+		unsigned int cacheMaxSize;
+
+		// Thumbnail options.
+		RpPngWriter::Profile thumbnailPngProfile;
+
+		// I/O budget for thumbnails and property pages.
+		IoBudget::Limits ioBudget;
+		static const IoBudget::Limits defIoBudget;
 };
 
 /** ConfigPrivate **/
@@ -116,6 +132,9 @@ class ConfigPrivate : public ConfReaderPrivate
 // handle proper destruction when the DLL is unloaded.
 Config ConfigPrivate::instance;
 
+// Default I/O budget: 64 MiB, unlimited reads, 10 seconds.
+const IoBudget::Limits ConfigPrivate::defIoBudget = {64U*1024U*1024U, 0, 10000};
+
 /**
  * Default image type priority.
  * Used if a custom configuration is not defined
@@ -142,6 +161,16 @@ ConfigPrivate::ConfigPrivate()
 	, downloadHighResScans(true)
 	/* Overlay icon */
 	, showDangerousPermissionsOverlayIcon(true)
+	/* Cache expiration options */
+	, cacheRevalidateDays(30)
+	, negativeCacheDays(1)
+	, negativeCacheMaxDays(28)
+	/* Maximum cache size */
+	, cacheMaxSize(512)
+	/* Thumbnail options */
+	, thumbnailPngProfile(RpPngWriter::PROFILE_FAST)
+	/* I/O budget */
+	, ioBudget(defIoBudget)
 {
 	// NOTE: Configuration is also initialized in the reset() function.
 }
@@ -168,6 +197,16 @@ void ConfigPrivate::reset(void)
 	downloadHighResScans = true;
 	// Overlay icon.
 	showDangerousPermissionsOverlayIcon = true;
+	// Cache expiration options.
+	cacheRevalidateDays = 30;
+	negativeCacheDays = 1;
+	negativeCacheMaxDays = 28;
+	// Maximum cache size.
+	cacheMaxSize = 512;
+	// Thumbnail options.
+	thumbnailPngProfile = RpPngWriter::PROFILE_FAST;
+	// I/O budget.
+	ioBudget = defIoBudget;
 }
 
 /**
@@ -194,6 +233,38 @@ int ConfigPrivate::processConfigLine(const char *section, const char *name, cons
 
 	// Which section are we in?
 	if (!strcasecmp(section, "Downloads")) {
+		// Cache expiration options. (in days)
+		unsigned int *days = nullptr;
+		if (!strcasecmp(name, "CacheRevalidateDays")) {
+			days = &cacheRevalidateDays;
+		} else if (!strcasecmp(name, "NegativeCacheDays")) {
+			days = &negativeCacheDays;
+		} else if (!strcasecmp(name, "NegativeCacheMaxDays")) {
+			days = &negativeCacheMaxDays;
+		}
+		if (days) {
+			char *endptr = nullptr;
+			const long val = strtol(value, &endptr, 10);
+			if (*endptr == '\0' && val >= 0 && val <= 3650) {
+				*days = static_cast<unsigned int>(val);
+			} else {
+				// TODO: Show a warning or something?
+			}
+			return 1;
+		}
+
+		if (!strcasecmp(name, "CacheMaxSize")) {
+			// Maximum cache size, in MiB.
+			char *endptr = nullptr;
+			const long val = strtol(value, &endptr, 10);
+			if (*endptr == '\0' && val >= 0 && val <= 1048576) {
+				cacheMaxSize = static_cast<unsigned int>(val);
+			} else {
+				// TODO: Show a warning or something?
+			}
+			return 1;
+		}
+
 		// Downloads. Check for one of the three boolean options.
 		bool *param;
 		if (!strcasecmp(name, "ExtImageDownload")) {
@@ -218,6 +289,26 @@ int ConfigPrivate::processConfigLine(const char *section, const char *name, cons
 		}
 	} else if (!strcasecmp(section, "Options")) {
 		// Options.
+		if (!strcasecmp(name, "ThumbnailPngProfile")) {
+			// PNG encoding profile for thumbnails.
+			const int profile = RpPngWriter::profileFromName(value);
+			if (profile >= 0) {
+				thumbnailPngProfile = static_cast<RpPngWriter::Profile>(profile);
+			} else {
+				// TODO: Show a warning or something?
+			}
+			return 1;
+		} else if (!strcasecmp(name, "IoBudget")) {
+			// I/O budget for thumbnails and property pages.
+			IoBudget::Limits limits;
+			if (IoBudget::parseLimits(value, limits) == 0) {
+				ioBudget = limits;
+			} else {
+				// TODO: Show a warning or something?
+			}
+			return 1;
+		}
+
 		bool *param;
 		if (!strcasecmp(name, "ShowDangerousPermissionsOverlayIcon")) {
 			param = &showDangerousPermissionsOverlayIcon;
@@ -528,4 +619,76 @@ bool Config::showDangerousPermissionsOverlayIcon(void) const
 	return d->showDangerousPermissionsOverlayIcon;
 }
 
+/**
+ * Number of days before cached images are revalidated with the server.
+ * NOTE: Call load() before using this function.
+ * @return Revalidation interval, in days. (0 == never revalidate)
+ */
+unsigned int Config::cacheRevalidateDays(void) const
+{
+	RP_D(const Config);
+	return d->cacheRevalidateDays;
+}
+
+/**
+ * Number of days before a failed download is retried.
+ * This is doubled for each consecutive failure, up to negativeCacheMaxDays().
+ * NOTE: Call load() before using this function.
+ * @return Initial negative cache TTL, in days.
+ */
+unsigned int Config::negativeCacheDays(void) const
+{
+	RP_D(const Config);
+	return d->negativeCacheDays;
+}
+
+/**
+ * Maximum number of days before a failed download is retried.
+ * NOTE: Call load() before using this function.
+ * @return Maximum negative cache TTL, in days.
+ */
+unsigned int Config::negativeCacheMaxDays(void) const
+{
+	RP_D(const Config);
+	return d->negativeCacheMaxDays;
+}
+
+/**
+ * Maximum size of the download cache.
+ * If the cache grows larger than this, the least-recently
+ * used files are evicted.
+ * NOTE: Call load() before using this function.
+ * @return Maximum cache size, in MiB. (0 == unlimited)
+ */
+unsigned int Config::cacheMaxSize(void) const
+{
+	RP_D(const Config);
+	return d->cacheMaxSize;
+}
+
+/** Thumbnail options. **/
+
+/**
+ * PNG encoding profile for thumbnails.
+ * NOTE: Call load() before using this function.
+ * @return PNG encoding profile.
+ */
+RpPngWriter::Profile Config::thumbnailPngProfile(void) const
+{
+	RP_D(const Config);
+	return d->thumbnailPngProfile;
+}
+
+/**
+ * I/O budget for reading a ROM image when creating
+ * a thumbnail or showing a property page.
+ * NOTE: Call load() before using this function.
+ * @return I/O budget limits.
+ */
+IoBudget::Limits Config::ioBudget(void) const
+{
+	RP_D(const Config);
+	return d->ioBudget;
+}
+
 }
@@ -23,6 +23,8 @@
 #define __ROMPROPERTIES_LIBRPBASE_CONFIG_CONFIG_HPP__
 
 #include "ConfReader.hpp"
+#include "../file/IoBudget.hpp"
+#include "../img/RpPngWriter.hpp"
 
 // C includes.
 #include <stdint.h>
@@ -127,6 +129,52 @@ class Config : public ConfReader
 		 * @return True if we should show the overlay icon; false if not.
 		 */
 		bool showDangerousPermissionsOverlayIcon(void) const;
+
+		/**
+		 * Number of days before cached images are revalidated with the server.
+		 * NOTE: Call load() before using this function.
+		 * @return Revalidation interval, in days. (0 == never revalidate)
+		 */
+		unsigned int cacheRevalidateDays(void) const;
+
+		/**
+		 * Number of days before a failed download is retried.
+		 * This is doubled for each consecutive failure, up to negativeCacheMaxDays().
+		 * NOTE: Call load() before using this function.
+		 * @return Initial negative cache TTL, in days.
+		 */
+		unsigned int negativeCacheDays(void) const;
+
+		/**
+		 * Maximum number of days before a failed download is retried.
+		 * NOTE: Call load() before using this function.
+		 * @return Maximum negative cache TTL, in days.
+		 */
+		unsigned int negativeCacheMaxDays(void) const;
+
+		/**
+		 * Maximum size of the download cache.
+		 * If the cache grows larger than this, the least-recently
+		 * used files are evicted.
+		 * NOTE: Call load() before using this function.
+		 * @return Maximum cache size, in MiB. (0 == unlimited)
+		 */
+		unsigned int cacheMaxSize(void) const;
+
+		/**
+		 * PNG encoding profile for thumbnails.
+		 * NOTE: Call load() before using this function.
+		 * @return PNG encoding profile.
+		 */
+		RpPngWriter::Profile thumbnailPngProfile(void) const;
+
+		/**
+		 * I/O budget for reading a ROM image when creating
+		 * a thumbnail or showing a property page.
+		 * NOTE: Call load() before using this function.
+		 * @return I/O budget limits.
+		 */
+		IoBudget::Limits ioBudget(void) const;
 };
 
 }
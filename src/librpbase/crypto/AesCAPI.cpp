@@ -21,6 +21,7 @@
 
 #include "AesCAPI.hpp"
 #include "../common.h"
+#include "../file/IoStats.hpp"
 
 // C includes. (C++ namespace)
 #include <cerrno>
@@ -334,6 +335,7 @@ size_t AesCAPI::decrypt(uint8_t *RESTRICT pData, size_t size)
 		// Key hasn't been set.
 		return 0;
 	}
+	IoStats::countDecrypt(size);
 
 	// FIXME: Nettle version doesn't do this, which allows
 	// calling decrypt() multiple times for CBC with large
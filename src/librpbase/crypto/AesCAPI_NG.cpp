@@ -20,6 +20,7 @@
 
 #include "AesCAPI_NG.hpp"
 #include "../common.h"
+#include "../file/IoStats.hpp"
 
 // C includes. (C++ namespace)
 #include <cassert>
@@ -496,6 +497,7 @@ size_t AesCAPI_NG::decrypt(uint8_t *RESTRICT pData, size_t size)
 		// or the key hasn't been set.
 		return 0;
 	}
+	IoStats::countDecrypt(size);
 
 	// Get the block length.
 	ULONG cbBlockLen;
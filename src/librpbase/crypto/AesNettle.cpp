@@ -22,6 +22,7 @@
 
 #include "AesNettle.hpp"
 #include "../common.h"
+#include "../file/IoStats.hpp"
 
 // C includes. (C++ namespace)
 #include <cerrno>
@@ -242,6 +243,7 @@ size_t AesNettle::decrypt(uint8_t *RESTRICT pData, size_t size)
 		// Invalid parameters.
 		return 0;
 	}
+	IoStats::countDecrypt(size);
 
 	// Decrypt the data.
 	RP_D(AesNettle);
@@ -0,0 +1,173 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * IoBudget.cpp: Per-thread I/O budgets.                                   *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "IoBudget.hpp"
+#include "threads/ThreadLocal.hpp"
+
+#ifdef _WIN32
+# include "libwin32common/RpWin32_sdk.h"
+#else /* !_WIN32 */
+# include <time.h>
+#endif /* _WIN32 */
+
+// C includes. (C++ namespace)
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+
+namespace LibRpBase {
+
+// Budget for the current thread.
+static ThreadLocalPtr tls_budget;
+
+/**
+ * Get the current monotonic time.
+ * @return Monotonic time, in milliseconds.
+ */
+static int64_t monotonicTime(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER freq, counter;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&counter);
+	return static_cast<int64_t>(counter.QuadPart / (double)freq.QuadPart * 1000.0);
+#else /* !_WIN32 */
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (static_cast<int64_t>(ts.tv_sec) * 1000LL) + (ts.tv_nsec / 1000000);
+#endif /* _WIN32 */
+}
+
+/**
+ * Create an I/O budget.
+ * The deadline starts when the budget is created.
+ * @param max_bytes Maximum number of bytes to read. (0 == unlimited)
+ * @param max_reads Maximum number of read() calls. (0 == unlimited)
+ * @param timeout_ms Maximum time, in milliseconds. (0 == unlimited)
+ */
+IoBudget::IoBudget(uint64_t max_bytes, uint64_t max_reads, unsigned int timeout_ms)
+	: m_max_bytes(max_bytes)
+	, m_max_reads(max_reads)
+	, m_deadline(timeout_ms != 0 ? monotonicTime() + timeout_ms : 0)
+	, m_bytes_read(0)
+	, m_reads(0)
+	, m_exceeded(false)
+{ }
+
+/**
+ * Create an I/O budget.
+ * The deadline starts when the budget is created.
+ * @param limits Limits.
+ */
+IoBudget::IoBudget(const Limits &limits)
+	: m_max_bytes(limits.max_bytes)
+	, m_max_reads(limits.max_reads)
+	, m_deadline(limits.timeout_ms != 0 ? monotonicTime() + limits.timeout_ms : 0)
+	, m_bytes_read(0)
+	, m_reads(0)
+	, m_exceeded(false)
+{ }
+
+/**
+ * Parse I/O budget limits.
+ * Format: "MiB[,reads[,ms]]". Omitted or zero limits are unlimited.
+ * @param str	[in] Limits string.
+ * @param limits	[out] Limits.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int IoBudget::parseLimits(const char *str, Limits &limits)
+{
+	unsigned long long values[3] = {0, 0, 0};
+	for (unsigned int i = 0; i < 3; i++) {
+		char *endptr = nullptr;
+		errno = 0;
+		values[i] = strtoull(str, &endptr, 10);
+		if (endptr == str || errno != 0 || *str == '-') {
+			return -EINVAL;
+		}
+		str = endptr;
+		if (*str == '\0') {
+			break;
+		} else if (*str != ',' || i == 2) {
+			return -EINVAL;
+		}
+		str++;
+	}
+
+	if (values[0] > (UINT64_MAX >> 20) || values[2] > UINT_MAX) {
+		return -ERANGE;
+	}
+	limits.max_bytes = values[0] << 20;
+	limits.max_reads = values[1];
+	limits.timeout_ms = static_cast<unsigned int>(values[2]);
+	return 0;
+}
+
+IoBudget::Scope::Scope(IoBudget *budget)
+	: m_prev(static_cast<IoBudget*>(tls_budget.get()))
+{
+	tls_budget.set(budget);
+}
+
+IoBudget::Scope::~Scope()
+{
+	tls_budget.set(m_prev);
+}
+
+/**
+ * Get the budget for the current thread.
+ * @return Budget, or nullptr if no budget is active.
+ */
+IoBudget *IoBudget::current(void)
+{
+	return static_cast<IoBudget*>(tls_budget.get());
+}
+
+/**
+ * Charge a read to this budget.
+ * @param size Number of bytes to read. (0 for seeks)
+ * @return 0 if the operation is allowed; -ECANCELED if not.
+ */
+int IoBudget::chargeRead(size_t size)
+{
+	if (m_exceeded) {
+		return -ECANCELED;
+	}
+
+	if (size != 0) {
+		if ((m_max_reads != 0 && m_reads >= m_max_reads) ||
+		    (m_max_bytes != 0 && m_bytes_read + size > m_max_bytes))
+		{
+			m_exceeded = true;
+			return -ECANCELED;
+		}
+		m_reads++;
+		m_bytes_read += size;
+	}
+
+	if (m_deadline != 0 && monotonicTime() >= m_deadline) {
+		m_exceeded = true;
+		return -ECANCELED;
+	}
+
+	return 0;
+}
+
+}
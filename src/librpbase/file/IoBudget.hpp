@@ -0,0 +1,217 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * IoBudget.hpp: Per-thread I/O budgets.                                   *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef __ROMPROPERTIES_LIBRPBASE_IOBUDGET_HPP__
+#define __ROMPROPERTIES_LIBRPBASE_IOBUDGET_HPP__
+
+#include "librpbase/common.h"
+
+// C includes.
+#include <stddef.h>
+#include <stdint.h>
+
+namespace LibRpBase {
+
+/**
+ * I/O budget for a single file.
+ *
+ * While a budget is active on a thread, all reads and seeks done
+ * by that thread through RpFile are checked against the budget.
+ * Once any limit is exceeded, the budget is marked as exceeded,
+ * and all further reads and seeks fail with ECANCELED.
+ *
+ * Since IDiscReader, IPartition, and the gzip decompressor all
+ * read through RpFile, this also covers disc images, partitions,
+ * and compressed files.
+ *
+ * Parsers don't need to know about budgets. A failed read is
+ * handled the same way as any other read error, so detection,
+ * field loading, and image loading will fail without doing
+ * any more I/O. If RomDataFactory::create() or a loader fails,
+ * check isExceeded() to distinguish budget exhaustion from
+ * an unsupported or corrupt file.
+ *
+ * Example:
+ *   IoBudget budget(64*1024*1024, 10000, 2000);
+ *   IoBudget::Scope scope(&budget);
+ *   RomData *romData = RomDataFactory::create(file);
+ *   if (!romData && budget.isExceeded()) { ... }
+ */
+class IoBudget
+{
+	public:
+		/**
+		 * I/O budget limits.
+		 */
+		struct Limits {
+			uint64_t max_bytes;		// Maximum number of bytes to read. (0 == unlimited)
+			uint64_t max_reads;		// Maximum number of read() calls. (0 == unlimited)
+			unsigned int timeout_ms;	// Maximum time, in milliseconds. (0 == unlimited)
+
+			/**
+			 * Are any limits set?
+			 * @return True if at least one limit is set.
+			 */
+			inline bool isEnabled(void) const
+			{
+				return (max_bytes != 0 || max_reads != 0 || timeout_ms != 0);
+			}
+		};
+
+		/**
+		 * Parse I/O budget limits.
+		 * Format: "MiB[,reads[,ms]]". Omitted or zero limits are unlimited.
+		 * @param str	[in] Limits string.
+		 * @param limits	[out] Limits.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		static int parseLimits(const char *str, Limits &limits);
+
+	public:
+		/**
+		 * Create an I/O budget.
+		 * The deadline starts when the budget is created.
+		 * @param max_bytes Maximum number of bytes to read. (0 == unlimited)
+		 * @param max_reads Maximum number of read() calls. (0 == unlimited)
+		 * @param timeout_ms Maximum time, in milliseconds. (0 == unlimited)
+		 */
+		IoBudget(uint64_t max_bytes, uint64_t max_reads, unsigned int timeout_ms);
+
+		/**
+		 * Create an I/O budget.
+		 * The deadline starts when the budget is created.
+		 * @param limits Limits.
+		 */
+		explicit IoBudget(const Limits &limits);
+
+	private:
+		RP_DISABLE_COPY(IoBudget)
+
+	public:
+		/**
+		 * Set the budget for the current thread for the lifetime
+		 * of this object. The previous budget, if any, is restored
+		 * when this object is destroyed.
+		 */
+		class Scope
+		{
+			public:
+				explicit Scope(IoBudget *budget);
+				~Scope();
+
+			private:
+				RP_DISABLE_COPY(Scope)
+				IoBudget *m_prev;
+		};
+
+		/**
+		 * Get the budget for the current thread.
+		 * @return Budget, or nullptr if no budget is active.
+		 */
+		static IoBudget *current(void);
+
+		/**
+		 * Check if the current thread's budget allows a read.
+		 * If it does, the read is charged to the budget.
+		 *
+		 * NOTE: The requested size is charged, not the number
+		 * of bytes actually read, since the read hasn't been
+		 * done yet when this function is called.
+		 *
+		 * @param size Number of bytes to read.
+		 * @return 0 if the read is allowed; negative POSIX error code if not.
+		 */
+		static inline int checkRead(size_t size)
+		{
+			IoBudget *const budget = current();
+			return (budget ? budget->chargeRead(size) : 0);
+		}
+
+		/**
+		 * Check if the current thread's budget allows a seek.
+		 * Seeks aren't limited, but they fail once the
+		 * budget has been exceeded or the deadline has passed.
+		 * @return 0 if the seek is allowed; negative POSIX error code if not.
+		 */
+		static inline int checkSeek(void)
+		{
+			IoBudget *const budget = current();
+			return (budget ? budget->chargeRead(0) : 0);
+		}
+
+		/**
+		 * Has the current thread's budget been exceeded?
+		 * @return True if a budget is active and has been exceeded.
+		 */
+		static inline bool isCurrentExceeded(void)
+		{
+			const IoBudget *const budget = current();
+			return (budget && budget->isExceeded());
+		}
+
+	public:
+		/**
+		 * Has this budget been exceeded?
+		 * @return True if any limit has been exceeded.
+		 */
+		inline bool isExceeded(void) const
+		{
+			return m_exceeded;
+		}
+
+		/**
+		 * Get the number of bytes charged to this budget.
+		 * @return Number of bytes.
+		 */
+		inline uint64_t bytesRead(void) const
+		{
+			return m_bytes_read;
+		}
+
+		/**
+		 * Get the number of reads charged to this budget.
+		 * @return Number of reads.
+		 */
+		inline uint64_t reads(void) const
+		{
+			return m_reads;
+		}
+
+	private:
+		/**
+		 * Charge a read to this budget.
+		 * @param size Number of bytes to read. (0 for seeks)
+		 * @return 0 if the operation is allowed; -ECANCELED if not.
+		 */
+		int chargeRead(size_t size);
+
+	private:
+		uint64_t m_max_bytes;
+		uint64_t m_max_reads;
+		int64_t m_deadline;	// Monotonic time, in milliseconds. (0 == none)
+
+		uint64_t m_bytes_read;
+		uint64_t m_reads;
+		bool m_exceeded;
+};
+
+}
+
+#endif /* __ROMPROPERTIES_LIBRPBASE_IOBUDGET_HPP__ */
@@ -0,0 +1,51 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * IoStats.cpp: Per-thread I/O statistics.                                 *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "IoStats.hpp"
+#include "threads/ThreadLocal.hpp"
+
+namespace LibRpBase { namespace IoStats {
+
+// Counters for the current thread.
+static ThreadLocalPtr tls_counters;
+
+/**
+ * Set the I/O counters for the current thread.
+ *
+ * Counting is disabled by default. If enabled, all I/O
+ * done by the current thread will be added to the counters.
+ *
+ * @param counters Counters, or nullptr to disable counting.
+ */
+void setThreadCounters(Counters *counters)
+{
+	tls_counters.set(counters);
+}
+
+/**
+ * Get the I/O counters for the current thread.
+ * @return Counters, or nullptr if counting is disabled.
+ */
+Counters *threadCounters(void)
+{
+	return static_cast<Counters*>(tls_counters.get());
+}
+
+} }
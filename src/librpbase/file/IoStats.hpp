@@ -0,0 +1,98 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * IoStats.hpp: Per-thread I/O statistics.                                 *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef __ROMPROPERTIES_LIBRPBASE_IOSTATS_HPP__
+#define __ROMPROPERTIES_LIBRPBASE_IOSTATS_HPP__
+
+// C includes.
+#include <stddef.h>
+#include <stdint.h>
+
+namespace LibRpBase { namespace IoStats {
+
+/**
+ * I/O counters.
+ * Reads and seeks are counted in RpFile, so reads done
+ * through IDiscReader and IPartition are included.
+ */
+struct Counters {
+	uint64_t reads;			// Number of read() calls.
+	uint64_t bytes_read;		// Number of bytes read.
+	uint64_t seeks;			// Number of seek() calls.
+	uint64_t decrypts;		// Number of IAesCipher::decrypt() calls.
+	uint64_t bytes_decrypted;	// Number of bytes decrypted.
+};
+
+/**
+ * Set the I/O counters for the current thread.
+ *
+ * Counting is disabled by default. If enabled, all I/O
+ * done by the current thread will be added to the counters.
+ *
+ * @param counters Counters, or nullptr to disable counting.
+ */
+void setThreadCounters(Counters *counters);
+
+/**
+ * Get the I/O counters for the current thread.
+ * @return Counters, or nullptr if counting is disabled.
+ */
+Counters *threadCounters(void);
+
+/**
+ * Count a read.
+ * @param size Number of bytes read.
+ */
+static inline void countRead(size_t size)
+{
+	Counters *const counters = threadCounters();
+	if (counters) {
+		counters->reads++;
+		counters->bytes_read += size;
+	}
+}
+
+/**
+ * Count a seek.
+ */
+static inline void countSeek(void)
+{
+	Counters *const counters = threadCounters();
+	if (counters) {
+		counters->seeks++;
+	}
+}
+
+/**
+ * Count a decryption.
+ * @param size Number of bytes decrypted.
+ */
+static inline void countDecrypt(size_t size)
+{
+	Counters *const counters = threadCounters();
+	if (counters) {
+		counters->decrypts++;
+		counters->bytes_decrypted += size;
+	}
+}
+
+} }
+
+#endif /* __ROMPROPERTIES_LIBRPBASE_IOSTATS_HPP__ */
@@ -19,6 +19,8 @@
  ***************************************************************************/
 
 #include "RpFile.hpp"
+#include "IoStats.hpp"
+#include "IoBudget.hpp"
 
 // librpbase
 #include "byteswap.h"
@@ -340,6 +342,13 @@ size_t RpFile::read(void *ptr, size_t size)
 		return 0;
 	}
 
+	// Check the I/O budget.
+	int err = IoBudget::checkRead(size);
+	if (err != 0) {
+		m_lastError = -err;
+		return 0;
+	}
+
 	size_t ret;
 	if (d->gzfd) {
 		int iret = gzread(d->gzfd, ptr, size);
@@ -357,6 +366,7 @@ size_t RpFile::read(void *ptr, size_t size)
 			m_lastError = errno;
 		}
 	}
+	IoStats::countRead(ret);
 	return ret;
 }
 
@@ -397,6 +407,13 @@ int RpFile::seek(int64_t pos)
 		return -1;
 	}
 
+	// Check the I/O budget.
+	int err = IoBudget::checkSeek();
+	if (err != 0) {
+		m_lastError = -err;
+		return -1;
+	}
+
 	int ret;
 	if (d->gzfd) {
 		z_off_t zret = gzseek(d->gzfd, pos, SEEK_SET);
@@ -414,6 +431,7 @@ int RpFile::seek(int64_t pos)
 		}
 	}
 	::fflush(d->file);	// needed for some things like gzip
+	IoStats::countSeek();
 	return ret;
 }
 
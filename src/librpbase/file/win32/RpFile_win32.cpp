@@ -19,6 +19,8 @@
  ***************************************************************************/
 
 #include "../RpFile.hpp"
+#include "../IoStats.hpp"
+#include "../IoBudget.hpp"
 
 // librpbase
 #include "byteswap.h"
@@ -654,9 +656,18 @@ size_t RpFile::read(void *ptr, size_t size)
 		return 0;
 	}
 
+	// Check the I/O budget.
+	int err = IoBudget::checkRead(size);
+	if (err != 0) {
+		m_lastError = -err;
+		return 0;
+	}
+
 	if (d->sector_size != 0) {
 		// Block device. Need to read in multiples of the block size.
-		return d->readUsingBlocks(ptr, size);
+		const size_t ret = d->readUsingBlocks(ptr, size);
+		IoStats::countRead(ret);
+		return ret;
 	}
 
 	DWORD bytesRead;
@@ -678,6 +689,7 @@ size_t RpFile::read(void *ptr, size_t size)
 		}
 	}
 
+	IoStats::countRead(bytesRead);
 	return bytesRead;
 }
 
@@ -727,6 +739,13 @@ int RpFile::seek(int64_t pos)
 		return -1;
 	}
 
+	// Check the I/O budget.
+	int err = IoBudget::checkSeek();
+	if (err != 0) {
+		m_lastError = -err;
+		return -1;
+	}
+
 	int ret;
 	if (d->gzfd) {
 		// FIXME: Might not work with >2GB files...
@@ -750,6 +769,7 @@ int RpFile::seek(int64_t pos)
 		}
 	}
 
+	IoStats::countSeek();
 	return ret;
 }
 
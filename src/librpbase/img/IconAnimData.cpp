@@ -0,0 +1,268 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * IconAnimData.cpp: Icon animation data.                                  *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "IconAnimData.hpp"
+#include "rp_image.hpp"
+
+// C includes. (C++ namespace)
+#include <cassert>
+#include <cstring>
+
+// C++ includes.
+#include <unordered_map>
+using std::unordered_map;
+
+namespace LibRpBase {
+
+/**
+ * Calculate a content hash for an image.
+ * This uses 32-bit FNV-1a over the image properties,
+ * the palette (if present), and the image data.
+ * @param img Image.
+ * @return Content hash.
+ */
+static uint32_t hashImage(const rp_image *img)
+{
+	uint32_t hash = 2166136261U;
+	auto hash_bytes = [&hash](const void *data, size_t len) {
+		const uint8_t *p = static_cast<const uint8_t*>(data);
+		for (; len > 0; len--, p++) {
+			hash = (hash ^ *p) * 16777619U;
+		}
+	};
+
+	const int props[3] = {img->width(), img->height(), static_cast<int>(img->format())};
+	hash_bytes(props, sizeof(props));
+	if (img->palette()) {
+		hash_bytes(img->palette(), img->palette_len() * sizeof(uint32_t));
+	}
+	const size_t row_bytes = static_cast<size_t>(img->row_bytes());
+	for (int y = 0; y < img->height(); y++) {
+		hash_bytes(img->scanLine(y), row_bytes);
+	}
+	return hash;
+}
+
+/**
+ * Compare the contents of two images.
+ * @param a Image A.
+ * @param b Image B.
+ * @return True if the images are identical; false if not.
+ */
+static bool isSameImage(const rp_image *a, const rp_image *b)
+{
+	if (a->width() != b->width() ||
+	    a->height() != b->height() ||
+	    a->format() != b->format() ||
+	    a->palette_len() != b->palette_len() ||
+	    a->tr_idx() != b->tr_idx())
+	{
+		return false;
+	}
+
+	if (a->palette() && memcmp(a->palette(), b->palette(), a->palette_len() * sizeof(uint32_t)) != 0) {
+		return false;
+	}
+
+	const size_t row_bytes = static_cast<size_t>(a->row_bytes());
+	for (int y = 0; y < a->height(); y++) {
+		if (memcmp(a->scanLine(y), b->scanLine(y), row_bytes) != 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Remove duplicate frames.
+ *
+ * Frames are compared by content. If a frame is identical
+ * to an earlier frame, sequence indexes referring to it are
+ * changed to refer to the earlier frame, and the duplicate
+ * frame is deleted and set to nullptr.
+ *
+ * NOTE: This deletes rp_image objects, so it should only
+ * be called by the object that owns the frames.
+ *
+ * @return Number of frames removed.
+ */
+int IconAnimData::dedupFrames(void)
+{
+	assert(count >= 0 && count <= MAX_FRAMES);
+	assert(seq_count >= 0 && seq_count <= MAX_SEQUENCE);
+
+	std::array<uint32_t, MAX_FRAMES> hashes;
+	int removed = 0;
+	for (int i = 0; i < count; i++) {
+		const rp_image *const img = frames[i];
+		if (!img || !img->isValid())
+			continue;
+		hashes[i] = hashImage(img);
+
+		// Check for an identical earlier frame.
+		for (int j = 0; j < i; j++) {
+			if (!frames[j] || !frames[j]->isValid() || hashes[j] != hashes[i])
+				continue;
+			if (!isSameImage(frames[j], img))
+				continue;
+
+			// Found a duplicate frame.
+			for (int s = 0; s < seq_count; s++) {
+				if (seq_index[s] == i) {
+					seq_index[s] = static_cast<uint8_t>(j);
+				}
+			}
+			delete img;
+			frames[i] = nullptr;
+			removed++;
+			break;
+		}
+	}
+
+	return removed;
+}
+
+/**
+ * Convert ARGB32 frames to CI8 using a shared palette.
+ *
+ * This is only done if all frames are ARGB32 and have the
+ * same dimensions, and if there are no more than 256 unique
+ * colors across all frames. The conversion is lossless.
+ *
+ * NOTE: This deletes rp_image objects, so it should only
+ * be called by the object that owns the frames.
+ *
+ * @return True if the frames were converted; false if not.
+ */
+bool IconAnimData::packFramesCI8(void)
+{
+	assert(count >= 0 && count <= MAX_FRAMES);
+
+	// Verify that all frames are compatible.
+	const rp_image *first = nullptr;
+	for (int i = 0; i < count; i++) {
+		const rp_image *const img = frames[i];
+		if (!img)
+			continue;
+		if (!img->isValid() || img->format() != rp_image::FORMAT_ARGB32)
+			return false;
+		if (!first) {
+			first = img;
+		} else if (img->width() != first->width() || img->height() != first->height()) {
+			return false;
+		}
+	}
+	if (!first) {
+		// No frames.
+		return false;
+	}
+
+	// Build the shared palette.
+	const int width = first->width();
+	const int height = first->height();
+	unordered_map<uint32_t, uint8_t> color_map;
+	std::array<uint32_t, 256> palette;
+	for (int i = 0; i < count; i++) {
+		const rp_image *const img = frames[i];
+		if (!img)
+			continue;
+		for (int y = 0; y < height; y++) {
+			const uint32_t *px = static_cast<const uint32_t*>(img->scanLine(y));
+			for (int x = width; x > 0; x--, px++) {
+				if (color_map.find(*px) != color_map.end())
+					continue;
+				if (color_map.size() >= palette.size()) {
+					// Too many colors.
+					return false;
+				}
+				palette[color_map.size()] = *px;
+				color_map.emplace(*px, static_cast<uint8_t>(color_map.size()));
+			}
+		}
+	}
+
+	// If exactly one color is transparent and the rest
+	// are opaque, it can be used as the tRNS index.
+	int tr_idx = -1;
+	const int palette_len = static_cast<int>(color_map.size());
+	for (int i = 0; i < palette_len; i++) {
+		const uint8_t alpha = palette[i] >> 24;
+		if (alpha == 0xFF)
+			continue;
+		if (alpha != 0 || tr_idx >= 0) {
+			// Palette has alpha transparency.
+			tr_idx = -1;
+			break;
+		}
+		tr_idx = i;
+	}
+
+	// Convert the frames.
+	// All frames are converted before any of the originals are
+	// replaced so that a failed allocation doesn't leave a mix
+	// of ARGB32 and CI8 frames.
+	std::array<rp_image*, MAX_FRAMES> ci8_frames;
+	ci8_frames.fill(nullptr);
+	for (int i = 0; i < count; i++) {
+		const rp_image *const img = frames[i];
+		if (!img)
+			continue;
+
+		rp_image *const ci8 = new rp_image(width, height, rp_image::FORMAT_CI8);
+		ci8_frames[i] = ci8;
+		if (!ci8->isValid() || ci8->palette_len() < palette_len) {
+			// Could not allocate the image.
+			for (int j = i; j >= 0; j--) {
+				delete ci8_frames[j];
+			}
+			return false;
+		}
+		// NOTE: rp_image initializes the palette to 0,
+		// so we don't need to clear the remaining colors.
+		memcpy(ci8->palette(), palette.data(), palette_len * sizeof(uint32_t));
+		ci8->set_tr_idx(tr_idx);
+
+		for (int y = 0; y < height; y++) {
+			const uint32_t *src = static_cast<const uint32_t*>(img->scanLine(y));
+			uint8_t *dest = static_cast<uint8_t*>(ci8->scanLine(y));
+			for (int x = width; x > 0; x--, src++, dest++) {
+				*dest = color_map[*src];
+			}
+		}
+
+		rp_image::sBIT_t sBIT;
+		if (img->get_sBIT(&sBIT) == 0) {
+			ci8->set_sBIT(&sBIT);
+		}
+	}
+
+	// Replace the original frames.
+	for (int i = 0; i < count; i++) {
+		if (!frames[i])
+			continue;
+		delete frames[i];
+		frames[i] = ci8_frames[i];
+	}
+
+	return true;
+}
+
+}
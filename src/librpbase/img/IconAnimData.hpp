@@ -81,6 +81,35 @@ struct IconAnimData
 		static const delay_t zero_delay = {0, 0, 0};
 		delays.fill(zero_delay);
 	}
+
+	/**
+	 * Remove duplicate frames.
+	 *
+	 * Frames are compared by content. If a frame is identical
+	 * to an earlier frame, sequence indexes referring to it are
+	 * changed to refer to the earlier frame, and the duplicate
+	 * frame is deleted and set to nullptr.
+	 *
+	 * NOTE: This deletes rp_image objects, so it should only
+	 * be called by the object that owns the frames.
+	 *
+	 * @return Number of frames removed.
+	 */
+	int dedupFrames(void);
+
+	/**
+	 * Convert ARGB32 frames to CI8 using a shared palette.
+	 *
+	 * This is only done if all frames are ARGB32 and have the
+	 * same dimensions, and if there are no more than 256 unique
+	 * colors across all frames. The conversion is lossless.
+	 *
+	 * NOTE: This deletes rp_image objects, so it should only
+	 * be called by the object that owns the frames.
+	 *
+	 * @return True if the frames were converted; false if not.
+	 */
+	bool packFramesCI8(void);
 };
 
 }
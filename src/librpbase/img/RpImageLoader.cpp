@@ -72,10 +72,16 @@ const uint8_t RpImageLoaderPrivate::jpeg_magic_2[4] =
  * This image is NOT checked for issues; do not use
  * with untrusted images!
  *
+ * If req_size is specified, the image may be decoded at
+ * a reduced size if the image format supports it, as long
+ * as the larger dimension is still at least req_size.
+ * Currently, this is only supported for JPEG.
+ *
  * @param file IRpFile to load from.
+ * @param req_size Requested image size. (0 for full size)
  * @return rp_image*, or nullptr on error.
  */
-rp_image *RpImageLoader::loadUnchecked(IRpFile *file)
+rp_image *RpImageLoader::loadUnchecked(IRpFile *file, int req_size)
 {
 	file->rewind();
 
@@ -97,7 +103,7 @@ rp_image *RpImageLoader::loadUnchecked(IRpFile *file)
 			  sizeof(RpImageLoaderPrivate::jpeg_magic_2)))
 		{
 			// Found a JPEG image.
-			return RpJpeg::loadUnchecked(file);
+			return RpJpeg::loadUnchecked(file, req_size);
 		}
 #endif /* HAVE_JPEG */
 	}
@@ -112,10 +118,16 @@ rp_image *RpImageLoader::loadUnchecked(IRpFile *file)
  * This image is verified with various tools to ensure
  * it doesn't have any errors.
  *
+ * If req_size is specified, the image may be decoded at
+ * a reduced size if the image format supports it, as long
+ * as the larger dimension is still at least req_size.
+ * Currently, this is only supported for JPEG.
+ *
  * @param file IRpFile to load from.
+ * @param req_size Requested image size. (0 for full size)
  * @return rp_image*, or nullptr on error.
  */
-rp_image *RpImageLoader::load(IRpFile *file)
+rp_image *RpImageLoader::load(IRpFile *file, int req_size)
 {
 	file->rewind();
 
@@ -137,7 +149,7 @@ rp_image *RpImageLoader::load(IRpFile *file)
 			  sizeof(RpImageLoaderPrivate::jpeg_magic_2)))
 		{
 			// Found a JPEG image.
-			return RpJpeg::load(file);
+			return RpJpeg::load(file, req_size);
 		}
 #endif /* HAVE_JPEG */
 	}
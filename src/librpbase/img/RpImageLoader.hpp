@@ -44,10 +44,16 @@ class RpImageLoader
 		 * This image is NOT checked for issues; do not use
 		 * with untrusted images!
 		 *
+		 * If req_size is specified, the image may be decoded at
+		 * a reduced size if the image format supports it, as long
+		 * as the larger dimension is still at least req_size.
+		 * Currently, this is only supported for JPEG.
+		 *
 		 * @param file IRpFile to load from.
+		 * @param req_size Requested image size. (0 for full size)
 		 * @return rp_image*, or nullptr on error.
 		 */
-		static rp_image *loadUnchecked(IRpFile *file);
+		static rp_image *loadUnchecked(IRpFile *file, int req_size = 0);
 
 		/**
 		 * Load an image from an IRpFile.
@@ -55,10 +61,16 @@ class RpImageLoader
 		 * This image is verified with various tools to ensure
 		 * it doesn't have any errors.
 		 *
+		 * If req_size is specified, the image may be decoded at
+		 * a reduced size if the image format supports it, as long
+		 * as the larger dimension is still at least req_size.
+		 * Currently, this is only supported for JPEG.
+		 *
 		 * @param file IRpFile to load from.
+		 * @param req_size Requested image size. (0 for full size)
 		 * @return rp_image*, or nullptr on error.
 		 */
-		static rp_image *load(IRpFile *file);
+		static rp_image *load(IRpFile *file, int req_size = 0);
 };
 
 }
@@ -245,10 +245,15 @@ void RpJpegPrivate::jpeg_IRpFile_src(j_decompress_ptr cinfo, IRpFile *infile)
  * This image is NOT checked for issues; do not use
  * with untrusted images!
  *
+ * If req_size is specified, the image may be decoded
+ * at 1/2, 1/4, or 1/8 scale, as long as the larger
+ * dimension is still at least req_size.
+ *
  * @param file IRpFile to load from.
+ * @param req_size Requested image size. (0 for full size)
  * @return rp_image*, or nullptr on error.
  */
-rp_image *RpJpeg::loadUnchecked(IRpFile *file)
+rp_image *RpJpeg::loadUnchecked(IRpFile *file, int req_size)
 {
 	if (!file)
 		return nullptr;
@@ -335,6 +340,20 @@ rp_image *RpJpeg::loadUnchecked(IRpFile *file)
 	}
 
 	/** Step 4: Set parameters for decompression. **/
+	if (req_size > 0) {
+		// Use DCT scaling to decode a smaller image if possible.
+		// This is much faster than decoding the full image and
+		// then scaling it down. The largest dimension must remain
+		// at least req_size in order to prevent quality loss.
+		const unsigned int max_dim = std::max(cinfo.image_width, cinfo.image_height);
+		unsigned int denom = 8;
+		while (denom > 1 && (max_dim + denom - 1) / denom < static_cast<unsigned int>(req_size)) {
+			denom /= 2;
+		}
+		cinfo.scale_num = 1;
+		cinfo.scale_denom = denom;
+	}
+
 	// Make sure we use libjpeg's built-in colorspace conversion
 	// where possible.
 	switch (cinfo.jpeg_color_space) {
@@ -434,7 +453,7 @@ rp_image *RpJpeg::loadUnchecked(IRpFile *file)
 				return nullptr;
 			}
 
-			img = new rp_image(cinfo.image_width, cinfo.image_height, rp_image::FORMAT_ARGB32);
+			img = new rp_image(cinfo.output_width, cinfo.output_height, rp_image::FORMAT_ARGB32);
 			if (!img->isValid()) {
 				// Could not allocate the image.
 				jpeg_destroy_decompress(&cinfo);
@@ -455,7 +474,7 @@ rp_image *RpJpeg::loadUnchecked(IRpFile *file)
 				return nullptr;
 			}
 
-			img = new rp_image(cinfo.image_width, cinfo.image_height, rp_image::FORMAT_ARGB32);
+			img = new rp_image(cinfo.output_width, cinfo.output_height, rp_image::FORMAT_ARGB32);
 			if (!img->isValid()) {
 				// Could not allocate the image.
 				jpeg_destroy_decompress(&cinfo);
@@ -474,7 +493,7 @@ rp_image *RpJpeg::loadUnchecked(IRpFile *file)
 				return nullptr;
 			}
 
-			img = new rp_image(cinfo.image_width, cinfo.image_height, rp_image::FORMAT_ARGB32);
+			img = new rp_image(cinfo.output_width, cinfo.output_height, rp_image::FORMAT_ARGB32);
 			if (!img->isValid()) {
 				// Could not allocate the image.
 				jpeg_destroy_decompress(&cinfo);
@@ -638,16 +657,21 @@ rp_image *RpJpeg::loadUnchecked(IRpFile *file)
  * This image is verified with various tools to ensure
  * it doesn't have any errors.
  *
+ * If req_size is specified, the image may be decoded
+ * at 1/2, 1/4, or 1/8 scale, as long as the larger
+ * dimension is still at least req_size.
+ *
  * @param file IRpFile to load from.
+ * @param req_size Requested image size. (0 for full size)
  * @return rp_image*, or nullptr on error.
  */
-rp_image *RpJpeg::load(IRpFile *file)
+rp_image *RpJpeg::load(IRpFile *file, int req_size)
 {
 	if (!file)
 		return nullptr;
 
 	// FIXME: Add a JPEG equivalent of pngcheck().
-	return loadUnchecked(file);
+	return loadUnchecked(file, req_size);
 }
 
 }
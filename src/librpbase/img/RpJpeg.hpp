@@ -43,10 +43,15 @@ class RpJpeg
 		 * This image is NOT checked for issues; do not use
 		 * with untrusted images!
 		 *
+		 * If req_size is specified, the image may be decoded
+		 * at 1/2, 1/4, or 1/8 scale, as long as the larger
+		 * dimension is still at least req_size.
+		 *
 		 * @param file IRpFile to load from.
+		 * @param req_size Requested image size. (0 for full size)
 		 * @return rp_image*, or nullptr on error.
 		 */
-		static rp_image *loadUnchecked(IRpFile *file);
+		static rp_image *loadUnchecked(IRpFile *file, int req_size = 0);
 
 		/**
 		 * Load a JPEG image from an IRpFile.
@@ -54,10 +59,15 @@ class RpJpeg
 		 * This image is verified with various tools to ensure
 		 * it doesn't have any errors.
 		 *
+		 * If req_size is specified, the image may be decoded
+		 * at 1/2, 1/4, or 1/8 scale, as long as the larger
+		 * dimension is still at least req_size.
+		 *
 		 * @param file IRpFile to load from.
+		 * @param req_size Requested image size. (0 for full size)
 		 * @return rp_image*, or nullptr on error.
 		 */
-		static rp_image *load(IRpFile *file);
+		static rp_image *load(IRpFile *file, int req_size = 0);
 };
 
 }
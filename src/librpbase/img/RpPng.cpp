@@ -603,9 +603,10 @@ rp_image *RpPng::load(IRpFile *file)
  *
  * @param file IRpFile to write to.
  * @param img rp_image to save.
+ * @param profile Encoding profile.
  * @return 0 on success; negative POSIX error code on error.
  */
-int RpPng::save(IRpFile *file, const rp_image *img)
+int RpPng::save(IRpFile *file, const rp_image *img, RpPngWriter::Profile profile)
 {
 	assert(file != nullptr);
 	assert(img != nullptr);
@@ -617,8 +618,13 @@ int RpPng::save(IRpFile *file, const rp_image *img)
 	if (!pngWriter->isOpen())
 		return -pngWriter->lastError();
 
+	// Set the encoding profile.
+	int ret = pngWriter->setProfile(profile);
+	if (ret != 0)
+		return ret;
+
 	// Write the PNG IHDR.
-	int ret = pngWriter->write_IHDR();
+	ret = pngWriter->write_IHDR();
 	if (ret != 0)
 		return ret;
 
@@ -631,9 +637,10 @@ int RpPng::save(IRpFile *file, const rp_image *img)
  *
  * @param filename Destination filename.
  * @param img rp_image to save.
+ * @param profile Encoding profile.
  * @return 0 on success; negative POSIX error code on error.
  */
-int RpPng::save(const char *filename, const rp_image *img)
+int RpPng::save(const char *filename, const rp_image *img, RpPngWriter::Profile profile)
 {
 	assert(filename != nullptr);
 	assert(filename[0] != 0);
@@ -646,8 +653,13 @@ int RpPng::save(const char *filename, const rp_image *img)
 	if (!pngWriter->isOpen())
 		return -pngWriter->lastError();
 
+	// Set the encoding profile.
+	int ret = pngWriter->setProfile(profile);
+	if (ret != 0)
+		return ret;
+
 	// Write the PNG IHDR.
-	int ret = pngWriter->write_IHDR();
+	ret = pngWriter->write_IHDR();
 	if (ret != 0)
 		return ret;
 
@@ -672,9 +684,10 @@ int RpPng::save(const char *filename, const rp_image *img)
  *
  * @param file IRpFile to write to.
  * @param iconAnimData Animated image data to save.
+ * @param profile Encoding profile.
  * @return 0 on success; negative POSIX error code on error.
  */
-int RpPng::save(IRpFile *file, const IconAnimData *iconAnimData)
+int RpPng::save(IRpFile *file, const IconAnimData *iconAnimData, RpPngWriter::Profile profile)
 {
 	assert(file != nullptr);
 	assert(iconAnimData != nullptr);
@@ -686,8 +699,13 @@ int RpPng::save(IRpFile *file, const IconAnimData *iconAnimData)
 	if (!pngWriter->isOpen())
 		return -pngWriter->lastError();
 
+	// Set the encoding profile.
+	int ret = pngWriter->setProfile(profile);
+	if (ret != 0)
+		return ret;
+
 	// Write the PNG IHDR.
-	int ret = pngWriter->write_IHDR();
+	ret = pngWriter->write_IHDR();
 	if (ret != 0)
 		return ret;
 
@@ -709,9 +727,10 @@ int RpPng::save(IRpFile *file, const IconAnimData *iconAnimData)
  *
  * @param filename Destination filename.
  * @param iconAnimData Animated image data to save.
+ * @param profile Encoding profile.
  * @return 0 on success; negative POSIX error code on error.
  */
-int RpPng::save(const char *filename, const IconAnimData *iconAnimData)
+int RpPng::save(const char *filename, const IconAnimData *iconAnimData, RpPngWriter::Profile profile)
 {
 	assert(filename != nullptr);
 	assert(filename[0] != 0);
@@ -724,8 +743,13 @@ int RpPng::save(const char *filename, const IconAnimData *iconAnimData)
 	if (!pngWriter->isOpen())
 		return -pngWriter->lastError();
 
+	// Set the encoding profile.
+	int ret = pngWriter->setProfile(profile);
+	if (ret != 0)
+		return ret;
+
 	// Write the PNG IHDR.
-	int ret = pngWriter->write_IHDR();
+	ret = pngWriter->write_IHDR();
 	if (ret != 0)
 		return ret;
 
@@ -22,6 +22,7 @@
 #define __ROMPROPERTIES_LIBRPBASE_IMG_RPPNG_HPP__
 
 #include "../common.h"
+#include "RpPngWriter.hpp"
 
 namespace LibRpBase {
 
@@ -69,18 +70,22 @@ class RpPng
 		 *
 		 * @param file IRpFile to write to.
 		 * @param img rp_image to save.
+		 * @param profile Encoding profile.
 		 * @return 0 on success; negative POSIX error code on error.
 		 */
-		static int save(IRpFile *file, const rp_image *img);
+		static int save(IRpFile *file, const rp_image *img,
+			RpPngWriter::Profile profile = RpPngWriter::PROFILE_DEFAULT);
 
 		/**
 		 * Save an image in PNG format to a file.
 		 *
 		 * @param filename Destination filename.
 		 * @param img rp_image to save.
+		 * @param profile Encoding profile.
 		 * @return 0 on success; negative POSIX error code on error.
 		 */
-		static int save(const char *filename, const rp_image *img);
+		static int save(const char *filename, const rp_image *img,
+			RpPngWriter::Profile profile = RpPngWriter::PROFILE_DEFAULT);
 
 		/**
 		 * Save an animated image in APNG format to an IRpFile.
@@ -99,9 +104,11 @@ class RpPng
 		 *
 		 * @param file IRpFile to write to.
 		 * @param iconAnimData Animated image data to save.
+		 * @param profile Encoding profile.
 		 * @return 0 on success; negative POSIX error code on error.
 		 */
-		static int save(IRpFile *file, const IconAnimData *iconAnimData);
+		static int save(IRpFile *file, const IconAnimData *iconAnimData,
+			RpPngWriter::Profile profile = RpPngWriter::PROFILE_DEFAULT);
 
 		/**
 		 * Save an animated image in APNG format to a file.
@@ -116,9 +123,11 @@ class RpPng
 		 *
 		 * @param filename Destination filename.
 		 * @param iconAnimData Animated image data to save.
+		 * @param profile Encoding profile.
 		 * @return 0 on success; negative POSIX error code on error.
 		 */
-		static int save(const char *filename, const IconAnimData *iconAnimData);
+		static int save(const char *filename, const IconAnimData *iconAnimData,
+			RpPngWriter::Profile profile = RpPngWriter::PROFILE_DEFAULT);
 };
 
 }
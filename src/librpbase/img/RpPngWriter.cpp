@@ -25,12 +25,14 @@
 #include "byteorder.h"
 #include "TextFuncs.hpp"
 #include "file/RpFile.hpp"
+#include "file/FileSystem.hpp"
 
 // APNG
 #include "img/IconAnimData.hpp"
 #include "APNG_dlopen.h"
 
-// libpng
+// zlib and libpng
+#include <zlib.h>
 #include <png.h>
 
 #if PNG_LIBPNG_VER < 10209 || \
@@ -83,6 +85,7 @@
 #include <cassert>
 #include <cerrno>
 #include <csetjmp>
+#include <cstring>
 
 // C++ includes.
 #include <memory>
@@ -93,8 +96,6 @@ using std::unique_ptr;
 using std::vector;
 
 #if defined(_MSC_VER) && (defined(ZLIB_IS_DLL) || defined(PNG_IS_DLL))
-// Need zlib for delay-load checks.
-#include <zlib.h>
 // MSVC: Exception handling for /DELAYLOAD.
 #include "libwin32common/DelayLoadHelper.h"
 #endif /* defined(_MSC_VER) && (defined(ZLIB_IS_DLL) || defined(PNG_IS_DLL)) */
@@ -128,25 +129,42 @@ class RpPngWriterPrivate
 		RpPngWriterPrivate(IRpFile *file, int width, int height, rp_image::Format format)
 			: lastError(0), file(nullptr), imageTag(IMGT_INVALID)
 			, png_ptr(nullptr), info_ptr(nullptr), IHDR_written(false)
+			, profile(RpPngWriter::PROFILE_DEFAULT)
+			, APNG_loaded(false), frame_count(0), frames_written(0), prevFrame(nullptr)
 		{
 			init(file, width, height, format);
 		}
 		RpPngWriterPrivate(IRpFile *file, const rp_image *img)
 			: lastError(0), file(nullptr), imageTag(IMGT_INVALID)
 			, png_ptr(nullptr), info_ptr(nullptr), IHDR_written(false)
+			, profile(RpPngWriter::PROFILE_DEFAULT)
+			, APNG_loaded(false), frame_count(0), frames_written(0), prevFrame(nullptr)
 		{
 			init(file, img);
 		}
 		RpPngWriterPrivate(IRpFile *file, const IconAnimData *iconAnimData)
 			: lastError(0), file(nullptr), imageTag(IMGT_INVALID)
 			, png_ptr(nullptr), info_ptr(nullptr), IHDR_written(false)
+			, profile(RpPngWriter::PROFILE_DEFAULT)
+			, APNG_loaded(false), frame_count(0), frames_written(0), prevFrame(nullptr)
 		{
 			init(file, iconAnimData);
 		}
 
+		RpPngWriterPrivate(IRpFile *file, int width, int height, rp_image::Format format, int frame_count)
+			: lastError(0), file(nullptr), imageTag(IMGT_INVALID)
+			, png_ptr(nullptr), info_ptr(nullptr), IHDR_written(false)
+			, profile(RpPngWriter::PROFILE_DEFAULT)
+			, APNG_loaded(false), frame_count(0), frames_written(0), prevFrame(nullptr)
+		{
+			init(file, width, height, format, frame_count);
+		}
+
 		RpPngWriterPrivate(const char *filename, int width, int height, rp_image::Format format)
 			: lastError(0), file(nullptr), imageTag(IMGT_INVALID)
 			, png_ptr(nullptr), info_ptr(nullptr), IHDR_written(false)
+			, profile(RpPngWriter::PROFILE_DEFAULT)
+			, APNG_loaded(false), frame_count(0), frames_written(0), prevFrame(nullptr)
 		{
 			RpFile *const file = (filename ? new RpFile(filename, RpFile::FM_CREATE_WRITE) : nullptr);
 			init(file, width, height, format);
@@ -155,6 +173,8 @@ class RpPngWriterPrivate
 		RpPngWriterPrivate(const char *filename, const rp_image *img)
 			: lastError(0), file(nullptr), imageTag(IMGT_INVALID)
 			, png_ptr(nullptr), info_ptr(nullptr), IHDR_written(false)
+			, profile(RpPngWriter::PROFILE_DEFAULT)
+			, APNG_loaded(false), frame_count(0), frames_written(0), prevFrame(nullptr)
 		{
 			RpFile *const file = (filename ? new RpFile(filename, RpFile::FM_CREATE_WRITE) : nullptr);
 			init(file, img);
@@ -163,11 +183,27 @@ class RpPngWriterPrivate
 		RpPngWriterPrivate(const char *filename, const IconAnimData *iconAnimData)
 			: lastError(0), file(nullptr), imageTag(IMGT_INVALID)
 			, png_ptr(nullptr), info_ptr(nullptr), IHDR_written(false)
+			, profile(RpPngWriter::PROFILE_DEFAULT)
+			, APNG_loaded(false), frame_count(0), frames_written(0), prevFrame(nullptr)
 		{
 			RpFile *const file = (filename ? new RpFile(filename, RpFile::FM_CREATE_WRITE) : nullptr);
 			init(file, iconAnimData);
 			file->unref();
 		}
+		RpPngWriterPrivate(const char *filename, int width, int height, rp_image::Format format, int frame_count)
+			: lastError(0), file(nullptr), imageTag(IMGT_INVALID)
+			, png_ptr(nullptr), info_ptr(nullptr), IHDR_written(false)
+			, profile(RpPngWriter::PROFILE_DEFAULT)
+			, APNG_loaded(false), frame_count(0), frames_written(0), prevFrame(nullptr)
+		{
+			RpFile *const file = (filename ? new RpFile(filename, RpFile::FM_CREATE_WRITE) : nullptr);
+			init(file, width, height, format, frame_count);
+			if (this->file) {
+				// Delete the file if the stream isn't finished.
+				stream_filename = filename;
+			}
+			file->unref();
+		}
 
 		~RpPngWriterPrivate();
 	private:
@@ -175,6 +211,7 @@ class RpPngWriterPrivate
 		void init(IRpFile *file, int width, int height, rp_image::Format format);
 		void init(IRpFile *file, const rp_image *img);
 		void init(IRpFile *file, const IconAnimData *iconAnimData);
+		void init(IRpFile *file, int width, int height, rp_image::Format format, int frame_count);
 
 	private:
 		RP_DISABLE_COPY(RpPngWriterPrivate)
@@ -193,6 +230,7 @@ class RpPngWriterPrivate
 			IMGT_RAW,		// Raw image.
 			IMGT_RP_IMAGE,		// rp_image
 			IMGT_ICONANIMDATA,	// iconAnimData
+			IMGT_APNG_STREAM,	// Animated image, written one frame at a time.
 		} imageTag;
 		union {
 			const rp_image *img;
@@ -285,6 +323,18 @@ class RpPngWriterPrivate
 		// Current state.
 		bool IHDR_written;
 
+		// Encoding profile.
+		RpPngWriter::Profile profile;
+
+		// Set if APNG_ref() was called.
+		bool APNG_loaded;
+
+		// APNG streaming state.
+		int frame_count;	// Total number of frames.
+		int frames_written;	// Number of frames written so far.
+		rp_image *prevFrame;	// Copy of the previous frame. (Only if frame_count > 1.)
+		string stream_filename;		// Filename to delete if not all frames were written.
+
 	public:
 		/**
 		 * Initialize the PNG write structs.
@@ -322,6 +372,34 @@ class RpPngWriterPrivate
 		 */
 		int write_CI8_palette(void);
 
+		/**
+		 * Set the libpng filter and zlib parameters
+		 * for the current encoding profile.
+		 * NOTE: cache.format must be set.
+		 */
+		void set_compression_params(void);
+
+		/**
+		 * Set the libpng pixel transformations for writing image data.
+		 * @param is_abgr If true, image data is ABGR instead of ARGB.
+		 */
+		void set_transformations(bool is_abgr = false);
+
+		/**
+		 * Write an APNG frame.
+		 * Only the region that differs from the previous frame is stored.
+		 *
+		 * NOTE: This must be called with a valid setjmp() context.
+		 *
+		 * @param img		[in] Frame image.
+		 * @param prev		[in,opt] Previous frame, or nullptr if this is the first frame.
+		 * @param row_pointers	[in] Row pointer buffer. (must have cache.height elements)
+		 * @param delay_numer	[in] Delay numerator.
+		 * @param delay_denom	[in] Delay denominator.
+		 */
+		void write_APNG_frame(const rp_image *img, const rp_image *prev,
+			const png_byte **row_pointers, uint16_t delay_numer, uint16_t delay_denom);
+
 		/**
 		 * Write raw image data to the PNG image.
 		 *
@@ -359,6 +437,18 @@ class RpPngWriterPrivate
 		 * @return 0 on success; negative POSIX error code on error.
 		 */
 		int write_IDAT_APNG(void);
+
+		/**
+		 * Write a frame to a streaming APNG image.
+		 *
+		 * If this is the last frame, the file will be closed.
+		 *
+		 * @param img		[in] Frame image.
+		 * @param delay_numer	[in] Delay numerator.
+		 * @param delay_denom	[in] Delay denominator.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int write_frame(const rp_image *img, uint16_t delay_numer, uint16_t delay_denom);
 };
 
 /** RpPngWriterPrivate **/
@@ -510,9 +600,14 @@ void RpPngWriterPrivate::init(IRpFile *file, const IconAnimData *iconAnimData)
 		int ret = APNG_ref();
 		if (ret != 0) {
 			// Error loading APNG.
+			// NOTE: APNG_unref() must be called even if
+			// APNG_ref() failed. Otherwise, the next call
+			// to APNG_ref() will incorrectly succeed.
+			APNG_unref();
 			lastError = ENOTSUP;
 			return;
 		}
+		APNG_loaded = true;
 		imageTag = IMGT_ICONANIMDATA;
 	} else {
 		imageTag = IMGT_RP_IMAGE;
@@ -571,11 +666,50 @@ void RpPngWriterPrivate::init(IRpFile *file, const IconAnimData *iconAnimData)
 	}
 }
 
+void RpPngWriterPrivate::init(IRpFile *file, int width, int height, rp_image::Format format, int frame_count)
+{
+	if (frame_count <= 0) {
+		// Invalid parameters.
+		lastError = EINVAL;
+		return;
+	}
+
+	if (frame_count > 1) {
+		// Load APNG.
+		int ret = APNG_ref();
+		if (ret != 0) {
+			// Error loading APNG.
+			// NOTE: APNG_unref() must be called even if
+			// APNG_ref() failed. Otherwise, the next call
+			// to APNG_ref() will incorrectly succeed.
+			APNG_unref();
+			lastError = ENOTSUP;
+			return;
+		}
+		APNG_loaded = true;
+	}
+
+	// Initialize as a raw image.
+	init(file, width, height, format);
+	if (imageTag != IMGT_RAW) {
+		// Initialization failed.
+		return;
+	}
+
+	imageTag = IMGT_APNG_STREAM;
+	this->frame_count = frame_count;
+	if (frame_count > 1) {
+		// Previous frame buffer for calculating the changed region.
+		prevFrame = new rp_image(width, height, format);
+	}
+}
+
 RpPngWriterPrivate::~RpPngWriterPrivate()
 {
 	this->close();
+	delete prevFrame;
 
-	if (imageTag == IMGT_ICONANIMDATA) {
+	if (APNG_loaded) {
 		// Unreference APNG.
 		APNG_unref();
 	}
@@ -611,8 +745,19 @@ int RpPngWriterPrivate::init_png_write_structs(void)
  */
 void RpPngWriterPrivate::close(void)
 {
+	// If this is an APNG stream, the acTL chunk has the total
+	// number of frames. If fewer frames were written, the file
+	// is invalid, so it must be discarded.
+	const bool incomplete = (file && imageTag == IMGT_APNG_STREAM &&
+		frames_written < frame_count);
+
 	// Close libpng.
-	if (png_ptr || info_ptr) {
+	if (incomplete) {
+		// Don't finish writing the PNG file.
+		png_destroy_write_struct(&png_ptr, &info_ptr);
+		png_ptr = nullptr;
+		info_ptr = nullptr;
+	} else if (png_ptr || info_ptr) {
 		// If PNG write failed, png_write_end()
 		// may call longjmp().
 #ifdef PNG_SETJMP_SUPPORTED
@@ -631,9 +776,24 @@ void RpPngWriterPrivate::close(void)
 		info_ptr = nullptr;
 	}
 
+	if (incomplete) {
+		// Discard the partially-written file.
+		file->truncate(0);
+		if (lastError == 0) {
+			lastError = EIO;
+		}
+	}
+
 	// unref() the file.
-	this->file->unref();
-	this->file = nullptr;
+	if (this->file) {
+		this->file->unref();
+		this->file = nullptr;
+	}
+
+	if (incomplete && !stream_filename.empty()) {
+		// We created the file, so delete it.
+		FileSystem::delete_file(stream_filename);
+	}
 }
 
 /**
@@ -720,6 +880,185 @@ int RpPngWriterPrivate::write_CI8_palette(void)
 	return 0;
 }
 
+/**
+ * Set the libpng filter and zlib parameters
+ * for the current encoding profile.
+ * NOTE: cache.format must be set.
+ */
+void RpPngWriterPrivate::set_compression_params(void)
+{
+	// Paletted images rarely benefit from filtering,
+	// so filters are only enabled for ARGB32.
+	const bool can_filter = (cache.format == rp_image::FORMAT_ARGB32);
+
+	switch (profile) {
+		default:
+			assert(!"Invalid encoding profile.");
+			// fall-through
+		case RpPngWriter::PROFILE_DEFAULT:
+			png_set_filter(png_ptr, 0, PNG_FILTER_NONE);
+			png_set_compression_level(png_ptr, PNG_Z_DEFAULT_COMPRESSION);
+			break;
+
+		case RpPngWriter::PROFILE_FAST:
+			// Sub and Up are the cheapest filters that still
+			// help with gradients. Z_RLE skips most of the
+			// match searching, which is where zlib spends
+			// most of its time.
+			png_set_filter(png_ptr, 0, (can_filter
+				? (PNG_FILTER_SUB | PNG_FILTER_UP)
+				: PNG_FILTER_NONE));
+			png_set_compression_level(png_ptr, Z_BEST_SPEED);
+			png_set_compression_strategy(png_ptr, Z_RLE);
+			break;
+
+		case RpPngWriter::PROFILE_SMALL:
+			png_set_filter(png_ptr, 0, (can_filter
+				? PNG_ALL_FILTERS
+				: PNG_FILTER_NONE));
+			png_set_compression_level(png_ptr, Z_BEST_COMPRESSION);
+			png_set_compression_mem_level(png_ptr, MAX_MEM_LEVEL);
+			break;
+	}
+}
+
+/**
+ * Set the libpng pixel transformations for writing image data.
+ * @param is_abgr If true, image data is ABGR instead of ARGB.
+ */
+void RpPngWriterPrivate::set_transformations(bool is_abgr)
+{
+	// TODO: Byteswap image data on big-endian systems?
+	//png_set_swap(png_ptr);
+
+	// TODO: What format on big-endian?
+	if (!is_abgr) {
+		png_set_bgr(png_ptr);
+	}
+
+#ifdef PNG_sBIT_SUPPORTED
+	if (cache.skip_alpha && cache.format == rp_image::FORMAT_ARGB32) {
+		// Need to skip the alpha bytes.
+		// Assuming 'after' on LE, 'before' on BE.
+#if SYS_BYTEORDER == SYS_LIL_ENDIAN
+		static const int flags = PNG_FILLER_AFTER;
+#else /* SYS_BYTEORDER == SYS_BIG_ENDIAN */
+		static const int flags = PNG_FILLER_BEFORE;
+#endif
+		png_set_filler(png_ptr, 0xFF, flags);
+	}
+#endif /* PNG_sBIT_SUPPORTED */
+}
+
+/**
+ * Calculate the region of an animated image frame
+ * that differs from the previous frame.
+ *
+ * If the frames are identical, a 1x1 region at the
+ * origin is returned, since APNG frames can't be empty.
+ *
+ * @param prev		[in] Previous frame.
+ * @param img		[in] Current frame.
+ * @param bytespp	[in] Bytes per pixel.
+ * @param pX		[out] X offset.
+ * @param pY		[out] Y offset.
+ * @param pW		[out] Width.
+ * @param pH		[out] Height.
+ */
+static void calc_changed_rect(const rp_image *prev, const rp_image *img, int bytespp,
+	int *pX, int *pY, int *pW, int *pH)
+{
+	const int width = img->width();
+	const int height = img->height();
+	const size_t row_bytes = static_cast<size_t>(width) * bytespp;
+
+	// Find the first and last rows that changed.
+	int top = 0;
+	while (top < height && !memcmp(prev->scanLine(top), img->scanLine(top), row_bytes)) {
+		top++;
+	}
+	if (top == height) {
+		// Frames are identical.
+		*pX = 0; *pY = 0;
+		*pW = 1; *pH = 1;
+		return;
+	}
+	int bottom = height - 1;
+	while (bottom > top && !memcmp(prev->scanLine(bottom), img->scanLine(bottom), row_bytes)) {
+		bottom--;
+	}
+
+	// Find the first and last columns that changed.
+	int left = width, right = -1;
+	for (int y = top; y <= bottom; y++) {
+		const uint8_t *const p = static_cast<const uint8_t*>(prev->scanLine(y));
+		const uint8_t *const c = static_cast<const uint8_t*>(img->scanLine(y));
+		for (int x = 0; x < left; x++) {
+			if (memcmp(&p[x * bytespp], &c[x * bytespp], bytespp) != 0) {
+				left = x;
+				break;
+			}
+		}
+		for (int x = width - 1; x > right; x--) {
+			if (memcmp(&p[x * bytespp], &c[x * bytespp], bytespp) != 0) {
+				right = x;
+				break;
+			}
+		}
+	}
+
+	assert(left <= right);
+	*pX = left;
+	*pY = top;
+	*pW = right - left + 1;
+	*pH = bottom - top + 1;
+}
+
+/**
+ * Write an APNG frame.
+ * Only the region that differs from the previous frame is stored.
+ *
+ * NOTE: This must be called with a valid setjmp() context.
+ *
+ * @param img		[in] Frame image.
+ * @param prev		[in,opt] Previous frame, or nullptr if this is the first frame.
+ * @param row_pointers	[in] Row pointer buffer. (must have cache.height elements)
+ * @param delay_numer	[in] Delay numerator.
+ * @param delay_denom	[in] Delay denominator.
+ */
+void RpPngWriterPrivate::write_APNG_frame(const rp_image *img, const rp_image *prev,
+	const png_byte **row_pointers, uint16_t delay_numer, uint16_t delay_denom)
+{
+	const int bytespp = (cache.format == rp_image::FORMAT_ARGB32 ? 4 : 1);
+
+	// The first frame must cover the entire image.
+	int x = 0, y = 0, w = cache.width, h = cache.height;
+	if (prev) {
+		calc_changed_rect(prev, img, bytespp, &x, &y, &w, &h);
+	}
+
+	// Initialize the row pointers array.
+	for (int row = h-1; row >= 0; row--) {
+		row_pointers[row] = static_cast<const png_byte*>(img->scanLine(y + row)) + (x * bytespp);
+	}
+
+	// Frame header.
+	// The unchanged area is kept from the previous frame,
+	// and the changed area replaces it entirely.
+	png_write_frame_head(png_ptr, info_ptr, (png_bytepp)row_pointers,
+			w, h, x, y,
+			delay_numer, delay_denom,
+			PNG_DISPOSE_OP_NONE,
+			PNG_BLEND_OP_SOURCE);
+
+	// Write the image data.
+	// TODO: Individual palette for CI8?
+	png_write_image(png_ptr, (png_bytepp)row_pointers);
+
+	// Frame tail.
+	png_write_frame_tail(png_ptr, info_ptr);
+}
+
 /**
  * Write raw image data to the PNG image.
  *
@@ -757,24 +1096,8 @@ int RpPngWriterPrivate::write_IDAT(const png_byte *const *row_pointers, bool is_
 	}
 #endif /* PNG_SETJMP_SUPPORTED */
 
-	// TODO: Byteswap image data on big-endian systems?
-	//png_set_swap(png_ptr);
-
-	// TODO: What format on big-endian?
-	if (!is_abgr) {
-		png_set_bgr(png_ptr);
-	}
-
-	if (cache.skip_alpha && cache.format == rp_image::FORMAT_ARGB32) {
-		// Need to skip the alpha bytes.
-		// Assuming 'after' on LE, 'before' on BE.
-#if SYS_BYTEORDER == SYS_LIL_ENDIAN
-		static const int flags = PNG_FILLER_AFTER;
-#else /* SYS_BYTEORDER == SYS_BIG_ENDIAN */
-		static const int flags = PNG_FILLER_BEFORE;
-#endif
-		png_set_filler(png_ptr, 0xFF, flags);
-	}
+	// Set the pixel transformations.
+	set_transformations(is_abgr);
 
 	// Write the image data.
 	png_write_image(png_ptr, const_cast<png_bytepp>(row_pointers));
@@ -873,10 +1196,8 @@ int RpPngWriterPrivate::write_IDAT_APNG(void)
 	}
 #endif /* PNG_SETJMP_SUPPORTED */
 
-	// TODO: Byteswap image data on big-endian systems?
-	//ppng_set_swap(png_ptr);
-	// TODO: What format on big-endian?
-	png_set_bgr(png_ptr);
+	// Set the pixel transformations.
+	set_transformations();
 
 	// Allocate the row pointers.
 	row_pointers = static_cast<const png_byte**>(
@@ -887,30 +1208,18 @@ int RpPngWriterPrivate::write_IDAT_APNG(void)
 	}
 
 	// Write the images.
+	// Each frame only stores the region that changed
+	// since the previous frame in the sequence.
+	const rp_image *prev = nullptr;
 	for (int i = 0; i < iconAnimData->seq_count; i++) {
 		const rp_image *img = iconAnimData->frames[iconAnimData->seq_index[i]];
 		if (!img)
 			break;
 
-		// Initialize the row pointers array.
-		for (int y = cache.height-1; y >= 0; y--) {
-			row_pointers[y] = static_cast<const png_byte*>(img->scanLine(y));
-		}
-
-		// Frame header.
-		png_write_frame_head(png_ptr, info_ptr, (png_bytepp)row_pointers,
-				cache.width, cache.height, 0, 0,	// width, height, x offset, y offset
-				iconAnimData->delays[i].numer,
-				iconAnimData->delays[i].denom,
-				PNG_DISPOSE_OP_NONE,
-				PNG_BLEND_OP_SOURCE);
-
-		// Write the image data.
-		// TODO: Individual palette for CI8?
-		png_write_image(png_ptr, (png_bytepp)row_pointers);
-
-		// Frame tail.
-		png_write_frame_tail(png_ptr, info_ptr);
+		write_APNG_frame(img, prev, row_pointers,
+			iconAnimData->delays[i].numer,
+			iconAnimData->delays[i].denom);
+		prev = img;
 	}
 
 	png_free(png_ptr, row_pointers);
@@ -926,6 +1235,88 @@ int RpPngWriterPrivate::write_IDAT_APNG(void)
 	return 0;
 }
 
+/**
+ * Write a frame to a streaming APNG image.
+ *
+ * If this is the last frame, the file will be closed.
+ *
+ * @param img		[in] Frame image.
+ * @param delay_numer	[in] Delay numerator.
+ * @param delay_denom	[in] Delay denominator.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int RpPngWriterPrivate::write_frame(const rp_image *img, uint16_t delay_numer, uint16_t delay_denom)
+{
+	assert(file != nullptr);
+	assert(imageTag == IMGT_APNG_STREAM);
+	assert(IHDR_written);
+	if (unlikely(!file || imageTag != IMGT_APNG_STREAM || frames_written >= frame_count)) {
+		// Invalid state.
+		lastError = EIO;
+		return -lastError;
+	}
+	if (unlikely(!IHDR_written)) {
+		// IHDR has not been written yet.
+		// TODO: Better error code?
+		lastError = EIO;
+		return -lastError;
+	}
+
+	// Row pointers. (NOTE: Allocated after setjmp().)
+	const png_byte **row_pointers = nullptr;
+
+#ifdef PNG_SETJMP_SUPPORTED
+	// WARNING: Do NOT initialize any C++ objects past this point!
+	if (setjmp(png_jmpbuf(png_ptr))) {
+		// PNG write failed.
+		png_free(png_ptr, row_pointers);
+		lastError = EIO;
+		return -lastError;
+	}
+#endif /* PNG_SETJMP_SUPPORTED */
+
+	if (frames_written == 0) {
+		// Set the pixel transformations.
+		set_transformations();
+	}
+
+	// Allocate the row pointers.
+	row_pointers = static_cast<const png_byte**>(
+		png_malloc(png_ptr, sizeof(const png_byte*) * cache.height));
+	if (!row_pointers) {
+		lastError = ENOMEM;
+		return -lastError;
+	}
+
+	if (frame_count == 1) {
+		// Single frame. Write a standard PNG image.
+		for (int y = cache.height-1; y >= 0; y--) {
+			row_pointers[y] = static_cast<const png_byte*>(img->scanLine(y));
+		}
+		png_write_image(png_ptr, (png_bytepp)row_pointers);
+	} else {
+		write_APNG_frame(img, (frames_written > 0 ? prevFrame : nullptr),
+			row_pointers, delay_numer, delay_denom);
+	}
+
+	png_free(png_ptr, row_pointers);
+	row_pointers = nullptr;
+	frames_written++;
+
+	if (frames_written < frame_count) {
+		// Save this frame for comparison with the next frame.
+		const size_t row_bytes = static_cast<size_t>(cache.width) *
+			(cache.format == rp_image::FORMAT_ARGB32 ? 4 : 1);
+		for (int y = cache.height-1; y >= 0; y--) {
+			memcpy(prevFrame->scanLine(y), img->scanLine(y), row_bytes);
+		}
+	} else {
+		// Last frame. Finish writing the file.
+		close();
+	}
+	return 0;
+}
+
 /** RpPngWriter **/
 
 /**
@@ -1059,6 +1450,61 @@ RpPngWriter::RpPngWriter(IRpFile *file, int width, int height, rp_image::Format
 	: d_ptr(new RpPngWriterPrivate(file, width, height, format))
 { }
 
+/**
+ * Write an animated image to an APNG file, one frame at a time.
+ *
+ * Check isOpen() after constructing to verify that
+ * the file was opened.
+ *
+ * If frame_count is 1, a standard PNG image will be written.
+ *
+ * NOTE: If frame_count is more than 1 and APNG write
+ * support is unavailable, -ENOTSUP will be set as the
+ * last error. The caller should then save the first
+ * frame as a standard PNG file.
+ *
+ * NOTE 2: If the writer is destroyed before all frames
+ * are written, the file is deleted, since the frame count
+ * in the acTL chunk would be wrong.
+ *
+ * @param filename	[in] Filename.
+ * @param width		[in] Image width.
+ * @param height	[in] Image height.
+ * @param format	[in] Image format.
+ * @param frame_count	[in] Number of frames that will be written.
+ */
+RpPngWriter::RpPngWriter(const char *filename, int width, int height, rp_image::Format format, int frame_count)
+	: d_ptr(new RpPngWriterPrivate(filename, width, height, format, frame_count))
+{ }
+
+/**
+ * Write an animated image to an APNG file, one frame at a time.
+ * IRpFile must be open for writing.
+ *
+ * Check isOpen() after constructing to verify that
+ * the file was opened.
+ *
+ * If frame_count is 1, a standard PNG image will be written.
+ *
+ * NOTE: If frame_count is more than 1 and APNG write
+ * support is unavailable, -ENOTSUP will be set as the
+ * last error. The caller should then save the first
+ * frame as a standard PNG file.
+ *
+ * NOTE 2: If the writer is destroyed before all frames
+ * are written, the file is truncated, since the frame count
+ * in the acTL chunk would be wrong.
+ *
+ * @param file		[in] IRpFile open for writing.
+ * @param width		[in] Image width.
+ * @param height	[in] Image height.
+ * @param format	[in] Image format.
+ * @param frame_count	[in] Number of frames that will be written.
+ */
+RpPngWriter::RpPngWriter(IRpFile *file, int width, int height, rp_image::Format format, int frame_count)
+	: d_ptr(new RpPngWriterPrivate(file, width, height, format, frame_count))
+{ }
+
 RpPngWriter::~RpPngWriter()
 {
 	delete d_ptr;
@@ -1093,6 +1539,53 @@ void RpPngWriter::close(void)
 	d->close();
 }
 
+/**
+ * Get an encoding profile from its name.
+ * Valid names are "default", "fast", and "small". (case-insensitive)
+ * @param name Profile name.
+ * @return Profile, or -1 if the name is invalid.
+ */
+int RpPngWriter::profileFromName(const char *name)
+{
+	static const char *const profile_names[] = {
+		"default", "fast", "small",
+	};
+	static_assert(ARRAY_SIZE(profile_names) == PROFILE_MAX, "profile_names[] is the wrong size.");
+
+	if (!name)
+		return -1;
+	for (int i = 0; i < ARRAY_SIZE(profile_names); i++) {
+		if (!strcasecmp(name, profile_names[i])) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+/**
+ * Set the encoding profile.
+ * This must be called before write_IHDR().
+ * @param profile Encoding profile.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int RpPngWriter::setProfile(Profile profile)
+{
+	RP_D(RpPngWriter);
+	assert(profile >= PROFILE_DEFAULT && profile < PROFILE_MAX);
+	assert(!d->IHDR_written);
+	if (unlikely(profile < PROFILE_DEFAULT || profile >= PROFILE_MAX)) {
+		return -EINVAL;
+	}
+	if (unlikely(d->IHDR_written)) {
+		// Compression parameters are set by write_IHDR().
+		d->lastError = EEXIST;
+		return -d->lastError;
+	}
+
+	d->profile = profile;
+	return 0;
+}
+
 /**
  * Write the PNG IHDR.
  * This must be called before writing any other image data.
@@ -1128,9 +1621,7 @@ int RpPngWriter::write_IHDR(void)
 #endif /* PNG_SETJMP_SUPPORTED */
 
 	// Initialize compression parameters.
-	// TODO: Customizable?
-	png_set_filter(d->png_ptr, 0, PNG_FILTER_NONE);
-	png_set_compression_level(d->png_ptr, PNG_Z_DEFAULT_COMPRESSION);
+	d->set_compression_params();
 
 	// Write the PNG header.
 	switch (d->cache.format) {
@@ -1182,6 +1673,9 @@ int RpPngWriter::write_IHDR(void)
 	if (d->imageTag == RpPngWriterPrivate::IMGT_ICONANIMDATA) {
 		// Write an acTL chunk to indicate that this is an APNG image.
 		png_set_acTL(d->png_ptr, d->info_ptr, d->iconAnimData->seq_count, 0);
+	} else if (d->imageTag == RpPngWriterPrivate::IMGT_APNG_STREAM && d->frame_count > 1) {
+		// Write an acTL chunk to indicate that this is an APNG image.
+		png_set_acTL(d->png_ptr, d->info_ptr, d->frame_count, 0);
 	}
 
 #ifdef PNG_sBIT_SUPPORTED
@@ -1204,8 +1698,8 @@ int RpPngWriter::write_IHDR(void)
  * This must be called before writing any other image data.
  *
  * This function sets the cached sBIT before writing IHDR.
- * It should only be used for raw images. Use write_IHDR()
- * for rp_image and IconAnimData.
+ * It should only be used for raw images and streaming APNG
+ * images. Use write_IHDR() for rp_image and IconAnimData.
  *
  * @param sBIT		[in] sBIT metadata.
  * @param palette	[in,opt] Palette for CI8 images.
@@ -1215,8 +1709,11 @@ int RpPngWriter::write_IHDR(void)
 int RpPngWriter::write_IHDR(const rp_image::sBIT_t *sBIT, const uint32_t *palette, int palette_len)
 {
 	RP_D(RpPngWriter);
-	assert(d->imageTag == RpPngWriterPrivate::IMGT_RAW);
-	if (d->imageTag != RpPngWriterPrivate::IMGT_RAW) {
+	assert(d->imageTag == RpPngWriterPrivate::IMGT_RAW ||
+	       d->imageTag == RpPngWriterPrivate::IMGT_APNG_STREAM);
+	if (d->imageTag != RpPngWriterPrivate::IMGT_RAW &&
+	    d->imageTag != RpPngWriterPrivate::IMGT_APNG_STREAM)
+	{
 		// Can't be used for this type.
 		return -EINVAL;
 	}
@@ -1471,4 +1968,44 @@ int RpPngWriter::write_IDAT(void)
 	return ret;
 }
 
+/**
+ * Write a frame to a streaming APNG image.
+ *
+ * write_IHDR() must be called before writing any frames.
+ * Only the region that changed since the previous frame
+ * is stored in the file, so the caller does not need to
+ * keep previous frames around.
+ *
+ * After the last frame is written, the file will be closed.
+ *
+ * NOTE: CI8 frames must use the palette specified in write_IHDR().
+ *
+ * @param img		[in] Frame image. (must match the constructor's width, height, and format)
+ * @param delay_numer	[in] Delay numerator.
+ * @param delay_denom	[in] Delay denominator.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int RpPngWriter::write_frame(const rp_image *img, uint16_t delay_numer, uint16_t delay_denom)
+{
+	RP_D(RpPngWriter);
+	assert(d->imageTag == RpPngWriterPrivate::IMGT_APNG_STREAM);
+	if (unlikely(d->imageTag != RpPngWriterPrivate::IMGT_APNG_STREAM)) {
+		// Can't be used for this type.
+		return -EINVAL;
+	}
+
+	assert(img != nullptr);
+	assert(img->isValid());
+	if (unlikely(!img || !img->isValid() ||
+	    img->width() != d->cache.width ||
+	    img->height() != d->cache.height ||
+	    img->format() != d->cache.format))
+	{
+		// Frame doesn't match the image parameters.
+		return -EINVAL;
+	}
+
+	return d->write_frame(img, delay_numer, delay_denom);
+}
+
 }
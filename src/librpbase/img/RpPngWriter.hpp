@@ -156,6 +156,57 @@ class RpPngWriter
 		 */
 		RpPngWriter(IRpFile *file, const IconAnimData *iconAnimData);
 
+		/**
+		 * Write an animated image to an APNG file, one frame at a time.
+		 *
+		 * Check isOpen() after constructing to verify that
+		 * the file was opened.
+		 *
+		 * If frame_count is 1, a standard PNG image will be written.
+		 *
+		 * NOTE: If frame_count is more than 1 and APNG write
+		 * support is unavailable, -ENOTSUP will be set as the
+		 * last error. The caller should then save the first
+		 * frame as a standard PNG file.
+		 *
+		 * NOTE 2: If the writer is destroyed before all frames
+		 * are written, the file is deleted, since the frame count
+		 * in the acTL chunk would be wrong.
+		 *
+		 * @param filename	[in] Filename.
+		 * @param width		[in] Image width.
+		 * @param height	[in] Image height.
+		 * @param format	[in] Image format.
+		 * @param frame_count	[in] Number of frames that will be written.
+		 */
+		RpPngWriter(const char *filename, int width, int height, rp_image::Format format, int frame_count);
+
+		/**
+		 * Write an animated image to an APNG file, one frame at a time.
+		 * IRpFile must be open for writing.
+		 *
+		 * Check isOpen() after constructing to verify that
+		 * the file was opened.
+		 *
+		 * If frame_count is 1, a standard PNG image will be written.
+		 *
+		 * NOTE: If frame_count is more than 1 and APNG write
+		 * support is unavailable, -ENOTSUP will be set as the
+		 * last error. The caller should then save the first
+		 * frame as a standard PNG file.
+		 *
+		 * NOTE 2: If the writer is destroyed before all frames
+		 * are written, the file is truncated, since the frame count
+		 * in the acTL chunk would be wrong.
+		 *
+		 * @param file		[in] IRpFile open for writing.
+		 * @param width		[in] Image width.
+		 * @param height	[in] Image height.
+		 * @param format	[in] Image format.
+		 * @param frame_count	[in] Number of frames that will be written.
+		 */
+		RpPngWriter(IRpFile *file, int width, int height, rp_image::Format format, int frame_count);
+
 		~RpPngWriter();
 
 	private:
@@ -181,6 +232,34 @@ class RpPngWriter
 		 */
 		void close(void);
 
+		/**
+		 * PNG encoding profile.
+		 * Trades encoding speed for output size.
+		 */
+		enum Profile {
+			PROFILE_DEFAULT	= 0,	// No filtering; default zlib level.
+			PROFILE_FAST	= 1,	// Cheap adaptive filtering; zlib level 1 with RLE.
+			PROFILE_SMALL	= 2,	// All filters; maximum zlib level.
+
+			PROFILE_MAX
+		};
+
+		/**
+		 * Get an encoding profile from its name.
+		 * Valid names are "default", "fast", and "small". (case-insensitive)
+		 * @param name Profile name.
+		 * @return Profile, or -1 if the name is invalid.
+		 */
+		static int profileFromName(const char *name);
+
+		/**
+		 * Set the encoding profile.
+		 * This must be called before write_IHDR().
+		 * @param profile Encoding profile.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int setProfile(Profile profile);
+
 		/**
 		 * Write the PNG IHDR.
 		 * This must be called before writing any other image data.
@@ -193,8 +272,8 @@ class RpPngWriter
 		 * This must be called before writing any other image data.
 		 *
 		 * This function sets the cached sBIT before writing IHDR.
-		 * It should only be used for raw images. Use write_IHDR()
-		 * for rp_image and IconAnimData.
+		 * It should only be used for raw images and streaming APNG
+		 * images. Use write_IHDR() for rp_image and IconAnimData.
 		 *
 		 * @param sBIT		[in] sBIT metadata.
 		 * @param palette	[in,opt] Palette for CI8 images.
@@ -256,6 +335,25 @@ class RpPngWriter
 		 * @return 0 on success; negative POSIX error code on error.
 		 */
 		int write_IDAT(void);
+
+		/**
+		 * Write a frame to a streaming APNG image.
+		 *
+		 * write_IHDR() must be called before writing any frames.
+		 * Only the region that changed since the previous frame
+		 * is stored in the file, so the caller does not need to
+		 * keep previous frames around.
+		 *
+		 * After the last frame is written, the file will be closed.
+		 *
+		 * NOTE: CI8 frames must use the palette specified in write_IHDR().
+		 *
+		 * @param img		[in] Frame image. (must match the constructor's width, height, and format)
+		 * @param delay_numer	[in] Delay numerator.
+		 * @param delay_denom	[in] Delay denominator.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int write_frame(const rp_image *img, uint16_t delay_numer, uint16_t delay_denom);
 };
 
 }
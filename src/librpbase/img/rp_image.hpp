@@ -372,6 +372,21 @@ class rp_image
 			Alignment alignment = AlignDefault,
 			uint32_t bgColor = 0x00000000) const;
 
+		/**
+		 * Scale the rp_image down using area averaging.
+		 *
+		 * Each pixel in the new image is the average of the
+		 * pixels it covers in the original image, weighted by
+		 * alpha so transparent pixels don't darken the edges.
+		 *
+		 * The new image is always ARGB32.
+		 *
+		 * @param width New width. (must be <= current width)
+		 * @param height New height. (must be <= current height)
+		 * @return New ARGB32 rp_image with a scaled-down version of the original, or nullptr on error.
+		 */
+		rp_image *downscaled(int width, int height) const;
+
 		/**
 		 * Un-premultiply this image.
 		 * Standard version using regular C++ code.
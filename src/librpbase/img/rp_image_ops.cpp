@@ -29,6 +29,7 @@
 
 // C++ includes.
 #include <algorithm>
+#include <memory>
 
 // Workaround for RP_D() expecting the no-underscore, UpperCamelCase naming convention.
 #define rp_imagePrivate rp_image_private
@@ -509,6 +510,108 @@ rp_image *rp_image::resized(int width, int height, Alignment alignment, uint32_t
 	return img;
 }
 
+/**
+ * Scale the rp_image down using area averaging.
+ *
+ * Each pixel in the new image is the average of the
+ * pixels it covers in the original image, weighted by
+ * alpha so transparent pixels don't darken the edges.
+ *
+ * The new image is always ARGB32.
+ *
+ * @param width New width. (must be <= current width)
+ * @param height New height. (must be <= current height)
+ * @return New ARGB32 rp_image with a scaled-down version of the original, or nullptr on error.
+ */
+rp_image *rp_image::downscaled(int width, int height) const
+{
+	RP_D(const rp_image);
+	const int src_width = d->backend->width;
+	const int src_height = d->backend->height;
+	assert(width > 0 && width <= src_width);
+	assert(height > 0 && height <= src_height);
+	if (width <= 0 || width > src_width ||
+	    height <= 0 || height > src_height)
+	{
+		return nullptr;
+	}
+
+	// The source image must be ARGB32.
+	rp_image *tmp_img = nullptr;
+	const rp_image *src_img = this;
+	if (d->backend->format != FORMAT_ARGB32) {
+		tmp_img = this->dup_ARGB32();
+		if (!tmp_img) {
+			return nullptr;
+		}
+		src_img = tmp_img;
+	}
+	if (width == src_width && height == src_height) {
+		// No scaling is needed.
+		return (tmp_img ? tmp_img : this->dup());
+	}
+
+	rp_image *img = new rp_image(width, height, FORMAT_ARGB32);
+	if (!img->isValid()) {
+		// Image is invalid. Something went wrong.
+		delete img;
+		delete tmp_img;
+		return nullptr;
+	}
+
+	// Source columns for each destination column.
+	std::unique_ptr<int[]> sx_tbl(new int[width + 1]);
+	for (int x = 0; x <= width; x++) {
+		sx_tbl[x] = static_cast<int>((static_cast<int64_t>(x) * src_width) / width);
+	}
+
+	for (int y = 0; y < height; y++) {
+		const int sy0 = static_cast<int>((static_cast<int64_t>(y) * src_height) / height);
+		const int sy1 = static_cast<int>((static_cast<int64_t>(y + 1) * src_height) / height);
+		uint32_t *dest = static_cast<uint32_t*>(img->scanLine(y));
+
+		for (int x = 0; x < width; x++, dest++) {
+			const int sx0 = sx_tbl[x];
+			const int sx1 = sx_tbl[x + 1];
+
+			// Color channels are weighted by alpha.
+			uint64_t a_sum = 0, r_sum = 0, g_sum = 0, b_sum = 0;
+			for (int sy = sy0; sy < sy1; sy++) {
+				const uint32_t *src = static_cast<const uint32_t*>(src_img->scanLine(sy)) + sx0;
+				for (int sx = sx0; sx < sx1; sx++, src++) {
+					const uint32_t px = *src;
+					const unsigned int a = (px >> 24);
+					a_sum += a;
+					r_sum += ((px >> 16) & 0xFF) * a;
+					g_sum += ((px >>  8) & 0xFF) * a;
+					b_sum += ( px        & 0xFF) * a;
+				}
+			}
+
+			if (a_sum == 0) {
+				// Fully transparent.
+				*dest = 0;
+				continue;
+			}
+
+			const unsigned int count = (sy1 - sy0) * (sx1 - sx0);
+			const uint32_t a = static_cast<uint32_t>((a_sum + (count / 2)) / count);
+			const uint32_t r = static_cast<uint32_t>((r_sum + (a_sum / 2)) / a_sum);
+			const uint32_t g = static_cast<uint32_t>((g_sum + (a_sum / 2)) / a_sum);
+			const uint32_t b = static_cast<uint32_t>((b_sum + (a_sum / 2)) / a_sum);
+			*dest = (a << 24) | (r << 16) | (g << 8) | b;
+		}
+	}
+
+	// Copy sBIT if it's set.
+	if (d->has_sBIT) {
+		img->set_sBIT(&d->sBIT);
+	}
+
+	delete tmp_img;
+	return img;
+}
+
 /**
  * Convert a chroma-keyed image to standard ARGB32.
  * Standard version using regular C++ code.
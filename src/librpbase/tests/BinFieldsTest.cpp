@@ -0,0 +1,519 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase/tests)                  *
+ * BinFieldsTest.cpp: BinFields serialization test.                        *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// librpbase
+#include "../BinFields.hpp"
+#include "../RomFields.hpp"
+#include "../RomMetaData.hpp"
+#include "../byteswap.h"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstring>
+
+// C++ includes.
+#include <memory>
+#include <string>
+#include <vector>
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+namespace LibRpBase { namespace Tests {
+
+class BinFieldsTest : public ::testing::Test
+{
+	protected:
+		BinFieldsTest() { }
+
+	public:
+		/**
+		 * Create a RomFields object with every field type.
+		 * @return RomFields object.
+		 */
+		static RomFields *createTestFields(void);
+
+		/**
+		 * Create a RomMetaData object with every property type.
+		 * @return RomMetaData object.
+		 */
+		static RomMetaData *createTestMetaData(void);
+
+		/**
+		 * Compare two RomFields objects.
+		 * Icons in RFT_LISTDATA fields are ignored.
+		 * @param expected Expected RomFields.
+		 * @param actual Actual RomFields.
+		 */
+		static void compareFields(const RomFields *expected, const RomFields *actual);
+
+		/**
+		 * Compare two RomMetaData objects.
+		 * @param expected Expected RomMetaData.
+		 * @param actual Actual RomMetaData.
+		 */
+		static void compareMetaData(const RomMetaData *expected, const RomMetaData *actual);
+};
+
+// Bit names for RFT_BITFIELD.
+static const char *const bit_names[] = {
+	"Bit 0", "Bit 1", "", "Bit 3", "Bit 4",
+};
+
+// Column names for RFT_LISTDATA.
+static const char *const col_names[] = {
+	"Name", "Value", "Description",
+};
+
+/**
+ * Create a RomFields object with every field type.
+ * @return RomFields object.
+ */
+RomFields *BinFieldsTest::createTestFields(void)
+{
+	RomFields *const fields = new RomFields();
+	fields->reserveTabs(3);
+	fields->setTabName(0, "Main");
+	fields->setTabName(1, "Lists");
+	fields->setTabName(2, "Misc");
+
+	// RFT_STRING
+	fields->setTabIndex(0);
+	fields->addField_string("String", "Hello, world!");
+	fields->addField_string("Monospace", "0123456789ABCDEF", RomFields::STRF_MONOSPACE);
+	fields->addField_string("NULL string", nullptr);
+	fields->addField_string("Empty string", "");
+	fields->addField_string("UTF-8", "\xE3\x83\x9D\xE3\x82\xB1\xE3\x83\xA2\xE3\x83\xB3");
+	fields->addField_string("Duplicate", "Hello, world!");
+
+	// RFT_BITFIELD
+	const vector<string> *const v_bit_names =
+		RomFields::strArrayToVector(bit_names, ARRAY_SIZE(bit_names));
+	fields->addField_bitfield("Bitfield", v_bit_names, 3, 0x1B);
+	fields->addField_bitfield("Bitfield 2", v_bit_names, 2, 0x04);
+
+	// RFT_LISTDATA: Headers and checkboxes.
+	fields->setTabIndex(1);
+	const vector<string> *const v_col_names =
+		RomFields::strArrayToVector(col_names, ARRAY_SIZE(col_names));
+	vector<vector<string> > *list_data = new vector<vector<string> >(3);
+	for (int row = 0; row < 3; row++) {
+		vector<string> &data_row = list_data->at(row);
+		data_row.push_back(string("Row ") + static_cast<char>('0' + row));
+		data_row.push_back(string(row, 'x'));
+		data_row.push_back("Description");
+	}
+	RomFields::AFLD_PARAMS params(RomFields::RFT_LISTDATA_CHECKBOXES | RomFields::RFT_LISTDATA_SEPARATE_ROW, 4);
+	params.headers = v_col_names;
+	params.list_data = list_data;
+	params.mxd.checkboxes = 0x5;
+	params.alignment.headers = AFLD_ALIGN3(TXA_L, TXA_C, TXA_R);
+	params.alignment.data = AFLD_ALIGN3(TXA_D, TXA_R, TXA_C);
+	fields->addField_listData("ListData", &params);
+
+	// RFT_LISTDATA: No headers, rows with different column counts.
+	list_data = new vector<vector<string> >(2);
+	list_data->at(0).push_back("One");
+	list_data->at(1).push_back("Two");
+	list_data->at(1).push_back("");
+	params = RomFields::AFLD_PARAMS();
+	params.headers = nullptr;
+	params.list_data = list_data;
+	fields->addField_listData("ListData, no headers", &params);
+
+	// RFT_LISTDATA: Empty.
+	params = RomFields::AFLD_PARAMS();
+	params.headers = v_col_names;
+	params.list_data = new vector<vector<string> >();
+	fields->addField_listData("ListData, empty", &params);
+
+	// RFT_DATETIME
+	fields->setTabIndex(2);
+	fields->addField_dateTime("DateTime", 1546300800,
+		RomFields::RFT_DATETIME_HAS_DATE | RomFields::RFT_DATETIME_HAS_TIME | RomFields::RFT_DATETIME_IS_UTC);
+	fields->addField_dateTime("Invalid DateTime", -1, RomFields::RFT_DATETIME_HAS_DATE);
+	fields->addField_dateTime("Large DateTime", static_cast<time_t>(INT64_C(0x123456789)),
+		RomFields::RFT_DATETIME_HAS_DATE);
+
+	// RFT_AGE_RATINGS
+	RomFields::age_ratings_t age_ratings;
+	for (int i = 0; i < RomFields::AGE_MAX; i++) {
+		age_ratings[i] = static_cast<uint16_t>(i * 0x111);
+	}
+	age_ratings[RomFields::AGE_USA] = 13 | RomFields::AGEBF_ACTIVE;
+	fields->addField_ageRatings("Age Ratings", age_ratings);
+
+	// RFT_DIMENSIONS
+	fields->addField_dimensions("1D", 256);
+	fields->addField_dimensions("2D", 640, 480);
+	fields->addField_dimensions("3D", 64, 32, -1);
+
+	return fields;
+}
+
+/**
+ * Create a RomMetaData object with every property type.
+ * @return RomMetaData object.
+ */
+RomMetaData *BinFieldsTest::createTestMetaData(void)
+{
+	RomMetaData *const metaData = new RomMetaData();
+	metaData->addMetaData_string(Property::Title, "Test Title");
+	metaData->addMetaData_string(Property::Publisher, "Hello, world!");
+	metaData->addMetaData_integer(Property::Width, 640);
+	metaData->addMetaData_integer(Property::Duration, -1);
+	metaData->addMetaData_uint(Property::TrackNumber, 0xFFFFFFFFU);
+	metaData->addMetaData_timestamp(Property::CreationDate, 1546300800);
+	return metaData;
+}
+
+/**
+ * Compare two RomFields objects.
+ * Icons in RFT_LISTDATA fields are ignored.
+ * @param expected Expected RomFields.
+ * @param actual Actual RomFields.
+ */
+void BinFieldsTest::compareFields(const RomFields *expected, const RomFields *actual)
+{
+	ASSERT_TRUE(expected != nullptr);
+	ASSERT_TRUE(actual != nullptr);
+
+	// Tabs.
+	ASSERT_EQ(expected->tabCount(), actual->tabCount());
+	for (int i = 0; i < expected->tabCount(); i++) {
+		const char *const name_exp = expected->tabName(i);
+		const char *const name_act = actual->tabName(i);
+		if (!name_exp) {
+			EXPECT_TRUE(name_act == nullptr) << "tab " << i;
+		} else {
+			ASSERT_TRUE(name_act != nullptr) << "tab " << i;
+			EXPECT_STREQ(name_exp, name_act) << "tab " << i;
+		}
+	}
+
+	// Fields.
+	ASSERT_EQ(expected->count(), actual->count());
+	for (int i = 0; i < expected->count(); i++) {
+		const RomFields::Field *const f_exp = expected->field(i);
+		const RomFields::Field *const f_act = actual->field(i);
+		ASSERT_TRUE(f_exp != nullptr);
+		ASSERT_TRUE(f_act != nullptr);
+		EXPECT_STREQ(f_exp->name, f_act->name) << "field " << i;
+		ASSERT_EQ(f_exp->type, f_act->type) << "field " << i;
+		EXPECT_EQ(f_exp->tabIdx, f_act->tabIdx) << "field " << i;
+		EXPECT_EQ(f_exp->isValid, f_act->isValid) << "field " << i;
+
+		switch (f_exp->type) {
+			case RomFields::RFT_STRING:
+				EXPECT_EQ(f_exp->desc.flags, f_act->desc.flags) << "field " << i;
+				if (!f_exp->data.str) {
+					EXPECT_TRUE(f_act->data.str == nullptr) << "field " << i;
+				} else {
+					ASSERT_TRUE(f_act->data.str != nullptr) << "field " << i;
+					EXPECT_EQ(*f_exp->data.str, *f_act->data.str) << "field " << i;
+				}
+				break;
+
+			case RomFields::RFT_BITFIELD:
+				EXPECT_EQ(f_exp->desc.bitfield.elemsPerRow, f_act->desc.bitfield.elemsPerRow) << "field " << i;
+				ASSERT_TRUE(f_act->desc.bitfield.names != nullptr) << "field " << i;
+				EXPECT_EQ(*f_exp->desc.bitfield.names, *f_act->desc.bitfield.names) << "field " << i;
+				EXPECT_EQ(f_exp->data.bitfield, f_act->data.bitfield) << "field " << i;
+				break;
+
+			case RomFields::RFT_LISTDATA:
+				EXPECT_EQ(f_exp->desc.list_data.flags & ~RomFields::RFT_LISTDATA_ICONS,
+					  f_act->desc.list_data.flags) << "field " << i;
+				EXPECT_EQ(f_exp->desc.list_data.rows_visible, f_act->desc.list_data.rows_visible) << "field " << i;
+				EXPECT_EQ(f_exp->desc.list_data.alignment.headers, f_act->desc.list_data.alignment.headers) << "field " << i;
+				EXPECT_EQ(f_exp->desc.list_data.alignment.data, f_act->desc.list_data.alignment.data) << "field " << i;
+				if (!f_exp->desc.list_data.names) {
+					EXPECT_TRUE(f_act->desc.list_data.names == nullptr) << "field " << i;
+				} else {
+					ASSERT_TRUE(f_act->desc.list_data.names != nullptr) << "field " << i;
+					EXPECT_EQ(*f_exp->desc.list_data.names, *f_act->desc.list_data.names) << "field " << i;
+				}
+				if (!f_exp->data.list_data.data) {
+					EXPECT_TRUE(f_act->data.list_data.data == nullptr) << "field " << i;
+				} else {
+					ASSERT_TRUE(f_act->data.list_data.data != nullptr) << "field " << i;
+					EXPECT_EQ(*f_exp->data.list_data.data, *f_act->data.list_data.data) << "field " << i;
+				}
+				if (f_exp->desc.list_data.flags & RomFields::RFT_LISTDATA_CHECKBOXES) {
+					EXPECT_EQ(f_exp->data.list_data.mxd.checkboxes, f_act->data.list_data.mxd.checkboxes) << "field " << i;
+				}
+				break;
+
+			case RomFields::RFT_DATETIME:
+				EXPECT_EQ(f_exp->desc.flags, f_act->desc.flags) << "field " << i;
+				EXPECT_EQ(f_exp->data.date_time, f_act->data.date_time) << "field " << i;
+				break;
+
+			case RomFields::RFT_AGE_RATINGS:
+				ASSERT_TRUE(f_act->data.age_ratings != nullptr) << "field " << i;
+				EXPECT_EQ(*f_exp->data.age_ratings, *f_act->data.age_ratings) << "field " << i;
+				break;
+
+			case RomFields::RFT_DIMENSIONS:
+				EXPECT_EQ(f_exp->data.dimensions[0], f_act->data.dimensions[0]) << "field " << i;
+				EXPECT_EQ(f_exp->data.dimensions[1], f_act->data.dimensions[1]) << "field " << i;
+				EXPECT_EQ(f_exp->data.dimensions[2], f_act->data.dimensions[2]) << "field " << i;
+				break;
+
+			default:
+				ADD_FAILURE() << "Unexpected field type " << static_cast<int>(f_exp->type);
+				break;
+		}
+	}
+}
+
+/**
+ * Compare two RomMetaData objects.
+ * @param expected Expected RomMetaData.
+ * @param actual Actual RomMetaData.
+ */
+void BinFieldsTest::compareMetaData(const RomMetaData *expected, const RomMetaData *actual)
+{
+	ASSERT_TRUE(expected != nullptr);
+	ASSERT_TRUE(actual != nullptr);
+	ASSERT_EQ(expected->count(), actual->count());
+
+	for (int i = 0; i < expected->count(); i++) {
+		const RomMetaData::MetaData *const p_exp = expected->prop(i);
+		const RomMetaData::MetaData *const p_act = actual->prop(i);
+		ASSERT_TRUE(p_exp != nullptr);
+		ASSERT_TRUE(p_act != nullptr);
+		EXPECT_EQ(p_exp->name, p_act->name) << "property " << i;
+		ASSERT_EQ(p_exp->type, p_act->type) << "property " << i;
+		switch (p_exp->type) {
+			case PropertyType::Integer:
+				EXPECT_EQ(p_exp->data.ivalue, p_act->data.ivalue) << "property " << i;
+				break;
+			case PropertyType::UnsignedInteger:
+				EXPECT_EQ(p_exp->data.uvalue, p_act->data.uvalue) << "property " << i;
+				break;
+			case PropertyType::String:
+				ASSERT_TRUE(p_act->data.str != nullptr) << "property " << i;
+				EXPECT_EQ(*p_exp->data.str, *p_act->data.str) << "property " << i;
+				break;
+			case PropertyType::Timestamp:
+				EXPECT_EQ(p_exp->data.timestamp, p_act->data.timestamp) << "property " << i;
+				break;
+			default:
+				ADD_FAILURE() << "Unexpected property type " << static_cast<int>(p_exp->type);
+				break;
+		}
+	}
+}
+
+/**
+ * Serialize and deserialize every field and property type.
+ */
+TEST_F(BinFieldsTest, roundTrip)
+{
+	unique_ptr<RomFields> fields(createTestFields());
+	unique_ptr<RomMetaData> metaData(createTestMetaData());
+
+	vector<uint8_t> buf;
+	ASSERT_EQ(0, BinFields::serialize(buf, fields.get(), metaData.get()));
+
+	BinFields binFields(buf.data(), buf.size());
+	ASSERT_TRUE(binFields.isValid());
+	EXPECT_EQ(fields->tabCount(), binFields.tabCount());
+	EXPECT_EQ(fields->count(), binFields.count());
+	EXPECT_EQ(metaData->count(), binFields.metaDataCount());
+
+	unique_ptr<RomFields> fields2(binFields.toRomFields());
+	compareFields(fields.get(), fields2.get());
+	unique_ptr<RomMetaData> metaData2(binFields.toRomMetaData());
+	compareMetaData(metaData.get(), metaData2.get());
+
+	// Serializing the deserialized objects must produce the same buffer.
+	vector<uint8_t> buf2;
+	ASSERT_EQ(0, BinFields::serialize(buf2, fields2.get(), metaData2.get()));
+	EXPECT_EQ(buf, buf2);
+}
+
+/**
+ * Strings are accessed directly from the buffer.
+ */
+TEST_F(BinFieldsTest, zeroCopyAccess)
+{
+	unique_ptr<RomFields> fields(createTestFields());
+	vector<uint8_t> buf;
+	ASSERT_EQ(0, BinFields::serialize(buf, fields.get(), nullptr));
+
+	BinFields binFields(buf.data(), buf.size());
+	ASSERT_TRUE(binFields.isValid());
+	const char *const buf_start = reinterpret_cast<const char*>(buf.data());
+	const char *const buf_end = buf_start + buf.size();
+
+	// Tab name.
+	const char *const tabName = binFields.tabName(1);
+	ASSERT_TRUE(tabName != nullptr);
+	EXPECT_STREQ("Lists", tabName);
+	EXPECT_TRUE(tabName >= buf_start && tabName < buf_end);
+
+	// First field: RFT_STRING.
+	const BinFields_Field *const binField = binFields.field(0);
+	ASSERT_TRUE(binField != nullptr);
+	EXPECT_EQ(RomFields::RFT_STRING, binField->type);
+	size_t len = 0;
+	const char *const name = binFields.str(le32_to_cpu(binField->name), &len);
+	ASSERT_TRUE(name != nullptr);
+	EXPECT_STREQ("String", name);
+	EXPECT_EQ(strlen("String"), len);
+	EXPECT_TRUE(name >= buf_start && name < buf_end);
+
+	// Duplicate strings are only stored once.
+	const int count = binFields.count();
+	const BinFields_Field *dupField = nullptr;
+	for (int i = 0; i < count; i++) {
+		const BinFields_Field *const f = binFields.field(i);
+		if (!strcmp(binFields.str(le32_to_cpu(f->name)), "Duplicate")) {
+			dupField = f;
+			break;
+		}
+	}
+	ASSERT_TRUE(dupField != nullptr);
+	EXPECT_EQ(binField->v[0], dupField->v[0]);
+
+	// Shared name tables are only stored once.
+	const BinFields_Field *bitfields[2] = {nullptr, nullptr};
+	for (int i = 0, j = 0; i < count && j < 2; i++) {
+		const BinFields_Field *const f = binFields.field(i);
+		if (f->type == RomFields::RFT_BITFIELD) {
+			bitfields[j++] = f;
+		}
+	}
+	ASSERT_TRUE(bitfields[0] != nullptr);
+	ASSERT_TRUE(bitfields[1] != nullptr);
+	const uint32_t names_ref = le32_to_cpu(bitfields[0]->v[2]);
+	EXPECT_EQ(names_ref, le32_to_cpu(bitfields[1]->v[2]));
+	ASSERT_EQ(ARRAY_SIZE(bit_names), binFields.strArrayCount(names_ref));
+	for (int i = 0; i < ARRAY_SIZE(bit_names); i++) {
+		EXPECT_STREQ(bit_names[i], binFields.strArrayItem(names_ref, i));
+	}
+}
+
+/**
+ * Icons in RFT_LISTDATA fields are not serialized.
+ */
+TEST_F(BinFieldsTest, listDataIcons)
+{
+	RomFields fields;
+	vector<vector<string> > *const list_data = new vector<vector<string> >(2);
+	list_data->at(0).push_back("Icon 1");
+	list_data->at(1).push_back("Icon 2");
+	RomFields::AFLD_PARAMS params(RomFields::RFT_LISTDATA_ICONS, 0);
+	params.headers = nullptr;
+	params.list_data = list_data;
+	params.mxd.icons = new vector<const rp_image*>(2, nullptr);
+	fields.addField_listData("Icons", &params);
+
+	vector<uint8_t> buf;
+	ASSERT_EQ(0, BinFields::serialize(buf, &fields, nullptr));
+	BinFields binFields(buf.data(), buf.size());
+	unique_ptr<RomFields> fields2(binFields.toRomFields());
+	ASSERT_TRUE(fields2 != nullptr);
+	ASSERT_EQ(1, fields2->count());
+	const RomFields::Field *const field = fields2->field(0);
+	EXPECT_EQ(0U, field->desc.list_data.flags & RomFields::RFT_LISTDATA_ICONS);
+	ASSERT_TRUE(field->data.list_data.data != nullptr);
+	EXPECT_EQ(*list_data, *field->data.list_data.data);
+}
+
+/**
+ * Serialize nothing.
+ */
+TEST_F(BinFieldsTest, empty)
+{
+	vector<uint8_t> buf;
+	ASSERT_EQ(0, BinFields::serialize(buf, nullptr, nullptr));
+	EXPECT_EQ(sizeof(BinFields_Header), buf.size());
+
+	BinFields binFields(buf.data(), buf.size());
+	ASSERT_TRUE(binFields.isValid());
+	EXPECT_EQ(0, binFields.tabCount());
+	EXPECT_EQ(0, binFields.count());
+	EXPECT_EQ(0, binFields.metaDataCount());
+
+	unique_ptr<RomFields> fields(binFields.toRomFields());
+	ASSERT_TRUE(fields != nullptr);
+	EXPECT_TRUE(fields->empty());
+	unique_ptr<RomMetaData> metaData(binFields.toRomMetaData());
+	ASSERT_TRUE(metaData != nullptr);
+	EXPECT_TRUE(metaData->empty());
+}
+
+/**
+ * Truncated and corrupted buffers must be handled safely.
+ */
+TEST_F(BinFieldsTest, corruptBuffers)
+{
+	unique_ptr<RomFields> fields(createTestFields());
+	unique_ptr<RomMetaData> metaData(createTestMetaData());
+	vector<uint8_t> buf;
+	ASSERT_EQ(0, BinFields::serialize(buf, fields.get(), metaData.get()));
+
+	// Truncated buffers are rejected.
+	for (size_t size = 0; size < buf.size(); size++) {
+		BinFields binFields(buf.data(), size);
+		EXPECT_FALSE(binFields.isValid()) << "size " << size;
+	}
+
+	// Incorrect magic number.
+	vector<uint8_t> bad = buf;
+	bad[0] ^= 0xFF;
+	EXPECT_FALSE(BinFields(bad.data(), bad.size()).isValid());
+
+	// Corrupt each byte after the header. This must not crash,
+	// and any successfully-converted objects must be usable.
+	for (size_t i = sizeof(BinFields_Header); i < buf.size(); i++) {
+		bad = buf;
+		bad[i] ^= 0xA5;
+		BinFields binFields(bad.data(), bad.size());
+		ASSERT_TRUE(binFields.isValid());
+		unique_ptr<RomFields> fields2(binFields.toRomFields());
+		if (fields2) {
+			vector<uint8_t> buf2;
+			EXPECT_EQ(0, BinFields::serialize(buf2, fields2.get(), nullptr));
+		}
+		unique_ptr<RomMetaData> metaData2(binFields.toRomMetaData());
+	}
+}
+
+} }
+
+/**
+ * Test suite main function.
+ */
+extern "C" int gtest_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibRpBase test suite: BinFields tests.\n\n");
+	fflush(nullptr);
+
+	// coverity[fun_call_w_exception]: uncaught exceptions cause nonzero exit anyway, so don't warn.
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,271 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase/tests)                  *
+ * IoBudgetTest.cpp: IoBudget class test.                                  *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// librpbase
+#include "../file/IoBudget.hpp"
+#include "../file/RpFile.hpp"
+
+#ifdef _WIN32
+# include "libwin32common/RpWin32_sdk.h"
+#else /* !_WIN32 */
+# include <unistd.h>
+#endif /* _WIN32 */
+
+// C includes. (C++ namespace)
+#include <cerrno>
+#include <cstdio>
+
+namespace LibRpBase { namespace Tests {
+
+class IoBudgetTest : public ::testing::Test
+{
+	protected:
+		IoBudgetTest()
+			: m_file(nullptr)
+		{ }
+
+		void SetUp(void) final;
+		void TearDown(void) final;
+
+		/**
+		 * Sleep for the specified number of milliseconds.
+		 * @param ms Milliseconds.
+		 */
+		static void msleep(unsigned int ms)
+		{
+#ifdef _WIN32
+			Sleep(ms);
+#else /* !_WIN32 */
+			usleep(ms * 1000);
+#endif /* _WIN32 */
+		}
+
+	public:
+		// Test file.
+		static const char filename[];
+		static const size_t file_size = 4096;
+		RpFile *m_file;
+};
+
+const char IoBudgetTest::filename[] = "IoBudgetTest.bin";
+
+/**
+ * SetUp() function.
+ * Run before each test.
+ */
+void IoBudgetTest::SetUp(void)
+{
+	m_file = new RpFile(filename, RpFile::FM_CREATE_WRITE);
+	ASSERT_TRUE(m_file->isOpen());
+
+	uint8_t buf[file_size];
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = static_cast<uint8_t>(i);
+	}
+	ASSERT_EQ(sizeof(buf), m_file->write(buf, sizeof(buf)));
+	m_file->rewind();
+}
+
+/**
+ * TearDown() function.
+ * Run after each test.
+ */
+void IoBudgetTest::TearDown(void)
+{
+	if (m_file) {
+		m_file->unref();
+		m_file = nullptr;
+	}
+	remove(filename);
+}
+
+/**
+ * Reads are not limited if no budget is active.
+ */
+TEST_F(IoBudgetTest, noBudgetTest)
+{
+	EXPECT_TRUE(IoBudget::current() == nullptr);
+	EXPECT_FALSE(IoBudget::isCurrentExceeded());
+
+	uint8_t buf[16];
+	for (unsigned int i = 0; i < 100; i++) {
+		ASSERT_EQ(sizeof(buf), m_file->seekAndRead(i * 16, buf, sizeof(buf)));
+	}
+	EXPECT_EQ(0, m_file->lastError());
+}
+
+/**
+ * Limit the number of reads.
+ */
+TEST_F(IoBudgetTest, maxReadsTest)
+{
+	IoBudget budget(0, 3, 0);
+	IoBudget::Scope scope(&budget);
+	EXPECT_EQ(&budget, IoBudget::current());
+
+	uint8_t buf[16];
+	for (unsigned int i = 0; i < 3; i++) {
+		ASSERT_EQ(sizeof(buf), m_file->read(buf, sizeof(buf)));
+	}
+	EXPECT_FALSE(budget.isExceeded());
+	EXPECT_EQ(3U, budget.reads());
+	EXPECT_EQ(48U, budget.bytesRead());
+
+	// Seeks aren't charged as reads.
+	EXPECT_EQ(0, m_file->seek(0));
+	EXPECT_FALSE(budget.isExceeded());
+
+	// The fourth read fails.
+	EXPECT_EQ(0U, m_file->read(buf, sizeof(buf)));
+	EXPECT_EQ(ECANCELED, m_file->lastError());
+	EXPECT_TRUE(budget.isExceeded());
+	EXPECT_TRUE(IoBudget::isCurrentExceeded());
+
+	// Seeks also fail once the budget has been exceeded.
+	m_file->clearError();
+	EXPECT_EQ(-1, m_file->seek(0));
+	EXPECT_EQ(ECANCELED, m_file->lastError());
+}
+
+/**
+ * Limit the number of bytes read.
+ */
+TEST_F(IoBudgetTest, maxBytesTest)
+{
+	IoBudget budget(1000, 0, 0);
+	IoBudget::Scope scope(&budget);
+
+	uint8_t buf[600];
+	ASSERT_EQ(sizeof(buf), m_file->read(buf, sizeof(buf)));
+	EXPECT_EQ(buf[599], static_cast<uint8_t>(599));
+	EXPECT_FALSE(budget.isExceeded());
+
+	// This read would go over the budget, so nothing is read.
+	EXPECT_EQ(0U, m_file->read(buf, sizeof(buf)));
+	EXPECT_EQ(ECANCELED, m_file->lastError());
+	EXPECT_TRUE(budget.isExceeded());
+	EXPECT_EQ(600U, budget.bytesRead());
+
+	// The budget stays exceeded, even for reads that would fit.
+	EXPECT_EQ(0U, m_file->read(buf, 10));
+}
+
+/**
+ * Limit the time.
+ */
+TEST_F(IoBudgetTest, deadlineTest)
+{
+	IoBudget budget(0, 0, 20);
+	IoBudget::Scope scope(&budget);
+
+	uint8_t buf[16];
+	ASSERT_EQ(sizeof(buf), m_file->read(buf, sizeof(buf)));
+	EXPECT_FALSE(budget.isExceeded());
+
+	msleep(40);
+	EXPECT_EQ(0U, m_file->read(buf, sizeof(buf)));
+	EXPECT_EQ(ECANCELED, m_file->lastError());
+	EXPECT_TRUE(budget.isExceeded());
+}
+
+/**
+ * Nested scopes restore the previous budget.
+ */
+TEST_F(IoBudgetTest, scopeTest)
+{
+	IoBudget outer(0, 2, 0);
+	uint8_t buf[16];
+	{
+		IoBudget::Scope outerScope(&outer);
+		ASSERT_EQ(sizeof(buf), m_file->read(buf, sizeof(buf)));
+
+		IoBudget inner(0, 1, 0);
+		{
+			IoBudget::Scope innerScope(&inner);
+			EXPECT_EQ(&inner, IoBudget::current());
+			ASSERT_EQ(sizeof(buf), m_file->read(buf, sizeof(buf)));
+			EXPECT_EQ(0U, m_file->read(buf, sizeof(buf)));
+			EXPECT_TRUE(inner.isExceeded());
+		}
+
+		// Only the inner budget was charged.
+		EXPECT_EQ(&outer, IoBudget::current());
+		EXPECT_FALSE(outer.isExceeded());
+		EXPECT_EQ(1U, outer.reads());
+		ASSERT_EQ(sizeof(buf), m_file->read(buf, sizeof(buf)));
+
+		// Disable the budget for a nested operation.
+		{
+			IoBudget::Scope noScope(nullptr);
+			ASSERT_EQ(sizeof(buf), m_file->read(buf, sizeof(buf)));
+		}
+		EXPECT_EQ(2U, outer.reads());
+	}
+
+	EXPECT_TRUE(IoBudget::current() == nullptr);
+	ASSERT_EQ(sizeof(buf), m_file->read(buf, sizeof(buf)));
+}
+
+/**
+ * Parse I/O budget limits.
+ */
+TEST_F(IoBudgetTest, parseLimitsTest)
+{
+	IoBudget::Limits limits = {1, 1, 1};
+	ASSERT_EQ(0, IoBudget::parseLimits("64", limits));
+	EXPECT_EQ(64ULL << 20, limits.max_bytes);
+	EXPECT_EQ(0U, limits.max_reads);
+	EXPECT_EQ(0U, limits.timeout_ms);
+	EXPECT_TRUE(limits.isEnabled());
+
+	ASSERT_EQ(0, IoBudget::parseLimits("0,1000,5000", limits));
+	EXPECT_EQ(0U, limits.max_bytes);
+	EXPECT_EQ(1000U, limits.max_reads);
+	EXPECT_EQ(5000U, limits.timeout_ms);
+
+	ASSERT_EQ(0, IoBudget::parseLimits("0,0,0", limits));
+	EXPECT_FALSE(limits.isEnabled());
+
+	// Invalid strings.
+	EXPECT_EQ(-EINVAL, IoBudget::parseLimits("", limits));
+	EXPECT_EQ(-EINVAL, IoBudget::parseLimits("64,", limits));
+	EXPECT_EQ(-EINVAL, IoBudget::parseLimits("-1", limits));
+	EXPECT_EQ(-EINVAL, IoBudget::parseLimits("1,2,3,4", limits));
+	EXPECT_EQ(-EINVAL, IoBudget::parseLimits("64MiB", limits));
+	EXPECT_EQ(-ERANGE, IoBudget::parseLimits("0,0,4294967296", limits));
+}
+
+} }
+
+/**
+ * Test suite main function.
+ */
+extern "C" int gtest_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibRpBase test suite: IoBudget tests.\n\n");
+	fflush(nullptr);
+
+	// coverity[fun_call_w_exception]: uncaught exceptions cause nonzero exit anyway, so don't warn.
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,366 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase/tests)                  *
+ * RomFieldsTest.cpp: RomFields class test.                                 *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// librpbase
+#include "../RomFields.hpp"
+
+// C includes.
+#include <stdlib.h>
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstring>
+
+// C++ includes.
+#include <new>
+#include <string>
+#include <vector>
+using std::string;
+using std::vector;
+
+// Allocation counters.
+// All allocations made by the test executable are counted.
+static unsigned int alloc_count = 0;
+static unsigned int free_count = 0;
+
+void *operator new(size_t size)
+{
+	void *const ptr = malloc(size != 0 ? size : 1);
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+	alloc_count++;
+	return ptr;
+}
+
+void operator delete(void *ptr) throw()
+{
+	if (ptr) {
+		free_count++;
+		free(ptr);
+	}
+}
+
+namespace LibRpBase { namespace Tests {
+
+class RomFieldsTest : public ::testing::Test
+{
+	protected:
+		RomFieldsTest() { }
+
+	public:
+		// Bit names.
+		static const char *const bit_names[];
+		static const int bit_names_count;
+};
+
+const char *const RomFieldsTest::bit_names[] = {
+	"Zero", "One", nullptr, "Three", "Four",
+};
+const int RomFieldsTest::bit_names_count = 5;
+
+/**
+ * Name tables from strArrayToVector() are shared.
+ */
+TEST_F(RomFieldsTest, sharedNamesTest)
+{
+	const vector<string> *const v1 = RomFields::strArrayToVector(bit_names, bit_names_count);
+	ASSERT_TRUE(v1 != nullptr);
+	ASSERT_EQ(5U, v1->size());
+	EXPECT_EQ("Zero", v1->at(0));
+	EXPECT_EQ("", v1->at(2));
+	EXPECT_EQ("Four", v1->at(4));
+
+	// The same array returns the same vector without allocating memory.
+	const unsigned int allocs = alloc_count;
+	const vector<string> *const v2 = RomFields::strArrayToVector(bit_names, bit_names_count);
+	EXPECT_EQ(allocs, alloc_count);
+	EXPECT_EQ(v1, v2);
+
+	// A different count is a different name table.
+	const vector<string> *const v3 = RomFields::strArrayToVector(bit_names, 2);
+	EXPECT_NE(v1, v3);
+	EXPECT_EQ(2U, v3->size());
+
+	// NULL-terminated array.
+	const vector<string> *const v4 = RomFields::strArrayToVector(bit_names);
+	EXPECT_EQ(2U, v4->size());
+}
+
+/**
+ * Field names and short strings don't need separate allocations.
+ */
+TEST_F(RomFieldsTest, allocCountTest)
+{
+	static const int FIELD_COUNT = 64;
+	const vector<string> *const v_bit_names = RomFields::strArrayToVector(bit_names, bit_names_count);
+	RomFields::age_ratings_t age_ratings;
+	age_ratings.fill(0);
+
+	RomFields *const fields = new RomFields();
+	fields->reserveTabs(2);
+	fields->reserve(FIELD_COUNT * 2 + 2);
+
+	// Previously, each field name and each string was allocated
+	// separately, and each age ratings array was allocated
+	// separately, for a total of at least 4*FIELD_COUNT + 2
+	// allocations here. Now, everything is stored in the arena,
+	// and bit names are shared.
+	const unsigned int allocs = alloc_count;
+	fields->setTabName(0, "First Tab");
+	fields->addTab("Second Tab");
+	for (int i = 0; i < FIELD_COUNT; i++) {
+		fields->addField_string("Field Name", "Short value");
+		fields->addField_bitfield("Bitfield Name", v_bit_names, 3, i);
+	}
+	fields->addField_ageRatings("Age Ratings", age_ratings);
+	fields->addField_dateTime("Date", 0);
+	const unsigned int used = alloc_count - allocs;
+	EXPECT_LE(used, 3U);
+	EXPECT_EQ(FIELD_COUNT * 2 + 2, fields->count());
+
+	// Verify the field contents.
+	const RomFields::Field *field = fields->field(0);
+	ASSERT_TRUE(field != nullptr);
+	EXPECT_STREQ("Field Name", field->name);
+	EXPECT_EQ(RomFields::RFT_STRING, field->type);
+	ASSERT_TRUE(field->data.str != nullptr);
+	EXPECT_EQ("Short value", *field->data.str);
+	EXPECT_EQ(1, field->tabIdx);
+
+	field = fields->field(FIELD_COUNT * 2 - 1);
+	ASSERT_TRUE(field != nullptr);
+	EXPECT_STREQ("Bitfield Name", field->name);
+	EXPECT_EQ(v_bit_names, field->desc.bitfield.names);
+	EXPECT_EQ(static_cast<uint32_t>(FIELD_COUNT - 1), field->data.bitfield);
+
+	EXPECT_STREQ("First Tab", fields->tabName(0));
+	EXPECT_STREQ("Second Tab", fields->tabName(1));
+
+	delete fields;
+}
+
+/**
+ * All memory is freed when the RomFields object is deleted.
+ */
+TEST_F(RomFieldsTest, freeTest)
+{
+	// Create the shared name table first, since it isn't freed.
+	const vector<string> *const v_bit_names = RomFields::strArrayToVector(bit_names, bit_names_count);
+	RomFields::age_ratings_t age_ratings;
+	age_ratings.fill(0);
+
+	const unsigned int live = alloc_count - free_count;
+	RomFields *const fields = new RomFields();
+	for (int i = 0; i < 1000; i++) {
+		// Long strings and names require additional allocations.
+		fields->addField_string(string(100, 'n').c_str(), string(100, 's'));
+		fields->addField_bitfield("Bitfield", v_bit_names, 3, i);
+		fields->addField_ageRatings("Age Ratings", age_ratings);
+	}
+
+	vector<vector<string> > *const list_data = new vector<vector<string> >(10);
+	RomFields::AFLD_PARAMS params;
+	params.headers = v_bit_names;
+	params.list_data = list_data;
+	fields->addField_listData("List", &params);
+
+	RomFields *const fields2 = new RomFields();
+	fields2->addFields_romFields(fields, RomFields::TabOffset_AddTabs);
+	delete fields;
+	delete fields2;
+
+	EXPECT_EQ(live, alloc_count - free_count);
+}
+
+/**
+ * Name tables from ownStrVector() are freed along with
+ * the RomFields object, and addFields_romFields() copies them.
+ */
+TEST_F(RomFieldsTest, ownedNamesTest)
+{
+	vector<string> names;
+	names.push_back("Zero");
+	names.push_back("One");
+	names.push_back(string(100, 'x'));
+
+	const unsigned int live = alloc_count - free_count;
+	RomFields *const fields = new RomFields();
+	const vector<string> *const v_names = fields->ownStrVector(names);
+	ASSERT_TRUE(v_names != nullptr);
+	EXPECT_EQ(names, *v_names);
+	fields->addField_bitfield("Bitfield", v_names, 3, 5);
+
+	RomFields::AFLD_PARAMS params;
+	params.headers = fields->ownStrVector(names);
+	params.list_data = new vector<vector<string> >(1);
+	fields->addField_listData("List", &params);
+
+	RomFields *const fields2 = new RomFields();
+	fields2->addFields_romFields(fields, RomFields::TabOffset_Ignore);
+	delete fields;
+
+	// fields2 must have its own copies of the name tables.
+	ASSERT_EQ(2, fields2->count());
+	const RomFields::Field *field = fields2->field(0);
+	ASSERT_TRUE(field != nullptr);
+	ASSERT_TRUE(field->desc.bitfield.names != nullptr);
+	EXPECT_EQ(names, *field->desc.bitfield.names);
+	field = fields2->field(1);
+	ASSERT_TRUE(field != nullptr);
+	ASSERT_TRUE(field->desc.list_data.names != nullptr);
+	EXPECT_EQ(names, *field->desc.list_data.names);
+	delete fields2;
+
+	EXPECT_EQ(live, alloc_count - free_count);
+}
+
+/**
+ * addFields_romFields() copies names and data.
+ */
+TEST_F(RomFieldsTest, addFieldsTest)
+{
+	RomFields *const fields2 = new RomFields();
+	{
+		RomFields fields;
+		fields.setTabName(0, "Tab");
+		fields.addField_string(string("Long field name ").append(32, 'x').c_str(), "value", RomFields::STRF_TRIM_END);
+		fields.addField_dimensions("Dimensions", 1, 2, 3);
+		fields2->addFields_romFields(&fields, RomFields::TabOffset_AddTabs);
+	}
+
+	ASSERT_EQ(2, fields2->count());
+	const RomFields::Field *field = fields2->field(0);
+	ASSERT_TRUE(field != nullptr);
+	EXPECT_EQ(string("Long field name ").append(32, 'x'), field->name);
+	ASSERT_TRUE(field->data.str != nullptr);
+	EXPECT_EQ("value", *field->data.str);
+
+	field = fields2->field(1);
+	ASSERT_TRUE(field != nullptr);
+	EXPECT_STREQ("Dimensions", field->name);
+	EXPECT_EQ(3, field->data.dimensions[2]);
+
+	EXPECT_STREQ("Tab", fields2->tabName(0));
+	delete fields2;
+}
+
+/**
+ * Tab loader for tabLoaderTest.
+ * @param fields RomFields object.
+ * @param tabIdx Tab index.
+ * @param userdata Call counter. (int*)
+ * @return 0 on success; negative POSIX error code on error.
+ */
+static int tabLoaderTest_loader(RomFields *fields, int tabIdx, void *userdata)
+{
+	(*static_cast<int*>(userdata))++;
+	fields->addField_string("Lazy 1", string("tab ") + static_cast<char>('0' + tabIdx));
+	fields->addField_string("Lazy 2", "value");
+	return 0;
+}
+
+/**
+ * Tabs with tab loaders are only loaded when requested,
+ * and their fields are inserted in tab order.
+ */
+TEST_F(RomFieldsTest, tabLoaderTest)
+{
+	int calls = 0;
+	RomFields fields;
+	fields.setTabName(0, "Tab 0");
+	fields.addField_string("Eager 0", "value");
+	fields.setTabName(1, "Tab 1");
+	fields.setTabLoader(1, tabLoaderTest_loader, &calls);
+	fields.setTabName(2, "Tab 2");
+	fields.setTabIndex(2);
+	fields.addField_string("Eager 2", "value");
+
+	// Tab names are available before the tab is loaded.
+	EXPECT_EQ(3, fields.tabCount());
+	EXPECT_STREQ("Tab 1", fields.tabName(1));
+	EXPECT_TRUE(fields.isTabLoaded(0));
+	EXPECT_FALSE(fields.isTabLoaded(1));
+	EXPECT_TRUE(fields.hasPendingTabs());
+	EXPECT_EQ(2, fields.count());
+	EXPECT_EQ(0, calls);
+
+	// Load the tab.
+	EXPECT_EQ(2, fields.loadTab(1));
+	EXPECT_EQ(1, calls);
+	EXPECT_TRUE(fields.isTabLoaded(1));
+	EXPECT_FALSE(fields.hasPendingTabs());
+	ASSERT_EQ(4, fields.count());
+
+	static const char *const names[] = {"Eager 0", "Lazy 1", "Lazy 2", "Eager 2"};
+	static const uint8_t tabs[] = {0, 1, 1, 2};
+	for (int i = 0; i < 4; i++) {
+		const RomFields::Field *const field = fields.field(i);
+		ASSERT_TRUE(field != nullptr);
+		EXPECT_STREQ(names[i], field->name);
+		EXPECT_EQ(tabs[i], field->tabIdx);
+	}
+	EXPECT_EQ("tab 1", *fields.field(1)->data.str);
+
+	// The tab loader is only run once.
+	EXPECT_EQ(0, fields.loadTab(1));
+	EXPECT_EQ(0, fields.loadAllTabs());
+	EXPECT_EQ(1, calls);
+
+	// New fields still go to the current tab.
+	fields.addField_string("Eager 2b", "value");
+	EXPECT_EQ(2, fields.field(4)->tabIdx);
+}
+
+/**
+ * A RomFields object with only unloaded tabs isn't empty.
+ */
+TEST_F(RomFieldsTest, tabLoaderEmptyTest)
+{
+	int calls = 0;
+	RomFields fields;
+	fields.setTabName(0, "Lazy");
+	fields.setTabLoader(0, tabLoaderTest_loader, &calls);
+	EXPECT_FALSE(fields.empty());
+	EXPECT_EQ(0, fields.count());
+
+	EXPECT_EQ(2, fields.loadAllTabs());
+	EXPECT_EQ(1, calls);
+	EXPECT_FALSE(fields.empty());
+	EXPECT_EQ(2, fields.count());
+}
+
+} }
+
+/**
+ * Test suite main function.
+ */
+extern "C" int gtest_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibRpBase test suite: RomFields tests.\n\n");
+	fflush(nullptr);
+
+	// coverity[fun_call_w_exception]: uncaught exceptions cause nonzero exit anyway, so don't warn.
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
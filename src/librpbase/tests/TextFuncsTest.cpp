@@ -23,6 +23,9 @@
 
 // TextFuncs
 #include "../TextFuncs.hpp"
+#include "../TextFuncs_ascii.hpp"
+#include "../TextFuncs_cpN.hpp"
+#include "../TextFuncs_utf16.hpp"
 #include "../byteorder.h"
 
 // C includes. (C++ namespace)
@@ -59,6 +62,9 @@ class TextFuncsTest : public ::testing::Test
 		TextFuncsTest() { }
 
 	public:
+		// Number of iterations for benchmarks.
+		static const unsigned int BENCHMARK_ITERATIONS = 100000;
+
 		// NOTE: 8-bit test strings are unsigned in order to prevent
 		// narrowing conversion warnings from appearing.
 		// char16_t is defined as unsigned, so this isn't a problem
@@ -624,6 +630,80 @@ TEST_F(TextFuncsTest, utf16_bswap_LEtoBE)
 	EXPECT_EQ((const char16_t*)utf16be_data, str);
 }
 
+/**
+ * Test utf16le_to_utf8() and utf16be_to_utf8() with surrogate pairs
+ * and unpaired surrogates. Unpaired surrogates are converted to U+FFFD.
+ */
+TEST_F(TextFuncsTest, utf16_to_utf8_surrogates)
+{
+	// U+1F600, U+10000, U+10FFFF, unpaired high, unpaired low, unpaired high at the end.
+	static const char16_t wcs[] = {
+		'A', 0xD83D, 0xDE00, 'B', 0xD800, 0xDC00, 0xDBFF, 0xDFFF,
+		0xD800, 'C', 0xDC00, 'D', 0xD800, 0
+	};
+	static const char utf8[] =
+		"A\xF0\x9F\x98\x80" "B\xF0\x90\x80\x80\xF4\x8F\xBF\xBF"
+		"\xEF\xBF\xBD" "C\xEF\xBF\xBD" "D\xEF\xBF\xBD";
+
+	EXPECT_EQ(utf8, utf16_to_utf8(wcs, -1));
+
+	// Byteswapped version.
+	const u16string bwcs = utf16_bswap(wcs, -1);
+#if SYS_BYTEORDER == SYS_LIL_ENDIAN
+	EXPECT_EQ(utf8, utf16be_to_utf8(bwcs.data(), static_cast<int>(bwcs.size())));
+#else /* SYS_BYTEORDER == SYS_BIG_ENDIAN */
+	EXPECT_EQ(utf8, utf16le_to_utf8(bwcs.data(), static_cast<int>(bwcs.size())));
+#endif
+}
+
+/**
+ * Compare the scalar and SSE2 UTF-16 to UTF-8 converters using
+ * ASCII, BMP, and surrogate pairs at all alignments.
+ */
+TEST_F(TextFuncsTest, utf16_to_utf8_sse2_compare)
+{
+#ifdef TEXTFUNCS_UTF16_HAS_SSE2
+	// Build a test string. Surrogate pairs will cross
+	// 8-character block boundaries at some offsets.
+	u16string wcs;
+	for (unsigned int i = 0; i < 8; i++) {
+		wcs += u"ROM Properties ";
+		wcs += (char16_t)0x00E9;	// é
+		wcs += (char16_t)0x30DD;	// ポ
+		wcs += (char16_t)0xD83D;	// U+1F600
+		wcs += (char16_t)0xDE00;
+		for (unsigned int j = 0; j < i; j++) {
+			wcs += (char16_t)('0' + j);
+		}
+		if (i & 1) {
+			// Unpaired surrogate.
+			wcs += (char16_t)0xDC00;
+		}
+	}
+	const u16string bwcs = utf16_bswap(wcs.data(), static_cast<int>(wcs.size()));
+
+	string mbs_cpp, mbs_sse2;
+	mbs_cpp.resize(wcs.size() * 3);
+	mbs_sse2.resize(wcs.size() * 3);
+	for (size_t ofs = 0; ofs < 16; ofs++) {
+		const size_t len = wcs.size() - ofs;
+
+		// Host-endian.
+		size_t cb_cpp = utf16_to_utf8_cpp(&mbs_cpp[0], &wcs[ofs], len, false);
+		size_t cb_sse2 = utf16_to_utf8_sse2(&mbs_sse2[0], &wcs[ofs], len, false);
+		ASSERT_EQ(cb_cpp, cb_sse2) << "ofs == " << ofs;
+		EXPECT_EQ(0, memcmp(mbs_cpp.data(), mbs_sse2.data(), cb_cpp)) << "ofs == " << ofs;
+
+		// Byteswapped.
+		cb_sse2 = utf16_to_utf8_sse2(&mbs_sse2[0], &bwcs[ofs], len, true);
+		ASSERT_EQ(cb_cpp, cb_sse2) << "ofs == " << ofs;
+		EXPECT_EQ(0, memcmp(mbs_cpp.data(), mbs_sse2.data(), cb_cpp)) << "ofs == " << ofs;
+	}
+#else /* !TEXTFUNCS_UTF16_HAS_SSE2 */
+	fputs("*** SSE2 is not available on this architecture. Skipping test.\n", stderr);
+#endif /* TEXTFUNCS_UTF16_HAS_SSE2 */
+}
+
 /** Latin-1 (ISO-8859-1) **/
 
 /**
@@ -714,6 +794,407 @@ TEST_F(TextFuncsTest, utf16_to_latin1)
 	EXPECT_EQ((const char*)cp1252_data, str);
 }
 
+/** ASCII fast path and iconv descriptor caching. **/
+
+/**
+ * Test isAscii() with non-ASCII bytes at every position.
+ */
+TEST_F(TextFuncsTest, isAscii)
+{
+	char buf[160];
+	for (size_t len = 0; len <= sizeof(buf); len++) {
+		memset(buf, 0x7F, sizeof(buf));
+		EXPECT_TRUE(isAscii_cpp(buf, len));
+#ifdef TEXTFUNCS_ASCII_HAS_SSE2
+		EXPECT_TRUE(isAscii_sse2(buf, len));
+#endif /* TEXTFUNCS_ASCII_HAS_SSE2 */
+		EXPECT_TRUE(isAscii(buf, len));
+
+		for (size_t pos = 0; pos < len; pos++) {
+			memset(buf, 'A', sizeof(buf));
+			buf[pos] = static_cast<char>(0x80);
+			EXPECT_FALSE(isAscii_cpp(buf, len));
+#ifdef TEXTFUNCS_ASCII_HAS_SSE2
+			EXPECT_FALSE(isAscii_sse2(buf, len));
+#endif /* TEXTFUNCS_ASCII_HAS_SSE2 */
+			EXPECT_FALSE(isAscii(buf, len));
+		}
+
+		// Non-ASCII byte immediately after the string.
+		if (len < sizeof(buf)) {
+			memset(buf, 'A', sizeof(buf));
+			buf[len] = static_cast<char>(0xFF);
+			EXPECT_TRUE(isAscii(buf, len));
+		}
+	}
+}
+
+/**
+ * Test conversions with many different code pages.
+ * This checks that cached conversion descriptors are
+ * reused and replaced correctly.
+ */
+TEST_F(TextFuncsTest, cpN_many_code_pages)
+{
+	static const unsigned int cps[] = {
+		1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257,
+		437, 850, 932, CP_LATIN1,
+	};
+	static const char cp_in[] = "\xA9 ROM Properties";
+
+	// Get the expected results.
+	string expected[ARRAY_SIZE(cps)];
+	for (size_t i = 0; i < ARRAY_SIZE(cps); i++) {
+		expected[i] = cpN_to_utf8(cps[i], cp_in, -1);
+		EXPECT_FALSE(expected[i].empty());
+	}
+
+	// Repeat the conversions in different orders.
+	for (unsigned int round = 0; round < 3; round++) {
+		for (size_t i = 0; i < ARRAY_SIZE(cps); i++) {
+			const size_t idx = (round & 1) ? (ARRAY_SIZE(cps) - 1 - i) : i;
+			EXPECT_EQ(expected[idx], cpN_to_utf8(cps[idx], cp_in, -1));
+
+			// Shift-JIS conversion should still work.
+			EXPECT_EQ((const char*)sjis_utf8_data,
+				cp1252_sjis_to_utf8((const char*)sjis_data, -1));
+		}
+	}
+}
+
+/**
+ * Benchmark cp1252_sjis_to_utf8() with ASCII strings.
+ */
+TEST_F(TextFuncsTest, cp1252_sjis_to_utf8_ascii_benchmark)
+{
+	static const char cp1252_in[] = "SUPER MARIO SUNSHINE";
+	for (unsigned int i = BENCHMARK_ITERATIONS; i > 0; i--) {
+		string str = cp1252_sjis_to_utf8(cp1252_in, ARRAY_SIZE(cp1252_in)-1);
+		ASSERT_EQ(ARRAY_SIZE(cp1252_in)-1, str.size());
+	}
+}
+
+/**
+ * Benchmark cp1252_sjis_to_utf8() with Japanese text.
+ */
+TEST_F(TextFuncsTest, cp1252_sjis_to_utf8_japanese_benchmark)
+{
+	for (unsigned int i = BENCHMARK_ITERATIONS; i > 0; i--) {
+		string str = cp1252_sjis_to_utf8((const char*)sjis_data, ARRAY_SIZE(sjis_data)-1);
+		ASSERT_EQ(ARRAY_SIZE(sjis_utf8_data)-1, str.size());
+	}
+}
+
+/**
+ * Benchmark cp1252_to_utf8() with non-ASCII text.
+ */
+TEST_F(TextFuncsTest, cp1252_to_utf8_benchmark)
+{
+	for (unsigned int i = BENCHMARK_ITERATIONS; i > 0; i--) {
+		string str = cp1252_to_utf8((const char*)cp1252_data, ARRAY_SIZE(cp1252_data)-1);
+		ASSERT_EQ(ARRAY_SIZE(cp1252_utf8_data)-1, str.size());
+	}
+}
+
+/**
+ * Benchmark isAscii_cpp().
+ */
+TEST_F(TextFuncsTest, isAscii_cpp_benchmark)
+{
+	char buf[64];
+	memset(buf, 'A', sizeof(buf));
+	for (unsigned int i = BENCHMARK_ITERATIONS * 10; i > 0; i--) {
+		// NOTE: Modifying the buffer prevents the
+		// compiler from optimizing out the check.
+		buf[i & 63] = 'A' + (i & 15);
+		ASSERT_TRUE(isAscii_cpp(buf, sizeof(buf)));
+	}
+}
+
+#ifdef TEXTFUNCS_ASCII_HAS_SSE2
+/**
+ * Benchmark isAscii_sse2().
+ */
+TEST_F(TextFuncsTest, isAscii_sse2_benchmark)
+{
+	char buf[64];
+	memset(buf, 'A', sizeof(buf));
+	for (unsigned int i = BENCHMARK_ITERATIONS * 10; i > 0; i--) {
+		// NOTE: Modifying the buffer prevents the
+		// compiler from optimizing out the check.
+		buf[i & 63] = 'A' + (i & 15);
+		ASSERT_TRUE(isAscii_sse2(buf, sizeof(buf)));
+	}
+}
+#endif /* TEXTFUNCS_ASCII_HAS_SSE2 */
+
+/** Built-in code page decoders. **/
+
+/**
+ * Test the built-in cp1252 decoders.
+ */
+TEST_F(TextFuncsTest, cp1252_to_utf16_builtin)
+{
+	const size_t len = ARRAY_SIZE(cp1252_data)-1;
+	char16_t wcs[ARRAY_SIZE(cp1252_data)];
+
+	EXPECT_EQ(len, cp1252_to_utf16_cpp(wcs, (const char*)cp1252_data, len));
+	EXPECT_EQ(u16string(cp1252_utf16_data, len), u16string(wcs, len));
+
+#ifdef TEXTFUNCS_CPN_HAS_SSSE3
+	if (RP_CPU_HasSSSE3()) {
+		memset(wcs, 0, sizeof(wcs));
+		EXPECT_EQ(len, cp1252_to_utf16_ssse3(wcs, (const char*)cp1252_data, len));
+		EXPECT_EQ(u16string(cp1252_utf16_data, len), u16string(wcs, len));
+	} else {
+		fputs("*** SSSE3 is not supported on this CPU. Skipping SSSE3 test.\n", stderr);
+	}
+#endif /* TEXTFUNCS_CPN_HAS_SSSE3 */
+
+	// Undefined characters are mapped to C1 control codes.
+	static const char undef_in[] = "\x81\x8D\x8F\x90\x9D";
+	static const char16_t undef_out[] = {0x0081, 0x008D, 0x008F, 0x0090, 0x009D, 0};
+	EXPECT_EQ(undef_out, cp1252_to_utf16(undef_in, -1));
+}
+
+/**
+ * Compare the scalar and SSSE3 cp1252 decoders
+ * using all byte values at all alignments.
+ */
+TEST_F(TextFuncsTest, cp1252_to_utf16_ssse3_compare)
+{
+#ifdef TEXTFUNCS_CPN_HAS_SSSE3
+	if (!RP_CPU_HasSSSE3()) {
+		fputs("*** SSSE3 is not supported on this CPU. Skipping test.\n", stderr);
+		return;
+	}
+
+	char buf[256+16];
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = static_cast<char>((i * 7) & 0xFF);
+	}
+
+	char16_t wcs_cpp[sizeof(buf)], wcs_ssse3[sizeof(buf)];
+	for (size_t ofs = 0; ofs < 16; ofs++) {
+		const size_t len = sizeof(buf) - ofs;
+		EXPECT_EQ(len, cp1252_to_utf16_cpp(wcs_cpp, &buf[ofs], len));
+		EXPECT_EQ(len, cp1252_to_utf16_ssse3(wcs_ssse3, &buf[ofs], len));
+		EXPECT_EQ(0, memcmp(wcs_cpp, wcs_ssse3, len * sizeof(char16_t))) << "ofs == " << ofs;
+	}
+#else /* !TEXTFUNCS_CPN_HAS_SSSE3 */
+	fputs("*** SSSE3 is not available on this architecture. Skipping test.\n", stderr);
+#endif /* TEXTFUNCS_CPN_HAS_SSSE3 */
+}
+
+/**
+ * Test the built-in cp932 decoders.
+ * @param pfn cp932 decoder function.
+ */
+static void test_cp932_to_utf16(int (*pfn)(char16_t *wcs, const char *str, size_t len))
+{
+	char16_t wcs[256];
+
+	// Japanese text.
+	size_t len = ARRAY_SIZE(TextFuncsTest::sjis_data)-1;
+	int ret = pfn(wcs, (const char*)TextFuncsTest::sjis_data, len);
+	ASSERT_EQ(static_cast<int>(ARRAY_SIZE(TextFuncsTest::sjis_utf16_data)-1), ret);
+	EXPECT_EQ(u16string(TextFuncsTest::sjis_utf16_data, ret), u16string(wcs, ret));
+
+	// Halfwidth katakana.
+	len = ARRAY_SIZE(TextFuncsTest::sjis_copyright_in)-1;
+	ret = pfn(wcs, (const char*)TextFuncsTest::sjis_copyright_in, len);
+	ASSERT_EQ(static_cast<int>(ARRAY_SIZE(TextFuncsTest::sjis_copyright_out_utf16)-1), ret);
+	EXPECT_EQ(u16string(TextFuncsTest::sjis_copyright_out_utf16, ret), u16string(wcs, ret));
+
+	// cp1252 text isn't valid Shift-JIS.
+	len = ARRAY_SIZE(TextFuncsTest::cp1252_data)-1;
+	EXPECT_EQ(-1, pfn(wcs, (const char*)TextFuncsTest::cp1252_data, len));
+
+	// Lead byte without a trail byte.
+	static const char lead_only[] = "0123456789ABCDEF\x83";
+	EXPECT_EQ(-1, pfn(wcs, lead_only, sizeof(lead_only)-1));
+
+	// Lead byte with an invalid trail byte.
+	static const char bad_trail[] = "\x83\x7F";
+	EXPECT_EQ(-1, pfn(wcs, bad_trail, sizeof(bad_trail)-1));
+
+	// Invalid single-byte characters.
+	static const char bad_single[] = "\x80\xA0\xFD\xFE\xFF";
+	for (size_t i = 0; i < sizeof(bad_single)-1; i++) {
+		EXPECT_EQ(-1, pfn(wcs, &bad_single[i], 1));
+	}
+
+	// Microsoft-specific mappings, including the NEC and IBM
+	// extensions and the user-defined area.
+	static const char ms_in[] = "\x81\x5F\x81\x60\x81\x61\x81\x7C\x81\x91\x81\x92\x81\xCA"
+	                            "\x87\x40\xED\x40\xFA\x40\xF0\x40\xF9\xFC";
+	static const char16_t ms_out[] = {
+		0xFF3C, 0xFF5E, 0x2225, 0xFF0D, 0xFFE0, 0xFFE1, 0xFFE2,
+		0x2460, 0x7E8A, 0x2170, 0xE000, 0xE757
+	};
+	ret = pfn(wcs, ms_in, sizeof(ms_in)-1);
+	ASSERT_EQ(static_cast<int>(ARRAY_SIZE(ms_out)), ret);
+	EXPECT_EQ(u16string(ms_out, ARRAY_SIZE(ms_out)), u16string(wcs, ret));
+}
+
+/**
+ * Test cp932_to_utf16_cpp().
+ */
+TEST_F(TextFuncsTest, cp932_to_utf16_cpp)
+{
+	test_cp932_to_utf16(cp932_to_utf16_cpp);
+}
+
+#ifdef TEXTFUNCS_CPN_HAS_SSE2
+/**
+ * Test cp932_to_utf16_sse2().
+ */
+TEST_F(TextFuncsTest, cp932_to_utf16_sse2)
+{
+	test_cp932_to_utf16(cp932_to_utf16_sse2);
+}
+
+/**
+ * Compare the scalar and SSE2 cp932 decoders using mixed
+ * single-byte and double-byte text at all alignments.
+ */
+TEST_F(TextFuncsTest, cp932_to_utf16_sse2_compare)
+{
+	// ASCII, halfwidth katakana, and Japanese text.
+	string sjis;
+	for (unsigned int i = 0; i < 8; i++) {
+		sjis.append("ROM Properties \xB6\xC0\xB6\xC5 ");
+		sjis.append((const char*)sjis_data, ARRAY_SIZE(sjis_data)-1);
+	}
+
+	char16_t wcs_cpp[1024], wcs_sse2[1024];
+	ASSERT_LE(sjis.size(), ARRAY_SIZE(wcs_cpp));
+	for (size_t ofs = 0; ofs < sjis.size(); ofs++) {
+		// Skip offsets that start on a trail byte.
+		const int ret = cp932_to_utf16_cpp(wcs_cpp, &sjis[ofs], sjis.size() - ofs);
+		if (ret < 0)
+			continue;
+		EXPECT_EQ(ret, cp932_to_utf16_sse2(wcs_sse2, &sjis[ofs], sjis.size() - ofs));
+		EXPECT_EQ(0, memcmp(wcs_cpp, wcs_sse2, ret * sizeof(char16_t))) << "ofs == " << ofs;
+	}
+}
+#endif /* TEXTFUNCS_CPN_HAS_SSE2 */
+
+/**
+ * Benchmark cp1252_to_utf16_cpp().
+ */
+TEST_F(TextFuncsTest, cp1252_to_utf16_cpp_benchmark)
+{
+	const size_t len = ARRAY_SIZE(cp1252_data)-1;
+	char16_t wcs[ARRAY_SIZE(cp1252_data)];
+	for (unsigned int i = BENCHMARK_ITERATIONS * 10; i > 0; i--) {
+		ASSERT_EQ(len, cp1252_to_utf16_cpp(wcs, (const char*)cp1252_data, len));
+	}
+}
+
+#ifdef TEXTFUNCS_CPN_HAS_SSSE3
+/**
+ * Benchmark cp1252_to_utf16_ssse3().
+ */
+TEST_F(TextFuncsTest, cp1252_to_utf16_ssse3_benchmark)
+{
+	if (!RP_CPU_HasSSSE3()) {
+		fputs("*** SSSE3 is not supported on this CPU. Skipping test.\n", stderr);
+		return;
+	}
+
+	const size_t len = ARRAY_SIZE(cp1252_data)-1;
+	char16_t wcs[ARRAY_SIZE(cp1252_data)];
+	for (unsigned int i = BENCHMARK_ITERATIONS * 10; i > 0; i--) {
+		ASSERT_EQ(len, cp1252_to_utf16_ssse3(wcs, (const char*)cp1252_data, len));
+	}
+}
+#endif /* TEXTFUNCS_CPN_HAS_SSSE3 */
+
+/**
+ * Benchmark cp932_to_utf16_cpp() with mostly single-byte text.
+ */
+TEST_F(TextFuncsTest, cp932_to_utf16_cpp_benchmark)
+{
+	static const char sjis_in[] = "ROM Properties Page shell extension \xB6\xC0\xB6\xC5 "
+	                              "\x83\x7C\x83\x50\x83\x82\x83\x93 SUPER MARIO SUNSHINE";
+	char16_t wcs[ARRAY_SIZE(sjis_in)];
+	for (unsigned int i = BENCHMARK_ITERATIONS * 10; i > 0; i--) {
+		ASSERT_GT(cp932_to_utf16_cpp(wcs, sjis_in, sizeof(sjis_in)-1), 0);
+	}
+}
+
+#ifdef TEXTFUNCS_CPN_HAS_SSE2
+/**
+ * Benchmark cp932_to_utf16_sse2() with mostly single-byte text.
+ */
+TEST_F(TextFuncsTest, cp932_to_utf16_sse2_benchmark)
+{
+	static const char sjis_in[] = "ROM Properties Page shell extension \xB6\xC0\xB6\xC5 "
+	                              "\x83\x7C\x83\x50\x83\x82\x83\x93 SUPER MARIO SUNSHINE";
+	char16_t wcs[ARRAY_SIZE(sjis_in)];
+	for (unsigned int i = BENCHMARK_ITERATIONS * 10; i > 0; i--) {
+		ASSERT_GT(cp932_to_utf16_sse2(wcs, sjis_in, sizeof(sjis_in)-1), 0);
+	}
+}
+#endif /* TEXTFUNCS_CPN_HAS_SSE2 */
+
+/**
+ * Benchmark utf16le_to_utf8().
+ */
+TEST_F(TextFuncsTest, utf16le_to_utf8_benchmark)
+{
+	for (unsigned int i = BENCHMARK_ITERATIONS; i > 0; i--) {
+		string str = utf16le_to_utf8((const char16_t*)utf16le_data, (sizeof(utf16le_data)/sizeof(char16_t))-1);
+		ASSERT_EQ(ARRAY_SIZE(utf8_data)-1, str.size());
+	}
+}
+
+/**
+ * Benchmark utf16be_to_utf8().
+ */
+TEST_F(TextFuncsTest, utf16be_to_utf8_benchmark)
+{
+	for (unsigned int i = BENCHMARK_ITERATIONS; i > 0; i--) {
+		string str = utf16be_to_utf8((const char16_t*)utf16be_data, (sizeof(utf16be_data)/sizeof(char16_t))-1);
+		ASSERT_EQ(ARRAY_SIZE(utf8_data)-1, str.size());
+	}
+}
+
+/**
+ * Benchmark utf16_to_utf8_cpp() with a mostly-ASCII title.
+ */
+TEST_F(TextFuncsTest, utf16_to_utf8_cpp_benchmark)
+{
+	u16string wcs;
+	for (unsigned int i = 0; i < 8; i++) {
+		wcs += u"The Legend of Zelda: Ocarina of Time 3D \x00A9 Nintendo\n";
+	}
+	string mbs;
+	mbs.resize(wcs.size() * 3);
+	for (unsigned int i = BENCHMARK_ITERATIONS; i > 0; i--) {
+		ASSERT_EQ(wcs.size() + 8, utf16_to_utf8_cpp(&mbs[0], wcs.data(), wcs.size(), false));
+	}
+}
+
+#ifdef TEXTFUNCS_UTF16_HAS_SSE2
+/**
+ * Benchmark utf16_to_utf8_sse2() with a mostly-ASCII title.
+ */
+TEST_F(TextFuncsTest, utf16_to_utf8_sse2_benchmark)
+{
+	u16string wcs;
+	for (unsigned int i = 0; i < 8; i++) {
+		wcs += u"The Legend of Zelda: Ocarina of Time 3D \x00A9 Nintendo\n";
+	}
+	string mbs;
+	mbs.resize(wcs.size() * 3);
+	for (unsigned int i = BENCHMARK_ITERATIONS; i > 0; i--) {
+		ASSERT_EQ(wcs.size() + 8, utf16_to_utf8_sse2(&mbs[0], wcs.data(), wcs.size(), false));
+	}
+}
+#endif /* TEXTFUNCS_UTF16_HAS_SSE2 */
+
 /** Miscellaneous functions. **/
 
 /**
@@ -0,0 +1,177 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase/tests)                  *
+ * IconAnimDataTest.cpp: IconAnimData frame storage tests.                 *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// librpbase
+#include "common.h"
+#include "img/rp_image.hpp"
+#include "img/IconAnimData.hpp"
+
+// C includes.
+#include <stdint.h>
+
+// C includes. (C++ namespace)
+#include <cstring>
+
+// C++ includes.
+#include <memory>
+using std::unique_ptr;
+
+namespace LibRpBase { namespace Tests {
+
+class IconAnimDataTest : public ::testing::Test
+{
+	protected:
+		IconAnimDataTest() { }
+		~IconAnimDataTest()
+		{
+			for (int i = iconAnimData.count-1; i >= 0; i--) {
+				delete iconAnimData.frames[i];
+			}
+		}
+
+	public:
+		static const int ICON_W = 16;
+		static const int ICON_H = 16;
+
+		/**
+		 * Create an ARGB32 test frame.
+		 * Each pixel is one of two colors, depending on
+		 * whether it's in the column specified by `stripe`.
+		 * @param stripe Column to highlight.
+		 * @return Frame image.
+		 */
+		static rp_image *createFrame(int stripe)
+		{
+			rp_image *const img = new rp_image(ICON_W, ICON_H, rp_image::FORMAT_ARGB32);
+			for (int y = 0; y < ICON_H; y++) {
+				uint32_t *const px = static_cast<uint32_t*>(img->scanLine(y));
+				for (int x = 0; x < ICON_W; x++) {
+					px[x] = (x == stripe ? 0xFFFFFF00 : 0x00000000);
+				}
+			}
+			return img;
+		}
+
+		/**
+		 * Compare the pixels of an image with an ARGB32 image.
+		 * @param expected Expected image. (ARGB32)
+		 * @param actual Actual image.
+		 */
+		static void Compare_ARGB32(const rp_image *expected, const rp_image *actual)
+		{
+			unique_ptr<rp_image> argb(actual->dup_ARGB32());
+			ASSERT_TRUE(argb.get() != nullptr);
+			ASSERT_EQ(expected->width(), argb->width());
+			ASSERT_EQ(expected->height(), argb->height());
+			for (int y = 0; y < expected->height(); y++) {
+				ASSERT_EQ(0, memcmp(expected->scanLine(y), argb->scanLine(y), expected->row_bytes()))
+					<< "Image data doesn't match on line " << y << '.';
+			}
+		}
+
+		IconAnimData iconAnimData;
+};
+
+/**
+ * Identical frames should be removed, and the sequence
+ * should refer to the first copy.
+ */
+TEST_F(IconAnimDataTest, dedupFrames)
+{
+	static const int stripes[] = {0, 1, 0, 2, 1};
+	static const uint8_t seq[] = {0, 1, 2, 3, 4, 2};
+	iconAnimData.count = ARRAY_SIZE(stripes);
+	for (int i = 0; i < ARRAY_SIZE(stripes); i++) {
+		iconAnimData.frames[i] = createFrame(stripes[i]);
+	}
+	iconAnimData.seq_count = ARRAY_SIZE(seq);
+	memcpy(iconAnimData.seq_index.data(), seq, sizeof(seq));
+
+	EXPECT_EQ(2, iconAnimData.dedupFrames());
+
+	EXPECT_TRUE(iconAnimData.frames[0] != nullptr);
+	EXPECT_TRUE(iconAnimData.frames[1] != nullptr);
+	EXPECT_TRUE(iconAnimData.frames[2] == nullptr);
+	EXPECT_TRUE(iconAnimData.frames[3] != nullptr);
+	EXPECT_TRUE(iconAnimData.frames[4] == nullptr);
+
+	static const uint8_t seq_expected[] = {0, 1, 0, 3, 1, 0};
+	EXPECT_EQ(0, memcmp(seq_expected, iconAnimData.seq_index.data(), sizeof(seq_expected)));
+
+	// Running it again shouldn't remove anything else.
+	EXPECT_EQ(0, iconAnimData.dedupFrames());
+}
+
+/**
+ * ARGB32 frames with few colors should be converted to CI8
+ * with a shared palette, without changing the pixels.
+ */
+TEST_F(IconAnimDataTest, packFramesCI8)
+{
+	iconAnimData.count = 3;
+	unique_ptr<rp_image> orig[3];
+	for (int i = 0; i < 3; i++) {
+		iconAnimData.frames[i] = createFrame(i);
+		orig[i].reset(iconAnimData.frames[i]->dup());
+	}
+
+	ASSERT_TRUE(iconAnimData.packFramesCI8());
+	const uint32_t *const palette = iconAnimData.frames[0]->palette();
+	for (int i = 0; i < 3; i++) {
+		const rp_image *const img = iconAnimData.frames[i];
+		ASSERT_EQ(rp_image::FORMAT_CI8, img->format());
+		EXPECT_EQ(0, memcmp(palette, img->palette(), img->palette_len() * sizeof(uint32_t)))
+			<< "Frame " << i << " doesn't use the shared palette.";
+		// Only one color is transparent.
+		EXPECT_GE(img->tr_idx(), 0);
+		ASSERT_NO_FATAL_FAILURE(Compare_ARGB32(orig[i].get(), img));
+	}
+
+	// Already CI8. Nothing to do.
+	EXPECT_FALSE(iconAnimData.packFramesCI8());
+}
+
+/**
+ * Frames with more than 256 colors can't be converted to CI8.
+ */
+TEST_F(IconAnimDataTest, packFramesCI8_tooManyColors)
+{
+	rp_image *const img = createFrame(0);
+	for (int y = 0; y < ICON_H; y++) {
+		uint32_t *const px = static_cast<uint32_t*>(img->scanLine(y));
+		for (int x = 0; x < ICON_W; x++) {
+			px[x] = 0xFF000000 | (y << 8) | x;
+		}
+	}
+	// Make the first frame have 256 colors.
+	iconAnimData.count = 2;
+	iconAnimData.frames[0] = img;
+	// The second frame adds one more color.
+	iconAnimData.frames[1] = createFrame(1);
+
+	EXPECT_FALSE(iconAnimData.packFramesCI8());
+	EXPECT_EQ(rp_image::FORMAT_ARGB32, iconAnimData.frames[0]->format());
+	EXPECT_EQ(rp_image::FORMAT_ARGB32, iconAnimData.frames[1]->format());
+}
+
+} }
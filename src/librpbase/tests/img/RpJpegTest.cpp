@@ -0,0 +1,126 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase/tests)                  *
+ * RpJpegTest.cpp: RpJpeg DCT scaling test.                                *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// librpbase
+#include "librpbase/config.librpbase.h"
+#include "common.h"
+#include "file/RpFile.hpp"
+#include "file/FileSystem.hpp"
+#include "img/rp_image.hpp"
+#include "img/RpImageLoader.hpp"
+
+// C++ includes.
+#include <memory>
+#include <ostream>
+#include <string>
+using std::string;
+using std::unique_ptr;
+
+#ifdef HAVE_JPEG
+
+namespace LibRpBase { namespace Tests {
+
+struct RpJpegTest_mode
+{
+	int req_size;		// Requested image size.
+	int width;		// Expected width.
+	int height;		// Expected height.
+
+	RpJpegTest_mode(int req_size, int width, int height)
+		: req_size(req_size)
+		, width(width)
+		, height(height)
+	{ }
+};
+
+class RpJpegTest : public ::testing::TestWithParam<RpJpegTest_mode>
+{
+	protected:
+		RpJpegTest()
+			: ::testing::TestWithParam<RpJpegTest_mode>()
+		{ }
+
+	public:
+		// Test image. (100x60, RGB)
+		static const char jpeg_filename[];
+};
+
+const char RpJpegTest::jpeg_filename[] = "gradient.RGB24.jpg";
+
+/**
+ * Formatting function for RpJpegTest.
+ */
+inline ::std::ostream& operator<<(::std::ostream& os, const RpJpegTest_mode& mode)
+{
+	return os << "req_size " << mode.req_size;
+};
+
+/**
+ * Load the test image with a requested size.
+ * The image should be decoded using the largest DCT scaling
+ * factor that keeps its larger dimension at least req_size,
+ * or at full size if no scaling factor is usable.
+ */
+TEST_P(RpJpegTest, loadScaled)
+{
+	const RpJpegTest_mode &mode = GetParam();
+
+	string path = "png_data";
+	path += DIR_SEP_CHR;
+	path += jpeg_filename;
+	unique_IRpFile<RpFile> file(new RpFile(path, RpFile::FM_OPEN_READ));
+	ASSERT_TRUE(file->isOpen());
+
+	unique_ptr<rp_image> img(RpImageLoader::load(file.get(), mode.req_size));
+	ASSERT_TRUE(img.get() != nullptr) << "RpImageLoader failed to load the image.";
+	EXPECT_TRUE(img->isValid());
+	EXPECT_EQ(mode.width, img->width());
+	EXPECT_EQ(mode.height, img->height());
+}
+
+// Test cases.
+// NOTE: libjpeg rounds scaled dimensions up.
+INSTANTIATE_TEST_CASE_P(png_data, RpJpegTest,
+	::testing::Values(
+		// Full size
+		RpJpegTest_mode(0, 100, 60),
+		RpJpegTest_mode(100, 100, 60),
+		RpJpegTest_mode(256, 100, 60),
+		RpJpegTest_mode(51, 100, 60),
+
+		// 1/2 scale
+		RpJpegTest_mode(50, 50, 30),
+		RpJpegTest_mode(26, 50, 30),
+
+		// 1/4 scale
+		RpJpegTest_mode(25, 25, 15),
+		RpJpegTest_mode(14, 25, 15),
+
+		// 1/8 scale
+		RpJpegTest_mode(13, 13, 8),
+		RpJpegTest_mode(1, 13, 8))
+	);
+
+} }
+
+#endif /* HAVE_JPEG */
@@ -0,0 +1,530 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase/tests)                  *
+ * RpPngWriterTest.cpp: RpPngWriter encoding tests.                        *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// librpbase
+#include "common.h"
+#include "byteswap.h"
+#include "file/RpFile.hpp"
+#include "file/FileSystem.hpp"
+#include "img/rp_image.hpp"
+#include "img/RpImageLoader.hpp"
+#include "img/RpPng.hpp"
+#include "img/RpPngWriter.hpp"
+
+// C includes.
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef _WIN32
+# include "libwin32common/RpWin32_sdk.h"
+# include <direct.h>
+#else /* !_WIN32 */
+# include <unistd.h>
+#endif /* _WIN32 */
+
+// C includes. (C++ namespace)
+#include "librpbase/ctypex.h"
+#include <cinttypes>
+#include <cstring>
+
+// C++ includes.
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+namespace LibRpBase { namespace Tests {
+
+// Temporary directory for output files.
+static string tmp_dir;
+
+/**
+ * Remove the temporary directory.
+ * Registered with atexit() by tmpPath().
+ */
+static void removeTmpDir(void)
+{
+#ifdef _WIN32
+	_rmdir(tmp_dir.c_str());
+#else /* !_WIN32 */
+	rmdir(tmp_dir.c_str());
+#endif /* _WIN32 */
+}
+
+/**
+ * Get the path of a temporary output file.
+ * The temporary directory is created on first use,
+ * so test runs don't write to the working directory
+ * and don't conflict with each other.
+ * @param filename Filename.
+ * @return Path in the temporary directory, or an empty string on error.
+ */
+static string tmpPath(const char *filename)
+{
+	if (tmp_dir.empty()) {
+#ifdef _WIN32
+		char tmp_path[MAX_PATH];
+		const DWORD len = GetTempPathA(sizeof(tmp_path), tmp_path);
+		if (len == 0 || len >= sizeof(tmp_path))
+			return string();
+		char dirname[64];
+		snprintf(dirname, sizeof(dirname), "rp-RpPngWriterTest.%lu",
+			static_cast<unsigned long>(GetCurrentProcessId()));
+		string path = tmp_path;
+		path += dirname;
+		if (_mkdir(path.c_str()) != 0 && errno != EEXIST)
+			return string();
+		tmp_dir = path;
+#else /* !_WIN32 */
+		char tmpl[] = "/tmp/rp-RpPngWriterTest.XXXXXX";
+		if (!mkdtemp(tmpl))
+			return string();
+		tmp_dir = tmpl;
+#endif /* _WIN32 */
+		atexit(removeTmpDir);
+	}
+
+	string path = tmp_dir;
+	path += DIR_SEP_CHR;
+	path += filename;
+	return path;
+}
+
+struct RpPngWriterTest_mode
+{
+	string png_filename;		// PNG image to re-encode.
+	RpPngWriter::Profile profile;	// Encoding profile.
+
+	RpPngWriterTest_mode(const char *png_filename, RpPngWriter::Profile profile)
+		: png_filename(png_filename)
+		, profile(profile)
+	{ }
+};
+
+class RpPngWriterTest : public ::testing::TestWithParam<RpPngWriterTest_mode>
+{
+	protected:
+		RpPngWriterTest()
+			: ::testing::TestWithParam<RpPngWriterTest_mode>()
+		{ }
+
+		void SetUp(void) final;
+		void TearDown(void) final;
+
+	public:
+		// Number of iterations for benchmarks.
+		static const unsigned int BENCHMARK_ITERATIONS = 100;
+
+		// Temporary output filename.
+		string m_tmp_filename;
+
+		// Source image.
+		unique_ptr<rp_image> m_img;
+
+		/**
+		 * Compare two rp_images.
+		 * @param expected Expected image.
+		 * @param actual Actual image.
+		 */
+		static void Compare_RpImage(const rp_image *expected, const rp_image *actual);
+
+	public:
+		/** Test case parameters. **/
+
+		/**
+		 * Test case suffix generator.
+		 * @param info Test parameter information.
+		 * @return Test case suffix.
+		 */
+		static string test_case_suffix_generator(const ::testing::TestParamInfo<RpPngWriterTest_mode> &info);
+};
+
+/**
+ * Formatting function for RpPngWriterTest.
+ */
+inline ::std::ostream& operator<<(::std::ostream& os, const RpPngWriterTest_mode& mode)
+{
+	return os << mode.png_filename << " (profile " << static_cast<int>(mode.profile) << ')';
+};
+
+/**
+ * SetUp() function.
+ * Run before each test.
+ */
+void RpPngWriterTest::SetUp(void)
+{
+	const RpPngWriterTest_mode &mode = GetParam();
+
+	// Load the source PNG image.
+	string path = "png_data";
+	path += DIR_SEP_CHR;
+	path += mode.png_filename;
+	unique_IRpFile<RpFile> file(new RpFile(path, RpFile::FM_OPEN_READ));
+	ASSERT_TRUE(file->isOpen());
+
+	m_img.reset(RpImageLoader::load(file.get()));
+	ASSERT_TRUE(m_img.get() != nullptr) << "RpImageLoader failed to load the image.";
+
+	m_tmp_filename = tmpPath("RpPngWriterTest.png");
+	ASSERT_FALSE(m_tmp_filename.empty());
+}
+
+/**
+ * TearDown() function.
+ * Run after each test.
+ */
+void RpPngWriterTest::TearDown(void)
+{
+	if (!m_tmp_filename.empty()) {
+		remove(m_tmp_filename.c_str());
+	}
+}
+
+/**
+ * Compare two rp_images.
+ * @param expected Expected image.
+ * @param actual Actual image.
+ */
+void RpPngWriterTest::Compare_RpImage(const rp_image *expected, const rp_image *actual)
+{
+	ASSERT_EQ(expected->width(), actual->width());
+	ASSERT_EQ(expected->height(), actual->height());
+	ASSERT_EQ(expected->format(), actual->format());
+
+	if (expected->format() == rp_image::FORMAT_CI8) {
+		// Only the palette entries in the source image are saved.
+		ASSERT_LE(expected->palette_len(), actual->palette_len());
+		EXPECT_EQ(0, memcmp(expected->palette(), actual->palette(),
+			expected->palette_len() * sizeof(uint32_t)))
+			<< "Palettes don't match.";
+	}
+
+	const int bytesPerPixel = (expected->format() == rp_image::FORMAT_ARGB32 ? 4 : 1);
+	const size_t row_bytes = expected->width() * bytesPerPixel;
+	for (int y = 0; y < expected->height(); y++) {
+		ASSERT_EQ(0, memcmp(expected->scanLine(y), actual->scanLine(y), row_bytes))
+			<< "Image data doesn't match on line " << y << '.';
+	}
+}
+
+/**
+ * Save an image using the test's encoding profile,
+ * then verify that it decodes back to the original.
+ */
+TEST_P(RpPngWriterTest, roundTripTest)
+{
+	const RpPngWriterTest_mode &mode = GetParam();
+
+	ASSERT_EQ(0, RpPng::save(m_tmp_filename.c_str(), m_img.get(), mode.profile));
+
+	unique_IRpFile<RpFile> file(new RpFile(m_tmp_filename, RpFile::FM_OPEN_READ));
+	ASSERT_TRUE(file->isOpen());
+	unique_ptr<rp_image> img(RpImageLoader::load(file.get()));
+	ASSERT_TRUE(img.get() != nullptr) << "RpImageLoader failed to load the re-encoded image.";
+
+	ASSERT_NO_FATAL_FAILURE(Compare_RpImage(m_img.get(), img.get()));
+}
+
+/**
+ * Benchmark encoding an image using the test's encoding profile.
+ */
+TEST_P(RpPngWriterTest, encode_benchmark)
+{
+	const RpPngWriterTest_mode &mode = GetParam();
+
+	for (unsigned int i = BENCHMARK_ITERATIONS; i > 0; i--) {
+		ASSERT_EQ(0, RpPng::save(m_tmp_filename.c_str(), m_img.get(), mode.profile));
+	}
+
+	// Report the encoded size so the profiles can be compared.
+	const int64_t sz = FileSystem::filesize(m_tmp_filename);
+	ASSERT_GT(sz, 0);
+	printf("%s: profile %d: %" PRId64 " bytes\n",
+		mode.png_filename.c_str(), static_cast<int>(mode.profile), sz);
+}
+
+/**
+ * Create a test frame for the streaming APNG tests.
+ * A small square is drawn at a position that depends on the frame number.
+ * @param frame Frame number.
+ * @return Frame image.
+ */
+static rp_image *createStreamFrame(int frame)
+{
+	static const int dim = 64;
+	rp_image *const img = new rp_image(dim, dim, rp_image::FORMAT_ARGB32);
+	for (int y = 0; y < dim; y++) {
+		uint32_t *const px = static_cast<uint32_t*>(img->scanLine(y));
+		for (int x = 0; x < dim; x++) {
+			const bool in_square = (x >= frame*8 && x < frame*8 + 8 &&
+						y >= 16 && y < 24);
+			px[x] = (in_square ? 0xFFFF0000 : 0xFF000080);
+		}
+	}
+	return img;
+}
+
+/**
+ * APNG frame control information from an fcTL chunk.
+ */
+struct ApngFrameInfo {
+	uint32_t width, height;
+	uint32_t x_offset, y_offset;
+	uint16_t delay_num, delay_den;
+};
+
+/**
+ * Read the APNG chunks from a PNG file.
+ * @param filename	[in] PNG filename.
+ * @param num_frames	[out] Number of frames from acTL. (0 if no acTL)
+ * @param frames	[out] Frame control information from each fcTL.
+ */
+static void readApngChunks(const char *filename, uint32_t &num_frames, vector<ApngFrameInfo> &frames)
+{
+	num_frames = 0;
+	frames.clear();
+
+	unique_IRpFile<RpFile> file(new RpFile(filename, RpFile::FM_OPEN_READ));
+	ASSERT_TRUE(file->isOpen());
+	const int64_t sz = file->size();
+	ASSERT_GT(sz, 8);
+	vector<uint8_t> buf(static_cast<size_t>(sz));
+	ASSERT_EQ(buf.size(), file->read(buf.data(), buf.size()));
+
+	// Skip the PNG signature.
+	size_t pos = 8;
+	while (pos + 12 <= buf.size()) {
+		const uint8_t *const chunk = &buf[pos];
+		const uint32_t len = (chunk[0] << 24) | (chunk[1] << 16) | (chunk[2] << 8) | chunk[3];
+		ASSERT_LE(pos + 12 + len, buf.size());
+		const uint8_t *const data = chunk + 8;
+		if (!memcmp(&chunk[4], "acTL", 4)) {
+			ASSERT_EQ(8U, len);
+			num_frames = be32_to_cpu(*reinterpret_cast<const uint32_t*>(data));
+		} else if (!memcmp(&chunk[4], "fcTL", 4)) {
+			ASSERT_EQ(26U, len);
+			ApngFrameInfo info;
+			info.width = be32_to_cpu(*reinterpret_cast<const uint32_t*>(&data[4]));
+			info.height = be32_to_cpu(*reinterpret_cast<const uint32_t*>(&data[8]));
+			info.x_offset = be32_to_cpu(*reinterpret_cast<const uint32_t*>(&data[12]));
+			info.y_offset = be32_to_cpu(*reinterpret_cast<const uint32_t*>(&data[16]));
+			info.delay_num = be16_to_cpu(*reinterpret_cast<const uint16_t*>(&data[20]));
+			info.delay_den = be16_to_cpu(*reinterpret_cast<const uint16_t*>(&data[22]));
+			frames.push_back(info);
+		}
+		pos += 12 + len;
+	}
+}
+
+/**
+ * Write images one frame at a time, then verify the
+ * first frame, the frame count, and each frame's
+ * changed region and delay.
+ * @param frame_count Number of frames.
+ */
+static void streamTest(int frame_count)
+{
+	const string tmp_filename = tmpPath("RpPngWriterTest.stream.png");
+	ASSERT_FALSE(tmp_filename.empty());
+	unique_ptr<rp_image> frame0(createStreamFrame(0));
+
+	{
+		RpPngWriter pngWriter(tmp_filename.c_str(), frame0->width(), frame0->height(),
+			frame0->format(), frame_count);
+		if (frame_count > 1 && pngWriter.lastError() == ENOTSUP) {
+			// APNG write support isn't available.
+			printf("APNG is not available; skipping streaming test.\n");
+			remove(tmp_filename.c_str());
+			return;
+		}
+		ASSERT_TRUE(pngWriter.isOpen());
+		ASSERT_EQ(0, pngWriter.write_IHDR());
+
+		// Each frame has a different delay.
+		ASSERT_EQ(0, pngWriter.write_frame(frame0.get(), 1, 10));
+		for (int i = 1; i < frame_count; i++) {
+			unique_ptr<rp_image> frame(createStreamFrame(i));
+			ASSERT_EQ(0, pngWriter.write_frame(frame.get(), i+1, 10));
+		}
+
+		// All frames have been written.
+		EXPECT_FALSE(pngWriter.isOpen());
+		EXPECT_NE(0, pngWriter.write_frame(frame0.get(), 1, 10));
+	}
+
+	// The default image is the first frame.
+	unique_IRpFile<RpFile> file(new RpFile(tmp_filename, RpFile::FM_OPEN_READ));
+	ASSERT_TRUE(file->isOpen());
+	unique_ptr<rp_image> img(RpImageLoader::load(file.get()));
+	ASSERT_TRUE(img.get() != nullptr) << "RpImageLoader failed to load the streamed image.";
+	const size_t row_bytes = frame0->width() * sizeof(uint32_t);
+	ASSERT_EQ(frame0->width(), img->width());
+	ASSERT_EQ(frame0->height(), img->height());
+	ASSERT_EQ(frame0->format(), img->format());
+	for (int y = 0; y < frame0->height(); y++) {
+		ASSERT_EQ(0, memcmp(frame0->scanLine(y), img->scanLine(y), row_bytes))
+			<< "Image data doesn't match on line " << y << '.';
+	}
+	file.release()->unref();
+
+	// Check the APNG chunks.
+	uint32_t num_frames;
+	vector<ApngFrameInfo> frames;
+	ASSERT_NO_FATAL_FAILURE(readApngChunks(tmp_filename.c_str(), num_frames, frames));
+	if (frame_count == 1) {
+		// Standard PNG image.
+		EXPECT_EQ(0U, num_frames);
+		EXPECT_TRUE(frames.empty());
+	} else {
+		EXPECT_EQ(static_cast<uint32_t>(frame_count), num_frames);
+		ASSERT_EQ(static_cast<size_t>(frame_count), frames.size());
+
+		// The first frame is the full image.
+		EXPECT_EQ(static_cast<uint32_t>(frame0->width()), frames[0].width);
+		EXPECT_EQ(static_cast<uint32_t>(frame0->height()), frames[0].height);
+		EXPECT_EQ(0U, frames[0].x_offset);
+		EXPECT_EQ(0U, frames[0].y_offset);
+
+		// The square moves 8px to the right in each frame,
+		// so the changed region covers its old and new positions.
+		for (int i = 0; i < frame_count; i++) {
+			if (i > 0) {
+				EXPECT_EQ(16U, frames[i].width) << "frame " << i;
+				EXPECT_EQ(8U, frames[i].height) << "frame " << i;
+				EXPECT_EQ(static_cast<uint32_t>((i-1) * 8), frames[i].x_offset) << "frame " << i;
+				EXPECT_EQ(16U, frames[i].y_offset) << "frame " << i;
+			}
+			EXPECT_EQ(i+1, frames[i].delay_num) << "frame " << i;
+			EXPECT_EQ(10, frames[i].delay_den) << "frame " << i;
+		}
+	}
+
+	remove(tmp_filename.c_str());
+}
+
+/**
+ * Write a single-frame image using the streaming API.
+ */
+TEST(RpPngWriterStreamTest, singleFrameTest)
+{
+	ASSERT_NO_FATAL_FAILURE(streamTest(1));
+}
+
+/**
+ * Write an animated image using the streaming API.
+ */
+TEST(RpPngWriterStreamTest, multiFrameTest)
+{
+	ASSERT_NO_FATAL_FAILURE(streamTest(4));
+}
+
+/**
+ * If the writer is destroyed before all frames are written,
+ * the file is deleted, since the acTL frame count is wrong.
+ */
+TEST(RpPngWriterStreamTest, partialWriteTest)
+{
+	const string tmp_filename = tmpPath("RpPngWriterTest.partial.png");
+	ASSERT_FALSE(tmp_filename.empty());
+	unique_ptr<rp_image> frame0(createStreamFrame(0));
+
+	{
+		RpPngWriter pngWriter(tmp_filename.c_str(), frame0->width(), frame0->height(),
+			frame0->format(), 4);
+		if (pngWriter.lastError() == ENOTSUP) {
+			// APNG write support isn't available.
+			printf("APNG is not available; skipping partial write test.\n");
+			remove(tmp_filename.c_str());
+			return;
+		}
+		ASSERT_TRUE(pngWriter.isOpen());
+		ASSERT_EQ(0, pngWriter.write_IHDR());
+		ASSERT_EQ(0, pngWriter.write_frame(frame0.get(), 1, 10));
+		unique_ptr<rp_image> frame1(createStreamFrame(1));
+		ASSERT_EQ(0, pngWriter.write_frame(frame1.get(), 1, 10));
+		EXPECT_EQ(0, FileSystem::access(tmp_filename, R_OK));
+	}
+
+	EXPECT_NE(0, FileSystem::access(tmp_filename, R_OK));
+	remove(tmp_filename.c_str());
+}
+
+/**
+ * Test case suffix generator.
+ * @param info Test parameter information.
+ * @return Test case suffix.
+ */
+string RpPngWriterTest::test_case_suffix_generator(const ::testing::TestParamInfo<RpPngWriterTest_mode> &info)
+{
+	static const char *const profile_names[] = {
+		"_default", "_fast", "_small",
+	};
+	static_assert(ARRAY_SIZE(profile_names) == RpPngWriter::PROFILE_MAX, "profile_names[] is the wrong size.");
+
+	string suffix = info.param.png_filename;
+
+	// Replace all non-alphanumeric characters with '_'.
+	// See gtest-param-util.h::IsValidParamName().
+	for (auto iter = suffix.begin(); iter != suffix.end(); ++iter) {
+		// NOTE: Not checking for '_' because that
+		// wastes a branch.
+		if (!ISALNUM(*iter)) {
+			*iter = '_';
+		}
+	}
+
+	suffix += profile_names[info.param.profile];
+	return suffix;
+}
+
+// Test cases.
+
+#define RPPNGWRITER_TEST_FILE(png_filename) \
+	RpPngWriterTest_mode(png_filename, RpPngWriter::PROFILE_DEFAULT), \
+	RpPngWriterTest_mode(png_filename, RpPngWriter::PROFILE_FAST), \
+	RpPngWriterTest_mode(png_filename, RpPngWriter::PROFILE_SMALL)
+
+INSTANTIATE_TEST_CASE_P(png_data, RpPngWriterTest,
+	::testing::Values(
+		RPPNGWRITER_TEST_FILE("gl_triangle.RGB24.png"),
+		RPPNGWRITER_TEST_FILE("gl_triangle.RGB24.tRNS.png"),
+		RPPNGWRITER_TEST_FILE("gl_triangle.ARGB32.png"),
+		RPPNGWRITER_TEST_FILE("gl_triangle.gray.png"),
+		RPPNGWRITER_TEST_FILE("gl_triangle.gray.alpha.png"),
+		RPPNGWRITER_TEST_FILE("gl_quad.RGB24.png"),
+		RPPNGWRITER_TEST_FILE("gl_quad.RGB24.tRNS.png"),
+		RPPNGWRITER_TEST_FILE("gl_quad.ARGB32.png"),
+		RPPNGWRITER_TEST_FILE("gl_quad.gray.png"),
+		RPPNGWRITER_TEST_FILE("gl_quad.gray.alpha.png"),
+		RPPNGWRITER_TEST_FILE("xterm-256color.CI8.png"),
+		RPPNGWRITER_TEST_FILE("xterm-256color.CI8.tRNS.png"),
+		RPPNGWRITER_TEST_FILE("odd-width.16color.CI4.png"),
+		RPPNGWRITER_TEST_FILE("happy-mac.mono.png"),
+		RPPNGWRITER_TEST_FILE("happy-mac.mono.odd-size.png"))
+	, RpPngWriterTest::test_case_suffix_generator);
+
+} }
@@ -0,0 +1,42 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * ThreadLocal.hpp: Thread-local pointer.                                  *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef __ROMPROPERTIES_LIBRPBASE_THREADLOCAL_HPP__
+#define __ROMPROPERTIES_LIBRPBASE_THREADLOCAL_HPP__
+
+#include "common.h"
+
+// NOTE: The .cpp files are #included here in order to inline the functions.
+// Do NOT compile them separately!
+
+// Each .cpp file defines the ThreadLocalPtr class itself, with required fields.
+
+// NOTE: Compiler-provided thread-local storage (__declspec(thread),
+// __thread, thread_local) isn't used, since implicit TLS doesn't work
+// in DLLs loaded with LoadLibrary() on Windows XP, e.g. the shell
+// extension DLL loaded by Explorer.
+
+#ifdef _WIN32
+# include "ThreadLocalWin32.cpp"
+#else /* !_WIN32 */
+# include "ThreadLocalPosix.cpp"
+#endif
+
+#endif /* __ROMPROPERTIES_LIBRPBASE_THREADLOCAL_HPP__ */
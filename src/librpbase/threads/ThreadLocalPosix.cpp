@@ -0,0 +1,118 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (librpbase)                        *
+ * ThreadLocalPosix.cpp: POSIX thread-local pointer implementation.        *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "ThreadLocal.hpp"
+#include <pthread.h>
+
+// C includes. (C++ namespace)
+#include <cerrno>
+
+namespace LibRpBase {
+
+class ThreadLocalPtr
+{
+	public:
+		/**
+		 * Create a thread-local pointer.
+		 * The pointer is initially nullptr in all threads.
+		 */
+		inline explicit ThreadLocalPtr();
+
+		/**
+		 * Delete the thread-local pointer.
+		 * NOTE: The objects pointed to aren't deleted.
+		 */
+		inline ~ThreadLocalPtr();
+
+	private:
+		RP_DISABLE_COPY(ThreadLocalPtr)
+
+	public:
+		/**
+		 * Get the pointer for the current thread.
+		 * @return Pointer, or nullptr if it isn't set.
+		 */
+		inline void *get(void) const;
+
+		/**
+		 * Set the pointer for the current thread.
+		 * @param ptr Pointer.
+		 * @return 0 on success; non-zero on error.
+		 */
+		inline int set(void *ptr);
+
+	private:
+		pthread_key_t m_key;
+		// NOTE: If the ThreadLocalPtr is a static object, this is
+		// false until it's constructed, so get() returns nullptr
+		// if it's called by another static initializer.
+		bool m_isInit;
+};
+
+/**
+ * Create a thread-local pointer.
+ * The pointer is initially nullptr in all threads.
+ */
+inline ThreadLocalPtr::ThreadLocalPtr()
+	: m_isInit(false)
+{
+	if (pthread_key_create(&m_key, nullptr) == 0) {
+		m_isInit = true;
+	} else {
+		// FIXME: Do something if an error occurred here...
+	}
+}
+
+/**
+ * Delete the thread-local pointer.
+ * NOTE: The objects pointed to aren't deleted.
+ */
+inline ThreadLocalPtr::~ThreadLocalPtr()
+{
+	if (m_isInit) {
+		pthread_key_delete(m_key);
+		m_isInit = false;
+	}
+}
+
+/**
+ * Get the pointer for the current thread.
+ * @return Pointer, or nullptr if it isn't set.
+ */
+inline void *ThreadLocalPtr::get(void) const
+{
+	if (!m_isInit)
+		return nullptr;
+	return pthread_getspecific(m_key);
+}
+
+/**
+ * Set the pointer for the current thread.
+ * @param ptr Pointer.
+ * @return 0 on success; non-zero on error.
+ */
+inline int ThreadLocalPtr::set(void *ptr)
+{
+	if (!m_isInit)
+		return -EBADF;
+	return pthread_setspecific(m_key, ptr);
+}
+
+}
@@ -0,0 +1,490 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (rpcli)                            *
+ * catalog.cpp: Incremental result catalog.                               *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+
+#include "stdafx.h"
+#include "config.rpcli.h"
+#include "catalog.hpp"
+
+#ifdef _WIN32
+#error This file should only be compiled on Unix-like systems.
+#endif
+
+// librpbase
+#include "librpbase/SystemRegion.hpp"
+#include "librpbase/config/AboutTabText.hpp"
+#include "librpbase/file/FileSystem.hpp"
+#include "librpbase/file/RpFile.hpp"
+#ifdef ENABLE_DECRYPTION
+# include "librpbase/crypto/KeyManager.hpp"
+#endif /* ENABLE_DECRYPTION */
+using namespace LibRpBase;
+
+// C includes.
+#include <stdlib.h>
+#include <unistd.h>
+
+// C includes. (C++ namespace)
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+// C++ includes.
+#include <string>
+#include <utility>
+#include <vector>
+using std::pair;
+using std::string;
+using std::vector;
+
+// Catalog file format.
+// NOTE: The catalog is a local cache, so host byte order is used.
+#define CATALOG_MAGIC 0x54435052	// "RPCT"
+#define CATALOG_VERSION 2
+
+struct CatalogHeader {
+	uint32_t magic;		// CATALOG_MAGIC
+	uint32_t version;	// CATALOG_VERSION
+	uint32_t count;		// Number of records.
+	uint32_t reserved;
+	char prg_version[64];	// Program version. (NULL-terminated)
+	uint64_t env_hash;	// Hash of the options, keys.conf mtime, and language.
+};
+ASSERT_STRUCT(CatalogHeader, 88);
+
+// Each record is followed by filename_len bytes of filename,
+// then json_len bytes of JSON.
+struct CatalogRecord {
+	uint64_t dev;
+	uint64_t ino;
+	int64_t size;
+	int64_t mtime;
+	uint32_t mtime_nsec;
+	uint32_t json_len;
+	uint32_t filename_len;
+	uint8_t result;
+	uint8_t reserved[3];
+};
+ASSERT_STRUCT(CatalogRecord, 48);
+
+// Maximum size of a single JSON object.
+static const uint32_t CATALOG_JSON_MAX = 16U*1024U*1024U;
+// Maximum length of a filename.
+static const uint32_t CATALOG_FILENAME_MAX = 64U*1024U;
+
+/**
+ * Get the mtime's nanoseconds from a stat struct.
+ * @param sb stat struct.
+ * @return Nanoseconds.
+ */
+static inline uint32_t mtime_nsec(const struct stat &sb)
+{
+#if defined(__APPLE__)
+	return static_cast<uint32_t>(sb.st_mtimespec.tv_nsec);
+#else
+	return static_cast<uint32_t>(sb.st_mtim.tv_nsec);
+#endif
+}
+
+/**
+ * Get the program version for the catalog header.
+ * @param prg_version [out] Program version buffer.
+ */
+static void getPrgVersion(char prg_version[64])
+{
+	memset(prg_version, 0, 64);
+	snprintf(prg_version, 64, "%s %s", AboutTabText::prg_version, AboutTabText::git_version);
+}
+
+/**
+ * Add a string to a 64-bit FNV-1a hash.
+ * The terminating NULL is included, so adjacent
+ * strings can't run into each other.
+ * @param hash Hash.
+ * @param str String. (nullptr is treated as an empty string.)
+ * @return New hash.
+ */
+static uint64_t hashString(uint64_t hash, const char *str)
+{
+	if (str) {
+		for (; *str != '\0'; str++) {
+			hash ^= static_cast<uint8_t>(*str);
+			hash *= 0x100000001B3ULL;
+		}
+	}
+	hash *= 0x100000001B3ULL;
+	return hash;
+}
+
+/**
+ * Hash everything other than the program version that affects
+ * the stored results: the output options, the full program version
+ * (in case it was truncated in the header), the keys.conf mtime,
+ * and the language.
+ * @param options Output options.
+ * @return Hash.
+ */
+static uint64_t getEnvHash(const char *options)
+{
+	uint64_t hash = 0xCBF29CE484222325ULL;
+	hash = hashString(hash, options);
+	hash = hashString(hash, AboutTabText::prg_version);
+	hash = hashString(hash, AboutTabText::git_version);
+
+	// keys.conf mtime.
+	// If keys.conf doesn't exist, the mtime is 0.
+	time_t keys_mtime = 0;
+#ifdef ENABLE_DECRYPTION
+	const char *const keys_filename = KeyManager::instance()->filename();
+	if (keys_filename) {
+		FileSystem::get_mtime(keys_filename, &keys_mtime);
+	}
+#endif /* ENABLE_DECRYPTION */
+	char buf[32];
+	snprintf(buf, sizeof(buf), "%lld", static_cast<long long>(keys_mtime));
+	hash = hashString(hash, buf);
+
+	// Language.
+	// SystemRegion covers region-specific fields, and the
+	// environment variables cover gettext translations.
+	snprintf(buf, sizeof(buf), "%08X:%08X",
+		SystemRegion::getLanguageCode(), SystemRegion::getCountryCode());
+	hash = hashString(hash, buf);
+	static const char *const lang_vars[] = {"LANGUAGE", "LC_ALL", "LC_MESSAGES", "LANG"};
+	for (size_t i = 0; i < ARRAY_SIZE(lang_vars); i++) {
+		hash = hashString(hash, getenv(lang_vars[i]));
+	}
+
+	return hash;
+}
+
+Catalog::Catalog()
+	: m_env_hash(0)
+	, m_dirty(false)
+	, m_generation(0)
+	, m_hits(0)
+{ }
+
+/**
+ * Open a catalog file.
+ * If the file doesn't exist, is invalid, or was created by a
+ * different program version or with different options,
+ * an empty catalog is used.
+ * @param filename Catalog filename.
+ * @param options Output options that affect the stored results.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int Catalog::open(const char *filename, const char *options)
+{
+	MutexLocker locker(m_mutex);
+	m_filename = filename;
+	m_env_hash = getEnvHash(options);
+	m_entries.clear();
+	m_dirty = false;
+
+	unique_IRpFile<RpFile> file(new RpFile(filename, RpFile::FM_OPEN_READ));
+	if (!file->isOpen()) {
+		const int err = file->lastError();
+		// If the catalog doesn't exist yet, it will be created by save().
+		return (err == ENOENT ? 0 : -err);
+	}
+
+	int ret = 0;
+	CatalogHeader header;
+	char prg_version[sizeof(header.prg_version)];
+	getPrgVersion(prg_version);
+	if (file->read(&header, sizeof(header)) != sizeof(header) ||
+	    header.magic != CATALOG_MAGIC || header.version != CATALOG_VERSION ||
+	    memcmp(header.prg_version, prg_version, sizeof(prg_version)) != 0 ||
+	    header.env_hash != m_env_hash)
+	{
+		// Invalid or outdated catalog. Start over.
+		m_dirty = true;
+		m_generation++;
+		return 0;
+	}
+
+	m_entries.reserve(header.count);
+	string rec_filename, json;
+	for (uint32_t i = 0; i < header.count; i++) {
+		CatalogRecord rec;
+		if (file->read(&rec, sizeof(rec)) != sizeof(rec) ||
+		    rec.json_len > CATALOG_JSON_MAX || rec.result >= SCAN_MAX ||
+		    rec.filename_len == 0 || rec.filename_len > CATALOG_FILENAME_MAX)
+		{
+			ret = -EIO;
+			break;
+		}
+		rec_filename.resize(rec.filename_len);
+		if (file->read(&rec_filename[0], rec.filename_len) != rec.filename_len) {
+			ret = -EIO;
+			break;
+		}
+		json.resize(rec.json_len);
+		if (rec.json_len > 0 && file->read(&json[0], rec.json_len) != rec.json_len) {
+			ret = -EIO;
+			break;
+		}
+
+		const Key key = {rec.dev, rec.ino};
+		Entry &entry = m_entries[key];
+		entry.size = rec.size;
+		entry.mtime = rec.mtime;
+		entry.mtime_nsec = rec.mtime_nsec;
+		entry.result = rec.result;
+		entry.filename.swap(rec_filename);
+		entry.json.swap(json);
+	}
+
+	if (ret != 0) {
+		// Truncated catalog. Keep the valid records.
+		m_dirty = true;
+		m_generation++;
+	}
+	return 0;
+}
+
+/**
+ * Get the number of entries in the catalog.
+ * @return Number of entries.
+ */
+size_t Catalog::count(void) const
+{
+	MutexLocker locker(m_mutex);
+	return m_entries.size();
+}
+
+/**
+ * Look up a file.
+ * @param filename	[in] Filename.
+ * @param sb		[in] File status.
+ * @param pResult	[out] ScanResult.
+ * @param json		[out] JSON object, without the "file" member.
+ * @return True if found and unchanged; false if not.
+ */
+bool Catalog::lookup(const char *filename, const struct stat &sb, ScanResult *pResult, string &json)
+{
+	const Key key = {static_cast<uint64_t>(sb.st_dev), static_cast<uint64_t>(sb.st_ino)};
+
+	MutexLocker locker(m_mutex);
+	auto iter = m_entries.find(key);
+	if (iter == m_entries.end())
+		return false;
+
+	Entry &entry = iter->second;
+	if (entry.size != static_cast<int64_t>(sb.st_size) ||
+	    entry.mtime != static_cast<int64_t>(sb.st_mtime) ||
+	    entry.mtime_nsec != mtime_nsec(sb))
+	{
+		// File has changed.
+		return false;
+	}
+
+	if (entry.filename != filename) {
+		// File was renamed. Update the filename so
+		// the entry isn't removed by save().
+		entry.filename = filename;
+		m_dirty = true;
+		m_generation++;
+	}
+
+	*pResult = static_cast<ScanResult>(entry.result);
+	json = entry.json;
+	m_hits++;
+	return true;
+}
+
+/**
+ * Store a result for a file.
+ * @param filename [in] Filename.
+ * @param sb	[in] File status.
+ * @param result [in] ScanResult.
+ * @param json	[in] JSON object, without the "file" member.
+ */
+void Catalog::store(const char *filename, const struct stat &sb, ScanResult result, const string &json)
+{
+	const size_t filename_len = strlen(filename);
+	if (result == SCAN_ERROR || result == SCAN_BUDGET || json.size() > CATALOG_JSON_MAX ||
+	    filename_len == 0 || filename_len > CATALOG_FILENAME_MAX)
+	{
+		// Errors and budget failures may be temporary, so they aren't stored.
+		return;
+	}
+
+	const Key key = {static_cast<uint64_t>(sb.st_dev), static_cast<uint64_t>(sb.st_ino)};
+
+	MutexLocker locker(m_mutex);
+	// NOTE: If the file has changed, this replaces the old entry.
+	Entry &entry = m_entries[key];
+	entry.size = static_cast<int64_t>(sb.st_size);
+	entry.mtime = static_cast<int64_t>(sb.st_mtime);
+	entry.mtime_nsec = mtime_nsec(sb);
+	entry.result = static_cast<uint8_t>(result);
+	entry.filename.assign(filename, filename_len);
+	entry.json = json;
+	m_dirty = true;
+	m_generation++;
+}
+
+/**
+ * Check if the catalog has changed since it was last saved.
+ * @return True if the catalog has changed.
+ */
+bool Catalog::isDirty(void) const
+{
+	MutexLocker locker(m_mutex);
+	return m_dirty;
+}
+
+/**
+ * Save the catalog file if it has changed.
+ * Entries for files that no longer exist are removed first.
+ * The file is replaced atomically.
+ *
+ * The entries are copied while the catalog is locked; checking
+ * the files and writing the catalog is done without holding the
+ * lock, so lookup() and store() aren't blocked.
+ *
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int Catalog::save(void)
+{
+	// Only one save at a time.
+	MutexLocker saveLocker(m_saveMutex);
+
+	// Copy the entries.
+	string filename;
+	uint64_t env_hash;
+	uint64_t generation;
+	bool dirty;
+	vector<pair<Key, Entry> > entries;
+	{
+		MutexLocker locker(m_mutex);
+		if (m_filename.empty())
+			return 0;
+		filename = m_filename;
+		env_hash = m_env_hash;
+		generation = m_generation;
+		dirty = m_dirty;
+		entries.assign(m_entries.cbegin(), m_entries.cend());
+	}
+
+	// Remove entries for files that were deleted or replaced.
+	vector<pair<Key, Entry> > removed;
+	for (size_t i = 0; i < entries.size(); ) {
+		const pair<Key, Entry> &p = entries[i];
+		struct stat sb;
+		if (stat(p.second.filename.c_str(), &sb) != 0 ||
+		    static_cast<uint64_t>(sb.st_dev) != p.first.dev ||
+		    static_cast<uint64_t>(sb.st_ino) != p.first.ino)
+		{
+			removed.push_back(pair<Key, Entry>());
+			removed.back().swap(entries[i]);
+			if (i != entries.size() - 1) {
+				entries[i].swap(entries.back());
+			}
+			entries.pop_back();
+		} else {
+			i++;
+		}
+	}
+
+	if (!dirty && removed.empty())
+		return 0;
+
+	// Write to a temporary file, then rename it over the catalog.
+	string tmp_filename = filename;
+	tmp_filename += ".XXXXXX";
+	const int fd = mkstemp(&tmp_filename[0]);
+	if (fd < 0) {
+		return -errno;
+	}
+	FILE *const f = fdopen(fd, "wb");
+	if (!f) {
+		const int err = errno;
+		close(fd);
+		unlink(tmp_filename.c_str());
+		return -err;
+	}
+
+	CatalogHeader header;
+	header.magic = CATALOG_MAGIC;
+	header.version = CATALOG_VERSION;
+	header.count = static_cast<uint32_t>(entries.size());
+	header.reserved = 0;
+	getPrgVersion(header.prg_version);
+	header.env_hash = env_hash;
+	bool ok = (fwrite(&header, 1, sizeof(header), f) == sizeof(header));
+
+	for (auto iter = entries.cbegin(); ok && iter != entries.cend(); ++iter) {
+		const Entry &entry = iter->second;
+		CatalogRecord rec;
+		memset(&rec, 0, sizeof(rec));
+		rec.dev = iter->first.dev;
+		rec.ino = iter->first.ino;
+		rec.size = entry.size;
+		rec.mtime = entry.mtime;
+		rec.mtime_nsec = entry.mtime_nsec;
+		rec.json_len = static_cast<uint32_t>(entry.json.size());
+		rec.filename_len = static_cast<uint32_t>(entry.filename.size());
+		rec.result = entry.result;
+		ok = (fwrite(&rec, 1, sizeof(rec), f) == sizeof(rec) &&
+		      fwrite(entry.filename.data(), 1, entry.filename.size(), f) == entry.filename.size() &&
+		      fwrite(entry.json.data(), 1, entry.json.size(), f) == entry.json.size());
+	}
+
+	int err = 0;
+	if (!ok || fflush(f) != 0 || fsync(fileno(f)) != 0) {
+		err = (errno != 0 ? errno : EIO);
+	}
+	if (fclose(f) != 0 && err == 0) {
+		err = errno;
+	}
+	if (err == 0 && rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+		err = errno;
+	}
+	if (err != 0) {
+		unlink(tmp_filename.c_str());
+		return -err;
+	}
+
+	MutexLocker locker(m_mutex);
+	// Remove the entries that were removed from the saved catalog,
+	// unless they were replaced by store() in the meantime.
+	for (auto iter = removed.cbegin(); iter != removed.cend(); ++iter) {
+		auto entry_iter = m_entries.find(iter->first);
+		if (entry_iter == m_entries.end())
+			continue;
+		const Entry &entry = entry_iter->second;
+		if (entry.size == iter->second.size &&
+		    entry.mtime == iter->second.mtime &&
+		    entry.mtime_nsec == iter->second.mtime_nsec &&
+		    entry.filename == iter->second.filename)
+		{
+			m_entries.erase(entry_iter);
+		}
+	}
+	if (m_generation == generation) {
+		// Nothing changed while saving.
+		m_dirty = false;
+	}
+	return 0;
+}
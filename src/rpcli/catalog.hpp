@@ -0,0 +1,169 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (rpcli)                            *
+ * catalog.hpp: Incremental result catalog.                               *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+
+#ifndef __ROMPROPERTIES_RPCLI_CATALOG_HPP__
+#define __ROMPROPERTIES_RPCLI_CATALOG_HPP__
+
+#include "librpbase/common.h"
+#include "librpbase/threads/Mutex.hpp"
+#include "scan.hpp"
+
+// C includes.
+#include <stdint.h>
+#include <sys/stat.h>
+
+// C++ includes.
+#include <string>
+#include <unordered_map>
+
+/**
+ * Persistent store of scan results.
+ *
+ * Results are keyed by device and inode number, and are only
+ * used if the file's size and mtime haven't changed. This lets
+ * unchanged files be answered without opening them.
+ *
+ * The catalog header stores the program version and a hash of
+ * everything else that affects the results: the output options,
+ * the keys.conf mtime, and the language. If any of these change,
+ * the whole catalog is discarded.
+ *
+ * The catalog is loaded into memory by open() and written
+ * back to disk by save(). All functions are thread-safe.
+ */
+class Catalog
+{
+	public:
+		Catalog();
+
+	private:
+		RP_DISABLE_COPY(Catalog)
+
+	public:
+		/**
+		 * Open a catalog file.
+		 * If the file doesn't exist, is invalid, or was created by a
+		 * different program version or with different options,
+		 * an empty catalog is used.
+		 * @param filename Catalog filename.
+		 * @param options Output options that affect the stored results.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int open(const char *filename, const char *options);
+
+		/**
+		 * Look up a file.
+		 * @param filename	[in] Filename.
+		 * @param sb		[in] File status.
+		 * @param pResult	[out] ScanResult.
+		 * @param json		[out] JSON object, without the "file" member.
+		 * @return True if found and unchanged; false if not.
+		 */
+		bool lookup(const char *filename, const struct stat &sb, ScanResult *pResult, std::string &json);
+
+		/**
+		 * Store a result for a file.
+		 * @param filename [in] Filename.
+		 * @param sb	[in] File status.
+		 * @param result [in] ScanResult.
+		 * @param json	[in] JSON object, without the "file" member.
+		 */
+		void store(const char *filename, const struct stat &sb, ScanResult result, const std::string &json);
+
+		/**
+		 * Check if the catalog has changed since it was last saved.
+		 * @return True if the catalog has changed.
+		 */
+		bool isDirty(void) const;
+
+		/**
+		 * Save the catalog file if it has changed.
+		 * Entries for files that no longer exist are removed first.
+		 * The file is replaced atomically.
+		 *
+		 * The entries are copied while the catalog is locked; checking
+		 * the files and writing the catalog is done without holding the
+		 * lock, so lookup() and store() aren't blocked.
+		 *
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int save(void);
+
+		/**
+		 * Get the number of entries in the catalog.
+		 * @return Number of entries.
+		 */
+		size_t count(void) const;
+
+		/**
+		 * Get the number of lookups that were answered from the catalog.
+		 * @return Number of catalog hits.
+		 */
+		unsigned int hits(void) const
+		{
+			return m_hits;
+		}
+
+	private:
+		/**
+		 * Catalog entry.
+		 */
+		struct Entry {
+			int64_t size;		// File size.
+			int64_t mtime;		// File mtime, in seconds.
+			uint32_t mtime_nsec;	// File mtime, nanoseconds.
+			uint8_t result;		// ScanResult.
+			std::string filename;	// Filename the file was last seen as.
+			std::string json;	// JSON object, without the "file" member.
+		};
+
+		/**
+		 * Catalog key: Device and inode number.
+		 */
+		struct Key {
+			uint64_t dev;
+			uint64_t ino;
+
+			bool operator==(const Key &other) const
+			{
+				return (dev == other.dev && ino == other.ino);
+			}
+		};
+
+		struct KeyHash {
+			size_t operator()(const Key &key) const
+			{
+				return static_cast<size_t>(key.ino ^ (key.dev << 32) ^ (key.dev >> 32));
+			}
+		};
+
+		LibRpBase::Mutex m_saveMutex;	// Serializes save().
+		mutable LibRpBase::Mutex m_mutex;
+		std::string m_filename;
+		uint64_t m_env_hash;	// Hash of the options, keys.conf mtime, and language.
+		std::unordered_map<Key, Entry, KeyHash> m_entries;
+		bool m_dirty;
+		uint64_t m_generation;	// Incremented whenever m_dirty is set.
+		unsigned int m_hits;
+};
+
+#endif /* __ROMPROPERTIES_RPCLI_CATALOG_HPP__ */
@@ -0,0 +1,182 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (rpcli)                            *
+ * jsonwriter.cpp: Buffered JSON writer.                                   *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "jsonwriter.hpp"
+
+/**
+ * Flush the buffer to the stream.
+ */
+void JSONWriter::flush(void)
+{
+	if (pos > 0) {
+		os.write(buf, pos);
+		pos = 0;
+	}
+}
+
+/**
+ * Write raw characters.
+ * @param str Characters.
+ * @param len Number of characters.
+ */
+void JSONWriter::write(const char *str, size_t len)
+{
+	if (len > sizeof(buf) - pos) {
+		flush();
+		if (len > sizeof(buf)) {
+			// Too big for the buffer.
+			// Write it directly to the stream.
+			os.write(str, len);
+			return;
+		}
+	}
+	memcpy(&buf[pos], str, len);
+	pos += len;
+}
+
+/**
+ * Write a signed integer in decimal.
+ * @param val Value.
+ */
+void JSONWriter::writeInt(int64_t val)
+{
+	if (val < 0) {
+		put('-');
+		// NOTE: Negating INT64_MIN as a signed value overflows.
+		writeUInt(0ULL - static_cast<uint64_t>(val));
+	} else {
+		writeUInt(static_cast<uint64_t>(val));
+	}
+}
+
+/**
+ * Write an unsigned integer in decimal.
+ * @param val Value.
+ */
+void JSONWriter::writeUInt(uint64_t val)
+{
+	// Maximum of 20 digits for a 64-bit value.
+	char tmp[20];
+	char *p = &tmp[sizeof(tmp)];
+	do {
+		*--p = '0' + static_cast<char>(val % 10);
+		val /= 10;
+	} while (val != 0);
+	write(p, &tmp[sizeof(tmp)] - p);
+}
+
+/**
+ * Write a quoted JSON string.
+ * Backslashes, double quotes, and \b\f\t\n\r are escaped.
+ * Other control characters are escaped as \u00XX.
+ * All other characters are written as-is.
+ * @param str NULL-terminated string. (If nullptr, "0" is written.)
+ */
+void JSONWriter::writeString(const char *str)
+{
+	if (!str) {
+		// NULL string.
+		// Print "0" to indicate this.
+		put('0');
+		return;
+	}
+	writeString(str, strlen(str));
+}
+
+/**
+ * Write a quoted JSON string.
+ * @param str String.
+ * @param len Length of the string.
+ */
+void JSONWriter::writeString(const char *str, size_t len)
+{
+	put('"');
+	while (len > 0) {
+		// Copy everything up to the next special character.
+		const size_t n = findSpecial(str, len);
+		if (n > 0) {
+			write(str, n);
+			str += n;
+			len -= n;
+			if (len == 0)
+				break;
+		}
+
+		switch (*str) {
+			case '\\':
+				write("\\\\", 2);
+				break;
+			case '"':
+				write("\\\"", 2);
+				break;
+			case '\b':
+				write("\\b", 2);
+				break;
+			case '\f':
+				write("\\f", 2);
+				break;
+			case '\t':
+				write("\\t", 2);
+				break;
+			case '\n':
+				write("\\n", 2);
+				break;
+			case '\r':
+				write("\\r", 2);
+				break;
+			case '\0':
+				// Embedded NULL. Stop here.
+				put('"');
+				return;
+			default: {
+				// Other control characters are escaped as \u00XX.
+				static const char hex_lookup[] = "0123456789ABCDEF";
+				const uint8_t chr = static_cast<uint8_t>(*str);
+				const char esc[6] = {'\\', 'u', '0', '0',
+					hex_lookup[chr >> 4], hex_lookup[chr & 0x0F]};
+				write(esc, sizeof(esc));
+				break;
+			}
+		}
+		str++;
+		len--;
+	}
+	put('"');
+}
+
+/**
+ * Find the first character in a string that needs special handling.
+ * This includes '"', '\\', and all characters below 0x20.
+ * Standard version using regular C++ code.
+ * @param str String.
+ * @param len Length of the string.
+ * @return Index of the first special character, or len if none.
+ */
+size_t JSONWriter::findSpecial_cpp(const char *str, size_t len)
+{
+	const uint8_t *const p = reinterpret_cast<const uint8_t*>(str);
+	for (size_t i = 0; i < len; i++) {
+		const uint8_t chr = p[i];
+		if (chr < 0x20 || chr == '"' || chr == '\\') {
+			return i;
+		}
+	}
+	return len;
+}
@@ -0,0 +1,209 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (rpcli)                            *
+ * jsonwriter.hpp: Buffered JSON writer.                                   *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#ifndef __ROMPROPERTIES_RPCLI_JSONWRITER_HPP__
+#define __ROMPROPERTIES_RPCLI_JSONWRITER_HPP__
+
+#include "librpbase/common.h"
+#include "librpbase/cpu_dispatch.h"
+
+// C includes.
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// C++ includes.
+#include <ostream>
+#include <string>
+
+#if defined(RP_CPU_I386) || defined(RP_CPU_AMD64)
+# include "librpbase/cpuflags_x86.h"
+# define JSONWRITER_HAS_SSE2 1
+#endif
+#ifdef RP_CPU_AMD64
+# define JSONWRITER_ALWAYS_HAS_SSE2 1
+#endif
+
+/**
+ * Buffered JSON writer.
+ *
+ * Output is accumulated in a fixed-size buffer and written
+ * to the underlying stream in large blocks, instead of using
+ * many small ostream insertions. No heap allocations are
+ * done while writing.
+ *
+ * The buffer is flushed when the JSONWriter is destroyed.
+ */
+class JSONWriter
+{
+	public:
+		explicit JSONWriter(std::ostream &os)
+			: os(os), pos(0) { }
+		~JSONWriter() { flush(); }
+
+	private:
+		RP_DISABLE_COPY(JSONWriter)
+
+	public:
+		/**
+		 * Flush the buffer to the stream.
+		 */
+		void flush(void);
+
+		/**
+		 * Write a raw character.
+		 * @param chr Character.
+		 */
+		inline void put(char chr)
+		{
+			if (pos == sizeof(buf)) {
+				flush();
+			}
+			buf[pos++] = chr;
+		}
+
+		/**
+		 * Write raw characters.
+		 * @param str Characters.
+		 * @param len Number of characters.
+		 */
+		void write(const char *str, size_t len);
+
+		/**
+		 * Write a raw NULL-terminated string.
+		 * @param str String.
+		 */
+		inline void write(const char *str)
+		{
+			write(str, strlen(str));
+		}
+
+		/**
+		 * Write a raw string.
+		 * @param str String.
+		 */
+		inline void write(const std::string &str)
+		{
+			write(str.data(), str.size());
+		}
+
+		/**
+		 * Write a signed integer in decimal.
+		 * @param val Value.
+		 */
+		void writeInt(int64_t val);
+
+		/**
+		 * Write an unsigned integer in decimal.
+		 * @param val Value.
+		 */
+		void writeUInt(uint64_t val);
+
+		/**
+		 * Write a quoted JSON string.
+		 * Backslashes, double quotes, and \b\f\t\n\r are escaped.
+		 * Other control characters are escaped as \u00XX.
+		 * All other characters are written as-is.
+		 * @param str NULL-terminated string. (If nullptr, "0" is written.)
+		 */
+		void writeString(const char *str);
+
+		/**
+		 * Write a quoted JSON string.
+		 * @param str String.
+		 * @param len Length of the string.
+		 */
+		void writeString(const char *str, size_t len);
+
+		/**
+		 * Write a quoted JSON string.
+		 * @param str String.
+		 */
+		inline void writeString(const std::string &str)
+		{
+			writeString(str.data(), str.size());
+		}
+
+	public:
+		/** Internal algorithms. **/
+		// NOTE: These are public to allow for unit tests and benchmarking.
+
+		/**
+		 * Find the first character in a string that needs special handling.
+		 * This includes '"', '\\', and all characters below 0x20.
+		 * Standard version using regular C++ code.
+		 * @param str String.
+		 * @param len Length of the string.
+		 * @return Index of the first special character, or len if none.
+		 */
+		static size_t findSpecial_cpp(const char *str, size_t len);
+
+#ifdef JSONWRITER_HAS_SSE2
+		/**
+		 * Find the first character in a string that needs special handling.
+		 * This includes '"', '\\', and all characters below 0x20.
+		 * SSE2-optimized version.
+		 * @param str String.
+		 * @param len Length of the string.
+		 * @return Index of the first special character, or len if none.
+		 */
+		static size_t findSpecial_sse2(const char *str, size_t len);
+#endif /* JSONWRITER_HAS_SSE2 */
+
+		/**
+		 * Find the first character in a string that needs special handling.
+		 * This includes '"', '\\', and all characters below 0x20.
+		 * @param str String.
+		 * @param len Length of the string.
+		 * @return Index of the first special character, or len if none.
+		 */
+		static inline size_t findSpecial(const char *str, size_t len);
+
+	private:
+		std::ostream &os;
+		size_t pos;		// Current position in buf.
+		char buf[4096];
+};
+
+/**
+ * Find the first character in a string that needs special handling.
+ * This includes '"', '\\', and all characters below 0x20.
+ * @param str String.
+ * @param len Length of the string.
+ * @return Index of the first special character, or len if none.
+ */
+inline size_t JSONWriter::findSpecial(const char *str, size_t len)
+{
+#ifdef JSONWRITER_ALWAYS_HAS_SSE2
+	// amd64 always has SSE2.
+	return findSpecial_sse2(str, len);
+#else /* !JSONWRITER_ALWAYS_HAS_SSE2 */
+# ifdef JSONWRITER_HAS_SSE2
+	if (RP_CPU_HasSSE2()) {
+		return findSpecial_sse2(str, len);
+	} else
+# endif /* JSONWRITER_HAS_SSE2 */
+	{
+		return findSpecial_cpp(str, len);
+	}
+#endif /* JSONWRITER_ALWAYS_HAS_SSE2 */
+}
+
+#endif /* __ROMPROPERTIES_RPCLI_JSONWRITER_HPP__ */
@@ -0,0 +1,78 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (rpcli)                            *
+ * jsonwriter_sse2.cpp: Buffered JSON writer.                              *
+ * SSE2-optimized version.                                                 *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+#include "jsonwriter.hpp"
+
+// SSE2 intrinsics.
+#include <emmintrin.h>
+#ifdef _MSC_VER
+# include <intrin.h>
+#endif
+
+/**
+ * Get the index of the lowest set bit.
+ * @param mask Mask. (Must not be 0.)
+ * @return Index of the lowest set bit.
+ */
+static inline unsigned int lowest_bit(unsigned int mask)
+{
+#ifdef _MSC_VER
+	unsigned long idx;
+	_BitScanForward(&idx, mask);
+	return static_cast<unsigned int>(idx);
+#else /* !_MSC_VER */
+	return static_cast<unsigned int>(__builtin_ctz(mask));
+#endif /* _MSC_VER */
+}
+
+/**
+ * Find the first character in a string that needs special handling.
+ * This includes '"', '\\', and all characters below 0x20.
+ * SSE2-optimized version.
+ * @param str String.
+ * @param len Length of the string.
+ * @return Index of the first special character, or len if none.
+ */
+size_t JSONWriter::findSpecial_sse2(const char *str, size_t len)
+{
+	const __m128i quote = _mm_set1_epi8('"');
+	const __m128i bslash = _mm_set1_epi8('\\');
+	const __m128i ctrl_max = _mm_set1_epi8(0x1F);
+
+	// Process 16 bytes at a time.
+	size_t i = 0;
+	for (; len - i >= 16; i += 16) {
+		const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&str[i]));
+
+		// Control characters: min(data, 0x1F) == data
+		__m128i special = _mm_cmpeq_epi8(_mm_min_epu8(data, ctrl_max), data);
+		special = _mm_or_si128(special, _mm_cmpeq_epi8(data, quote));
+		special = _mm_or_si128(special, _mm_cmpeq_epi8(data, bslash));
+
+		const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(special));
+		if (mask != 0) {
+			return i + lowest_bit(mask);
+		}
+	}
+
+	// Remaining bytes.
+	return i + findSpecial_cpp(&str[i], len - i);
+}
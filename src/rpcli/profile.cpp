@@ -0,0 +1,363 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (rpcli)                            *
+ * profile.cpp: Per-phase profiling.                                      *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+
+#include "stdafx.h"
+#include "profile.hpp"
+
+// librpbase
+#include "librpbase/RomData.hpp"
+#include "librpbase/TextFuncs.hpp"
+#include "librpbase/img/IconAnimData.hpp"
+#include "librpbase/threads/Mutex.hpp"
+#include "libi18n/i18n.h"
+using namespace LibRpBase;
+
+#ifdef _WIN32
+# include "libwin32common/RpWin32_sdk.h"
+#else /* !_WIN32 */
+# include <time.h>
+#endif /* _WIN32 */
+
+// C includes. (C++ namespace)
+#include <cstring>
+
+// C++ includes.
+#include <iomanip>
+#include <map>
+#include <string>
+#include <vector>
+using std::endl;
+using std::map;
+using std::ostream;
+using std::setw;
+using std::string;
+using std::vector;
+
+bool FileProfile::ms_enabled = false;
+
+// Phase names.
+static const char *const phase_names[FileProfile::PHASE_MAX] = {
+	"open", "detect", "fields", "metadata", "images", "exturls", "output"
+};
+
+// Histogram buckets for the total time per file, in ns.
+// The last bucket has no upper limit.
+static const int64_t hist_limits[] = {
+	100000LL,	// 100 µs
+	1000000LL,	// 1 ms
+	10000000LL,	// 10 ms
+	100000000LL,	// 100 ms
+	1000000000LL,	// 1 s
+};
+static const char *const hist_names[ARRAY_SIZE(hist_limits)+1] = {
+	"<100us", "<1ms", "<10ms", "<100ms", "<1s", ">=1s"
+};
+
+/**
+ * Summary for a single RomData class.
+ */
+struct ClassSummary {
+	unsigned int count;
+	int64_t wall_ns[FileProfile::PHASE_MAX];
+	int64_t cpu_ns[FileProfile::PHASE_MAX];
+	unsigned int hist[ARRAY_SIZE(hist_limits)+1];
+	IoStats::Counters io;
+};
+
+// Summary, indexed by RomData class name.
+static Mutex summaryMutex;
+static map<string, ClassSummary> summary;
+
+/**
+ * Get the current wall time.
+ * @return Wall time, in ns.
+ */
+static int64_t wallTime(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER freq, counter;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&counter);
+	return static_cast<int64_t>(counter.QuadPart / (double)freq.QuadPart * 1000000000.0);
+#else /* !_WIN32 */
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (static_cast<int64_t>(ts.tv_sec) * 1000000000LL) + ts.tv_nsec;
+#endif /* _WIN32 */
+}
+
+/**
+ * Get the CPU time used by the current thread.
+ * @return CPU time, in ns.
+ */
+static int64_t cpuTime(void)
+{
+#ifdef _WIN32
+	FILETIME ftCreation, ftExit, ftKernel, ftUser;
+	if (!GetThreadTimes(GetCurrentThread(), &ftCreation, &ftExit, &ftKernel, &ftUser))
+		return 0;
+	const uint64_t t100ns =
+		((static_cast<uint64_t>(ftKernel.dwHighDateTime) << 32) | ftKernel.dwLowDateTime) +
+		((static_cast<uint64_t>(ftUser.dwHighDateTime) << 32) | ftUser.dwLowDateTime);
+	return static_cast<int64_t>(t100ns * 100);
+#else /* !_WIN32 */
+	struct timespec ts;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+	return (static_cast<int64_t>(ts.tv_sec) * 1000000000LL) + ts.tv_nsec;
+#endif /* _WIN32 */
+}
+
+/**
+ * Format a time in ns as milliseconds.
+ * @param ns Time, in ns.
+ * @return Formatted time.
+ */
+static inline string formatMs(int64_t ns)
+{
+	return rp_sprintf("%.3f", ns / 1000000.0);
+}
+
+/**
+ * Print I/O counters.
+ * @param os Output stream.
+ * @param io I/O counters.
+ */
+static void printIo(ostream &os, const IoStats::Counters &io)
+{
+	// tr: I/O statistics for --profile.
+	os << "   " << rp_sprintf_p(C_("rpcli", "I/O: %1$s read(s), %2$s read, %3$s seek(s), %4$s decryption(s) (%5$s)"),
+		rp_sprintf("%llu", (unsigned long long)io.reads).c_str(),
+		formatFileSize(static_cast<int64_t>(io.bytes_read)).c_str(),
+		rp_sprintf("%llu", (unsigned long long)io.seeks).c_str(),
+		rp_sprintf("%llu", (unsigned long long)io.decrypts).c_str(),
+		formatFileSize(static_cast<int64_t>(io.bytes_decrypted)).c_str()) << endl;
+}
+
+FileProfile::FileProfile()
+	: m_enabled(ms_enabled)
+	, m_phase(PHASE_MAX)
+	, m_wall_start(0)
+	, m_cpu_start(0)
+	, m_prev_io(nullptr)
+{
+	memset(m_wall_ns, 0, sizeof(m_wall_ns));
+	memset(m_cpu_ns, 0, sizeof(m_cpu_ns));
+	memset(&m_io, 0, sizeof(m_io));
+	if (m_enabled) {
+		m_prev_io = IoStats::threadCounters();
+		IoStats::setThreadCounters(&m_io);
+	}
+}
+
+FileProfile::~FileProfile()
+{
+	if (m_enabled) {
+		IoStats::setThreadCounters(m_prev_io);
+	}
+}
+
+/**
+ * Start timing a phase.
+ * The current phase, if any, is stopped.
+ * @param phase Phase.
+ */
+void FileProfile::start(Phase phase)
+{
+	if (!m_enabled)
+		return;
+	stop();
+	m_phase = phase;
+	m_wall_start = wallTime();
+	m_cpu_start = cpuTime();
+}
+
+/**
+ * Stop timing the current phase.
+ */
+void FileProfile::stop(void)
+{
+	if (!m_enabled || m_phase == PHASE_MAX)
+		return;
+	m_wall_ns[m_phase] += wallTime() - m_wall_start;
+	m_cpu_ns[m_phase] += cpuTime() - m_cpu_start;
+	m_phase = PHASE_MAX;
+}
+
+/**
+ * Load all data from a RomData object, timing each phase.
+ * This should be called before the output is formatted,
+ * so the output phase only measures formatting.
+ * @param romData RomData object.
+ */
+void FileProfile::load(const RomData *romData)
+{
+	if (!m_enabled)
+		return;
+
+	start(PHASE_FIELDS);
+	romData->fields();
+
+	start(PHASE_METADATA);
+	romData->metaData();
+
+	const int supported = romData->supportedImageTypes();
+	start(PHASE_IMAGES);
+	for (int i = RomData::IMG_INT_MIN; i <= RomData::IMG_INT_MAX; i++) {
+		if (!(supported & (1 << i)))
+			continue;
+		romData->image(static_cast<RomData::ImageType>(i));
+		if (romData->imgpf(static_cast<RomData::ImageType>(i)) & RomData::IMGPF_ICON_ANIMATED) {
+			romData->iconAnimData();
+		}
+	}
+
+	// NOTE: rpcli doesn't download external images,
+	// so this only measures URL generation.
+	start(PHASE_EXTURLS);
+	vector<RomData::ExtURL> extURLs;
+	for (int i = RomData::IMG_EXT_MIN; i <= RomData::IMG_EXT_MAX; i++) {
+		if (!(supported & (1 << i)))
+			continue;
+		extURLs.clear();
+		romData->extURLs(static_cast<RomData::ImageType>(i), &extURLs, RomData::IMAGE_SIZE_DEFAULT);
+	}
+
+	stop();
+}
+
+/**
+ * Finish profiling this file.
+ * The results are added to the summary.
+ * @param className RomData class name, or nullptr if the file isn't supported.
+ */
+void FileProfile::finish(const char *className)
+{
+	if (!m_enabled)
+		return;
+	stop();
+
+	int64_t total_ns = 0;
+	for (int i = 0; i < PHASE_MAX; i++) {
+		total_ns += m_wall_ns[i];
+	}
+	unsigned int bucket = 0;
+	while (bucket < ARRAY_SIZE(hist_limits) && total_ns >= hist_limits[bucket]) {
+		bucket++;
+	}
+
+	MutexLocker locker(summaryMutex);
+	auto iter = summary.find(className ? className : "");
+	if (iter == summary.end()) {
+		ClassSummary cs;
+		memset(&cs, 0, sizeof(cs));
+		iter = summary.insert(std::make_pair(string(className ? className : ""), cs)).first;
+	}
+
+	ClassSummary &cs = iter->second;
+	cs.count++;
+	for (int i = 0; i < PHASE_MAX; i++) {
+		cs.wall_ns[i] += m_wall_ns[i];
+		cs.cpu_ns[i] += m_cpu_ns[i];
+	}
+	cs.hist[bucket]++;
+	cs.io.reads += m_io.reads;
+	cs.io.bytes_read += m_io.bytes_read;
+	cs.io.seeks += m_io.seeks;
+	cs.io.decrypts += m_io.decrypts;
+	cs.io.bytes_decrypted += m_io.bytes_decrypted;
+}
+
+/**
+ * Print this profile.
+ * @param os Output stream.
+ */
+void FileProfile::print(ostream &os) const
+{
+	if (!m_enabled)
+		return;
+
+	os << "-- " << C_("rpcli", "Profile:") << endl;
+	os << "   " << std::left << setw(10) << C_("rpcli", "Phase")
+	   << std::right << setw(12) << C_("rpcli", "Wall (ms)")
+	   << setw(12) << C_("rpcli", "CPU (ms)") << endl;
+	int64_t wall_total = 0, cpu_total = 0;
+	for (int i = 0; i < PHASE_MAX; i++) {
+		os << "   " << std::left << setw(10) << phase_names[i]
+		   << std::right << setw(12) << formatMs(m_wall_ns[i])
+		   << setw(12) << formatMs(m_cpu_ns[i]) << endl;
+		wall_total += m_wall_ns[i];
+		cpu_total += m_cpu_ns[i];
+	}
+	os << "   " << std::left << setw(10) << C_("rpcli", "total")
+	   << std::right << setw(12) << formatMs(wall_total)
+	   << setw(12) << formatMs(cpu_total) << endl;
+	printIo(os, m_io);
+}
+
+/**
+ * Print a summary of all profiled files, grouped by RomData class.
+ * Nothing is printed if less than two files were profiled.
+ * @param os Output stream.
+ * @return Number of files in the summary.
+ */
+unsigned int FileProfile::printSummary(ostream &os)
+{
+	MutexLocker locker(summaryMutex);
+	unsigned int files = 0;
+	for (auto iter = summary.cbegin(); iter != summary.cend(); ++iter) {
+		files += iter->second.count;
+	}
+	if (files < 2) {
+		// A single file's profile is printed by itself.
+		return files;
+	}
+
+	os << "== " << C_("rpcli", "Profile summary:") << endl;
+	for (auto iter = summary.cbegin(); iter != summary.cend(); ++iter) {
+		const ClassSummary &cs = iter->second;
+
+		// tr: %1$s == RomData class name, %2$u == number of files
+		os << "-- " << rp_sprintf_p(C_("rpcli", "%1$s: %2$u file(s)"),
+			(!iter->first.empty() ? iter->first.c_str() : C_("rpcli", "(unsupported)")),
+			cs.count) << endl;
+		os << "   " << std::left << setw(10) << C_("rpcli", "Phase")
+		   << std::right << setw(14) << C_("rpcli", "Wall (ms)")
+		   << setw(14) << C_("rpcli", "CPU (ms)")
+		   << setw(14) << C_("rpcli", "Mean (ms)") << endl;
+		for (int i = 0; i < PHASE_MAX; i++) {
+			os << "   " << std::left << setw(10) << phase_names[i]
+			   << std::right << setw(14) << formatMs(cs.wall_ns[i])
+			   << setw(14) << formatMs(cs.cpu_ns[i])
+			   << setw(14) << formatMs(cs.wall_ns[i] / cs.count) << endl;
+		}
+		printIo(os, cs.io);
+
+		// Histogram of the total time per file.
+		os << "   " << C_("rpcli", "Time per file:");
+		for (unsigned int i = 0; i < ARRAY_SIZE(hist_names); i++) {
+			os << ' ' << hist_names[i] << '=' << cs.hist[i];
+		}
+		os << endl;
+	}
+
+	return files;
+}
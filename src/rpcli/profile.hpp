@@ -0,0 +1,144 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (rpcli)                            *
+ * profile.hpp: Per-phase profiling.                                      *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+
+#ifndef __ROMPROPERTIES_RPCLI_PROFILE_HPP__
+#define __ROMPROPERTIES_RPCLI_PROFILE_HPP__
+
+#include "librpbase/common.h"
+#include "librpbase/file/IoStats.hpp"
+
+// C includes.
+#include <stdint.h>
+
+// C++ includes.
+#include <ostream>
+
+namespace LibRpBase {
+	class RomData;
+}
+
+/**
+ * Per-file profile.
+ *
+ * Measures wall time and CPU time for each phase of
+ * processing a file, and counts I/O done by the current
+ * thread while the profile exists.
+ *
+ * If profiling is disabled, all functions are no-ops.
+ */
+class FileProfile
+{
+	public:
+		enum Phase {
+			PHASE_OPEN = 0,		// Opening the file.
+			PHASE_DETECT,		// RomDataFactory::create()
+			PHASE_FIELDS,		// RomData::fields()
+			PHASE_METADATA,		// RomData::metaData()
+			PHASE_IMAGES,		// RomData::image(), iconAnimData()
+			PHASE_EXTURLS,		// RomData::extURLs()
+			PHASE_OUTPUT,		// Output formatting.
+
+			PHASE_MAX
+		};
+
+		FileProfile();
+		~FileProfile();
+
+	private:
+		RP_DISABLE_COPY(FileProfile)
+
+	public:
+		/**
+		 * Is profiling enabled?
+		 * @return True if enabled; false if not.
+		 */
+		static bool isEnabled(void)
+		{
+			return ms_enabled;
+		}
+
+		/**
+		 * Enable or disable profiling.
+		 * This should be set before any files are processed.
+		 * @param enabled True to enable; false to disable.
+		 */
+		static void setEnabled(bool enabled)
+		{
+			ms_enabled = enabled;
+		}
+
+		/**
+		 * Start timing a phase.
+		 * The current phase, if any, is stopped.
+		 * @param phase Phase.
+		 */
+		void start(Phase phase);
+
+		/**
+		 * Stop timing the current phase.
+		 */
+		void stop(void);
+
+		/**
+		 * Load all data from a RomData object, timing each phase.
+		 * This should be called before the output is formatted,
+		 * so the output phase only measures formatting.
+		 * @param romData RomData object.
+		 */
+		void load(const LibRpBase::RomData *romData);
+
+		/**
+		 * Finish profiling this file.
+		 * The results are added to the summary.
+		 * @param className RomData class name, or nullptr if the file isn't supported.
+		 */
+		void finish(const char *className);
+
+		/**
+		 * Print this profile.
+		 * @param os Output stream.
+		 */
+		void print(std::ostream &os) const;
+
+		/**
+		 * Print a summary of all profiled files, grouped by RomData class.
+		 * Nothing is printed if less than two files were profiled.
+		 * @param os Output stream.
+		 * @return Number of files in the summary.
+		 */
+		static unsigned int printSummary(std::ostream &os);
+
+	private:
+		static bool ms_enabled;
+
+		bool m_enabled;
+		Phase m_phase;		// Current phase, or PHASE_MAX if none.
+		int64_t m_wall_start;	// Current phase's wall time start, in ns.
+		int64_t m_cpu_start;	// Current phase's CPU time start, in ns.
+
+		int64_t m_wall_ns[PHASE_MAX];
+		int64_t m_cpu_ns[PHASE_MAX];
+		LibRpBase::IoStats::Counters m_io;
+		LibRpBase::IoStats::Counters *m_prev_io;
+};
+
+#endif /* __ROMPROPERTIES_RPCLI_PROFILE_HPP__ */
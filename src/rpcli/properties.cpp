@@ -23,6 +23,7 @@
 #include "librpbase/config.librpbase.h"
 #include "config.rpcli.h"
 #include "properties.hpp"
+#include "jsonwriter.hpp"
 
 // C includes. (C++ namespace)
 #include <cassert>
@@ -156,7 +157,7 @@ public:
 	StringField(size_t width, const RomFields::Field *romField) :width(width), romField(romField) {}
 	friend ostream& operator<<(ostream& os, const StringField& field) {
 		auto romField = field.romField;
-		return os << ColonPad(field.width, romField->name.c_str())
+		return os << ColonPad(field.width, romField->name)
 			  << SafeString(romField->data.str, true, field.width);
 	}
 };
@@ -197,7 +198,7 @@ public:
 		}
 
 		// Print the bits.
-		os << ColonPad(field.width, romField->name.c_str());
+		os << ColonPad(field.width, romField->name);
 		StreamStateSaver state(os);
 		os << left;
 		col = 0;
@@ -308,7 +309,7 @@ public:
 
 		/** Print the list data. **/
 
-		os << ColonPad(field.width, romField->name.c_str());
+		os << ColonPad(field.width, romField->name);
 		StreamStateSaver state(os);
 
 		// Print the list on a separate row from the field name?
@@ -478,7 +479,7 @@ public:
 		auto romField = field.romField;
 		auto flags = romField->desc.flags;
 
-		os << ColonPad(field.width, romField->name.c_str());
+		os << ColonPad(field.width, romField->name);
 		StreamStateSaver state(os);
 
 		if (romField->data.date_time == -1) {
@@ -532,7 +533,7 @@ public:
 	friend ostream& operator<<(ostream& os, const AgeRatingsField& field) {
 		auto romField = field.romField;
 
-		os << ColonPad(field.width, romField->name.c_str());
+		os << ColonPad(field.width, romField->name);
 		StreamStateSaver state(os);
 
 		// Convert the age ratings field to a string.
@@ -550,7 +551,7 @@ public:
 	friend ostream& operator<<(ostream& os, const DimensionsField& field) {
 		auto romField = field.romField;
 
-		os << ColonPad(field.width, romField->name.c_str());
+		os << ColonPad(field.width, romField->name);
 		StreamStateSaver state(os);
 
 		// Convert the dimensions field to a string.
@@ -575,7 +576,7 @@ public:
 		for (int i = 0; i < fo.fields.count(); i++) {
 			const RomFields::Field *const field = fo.fields.field(i);
 			if (likely(field != nullptr)) {
-				maxWidth = max(maxWidth, field->name.size());
+				maxWidth = max(maxWidth, strlen(field->name));
 			}
 		}
 		maxWidth += 2;
@@ -614,7 +615,7 @@ public:
 			switch (romField->type) {
 			case RomFields::RFT_INVALID: {
 				assert(!"INVALID field type");
-				os << ColonPad(maxWidth, romField->name.c_str()) << "INVALID";
+				os << ColonPad(maxWidth, romField->name) << "INVALID";
 				break;
 			}
 			case RomFields::RFT_STRING: {
@@ -643,7 +644,7 @@ public:
 			}
 			default: {
 				assert(!"Unknown RomFieldType");
-				os << ColonPad(maxWidth, romField->name.c_str()) << "NYI";
+				os << ColonPad(maxWidth, romField->name) << "NYI";
 				break;
 			}
 			}
@@ -654,240 +655,239 @@ public:
 	}
 };
 
-class JSONString {
-	const char* str;
-public:
-	explicit JSONString(const char* str) :str(str) {}
-	friend ostream& operator<<(ostream& os, const JSONString& js) {
-		//assert(js.str); // not all strings can't be null, apparently
-		if (!js.str) {
-			// NULL string.
-			// Print "0" to indicate this.
-			return os << '0';
-		}
+JSONString::JSONString(const char *str) : str(str) {}
+std::ostream& operator<<(std::ostream& os, const JSONString& js) {
+	//assert(js.str); // not all strings can't be null, apparently
+	JSONWriter json(os);
+	json.writeString(js.str);
+	return os;
+}
+
+/**
+ * Write RomFields as JSON.
+ * @param json JSONWriter.
+ * @param fields RomFields.
+ * @param compact If true, don't print any newlines. (NDJSON)
+ */
+static void writeJSONFields(JSONWriter &json, const RomFields &fields, bool compact)
+{
+	json.write(compact ? "[" : "[\n");
+	bool printed_first = false;
+	for (int i = 0; i < fields.count(); i++) {
+		auto romField = fields.field(i);
+		assert(romField != nullptr);
+		if (!romField || !romField->isValid)
+			continue;
 
-		// Certain characters need to be escaped.
-		const char *str = js.str;
-		os << '"';
-		for (; *str != 0; str++) {
-			switch (*str) {
-				case '\\':
-					os << "\\\\";
-					break;
-				case '"':
-					os << "\\";
-					break;
-				case '\b':
-					os << "\\b";
-					break;
-				case '\f':
-					os << "\\f";
-					break;
-				case '\t':
-					os << "\\t";
-					break;
-				case '\n':
-					os << "\\n";
-					break;
-				case '\r':
-					os << "\\r";
-					break;
-				default:
-					os << *str;
-					break;
+		if (printed_first) {
+			if (compact) {
+				json.put(',');
+			} else {
+				json.write(",\n", 2);
 			}
 		}
 
-		return os << '"';
-	}
-};
-
-class JSONFieldsOutput {
-	const RomFields& fields;
-public:
-	explicit JSONFieldsOutput(const RomFields& fields) :fields(fields) {}
-	friend std::ostream& operator<<(std::ostream& os, const JSONFieldsOutput& fo) {
-		os << "[\n";
-		bool printed_first = false;
-		for (int i = 0; i < fo.fields.count(); i++) {
-			auto romField = fo.fields.field(i);
-			assert(romField != nullptr);
-			if (!romField || !romField->isValid)
-				continue;
-
-			if (printed_first)
-				os << ',' << endl;
+		switch (romField->type) {
+		case RomFields::RFT_INVALID: {
+			assert(!"INVALID field type");
+			json.write("{\"type\":\"INVALID\"}");
+			break;
+		}
 
-			switch (romField->type) {
-			case RomFields::RFT_INVALID: {
-				assert(!"INVALID field type");
-				os << "{\"type\":\"INVALID\"}";
-				break;
+		case RomFields::RFT_STRING: {
+			json.write("{\"type\":\"STRING\",\"desc\":{\"name\":");
+			json.writeString(romField->name);
+			json.write(",\"format\":");
+			json.writeUInt(romField->desc.flags);
+			json.write("},\"data\":");
+			if (romField->data.str) {
+				json.writeString(*(romField->data.str));
+			} else {
+				// NULL string.
+				json.writeString(nullptr);
 			}
+			json.put('}');
+			break;
+		}
 
-			case RomFields::RFT_STRING: {
-				os << "{\"type\":\"STRING\",\"desc\":{\"name\":" << JSONString(romField->name.c_str())
-				   << ",\"format\":" << romField->desc.flags
-				   << "},\"data\":" << JSONString(romField->data.str->c_str()) << '}';
-				break;
-			}
+		case RomFields::RFT_BITFIELD: {
+			const auto &bitfieldDesc = romField->desc.bitfield;
+			json.write("{\"type\":\"BITFIELD\",\"desc\":{\"name\":");
+			json.writeString(romField->name);
+			json.write(",\"elementsPerRow\":");
+			json.writeInt(bitfieldDesc.elemsPerRow);
+			json.write(",\"names\":");
+			assert(bitfieldDesc.names != nullptr);
+			if (bitfieldDesc.names) {
+				json.put('[');
+				unsigned int count = static_cast<unsigned int>(bitfieldDesc.names->size());
+				assert(count <= 32);
+				if (count > 32)
+					count = 32;
+				bool printedOne = false;
+				for (unsigned int bit = 0; bit < count; bit++) {
+					const string &name = bitfieldDesc.names->at(bit);
+					if (name.empty())
+						continue;
 
-			case RomFields::RFT_BITFIELD: {
-				const auto &bitfieldDesc = romField->desc.bitfield;
-				os << "{\"type\":\"BITFIELD\",\"desc\":{\"name\":" << JSONString(romField->name.c_str())
-				   << ",\"elementsPerRow\":" << bitfieldDesc.elemsPerRow
-				   << ",\"names\":";
-				assert(bitfieldDesc.names != nullptr);
-				if (bitfieldDesc.names) {
-					os << '[';
-					unsigned int count = static_cast<unsigned int>(bitfieldDesc.names->size());
-					assert(count <= 32);
-					if (count > 32)
-						count = 32;
-					bool printedOne = false;
-					for (unsigned int bit = 0; bit < count; bit++) {
-						const string &name = bitfieldDesc.names->at(bit);
-						if (name.empty())
-							continue;
-
-						if (printedOne) os << ',';
-						printedOne = true;
-						os << JSONString(name.c_str());
-					}
-					os << ']';
-				} else {
-					os << "\"ERROR\"";
+					if (printedOne) json.put(',');
+					printedOne = true;
+					json.writeString(name);
 				}
-				os << "},\"data\":" << romField->data.bitfield << '}';
-				break;
+				json.put(']');
+			} else {
+				json.write("\"ERROR\"");
 			}
+			json.write("},\"data\":");
+			json.writeUInt(romField->data.bitfield);
+			json.put('}');
+			break;
+		}
 
-			case RomFields::RFT_LISTDATA: {
-				const auto &listDataDesc = romField->desc.list_data;
-				os << "{\"type\":\"LISTDATA\",\"desc\":{\"name\":" << JSONString(romField->name.c_str());
-				if (listDataDesc.names) {
-					os << ",\"names\":[";
-					const unsigned int col_count = static_cast<unsigned int>(listDataDesc.names->size());
+		case RomFields::RFT_LISTDATA: {
+			const auto &listDataDesc = romField->desc.list_data;
+			json.write("{\"type\":\"LISTDATA\",\"desc\":{\"name\":");
+			json.writeString(romField->name);
+			if (listDataDesc.names) {
+				json.write(",\"names\":[");
+				const unsigned int col_count = static_cast<unsigned int>(listDataDesc.names->size());
+				if (listDataDesc.flags & RomFields::RFT_LISTDATA_CHECKBOXES) {
+					// TODO: Better JSON schema for RFT_LISTDATA_CHECKBOXES?
+					json.write("\"checked\",");
+				}
+				for (unsigned int j = 0; j < col_count; j++) {
+					if (j) json.put(',');
+					json.writeString(listDataDesc.names->at(j));
+				}
+				json.put(']');
+			} else {
+				json.write(",\"names\":[]");
+			}
+			json.write("},\"data\":[");
+			const auto list_data = romField->data.list_data.data;
+			assert(list_data != nullptr);
+			if (list_data) {
+				uint32_t checkboxes = romField->data.list_data.mxd.checkboxes;
+				for (auto it = list_data->cbegin(); it != list_data->cend(); ++it) {
+					if (it != list_data->cbegin()) json.put(',');
+					json.put('[');
+					bool did_one = false;
 					if (listDataDesc.flags & RomFields::RFT_LISTDATA_CHECKBOXES) {
 						// TODO: Better JSON schema for RFT_LISTDATA_CHECKBOXES?
-						os << "checked,";
-					}
-					for (unsigned int j = 0; j < col_count; j++) {
-						if (j) os << ',';
-						os << JSONString(listDataDesc.names->at(j).c_str());
+						json.write((checkboxes & 1) ? "true" : "false");
+						checkboxes >>= 1;
+						did_one = true;
 					}
-					os << ']';
-				} else {
-					os << ",\"names\":[]";
-				}
-				os << "},\"data\":[";
-				const auto list_data = romField->data.list_data.data;
-				assert(list_data != nullptr);
-				if (list_data) {
-					uint32_t checkboxes = romField->data.list_data.mxd.checkboxes;
-					for (auto it = list_data->cbegin(); it != list_data->cend(); ++it) {
-						if (it != list_data->cbegin()) os << ',';
-						os << '[';
-						if (listDataDesc.flags & RomFields::RFT_LISTDATA_CHECKBOXES) {
-							// TODO: Better JSON schema for RFT_LISTDATA_CHECKBOXES?
-							os << ((checkboxes & 1) ? "true" : "false") << ',';
-							checkboxes >>= 1;
-						}
 
-						bool did_one = false;
-						for (auto jt = it->cbegin(); jt != it->cend(); ++jt) {
-							if (!did_one) os << ',';
-							os << JSONString(jt->c_str());
-							did_one = true;
-						}
-						os << ']';
+					for (auto jt = it->cbegin(); jt != it->cend(); ++jt) {
+						if (did_one) json.put(',');
+						json.writeString(*jt);
+						did_one = true;
 					}
+					json.put(']');
 				}
-				os << "]}";
-				break;
-			}
-
-			case RomFields::RFT_DATETIME: {
-				os << "{\"type\":\"DATETIME\",\"desc\":{\"name\":" << JSONString(romField->name.c_str())
-				   << ",\"flags\":" << romField->desc.flags
-				   << "},\"data\":" << romField->data.date_time
-				   << '}';
-				break;
 			}
+			json.write("]}");
+			break;
+		}
 
-			case RomFields::RFT_AGE_RATINGS: {
-				os << "{\"type\":\"AGE_RATINGS\",\"desc\":{\"name\":" << JSONString(romField->name.c_str())
-				   << "},\"data\":";
-
-				const RomFields::age_ratings_t *age_ratings = romField->data.age_ratings;
-				assert(age_ratings != nullptr);
-				if (!age_ratings) {
-					os << "\"ERROR\"}";
-					break;
-				}
-
-				os << '[';
-				bool printedOne = false;
-				const unsigned int age_ratings_max = static_cast<unsigned int>(age_ratings->size());
-				for (unsigned int j = 0; j < age_ratings_max; j++) {
-					const uint16_t rating = age_ratings->at(j);
-					if (!(rating & RomFields::AGEBF_ACTIVE))
-						continue;
+		case RomFields::RFT_DATETIME: {
+			json.write("{\"type\":\"DATETIME\",\"desc\":{\"name\":");
+			json.writeString(romField->name);
+			json.write(",\"flags\":");
+			json.writeUInt(romField->desc.flags);
+			json.write("},\"data\":");
+			json.writeInt(romField->data.date_time);
+			json.put('}');
+			break;
+		}
 
-					if (printedOne) {
-						// Append a comma.
-						os << ',';
-					}
-					printedOne = true;
+		case RomFields::RFT_AGE_RATINGS: {
+			json.write("{\"type\":\"AGE_RATINGS\",\"desc\":{\"name\":");
+			json.writeString(romField->name);
+			json.write("},\"data\":");
 
-					os << "{\"name\":";
-					const char *const abbrev = RomFields::ageRatingAbbrev(j);
-					if (abbrev) {
-						os << '"' << abbrev << '"';
-					} else {
-						// Invalid age rating.
-						// Use the numeric index.
-						os << j;
-					}
-					os << ",\"rating\":\""
-					   << RomFields::ageRatingDecode(j, rating)
-					   << "\"}";
-				}
-				os << "]}";
+			const RomFields::age_ratings_t *age_ratings = romField->data.age_ratings;
+			assert(age_ratings != nullptr);
+			if (!age_ratings) {
+				json.write("\"ERROR\"}");
 				break;
 			}
 
-			case RomFields::RFT_DIMENSIONS: {
-				os << "{\"type\":\"DIMENSIONS\",\"desc\":{\"name\":" << JSONString(romField->name.c_str())
-				   << "},\"data\":";
-
-				const int *const dimensions = romField->data.dimensions;
-				os << "[\"w\":" << dimensions[0];
-				if (dimensions[1] > 0) {
-					os << ",\"h\":" << dimensions[1];
-					if (dimensions[2] > 0) {
-						os << ",\"d\":" << dimensions[2];
-					}
+			json.put('[');
+			bool printedOne = false;
+			const unsigned int age_ratings_max = static_cast<unsigned int>(age_ratings->size());
+			for (unsigned int j = 0; j < age_ratings_max; j++) {
+				const uint16_t rating = age_ratings->at(j);
+				if (!(rating & RomFields::AGEBF_ACTIVE))
+					continue;
+
+				if (printedOne) {
+					// Append a comma.
+					json.put(',');
 				}
-				os << "]}";
-				break;
+				printedOne = true;
+
+				json.write("{\"name\":");
+				const char *const abbrev = RomFields::ageRatingAbbrev(j);
+				if (abbrev) {
+					json.put('"');
+					json.write(abbrev);
+					json.put('"');
+				} else {
+					// Invalid age rating.
+					// Use the numeric index.
+					json.writeUInt(j);
+				}
+				json.write(",\"rating\":\"");
+				json.write(RomFields::ageRatingDecode(j, rating));
+				json.write("\"}");
 			}
+			json.write("]}");
+			break;
+		}
 
-			default: {
-				assert(!"Unknown RomFieldType");
-				os << "{\"type\":\"NYI\",\"desc\":{\"name\":" << JSONString(romField->name.c_str()) << "}}";
-				break;
-			}
+		case RomFields::RFT_DIMENSIONS: {
+			json.write("{\"type\":\"DIMENSIONS\",\"desc\":{\"name\":");
+			json.writeString(romField->name);
+			json.write("},\"data\":");
+
+			const int *const dimensions = romField->data.dimensions;
+			json.write("{\"w\":");
+			json.writeInt(dimensions[0]);
+			if (dimensions[1] > 0) {
+				json.write(",\"h\":");
+				json.writeInt(dimensions[1]);
+				if (dimensions[2] > 0) {
+					json.write(",\"d\":");
+					json.writeInt(dimensions[2]);
+				}
 			}
+			json.write("}}");
+			break;
+		}
 
-			printed_first = true;
+		default: {
+			assert(!"Unknown RomFieldType");
+			json.write("{\"type\":\"NYI\",\"desc\":{\"name\":");
+			json.writeString(romField->name);
+			json.write("}}");
+			break;
+		}
 		}
-		os << ']';
-		return os;
-	}
-};
 
+		printed_first = true;
+	}
+	json.put(']');
+}
 
+JSONFieldsOutput::JSONFieldsOutput(const RomFields& fields, bool compact)
+	: fields(fields), compact(compact) {}
+std::ostream& operator<<(std::ostream& os, const JSONFieldsOutput& fo) {
+	JSONWriter json(os);
+	writeJSONFields(json, fo.fields, fo.compact);
+	return os;
+}
 
 ROMOutput::ROMOutput(const RomData *romdata) : romdata(romdata) { }
 std::ostream& operator<<(std::ostream& os, const ROMOutput& fo) {
@@ -943,7 +943,8 @@ std::ostream& operator<<(std::ostream& os, const ROMOutput& fo) {
 	return os;
 }
 
-JSONROMOutput::JSONROMOutput(const RomData *romdata) : romdata(romdata) {}
+JSONROMOutput::JSONROMOutput(const RomData *romdata, bool compact)
+	: romdata(romdata), compact(compact) {}
 std::ostream& operator<<(std::ostream& os, const JSONROMOutput& fo) {
 	auto romdata = fo.romdata;
 	assert(romdata && romdata->isValid());
@@ -953,19 +954,21 @@ std::ostream& operator<<(std::ostream& os, const JSONROMOutput& fo) {
 	assert(systemName != nullptr);
 	assert(fileType != nullptr);
 
-	os << "{\"system\":";
+	JSONWriter json(os);
+	json.write("{\"system\":");
 	if (systemName) {
-		os << JSONString(systemName);
+		json.writeString(systemName);
 	} else {
-		os << "\"unknown\"";
+		json.write("\"unknown\"");
 	}
-	os << ",\"filetype\":";
+	json.write(",\"filetype\":");
 	if (fileType) {
-		os << JSONString(fileType);
+		json.writeString(fileType);
 	} else {
-		os << "\"unknown\"";
+		json.write("\"unknown\"");
 	}
-	os << ",\"fields\":" << JSONFieldsOutput(*(romdata->fields()));
+	json.write(",\"fields\":");
+	writeJSONFields(json, *(romdata->fields()), fo.compact);
 
 	const int supported = romdata->supportedImageTypes();
 
@@ -976,43 +979,52 @@ std::ostream& operator<<(std::ostream& os, const JSONROMOutput& fo) {
 			continue;
 
 		if (first) {
-			os << ",\n\"imgint\":[";
+			json.write(fo.compact ? "," : ",\n");
+			json.write("\"imgint\":[");
 			first = false;
 		} else {
-			os << ',';
+			json.put(',');
 		}
 
-		os << "{\"type\":" << JSONString(RomData::getImageTypeName((RomData::ImageType)i));
+		json.write("{\"type\":");
+		json.writeString(RomData::getImageTypeName((RomData::ImageType)i));
 		auto image = romdata->image((RomData::ImageType)i);
 		if (image && image->isValid()) {
-			os << ",\"format\":" << JSONString(rp_image::getFormatName(image->format()));
-			os << ",\"size\":[" << image->width() << ',' << image->height() << ']';
+			json.write(",\"format\":");
+			json.writeString(rp_image::getFormatName(image->format()));
+			json.write(",\"size\":[");
+			json.writeInt(image->width());
+			json.put(',');
+			json.writeInt(image->height());
+			json.put(']');
 			int ppf = romdata->imgpf((RomData::ImageType) i);
 			if (ppf) {
-				os << ",\"postprocessing\":" << ppf;
+				json.write(",\"postprocessing\":");
+				json.writeInt(ppf);
 			}
 			if (ppf & RomData::IMGPF_ICON_ANIMATED) {
 				auto animdata = romdata->iconAnimData();
 				if (animdata) {
-					os << ",\"frames\":" << animdata->count;
-					os << ",\"sequence\":[";
+					json.write(",\"frames\":");
+					json.writeInt(animdata->count);
+					json.write(",\"sequence\":[");
 					for (int j = 0; j < animdata->seq_count; j++) {
-						if (j) os << ',';
-						os << (unsigned)animdata->seq_index[j];
+						if (j) json.put(',');
+						json.writeUInt(animdata->seq_index[j]);
 					}
-					os << "],\"delay\":[";
+					json.write("],\"delay\":[");
 					for (int j = 0; j < animdata->seq_count; j++) {
-						if (j) os << ',';
-						os << animdata->delays[j].ms;
+						if (j) json.put(',');
+						json.writeInt(animdata->delays[j].ms);
 					}
-					os << ']';
+					json.put(']');
 				}
 			}
 		}
-		os << '}';
+		json.put('}');
 	}
 	if (!first) {
-		os << ']';
+		json.put(']');
 	}
 
 	first = true;
@@ -1032,32 +1044,54 @@ std::ostream& operator<<(std::ostream& os, const JSONROMOutput& fo) {
 			continue;
 
 		if (first) {
-			os << ",\n\"imgext\":[";
+			json.write(fo.compact ? "," : ",\n");
+			json.write("\"imgext\":[");
 			first = false;
 		} else {
-			os << ',';
+			json.put(',');
 		}
 
-		os << "{\"type\":" << JSONString(RomData::getImageTypeName((RomData::ImageType)i));
+		json.write("{\"type\":");
+		json.writeString(RomData::getImageTypeName((RomData::ImageType)i));
 		int ppf = romdata->imgpf((RomData::ImageType) i);
 		if (ppf) {
-			os << ",\"postprocessing\":" << ppf;
+			json.write(",\"postprocessing\":");
+			json.writeInt(ppf);
 		}
 		// NOTE: IMGPF_ICON_ANIMATED won't ever appear in external image
-		os << ",\"exturls\":[";
+		json.write(",\"exturls\":[");
 		bool firsturl = true;
 
 		for (auto iter = extURLs.cbegin(); iter != extURLs.cend(); ++iter) {
 			if (firsturl) firsturl = false;
-			else os << ',';
+			else json.put(',');
 
-			os << "{\"url\":" << JSONString(iter->url.c_str());
-			os << ",\"cache_key\":" << JSONString(iter->cache_key.c_str()) << '}';
+			json.write("{\"url\":");
+			json.writeString(iter->url);
+			json.write(",\"cache_key\":");
+			json.writeString(iter->cache_key);
+			json.put('}');
 		}
+		json.write("]}", 2);
 	}
 	if (!first) {
-		os << ']';
+		json.put(']');
 	}
 
-	return os << '}';
+	json.put('}');
+	return os;
+}
+
+JSONErrorOutput::JSONErrorOutput(const char *error, int code)
+	: error(error), code(code) {}
+std::ostream& operator<<(std::ostream& os, const JSONErrorOutput& fo) {
+	JSONWriter json(os);
+	json.write("{\"error\":");
+	json.writeString(fo.error);
+	if (fo.code != 0) {
+		json.write(",\"code\":");
+		json.writeInt(fo.code);
+	}
+	json.put('}');
+	return os;
 }
@@ -25,6 +25,7 @@
 #include <ostream>
 namespace LibRpBase {
 	class RomData;
+	class RomFields;
 }
 
 class ROMOutput {
@@ -34,11 +35,35 @@ public:
 	friend std::ostream& operator<<(std::ostream& os, const ROMOutput& fo);
 };
 
+class JSONString {
+	const char *str;
+public:
+	explicit JSONString(const char *str);
+	friend std::ostream& operator<<(std::ostream& os, const JSONString& js);
+};
+
+class JSONFieldsOutput {
+	const LibRpBase::RomFields &fields;
+	bool compact;		// If true, don't print any newlines. (NDJSON)
+public:
+	explicit JSONFieldsOutput(const LibRpBase::RomFields &fields, bool compact = false);
+	friend std::ostream& operator<<(std::ostream& os, const JSONFieldsOutput& fo);
+};
+
 class JSONROMOutput {
 	const LibRpBase::RomData *romdata;
+	bool compact;		// If true, don't print any newlines. (NDJSON)
 public:
-	explicit JSONROMOutput(const LibRpBase::RomData *romdata);
+	explicit JSONROMOutput(const LibRpBase::RomData *romdata, bool compact = false);
 	friend std::ostream& operator<<(std::ostream& os, const JSONROMOutput& fo);
 };
 
+class JSONErrorOutput {
+	const char *error;	// Error message.
+	int code;		// Error code. (If 0, not printed.)
+public:
+	explicit JSONErrorOutput(const char *error, int code = 0);
+	friend std::ostream& operator<<(std::ostream& os, const JSONErrorOutput& fo);
+};
+
 #endif /* __ROMPROPERTIES_RPCLI_PROPERTIES_HPP__ */
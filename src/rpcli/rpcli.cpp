@@ -32,12 +32,26 @@ using namespace LibRpBase;
 // libromdata
 #include "librpbase/TextFuncs.hpp"
 #include "librpbase/file/RpFile.hpp"
+#include "librpbase/file/IoBudget.hpp"
 #include "librpbase/img/rp_image.hpp"
 #include "librpbase/img/RpPng.hpp"
+#include "librpbase/img/RpPngWriter.hpp"
 #include "librpbase/img/IconAnimData.hpp"
 #include "libromdata/RomDataFactory.hpp"
 using namespace LibRomData;
 
+#ifndef _WIN32
+// libcachemgr
+# include "librpbase/config/Config.hpp"
+# include "libcachemgr/CacheManager.hpp"
+# include "libcachemgr/CacheIndex.hpp"
+using LibCacheMgr::CacheManager;
+using LibCacheMgr::CacheIndex;
+# include "scan.hpp"
+# include "serve.hpp"
+# include "catalog.hpp"
+#endif /* !_WIN32 */
+
 #ifdef _WIN32
 // libwin32common
 # include "libwin32common/RpWin32_sdk.h"
@@ -45,6 +59,7 @@ using namespace LibRomData;
 #endif /* _WIN32 */
 
 #include "properties.hpp"
+#include "profile.hpp"
 #ifdef ENABLE_DECRYPTION
 # include "verifykeys.hpp"
 #endif /* ENABLE_DECRYPTION */
@@ -82,8 +97,69 @@ DELAYLOAD_TEST_FUNCTION_IMPL1(textdomain, nullptr);
 struct ExtractParam {
 	int image_type; // Image Type. -1 = iconAnimData, MUST be between -1 and IMG_INT_MAX
 	const char* filename; // Target filename. Can be null due to argv[argc]
+	RpPngWriter::Profile profile; // PNG encoding profile.
 };
 
+/**
+ * Save an animated icon as an APNG image.
+ * Frames are written one at a time, and only the
+ * region that changed since the previous frame
+ * is stored.
+ * @param filename	[in] Output filename.
+ * @param iconAnimData	[in] Animated icon data.
+ * @param profile	[in] PNG encoding profile.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+static int SaveAnimatedIcon(const char *filename, const IconAnimData *iconAnimData, RpPngWriter::Profile profile)
+{
+	const rp_image *frame = iconAnimData->frames[iconAnimData->seq_index[0]];
+	if (!frame || !frame->isValid()) {
+		return -EINVAL;
+	}
+
+	RpPngWriter pngWriter(filename, frame->width(), frame->height(),
+		frame->format(), iconAnimData->seq_count);
+	if (!pngWriter.isOpen()) {
+		return -pngWriter.lastError();
+	}
+	int ret = pngWriter.setProfile(profile);
+	if (ret != 0) {
+		return ret;
+	}
+
+	// NOTE: CI8 frames are written using the first frame's palette.
+	rp_image::sBIT_t sBIT;
+	const bool has_sBIT = (frame->get_sBIT(&sBIT) == 0);
+	ret = pngWriter.write_IHDR(has_sBIT ? &sBIT : nullptr,
+		frame->palette(), frame->palette_len());
+	if (ret != 0) {
+		return ret;
+	}
+
+	for (int i = 0; i < iconAnimData->seq_count; i++) {
+		// If a frame is nullptr, the previous frame is used.
+		const rp_image *const next = iconAnimData->frames[iconAnimData->seq_index[i]];
+		if (next) {
+			if (next->width() != frame->width() ||
+			    next->height() != frame->height() ||
+			    next->format() != frame->format())
+			{
+				// All frames must have the same format.
+				return -EINVAL;
+			}
+			frame = next;
+		}
+		ret = pngWriter.write_frame(frame,
+			iconAnimData->delays[i].numer, iconAnimData->delays[i].denom);
+		if (ret != 0) {
+			// NOTE: RpPngWriter deletes the file
+			// if not all frames were written.
+			return ret;
+		}
+	}
+	return 0;
+}
+
 /**
 * Extracts images from romdata
 * @param romData RomData containing the images
@@ -105,7 +181,7 @@ static void ExtractImages(const RomData *romData, vector<ExtractParam>& extract)
 					rp_sprintf_p(C_("rpcli", "Extracting %1$s into '%2$s'"),
 						RomData::getImageTypeName((RomData::ImageType)it->image_type),
 						it->filename) << endl;
-				int errcode = RpPng::save(it->filename, image);
+				int errcode = RpPng::save(it->filename, image, it->profile);
 				if (errcode != 0) {
 					// tr: %1$s == filename, %2%s == error message
 					cerr << rp_sprintf_p(C_("rpcli", "Couldn't create file '%1$s': %2$s"),
@@ -122,11 +198,11 @@ static void ExtractImages(const RomData *romData, vector<ExtractParam>& extract)
 			if (iconAnimData && iconAnimData->count != 0 && iconAnimData->seq_count != 0) {
 				found = true;
 				cerr << "-- " << rp_sprintf(C_("rpcli", "Extracting animated icon into '%s'"), it->filename) << endl;
-				int errcode = RpPng::save(it->filename, iconAnimData);
+				int errcode = SaveAnimatedIcon(it->filename, iconAnimData, it->profile);
 				if (errcode == -ENOTSUP) {
 					cerr << "   " << C_("rpcli", "APNG not supported, extracting only the first frame") << endl;
 					// falling back to outputting the first frame
-					errcode = RpPng::save(it->filename, iconAnimData->frames[iconAnimData->seq_index[0]]);
+					errcode = RpPng::save(it->filename, iconAnimData->frames[iconAnimData->seq_index[0]], it->profile);
 				}
 				if (errcode != 0) {
 					cerr << "   " <<
@@ -154,22 +230,43 @@ static void ExtractImages(const RomData *romData, vector<ExtractParam>& extract)
 * @param filename ROM filename
 * @param json Is program running in json mode?
 * @param extract Vector of image extraction parameters
+* @param budget I/O budget
 */
-static void DoFile(const char *filename, bool json, vector<ExtractParam>& extract){
+static void DoFile(const char *filename, bool json, vector<ExtractParam>& extract, const IoBudget::Limits &budget){
 	cerr << "== " << rp_sprintf(C_("rpcli", "Reading file '%s'..."), filename) << endl;
+	IoBudget ioBudget(budget);
+	IoBudget::Scope scope(budget.isEnabled() ? &ioBudget : nullptr);
+	FileProfile prof;
+	prof.start(FileProfile::PHASE_OPEN);
 	IRpFile *file = new RpFile(filename, RpFile::FM_OPEN_READ_GZ);
 	if (file->isOpen()) {
+		prof.start(FileProfile::PHASE_DETECT);
 		RomData *romData = RomDataFactory::create(file);
 		if (romData && romData->isValid()) {
+			prof.load(romData);
+			prof.start(FileProfile::PHASE_OUTPUT);
 			if (json) {
 				cerr << "-- " << C_("rpcli", "Outputting JSON data") << endl;
 				cout << JSONROMOutput(romData) << endl;
 			} else {
 				cout << ROMOutput(romData) << endl;
 			}
+			prof.finish(romData->className());
+			prof.print(cerr);
 
 			ExtractImages(romData, extract);
+			if (ioBudget.isExceeded()) {
+				// Some fields or images may be missing.
+				cerr << "-- " << C_("rpcli", "Warning: I/O budget exceeded; output may be incomplete") << endl;
+			}
+		} else if (ioBudget.isExceeded()) {
+			prof.finish(nullptr);
+			prof.print(cerr);
+			cerr << "-- " << C_("rpcli", "I/O budget exceeded") << endl;
+			if (json) cout << "{\"error\":\"i/o budget exceeded\",\"code\":" << ECANCELED << "}" << endl;
 		} else {
+			prof.finish(nullptr);
+			prof.print(cerr);
 			cerr << "-- " << C_("rpcli", "ROM is not supported") << endl;
 			if (json) cout << "{\"error\":\"rom is not supported\"}" << endl;
 		}
@@ -221,6 +318,77 @@ static void PrintSystemRegion(void)
 	cout << endl;
 }
 
+#ifndef _WIN32
+/**
+ * Print the download cache usage.
+ * @return 0 on success; non-zero on error.
+ */
+static int PrintCacheInfo(void)
+{
+	CacheIndex *const idx = CacheManager::index();
+	CacheIndex::Stats stats;
+	if (!idx || idx->stats(&stats) != 0) {
+		cerr << C_("rpcli", "Unable to open the cache index.") << endl;
+		return EXIT_FAILURE;
+	}
+
+	const unsigned int maxSizeMiB = Config::instance()->cacheMaxSize();
+	cout << rp_sprintf(C_("rpcli", "Cache directory: %s"), idx->cacheDir().c_str()) << endl;
+	cout << rp_sprintf(C_("rpcli", "Cached files: %u"), stats.count - stats.negative) << endl;
+	cout << rp_sprintf(C_("rpcli", "Negative cache entries: %u"), stats.negative) << endl;
+	cout << rp_sprintf(C_("rpcli", "Total size: %s"),
+		formatFileSize(static_cast<int64_t>(stats.total_size)).c_str()) << endl;
+	cout << rp_sprintf(C_("rpcli", "Maximum size: %s"),
+		(maxSizeMiB > 0
+			? formatFileSize(static_cast<int64_t>(maxSizeMiB) * 1024 * 1024).c_str()
+			: C_("rpcli", "unlimited"))) << endl;
+	if (stats.oldest_access >= 0) {
+		const time_t now = time(nullptr);
+		const long days = (now > stats.oldest_access ? (long)((now - stats.oldest_access) / 86400) : 0);
+		cout << rp_sprintf(C_("rpcli", "Least recently used file: %ld day(s) ago"), days) << endl;
+	}
+
+	// Extra line. (TODO: Only if multiple commands are specified.)
+	cout << endl;
+	return 0;
+}
+
+/**
+ * Trim the download cache by evicting the least-recently used files.
+ * @param maxSizeStr Maximum size, in MiB. (If empty, use the configured maximum size.)
+ * @return 0 on success; non-zero on error.
+ */
+static int TrimCache(const char *maxSizeStr)
+{
+	uint64_t maxSize;
+	if (maxSizeStr[0] != '\0') {
+		char *endptr = nullptr;
+		const long val = strtol(maxSizeStr, &endptr, 10);
+		if (*endptr != '\0' || val < 0) {
+			cerr << rp_sprintf(C_("rpcli", "Invalid cache size '%s'"), maxSizeStr) << endl;
+			return EXIT_FAILURE;
+		}
+		maxSize = static_cast<uint64_t>(val) * 1024 * 1024;
+	} else {
+		maxSize = static_cast<uint64_t>(Config::instance()->cacheMaxSize()) * 1024 * 1024;
+		if (maxSize == 0) {
+			// Unlimited. Nothing to trim.
+			return 0;
+		}
+	}
+
+	CacheIndex *const idx = CacheManager::index();
+	const int64_t freed = (idx ? idx->evict(maxSize) : -EIO);
+	if (freed < 0) {
+		cerr << rp_sprintf(C_("rpcli", "Unable to trim the cache: %s"), strerror(static_cast<int>(-freed))) << endl;
+		return EXIT_FAILURE;
+	}
+	cout << rp_sprintf(C_("rpcli", "Freed %s from the cache."), formatFileSize(freed).c_str()) << endl;
+	cout << endl;
+	return 0;
+}
+#endif /* !_WIN32 */
+
 int RP_C_API main(int argc, char *argv[])
 {
 #ifdef _WIN32
@@ -253,31 +421,62 @@ int RP_C_API main(int argc, char *argv[])
 
 	if(argc < 2){
 #ifdef ENABLE_DECRYPTION
-		cerr << C_("rpcli", "Usage: rpcli [-k] [-c] [-j] [[-x[b]N outfile]... [-a apngoutfile] filename]...") << endl;
+		cerr << C_("rpcli", "Usage: rpcli [-k] [-c] [-j] [-zprofile] [[-x[b]N outfile]... [-a apngoutfile] filename]...") << endl;
 		cerr << "  -k:   " << C_("rpcli", "Verify encryption keys in keys.conf.") << endl;
 #else /* !ENABLE_DECRYPTION */
-		cerr << C_("rpcli", "Usage: rpcli [-j] [[-x[b]N outfile]... [-a apngoutfile] filename]...") << endl;
+		cerr << C_("rpcli", "Usage: rpcli [-j] [-zprofile] [[-x[b]N outfile]... [-a apngoutfile] filename]...") << endl;
 #endif /* ENABLE_DECRYPTION */
 		cerr << "  -c:   " << C_("rpcli", "Print system region information.") << endl;
+#ifndef _WIN32
+		cerr << "  -C:   " << C_("rpcli", "Print download cache usage.") << endl;
+		cerr << "  -TN:  " << C_("rpcli", "Trim the download cache to N MiB. (default is CacheMaxSize)") << endl;
+		cerr << "  -r:   " << C_("rpcli", "Recursively scan a directory and print one JSON object per file.") << endl;
+		cerr << "  -JN:  " << C_("rpcli", "Use N worker threads for -r. (default is the number of CPUs)") << endl;
+		cerr << "  -s:   " << C_("rpcli", "Print -r and --serve results in request order instead of completion order.") << endl;
+		cerr << "  --serve[=socket]: " << C_("rpcli", "Read filenames from stdin, or from connections to a Unix socket, and print one JSON object per file.") << endl;
+		cerr << "  -0:   " << C_("rpcli", "Filenames for --serve are separated by NUL characters instead of newlines.") << endl;
+		cerr << "  --catalog=file: " << C_("rpcli", "Store -r and --serve results in a catalog file, and skip files that haven't changed.") << endl;
+		cerr << "  --prefetch: " << C_("rpcli", "Download the external images for -r into the cache after scanning.") << endl;
+#endif /* !_WIN32 */
 		cerr << "  -j:   " << C_("rpcli", "Use JSON output format.") << endl;
 		cerr << "  -xN:  " << C_("rpcli", "Extract image N to outfile in PNG format.") << endl;
 		cerr << "  -a:   " << C_("rpcli", "Extract the animated icon to outfile in APNG format.") << endl;
+		cerr << "  -z:   " << C_("rpcli", "PNG encoding profile for extracted images: default, fast, small.") << endl;
+		cerr << "  --profile: " << C_("rpcli", "Print the time and I/O used for each file, and a summary by file type.") << endl;
+		cerr << "  --budget=MiB[,reads[,ms]]: " << C_("rpcli", "Stop reading a file once it has used this much I/O or time. (0 == unlimited)") << endl;
 		cerr << endl;
 		cerr << C_("rpcli", "Examples:") << endl;
 		cerr << "* rpcli s3.gen" << endl;
 		cerr << "\t " << C_("rpcli", "displays info about s3.gen") << endl;
 		cerr << "* rpcli -x0 icon.png pokeb2.nds" << endl;
 		cerr << "\t " << C_("rpcli", "extracts icon from pokeb2.nds") << endl;
+#ifndef _WIN32
+		cerr << "* rpcli -J8 -r roms > roms.ndjson" << endl;
+		cerr << "\t " << C_("rpcli", "scans all files in roms using 8 threads") << endl;
+		cerr << "* find roms -type f -print0 | rpcli -0 --serve" << endl;
+		cerr << "\t " << C_("rpcli", "scans all files listed by find") << endl;
+#endif /* !_WIN32 */
 	}
 	
 	assert(RomData::IMG_INT_MIN == 0);
 	// DoFile parameters
 	bool json = false;
 	vector<ExtractParam> extract;
+	RpPngWriter::Profile png_profile = RpPngWriter::PROFILE_DEFAULT;
+	IoBudget::Limits budget = {0, 0, 0};
+#ifndef _WIN32
+	// ScanDirectory parameters
+	unsigned int scan_jobs = 0;
+	bool scan_ordered = false;
+	char serve_delim = '\n';
+	Catalog catalog;
+#endif /* !_WIN32 */
 
-	for (int i = 1; i < argc; i++) { // figure out the json mode in advance
+	for (int i = 1; i < argc; i++) { // figure out the json and profile modes in advance
 		if (argv[i][0] == '-' && argv[i][1] == 'j') {
 			json = true;
+		} else if (!strcmp(argv[i], "--profile")) {
+			FileProfile::setEnabled(true);
 		}
 	}
 	if (json) cout << "[\n";
@@ -302,6 +501,97 @@ int RP_C_API main(int argc, char *argv[])
 				PrintSystemRegion();
 				break;
 			}
+#ifndef _WIN32
+			case 'C': {
+				// Print the download cache usage.
+				if (PrintCacheInfo() != 0) {
+					ret = EXIT_FAILURE;
+				}
+				break;
+			}
+			case 'T': {
+				// Trim the download cache.
+				if (TrimCache(argv[i] + 2) != 0) {
+					ret = EXIT_FAILURE;
+				}
+				break;
+			}
+			case 'r': {
+				// Recursively scan a directory.
+				if (i + 1 >= argc) {
+					cerr << C_("rpcli", "Warning: -r requires a directory") << endl;
+					break;
+				}
+				if (ScanDirectory(argv[++i], scan_jobs, scan_ordered) != 0) {
+					ret = EXIT_FAILURE;
+				}
+				break;
+			}
+			case 'J': {
+				// Number of worker threads for -r.
+				char *endptr = nullptr;
+				const long jobs = strtol(argv[i] + 2, &endptr, 10);
+				if (argv[i][2] == '\0' || *endptr != '\0' || jobs < 0 || jobs > 1024) {
+					cerr << rp_sprintf(C_("rpcli", "Warning: skipping invalid job count '%s'"), argv[i] + 2) << endl;
+					break;
+				}
+				scan_jobs = static_cast<unsigned int>(jobs);
+				break;
+			}
+			case 's':
+				scan_ordered = true;
+				break;
+			case '0':
+				serve_delim = '\0';
+				break;
+#endif /* !_WIN32 */
+			case '-': {
+				// Long options.
+				if (!strcmp(argv[i], "--profile")) {
+					// Handled above.
+					break;
+				}
+				if (!strncmp(argv[i], "--budget=", 9)) {
+					IoBudget::Limits newBudget;
+					if (IoBudget::parseLimits(argv[i] + 9, newBudget) != 0) {
+						cerr << rp_sprintf(C_("rpcli", "Warning: skipping invalid I/O budget '%s'"), argv[i] + 9) << endl;
+						break;
+					}
+					budget = newBudget;
+#ifndef _WIN32
+					SetScanBudget(budget.max_bytes, budget.max_reads, budget.timeout_ms);
+#endif /* !_WIN32 */
+					break;
+				}
+#ifndef _WIN32
+				if (!strcmp(argv[i], "--serve")) {
+					if (ServeStdin(scan_jobs, scan_ordered, serve_delim) != 0) {
+						ret = EXIT_FAILURE;
+					}
+					break;
+				} else if (!strncmp(argv[i], "--serve=", 8) && argv[i][8] != '\0') {
+					if (ServeSocket(argv[i] + 8, scan_jobs, scan_ordered, serve_delim) != 0) {
+						ret = EXIT_FAILURE;
+					}
+					break;
+				} else if (!strcmp(argv[i], "--prefetch")) {
+					SetScanPrefetch(true);
+					break;
+				} else if (!strncmp(argv[i], "--catalog=", 10) && argv[i][10] != '\0') {
+					const int cret = catalog.open(argv[i] + 10, SCAN_OUTPUT_OPTIONS);
+					if (cret != 0) {
+						cerr << rp_sprintf_p(C_("rpcli", "Warning: couldn't open catalog '%1$s': %2$s"),
+							argv[i] + 10, strerror(-cret)) << endl;
+						SetScanCatalog(nullptr);
+					} else {
+						SetScanCatalog(&catalog);
+					}
+					break;
+				}
+#endif /* !_WIN32 */
+				cerr << rp_sprintf(C_("rpcli", "Warning: skipping unknown option '%s'"), argv[i]) << endl;
+				break;
+			}
 			case 'x': {
 				ExtractParam ep;
 				long num = atol(argv[i] + 2);
@@ -311,6 +601,7 @@ int RP_C_API main(int argc, char *argv[])
 				}
 				ep.image_type = num;
 				ep.filename = argv[++i];
+				ep.profile = png_profile;
 				extract.push_back(ep);
 				break;
 			}
@@ -318,9 +609,20 @@ int RP_C_API main(int argc, char *argv[])
 				ExtractParam ep;
 				ep.image_type = -1;
 				ep.filename = argv[++i];
+				ep.profile = png_profile;
 				extract.push_back(ep);
 				break;
 			}
+			case 'z': {
+				// PNG encoding profile.
+				const int profile = RpPngWriter::profileFromName(argv[i] + 2);
+				if (profile < 0) {
+					cerr << rp_sprintf(C_("rpcli", "Warning: skipping unknown PNG profile '%s'"), argv[i] + 2) << endl;
+					break;
+				}
+				png_profile = static_cast<RpPngWriter::Profile>(profile);
+				break;
+			}
 			case 'j': // do nothing
 				break;
 			default:
@@ -331,10 +633,13 @@ int RP_C_API main(int argc, char *argv[])
 		else{
 			if (first) first = false;
 			else if (json) cout << "," << endl;
-			DoFile(argv[i], json, extract);
+			DoFile(argv[i], json, extract, budget);
 			extract.clear();
 		}
 	}
 	if (json) cout << "]\n";
+	if (FileProfile::isEnabled()) {
+		FileProfile::printSummary(cerr);
+	}
 	return ret;
 }
@@ -0,0 +1,565 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (rpcli)                            *
+ * scan.cpp: Recursive directory scanning.                                 *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "stdafx.h"
+#include "config.rpcli.h"
+
+#ifdef _WIN32
+#error This file should only be compiled on Unix-like systems.
+#endif
+
+#include "scan.hpp"
+#include "catalog.hpp"
+#include "properties.hpp"
+#include "profile.hpp"
+
+// librpbase
+#include "librpbase/RomData.hpp"
+#include "librpbase/TextFuncs.hpp"
+#include "librpbase/file/RpFile.hpp"
+#include "librpbase/file/IoBudget.hpp"
+#include "librpbase/threads/Mutex.hpp"
+#include "librpbase/config/Config.hpp"
+#include "libi18n/i18n.h"
+using namespace LibRpBase;
+
+// libromdata
+#include "libromdata/RomDataFactory.hpp"
+using LibRomData::RomDataFactory;
+
+// libcachemgr
+#include "libcachemgr/CacheManager.hpp"
+using LibCacheMgr::CacheManager;
+
+// C includes.
+#include <dirent.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// C includes. (C++ namespace)
+#include <cerrno>
+
+// C++ includes.
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+using std::cerr;
+using std::cout;
+using std::endl;
+using std::ostream;
+using std::ostringstream;
+using std::string;
+using std::vector;
+
+// Output options that affect ScanFile() results.
+// NOTE: Update this if ScanFile() output gains options.
+const char SCAN_OUTPUT_OPTIONS[] = "json,compact,imgint,imgext";
+
+// Result catalog. (optional)
+static Catalog *scanCatalog = nullptr;
+
+// I/O budget limits. (0 == unlimited)
+static uint64_t budget_max_bytes = 0;
+static uint64_t budget_max_reads = 0;
+static unsigned int budget_timeout_ms = 0;
+
+// Prefetch external images after scanning a directory.
+static bool scan_prefetch = false;
+
+// External image download requests for the current directory scan.
+// Only set while ScanDirectory() is running with prefetching enabled.
+static Mutex prefetchMutex;
+static vector<CacheManager::DownloadRequest> *prefetchRequests = nullptr;
+
+/**
+ * Shared state for the worker threads.
+ */
+struct ScanState {
+	vector<string> files;	// Files to scan.
+	bool ordered;		// Print results in directory order.
+
+	// All fields below are protected by mutex.
+	Mutex mutex;
+	size_t next_file;		// Next file to scan.
+	unsigned int counts[SCAN_MAX];	// Result counts.
+
+	// Ordered mode: Results that can't be printed yet.
+	vector<string> results;
+	vector<bool> done;
+	size_t next_output;		// Next result to print.
+
+	ScanState()
+		: ordered(false)
+		, next_file(0)
+		, next_output(0)
+	{
+		memset(counts, 0, sizeof(counts));
+	}
+
+	private:
+		RP_DISABLE_COPY(ScanState)
+};
+
+/**
+ * Recursively list all files in a directory.
+ * Entries are sorted by name. Symlinks to directories are not followed.
+ * @param path		[in] Directory path, without a trailing slash.
+ * @param files		[out] Vector for the files.
+ * @param errors	[in/out] Incremented for each directory that couldn't be read.
+ * @return 0 on success; negative POSIX error code if the directory couldn't be opened.
+ */
+static int listFiles(const string &path, vector<string> &files, unsigned int &errors)
+{
+	DIR *const dir = opendir(path.c_str());
+	if (!dir) {
+		const int err = errno;
+		cerr << "-- " << rp_sprintf_p(C_("rpcli", "Couldn't open directory '%1$s': %2$s"),
+			path.c_str(), strerror(err)) << endl;
+		errors++;
+		return -err;
+	}
+
+	vector<string> names;
+	struct dirent *d;
+	while ((d = readdir(dir)) != nullptr) {
+		if (d->d_name[0] == '.' &&
+		    (d->d_name[1] == '\0' || (d->d_name[1] == '.' && d->d_name[2] == '\0')))
+		{
+			// "." or ".."
+			continue;
+		}
+		names.push_back(d->d_name);
+	}
+	closedir(dir);
+	std::sort(names.begin(), names.end());
+
+	for (auto iter = names.cbegin(); iter != names.cend(); ++iter) {
+		string filename = path;
+		filename += '/';
+		filename += *iter;
+
+		// NOTE: Using lstat() instead of d_type, since
+		// d_type is DT_UNKNOWN on some filesystems.
+		struct stat sb;
+		if (lstat(filename.c_str(), &sb) != 0) {
+			continue;
+		}
+		if (S_ISLNK(sb.st_mode)) {
+			// Only follow symlinks to regular files.
+			if (stat(filename.c_str(), &sb) != 0 || !S_ISREG(sb.st_mode)) {
+				continue;
+			}
+		}
+
+		if (S_ISDIR(sb.st_mode)) {
+			listFiles(filename, files, errors);
+		} else if (S_ISREG(sb.st_mode)) {
+			files.push_back(std::move(filename));
+		}
+	}
+	return 0;
+}
+
+/**
+ * Add a RomData object's external image URLs to the prefetch list.
+ * @param romData RomData object.
+ */
+static void addPrefetchRequests(const RomData *romData)
+{
+	const uint32_t imgbf = romData->supportedImageTypes();
+	if (!(imgbf & ((1U << (RomData::IMG_EXT_MAX + 1)) - (1U << RomData::IMG_EXT_MIN)))) {
+		// No external images.
+		return;
+	}
+
+	// NOTE: The same URLs are printed in "imgext".
+	const bool highRes = Config::instance()->downloadHighResScans();
+	vector<RomData::ExtURL> extURLs;
+	for (int i = RomData::IMG_EXT_MIN; i <= RomData::IMG_EXT_MAX; i++) {
+		if (!(imgbf & (1U << i)))
+			continue;
+
+		extURLs.clear();
+		int ret = romData->extURLs(static_cast<RomData::ImageType>(i), &extURLs, RomData::IMAGE_SIZE_DEFAULT);
+		if (ret != 0 || extURLs.empty())
+			continue;
+
+		MutexLocker locker(prefetchMutex);
+		if (!prefetchRequests)
+			return;
+		for (auto iter = extURLs.cbegin(); iter != extURLs.cend(); ++iter) {
+			if (iter->high_res && !highRes)
+				continue;
+			prefetchRequests->push_back(CacheManager::DownloadRequest(iter->url, iter->cache_key));
+		}
+	}
+}
+
+/**
+ * Download the external images for all scanned files.
+ * Each cache key is only requested once.
+ * @param requests Download requests.
+ */
+static void prefetchExtImages(vector<CacheManager::DownloadRequest> &requests)
+{
+	std::sort(requests.begin(), requests.end(),
+		[](const CacheManager::DownloadRequest &a, const CacheManager::DownloadRequest &b) {
+			return (a.cache_key < b.cache_key);
+		});
+	requests.erase(std::unique(requests.begin(), requests.end(),
+		[](const CacheManager::DownloadRequest &a, const CacheManager::DownloadRequest &b) {
+			return (a.cache_key == b.cache_key);
+		}), requests.end());
+	if (requests.empty())
+		return;
+
+	cerr << "-- " << rp_sprintf(C_("rpcli", "Prefetching %u external image(s)..."),
+		static_cast<unsigned int>(requests.size())) << endl;
+	CacheManager cache;
+	const int cached = cache.prefetch(requests);
+	cerr << "-- " << rp_sprintf_p(C_("rpcli", "%1$d of %2$u external image(s) are available in the cache"),
+		cached, static_cast<unsigned int>(requests.size())) << endl;
+}
+
+/**
+ * Scan a single file.
+ * @param filename	[in] Filename.
+ * @param os		[out] Output stream for the JSON object, without the "file" member.
+ * @return ScanResult.
+ */
+static ScanResult scanFileInt(const char *filename, ostringstream &os)
+{
+	// NOTE: The budget covers everything up to and including
+	// the JSON output, since fields and images are loaded lazily.
+	IoBudget budget(budget_max_bytes, budget_max_reads, budget_timeout_ms);
+	const bool use_budget = (budget_max_bytes != 0 || budget_max_reads != 0 || budget_timeout_ms != 0);
+	IoBudget::Scope scope(use_budget ? &budget : nullptr);
+
+	ScanResult result;
+	FileProfile prof;
+	prof.start(FileProfile::PHASE_OPEN);
+	IRpFile *const file = new RpFile(filename, RpFile::FM_OPEN_READ_GZ);
+	if (file->isOpen()) {
+		prof.start(FileProfile::PHASE_DETECT);
+		RomData *const romData = RomDataFactory::create(file);
+		if (romData && romData->isValid()) {
+			prof.load(romData);
+			prof.start(FileProfile::PHASE_OUTPUT);
+			os << JSONROMOutput(romData, true);
+			prof.finish(romData->className());
+			result = SCAN_SUPPORTED;
+			if (prefetchRequests) {
+				addPrefetchRequests(romData);
+			}
+		} else {
+			prof.finish(nullptr);
+			os << JSONErrorOutput("rom is not supported");
+			result = SCAN_UNSUPPORTED;
+		}
+
+		if (romData) {
+			romData->unref();
+		}
+	} else {
+		os << JSONErrorOutput("couldn't open file", file->lastError());
+		result = SCAN_ERROR;
+	}
+	file->unref();
+
+	if (budget.isExceeded()) {
+		// The output may be incomplete.
+		os.str(string());
+		os << JSONErrorOutput("i/o budget exceeded", ECANCELED);
+		result = SCAN_BUDGET;
+	}
+	return result;
+}
+
+/**
+ * Print a JSON object with a "file" member added.
+ * @param os		[out] Output stream.
+ * @param filename	[in] Filename.
+ * @param json		[in] JSON object, without the "file" member.
+ */
+static void printWithFilename(ostream &os, const char *filename, const string &json)
+{
+	os << "{\"file\":" << JSONString(filename);
+	if (json.size() > 2) {
+		os << ',';
+		os.write(json.data() + 1, json.size() - 1);
+	} else {
+		os << '}';
+	}
+}
+
+/**
+ * Scan a single file and print information about it
+ * as a single-line JSON object.
+ * @param filename	[in] Filename.
+ * @param os		[out] Output stream for the JSON object.
+ * @return ScanResult.
+ */
+ScanResult ScanFile(const char *filename, ostream &os)
+{
+	// NOTE: stat() is called before the file is opened, so if the
+	// file changes while it's being scanned, the stored result will
+	// have the old mtime and the file will be rescanned next time.
+	Catalog *const catalog = scanCatalog;
+	struct stat sb;
+	const bool use_catalog = (catalog && stat(filename, &sb) == 0 && S_ISREG(sb.st_mode));
+
+	string json;
+	ScanResult result;
+	if (use_catalog && catalog->lookup(filename, sb, &result, json)) {
+		// File is unchanged.
+		printWithFilename(os, filename, json);
+		return result;
+	}
+
+	ostringstream oss;
+	result = scanFileInt(filename, oss);
+	json = oss.str();
+	if (use_catalog) {
+		catalog->store(filename, sb, result, json);
+	}
+	printWithFilename(os, filename, json);
+	return result;
+}
+
+/**
+ * Set the catalog used by ScanFile().
+ * If set, unchanged files are answered from the catalog
+ * without opening them, and new results are stored in it.
+ * @param catalog Catalog, or nullptr to disable.
+ */
+void SetScanCatalog(Catalog *catalog)
+{
+	scanCatalog = catalog;
+}
+
+/**
+ * Save the catalog used by ScanFile(), if any.
+ * Errors are printed to stderr.
+ */
+void SaveScanCatalog(void)
+{
+	if (!scanCatalog)
+		return;
+
+	const int ret = scanCatalog->save();
+	if (ret != 0) {
+		cerr << "-- " << rp_sprintf(C_("rpcli", "Couldn't save the catalog: %s"), strerror(-ret)) << endl;
+	}
+}
+
+/**
+ * Check if the catalog used by ScanFile() has unsaved changes.
+ * @return True if there is a catalog and it has unsaved changes.
+ */
+bool IsScanCatalogDirty(void)
+{
+	return (scanCatalog && scanCatalog->isDirty());
+}
+
+/**
+ * Set the I/O budget used by ScanFile().
+ * Each file gets its own budget with these limits.
+ * All limits are 0 by default, which disables the budget.
+ * @param max_bytes Maximum number of bytes to read. (0 == unlimited)
+ * @param max_reads Maximum number of read() calls. (0 == unlimited)
+ * @param timeout_ms Maximum time, in milliseconds. (0 == unlimited)
+ */
+void SetScanBudget(uint64_t max_bytes, uint64_t max_reads, unsigned int timeout_ms)
+{
+	budget_max_bytes = max_bytes;
+	budget_max_reads = max_reads;
+	budget_timeout_ms = timeout_ms;
+}
+
+/**
+ * Enable prefetching external images for ScanDirectory().
+ * After all files are scanned, the external images listed
+ * in the output are downloaded into the cache concurrently.
+ * @param prefetch True to enable; false to disable.
+ */
+void SetScanPrefetch(bool prefetch)
+{
+	scan_prefetch = prefetch;
+}
+
+/**
+ * Get the number of worker threads to use.
+ * @param jobs Requested number of worker threads. (0 == number of CPUs)
+ * @return Number of worker threads.
+ */
+unsigned int GetJobCount(unsigned int jobs)
+{
+	if (jobs == 0) {
+		const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		jobs = (cpus > 0 ? static_cast<unsigned int>(cpus) : 1);
+	}
+	return jobs;
+}
+
+/**
+ * Print a summary of scan results to stderr.
+ * @param counts Result counts, indexed by ScanResult.
+ */
+void PrintScanSummary(const unsigned int counts[SCAN_MAX])
+{
+	// tr: Summary printed after scanning multiple files.
+	cerr << "-- " << rp_sprintf_p(C_("rpcli", "Scanned %1$u file(s): %2$u supported, %3$u unsupported, %4$u error(s)"),
+		counts[SCAN_SUPPORTED] + counts[SCAN_UNSUPPORTED] + counts[SCAN_ERROR] + counts[SCAN_BUDGET],
+		counts[SCAN_SUPPORTED], counts[SCAN_UNSUPPORTED], counts[SCAN_ERROR]) << endl;
+	if (counts[SCAN_BUDGET] != 0) {
+		cerr << "-- " << rp_sprintf(C_("rpcli", "%u file(s) exceeded the I/O budget"),
+			counts[SCAN_BUDGET]) << endl;
+	}
+	if (scanCatalog) {
+		cerr << "-- " << rp_sprintf(C_("rpcli", "%u unchanged file(s) were read from the catalog"),
+			scanCatalog->hits()) << endl;
+	}
+}
+
+/**
+ * Worker thread.
+ * @param param ScanState.
+ * @return nullptr
+ */
+static void *scanThread(void *param)
+{
+	ScanState *const st = static_cast<ScanState*>(param);
+	const size_t count = st->files.size();
+
+	for (;;) {
+		size_t idx;
+		{
+			MutexLocker locker(st->mutex);
+			if (st->next_file >= count)
+				break;
+			idx = st->next_file++;
+		}
+
+		ostringstream oss;
+		const ScanResult result = ScanFile(st->files[idx].c_str(), oss);
+
+		MutexLocker locker(st->mutex);
+		st->counts[result]++;
+		if (!st->ordered) {
+			cout << oss.str() << endl;
+			continue;
+		}
+
+		// Print all results that are now available in order.
+		st->results[idx] = oss.str();
+		st->done[idx] = true;
+		for (; st->next_output < count && st->done[st->next_output]; st->next_output++) {
+			cout << st->results[st->next_output] << '\n';
+			string().swap(st->results[st->next_output]);
+		}
+		cout.flush();
+	}
+
+	return nullptr;
+}
+
+/**
+ * Recursively scan a directory and print information about
+ * each file as NDJSON, i.e. one JSON object per line.
+ *
+ * Files are processed by a pool of worker threads.
+ * A summary is printed to stderr once all files are processed.
+ *
+ * @param path Directory to scan.
+ * @param jobs Number of worker threads. (0 == number of CPUs)
+ * @param ordered If true, print results in directory order instead of completion order.
+ * @return 0 on success; non-zero on error.
+ */
+int ScanDirectory(const char *path, unsigned int jobs, bool ordered)
+{
+	cerr << "== " << rp_sprintf(C_("rpcli", "Scanning directory '%s'..."), path) << endl;
+
+	ScanState st;
+	st.ordered = ordered;
+
+	// Remove trailing slashes, except for the root directory.
+	string dirname(path);
+	while (dirname.size() > 1 && dirname[dirname.size()-1] == '/') {
+		dirname.resize(dirname.size()-1);
+	}
+	if (listFiles(dirname, st.files, st.counts[SCAN_ERROR]) != 0) {
+		return EXIT_FAILURE;
+	}
+
+	if (ordered) {
+		st.results.resize(st.files.size());
+		st.done.resize(st.files.size());
+	}
+
+	jobs = GetJobCount(jobs);
+	if (jobs > st.files.size()) {
+		jobs = (st.files.empty() ? 1 : static_cast<unsigned int>(st.files.size()));
+	}
+
+	// Collect external image URLs for prefetching.
+	// NOTE: Files read from the catalog aren't opened,
+	// so their images aren't prefetched.
+	vector<CacheManager::DownloadRequest> requests;
+	if (scan_prefetch) {
+		if (Config::instance()->extImgDownloadEnabled()) {
+			MutexLocker locker(prefetchMutex);
+			prefetchRequests = &requests;
+		} else {
+			cerr << "-- " << C_("rpcli", "External image downloads are disabled; not prefetching.") << endl;
+		}
+	}
+
+	// The current thread is used as one of the workers.
+	vector<pthread_t> threads;
+	threads.reserve(jobs - 1);
+	for (unsigned int i = 1; i < jobs; i++) {
+		pthread_t thread;
+		if (pthread_create(&thread, nullptr, scanThread, &st) != 0)
+			break;
+		threads.push_back(thread);
+	}
+	scanThread(&st);
+	for (auto iter = threads.cbegin(); iter != threads.cend(); ++iter) {
+		pthread_join(*iter, nullptr);
+	}
+	cout.flush();
+
+	if (scan_prefetch) {
+		{
+			MutexLocker locker(prefetchMutex);
+			prefetchRequests = nullptr;
+		}
+		prefetchExtImages(requests);
+	}
+
+	SaveScanCatalog();
+	PrintScanSummary(st.counts);
+	return 0;
+}
@@ -0,0 +1,126 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (rpcli)                            *
+ * scan.hpp: Recursive directory scanning.                                 *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __ROMPROPERTIES_RPCLI_SCAN_HPP__
+#define __ROMPROPERTIES_RPCLI_SCAN_HPP__
+
+// C includes.
+#include <stdint.h>
+
+// C++ includes.
+#include <ostream>
+
+class Catalog;
+
+/**
+ * Result of scanning a single file.
+ */
+enum ScanResult {
+	SCAN_SUPPORTED = 0,	// File is supported.
+	SCAN_UNSUPPORTED,	// File is not supported.
+	SCAN_ERROR,		// File could not be opened.
+	SCAN_BUDGET,		// File exceeded the I/O budget.
+
+	SCAN_MAX
+};
+
+/**
+ * Output options that affect ScanFile() results.
+ * These are hashed into the catalog header, so results
+ * written with different options aren't reused.
+ */
+extern const char SCAN_OUTPUT_OPTIONS[];
+
+/**
+ * Scan a single file and print information about it
+ * as a single-line JSON object.
+ * @param filename	[in] Filename.
+ * @param os		[out] Output stream for the JSON object.
+ * @return ScanResult.
+ */
+ScanResult ScanFile(const char *filename, std::ostream &os);
+
+/**
+ * Set the catalog used by ScanFile().
+ * If set, unchanged files are answered from the catalog
+ * without opening them, and new results are stored in it.
+ * @param catalog Catalog, or nullptr to disable.
+ */
+void SetScanCatalog(Catalog *catalog);
+
+/**
+ * Save the catalog used by ScanFile(), if any.
+ * Errors are printed to stderr.
+ */
+void SaveScanCatalog(void);
+
+/**
+ * Check if the catalog used by ScanFile() has unsaved changes.
+ * @return True if there is a catalog and it has unsaved changes.
+ */
+bool IsScanCatalogDirty(void);
+
+/**
+ * Set the I/O budget used by ScanFile().
+ * Each file gets its own budget with these limits.
+ * All limits are 0 by default, which disables the budget.
+ * @param max_bytes Maximum number of bytes to read. (0 == unlimited)
+ * @param max_reads Maximum number of read() calls. (0 == unlimited)
+ * @param timeout_ms Maximum time, in milliseconds. (0 == unlimited)
+ */
+void SetScanBudget(uint64_t max_bytes, uint64_t max_reads, unsigned int timeout_ms);
+
+/**
+ * Enable prefetching external images for ScanDirectory().
+ * After all files are scanned, the external images listed
+ * in the output are downloaded into the cache concurrently.
+ * @param prefetch True to enable; false to disable.
+ */
+void SetScanPrefetch(bool prefetch);
+
+/**
+ * Get the number of worker threads to use.
+ * @param jobs Requested number of worker threads. (0 == number of CPUs)
+ * @return Number of worker threads.
+ */
+unsigned int GetJobCount(unsigned int jobs);
+
+/**
+ * Print a summary of scan results to stderr.
+ * @param counts Result counts, indexed by ScanResult.
+ */
+void PrintScanSummary(const unsigned int counts[SCAN_MAX]);
+
+/**
+ * Recursively scan a directory and print information about
+ * each file as NDJSON, i.e. one JSON object per line.
+ *
+ * Files are processed by a pool of worker threads.
+ * A summary is printed to stderr once all files are processed.
+ *
+ * @param path Directory to scan.
+ * @param jobs Number of worker threads. (0 == number of CPUs)
+ * @param ordered If true, print results in directory order instead of completion order.
+ * @return 0 on success; non-zero on error.
+ */
+int ScanDirectory(const char *path, unsigned int jobs, bool ordered);
+
+#endif /* __ROMPROPERTIES_RPCLI_SCAN_HPP__ */
@@ -0,0 +1,815 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (rpcli)                            *
+ * serve.cpp: Server mode.                                                  *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+
+#include "stdafx.h"
+#include "config.rpcli.h"
+
+#ifdef _WIN32
+#error This file should only be compiled on Unix-like systems.
+#endif
+
+#include "serve.hpp"
+#include "scan.hpp"
+
+// librpbase
+#include "librpbase/TextFuncs.hpp"
+#include "librpbase/threads/Mutex.hpp"
+#include "librpbase/threads/Semaphore.hpp"
+#include "libi18n/i18n.h"
+using namespace LibRpBase;
+
+// C includes.
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// C includes. (C++ namespace)
+#include <cassert>
+#include <cerrno>
+
+// C++ includes.
+#include <deque>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+using std::cerr;
+using std::cout;
+using std::deque;
+using std::endl;
+using std::map;
+using std::ostringstream;
+using std::pair;
+using std::string;
+using std::vector;
+
+class ServeStream;
+
+/**
+ * Worker thread pool for server mode.
+ *
+ * Requests from all input streams are processed by the same
+ * worker threads. The request queue is bounded; if it's full,
+ * the reader blocks until a worker takes a request.
+ */
+class ServePool
+{
+	public:
+		ServePool();
+		~ServePool();
+
+	private:
+		RP_DISABLE_COPY(ServePool)
+
+	public:
+		/**
+		 * Start the worker threads.
+		 * @param jobs Number of worker threads. (0 == number of CPUs)
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int start(unsigned int jobs);
+
+		/**
+		 * Stop the worker threads once the queue is empty.
+		 */
+		void stop(void);
+
+		/**
+		 * Get the number of worker threads.
+		 * @return Number of worker threads.
+		 */
+		unsigned int jobs(void) const
+		{
+			return static_cast<unsigned int>(m_threads.size());
+		}
+
+		/**
+		 * Queue a request.
+		 * Blocks if the queue is full.
+		 * @param stream Input stream.
+		 * @param seq Request sequence number.
+		 * @param filename Filename. (will be moved)
+		 */
+		void push(ServeStream *stream, uint64_t seq, string &filename);
+
+	private:
+		/**
+		 * Worker thread.
+		 * @param param ServePool.
+		 * @return nullptr
+		 */
+		static void *workerThread(void *param);
+
+	private:
+		struct Request {
+			ServeStream *stream;
+			uint64_t seq;
+			string filename;
+		};
+
+		vector<pthread_t> m_threads;
+
+		// Maximum number of queued requests per worker thread.
+		static const unsigned int QUEUE_SIZE_PER_JOB = 4;
+
+		// Number of free slots in the queue.
+		Semaphore *m_free;
+		// Number of queued requests.
+		// Released once per worker when stopping.
+		Semaphore m_used;
+
+		// Protects m_queue.
+		Mutex m_mutex;
+		deque<Request> m_queue;
+};
+
+/**
+ * Request processor for a single input stream.
+ *
+ * The calling thread reads requests from the input stream
+ * and queues them in a ServePool. The pool's worker threads
+ * process the requests and queue the results, which are
+ * written to the output stream by the stream's own writer
+ * thread. Worker threads never block on the output stream,
+ * so a client that stops reading only stalls its own stream.
+ */
+class ServeStream
+{
+	public:
+		ServeStream(ServePool &pool, int in_fd, int out_fd, bool ordered, char delim);
+
+	private:
+		RP_DISABLE_COPY(ServeStream)
+
+	public:
+		/**
+		 * Process requests until the input stream is closed.
+		 * All requests will have been written when this returns.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int run(void);
+
+		/**
+		 * Get the result counts.
+		 * @return Result counts, indexed by ScanResult.
+		 */
+		const unsigned int *counts(void) const
+		{
+			return m_counts;
+		}
+
+		/**
+		 * Queue a result for the writer thread.
+		 * Called by the pool's worker threads. This never blocks
+		 * on the output stream.
+		 * @param seq Request sequence number.
+		 * @param line JSON object. (will be moved)
+		 * @param result ScanResult.
+		 */
+		void writeResult(uint64_t seq, string &line, ScanResult result);
+
+	private:
+		/**
+		 * Writer thread.
+		 * @param param ServeStream.
+		 * @return nullptr
+		 */
+		static void *writerThread(void *param);
+
+		/**
+		 * Queue a request.
+		 * Blocks if too many requests are outstanding.
+		 * @param filename Filename. (will be moved)
+		 */
+		void addRequest(string &filename);
+
+		/**
+		 * Queue a line for the writer thread.
+		 * Caller must hold m_mutex.
+		 * @param line Line, without the trailing newline. (will be moved)
+		 */
+		void queueLine(string &line);
+
+		/**
+		 * Write a line to the output stream.
+		 * Called by the writer thread.
+		 * @param line Line, without the trailing newline.
+		 */
+		void writeLine(string &line);
+
+	private:
+		ServePool &m_pool;
+		int m_in_fd;
+		int m_out_fd;
+		bool m_ordered;		// Print results in request order.
+		char m_delim;		// Filename delimiter.
+		uint64_t m_nextSeq;	// Next request sequence number. (reader only)
+		bool m_writeError;	// If true, the output stream is closed. (writer only)
+
+		// Maximum number of outstanding requests per worker thread.
+		// A request is outstanding until its result has been written,
+		// so this also limits the number of queued results and, in
+		// ordered mode, the number of results waiting for an earlier
+		// request.
+		static const unsigned int WINDOW_SIZE_PER_JOB = 16;
+
+		// Number of requests that can be queued before
+		// the earliest outstanding result is written.
+		unsigned int m_windowSize;
+		Semaphore m_window;
+
+		// Number of queued lines.
+		// Released once more to stop the writer thread.
+		Semaphore m_outSem;
+
+		// All fields below are protected by m_mutex.
+		Mutex m_mutex;
+		deque<string> m_output;		// Lines to write.
+		unsigned int m_counts[SCAN_MAX];
+
+		// Ordered mode: Results that can't be printed yet.
+		map<uint64_t, string> m_pending;
+		uint64_t m_nextOutput;	// Next result to print.
+};
+
+ServePool::ServePool()
+	: m_free(nullptr)
+	, m_used(0)
+{ }
+
+ServePool::~ServePool()
+{
+	stop();
+}
+
+/**
+ * Start the worker threads.
+ * @param jobs Number of worker threads. (0 == number of CPUs)
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int ServePool::start(unsigned int jobs)
+{
+	assert(m_threads.empty());
+	jobs = GetJobCount(jobs);
+	m_free = new Semaphore(jobs * QUEUE_SIZE_PER_JOB);
+	m_threads.reserve(jobs);
+	for (unsigned int i = 0; i < jobs; i++) {
+		pthread_t thread;
+		int ret = pthread_create(&thread, nullptr, workerThread, this);
+		if (ret != 0) {
+			if (m_threads.empty()) {
+				delete m_free;
+				m_free = nullptr;
+				return -ret;
+			}
+			break;
+		}
+		m_threads.push_back(thread);
+	}
+	return 0;
+}
+
+/**
+ * Stop the worker threads once the queue is empty.
+ */
+void ServePool::stop(void)
+{
+	// Wake up the workers so they can exit once the queue is empty.
+	for (size_t i = 0; i < m_threads.size(); i++) {
+		m_used.release();
+	}
+	for (auto iter = m_threads.cbegin(); iter != m_threads.cend(); ++iter) {
+		pthread_join(*iter, nullptr);
+	}
+	m_threads.clear();
+	delete m_free;
+	m_free = nullptr;
+}
+
+/**
+ * Queue a request.
+ * Blocks if the queue is full.
+ * @param stream Input stream.
+ * @param seq Request sequence number.
+ * @param filename Filename. (will be moved)
+ */
+void ServePool::push(ServeStream *stream, uint64_t seq, string &filename)
+{
+	m_free->obtain();
+	{
+		MutexLocker locker(m_mutex);
+		m_queue.push_back(Request());
+		Request &req = m_queue.back();
+		req.stream = stream;
+		req.seq = seq;
+		req.filename.swap(filename);
+	}
+	m_used.release();
+}
+
+/**
+ * Worker thread.
+ * @param param ServePool.
+ * @return nullptr
+ */
+void *ServePool::workerThread(void *param)
+{
+	ServePool *const pool = static_cast<ServePool*>(param);
+
+	for (;;) {
+		pool->m_used.obtain();
+
+		Request req;
+		{
+			MutexLocker locker(pool->m_mutex);
+			if (pool->m_queue.empty()) {
+				// Stopping.
+				break;
+			}
+			req.stream = pool->m_queue.front().stream;
+			req.seq = pool->m_queue.front().seq;
+			req.filename.swap(pool->m_queue.front().filename);
+			pool->m_queue.pop_front();
+		}
+		pool->m_free->release();
+
+		ostringstream oss;
+		const ScanResult result = ScanFile(req.filename.c_str(), oss);
+		string line = oss.str();
+		req.stream->writeResult(req.seq, line, result);
+	}
+
+	return nullptr;
+}
+
+ServeStream::ServeStream(ServePool &pool, int in_fd, int out_fd, bool ordered, char delim)
+	: m_pool(pool)
+	, m_in_fd(in_fd)
+	, m_out_fd(out_fd)
+	, m_ordered(ordered)
+	, m_delim(delim)
+	, m_nextSeq(0)
+	, m_writeError(false)
+	, m_windowSize(pool.jobs() * WINDOW_SIZE_PER_JOB)
+	, m_window(static_cast<int>(m_windowSize))
+	, m_outSem(0)
+	, m_nextOutput(0)
+{
+	memset(m_counts, 0, sizeof(m_counts));
+}
+
+/**
+ * Process requests until the input stream is closed.
+ * All requests will have been written when this returns.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int ServeStream::run(void)
+{
+	pthread_t writer;
+	int ret = pthread_create(&writer, nullptr, writerThread, this);
+	if (ret != 0) {
+		return -ret;
+	}
+
+	// Read requests until EOF.
+	string filename;
+	char buf[4096];
+	for (;;) {
+		const ssize_t size = read(m_in_fd, buf, sizeof(buf));
+		if (size < 0) {
+			if (errno == EINTR)
+				continue;
+			ret = -errno;
+			break;
+		} else if (size == 0) {
+			// EOF
+			break;
+		}
+
+		const char *p = buf;
+		const char *const p_end = buf + size;
+		while (p < p_end) {
+			const char *const p_delim = static_cast<const char*>(memchr(p, m_delim, p_end - p));
+			if (!p_delim) {
+				// Incomplete request.
+				filename.append(p, p_end - p);
+				break;
+			}
+			filename.append(p, p_delim - p);
+			addRequest(filename);
+			p = p_delim + 1;
+		}
+	}
+	if (ret == 0) {
+		// Allow the last request to be unterminated.
+		addRequest(filename);
+	}
+
+	// Wait for all outstanding requests to be written.
+	for (unsigned int i = 0; i < m_windowSize; i++) {
+		m_window.obtain();
+	}
+	for (unsigned int i = 0; i < m_windowSize; i++) {
+		m_window.release();
+	}
+
+	// Stop the writer thread. The output queue is empty.
+	m_outSem.release();
+	pthread_join(writer, nullptr);
+	return ret;
+}
+
+/**
+ * Writer thread.
+ * @param param ServeStream.
+ * @return nullptr
+ */
+void *ServeStream::writerThread(void *param)
+{
+	ServeStream *const stream = static_cast<ServeStream*>(param);
+
+	for (;;) {
+		stream->m_outSem.obtain();
+
+		string line;
+		{
+			MutexLocker locker(stream->m_mutex);
+			if (stream->m_output.empty()) {
+				// Stopping.
+				break;
+			}
+			line.swap(stream->m_output.front());
+			stream->m_output.pop_front();
+		}
+
+		// NOTE: This may block if the client isn't reading.
+		// Only this stream's reader is throttled by that.
+		stream->writeLine(line);
+		stream->m_window.release();
+	}
+
+	return nullptr;
+}
+
+/**
+ * Queue a request.
+ * Blocks if too many requests are outstanding.
+ * @param filename Filename. (will be moved)
+ */
+void ServeStream::addRequest(string &filename)
+{
+	if (m_delim == '\n' && !filename.empty() && filename[filename.size()-1] == '\r') {
+		// CRLF line ending.
+		filename.resize(filename.size()-1);
+	}
+	if (filename.empty()) {
+		// Ignore empty requests.
+		return;
+	}
+
+	m_window.obtain();
+	m_pool.push(this, m_nextSeq++, filename);
+}
+
+/**
+ * Queue a result for the writer thread.
+ * Called by the pool's worker threads. This never blocks
+ * on the output stream.
+ * @param seq Request sequence number.
+ * @param line JSON object. (will be moved)
+ * @param result ScanResult.
+ */
+void ServeStream::writeResult(uint64_t seq, string &line, ScanResult result)
+{
+	MutexLocker locker(m_mutex);
+	m_counts[result]++;
+	if (!m_ordered) {
+		queueLine(line);
+		return;
+	}
+
+	if (seq != m_nextOutput) {
+		// An earlier request hasn't finished yet.
+		m_pending[seq].swap(line);
+		return;
+	}
+
+	// Print this result and any pending results that follow it.
+	queueLine(line);
+	m_nextOutput++;
+	for (auto iter = m_pending.begin();
+	     iter != m_pending.end() && iter->first == m_nextOutput;
+	     iter = m_pending.erase(iter))
+	{
+		queueLine(iter->second);
+		m_nextOutput++;
+	}
+}
+
+/**
+ * Queue a line for the writer thread.
+ * Caller must hold m_mutex.
+ * @param line Line, without the trailing newline. (will be moved)
+ */
+void ServeStream::queueLine(string &line)
+{
+	m_output.push_back(string());
+	m_output.back().swap(line);
+	m_outSem.release();
+}
+
+/**
+ * Write a line to the output stream.
+ * Called by the writer thread.
+ * @param line Line, without the trailing newline.
+ */
+void ServeStream::writeLine(string &line)
+{
+	if (m_writeError) {
+		// Output stream was closed.
+		return;
+	}
+
+	line += '\n';
+	const char *p = line.data();
+	size_t size = line.size();
+	while (size > 0) {
+		const ssize_t ret = write(m_out_fd, p, size);
+		if (ret < 0) {
+			if (errno == EINTR)
+				continue;
+			m_writeError = true;
+			return;
+		}
+		p += ret;
+		size -= ret;
+	}
+}
+
+/**
+ * Server mode: Read filenames from stdin and print information
+ * about each file to stdout as a single-line JSON object.
+ *
+ * Filenames are separated by delim. Each request results in
+ * exactly one line of output, which includes the filename.
+ * A summary is printed to stderr once stdin is closed.
+ *
+ * @param jobs Number of worker threads. (0 == number of CPUs)
+ * @param ordered If true, print results in request order instead of completion order.
+ * @param delim Filename delimiter. ('\n' or '\0')
+ * @return 0 on success; non-zero on error.
+ */
+int ServeStdin(unsigned int jobs, bool ordered, char delim)
+{
+	// Results are written to the stdout file descriptor directly.
+	cout.flush();
+
+	ServePool pool;
+	int ret = pool.start(jobs);
+	if (ret != 0) {
+		cerr << "-- " << rp_sprintf(C_("rpcli", "Couldn't start the worker threads: %s"), strerror(-ret)) << endl;
+		return EXIT_FAILURE;
+	}
+
+	ServeStream stream(pool, STDIN_FILENO, STDOUT_FILENO, ordered, delim);
+	ret = stream.run();
+	pool.stop();
+	SaveScanCatalog();
+	if (ret != 0) {
+		cerr << "-- " << rp_sprintf(C_("rpcli", "Error reading requests: %s"), strerror(-ret)) << endl;
+	}
+	PrintScanSummary(stream.counts());
+	return (ret == 0 ? 0 : EXIT_FAILURE);
+}
+
+// Interval between catalog saves in socket mode, in seconds.
+static const unsigned int CATALOG_SAVE_INTERVAL = 60;
+
+// Set by the SIGINT and SIGTERM handlers.
+static volatile sig_atomic_t shutdownRequested = 0;
+
+/**
+ * SIGINT and SIGTERM handler for socket mode.
+ * @param sig Signal.
+ */
+static void shutdownHandler(int sig)
+{
+	RP_UNUSED(sig);
+	shutdownRequested = 1;
+}
+
+/**
+ * Block SIGINT and SIGTERM in the calling thread.
+ */
+static void blockShutdownSignals(void)
+{
+	sigset_t set;
+	sigemptyset(&set);
+	sigaddset(&set, SIGINT);
+	sigaddset(&set, SIGTERM);
+	pthread_sigmask(SIG_BLOCK, &set, nullptr);
+}
+
+/**
+ * Catalog thread for socket mode.
+ * Saves the catalog periodically if it has changed.
+ * @param param Unused.
+ * @return nullptr
+ */
+static void *catalogThread(void *param)
+{
+	RP_UNUSED(param);
+	blockShutdownSignals();
+
+	for (;;) {
+		sleep(CATALOG_SAVE_INTERVAL);
+		if (IsScanCatalogDirty()) {
+			SaveScanCatalog();
+		}
+	}
+	return nullptr;
+}
+
+/**
+ * Connection thread parameters.
+ */
+struct ConnectionParam {
+	ServePool *pool;
+	int fd;
+	bool ordered;
+	char delim;
+};
+
+/**
+ * Connection thread.
+ * @param param ConnectionParam. (will be deleted)
+ * @return nullptr
+ */
+static void *connectionThread(void *param)
+{
+	// Shutdown signals are handled by the listening thread.
+	blockShutdownSignals();
+
+	ConnectionParam *const cp = static_cast<ConnectionParam*>(param);
+	{
+		ServeStream stream(*cp->pool, cp->fd, cp->fd, cp->ordered, cp->delim);
+		stream.run();
+	}
+	// NOTE: The catalog is saved by catalogThread(), not here.
+	// Saving it on every disconnect would rewrite the whole
+	// catalog file for each connection.
+	close(cp->fd);
+	delete cp;
+	return nullptr;
+}
+
+/**
+ * Server mode: Listen on a Unix domain socket.
+ *
+ * Each connection is handled the same way as stdin in ServeStdin().
+ * Multiple connections can be handled at the same time, and their
+ * requests are processed by the same worker threads.
+ *
+ * The catalog, if any, is saved periodically while it has unsaved
+ * changes, and when the server is stopped with SIGINT or SIGTERM.
+ * This function only returns on error or when the server is stopped.
+ *
+ * @param path Socket path.
+ * @param jobs Number of worker threads. (0 == number of CPUs)
+ * @param ordered If true, print results in request order instead of completion order.
+ * @param delim Filename delimiter. ('\n' or '\0')
+ * @return 0 if stopped by a signal; non-zero on error.
+ */
+int ServeSocket(const char *path, unsigned int jobs, bool ordered, char delim)
+{
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		cerr << "-- " << rp_sprintf_p(C_("rpcli", "Couldn't listen on '%1$s': %2$s"),
+			path, strerror(ENAMETOOLONG)) << endl;
+		return EXIT_FAILURE;
+	}
+	strcpy(addr.sun_path, path);
+
+	// Clients may disconnect before all results are written.
+	signal(SIGPIPE, SIG_IGN);
+
+	const int sfd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (sfd < 0) {
+		cerr << "-- " << rp_sprintf_p(C_("rpcli", "Couldn't listen on '%1$s': %2$s"),
+			path, strerror(errno)) << endl;
+		return EXIT_FAILURE;
+	}
+
+	// Remove the socket from a previous instance.
+	struct stat sb;
+	if (lstat(path, &sb) == 0 && S_ISSOCK(sb.st_mode)) {
+		unlink(path);
+	}
+
+	if (bind(sfd, reinterpret_cast<const struct sockaddr*>(&addr), sizeof(addr)) != 0 ||
+	    listen(sfd, SOMAXCONN) != 0)
+	{
+		cerr << "-- " << rp_sprintf_p(C_("rpcli", "Couldn't listen on '%1$s': %2$s"),
+			path, strerror(errno)) << endl;
+		close(sfd);
+		return EXIT_FAILURE;
+	}
+
+	// Only this thread handles SIGINT and SIGTERM, so the
+	// threads started here block them. accept() is interrupted
+	// by the signals, since SA_RESTART isn't set.
+	sigset_t sigset;
+	sigemptyset(&sigset);
+	sigaddset(&sigset, SIGINT);
+	sigaddset(&sigset, SIGTERM);
+	pthread_sigmask(SIG_BLOCK, &sigset, nullptr);
+	struct sigaction sa;
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = shutdownHandler;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGINT, &sa, nullptr);
+	sigaction(SIGTERM, &sa, nullptr);
+
+	// NOTE: Connection threads are detached, so the pool
+	// is never deleted; it may still be in use if this
+	// function returns.
+	ServePool *const pool = new ServePool();
+	int ret = pool->start(jobs);
+	if (ret != 0) {
+		cerr << "-- " << rp_sprintf(C_("rpcli", "Couldn't start the worker threads: %s"), strerror(-ret)) << endl;
+		close(sfd);
+		return EXIT_FAILURE;
+	}
+	pthread_t catalog_thread;
+	if (pthread_create(&catalog_thread, nullptr, catalogThread, nullptr) == 0) {
+		pthread_detach(catalog_thread);
+	}
+	pthread_sigmask(SIG_UNBLOCK, &sigset, nullptr);
+	cerr << "== " << rp_sprintf(C_("rpcli", "Listening on '%s'..."), path) << endl;
+
+	ret = EXIT_FAILURE;
+	while (!shutdownRequested) {
+		const int cfd = accept(sfd, nullptr, nullptr);
+		if (cfd < 0) {
+			if (errno == EINTR && shutdownRequested) {
+				ret = 0;
+				break;
+			}
+			if (errno == EINTR || errno == ECONNABORTED)
+				continue;
+			cerr << "-- " << rp_sprintf(C_("rpcli", "Couldn't accept a connection: %s"),
+				strerror(errno)) << endl;
+			break;
+		}
+
+		ConnectionParam *const cp = new ConnectionParam;
+		cp->pool = pool;
+		cp->fd = cfd;
+		cp->ordered = ordered;
+		cp->delim = delim;
+
+		pthread_t thread;
+		if (pthread_create(&thread, nullptr, connectionThread, cp) != 0) {
+			close(cfd);
+			delete cp;
+			continue;
+		}
+		pthread_detach(thread);
+	}
+	if (shutdownRequested) {
+		ret = 0;
+	}
+
+	close(sfd);
+	unlink(path);
+	SaveScanCatalog();
+	return ret;
+}
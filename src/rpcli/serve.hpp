@@ -0,0 +1,60 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (rpcli)                            *
+ * serve.hpp: Server mode.                                                  *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+
+#ifndef __ROMPROPERTIES_RPCLI_SERVE_HPP__
+#define __ROMPROPERTIES_RPCLI_SERVE_HPP__
+
+/**
+ * Server mode: Read filenames from stdin and print information
+ * about each file to stdout as a single-line JSON object.
+ *
+ * Filenames are separated by delim. Each request results in
+ * exactly one line of output, which includes the filename.
+ * A summary is printed to stderr once stdin is closed.
+ *
+ * @param jobs Number of worker threads. (0 == number of CPUs)
+ * @param ordered If true, print results in request order instead of completion order.
+ * @param delim Filename delimiter. ('\n' or '\0')
+ * @return 0 on success; non-zero on error.
+ */
+int ServeStdin(unsigned int jobs, bool ordered, char delim);
+
+/**
+ * Server mode: Listen on a Unix domain socket.
+ *
+ * Each connection is handled the same way as stdin in ServeStdin().
+ * Multiple connections can be handled at the same time, and their
+ * requests are processed by the same worker threads.
+ *
+ * The catalog, if any, is saved periodically while it has unsaved
+ * changes, and when the server is stopped with SIGINT or SIGTERM.
+ * This function only returns on error or when the server is stopped.
+ *
+ * @param path Socket path.
+ * @param jobs Number of worker threads. (0 == number of CPUs)
+ * @param ordered If true, print results in request order instead of completion order.
+ * @param delim Filename delimiter. ('\n' or '\0')
+ * @return 0 if stopped by a signal; non-zero on error.
+ */
+int ServeSocket(const char *path, unsigned int jobs, bool ordered, char delim);
+
+#endif /* __ROMPROPERTIES_RPCLI_SERVE_HPP__ */
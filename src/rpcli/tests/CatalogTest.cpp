@@ -0,0 +1,309 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (rpcli/tests)                      *
+ * CatalogTest.cpp: Incremental result catalog tests.                      *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// rpcli
+#include "config.rpcli.h"
+#include "catalog.hpp"
+
+// librpbase
+#include "librpbase/common.h"
+
+// C includes.
+#include <ftw.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+// C includes. (C++ namespace)
+#include <cstdio>
+
+// C++ includes.
+#include <string>
+using std::string;
+
+namespace RpCli { namespace Tests {
+
+class CatalogTest : public ::testing::Test
+{
+	protected:
+		CatalogTest() { }
+
+		static void SetUpTestCase(void)
+		{
+			// Use a temporary directory for the catalog and keys.conf.
+			// NOTE: XDG_CONFIG_HOME must be set before the config
+			// directory is initialized by FileSystem::getConfigDirectory().
+			char tmpl[] = "/tmp/rp-CatalogTest.XXXXXX";
+			if (mkdtemp(tmpl)) {
+				ms_tmpdir = tmpl;
+				setenv("XDG_CONFIG_HOME", tmpl, 1);
+			}
+		}
+
+		static void TearDownTestCase(void)
+		{
+			// Remove the temporary directory.
+			if (!ms_tmpdir.empty()) {
+				nftw(ms_tmpdir.c_str(), removeEntry, 16, FTW_DEPTH | FTW_PHYS);
+				ms_tmpdir.clear();
+			}
+		}
+
+		void SetUp(void) final
+		{
+			ASSERT_FALSE(ms_tmpdir.empty());
+			const ::testing::TestInfo *const info =
+				::testing::UnitTest::GetInstance()->current_test_info();
+			m_catalog_filename = ms_tmpdir + '/' + info->name() + ".cat";
+		}
+
+		static int removeEntry(const char *fpath, const struct stat *sb, int typeflag, struct FTW *ftwbuf)
+		{
+			RP_UNUSED(sb);
+			RP_UNUSED(typeflag);
+			RP_UNUSED(ftwbuf);
+			return remove(fpath);
+		}
+
+		/**
+		 * Create a file in the temporary directory.
+		 * @param name		[in] Filename, relative to the temporary directory.
+		 * @param contents	[in] File contents.
+		 * @param sb		[out] File status.
+		 * @return Full filename.
+		 */
+		static string createFile(const char *name, const char *contents, struct stat &sb)
+		{
+			string filename = ms_tmpdir + '/' + name;
+			FILE *const f = fopen(filename.c_str(), "wb");
+			EXPECT_TRUE(f != nullptr);
+			if (f) {
+				fputs(contents, f);
+				fclose(f);
+			}
+			EXPECT_EQ(0, stat(filename.c_str(), &sb));
+			return filename;
+		}
+
+		/**
+		 * Open the catalog, store a result for a new file, and save it.
+		 * @param options	[in] Output options.
+		 * @param sb		[out] File status.
+		 * @return Full filename.
+		 */
+		string createCatalog(const char *options, struct stat &sb)
+		{
+			Catalog catalog;
+			EXPECT_EQ(0, catalog.open(m_catalog_filename.c_str(), options));
+			const string filename = createFile("file.bin", "data", sb);
+			catalog.store(filename.c_str(), sb, SCAN_SUPPORTED, "{\"system\":\"Test\"}");
+			EXPECT_EQ(0, catalog.save());
+			return filename;
+		}
+
+		static string ms_tmpdir;
+		string m_catalog_filename;
+};
+
+string CatalogTest::ms_tmpdir;
+
+/**
+ * Stored results are reused if nothing changed.
+ */
+TEST_F(CatalogTest, reload)
+{
+	struct stat sb;
+	const string filename = createCatalog("opts", sb);
+
+	Catalog catalog;
+	ASSERT_EQ(0, catalog.open(m_catalog_filename.c_str(), "opts"));
+	EXPECT_EQ(1U, catalog.count());
+
+	ScanResult result = SCAN_MAX;
+	string json;
+	EXPECT_TRUE(catalog.lookup(filename.c_str(), sb, &result, json));
+	EXPECT_EQ(SCAN_SUPPORTED, result);
+	EXPECT_EQ("{\"system\":\"Test\"}", json);
+	EXPECT_EQ(1U, catalog.hits());
+}
+
+/**
+ * The catalog is discarded if the output options change.
+ */
+TEST_F(CatalogTest, optionsChanged)
+{
+	struct stat sb;
+	createCatalog("opts", sb);
+
+	Catalog catalog;
+	ASSERT_EQ(0, catalog.open(m_catalog_filename.c_str(), "other opts"));
+	EXPECT_EQ(0U, catalog.count());
+}
+
+/**
+ * The catalog is discarded if the language changes.
+ */
+TEST_F(CatalogTest, languageChanged)
+{
+	struct stat sb;
+	createCatalog("opts", sb);
+
+	const char *const old_language = getenv("LANGUAGE");
+	const string old_language_str = (old_language ? old_language : "");
+	setenv("LANGUAGE", "xx_CatalogTest", 1);
+
+	Catalog catalog;
+	EXPECT_EQ(0, catalog.open(m_catalog_filename.c_str(), "opts"));
+	EXPECT_EQ(0U, catalog.count());
+
+	if (old_language) {
+		setenv("LANGUAGE", old_language_str.c_str(), 1);
+	} else {
+		unsetenv("LANGUAGE");
+	}
+}
+
+#ifdef ENABLE_DECRYPTION
+/**
+ * The catalog is discarded if keys.conf changes.
+ */
+TEST_F(CatalogTest, keysChanged)
+{
+	struct stat sb;
+	createCatalog("opts", sb);
+
+	// Create keys.conf with a different mtime.
+	const string config_dir = ms_tmpdir + "/rom-properties";
+	mkdir(config_dir.c_str(), 0700);
+	struct stat keys_sb;
+	const string keys_filename = createFile("rom-properties/keys.conf", "[Keys]\n", keys_sb);
+	struct timeval tv[2] = {{12345678, 0}, {12345678, 0}};
+	ASSERT_EQ(0, utimes(keys_filename.c_str(), tv));
+
+	Catalog catalog;
+	EXPECT_EQ(0, catalog.open(m_catalog_filename.c_str(), "opts"));
+	EXPECT_EQ(0U, catalog.count());
+
+	EXPECT_EQ(0, unlink(keys_filename.c_str()));
+}
+#endif /* ENABLE_DECRYPTION */
+
+/**
+ * Entries for deleted files are removed when the catalog is saved.
+ */
+TEST_F(CatalogTest, pruneDeleted)
+{
+	struct stat sb;
+	const string filename = createCatalog("opts", sb);
+
+	Catalog catalog;
+	ASSERT_EQ(0, catalog.open(m_catalog_filename.c_str(), "opts"));
+	struct stat sb2;
+	const string filename2 = createFile("file2.bin", "data2", sb2);
+	catalog.store(filename2.c_str(), sb2, SCAN_UNSUPPORTED, "{}");
+	EXPECT_EQ(2U, catalog.count());
+
+	ASSERT_EQ(0, unlink(filename.c_str()));
+	ASSERT_EQ(0, catalog.save());
+	EXPECT_EQ(1U, catalog.count());
+
+	Catalog catalog2;
+	ASSERT_EQ(0, catalog2.open(m_catalog_filename.c_str(), "opts"));
+	EXPECT_EQ(1U, catalog2.count());
+	ScanResult result = SCAN_MAX;
+	string json;
+	EXPECT_TRUE(catalog2.lookup(filename2.c_str(), sb2, &result, json));
+	EXPECT_EQ(SCAN_UNSUPPORTED, result);
+
+	EXPECT_EQ(0, unlink(filename2.c_str()));
+}
+
+/**
+ * Renamed files keep their entries.
+ */
+TEST_F(CatalogTest, renamed)
+{
+	struct stat sb;
+	const string filename = createCatalog("opts", sb);
+	const string new_filename = ms_tmpdir + "/renamed.bin";
+	ASSERT_EQ(0, rename(filename.c_str(), new_filename.c_str()));
+
+	Catalog catalog;
+	ASSERT_EQ(0, catalog.open(m_catalog_filename.c_str(), "opts"));
+	ScanResult result = SCAN_MAX;
+	string json;
+	EXPECT_TRUE(catalog.lookup(new_filename.c_str(), sb, &result, json));
+	ASSERT_EQ(0, catalog.save());
+	EXPECT_EQ(1U, catalog.count());
+
+	EXPECT_EQ(0, unlink(new_filename.c_str()));
+}
+
+/**
+ * The catalog is only dirty if it has unsaved changes.
+ */
+TEST_F(CatalogTest, dirty)
+{
+	struct stat sb;
+	const string filename = createCatalog("opts", sb);
+
+	Catalog catalog;
+	ASSERT_EQ(0, catalog.open(m_catalog_filename.c_str(), "opts"));
+	EXPECT_FALSE(catalog.isDirty());
+
+	ScanResult result = SCAN_MAX;
+	string json;
+	EXPECT_TRUE(catalog.lookup(filename.c_str(), sb, &result, json));
+	EXPECT_FALSE(catalog.isDirty());
+
+	catalog.store(filename.c_str(), sb, SCAN_SUPPORTED, "{\"system\":\"Other\"}");
+	EXPECT_TRUE(catalog.isDirty());
+	ASSERT_EQ(0, catalog.save());
+	EXPECT_FALSE(catalog.isDirty());
+
+	// Deleted files are still pruned if nothing else changed.
+	ASSERT_EQ(0, unlink(filename.c_str()));
+	ASSERT_EQ(0, catalog.save());
+	EXPECT_EQ(0U, catalog.count());
+	EXPECT_FALSE(catalog.isDirty());
+
+	Catalog catalog2;
+	ASSERT_EQ(0, catalog2.open(m_catalog_filename.c_str(), "opts"));
+	EXPECT_EQ(0U, catalog2.count());
+}
+
+} }
+
+/**
+ * Test suite main function.
+ */
+extern "C" int gtest_main(int argc, char *argv[])
+{
+	fprintf(stderr, "rpcli test suite: Catalog tests.\n\n");
+	fflush(nullptr);
+
+	// coverity[fun_call_w_exception]: uncaught exceptions cause nonzero exit anyway, so don't warn.
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
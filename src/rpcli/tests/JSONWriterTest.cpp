@@ -0,0 +1,551 @@
+/***************************************************************************
+ * ROM Properties Page shell extension. (rpcli/tests)                      *
+ * JSONWriterTest.cpp: JSON output tests.                                  *
+ *                                                                         *
+ * Copyright (c) 2016-2019 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License       *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// rpcli
+#include "properties.hpp"
+#include "jsonwriter.hpp"
+
+// librpbase
+#include "librpbase/byteswap.h"
+#include "librpbase/RomFields.hpp"
+#include "librpbase/file/RpMemFile.hpp"
+using namespace LibRpBase;
+
+// libromdata
+#include "libromdata/Texture/DirectDrawSurface.hpp"
+#include "libromdata/Texture/dds_structs.h"
+using LibRomData::DirectDrawSurface;
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstring>
+
+// C++ includes.
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+using std::ostringstream;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+namespace RpCli { namespace Tests {
+
+class JSONWriterTest : public ::testing::Test
+{
+	protected:
+		JSONWriterTest() { }
+
+	public:
+		// Number of iterations for benchmarks.
+		static const unsigned int BENCHMARK_ITERATIONS = 10000;
+
+		/**
+		 * Create a RomFields object with every field type.
+		 * @return RomFields object.
+		 */
+		static RomFields *createTestFields(void);
+
+		/**
+		 * Create a DirectDrawSurface object from a synthetic DDS texture.
+		 * @return DirectDrawSurface object, or nullptr on error.
+		 */
+		static DirectDrawSurface *createTestDDS(void);
+
+		/**
+		 * Reference JSON string escaping.
+		 * This is the original ostream-based algorithm, with control
+ * characters other than \b\f\t\n\r escaped as \u00XX.
+		 * @param os Output stream.
+		 * @param str NULL-terminated string.
+		 */
+		static void refEscape(std::ostream &os, const char *str);
+};
+
+// Bit names for RFT_BITFIELD.
+static const char *const bit_names[] = {
+	"Bit 0", "Bit \"1\"", "", "Bit 3",
+};
+
+// Column names for RFT_LISTDATA.
+static const char *const col_names[] = {
+	"Name", "Value\\Path",
+};
+
+/**
+ * Create a RomFields object with every field type.
+ * @return RomFields object.
+ */
+RomFields *JSONWriterTest::createTestFields(void)
+{
+	RomFields *const fields = new RomFields();
+
+	// RFT_STRING
+	fields->addField_string("String", "Hello, world!");
+	fields->addField_string("Monospace", "0123456789ABCDEF", RomFields::STRF_MONOSPACE);
+	fields->addField_string("NULL string", nullptr);
+	fields->addField_string("Empty string", "");
+	fields->addField_string("Escapes", "\"quoted\" back\\slash\b\f\t\n\r end");
+	fields->addField_string("Control", "\x01\x1F\x7F");
+	fields->addField_string("UTF-8", "\xE3\x83\x9D\xE3\x82\xB1\xE3\x83\xA2\xE3\x83\xB3");
+
+	// RFT_BITFIELD
+	const vector<string> *const v_bit_names =
+		RomFields::strArrayToVector(bit_names, ARRAY_SIZE(bit_names));
+	fields->addField_bitfield("Bitfield", v_bit_names, 3, 0x8000000B);
+
+	// RFT_LISTDATA: Headers and checkboxes.
+	const vector<string> *const v_col_names =
+		RomFields::strArrayToVector(col_names, ARRAY_SIZE(col_names));
+	vector<vector<string> > *list_data = new vector<vector<string> >(3);
+	for (int row = 0; row < 3; row++) {
+		vector<string> &data_row = list_data->at(row);
+		data_row.push_back(string("Row ") + static_cast<char>('0' + row));
+		data_row.push_back(string(row, '\t'));
+	}
+	RomFields::AFLD_PARAMS params(RomFields::RFT_LISTDATA_CHECKBOXES, 4);
+	params.headers = v_col_names;
+	params.list_data = list_data;
+	params.mxd.checkboxes = 0x5;
+	fields->addField_listData("ListData", &params);
+
+	// RFT_LISTDATA: No headers.
+	list_data = new vector<vector<string> >(2);
+	list_data->at(0).push_back("One");
+	list_data->at(1).push_back("Two");
+	list_data->at(1).push_back("");
+	params = RomFields::AFLD_PARAMS();
+	params.headers = nullptr;
+	params.list_data = list_data;
+	fields->addField_listData("No headers", &params);
+
+	// RFT_DATETIME
+	fields->addField_dateTime("DateTime", 1234567890,
+		RomFields::RFT_DATETIME_HAS_DATE | RomFields::RFT_DATETIME_HAS_TIME);
+	fields->addField_dateTime("Negative", -1);
+
+	// RFT_AGE_RATINGS
+	RomFields::age_ratings_t age_ratings;
+	age_ratings.fill(0);
+	age_ratings[RomFields::AGE_JAPAN] = RomFields::AGEBF_ACTIVE | 12;
+	age_ratings[RomFields::AGE_USA] = RomFields::AGEBF_ACTIVE | RomFields::AGEBF_PENDING;
+	age_ratings[2] = RomFields::AGEBF_ACTIVE | 3;
+	age_ratings[RomFields::AGE_EUROPE] = 16;	// not active
+	age_ratings[RomFields::AGE_AUSTRALIA] = RomFields::AGEBF_ACTIVE | RomFields::AGEBF_NO_RESTRICTION;
+	fields->addField_ageRatings("Age ratings", age_ratings);
+
+	// RFT_DIMENSIONS
+	fields->addField_dimensions("1D", 256);
+	fields->addField_dimensions("2D", 320, 240);
+	fields->addField_dimensions("3D", 64, 32, 16);
+	fields->addField_dimensions("Missing height", 64, 0, 16);
+
+	return fields;
+}
+
+/**
+ * Create a DirectDrawSurface object from a synthetic DDS texture.
+ * @return DirectDrawSurface object, or nullptr on error.
+ */
+DirectDrawSurface *JSONWriterTest::createTestDDS(void)
+{
+	// DDS: 64x32 DXT1 texture, no mipmaps.
+	const unsigned int dxt1_size = (64 * 32) / 2;
+	vector<uint8_t> buf(4 + sizeof(DDS_HEADER) + dxt1_size, 0x55);
+	memcpy(buf.data(), DDS_MAGIC, 4);
+	DDS_HEADER *const ddsHeader = reinterpret_cast<DDS_HEADER*>(&buf[4]);
+	memset(ddsHeader, 0, sizeof(*ddsHeader));
+	ddsHeader->dwSize = cpu_to_le32(sizeof(*ddsHeader));
+	ddsHeader->dwFlags = cpu_to_le32(DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH |
+	                                 DDSD_PIXELFORMAT | DDSD_LINEARSIZE);
+	ddsHeader->dwHeight = cpu_to_le32(32);
+	ddsHeader->dwWidth = cpu_to_le32(64);
+	ddsHeader->dwPitchOrLinearSize = cpu_to_le32(dxt1_size);
+	ddsHeader->ddspf.dwSize = cpu_to_le32(sizeof(ddsHeader->ddspf));
+	ddsHeader->ddspf.dwFlags = cpu_to_le32(DDPF_FOURCC);
+	ddsHeader->ddspf.dwFourCC = cpu_to_be32(DDPF_FOURCC_DXT1);
+
+	// NOTE: RpMemFile doesn't copy the buffer, and the image is
+	// decoded on demand, so the buffer has to stay valid for as
+	// long as the DirectDrawSurface object exists.
+	static vector<uint8_t> dds_buf;
+	dds_buf.swap(buf);
+
+	RpMemFile *const file = new RpMemFile(dds_buf.data(), dds_buf.size());
+	DirectDrawSurface *dds = new DirectDrawSurface(file);
+	file->unref();
+	if (!dds->isValid()) {
+		dds->unref();
+		dds = nullptr;
+	}
+	return dds;
+}
+
+/**
+ * Reference JSON string escaping.
+ * This is the original ostream-based algorithm, with control
+ * characters other than \b\f\t\n\r escaped as \u00XX.
+ * @param os Output stream.
+ * @param str NULL-terminated string.
+ */
+void JSONWriterTest::refEscape(std::ostream &os, const char *str)
+{
+	os << '"';
+	for (; *str != 0; str++) {
+		switch (*str) {
+			case '\\':	os << "\\\\"; break;
+			case '"':	os << "\\\""; break;
+			case '\b':	os << "\\b"; break;
+			case '\f':	os << "\\f"; break;
+			case '\t':	os << "\\t"; break;
+			case '\n':	os << "\\n"; break;
+			case '\r':	os << "\\r"; break;
+			default:
+				if (static_cast<uint8_t>(*str) < 0x20) {
+					char esc[8];
+					snprintf(esc, sizeof(esc), "\\u%04X", static_cast<uint8_t>(*str));
+					os << esc;
+				} else {
+					os << *str;
+				}
+				break;
+		}
+	}
+	os << '"';
+}
+
+// Expected output for createTestFields().
+static const char fields_expected[] =
+	"[\n"
+	"{\"type\":\"STRING\",\"desc\":{\"name\":\"String\",\"format\":0},\"data\":\"Hello, world!\"},\n"
+	"{\"type\":\"STRING\",\"desc\":{\"name\":\"Monospace\",\"format\":1},\"data\":\"0123456789ABCDEF\"},\n"
+	"{\"type\":\"STRING\",\"desc\":{\"name\":\"NULL string\",\"format\":0},\"data\":0},\n"
+	"{\"type\":\"STRING\",\"desc\":{\"name\":\"Empty string\",\"format\":0},\"data\":\"\"},\n"
+	"{\"type\":\"STRING\",\"desc\":{\"name\":\"Escapes\",\"format\":0},\"data\":\"\\\"quoted\\\" back\\\\slash\\b\\f\\t\\n\\r end\"},\n"
+	"{\"type\":\"STRING\",\"desc\":{\"name\":\"Control\",\"format\":0},\"data\":\"\\u0001\\u001F\x7F\"},\n"
+	"{\"type\":\"STRING\",\"desc\":{\"name\":\"UTF-8\",\"format\":0},\"data\":\"\xE3\x83\x9D\xE3\x82\xB1\xE3\x83\xA2\xE3\x83\xB3\"},\n"
+	"{\"type\":\"BITFIELD\",\"desc\":{\"name\":\"Bitfield\",\"elementsPerRow\":3,\"names\":[\"Bit 0\",\"Bit \\\"1\\\"\",\"Bit 3\"]},\"data\":2147483659},\n"
+	"{\"type\":\"LISTDATA\",\"desc\":{\"name\":\"ListData\",\"names\":[\"checked\",\"Name\",\"Value\\\\Path\"]},\"data\":[[true,\"Row 0\",\"\"],[false,\"Row 1\",\"\\t\"],[true,\"Row 2\",\"\\t\\t\"]]},\n"
+	"{\"type\":\"LISTDATA\",\"desc\":{\"name\":\"No headers\",\"names\":[]},\"data\":[[\"One\"],[\"Two\",\"\"]]},\n"
+	"{\"type\":\"DATETIME\",\"desc\":{\"name\":\"DateTime\",\"flags\":3},\"data\":1234567890},\n"
+	"{\"type\":\"DATETIME\",\"desc\":{\"name\":\"Negative\",\"flags\":0},\"data\":-1},\n"
+	"{\"type\":\"AGE_RATINGS\",\"desc\":{\"name\":\"Age ratings\"},\"data\":[{\"name\":\"CERO\",\"rating\":\"B\"},{\"name\":\"ESRB\",\"rating\":\"RP\"},{\"name\":2,\"rating\":\"3\"},{\"name\":\"ACB\",\"rating\":\"All\"}]},\n"
+	"{\"type\":\"DIMENSIONS\",\"desc\":{\"name\":\"1D\"},\"data\":{\"w\":256}},\n"
+	"{\"type\":\"DIMENSIONS\",\"desc\":{\"name\":\"2D\"},\"data\":{\"w\":320,\"h\":240}},\n"
+	"{\"type\":\"DIMENSIONS\",\"desc\":{\"name\":\"3D\"},\"data\":{\"w\":64,\"h\":32,\"d\":16}},\n"
+	"{\"type\":\"DIMENSIONS\",\"desc\":{\"name\":\"Missing height\"},\"data\":{\"w\":64}}]";
+
+// Expected output for createTestDDS().
+static const char dds_expected[] =
+	"{\"system\":\"DirectDraw Surface\",\"filetype\":\"Texture File\",\"fields\":[\n"
+	"{\"type\":\"DIMENSIONS\",\"desc\":{\"name\":\"Texture Size\"},\"data\":{\"w\":64,\"h\":32}},\n"
+	"{\"type\":\"STRING\",\"desc\":{\"name\":\"Linear Size\",\"format\":0},\"data\":\"1024\"},\n"
+	"{\"type\":\"STRING\",\"desc\":{\"name\":\"Mipmap Count\",\"format\":0},\"data\":\"0\"},\n"
+	"{\"type\":\"STRING\",\"desc\":{\"name\":\"Pixel Format\",\"format\":0},\"data\":\"DXT1\"},\n"
+	"{\"type\":\"STRING\",\"desc\":{\"name\":\"DX10 Format\",\"format\":0},\"data\":\"BC1_UNORM\"},\n"
+	"{\"type\":\"BITFIELD\",\"desc\":{\"name\":\"Flags\",\"elementsPerRow\":3,\"names\":[\"Caps\",\"Height\",\"Width\",\"Pitch\",\"Pixel Format\",\"Mipmap Count\",\"Linear Size\",\"Depth\"]},\"data\":528391},\n"
+	"{\"type\":\"BITFIELD\",\"desc\":{\"name\":\"Caps\",\"elementsPerRow\":3,\"names\":[\"Complex\",\"Texture\",\"Mipmap\"]},\"data\":0},\n"
+	"{\"type\":\"BITFIELD\",\"desc\":{\"name\":\"Caps2\",\"elementsPerRow\":4,\"names\":[\"Cubemap\",\"+X\",\"-X\",\"+Y\",\"-Y\",\"+Z\",\"-Z\",\"Volume\"]},\"data\":0}],\n"
+	"\"imgint\":[{\"type\":\"Internal image\",\"format\":\"ARGB32\",\"size\":[64,32],\"postprocessing\":4}]}";
+
+/**
+ * Remove the newlines that are only present in non-compact output.
+ * @param str Non-compact JSON output.
+ * @return Compact JSON output.
+ */
+static string toCompact(const char *str)
+{
+	// NOTE: All newlines in string values are escaped,
+	// so any raw newline is a separator.
+	string ret;
+	for (; *str != 0; str++) {
+		if (*str != '\n') {
+			ret += *str;
+		}
+	}
+	return ret;
+}
+
+/**
+ * Test JSONFieldsOutput with every field type.
+ */
+TEST_F(JSONWriterTest, fieldsOutput)
+{
+	unique_ptr<RomFields> fields(createTestFields());
+
+	ostringstream oss;
+	oss << JSONFieldsOutput(*fields);
+	EXPECT_EQ(string(fields_expected), oss.str());
+
+	oss.str(string());
+	oss << JSONFieldsOutput(*fields, true);
+	EXPECT_EQ(toCompact(fields_expected), oss.str());
+}
+
+/**
+ * Test JSONROMOutput with a DirectDrawSurface object.
+ */
+TEST_F(JSONWriterTest, romOutput)
+{
+	DirectDrawSurface *const dds = createTestDDS();
+	ASSERT_TRUE(dds != nullptr);
+
+	ostringstream oss;
+	oss << JSONROMOutput(dds);
+	EXPECT_EQ(string(dds_expected), oss.str());
+
+	oss.str(string());
+	oss << JSONROMOutput(dds, true);
+	EXPECT_EQ(toCompact(dds_expected), oss.str());
+
+	dds->unref();
+}
+
+/**
+ * Test JSONErrorOutput and JSONString.
+ */
+TEST_F(JSONWriterTest, errorOutput)
+{
+	ostringstream oss;
+	oss << JSONErrorOutput("Error \"message\"\n", -5) << JSONErrorOutput(nullptr);
+	EXPECT_EQ("{\"error\":\"Error \\\"message\\\"\\n\",\"code\":-5}{\"error\":0}", oss.str());
+
+	oss.str(string());
+	oss << JSONString("file\\name.bin") << ' ' << JSONString(nullptr);
+	EXPECT_EQ("\"file\\\\name.bin\" 0", oss.str());
+}
+
+/**
+ * Test integer formatting.
+ */
+TEST_F(JSONWriterTest, integers)
+{
+	ostringstream oss;
+	{
+		JSONWriter json(oss);
+		json.writeInt(0);
+		json.put(',');
+		json.writeInt(-1);
+		json.put(',');
+		json.writeInt(INT64_MIN);
+		json.put(',');
+		json.writeInt(INT64_MAX);
+		json.put(',');
+		json.writeUInt(UINT64_MAX);
+	}
+	EXPECT_EQ("0,-1,-9223372036854775808,9223372036854775807,18446744073709551615", oss.str());
+}
+
+/**
+ * Compare string escaping to the original algorithm
+ * using pseudo-random strings.
+ */
+TEST_F(JSONWriterTest, escapeRandom)
+{
+	// Characters are biased towards special characters.
+	static const char charset[] = "abcXYZ019 \"\\\b\f\t\n\r\x01\x1F\x7F\x80\xFF";
+
+	// Simple LCG for reproducible strings.
+	uint32_t seed = 0x12345678;
+	char str[80];
+	for (unsigned int i = 0; i < 4096; i++) {
+		seed = seed * 1103515245 + 12345;
+		const unsigned int len = (seed >> 16) % (sizeof(str) - 1);
+		for (unsigned int j = 0; j < len; j++) {
+			seed = seed * 1103515245 + 12345;
+			str[j] = charset[(seed >> 16) % (sizeof(charset) - 1)];
+		}
+		str[len] = '\0';
+
+		ostringstream oss_ref;
+		refEscape(oss_ref, str);
+		ostringstream oss;
+		oss << JSONString(str);
+		ASSERT_EQ(oss_ref.str(), oss.str()) << "iteration " << i;
+	}
+}
+
+/**
+ * Test string escaping with strings larger than the buffer.
+ */
+TEST_F(JSONWriterTest, escapeLarge)
+{
+	// Plain string, longer than the buffer.
+	string str(10000, 'x');
+	ostringstream oss_ref;
+	refEscape(oss_ref, str.c_str());
+	ostringstream oss;
+	oss << JSONString(str.c_str());
+	EXPECT_EQ(oss_ref.str(), oss.str());
+
+	// Lots of escaped characters.
+	for (size_t i = 0; i < str.size(); i += 3) {
+		str[i] = '"';
+	}
+	oss_ref.str(string());
+	refEscape(oss_ref, str.c_str());
+	oss.str(string());
+	oss << JSONString(str.c_str());
+	EXPECT_EQ(oss_ref.str(), oss.str());
+}
+
+/**
+ * Test escaping of every control character.
+ * Short strings are handled entirely by the scalar path;
+ * long strings go through the SSE2 path, if available.
+ */
+TEST_F(JSONWriterTest, escapeControl)
+{
+	for (unsigned int chr = 0x01; chr < 0x20; chr++) {
+		const char *expected_esc;
+		char esc[8];
+		switch (chr) {
+			case '\b':	expected_esc = "\\b"; break;
+			case '\f':	expected_esc = "\\f"; break;
+			case '\t':	expected_esc = "\\t"; break;
+			case '\n':	expected_esc = "\\n"; break;
+			case '\r':	expected_esc = "\\r"; break;
+			default:
+				snprintf(esc, sizeof(esc), "\\u%04X", chr);
+				expected_esc = esc;
+				break;
+		}
+
+		// Short string.
+		string str(1, static_cast<char>(chr));
+		ostringstream oss;
+		oss << JSONString(str.c_str());
+		EXPECT_EQ('"' + string(expected_esc) + '"', oss.str()) << "chr == " << chr;
+
+		// Long string, with the control character in the middle of a 16-byte block.
+		str = string(32, 'x');
+		str[5] = static_cast<char>(chr);
+		oss.str(string());
+		oss << JSONString(str.c_str());
+		EXPECT_EQ('"' + string(5, 'x') + expected_esc + string(26, 'x') + '"', oss.str()) << "chr == " << chr;
+	}
+}
+
+/**
+ * Test findSpecial() with special characters at every position.
+ */
+TEST_F(JSONWriterTest, findSpecial)
+{
+	static const char special[] = "\"\\\x00\x01\x1F";
+	char buf[64];
+
+	// Every byte below 0x20 is special; 0x20 and above aren't,
+	// other than '"' and '\\'.
+	for (unsigned int chr = 0; chr < 0x100; chr++) {
+		memset(buf, ' ', sizeof(buf));
+		buf[sizeof(buf) - 1] = static_cast<char>(chr);
+		const bool is_special = (chr < 0x20 || chr == '"' || chr == '\\');
+		const size_t expected = (is_special ? sizeof(buf) - 1 : sizeof(buf));
+		EXPECT_EQ(expected, JSONWriter::findSpecial_cpp(buf, sizeof(buf))) << "chr == " << chr;
+#ifdef JSONWRITER_HAS_SSE2
+		EXPECT_EQ(expected, JSONWriter::findSpecial_sse2(buf, sizeof(buf))) << "chr == " << chr;
+#endif /* JSONWRITER_HAS_SSE2 */
+	}
+
+	for (size_t len = 0; len <= sizeof(buf); len++) {
+		// No special characters.
+		memset(buf, 0x7F, sizeof(buf));
+		EXPECT_EQ(len, JSONWriter::findSpecial_cpp(buf, len));
+#ifdef JSONWRITER_HAS_SSE2
+		EXPECT_EQ(len, JSONWriter::findSpecial_sse2(buf, len));
+#endif /* JSONWRITER_HAS_SSE2 */
+
+		// One special character at each position.
+		for (size_t pos = 0; pos < len; pos++) {
+			for (size_t k = 0; k < sizeof(special) - 1; k++) {
+				memset(buf, ' ', sizeof(buf));
+				buf[pos] = special[k];
+				// Second special character after the first one.
+				if (pos + 5 < len) {
+					buf[pos + 5] = '"';
+				}
+				EXPECT_EQ(pos, JSONWriter::findSpecial_cpp(buf, len));
+#ifdef JSONWRITER_HAS_SSE2
+				EXPECT_EQ(pos, JSONWriter::findSpecial_sse2(buf, len));
+#endif /* JSONWRITER_HAS_SSE2 */
+			}
+		}
+	}
+}
+
+/**
+ * Benchmark JSONFieldsOutput.
+ */
+TEST_F(JSONWriterTest, fieldsOutput_benchmark)
+{
+	unique_ptr<RomFields> fields(createTestFields());
+	ostringstream oss;
+	for (unsigned int i = BENCHMARK_ITERATIONS; i > 0; i--) {
+		oss.str(string());
+		oss << JSONFieldsOutput(*fields);
+	}
+	EXPECT_EQ(string(fields_expected), oss.str());
+}
+
+/**
+ * Benchmark the original ostream-based string escaping.
+ */
+TEST_F(JSONWriterTest, escape_ostream_benchmark)
+{
+	const string str = string(1024, 'x') + "\"\n" + string(1024, 'y');
+	ostringstream oss;
+	for (unsigned int i = BENCHMARK_ITERATIONS; i > 0; i--) {
+		oss.str(string());
+		refEscape(oss, str.c_str());
+	}
+}
+
+/**
+ * Benchmark JSONWriter string escaping.
+ */
+TEST_F(JSONWriterTest, escape_JSONWriter_benchmark)
+{
+	const string str = string(1024, 'x') + "\"\n" + string(1024, 'y');
+	ostringstream oss;
+	for (unsigned int i = BENCHMARK_ITERATIONS; i > 0; i--) {
+		oss.str(string());
+		JSONWriter json(oss);
+		json.writeString(str);
+	}
+}
+
+} }
+
+/**
+ * Test suite main function.
+ */
+extern "C" int gtest_main(int argc, char *argv[])
+{
+	fprintf(stderr, "rpcli test suite: JSONWriter tests.\n\n");
+	fflush(nullptr);
+
+	// coverity[fun_call_w_exception]: uncaught exceptions cause nonzero exit anyway, so don't warn.
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,120 @@
+#!/usr/bin/env python
+# ROM Properties Page shell extension. (rpcli/tests)
+# ScanJSONTest.py: Validate `rpcli -r` output with a JSON parser.
+#
+# Copyright (c) 2016-2019 by David Korth.
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the
+# Free Software Foundation; either version 2 of the License, or (at your
+# option) any later version.
+#
+# This program is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# Usage: ScanJSONTest.py /path/to/rpcli
+#
+# Creates a directory with a synthetic GameCube disc image, which has
+# control characters in its title and external image URLs, and a file
+# with a control character in its name. `rpcli -r` is run on it, and
+# every output line is parsed using Python's json module in strict mode,
+# which rejects unescaped control characters.
+
+from __future__ import print_function
+
+import json
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+
+def create_gcn(filename):
+	"""Create a synthetic GameCube disc image."""
+	header = bytearray(0x440)
+	header[0:6] = b'GALE01'
+	header[0x1C:0x20] = struct.pack('>I', 0xC2339F3D)
+	title = b'Test\x01Game\x1Fend'
+	header[0x20:0x20+len(title)] = title
+	with open(filename, 'wb') as f:
+		f.write(bytes(header))
+		f.write(b'\0' * 0x10000)
+
+def check(cond, msg):
+	if not cond:
+		print('FAIL: ' + msg, file=sys.stderr)
+		sys.exit(1)
+
+def run_scan(rpcli, scandir, args, env=None):
+	"""Run `rpcli -r` and parse each output line."""
+	proc = subprocess.Popen([rpcli] + args + ['-r', scandir],
+		stdout=subprocess.PIPE, stderr=subprocess.PIPE, env=env)
+	out, err = proc.communicate()
+	sys.stderr.write(err.decode('utf-8', 'replace'))
+	check(proc.returncode == 0, 'rpcli returned %d' % proc.returncode)
+
+	records = {}
+	for line in out.decode('utf-8').splitlines():
+		try:
+			obj = json.loads(line)
+		except ValueError as e:
+			check(False, 'invalid JSON: %s\n%r' % (e, line))
+		check(isinstance(obj, dict), 'not an object: %r' % line)
+		records[os.path.basename(obj['file'])] = obj
+	return records
+
+def main(argv):
+	if len(argv) != 2:
+		print('Usage: %s /path/to/rpcli' % argv[0], file=sys.stderr)
+		return 2
+	rpcli = argv[1]
+
+	scandir = tempfile.mkdtemp(prefix='rpcli-scan-')
+	confdir = tempfile.mkdtemp(prefix='rpcli-conf-')
+	try:
+		# Disable external image downloads for --prefetch.
+		os.mkdir(os.path.join(confdir, 'rom-properties'))
+		with open(os.path.join(confdir, 'rom-properties', 'rom-properties.conf'), 'w') as f:
+			f.write('[Downloads]\nExtImageDownload=false\n')
+		env = dict(os.environ)
+		env['XDG_CONFIG_HOME'] = confdir
+
+		create_gcn(os.path.join(scandir, 'gcn.iso'))
+		with open(os.path.join(scandir, 'ctrl\x02name.bin'), 'wb') as f:
+			f.write(b'not a rom')
+
+		for args in (['-J1'], ['-J2', '-s'], ['-J2', '--prefetch']):
+			records = run_scan(rpcli, scandir, args, env)
+			check(len(records) == 2, 'expected 2 records, got %d' % len(records))
+
+			ctrl = records.get(u'ctrl\x02name.bin')
+			check(ctrl is not None, 'missing record for ctrl\\x02name.bin')
+			check('error' in ctrl, 'ctrl\\x02name.bin should be unsupported')
+
+			gcn = records.get(u'gcn.iso')
+			check(gcn is not None, 'missing record for gcn.iso')
+			titles = [field['data'] for field in gcn['fields'] if field['desc']['name'] == 'Title']
+			check(titles == [u'Test\x01Game\x1Fend'], 'unexpected title: %r' % titles)
+
+			imgext = gcn.get('imgext')
+			check(imgext, 'gcn.iso has no external images')
+			for img in imgext:
+				check(isinstance(img['type'], type(u'')), 'bad imgext type: %r' % img)
+				check(img['exturls'], 'empty exturls: %r' % img)
+				for url in img['exturls']:
+					check(sorted(url.keys()) == ['cache_key', 'url'], 'bad exturl: %r' % url)
+	finally:
+		shutil.rmtree(scandir)
+		shutil.rmtree(confdir)
+
+	print('PASS')
+	return 0
+
+if __name__ == '__main__':
+	sys.exit(main(sys.argv))
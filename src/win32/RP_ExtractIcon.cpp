@@ -28,8 +28,10 @@
 #include "librpbase/TextFuncs.hpp"
 #include "librpbase/TextFuncs_wchar.hpp"
 #include "librpbase/file/RpFile.hpp"
+#include "librpbase/file/IoBudget.hpp"
 #include "librpbase/img/rp_image.hpp"
 #include "librpbase/img/RpGdiplusBackend.hpp"
+#include "librpbase/config/Config.hpp"
 using namespace LibRpBase;
 
 // libromdata
@@ -165,6 +167,11 @@ IFACEMETHODIMP RP_ExtractIcon::Load(LPCOLESTR pszFileName, DWORD dwMode)
 		}
 	}
 
+	// Limit the I/O used for the ROM image.
+	const IoBudget::Limits budgetLimits = Config::instance()->ioBudget();
+	IoBudget budget(budgetLimits);
+	IoBudget::Scope budgetScope(budgetLimits.isEnabled() ? &budget : nullptr);
+
 	// Attempt to open the ROM file.
 	RpFile *file = new RpFile(d->filename, RpFile::FM_OPEN_READ_GZ);
 	if (!file->isOpen()) {
@@ -270,6 +277,10 @@ IFACEMETHODIMP RP_ExtractIcon::Extract(LPCWSTR pszFile, UINT nIconIndex,
 	}
 
 	// ROM is supported. Get the image.
+	// Limit the I/O used for the ROM image.
+	const IoBudget::Limits budgetLimits = Config::instance()->ioBudget();
+	IoBudget budget(budgetLimits);
+	IoBudget::Scope budgetScope(budgetLimits.isEnabled() ? &budget : nullptr);
 	// TODO: Small icon?
 	HBITMAP hBmpImage = nullptr;
 	int ret = d->thumbnailer.getThumbnail(d->romData, LOWORD(nIconSize), hBmpImage);
@@ -261,7 +261,8 @@ IFACEMETHODIMP RP_PropertyStore::Initialize(IStream *pstream, DWORD grfMode)
 	d->grfMode = grfMode;
 
 	// Attempt to create a RomData object.
-	d->romData = RomDataFactory::create(file);
+	// Only metadata is needed, so use metadata-only mode.
+	d->romData = RomDataFactory::create(file, RomDataFactory::RDA_METADATA_ONLY);
 	if (!d->romData) {
 		// No RomData.
 		return E_FAIL;
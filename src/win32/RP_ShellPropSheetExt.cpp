@@ -40,7 +40,9 @@ using LibWin32Common::AutoGetDC;
 #include "librpbase/TextFuncs.hpp"
 #include "librpbase/TextFuncs_wchar.hpp"
 #include "librpbase/file/RpFile.hpp"
+#include "librpbase/file/IoBudget.hpp"
 #include "librpbase/img/rp_image.hpp"
+#include "librpbase/config/Config.hpp"
 using namespace LibRpBase;
 
 // libi18n
@@ -1907,13 +1909,13 @@ void RP_ShellPropSheetExt_Private::initDialog(HWND hDlg)
 		if (!field || !field->isValid) {
 			t_desc_text.push_back(tstring());
 			continue;
-		} else if (field->name.empty()) {
+		} else if (!field->name || field->name[0] == '\0') {
 			t_desc_text.push_back(tstring());
 			continue;
 		}
 
 		const tstring desc_text = U82T_s(rp_sprintf(
-			desc_label_fmt, field->name.c_str()));
+			desc_label_fmt, field->name));
 
 		// Get the width of this specific entry.
 		// TODO: Use measureTextSize()?
@@ -2297,6 +2299,11 @@ IFACEMETHODIMP RP_ShellPropSheetExt::Initialize(
 	RpFile *file = nullptr;
 	RomData *romData = nullptr;
 
+	// Limit the I/O used for the ROM image.
+	const IoBudget::Limits budgetLimits = Config::instance()->ioBudget();
+	IoBudget budget(budgetLimits);
+	IoBudget::Scope budgetScope(budgetLimits.isEnabled() ? &budget : nullptr);
+
 	// Determine how many files are involved in this operation. This
 	// code sample displays the custom context menu item when only
 	// one file is selected.
@@ -2760,6 +2767,11 @@ INT_PTR CALLBACK RP_ShellPropSheetExt_Private::DlgProc(HWND hDlg, UINT uMsg, WPA
 				break;
 			}
 
+			// Limit the I/O used for the ROM image.
+			const IoBudget::Limits budgetLimits = Config::instance()->ioBudget();
+			IoBudget budget(budgetLimits);
+			IoBudget::Scope budgetScope(budgetLimits.isEnabled() ? &budget : nullptr);
+
 			// Open the RomData object.
 			RpFile *const file = new RpFile(d->filename, RpFile::FM_OPEN_READ_GZ);
 			if (!file->isOpen()) {
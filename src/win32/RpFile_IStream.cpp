@@ -26,6 +26,7 @@
 #include "librpbase/TextFuncs.hpp"
 #include "librpbase/TextFuncs_wchar.hpp"
 #include "librpbase/file/IRpFile.hpp"
+#include "librpbase/file/IoBudget.hpp"
 using namespace LibRpBase;
 
 // C++ includes.
@@ -266,6 +267,13 @@ size_t RpFile_IStream::read(void *ptr, size_t size)
 		return 0;
 	}
 
+	// Check the I/O budget.
+	const int budget_err = IoBudget::checkRead(size);
+	if (budget_err != 0) {
+		m_lastError = -budget_err;
+		return 0;
+	}
+
 	if (m_pZstm) {
 		// Read and decompress.
 		// Reference: https://www.codeproject.com/Articles/3602/Zlib-compression-decompression-wrapper-as-ISequent
@@ -428,6 +436,13 @@ int RpFile_IStream::seek(int64_t pos)
 		return -1;
 	}
 
+	// Check the I/O budget.
+	const int budget_err = IoBudget::checkSeek();
+	if (budget_err != 0) {
+		m_lastError = -budget_err;
+		return -1;
+	}
+
 	if (m_pZstm) {
 		// zlib stream: Special seek handling.
 		if (pos == m_z_filepos) {
@@ -606,6 +606,13 @@ int CacheTabPrivate::recursiveScan(const TCHAR *path, vector<pair<tstring, DWORD
 				return -EIO;
 			}
 
+			// Cache metadata files. (CacheMetadata)
+			if (len > 7 && !_tcsicmp(&findFileData.cFileName[len-7], _T(".rpmeta")))
+				goto isok;
+			// Scaled images. (CacheManager::storeScaledImage())
+			if (len > 6 && !_tcsicmp(&findFileData.cFileName[len-6], _T(".rpimg")))
+				goto isok;
+
 			pExt = &findFileData.cFileName[len-4];
 			if (_tcsicmp(pExt, _T(".png")) != 0 &&
 			    _tcsicmp(pExt, _T(".jpg")) != 0)